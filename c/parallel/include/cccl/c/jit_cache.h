@@ -0,0 +1,45 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA Core Compute Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#ifndef CCCL_C_EXPERIMENTAL
+#  error "C exposure is experimental and subject to change. Define CCCL_C_EXPERIMENTAL to acknowledge this notice."
+#endif // !CCCL_C_EXPERIMENTAL
+
+#include <cuda.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cccl/c/extern_c.h>
+#include <cccl/c/types.h>
+
+CCCL_C_EXTERN_C_BEGIN
+
+// The cccl_device_*_build functions cache the results of NVRTC and nvJitLink on disk, so that a process building the
+// same algorithms as a previous one skips the compilation. By default, the cache lives in
+// $CCCL_C_PARALLEL_CACHE_DIR, or else in $XDG_CACHE_HOME/cccl/c.parallel (%LOCALAPPDATA%\cccl\c.parallel on Windows),
+// and holds up to $CCCL_C_PARALLEL_CACHE_MAXSIZE bytes (1 GiB by default). Setting CCCL_C_PARALLEL_CACHE_DISABLE=1
+// disables it.
+
+// Moves the cache to another directory, which is created on demand. A null directory disables the cache.
+CCCL_C_API CUresult cccl_jit_cache_set_directory(const char* directory);
+
+// Bounds the total size of the cached build results, evicting the least recently used ones
+CCCL_C_API CUresult cccl_jit_cache_set_max_size(uint64_t max_size);
+
+// Imports the build results of another cache directory, e.g. one populated ahead of time by running the builds of an
+// application with the same toolkit. `num_imported` may be null.
+CCCL_C_API CUresult cccl_jit_cache_prewarm(const char* source_directory, size_t* num_imported);
+
+// Removes every cached build result
+CCCL_C_API CUresult cccl_jit_cache_clear(void);
+
+CCCL_C_EXTERN_C_END
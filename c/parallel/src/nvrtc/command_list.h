@@ -16,16 +16,22 @@
 #include <cstring>
 #include <iostream>
 #include <memory>
+#include <stdexcept>
+#include <string>
 #include <string_view>
 #include <unordered_map>
+#include <utility>
 #include <variant>
 #include <vector>
 
+#include <cuda/std/version>
+
 #include <nvrtc.h>
 
 #include <nvrtc/command_list_mixins.h>
 #include <nvrtc/nvjitlink_helper.h>
 #include <util/errors.h>
+#include <util/jit_cache.h>
 
 struct nvrtc_ptx
 {
@@ -138,6 +144,19 @@ struct nvrtc2_lto_context
   nvrtcProgram program{};
   nvrtc_compile compile_args{};
   std::string_view program_name = "test";
+
+  // The inputs of the compilation, which are recorded until compile_program() looks them up in the JIT cache
+  std::string_view program_source{};
+  std::string_view program_source_name{};
+  std::vector<std::string_view> expressions{};
+
+  // The results of the compilation, taken from the JIT cache or from the program once it is compiled. The program is
+  // only kept alive when it produced no LTO-IR, in which case nothing is cached.
+  std::string ltoir{};
+  std::unordered_map<std::string, std::string> lowered_names{};
+
+  // The inputs of the link, i.e. the link options and every linked LTO-IR
+  cccl::detail::jit_cache_key link_key{};
 };
 
 using nvrtc2_top_level_nl   = node_list<nvrtc2_lto_context, nvrtc2_top_level>;
@@ -149,6 +168,20 @@ inline nvrtc2_top_level_nl begin_linking_nvrtc_program(uint32_t numLtoOpts, cons
 {
   nvrtc2_lto_context context{nvrtc_jitlink(numLtoOpts, ltoOpts)};
 
+  unsigned int nvjitlink_major{};
+  unsigned int nvjitlink_minor{};
+  check(nvJitLinkVersion(&nvjitlink_major, &nvjitlink_minor));
+
+  context.link_key.add("nvJitLink")
+    .add(std::uint64_t{CCCL_VERSION})
+    .add(std::uint64_t{nvjitlink_major})
+    .add(std::uint64_t{nvjitlink_minor})
+    .add(std::uint64_t{numLtoOpts});
+  for (uint32_t i = 0; i < numLtoOpts; ++i)
+  {
+    context.link_key.add(ltoOpts[i]);
+  }
+
   return {std::move(context)};
 }
 
@@ -161,9 +194,20 @@ struct nvrtc2_post_build
 
   inline nvrtc2_post_build_nl get_name(nvrtc_get_name gn)
   {
-    const char* lowered_name;
-    check(nvrtcGetLoweredName(context.program, gn.name.data(), &lowered_name));
-    gn.lowered_name = lowered_name;
+    if (context.program)
+    {
+      const char* lowered_name;
+      check(nvrtcGetLoweredName(context.program, gn.name.data(), &lowered_name));
+      gn.lowered_name = lowered_name;
+      return {std::move(context)};
+    }
+
+    auto it = context.lowered_names.find(std::string(gn.name));
+    if (it == context.lowered_names.end())
+    {
+      throw std::runtime_error("NVRTC error: no name expression " + std::string(gn.name) + " was added");
+    }
+    gn.lowered_name = it->second;
     return {std::move(context)};
   }
 
@@ -200,12 +244,20 @@ struct nvrtc2_post_build
     auto [ltoir_size, ltoir] = get_ltoir();
     check(nvJitLinkAddData(
       context.jit.handle, NVJITLINK_INPUT_LTOIR, ltoir.get(), ltoir_size, context.program_name.data()));
+    context.link_key.add(std::string_view(ltoir.get(), ltoir_size));
     return cleanup_program();
   }
 
 private:
   inline std::pair<std::size_t, std::unique_ptr<char[]>> get_ltoir()
   {
+    if (!context.program)
+    {
+      std::unique_ptr<char[]> ltoir{new char[context.ltoir.size()]};
+      std::memcpy(ltoir.get(), context.ltoir.data(), context.ltoir.size());
+      return {context.ltoir.size(), std::move(ltoir)};
+    }
+
     std::size_t ltoir_size{};
     check(nvrtcGetLTOIRSize(context.program, &ltoir_size));
     std::unique_ptr<char[]> ltoir{new char[ltoir_size]};
@@ -216,7 +268,10 @@ private:
 
   inline nvrtc2_top_level_nl cleanup_program()
   {
-    nvrtcDestroyProgram(&context.program);
+    if (context.program)
+    {
+      nvrtcDestroyProgram(&context.program);
+    }
     return {std::move(context)};
   }
 };
@@ -231,7 +286,7 @@ struct nvrtc2_pre_build
   // Add expression before compiling (instantiates global kernel declared in unit)
   inline nvrtc2_pre_build_nl add_expression(nvrtc_expression arg)
   {
-    check(nvrtcAddNameExpression(context.program, arg.expression.data()));
+    context.expressions.push_back(arg.expression);
     return nvrtc2_pre_build_nl{std::move(context)};
   }
 
@@ -245,7 +300,7 @@ struct nvrtc2_pre_build
     return nvrtc2_pre_build_nl{std::move(context)};
   }
 
-  // Compile program
+  // Compile program, or take the result of an identical compilation from the JIT cache
   inline nvrtc2_post_build_nl compile_program(nvrtc_compile compile_args)
   {
     size_t n_actual_args = std::distance(
@@ -253,8 +308,81 @@ struct nvrtc2_pre_build
       std::remove_if(compile_args.args, compile_args.args + compile_args.num_args, [](const char* ptr) -> bool {
         return (ptr == nullptr);
       }));
-    const int num_options = static_cast<int>(n_actual_args);
-    nvrtcResult result    = nvrtcCompileProgram(context.program, num_options, compile_args.args);
+    context.compile_args = {compile_args.args, n_actual_args};
+
+    auto build = [this] {
+      return compile();
+    };
+    std::shared_ptr<const cccl::detail::jit_cache> cache = cccl::detail::get_jit_cache();
+    cccl::detail::jit_cache_entry entry = cache ? cache->get_or_build(compile_key(), build) : build();
+
+    // the entry holds the LTO-IR, followed by each expression and its lowered name
+    if (!entry.blobs.empty() && entry.blobs.size() != 1 + 2 * context.expressions.size())
+    {
+      entry = build();
+    }
+    if (!entry.blobs.empty())
+    {
+      context.ltoir = std::move(entry.blobs[0]);
+      for (std::size_t i = 1; i + 1 < entry.blobs.size(); i += 2)
+      {
+        context.lowered_names[std::move(entry.blobs[i])] = std::move(entry.blobs[i + 1]);
+      }
+    }
+
+    return {std::move(context)};
+  }
+
+private:
+  inline std::string compile_key() const
+  {
+    int nvrtc_major{};
+    int nvrtc_minor{};
+    check(nvrtcVersion(&nvrtc_major, &nvrtc_minor));
+
+    cccl::detail::jit_cache_key key;
+    key.add("NVRTC")
+      .add(std::uint64_t{CCCL_VERSION})
+      .add(static_cast<std::uint64_t>(nvrtc_major))
+      .add(static_cast<std::uint64_t>(nvrtc_minor))
+      .add(context.program_source)
+      .add(context.program_source_name)
+      .add(static_cast<std::uint64_t>(context.expressions.size()));
+    for (std::string_view expression : context.expressions)
+    {
+      key.add(expression);
+    }
+    key.add(static_cast<std::uint64_t>(context.compile_args.num_args));
+    for (std::size_t i = 0; i < context.compile_args.num_args; ++i)
+    {
+      key.add(std::string_view{context.compile_args.args[i]});
+    }
+
+    // the headers under an include path can change while the path and CCCL_VERSION stay the same
+    for (std::string_view path :
+         cccl::detail::get_include_paths(context.compile_args.args, context.compile_args.num_args))
+    {
+      key.add(cccl::detail::get_directory_digest(std::string(path)));
+    }
+    return key.digest();
+  }
+
+  // Compiles the program and, unless it produced no LTO-IR, returns the LTO-IR and the lowered names and destroys it
+  inline cccl::detail::jit_cache_entry compile()
+  {
+    const std::string program_source(context.program_source);
+    const std::string program_source_name(context.program_source_name);
+    check(nvrtcCreateProgram(
+      &context.program, program_source.c_str(), program_source_name.c_str(), 0, nullptr, nullptr));
+
+    std::vector<std::string> expressions(context.expressions.begin(), context.expressions.end());
+    for (const std::string& expression : expressions)
+    {
+      check(nvrtcAddNameExpression(context.program, expression.c_str()));
+    }
+
+    const int num_options = static_cast<int>(context.compile_args.num_args);
+    nvrtcResult result    = nvrtcCompileProgram(context.program, num_options, context.compile_args.args);
 
     size_t log_size{};
     check(nvrtcGetProgramLogSize(context.program, &log_size));
@@ -266,9 +394,25 @@ struct nvrtc2_pre_build
     }
     check(result);
 
-    context.compile_args = {compile_args.args, n_actual_args};
+    cccl::detail::jit_cache_entry entry;
+    std::size_t ltoir_size{};
+    if (nvrtcGetLTOIRSize(context.program, &ltoir_size) != NVRTC_SUCCESS)
+    {
+      return entry;
+    }
+    std::string& ltoir = entry.blobs.emplace_back(ltoir_size, '\0');
+    check(nvrtcGetLTOIR(context.program, ltoir.data()));
 
-    return {std::move(context)};
+    for (std::string& expression : expressions)
+    {
+      const char* lowered_name;
+      check(nvrtcGetLoweredName(context.program, expression.c_str(), &lowered_name));
+      entry.blobs.push_back(std::move(expression));
+      entry.blobs.emplace_back(lowered_name);
+    }
+
+    nvrtcDestroyProgram(&context.program);
+    return entry;
   }
 };
 
@@ -282,7 +426,11 @@ struct nvrtc2_top_level
   // Compile and link program
   inline nvrtc2_pre_build_nl add_program(nvrtc_translation_unit tu)
   {
-    check(nvrtcCreateProgram(&context.program, tu.program.data(), tu.name.data(), 0, nullptr, nullptr));
+    context.program_source      = tu.program;
+    context.program_source_name = tu.name;
+    context.expressions.clear();
+    context.ltoir.clear();
+    context.lowered_names.clear();
     return {std::move(context)};
   }
 
@@ -291,6 +439,7 @@ struct nvrtc2_top_level
   {
     check(nvJitLinkAddData(
       context.jit.handle, NVJITLINK_INPUT_LTOIR, (const void*) arg.ltoir, arg.size, context.program_name.data()));
+    context.link_key.add(std::string_view(arg.ltoir, arg.size));
     return {std::move(context)};
   }
 
@@ -359,17 +508,37 @@ struct nvrtc2_top_level
           (const void*) ltoir.ltoir,
           ltoir.size,
           context.program_name.data()));
+        context.link_key.add(std::string_view(ltoir.ltoir, ltoir.size));
       }
     }
 
     return {std::move(context)};
   }
 
-  // Execute steps and link unit
+  // Execute steps and link unit, or take the result of an identical link from the JIT cache
   inline nvrtc_link_result finalize_program()
   {
+    auto build = [this] {
+      return link();
+    };
+    std::shared_ptr<const cccl::detail::jit_cache> cache = cccl::detail::get_jit_cache();
+    cccl::detail::jit_cache_entry entry = cache ? cache->get_or_build(context.link_key.digest(), build) : build();
+    if (entry.blobs.size() != 1)
+    {
+      entry = build();
+    }
+
     nvrtc_link_result link_result{};
+    link_result.size = entry.blobs[0].size();
+    link_result.data = std::unique_ptr<char[]>(new char[link_result.size]);
+    std::memcpy(link_result.data.get(), entry.blobs[0].data(), link_result.size);
+    return link_result;
+  }
 
+private:
+  // Links the added units and returns the cubin, or the PTX when no cubin was requested
+  inline cccl::detail::jit_cache_entry link()
+  {
     auto jitlink_error = nvJitLinkComplete(context.jit.handle);
     size_t log_size{};
     check(nvJitLinkGetErrorLogSize(context.jit.handle, &log_size));
@@ -383,24 +552,26 @@ struct nvrtc2_top_level
     check(jitlink_error);
 
     bool output_ptx = false;
-    auto result     = nvJitLinkGetLinkedCubinSize(context.jit.handle, &link_result.size);
+    size_t size{};
+    auto result = nvJitLinkGetLinkedCubinSize(context.jit.handle, &size);
 
     if (result != NVJITLINK_SUCCESS)
     {
       output_ptx = true;
-      check(nvJitLinkGetLinkedPtxSize(context.jit.handle, &link_result.size));
+      check(nvJitLinkGetLinkedPtxSize(context.jit.handle, &size));
     }
-    link_result.data = std::unique_ptr<char[]>(new char[link_result.size]);
 
+    cccl::detail::jit_cache_entry entry;
+    std::string& data = entry.blobs.emplace_back(size, '\0');
     if (output_ptx)
     {
-      check(nvJitLinkGetLinkedPtx(context.jit.handle, link_result.data.get()));
+      check(nvJitLinkGetLinkedPtx(context.jit.handle, data.data()));
     }
     else
     {
-      check(nvJitLinkGetLinkedCubin(context.jit.handle, link_result.data.get()));
+      check(nvJitLinkGetLinkedCubin(context.jit.handle, data.data()));
     }
 
-    return link_result;
+    return entry;
   }
 };
@@ -20,4 +20,5 @@ nvJitLinkResult nvJitLinkGetErrorLogSize(nvJitLinkHandle, size_t*);
 nvJitLinkResult nvJitLinkGetErrorLog(nvJitLinkHandle, char*);
 nvJitLinkResult nvJitLinkGetInfoLogSize(nvJitLinkHandle, size_t*);
 nvJitLinkResult nvJitLinkGetInfoLog(nvJitLinkHandle, char*);
+nvJitLinkResult nvJitLinkVersion(unsigned int*, unsigned int*);
 }
@@ -0,0 +1,188 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "jit_cache.h"
+#include <cccl/c/jit_cache.h>
+
+namespace cccl::detail
+{
+namespace
+{
+std::filesystem::path default_jit_cache_directory()
+{
+  if (const char* env = std::getenv("CCCL_C_PARALLEL_CACHE_DIR"))
+  {
+    return env;
+  }
+#if defined(_WIN32)
+  if (const char* env = std::getenv("LOCALAPPDATA"))
+  {
+    return std::filesystem::path(env) / "cccl" / "c.parallel";
+  }
+#else // ^^^ _WIN32 ^^^ / vvv !_WIN32 vvv
+  if (const char* env = std::getenv("XDG_CACHE_HOME"))
+  {
+    return std::filesystem::path(env) / "cccl" / "c.parallel";
+  }
+  if (const char* env = std::getenv("HOME"))
+  {
+    return std::filesystem::path(env) / ".cache" / "cccl" / "c.parallel";
+  }
+#endif // !_WIN32
+  return {};
+}
+
+struct jit_cache_config
+{
+  std::mutex mutex;
+  std::shared_ptr<const jit_cache> cache;
+  std::uint64_t max_size = jit_cache::default_max_size;
+
+  jit_cache_config()
+  {
+    if (const char* env = std::getenv("CCCL_C_PARALLEL_CACHE_MAXSIZE"))
+    {
+      max_size = std::strtoull(env, nullptr, 10);
+    }
+
+    const char* disable = std::getenv("CCCL_C_PARALLEL_CACHE_DISABLE");
+    if (disable && std::string(disable) != "0")
+    {
+      return;
+    }
+
+    std::filesystem::path directory = default_jit_cache_directory();
+    if (!directory.empty())
+    {
+      cache = std::make_shared<const jit_cache>(std::move(directory), max_size);
+    }
+  }
+};
+
+jit_cache_config& get_jit_cache_config()
+{
+  static jit_cache_config config;
+  return config;
+}
+} // namespace
+
+std::shared_ptr<const jit_cache> get_jit_cache()
+{
+  jit_cache_config& config = get_jit_cache_config();
+  std::lock_guard<std::mutex> lock(config.mutex);
+  return config.cache;
+}
+
+const std::string& get_directory_digest(const std::string& directory)
+{
+  static std::mutex mutex;
+  static std::map<std::string, std::string> digests;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = digests.find(directory);
+  if (it == digests.end())
+  {
+    it = digests.emplace(directory, jit_cache_key{}.add_directory(directory).digest()).first;
+  }
+  return it->second;
+}
+} // namespace cccl::detail
+
+CUresult cccl_jit_cache_set_directory(const char* directory)
+try
+{
+  cccl::detail::jit_cache_config& config = cccl::detail::get_jit_cache_config();
+  std::lock_guard<std::mutex> lock(config.mutex);
+  config.cache = directory ? std::make_shared<const cccl::detail::jit_cache>(directory, config.max_size) : nullptr;
+  return CUDA_SUCCESS;
+}
+catch (const std::exception& exc)
+{
+  fflush(stderr);
+  printf("\nEXCEPTION in cccl_jit_cache_set_directory(): %s\n", exc.what());
+  fflush(stdout);
+  return CUDA_ERROR_UNKNOWN;
+}
+
+CUresult cccl_jit_cache_set_max_size(uint64_t max_size)
+try
+{
+  std::shared_ptr<const cccl::detail::jit_cache> cache;
+  {
+    cccl::detail::jit_cache_config& config = cccl::detail::get_jit_cache_config();
+    std::lock_guard<std::mutex> lock(config.mutex);
+    config.max_size = max_size;
+    if (config.cache)
+    {
+      config.cache = std::make_shared<const cccl::detail::jit_cache>(config.cache->directory(), max_size);
+    }
+    cache = config.cache;
+  }
+  if (cache)
+  {
+    cache->evict();
+  }
+  return CUDA_SUCCESS;
+}
+catch (const std::exception& exc)
+{
+  fflush(stderr);
+  printf("\nEXCEPTION in cccl_jit_cache_set_max_size(): %s\n", exc.what());
+  fflush(stdout);
+  return CUDA_ERROR_UNKNOWN;
+}
+
+CUresult cccl_jit_cache_prewarm(const char* source_directory, size_t* num_imported)
+try
+{
+  if (!source_directory)
+  {
+    return CUDA_ERROR_INVALID_VALUE;
+  }
+
+  std::shared_ptr<const cccl::detail::jit_cache> cache = cccl::detail::get_jit_cache();
+  const size_t imported                                 = cache ? cache->prewarm(source_directory) : 0;
+  if (num_imported)
+  {
+    *num_imported = imported;
+  }
+  return CUDA_SUCCESS;
+}
+catch (const std::exception& exc)
+{
+  fflush(stderr);
+  printf("\nEXCEPTION in cccl_jit_cache_prewarm(): %s\n", exc.what());
+  fflush(stdout);
+  return CUDA_ERROR_UNKNOWN;
+}
+
+CUresult cccl_jit_cache_clear(void)
+try
+{
+  if (std::shared_ptr<const cccl::detail::jit_cache> cache = cccl::detail::get_jit_cache())
+  {
+    cache->clear();
+  }
+  return CUDA_SUCCESS;
+}
+catch (const std::exception& exc)
+{
+  fflush(stderr);
+  printf("\nEXCEPTION in cccl_jit_cache_clear(): %s\n", exc.what());
+  fflush(stdout);
+  return CUDA_ERROR_UNKNOWN;
+}
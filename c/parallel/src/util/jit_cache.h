@@ -0,0 +1,622 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// A content-addressed cache of JIT build results, which persists them on disk across processes.
+//
+// Entries are keyed by the SHA-256 digest of every input of a build step, i.e. the generated source (which embeds the
+// type descriptors and the tuning policy), the compiler options (which include the target architecture), the files
+// under the include paths, the compiler and linker versions and the LTO-IR of the linked operators. Each entry lives in
+// its own file, which is written to a temporary file and published with an atomic rename, so concurrent processes never
+// observe a partial entry. The total size of the entries is bounded by evicting the least recently used ones, where a
+// hit refreshes the modification time of its file. The directory is only scanned for eviction once the entries stored
+// since the last scan may exceed the maximum size, so that a miss does not cost a walk over the whole cache. Filesystem
+// errors are never fatal: a cache which cannot be read or written behaves as if it were empty.
+namespace cccl::detail
+{
+class sha256
+{
+public:
+  static constexpr std::size_t digest_size = 32;
+
+  void update(const void* data, std::size_t size)
+  {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    m_length += size;
+    while (size > 0)
+    {
+      const std::size_t n = std::min(size, m_block.size() - m_block_size);
+      std::memcpy(m_block.data() + m_block_size, bytes, n);
+      m_block_size += n;
+      bytes += n;
+      size -= n;
+      if (m_block_size == m_block.size())
+      {
+        compress();
+        m_block_size = 0;
+      }
+    }
+  }
+
+  std::array<unsigned char, digest_size> finish()
+  {
+    const std::uint64_t bit_length = m_length * 8;
+    const unsigned char pad        = 0x80;
+    update(&pad, 1);
+    const unsigned char zero = 0;
+    while (m_block_size != 56)
+    {
+      update(&zero, 1);
+    }
+    unsigned char length_bytes[8];
+    for (int i = 0; i < 8; ++i)
+    {
+      length_bytes[i] = static_cast<unsigned char>(bit_length >> (56 - 8 * i));
+    }
+    update(length_bytes, 8);
+
+    std::array<unsigned char, digest_size> digest;
+    for (std::size_t i = 0; i < digest_size; ++i)
+    {
+      digest[i] = static_cast<unsigned char>(m_state[i / 4] >> (24 - 8 * (i % 4)));
+    }
+    return digest;
+  }
+
+private:
+  static std::uint32_t rotr(std::uint32_t x, int n)
+  {
+    return (x >> n) | (x << (32 - n));
+  }
+
+  void compress()
+  {
+    static constexpr std::uint32_t k[64] = {
+      0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+      0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+      0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+      0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+      0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+      0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+      0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+      0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+    std::uint32_t w[64];
+    for (int i = 0; i < 16; ++i)
+    {
+      w[i] = (std::uint32_t{m_block[4 * i]} << 24) | (std::uint32_t{m_block[4 * i + 1]} << 16)
+           | (std::uint32_t{m_block[4 * i + 2]} << 8) | std::uint32_t{m_block[4 * i + 3]};
+    }
+    for (int i = 16; i < 64; ++i)
+    {
+      const std::uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+      const std::uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+      w[i]                   = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    std::uint32_t a = m_state[0], b = m_state[1], c = m_state[2], d = m_state[3];
+    std::uint32_t e = m_state[4], f = m_state[5], g = m_state[6], h = m_state[7];
+    for (int i = 0; i < 64; ++i)
+    {
+      const std::uint32_t t1 = h + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25)) + ((e & f) ^ (~e & g)) + k[i] + w[i];
+      const std::uint32_t t2 = (rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+      h                      = g;
+      g                      = f;
+      f                      = e;
+      e                      = d + t1;
+      d                      = c;
+      c                      = b;
+      b                      = a;
+      a                      = t1 + t2;
+    }
+    m_state[0] += a;
+    m_state[1] += b;
+    m_state[2] += c;
+    m_state[3] += d;
+    m_state[4] += e;
+    m_state[5] += f;
+    m_state[6] += g;
+    m_state[7] += h;
+  }
+
+  std::array<std::uint32_t, 8> m_state = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+  std::array<unsigned char, 64> m_block{};
+  std::size_t m_block_size = 0;
+  std::uint64_t m_length   = 0;
+};
+
+// Accumulates the inputs of a build step. Every input is prefixed by its length, so that the boundaries between
+// inputs are part of the key.
+class jit_cache_key
+{
+public:
+  jit_cache_key& add(std::string_view input)
+  {
+    add(static_cast<std::uint64_t>(input.size()));
+    m_hash.update(input.data(), input.size());
+    return *this;
+  }
+
+  jit_cache_key& add(std::uint64_t input)
+  {
+    unsigned char bytes[8];
+    for (int i = 0; i < 8; ++i)
+    {
+      bytes[i] = static_cast<unsigned char>(input >> (8 * i));
+    }
+    m_hash.update(bytes, 8);
+    return *this;
+  }
+
+  // Adds the relative path, the size and the modification time of every file under a directory, e.g. a header tree
+  // which a compilation includes, so that the key changes when the headers change without a new CCCL_VERSION. A
+  // directory which cannot be read adds no files.
+  jit_cache_key& add_directory(const std::filesystem::path& directory)
+  {
+    struct file_stamp
+    {
+      std::string path;
+      std::uintmax_t size;
+      std::int64_t last_write;
+    };
+
+    std::vector<file_stamp> files;
+    std::error_code ec;
+    for (auto it = std::filesystem::recursive_directory_iterator(directory, ec);
+         !ec && it != std::filesystem::recursive_directory_iterator();
+         it.increment(ec))
+    {
+      std::error_code size_ec;
+      std::error_code time_ec;
+      if (!it->is_regular_file(size_ec))
+      {
+        continue;
+      }
+      const std::uintmax_t size = it->file_size(size_ec);
+      const auto last_write     = it->last_write_time(time_ec);
+      if (!size_ec && !time_ec)
+      {
+        files.push_back({it->path().lexically_relative(directory).generic_string(),
+                         size,
+                         static_cast<std::int64_t>(last_write.time_since_epoch().count())});
+      }
+    }
+
+    // the order of a directory iteration is unspecified
+    std::sort(files.begin(), files.end(), [](const file_stamp& lhs, const file_stamp& rhs) {
+      return lhs.path < rhs.path;
+    });
+    add(static_cast<std::uint64_t>(files.size()));
+    for (const file_stamp& file : files)
+    {
+      add(file.path).add(static_cast<std::uint64_t>(file.size)).add(static_cast<std::uint64_t>(file.last_write));
+    }
+    return *this;
+  }
+
+  // The hexadecimal digest of the inputs added so far
+  std::string digest() const
+  {
+    constexpr char hex_digits[] = "0123456789abcdef";
+
+    std::string result;
+    for (unsigned char byte : sha256(m_hash).finish())
+    {
+      result += hex_digits[byte >> 4];
+      result += hex_digits[byte & 0xf];
+    }
+    return result;
+  }
+
+private:
+  sha256 m_hash;
+};
+
+struct jit_cache_entry
+{
+  std::vector<std::string> blobs;
+};
+
+class jit_cache
+{
+public:
+  static constexpr std::uint64_t default_max_size = std::uint64_t{1} << 30;
+
+  explicit jit_cache(std::filesystem::path directory, std::uint64_t max_size = default_max_size)
+      : m_directory(std::move(directory))
+      , m_max_size(max_size)
+      , m_size(unknown_size)
+  {}
+
+  const std::filesystem::path& directory() const
+  {
+    return m_directory;
+  }
+
+  std::uint64_t max_size() const
+  {
+    return m_max_size;
+  }
+
+  std::optional<jit_cache_entry> lookup(const std::string& key) const
+  {
+    const std::filesystem::path path     = entry_path(key);
+    std::optional<jit_cache_entry> entry = read_entry(path);
+    std::error_code ec;
+    if (entry)
+    {
+      // refresh the entry for the eviction order
+      std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+    }
+    else if (std::filesystem::exists(path, ec))
+    {
+      // a corrupted entry is rebuilt by the caller
+      std::filesystem::remove(path, ec);
+    }
+    return entry;
+  }
+
+  void store(const std::string& key, const jit_cache_entry& entry) const
+  {
+    std::string contents(magic, sizeof(magic));
+    append_integer(contents, format_version);
+    append_integer(contents, static_cast<std::uint32_t>(entry.blobs.size()));
+    for (const std::string& blob : entry.blobs)
+    {
+      append_integer(contents, static_cast<std::uint64_t>(blob.size()));
+      contents += blob;
+    }
+
+    if (!publish(entry_path(key), contents))
+    {
+      return;
+    }
+
+    // The directory is only scanned by the first store and once the entries stored since the last scan may exceed the
+    // maximum size. Entries stored by other processes are accounted for by the next scan.
+    std::uint64_t size = m_size.load(std::memory_order_relaxed);
+    while (size != unknown_size
+           && !m_size.compare_exchange_weak(size, size + contents.size(), std::memory_order_relaxed))
+    {
+    }
+    if (size == unknown_size || size + contents.size() > m_max_size)
+    {
+      evict();
+    }
+  }
+
+  // Returns the cached entry of the key, or the result of the build step, which is cached unless it has no blobs
+  template <typename BuildFunction>
+  jit_cache_entry get_or_build(const std::string& key, BuildFunction&& build) const
+  {
+    if (std::optional<jit_cache_entry> entry = lookup(key))
+    {
+      return std::move(*entry);
+    }
+
+    jit_cache_entry entry = std::invoke(std::forward<BuildFunction>(build));
+    if (!entry.blobs.empty())
+    {
+      store(key, entry);
+    }
+    return entry;
+  }
+
+  // Removes the least recently used entries until the entries fit into the maximum size, together with the temporary
+  // files left behind by processes which were killed while publishing an entry
+  void evict() const
+  {
+    struct cached_file
+    {
+      std::filesystem::path path;
+      std::filesystem::file_time_type last_use;
+      std::uintmax_t size;
+    };
+
+    const auto stale_time = std::filesystem::file_time_type::clock::now() - std::chrono::hours(1);
+
+    std::vector<cached_file> files;
+    std::uint64_t total_size = 0;
+    for (const std::filesystem::path& path : list_files(m_directory))
+    {
+      std::error_code ec;
+      const auto last_use = std::filesystem::last_write_time(path, ec);
+      if (ec)
+      {
+        continue;
+      }
+      if (path.extension() != entry_extension)
+      {
+        if (last_use < stale_time)
+        {
+          std::filesystem::remove(path, ec);
+        }
+        continue;
+      }
+      const std::uintmax_t size = std::filesystem::file_size(path, ec);
+      if (!ec)
+      {
+        files.push_back({path, last_use, size});
+        total_size += size;
+      }
+    }
+
+    if (total_size <= m_max_size)
+    {
+      m_size.store(total_size, std::memory_order_relaxed);
+      return;
+    }
+
+    std::sort(files.begin(), files.end(), [](const cached_file& lhs, const cached_file& rhs) {
+      return lhs.last_use < rhs.last_use;
+    });
+    for (const cached_file& file : files)
+    {
+      if (total_size <= m_max_size)
+      {
+        break;
+      }
+      std::error_code ec;
+      if (std::filesystem::remove(file.path, ec))
+      {
+        total_size -= file.size;
+      }
+    }
+    m_size.store(total_size, std::memory_order_relaxed);
+  }
+
+  // Imports the valid entries of another cache directory which this cache does not hold yet, e.g. a directory which
+  // was populated ahead of time on another machine with the same toolkit. Returns the number of imported entries.
+  std::size_t prewarm(const std::filesystem::path& source_directory) const
+  {
+    std::size_t num_imported = 0;
+    for (const std::filesystem::path& source : list_files(source_directory))
+    {
+      const std::string key = source.stem().string();
+      std::error_code ec;
+      if (source.extension() != entry_extension || !is_key(key) || std::filesystem::exists(entry_path(key), ec))
+      {
+        continue;
+      }
+
+      std::ifstream input(source, std::ios::binary);
+      const std::string contents{std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>()};
+      if (input.bad() || !parse_entry(contents) || !publish(entry_path(key), contents))
+      {
+        continue;
+      }
+      ++num_imported;
+    }
+
+    if (num_imported > 0)
+    {
+      evict();
+    }
+    return num_imported;
+  }
+
+  // Removes every entry
+  void clear() const
+  {
+    for (const std::filesystem::path& path : list_files(m_directory))
+    {
+      std::error_code ec;
+      std::filesystem::remove(path, ec);
+    }
+  }
+
+private:
+  static constexpr char magic[8]                    = {'C', 'C', 'C', 'L', 'J', 'I', 'T', '\0'};
+  static constexpr std::uint32_t format_version     = 1;
+  static constexpr std::string_view entry_extension = ".bin";
+  static constexpr std::uint64_t unknown_size       = ~std::uint64_t{0};
+
+  static bool is_key(std::string_view key)
+  {
+    return key.size() == 2 * sha256::digest_size
+        && std::all_of(key.begin(), key.end(), [](char c) {
+             return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f');
+           });
+  }
+
+  // Entries are spread over subdirectories named after the first byte of their key, to keep the directories small
+  std::filesystem::path entry_path(const std::string& key) const
+  {
+    return m_directory / key.substr(0, 2) / (key + std::string(entry_extension));
+  }
+
+  template <typename Integer>
+  static void append_integer(std::string& contents, Integer value)
+  {
+    char bytes[sizeof(Integer)];
+    std::memcpy(bytes, &value, sizeof(Integer));
+    contents.append(bytes, sizeof(Integer));
+  }
+
+  template <typename Integer>
+  static bool read_integer(std::string_view& contents, Integer& value)
+  {
+    if (contents.size() < sizeof(Integer))
+    {
+      return false;
+    }
+    std::memcpy(&value, contents.data(), sizeof(Integer));
+    contents.remove_prefix(sizeof(Integer));
+    return true;
+  }
+
+  static std::optional<jit_cache_entry> parse_entry(std::string_view contents)
+  {
+    if (contents.size() < sizeof(magic) || std::memcmp(contents.data(), magic, sizeof(magic)) != 0)
+    {
+      return std::nullopt;
+    }
+    contents.remove_prefix(sizeof(magic));
+
+    std::uint32_t version   = 0;
+    std::uint32_t num_blobs = 0;
+    if (!read_integer(contents, version) || version != format_version || !read_integer(contents, num_blobs))
+    {
+      return std::nullopt;
+    }
+
+    jit_cache_entry entry;
+    for (std::uint32_t i = 0; i < num_blobs; ++i)
+    {
+      std::uint64_t size = 0;
+      if (!read_integer(contents, size) || size > contents.size())
+      {
+        return std::nullopt;
+      }
+      entry.blobs.emplace_back(contents.substr(0, static_cast<std::size_t>(size)));
+      contents.remove_prefix(static_cast<std::size_t>(size));
+    }
+
+    // a truncated or overlong file is corrupted
+    if (!contents.empty())
+    {
+      return std::nullopt;
+    }
+    return entry;
+  }
+
+  static std::optional<jit_cache_entry> read_entry(const std::filesystem::path& path)
+  {
+    std::ifstream input(path, std::ios::binary);
+    if (!input)
+    {
+      return std::nullopt;
+    }
+    const std::string contents{std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>()};
+    if (input.bad())
+    {
+      return std::nullopt;
+    }
+    return parse_entry(contents);
+  }
+
+  // Writes the contents to a temporary file next to the entry and renames it to the entry, which is atomic
+  static bool publish(const std::filesystem::path& path, const std::string& contents)
+  {
+    static std::atomic<std::uint64_t> counter{0};
+
+    std::error_code ec;
+    std::filesystem::create_directories(path.parent_path(), ec);
+    if (ec)
+    {
+      return false;
+    }
+
+    // unique among the threads and the processes writing to the cache
+    const std::uint64_t unique =
+      std::hash<std::thread::id>{}(std::this_thread::get_id())
+      ^ static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()) ^ (++counter << 48);
+    std::filesystem::path temporary = path;
+    temporary += ".tmp." + std::to_string(unique);
+
+    {
+      std::ofstream output(temporary, std::ios::binary | std::ios::trunc);
+      output.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+      output.close();
+      if (!output)
+      {
+        std::filesystem::remove(temporary, ec);
+        return false;
+      }
+    }
+
+    std::filesystem::rename(temporary, path, ec);
+    if (ec)
+    {
+      std::filesystem::remove(temporary, ec);
+      return false;
+    }
+    return true;
+  }
+
+  static std::vector<std::filesystem::path> list_files(const std::filesystem::path& directory)
+  {
+    std::vector<std::filesystem::path> files;
+    std::error_code ec;
+    for (auto it = std::filesystem::recursive_directory_iterator(directory, ec);
+         !ec && it != std::filesystem::recursive_directory_iterator();
+         it.increment(ec))
+    {
+      if (it->is_regular_file(ec))
+      {
+        files.push_back(it->path());
+      }
+    }
+    return files;
+  }
+
+  std::filesystem::path m_directory;
+  std::uint64_t m_max_size;
+  // The size of the entries as of the last scan of the directory, plus the size of the entries stored since then
+  mutable std::atomic<std::uint64_t> m_size;
+};
+
+// The cache used by the build steps of the algorithms, or nullptr when caching is disabled. It is configured by the
+// CCCL_C_PARALLEL_CACHE_DIR, CCCL_C_PARALLEL_CACHE_MAXSIZE and CCCL_C_PARALLEL_CACHE_DISABLE environment variables, and
+// by the cccl_jit_cache_* functions.
+std::shared_ptr<const jit_cache> get_jit_cache();
+
+// The include paths of compiler options, which are either joined to their option, as in -Ipath and
+// --include-path=path, or the next option, as in -I path and --include-path path
+inline std::vector<std::string_view> get_include_paths(const char* const* args, std::size_t num_args)
+{
+  std::vector<std::string_view> paths;
+  for (std::size_t i = 0; i < num_args; ++i)
+  {
+    const std::string_view arg = args[i];
+    if (arg == "-I" || arg == "--include-path")
+    {
+      if (i + 1 < num_args)
+      {
+        paths.push_back(args[++i]);
+      }
+      continue;
+    }
+    for (std::string_view prefix : {std::string_view{"-I"}, std::string_view{"--include-path="}})
+    {
+      if (arg.size() > prefix.size() && arg.substr(0, prefix.size()) == prefix)
+      {
+        paths.push_back(arg.substr(prefix.size()));
+        break;
+      }
+    }
+  }
+  return paths;
+}
+
+// The digest of jit_cache_key{}.add_directory(directory), which is computed once per directory and process
+const std::string& get_directory_digest(const std::string& directory);
+} // namespace cccl::detail
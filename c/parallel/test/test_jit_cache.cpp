@@ -0,0 +1,290 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../src/util/jit_cache.h"
+#include <c2h/catch2_test_helper.h>
+
+using cccl::detail::get_include_paths;
+using cccl::detail::jit_cache;
+using cccl::detail::jit_cache_entry;
+using cccl::detail::jit_cache_key;
+
+namespace
+{
+// A cache directory which is removed at the end of a test
+struct temporary_directory
+{
+  std::filesystem::path path;
+
+  temporary_directory()
+      : path(std::filesystem::temp_directory_path() / ("cccl_jit_cache_test_" + std::to_string(std::random_device{}())))
+  {
+    std::filesystem::remove_all(path);
+  }
+
+  ~temporary_directory()
+  {
+    std::error_code ec;
+    std::filesystem::remove_all(path, ec);
+  }
+};
+
+// Stands in for NVRTC and nvJitLink, counting the compilations
+struct stub_build
+{
+  int& num_builds;
+  std::string output;
+
+  jit_cache_entry operator()() const
+  {
+    ++num_builds;
+    return {{output, "lowered_" + output}};
+  }
+};
+
+std::string make_key(std::string_view source, std::string_view arch)
+{
+  return jit_cache_key{}.add(source).add(arch).digest();
+}
+
+std::vector<std::filesystem::path> cached_files(const std::filesystem::path& directory)
+{
+  std::vector<std::filesystem::path> files;
+  for (const auto& file : std::filesystem::recursive_directory_iterator(directory))
+  {
+    if (file.is_regular_file())
+    {
+      files.push_back(file.path());
+    }
+  }
+  return files;
+}
+} // namespace
+
+C2H_TEST("JIT cache keys are SHA-256 digests of the length-prefixed inputs", "[jit_cache]")
+{
+  cccl::detail::sha256 hash;
+  hash.update("abc", 3);
+  const auto digest = hash.finish();
+  REQUIRE(digest[0] == 0xba);
+  REQUIRE(digest[1] == 0x78);
+  REQUIRE(digest[30] == 0x15);
+  REQUIRE(digest[31] == 0xad);
+
+  REQUIRE(make_key("source", "sm_90").size() == 64);
+  REQUIRE(make_key("source", "sm_90") == make_key("source", "sm_90"));
+  REQUIRE(make_key("source", "sm_90") != make_key("source", "sm_80"));
+  // the boundaries between the inputs are part of the key
+  REQUIRE(make_key("source", "sm_90") != make_key("sourcesm_", "90"));
+}
+
+C2H_TEST("JIT cache keys change with the files of an include path", "[jit_cache]")
+{
+  temporary_directory directory;
+  std::filesystem::create_directories(directory.path / "cub");
+  std::ofstream(directory.path / "cub" / "cub.cuh") << "#pragma once";
+
+  const auto directory_key = [&] {
+    return jit_cache_key{}.add_directory(directory.path).digest();
+  };
+  const std::string key = directory_key();
+  REQUIRE(directory_key() == key);
+
+  std::ofstream(directory.path / "cub" / "cub.cuh", std::ios::app) << "\n";
+  const std::string edited_key = directory_key();
+  REQUIRE(edited_key != key);
+
+  std::ofstream(directory.path / "cub" / "version.cuh") << "#pragma once";
+  REQUIRE(directory_key() != edited_key);
+
+  // a missing directory adds no files
+  REQUIRE(jit_cache_key{}.add_directory(directory.path / "missing").digest()
+          == jit_cache_key{}.add(std::uint64_t{0}).digest());
+}
+
+C2H_TEST("JIT cache keys find the include paths of the compiler options", "[jit_cache]")
+{
+  const char* const args[] = {
+    "-arch=sm_90",
+    "-Ijoined",
+    "-I",
+    "separate",
+    "--include-path=joined_long",
+    "--include-path",
+    "separate_long",
+    "-DNDEBUG",
+    "-I"};
+  const std::vector<std::string_view> paths = get_include_paths(args, std::size(args));
+  REQUIRE(paths == std::vector<std::string_view>{"joined", "separate", "joined_long", "separate_long"});
+}
+
+C2H_TEST("JIT cache skips the build of cached entries", "[jit_cache]")
+{
+  temporary_directory directory;
+  const std::string key = make_key("reduce", "sm_90");
+  int num_builds        = 0;
+
+  {
+    jit_cache cache(directory.path);
+    REQUIRE_FALSE(cache.lookup(key));
+
+    const jit_cache_entry entry = cache.get_or_build(key, stub_build{num_builds, "cubin"});
+    REQUIRE(num_builds == 1);
+    REQUIRE(entry.blobs == std::vector<std::string>{"cubin", "lowered_cubin"});
+
+    REQUIRE(cache.get_or_build(key, stub_build{num_builds, "cubin"}).blobs == entry.blobs);
+    REQUIRE(num_builds == 1);
+  }
+
+  // another process finds the entry
+  jit_cache cache(directory.path);
+  REQUIRE(cache.get_or_build(key, stub_build{num_builds, "cubin"}).blobs[0] == "cubin");
+  REQUIRE(cache.get_or_build(make_key("reduce", "sm_80"), stub_build{num_builds, "other"}).blobs[0] == "other");
+  REQUIRE(num_builds == 2);
+
+  // no temporary file is left behind
+  for (const auto& file : cached_files(directory.path))
+  {
+    REQUIRE(file.extension() == ".bin");
+  }
+
+  // a build without results is not cached
+  const std::string empty_key = make_key("scan", "sm_90");
+  cache.get_or_build(empty_key, [&] {
+    ++num_builds;
+    return jit_cache_entry{};
+  });
+  REQUIRE_FALSE(cache.lookup(empty_key));
+
+  cache.clear();
+  REQUIRE_FALSE(cache.lookup(key));
+}
+
+C2H_TEST("JIT cache rebuilds corrupted entries", "[jit_cache]")
+{
+  temporary_directory directory;
+  jit_cache cache(directory.path);
+  const std::string key = make_key("merge_sort", "sm_90");
+  int num_builds        = 0;
+
+  cache.get_or_build(key, stub_build{num_builds, std::string(1000, 'x')});
+  const std::vector<std::filesystem::path> files = cached_files(directory.path);
+  REQUIRE(files.size() == 1);
+
+  std::filesystem::resize_file(files[0], 500);
+  REQUIRE_FALSE(cache.lookup(key));
+  REQUIRE_FALSE(std::filesystem::exists(files[0]));
+
+  REQUIRE(cache.get_or_build(key, stub_build{num_builds, "rebuilt"}).blobs[0] == "rebuilt");
+  REQUIRE(num_builds == 2);
+
+  std::ofstream(files[0], std::ios::binary | std::ios::trunc) << "not a cache entry";
+  REQUIRE_FALSE(cache.lookup(key));
+}
+
+C2H_TEST("JIT cache evicts the least recently used entries", "[jit_cache]")
+{
+  temporary_directory directory;
+  int num_builds = 0;
+
+  const std::string blob(1000, 'x');
+  const std::string keys[] = {
+    make_key("a", "sm_90"), make_key("b", "sm_90"), make_key("c", "sm_90"), make_key("d", "sm_90")};
+
+  // room for three entries of the same size
+  jit_cache(directory.path).get_or_build(keys[0], stub_build{num_builds, blob});
+  jit_cache cache(directory.path, 3 * std::filesystem::file_size(cached_files(directory.path)[0]));
+  for (int i = 1; i < 3; ++i)
+  {
+    cache.get_or_build(keys[i], stub_build{num_builds, blob});
+  }
+  REQUIRE(cached_files(directory.path).size() == 3);
+
+  // age the entries, from the oldest to the newest, then use the oldest one
+  const auto now = std::filesystem::file_time_type::clock::now();
+  for (const auto& file : cached_files(directory.path))
+  {
+    for (int i = 0; i < 3; ++i)
+    {
+      if (file.stem() == keys[i])
+      {
+        std::filesystem::last_write_time(file, now - std::chrono::minutes(10 - i));
+      }
+    }
+  }
+  REQUIRE(cache.lookup(keys[0]));
+
+  cache.get_or_build(keys[3], stub_build{num_builds, blob});
+  REQUIRE(cache.lookup(keys[0]));
+  REQUIRE_FALSE(cache.lookup(keys[1]));
+  REQUIRE(cache.lookup(keys[2]));
+  REQUIRE(cache.lookup(keys[3]));
+  REQUIRE(cached_files(directory.path).size() == 3);
+}
+
+C2H_TEST("JIT cache only scans the directory once the stored entries may exceed the maximum size", "[jit_cache]")
+{
+  temporary_directory directory;
+  int num_builds = 0;
+
+  const std::string blob(1000, 'x');
+  jit_cache(directory.path).get_or_build(make_key("a", "sm_90"), stub_build{num_builds, blob});
+  const std::uintmax_t entry_size = std::filesystem::file_size(cached_files(directory.path)[0]);
+
+  // the first store scans the directory, which holds one entry
+  jit_cache cache(directory.path, 3 * entry_size);
+  cache.get_or_build(make_key("b", "sm_90"), stub_build{num_builds, blob});
+
+  // entries stored by another process are only accounted for by the next scan
+  jit_cache other(directory.path);
+  other.get_or_build(make_key("c", "sm_90"), stub_build{num_builds, blob});
+  other.get_or_build(make_key("d", "sm_90"), stub_build{num_builds, blob});
+  REQUIRE(cached_files(directory.path).size() == 4);
+
+  cache.get_or_build(make_key("e", "sm_90"), stub_build{num_builds, blob});
+  REQUIRE(cached_files(directory.path).size() == 5);
+
+  cache.get_or_build(make_key("f", "sm_90"), stub_build{num_builds, blob});
+  REQUIRE(cached_files(directory.path).size() == 3);
+}
+
+C2H_TEST("JIT cache is pre-warmed from another directory", "[jit_cache]")
+{
+  temporary_directory source_directory;
+  temporary_directory directory;
+  int num_builds = 0;
+
+  jit_cache source(source_directory.path);
+  source.get_or_build(make_key("histogram", "sm_90"), stub_build{num_builds, "histogram"});
+  source.get_or_build(make_key("radix_sort", "sm_90"), stub_build{num_builds, "radix_sort"});
+  std::ofstream(source_directory.path / "stray.bin") << "not a cache entry";
+
+  jit_cache cache(directory.path);
+  cache.get_or_build(make_key("histogram", "sm_90"), stub_build{num_builds, "histogram"});
+  REQUIRE(num_builds == 3);
+
+  REQUIRE(cache.prewarm(source_directory.path) == 1);
+  const jit_cache_entry entry = cache.get_or_build(make_key("radix_sort", "sm_90"), stub_build{num_builds, "none"});
+  REQUIRE(entry.blobs[0] == "radix_sort");
+  REQUIRE(num_builds == 3);
+
+  REQUIRE(cache.prewarm(source_directory.path) == 0);
+  REQUIRE(cache.prewarm(directory.path / "missing") == 0);
+}
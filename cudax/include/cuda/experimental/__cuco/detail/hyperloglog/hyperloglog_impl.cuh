@@ -29,6 +29,7 @@
 #include <cuda/__utility/in_range.h>
 #include <cuda/atomic>
 #include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
 #include <cuda/std/__bit/countr.h>
 #include <cuda/std/__bit/integral.h>
 #include <cuda/std/__cstddef/types.h>
@@ -36,6 +37,7 @@
 #include <cuda/std/__iterator/concepts.h>
 #include <cuda/std/__memory/addressof.h>
 #include <cuda/std/__memory/pointer_traits.h>
+#include <cuda/std/__utility/declval.h>
 #include <cuda/std/span>
 
 #include <cuda/experimental/__cuco/detail/hyperloglog/finalizer.cuh>
@@ -46,6 +48,9 @@
 
 #include <cooperative_groups.h>
 
+#include <thread>
+#include <vector>
+
 #include <cooperative_groups/reduce.h>
 #include <cuda/std/__cccl/prologue.h>
 
@@ -321,6 +326,114 @@ public:
     __stream.sync();
   }
 
+  //! @brief Adds to be counted items to a sketch that resides in host-accessible memory.
+  //!
+  //! @note The items are split into contiguous chunks, each of which is added to a private sketch
+  //! by its own host thread. The private sketches are then combined by register-wise maximum, so
+  //! the result does not depend on the number of threads.
+  //!
+  //! @param __items Host-accessible items
+  //! @param __num_threads Maximum number of host threads to use; 0 selects
+  //! `std::thread::hardware_concurrency()`
+  _CCCL_HOST void __add_bulk(::cuda::std::span<const _Tp> __items, unsigned __num_threads)
+  {
+    // Below this many items per thread, spawning threads costs more than it saves.
+    constexpr ::cuda::std::size_t __min_items_per_thread = 1 << 16;
+
+    const auto __num_items = __items.size();
+    if (__num_items == 0)
+    {
+      return;
+    }
+
+    if (__num_threads == 0)
+    {
+      __num_threads = ::cuda::std::max(1u, ::std::thread::hardware_concurrency());
+    }
+    __num_threads = static_cast<unsigned>(::cuda::std::min<::cuda::std::size_t>(
+      __num_threads, ::cuda::std::max<::cuda::std::size_t>(1, __num_items / __min_items_per_thread)));
+
+    if (__num_threads == 1)
+    {
+      __add_host(__items, __sketch);
+      return;
+    }
+
+    const auto __num_regs   = __sketch.size();
+    const auto __chunk_size = (__num_items + __num_threads - 1) / __num_threads;
+    ::std::vector<__register_type> __partials(static_cast<::cuda::std::size_t>(__num_threads - 1) * __num_regs);
+    ::std::vector<::std::thread> __workers;
+    __workers.reserve(__num_threads - 1);
+
+    // Joins the workers even if spawning one of them throws.
+    struct __join_guard
+    {
+      ::std::vector<::std::thread>& __threads;
+      ~__join_guard()
+      {
+        for (auto& __t : __threads)
+        {
+          __t.join();
+        }
+      }
+    };
+
+    {
+      __join_guard __guard{__workers};
+      for (unsigned __t = 1; __t < __num_threads; ++__t)
+      {
+        const auto __offset = __t * __chunk_size;
+        const auto __chunk  = __items.subspan(__offset, ::cuda::std::min(__chunk_size, __num_items - __offset));
+        const ::cuda::std::span<__register_type> __partial{__partials.data() + (__t - 1) * __num_regs, __num_regs};
+        __workers.emplace_back([this, __chunk, __partial] {
+          __add_host(__chunk, __partial);
+        });
+      }
+      __add_host(__items.first(__chunk_size), __sketch);
+    }
+
+    for (unsigned __t = 1; __t < __num_threads; ++__t)
+    {
+      __merge_host(::cuda::std::span<const __register_type>{__partials.data() + (__t - 1) * __num_regs, __num_regs});
+    }
+  }
+
+  //! @brief Adds to be counted items to a sketch in device memory by staging it through host memory.
+  //!
+  //! @note This function synchronizes the given stream.
+  //!
+  //! @tparam _HostMemoryResource Host memory resource used for allocating the staging buffer
+  //!
+  //! @param __items Host-accessible items
+  //! @param __host_mr Host memory resource used for staging the sketch
+  //! @param __stream CUDA stream used to copy the sketch
+  //! @param __num_threads Maximum number of host threads to use; 0 selects
+  //! `std::thread::hardware_concurrency()`
+  template <typename _HostMemoryResource>
+  _CCCL_HOST void __add_bulk(::cuda::std::span<const _Tp> __items,
+                             _HostMemoryResource __host_mr,
+                             ::cuda::stream_ref __stream,
+                             unsigned __num_threads)
+  {
+    if (__items.empty())
+    {
+      return;
+    }
+
+    const auto __bytes = sizeof(__register_type) * __sketch.size();
+    ::cuda::host_buffer<__register_type> __host_sketch_buf{__stream, __host_mr, __sketch.size(), ::cuda::no_init};
+
+    ::cuda::__driver::__memcpyAsync(__host_sketch_buf.data(), __sketch.data(), __bytes, __stream.get());
+    __stream.sync();
+
+    __hyperloglog_impl __host_impl{
+      ::cuda::std::as_writable_bytes(::cuda::std::span{__host_sketch_buf.data(), __host_sketch_buf.size()}), __policy};
+    __host_impl.__add_bulk(__items, __num_threads);
+
+    ::cuda::__driver::__memcpyAsync(__sketch.data(), __host_sketch_buf.data(), __bytes, __stream.get());
+    __stream.sync();
+  }
+
   //! @brief Merges the result of `other` estimator reference into `*this` estimator reference.
   //!
   //! @throw If __sketch_bytes() != other.__sketch_bytes(), then terminates execution with a device __trap()
@@ -385,6 +498,26 @@ public:
     __stream.sync();
   }
 
+  //! @brief Merges the result of `other` estimator into `*this` estimator on the host.
+  //!
+  //! @note Both sketches must reside in host-accessible memory.
+  //!
+  //! @throw If __sketch_bytes() != __other.__sketch_bytes()
+  //!
+  //! @tparam _OtherScope Thread scope of `other` estimator
+  //!
+  //! @param __other Other estimator reference to be merged into `*this`
+  template <::cuda::thread_scope _OtherScope>
+  _CCCL_HOST void __merge_host(const __hyperloglog_impl<_Tp, _OtherScope, _Policy>& __other)
+  {
+    if (__other.__precision != __precision)
+    {
+      _CCCL_THROW(::std::invalid_argument, "Cannot merge estimators with different sketch sizes");
+    }
+
+    __merge_host(::cuda::std::span<const __register_type>{__other.__sketch.data(), __other.__sketch.size()});
+  }
+
   //! @brief Compute the estimated distinct items count.
   //!
   //! @param __group CUDA thread block group this operation is executed in
@@ -455,18 +588,16 @@ public:
       __host_sketch_buf.data(), __sketch.data(), sizeof(__register_type) * __num_regs, __stream.get());
     __stream.sync();
 
-    __fp_type __sum               = 0;
-    ::cuda::std::int32_t __zeroes = 0;
-
-    // geometric mean computation + count registers with 0s
-    for (const auto __reg : __host_sketch_buf)
-    {
-      __sum += __fp_type{1} / static_cast<__fp_type>(1ull << __reg);
-      __zeroes += __reg == 0;
-    }
+    return __estimate_host(::cuda::std::span<const __register_type>{__host_sketch_buf.data(), __num_regs});
+  }
 
-    // dispatch to the policy's finalizer for bias correction, etc.
-    return _Policy::finalize(__sum, __zeroes, __precision);
+  //! @brief Compute the estimated distinct items count of a sketch that resides in host-accessible
+  //! memory.
+  //!
+  //! @return Approximate distinct items count
+  [[nodiscard]] _CCCL_HOST ::cuda::std::size_t __estimate_host() const
+  {
+    return __estimate_host(::cuda::std::span<const __register_type>{__sketch.data(), __sketch.size()});
   }
 
   // #endif
@@ -561,6 +692,78 @@ public:
   }
 
 private:
+  //! @brief Hashes items on the host and folds them into the given registers.
+  //!
+  //! @param __items Host-accessible items
+  //! @param __registers Registers to update, laid out like `__sketch`
+  _CCCL_HOST void
+  __add_host(::cuda::std::span<const _Tp> __items, ::cuda::std::span<__register_type> __registers) const noexcept
+  {
+    using __hash_result_type = decltype(__policy.hash(::cuda::std::declval<const _Tp&>()));
+
+    // Hash a group of items before touching the registers, so that the independent hash
+    // computations can be interleaved (and vectorized) by the compiler.
+    constexpr ::cuda::std::size_t __lanes = 8;
+
+    const auto __update = [&](__hash_result_type __h) {
+      auto& __reg = __registers[__policy.register_index(__h, __precision)];
+      __reg       = ::cuda::std::max(__reg, static_cast<__register_type>(__policy.register_value(__h, __precision)));
+    };
+
+    const auto __num_items  = __items.size();
+    ::cuda::std::size_t __i = 0;
+    for (; __i + __lanes <= __num_items; __i += __lanes)
+    {
+      __hash_result_type __hashes[__lanes];
+      _CCCL_PRAGMA_UNROLL_FULL()
+      for (::cuda::std::size_t __lane = 0; __lane < __lanes; ++__lane)
+      {
+        __hashes[__lane] = __policy.hash(__items[__i + __lane]);
+      }
+      for (const auto __h : __hashes)
+      {
+        __update(__h);
+      }
+    }
+    for (; __i < __num_items; ++__i)
+    {
+      __update(__policy.hash(__items[__i]));
+    }
+  }
+
+  //! @brief Folds the given registers into `__sketch` by register-wise maximum on the host.
+  //!
+  //! @param __registers Registers to merge, laid out like `__sketch`
+  _CCCL_HOST void __merge_host(::cuda::std::span<const __register_type> __registers) noexcept
+  {
+    for (::cuda::std::size_t __i = 0; __i < __sketch.size(); ++__i)
+    {
+      __sketch[__i] = ::cuda::std::max(__sketch[__i], __registers[__i]);
+    }
+  }
+
+  //! @brief Computes the estimate from host-accessible registers.
+  //!
+  //! @param __registers Registers laid out like `__sketch`
+  //!
+  //! @return Approximate distinct items count
+  [[nodiscard]] _CCCL_HOST ::cuda::std::size_t
+  __estimate_host(::cuda::std::span<const __register_type> __registers) const noexcept
+  {
+    __fp_type __sum               = 0;
+    ::cuda::std::int32_t __zeroes = 0;
+
+    // geometric mean computation + count registers with 0s
+    for (const auto __reg : __registers)
+    {
+      __sum += __fp_type{1} / static_cast<__fp_type>(1ull << __reg);
+      __zeroes += __reg == 0;
+    }
+
+    // dispatch to the policy's finalizer for bias correction, etc.
+    return _Policy::finalize(__sum, __zeroes, __precision);
+  }
+
   //! @brief Atomically updates the register at position `i` with `max(reg[i], value)`.
   //!
   //! @param __i Register index
@@ -21,6 +21,11 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__host_stdlib/stdexcept>
+#include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/span>
+
 #include <cuda/experimental/__cuco/detail/hash_functions/murmurhash3.cuh>
 #include <cuda/experimental/__cuco/detail/hash_functions/xxhash.cuh>
 
@@ -90,6 +95,53 @@ public:
 };
 
 #endif // _CCCL_HAS_INT128()
+
+//! @brief Hashes every key of a host-accessible range, writing one hash value per key.
+//!
+//! Unlike `hash::operator()(span)`, which hashes the bytes of the whole span as a single key,
+//! this computes `__out[__i] = __hasher(__keys[__i])` for every `__i`. Keys are processed in
+//! groups of `__hash_bulk_lanes`, whose hash chains are independent of each other, so the
+//! compiler can keep several keys in flight per SIMD register instead of hashing them
+//! one after the other.
+//!
+//! @throw std::invalid_argument if `__out` is smaller than `__keys`
+//!
+//! @tparam _Key The type of the values to hash
+//! @tparam _Algo The hash algorithm
+//! @tparam _Result The output value type; must be constructible from the hash value type
+//!
+//! @param __hasher The hash function
+//! @param __keys The keys to hash
+//! @param __out Output storage for the hash values, at least `__keys.size()` elements
+template <typename _Key, hash_algorithm _Algo, typename _Result>
+_CCCL_HOST_API void
+hash_bulk(const hash<_Key, _Algo>& __hasher, ::cuda::std::span<const _Key> __keys, ::cuda::std::span<_Result> __out)
+{
+  static_assert(::cuda::std::is_convertible_v<decltype(__hasher(__keys[0])), _Result>,
+                "The output type must be able to hold the hash value");
+
+  if (__out.size() < __keys.size())
+  {
+    _CCCL_THROW(::std::invalid_argument, "hash_bulk output is smaller than its input");
+  }
+
+  constexpr ::cuda::std::size_t __hash_bulk_lanes = 8;
+
+  const ::cuda::std::size_t __n = __keys.size();
+  ::cuda::std::size_t __i       = 0;
+  for (; __i + __hash_bulk_lanes <= __n; __i += __hash_bulk_lanes)
+  {
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (::cuda::std::size_t __lane = 0; __lane < __hash_bulk_lanes; ++__lane)
+    {
+      __out[__i + __lane] = static_cast<_Result>(__hasher(__keys[__i + __lane]));
+    }
+  }
+  for (; __i < __n; ++__i)
+  {
+    __out[__i] = static_cast<_Result>(__hasher(__keys[__i]));
+  }
+}
 } // namespace cuda::experimental::cuco
 
 #include <cuda/std/__cccl/epilogue.h>
@@ -281,6 +281,31 @@ public:
     __ref.add(__first, __last, __stream);
   }
 
+  //! @brief Adds to be counted items from host memory to the estimator.
+  //!
+  //! The items are hashed by up to `__num_threads` host threads into a host copy of the sketch,
+  //! which is then copied back to the device. The result is identical to adding the same items
+  //! with `add`.
+  //!
+  //! @note This function synchronizes the given stream.
+  //!
+  //! @tparam _HostMemoryResource Host memory resource used for allocating the host buffer the
+  //! sketch is staged in
+  //!
+  //! @param __items Host-accessible items
+  //! @param __host_mr Host memory resource used for staging the sketch
+  //! @param __stream CUDA stream this operation is executed in
+  //! @param __num_threads Maximum number of host threads to use; 0 selects
+  //! `std::thread::hardware_concurrency()`
+  template <typename _HostMemoryResource = ::cuda::mr::legacy_pinned_memory_resource>
+  void add_bulk(::cuda::std::span<const _Tp> __items,
+                _HostMemoryResource __host_mr = {},
+                ::cuda::stream_ref __stream   = ::cuda::stream_ref{cudaStream_t{nullptr}},
+                unsigned __num_threads        = 0)
+  {
+    __ref.add_bulk(__items, __host_mr, __stream, __num_threads);
+  }
+
   //! @brief Asynchronously merges the result of `other` estimator into `*this` estimator.
   //!
   //! @throw If sketch_bytes() != __other.sketch_bytes()
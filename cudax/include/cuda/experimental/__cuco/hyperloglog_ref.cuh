@@ -206,6 +206,46 @@ public:
     __impl.__add(__first, __last, __stream);
   }
 
+  //! @brief Adds to be counted items to the estimator on the host.
+  //!
+  //! The sketch must reside in host-accessible memory and must not be modified concurrently. The
+  //! items are split into chunks that are hashed by up to `__num_threads` host threads. The
+  //! resulting sketch is byte-identical to the one obtained by adding the same items on the
+  //! device, so host and device sketches can be merged with each other.
+  //!
+  //! @param __items Host-accessible items
+  //! @param __num_threads Maximum number of host threads to use; 0 selects
+  //! `std::thread::hardware_concurrency()`
+  _CCCL_HOST void add_bulk(::cuda::std::span<const _Tp> __items, unsigned __num_threads = 0)
+  {
+    __impl.__add_bulk(__items, __num_threads);
+  }
+
+  //! @brief Adds to be counted items from host memory to an estimator whose sketch resides in
+  //! device memory.
+  //!
+  //! The sketch is copied to a host buffer, updated as by `add_bulk(__items, __num_threads)`, and
+  //! copied back.
+  //!
+  //! @note This function synchronizes the given stream.
+  //!
+  //! @tparam _HostMemoryResource Host memory resource used for allocating the host buffer the
+  //! sketch is staged in
+  //!
+  //! @param __items Host-accessible items
+  //! @param __host_mr Host memory resource used for staging the sketch
+  //! @param __stream CUDA stream this operation is executed in
+  //! @param __num_threads Maximum number of host threads to use; 0 selects
+  //! `std::thread::hardware_concurrency()`
+  template <typename _HostMemoryResource>
+  _CCCL_HOST void add_bulk(::cuda::std::span<const _Tp> __items,
+                           _HostMemoryResource __host_mr,
+                           ::cuda::stream_ref __stream,
+                           unsigned __num_threads = 0)
+  {
+    __impl.__add_bulk(__items, __host_mr, __stream, __num_threads);
+  }
+
   //! @brief Merges the result of `other` estimator reference into `*this` estimator reference.
   //!
   //! @throw If sketch_bytes() != __other.sketch_bytes(), then terminates execution with a device __trap()
@@ -256,6 +296,21 @@ public:
     __impl.__merge(__other.__impl, __stream);
   }
 
+  //! @brief Merges the result of `other` estimator reference into `*this` estimator on the host.
+  //!
+  //! @note Both sketches must reside in host-accessible memory.
+  //!
+  //! @throw If sketch_bytes() != __other.sketch_bytes()
+  //!
+  //! @tparam _OtherScope Thread scope of `other` estimator
+  //!
+  //! @param __other Other estimator reference to be merged into `*this`
+  template <::cuda::thread_scope _OtherScope>
+  _CCCL_HOST void merge_host(const hyperloglog_ref<_Tp, _OtherScope, _Policy>& __other)
+  {
+    __impl.__merge_host(__other.__impl);
+  }
+
   //! @brief Compute the estimated distinct items count.
   //!
   //! @param __group CUDA thread block group this operation is executed in
@@ -285,6 +340,16 @@ public:
     return __impl.__estimate(__host_mr, __stream);
   }
 
+  //! @brief Compute the estimated distinct items count on the host.
+  //!
+  //! @note The sketch must reside in host-accessible memory.
+  //!
+  //! @return Approximate distinct items count
+  [[nodiscard]] _CCCL_HOST ::cuda::std::size_t estimate_host() const
+  {
+    return __impl.__estimate_host();
+  }
+
   //! @brief Gets the hash function.
   //!
   //! @return The hash function
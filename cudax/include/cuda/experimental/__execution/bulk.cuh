@@ -43,6 +43,7 @@
 #include <cuda/experimental/__execution/policy.cuh>
 #include <cuda/experimental/__execution/queries.cuh>
 #include <cuda/experimental/__execution/rcvr_ref.cuh>
+#include <cuda/experimental/__execution/trace.cuh>
 #include <cuda/experimental/__execution/transform_completion_signatures.cuh>
 #include <cuda/experimental/__execution/transform_sender.cuh>
 #include <cuda/experimental/__execution/type_traits.cuh>
@@ -326,7 +327,19 @@ struct _CCCL_TYPE_VISIBILITY_DEFAULT bulk_chunked_t : __bulk_t<bulk_chunked_t>
     {
       _CCCL_TRY //
       {
+#if _CUDAX_HAS_EXECUTION_TRACING()
+        const auto __start_ns = __trace::__now();
+#endif // _CUDAX_HAS_EXECUTION_TRACING()
         this->__state_->__fn_(_Shape(0), _Shape(this->__state_->__shape_), __values...);
+#if _CUDAX_HAS_EXECUTION_TRACING()
+        __trace::__record(execution::get_env(this->__state_->__rcvr_),
+                          "bulk_chunked",
+                          trace_event_kind::bulk_chunk,
+                          trace_completion::none,
+                          __start_ns,
+                          0,
+                          static_cast<::cuda::std::size_t>(this->__state_->__shape_));
+#endif // _CUDAX_HAS_EXECUTION_TRACING()
         execution::set_value(static_cast<_Rcvr&&>(this->__state_->__rcvr_), static_cast<_Values&&>(__values)...);
       }
       _CCCL_CATCH_ALL //
@@ -364,10 +377,22 @@ struct _CCCL_TYPE_VISIBILITY_DEFAULT bulk_unchunked_t : __bulk_t<bulk_unchunked_
     {
       _CCCL_TRY //
       {
+#if _CUDAX_HAS_EXECUTION_TRACING()
+        const auto __start_ns = __trace::__now();
+#endif // _CUDAX_HAS_EXECUTION_TRACING()
         for (_Shape __index{}; __index != this->__state_->__shape_; ++__index)
         {
           this->__state_->__fn_(_Shape(__index), __values...);
         }
+#if _CUDAX_HAS_EXECUTION_TRACING()
+        __trace::__record(execution::get_env(this->__state_->__rcvr_),
+                          "bulk_unchunked",
+                          trace_event_kind::bulk_chunk,
+                          trace_completion::none,
+                          __start_ns,
+                          0,
+                          static_cast<::cuda::std::size_t>(this->__state_->__shape_));
+#endif // _CUDAX_HAS_EXECUTION_TRACING()
         execution::set_value(static_cast<_Rcvr&&>(this->__state_->__rcvr_), static_cast<_Values&&>(__values)...);
       }
       _CCCL_CATCH_ALL //
@@ -30,6 +30,7 @@
 #include <cuda/experimental/__execution/exception.cuh>
 #include <cuda/experimental/__execution/fwd.cuh>
 #include <cuda/experimental/__execution/queries.cuh>
+#include <cuda/experimental/__execution/trace.cuh>
 #include <cuda/experimental/__execution/utility.cuh>
 
 #include <cuda/experimental/__execution/prologue.cuh>
@@ -88,12 +89,24 @@ public:
   {
     __atomic_intrusive_queue<&__task::__next_>* __queue_;
     _Rcvr __rcvr_;
+#if _CUDAX_HAS_EXECUTION_TRACING()
+    ::cuda::std::uint64_t __enqueue_ns_ = 0;
+#endif // _CUDAX_HAS_EXECUTION_TRACING()
 
     _CCCL_HOST_DEVICE_API static void __execute_impl(__task* __p) noexcept
     {
       static_assert(noexcept(get_stop_token(declval<env_of_t<_Rcvr>>()).stop_requested()));
       auto& __rcvr = static_cast<__opstate_t*>(__p)->__rcvr_;
 
+#if _CUDAX_HAS_EXECUTION_TRACING()
+      // Record the time spent in the queue before completing, which may destroy *this.
+      __trace::__record(get_env(__rcvr),
+                        "run_loop",
+                        trace_event_kind::queue_wait,
+                        trace_completion::none,
+                        static_cast<__opstate_t*>(__p)->__enqueue_ns_);
+#endif // _CUDAX_HAS_EXECUTION_TRACING()
+
       if (get_stop_token(get_env(__rcvr)).stop_requested())
       {
         set_stopped(static_cast<_Rcvr&&>(__rcvr));
@@ -113,6 +126,9 @@ public:
 
     _CCCL_HOST_DEVICE_API constexpr void start() noexcept
     {
+#if _CUDAX_HAS_EXECUTION_TRACING()
+      __enqueue_ns_ = __trace::__now();
+#endif // _CUDAX_HAS_EXECUTION_TRACING()
       __queue_->push(this);
     }
   };
@@ -0,0 +1,967 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_TASK
+#define __CUDAX_EXECUTION_TASK
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+// Coroutines are a host-only feature. The task type is only available when the host
+// compiler supports C++20 coroutines.
+#if _CCCL_HOSTED() && _CCCL_STD_VER >= 2020 && defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#  define _CUDAX_HAS_EXECUTION_TASK() 1
+#else
+#  define _CUDAX_HAS_EXECUTION_TASK() 0
+#endif
+
+#if _CUDAX_HAS_EXECUTION_TASK()
+
+#  include <cuda/__utility/immovable.h>
+#  include <cuda/std/__bit/integral.h>
+#  include <cuda/std/__exception/cuda_error.h>
+#  include <cuda/std/__exception/exception_macros.h>
+#  include <cuda/std/__memory/allocator.h>
+#  include <cuda/std/__memory/allocator_traits.h>
+#  include <cuda/std/__memory/construct_at.h>
+#  include <cuda/std/__new/launder.h>
+#  include <cuda/std/__type_traits/decay.h>
+#  include <cuda/std/__utility/exchange.h>
+#  include <cuda/std/atomic>
+#  include <cuda/std/cstddef>
+#  include <cuda/std/optional>
+#  include <cuda/std/tuple>
+
+#  include <cuda/experimental/__execution/any_allocator.cuh>
+#  include <cuda/experimental/__execution/completion_signatures.cuh>
+#  include <cuda/experimental/__execution/cpos.cuh>
+#  include <cuda/experimental/__execution/env.cuh>
+#  include <cuda/experimental/__execution/exception.cuh>
+#  include <cuda/experimental/__execution/fwd.cuh>
+#  include <cuda/experimental/__execution/get_completion_signatures.cuh>
+#  include <cuda/experimental/__execution/inline_scheduler.cuh>
+#  include <cuda/experimental/__execution/parallel_scheduler_backend.cuh>
+#  include <cuda/experimental/__execution/queries.cuh>
+#  include <cuda/experimental/__execution/stop_token.cuh>
+#  include <cuda/experimental/__execution/task_scheduler.cuh>
+
+#  include <coroutine>
+#  include <memory>
+#  include <new>
+#  include <system_error>
+
+#  include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+template <class _Ty = void>
+class _CCCL_TYPE_VISIBILITY_DEFAULT task;
+
+namespace __task
+{
+namespace __coro = ::std;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Coroutine frame allocation
+//
+// Every frame is preceded by a small header that records how the frame must be released.
+// Frames allocated with the default allocator are rounded up to a power-of-two size class
+// and, when released, are parked in a per-thread free list instead of being returned to
+// the heap. In steady state, a coroutine that calls other coroutines therefore reuses the
+// frames of its previous callees and does no heap allocation at all.
+//
+// Frames allocated with a user-provided allocator (either the one in the receiver's
+// environment, or one passed with `allocator_arg`) carry a copy of that allocator in front
+// of the header and are always returned to it. They are never recycled, because the
+// per-thread cache can outlive the allocator.
+struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) __frame_header
+{
+  using __dealloc_fn_t = void(void* __block, size_t __bytes) noexcept;
+
+  void* __block_;
+  size_t __bytes_;
+  __dealloc_fn_t* __dealloc_; // null for recyclable frames
+};
+
+inline constexpr size_t __frame_min_class_log2 = 6; // 64 bytes
+inline constexpr size_t __frame_num_classes    = 7; // up to 4 KiB
+inline constexpr size_t __frame_max_cached     = 16; // per size class and thread
+
+[[nodiscard]] _CCCL_HOST_API inline auto __frame_size_class(size_t __bytes) noexcept -> size_t
+{
+  const size_t __log2 = ::cuda::std::__bit_log2(__bytes - 1) + 1;
+  return __log2 <= __frame_min_class_log2 ? 0 : __log2 - __frame_min_class_log2;
+}
+
+//! @brief A per-thread cache of coroutine frames, segregated by size class.
+struct __frame_cache
+{
+  struct __node
+  {
+    __node* __next_;
+  };
+
+  _CCCL_HIDE_FROM_ABI __frame_cache() = default;
+
+  _CCCL_HOST_API ~__frame_cache()
+  {
+    for (auto*& __head : __free_)
+    {
+      while (__head != nullptr)
+      {
+        ::operator delete(::cuda::std::exchange(__head, __head->__next_));
+      }
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto __allocate(size_t __class) -> void*
+  {
+    if (__node* __head = __free_[__class])
+    {
+      __free_[__class] = __head->__next_;
+      --__count_[__class];
+      return __head;
+    }
+    return ::operator new(size_t(1) << (__class + __frame_min_class_log2));
+  }
+
+  _CCCL_HOST_API void __deallocate(void* __block, size_t __class) noexcept
+  {
+    if (__count_[__class] == __frame_max_cached)
+    {
+      ::operator delete(__block);
+      return;
+    }
+    __free_[__class] = ::new (__block) __node{__free_[__class]};
+    ++__count_[__class];
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static auto __get() noexcept -> __frame_cache&
+  {
+    static thread_local __frame_cache __cache;
+    return __cache;
+  }
+
+private:
+  __node* __free_[__frame_num_classes]  = {};
+  size_t __count_[__frame_num_classes] = {};
+};
+
+// The allocator that new frames should come from. While a task's coroutine is running on
+// a thread, this points to the allocator obtained from the environment of the receiver
+// that the task was connected to, so the frames of the coroutines it calls come from the
+// same allocator. A null pointer stands for the default allocator.
+[[nodiscard]] _CCCL_HOST_API inline auto __current_frame_allocator() noexcept -> const any_allocator<::cuda::std::byte>*&
+{
+  static thread_local const any_allocator<::cuda::std::byte>* __alloc = nullptr;
+  return __alloc;
+}
+
+//! @brief RAII helper that publishes a task's frame allocator while its coroutine runs.
+struct __frame_allocator_scope : __immovable
+{
+  _CCCL_HOST_API explicit __frame_allocator_scope(const any_allocator<::cuda::std::byte>* __alloc) noexcept
+      : __prev_(::cuda::std::exchange(__current_frame_allocator(), __alloc))
+  {}
+
+  _CCCL_HOST_API ~__frame_allocator_scope()
+  {
+    __current_frame_allocator() = __prev_;
+  }
+
+  const any_allocator<::cuda::std::byte>* __prev_;
+};
+
+template <class _Alloc>
+_CCCL_HOST_API void __deallocate_with(void* __block, size_t __bytes) noexcept
+{
+  auto* __stored = ::cuda::std::launder(static_cast<_Alloc*>(__block));
+  _Alloc __alloc(_CCCL_MOVE(*__stored));
+  __stored->~_Alloc();
+  ::cuda::std::allocator_traits<_Alloc>::deallocate(__alloc, static_cast<::cuda::std::byte*>(__block), __bytes);
+}
+
+template <class _Alloc>
+[[nodiscard]] _CCCL_HOST_API auto __allocate_frame_with(const _Alloc& __user_alloc, size_t __frame_bytes) -> void*
+{
+  using __byte_alloc_t  = typename ::cuda::std::allocator_traits<_Alloc>::template rebind_alloc<::cuda::std::byte>;
+  constexpr size_t __al = alignof(__frame_header);
+  // Round the allocator's footprint up so that the header that follows it stays aligned.
+  constexpr size_t __prefix = (sizeof(__byte_alloc_t) + __al - 1) / __al * __al;
+  static_assert(alignof(__byte_alloc_t) <= __al, "over-aligned allocators are not supported");
+
+  __byte_alloc_t __alloc(__user_alloc);
+  const size_t __bytes = __prefix + sizeof(__frame_header) + __frame_bytes;
+  void* __block        = ::cuda::std::allocator_traits<__byte_alloc_t>::allocate(__alloc, __bytes);
+  ::new (__block) __byte_alloc_t(_CCCL_MOVE(__alloc));
+
+  auto* __header = ::new (static_cast<::cuda::std::byte*>(__block) + __prefix)
+    __frame_header{__block, __bytes, &__task::__deallocate_with<__byte_alloc_t>};
+  return __header + 1;
+}
+
+[[nodiscard]] _CCCL_HOST_API inline auto __allocate_frame(size_t __frame_bytes) -> void*
+{
+  if (const auto* __alloc = __current_frame_allocator())
+  {
+    return __task::__allocate_frame_with(*__alloc, __frame_bytes);
+  }
+
+  const size_t __bytes = sizeof(__frame_header) + __frame_bytes;
+  const size_t __class = __task::__frame_size_class(__bytes);
+  void* __block                             = nullptr;
+  __frame_header::__dealloc_fn_t* __dealloc = nullptr;
+
+  if (__class < __frame_num_classes)
+  {
+    __block = __frame_cache::__get().__allocate(__class);
+  }
+  else
+  {
+    __block   = ::operator new(__bytes);
+    __dealloc = [](void* __blk, size_t) noexcept {
+      ::operator delete(__blk);
+    };
+  }
+
+  auto* __header = ::new (__block) __frame_header{__block, __bytes, __dealloc};
+  return __header + 1;
+}
+
+_CCCL_HOST_API inline void __deallocate_frame(void* __frame) noexcept
+{
+  auto* __header = static_cast<__frame_header*>(__frame) - 1;
+  void* __block  = __header->__block_;
+  size_t __bytes = __header->__bytes_;
+  if (__header->__dealloc_ != nullptr)
+  {
+    __header->__dealloc_(__block, __bytes);
+  }
+  else
+  {
+    __frame_cache::__get().__deallocate(__block, __task::__frame_size_class(__bytes));
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// __context: the state a task's coroutine frames share with the operation state that is
+// running them.
+struct __context
+{
+  // Queries against the environment of the receiver the outermost task was connected to.
+  const __detail::__env_proxy* __env_;
+  // The receiver's allocator, or null if the receiver uses the default allocator.
+  const any_allocator<::cuda::std::byte>* __alloc_;
+};
+
+//! @brief The environment of the receivers that a task connects to the senders it awaits.
+struct __env_t
+{
+  [[nodiscard]] _CCCL_HOST_API auto query(get_stop_token_t) const noexcept -> inplace_stop_token
+  {
+    return __ctx_->__env_->query(get_stop_token);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto query(get_scheduler_t) const noexcept -> task_scheduler
+  {
+    return __ctx_->__env_->query(get_scheduler);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto query(get_allocator_t) const noexcept -> any_allocator<::cuda::std::byte>
+  {
+    return __ctx_->__env_->query(get_allocator);
+  }
+
+  const __context* __ctx_;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// __promise_base
+struct __promise_base
+{
+  _CCCL_HOST_API static auto operator new(size_t __bytes) -> void*
+  {
+    return __task::__allocate_frame(__bytes);
+  }
+
+  template <class _Alloc, class... _Args>
+  _CCCL_HOST_API static auto operator new(size_t __bytes, ::std::allocator_arg_t, const _Alloc& __alloc, _Args&...)
+    -> void*
+  {
+    return __task::__allocate_frame_with(__alloc, __bytes);
+  }
+
+  // Member coroutines receive the object as their first argument.
+  template <class _Self, class _Alloc, class... _Args>
+  _CCCL_HOST_API static auto
+  operator new(size_t __bytes, _Self&, ::std::allocator_arg_t, const _Alloc& __alloc, _Args&...) -> void*
+  {
+    return __task::__allocate_frame_with(__alloc, __bytes);
+  }
+
+  _CCCL_HOST_API static void operator delete(void* __frame, size_t) noexcept
+  {
+    __task::__deallocate_frame(__frame);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto initial_suspend() noexcept -> __coro::suspend_always
+  {
+    return {};
+  }
+
+  _CCCL_HOST_API void unhandled_exception() noexcept
+  {
+    __eptr_ = execution::current_exception();
+  }
+
+  // Called when a sender awaited by this coroutine completes with set_stopped. Returns the
+  // coroutine to resume next, if any.
+  [[nodiscard]] _CCCL_HOST_API auto __unhandled_stopped() noexcept -> __coro::coroutine_handle<>
+  {
+    return __on_stopped_(this);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto __get_env() const noexcept -> __env_t
+  {
+    return __env_t{__ctx_};
+  }
+
+  using __stopped_fn_t _CCCL_NODEBUG_ALIAS = __coro::coroutine_handle<>(__promise_base*) noexcept;
+
+  const __context* __ctx_ = nullptr;
+  // The coroutine awaiting this one, or null for the outermost task.
+  __coro::coroutine_handle<> __continuation_{};
+  // Invoked when the task finishes (for the outermost task only).
+  void (*__on_complete_)(void*) noexcept = nullptr;
+  void* __on_complete_arg_               = nullptr;
+  // Invoked when the task completes with "stopped".
+  __stopped_fn_t* __on_stopped_ = nullptr;
+  exception_ptr __eptr_{};
+};
+
+//! @brief The awaiter returned from a task's final_suspend. It transfers control
+//! symmetrically to the awaiting coroutine so that deep chains of task calls do not grow
+//! the stack.
+struct __final_awaiter
+{
+  [[nodiscard]] _CCCL_HOST_API static constexpr auto await_ready() noexcept -> bool
+  {
+    return false;
+  }
+
+  template <class _Promise>
+  [[nodiscard]] _CCCL_HOST_API auto await_suspend(__coro::coroutine_handle<_Promise> __h) noexcept
+    -> __coro::coroutine_handle<>
+  {
+    __promise_base& __promise = __h.promise();
+    if (__promise.__continuation_)
+    {
+      return __promise.__continuation_;
+    }
+    // The outermost task: complete the receiver. This may destroy the coroutine frame, so
+    // the promise must not be touched afterwards.
+    __promise.__on_complete_(__promise.__on_complete_arg_);
+    return __coro::noop_coroutine();
+  }
+
+  _CCCL_HOST_API static constexpr void await_resume() noexcept {}
+};
+
+template <class _Ty>
+struct __promise_value_base : __promise_base
+{
+  template <class _Uy = _Ty>
+  _CCCL_HOST_API void return_value(_Uy&& __value) noexcept(__nothrow_constructible<_Ty, _Uy>)
+  {
+    __value_.emplace(static_cast<_Uy&&>(__value));
+  }
+
+  ::cuda::std::optional<_Ty> __value_{};
+};
+
+template <>
+struct __promise_value_base<void> : __promise_base
+{
+  _CCCL_HOST_API void return_void() noexcept
+  {
+    __has_value_ = true;
+  }
+
+  bool __has_value_ = false;
+};
+
+template <class... _Ts>
+struct __await_result
+{
+  using type _CCCL_NODEBUG_ALIAS = ::cuda::std::tuple<decay_t<_Ts>...>;
+};
+
+template <class _Ty>
+struct __await_result<_Ty>
+{
+  using type _CCCL_NODEBUG_ALIAS = decay_t<_Ty>;
+};
+
+template <>
+struct __await_result<>
+{
+  using type _CCCL_NODEBUG_ALIAS = void;
+};
+
+template <class... _Ts>
+using __await_result_t _CCCL_NODEBUG_ALIAS = typename __await_result<_Ts...>::type;
+
+template <class _Sndr>
+using __completions_of_t _CCCL_NODEBUG_ALIAS = completion_signatures_of_t<_Sndr, __env_t>;
+
+template <class... _Ts>
+struct __single_or_void
+{
+  using type _CCCL_NODEBUG_ALIAS = void;
+};
+
+template <class _Ty>
+struct __single_or_void<_Ty>
+{
+  using type _CCCL_NODEBUG_ALIAS = _Ty;
+};
+
+template <class... _Ts>
+using __single_or_void_t _CCCL_NODEBUG_ALIAS = typename __single_or_void<_Ts...>::type;
+
+template <class _Sndr, class _Completions = __completions_of_t<_Sndr>>
+using __sender_result_t _CCCL_NODEBUG_ALIAS = __value_types<_Completions, __await_result_t, __single_or_void_t>;
+
+template <class _Sndr>
+_CCCL_CONCEPT __single_value_sender = _CCCL_REQUIRES_EXPR((_Sndr))( //
+  requires(__valid_completion_signatures<__completions_of_t<_Sndr>>),
+  requires(__completions_of_t<_Sndr>::count(set_value) <= 1));
+
+// Turns any error into an exception_ptr, so that it can be rethrown at the point of the
+// co_await.
+struct __as_eptr_fn
+{
+  template <class _Error>
+  [[nodiscard]] _CCCL_HOST_API auto operator()(_Error&& __err) const noexcept -> exception_ptr
+  {
+    if constexpr (__same_as<decay_t<_Error>, exception_ptr>)
+    {
+      return static_cast<_Error&&>(__err);
+    }
+    else
+    {
+      _CCCL_TRY
+      {
+        if constexpr (__same_as<decay_t<_Error>, ::std::error_code>)
+        {
+          throw ::std::system_error(__err);
+        }
+        else if constexpr (__same_as<decay_t<_Error>, cudaError_t>)
+        {
+          _CCCL_THROW(::cuda::cuda_error, __err, "co_await failed with cudaError_t");
+        }
+        else
+        {
+          throw static_cast<_Error&&>(__err);
+        }
+      }
+      _CCCL_CATCH_ALL
+      {
+        return execution::current_exception();
+      }
+      _CCCL_UNREACHABLE();
+    }
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// __sender_awaitable: adapts a sender so that a task can co_await it.
+template <class _Promise, class _Sndr>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __sender_awaitable
+{
+private:
+  using __result_t = __sender_result_t<_Sndr>;
+  using __value_t  = ::cuda::std::conditional_t<__same_as<__result_t, void>, ::cuda::std::monostate, __result_t>;
+
+  enum class __state_t : int8_t
+  {
+    __pending,
+    __value,
+    __error
+  };
+
+  struct __rcvr_t
+  {
+    using receiver_concept = receiver_t;
+
+    template <class... _As>
+    _CCCL_HOST_API void set_value(_As&&... __as) noexcept
+    {
+      _CCCL_TRY
+      {
+        if constexpr (sizeof...(_As) == 1)
+        {
+          __self_->__value_.emplace(static_cast<_As&&>(__as)...);
+        }
+        else if constexpr (sizeof...(_As) > 1)
+        {
+          __self_->__value_.emplace(::cuda::std::tuple<decay_t<_As>...>{static_cast<_As&&>(__as)...});
+        }
+        else
+        {
+          __self_->__value_.emplace();
+        }
+        __self_->__state_ = __state_t::__value;
+      }
+      _CCCL_CATCH_ALL
+      {
+        __self_->__eptr_  = execution::current_exception();
+        __self_->__state_ = __state_t::__error;
+      }
+      __self_->__resume();
+    }
+
+    template <class _Error>
+    _CCCL_HOST_API void set_error(_Error&& __err) noexcept
+    {
+      __self_->__eptr_  = __as_eptr_fn{}(static_cast<_Error&&>(__err));
+      __self_->__state_ = __state_t::__error;
+      __self_->__resume();
+    }
+
+    _CCCL_HOST_API void set_stopped() noexcept
+    {
+      // The awaiting coroutine never resumes. Its promise decides what runs next.
+      if (__self_->__claim())
+      {
+        const __frame_allocator_scope __scope(__self_->__promise_->__ctx_->__alloc_);
+        __self_->__promise_->__unhandled_stopped().resume();
+      }
+      else
+      {
+        __self_->__stopped_inline_ = true;
+      }
+    }
+
+    [[nodiscard]] _CCCL_HOST_API auto get_env() const noexcept -> __env_t
+    {
+      return __self_->__promise_->__get_env();
+    }
+
+    __sender_awaitable* __self_;
+  };
+
+  using __opstate_t = connect_result_t<_Sndr, __rcvr_t>;
+
+  // Returns true if the caller is responsible for resuming the coroutine; false if the
+  // coroutine has not suspended yet, in which case await_suspend will notice the
+  // completion and decline to suspend. This avoids a recursive resume (and unbounded stack
+  // growth) when the awaited sender completes synchronously inside start().
+  [[nodiscard]] _CCCL_HOST_API auto __claim() noexcept -> bool
+  {
+    return __ready_.exchange(true, ::cuda::std::memory_order_acq_rel);
+  }
+
+  _CCCL_HOST_API void __resume() noexcept
+  {
+    if (__claim())
+    {
+      const __frame_allocator_scope __scope(__promise_->__ctx_->__alloc_);
+      __continuation_.resume();
+    }
+  }
+
+public:
+  _CCCL_HOST_API explicit __sender_awaitable(_Sndr&& __sndr, _Promise& __promise)
+      : __promise_(&__promise)
+      , __opstate_(execution::connect(static_cast<_Sndr&&>(__sndr), __rcvr_t{this}))
+  {}
+
+  _CCCL_IMMOVABLE(__sender_awaitable);
+
+  [[nodiscard]] _CCCL_HOST_API static constexpr auto await_ready() noexcept -> bool
+  {
+    return false;
+  }
+
+  // Returning false resumes the awaiting coroutine without growing the stack, so a loop
+  // over senders that complete synchronously runs in constant stack space.
+  [[nodiscard]] _CCCL_HOST_API auto await_suspend(__coro::coroutine_handle<_Promise> __h) noexcept -> bool
+  {
+    __continuation_ = __h;
+    execution::start(__opstate_);
+    if (!__claim())
+    {
+      return true; // the sender will complete asynchronously
+    }
+    if (__stopped_inline_)
+    {
+      __promise_->__unhandled_stopped().resume();
+      return true;
+    }
+    return false;
+  }
+
+  _CCCL_HOST_API auto await_resume() -> __result_t
+  {
+    if (__state_ == __state_t::__error)
+    {
+      execution::rethrow_exception(_CCCL_MOVE(__eptr_));
+    }
+    if constexpr (!__same_as<__result_t, void>)
+    {
+      return _CCCL_MOVE(*__value_);
+    }
+  }
+
+private:
+  _Promise* __promise_;
+  __coro::coroutine_handle<_Promise> __continuation_{};
+  ::cuda::std::atomic<bool> __ready_{false};
+  bool __stopped_inline_ = false;
+  __state_t __state_     = __state_t::__pending;
+  ::cuda::std::optional<__value_t> __value_{};
+  exception_ptr __eptr_{};
+  __opstate_t __opstate_;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// __task_awaitable: the awaitable used when one task co_awaits another.
+template <class _Promise, class _Ty>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __task_awaitable
+{
+  using __child_promise_t = typename task<_Ty>::promise_type;
+
+  _CCCL_HOST_API explicit __task_awaitable(__coro::coroutine_handle<__child_promise_t> __child) noexcept
+      : __child_(__child)
+  {}
+
+  _CCCL_HOST_API __task_awaitable(__task_awaitable&& __other) noexcept
+      : __child_(::cuda::std::exchange(__other.__child_, {}))
+  {}
+
+  _CCCL_HOST_API ~__task_awaitable()
+  {
+    if (__child_)
+    {
+      __child_.destroy();
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static constexpr auto await_ready() noexcept -> bool
+  {
+    return false;
+  }
+
+  // Symmetric transfer into the child. The child transfers back to us from its final
+  // suspend point.
+  [[nodiscard]] _CCCL_HOST_API auto await_suspend(__coro::coroutine_handle<_Promise> __parent) noexcept
+    -> __coro::coroutine_handle<>
+  {
+    auto& __child              = __child_.promise();
+    __child.__ctx_             = __parent.promise().__ctx_;
+    __child.__continuation_    = __parent;
+    __child.__on_complete_arg_ = __parent.address();
+    __child.__on_stopped_      = &__propagate_stopped;
+    return __child_;
+  }
+
+  _CCCL_HOST_API auto await_resume() -> _Ty
+  {
+    auto& __child = __child_.promise();
+    if (__child.__eptr_)
+    {
+      execution::rethrow_exception(_CCCL_MOVE(__child.__eptr_));
+    }
+    if constexpr (!__same_as<_Ty, void>)
+    {
+      return _CCCL_MOVE(*__child.__value_);
+    }
+  }
+
+private:
+  // When the child completes with "stopped", so does the parent.
+  _CCCL_HOST_API static auto __propagate_stopped(__promise_base* __child) noexcept -> __coro::coroutine_handle<>
+  {
+    auto __parent = __coro::coroutine_handle<_Promise>::from_address(__child->__on_complete_arg_);
+    return __parent.promise().__unhandled_stopped();
+  }
+
+  __coro::coroutine_handle<__child_promise_t> __child_;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// __opstate_t: the operation state produced by connecting a task to a receiver.
+template <class _Ty, class _Rcvr>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __opstate_t : __detail::__env_proxy
+{
+  using operation_state_concept = operation_state_t;
+  using __promise_t             = typename task<_Ty>::promise_type;
+  using __handle_t              = __coro::coroutine_handle<__promise_t>;
+  using __rcvr_alloc_t          = decay_t<__call_result_t<get_allocator_t, env_of_t<_Rcvr>>>;
+  using __rcvr_stop_token_t     = stop_token_of_t<env_of_t<_Rcvr>>;
+
+  static constexpr bool __has_custom_allocator =
+    !__same_as<__rcvr_alloc_t, ::cuda::std::allocator<::cuda::std::byte>>
+    && !__same_as<__rcvr_alloc_t, ::cuda::std::allocator<void>>;
+
+  // If the receiver's stop token is not an inplace_stop_token, the task gets its own
+  // stop source, and a stop callback connects the two.
+  static constexpr bool __needs_stop_bridge =
+    !__same_as<__rcvr_stop_token_t, inplace_stop_token> && !__same_as<__rcvr_stop_token_t, never_stop_token>;
+
+  _CCCL_HOST_API explicit __opstate_t(__handle_t __coro, _Rcvr __rcvr)
+      : __rcvr_(static_cast<_Rcvr&&>(__rcvr))
+      , __coro_(__coro)
+      , __alloc_(execution::get_allocator(execution::get_env(__rcvr_)))
+      , __ctx_{this, __has_custom_allocator ? &__alloc_ : nullptr}
+  {
+    auto& __promise              = __coro_.promise();
+    __promise.__ctx_             = &__ctx_;
+    __promise.__on_complete_     = &__complete;
+    __promise.__on_complete_arg_ = this;
+    __promise.__on_stopped_      = &__stopped;
+  }
+
+  _CCCL_IMMOVABLE(__opstate_t);
+
+  _CCCL_HOST_API ~__opstate_t()
+  {
+    if (__coro_)
+    {
+      __coro_.destroy();
+    }
+  }
+
+  _CCCL_HOST_API void start() noexcept
+  {
+    if constexpr (__needs_stop_bridge)
+    {
+      __stop_callback_.emplace(execution::get_stop_token(execution::get_env(__rcvr_)),
+                               __on_stop_request{__stop_source_});
+    }
+    const __frame_allocator_scope __scope(__ctx_.__alloc_);
+    __coro_.resume();
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto query(const get_stop_token_t&) const noexcept -> inplace_stop_token final override
+  {
+    if constexpr (__same_as<__rcvr_stop_token_t, inplace_stop_token>)
+    {
+      return execution::get_stop_token(execution::get_env(__rcvr_));
+    }
+    else
+    {
+      return __stop_source_.get_token();
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto query(const get_allocator_t&) const noexcept
+    -> any_allocator<::cuda::std::byte> final override
+  {
+    return __alloc_;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto query(const get_scheduler_t&) const noexcept -> task_scheduler final override
+  {
+    if constexpr (__callable<const get_scheduler_t&, env_of_t<_Rcvr>>)
+    {
+      return task_scheduler{execution::get_scheduler(execution::get_env(__rcvr_))};
+    }
+    else
+    {
+      return task_scheduler{inline_scheduler{}};
+    }
+  }
+
+private:
+  _CCCL_HOST_API static void __complete(void* __arg) noexcept
+  {
+    auto* __self    = static_cast<__opstate_t*>(__arg);
+    auto& __promise = __self->__coro_.promise();
+    __self->__stop_callback_.reset();
+    if (__promise.__eptr_)
+    {
+      execution::set_error(static_cast<_Rcvr&&>(__self->__rcvr_), _CCCL_MOVE(__promise.__eptr_));
+    }
+    else if constexpr (__same_as<_Ty, void>)
+    {
+      execution::set_value(static_cast<_Rcvr&&>(__self->__rcvr_));
+    }
+    else
+    {
+      execution::set_value(static_cast<_Rcvr&&>(__self->__rcvr_), _CCCL_MOVE(*__promise.__value_));
+    }
+  }
+
+  _CCCL_HOST_API static auto __stopped(__promise_base* __promise) noexcept -> __coro::coroutine_handle<>
+  {
+    auto* __self = static_cast<__opstate_t*>(__promise->__on_complete_arg_);
+    __self->__stop_callback_.reset();
+    execution::set_stopped(static_cast<_Rcvr&&>(__self->__rcvr_));
+    return __coro::noop_coroutine();
+  }
+
+  using __stop_callback_t _CCCL_NODEBUG_ALIAS =
+    ::cuda::std::conditional_t<__needs_stop_bridge,
+                               stop_callback_for_t<__rcvr_stop_token_t, __on_stop_request>,
+                               ::cuda::std::monostate>;
+
+  _Rcvr __rcvr_;
+  __handle_t __coro_;
+  any_allocator<::cuda::std::byte> __alloc_;
+  __context __ctx_;
+  inplace_stop_source __stop_source_{};
+  ::cuda::std::optional<__stop_callback_t> __stop_callback_{};
+};
+} // namespace __task
+
+//! @brief Converts a sender into an awaitable that a task coroutine can `co_await`.
+//!
+//! If the sender completes with a value, `co_await` evaluates to that value (or to a
+//! `cuda::std::tuple` of values, or `void` if there are none). If it completes with an
+//! error, the error is thrown from the `co_await` expression. If it completes with
+//! "stopped", the awaiting task completes with "stopped" without resuming.
+struct as_awaitable_t
+{
+  _CCCL_TEMPLATE(class _Ty, class _Promise)
+  _CCCL_REQUIRES(__task::__single_value_sender<_Ty>)
+  [[nodiscard]] _CCCL_HOST_API auto operator()(_Ty&& __sndr, _Promise& __promise) const
+    -> __task::__sender_awaitable<_Promise, _Ty>
+  {
+    return __task::__sender_awaitable<_Promise, _Ty>{static_cast<_Ty&&>(__sndr), __promise};
+  }
+
+  template <class _Ty, class _Promise>
+  [[nodiscard]] _CCCL_HOST_API auto operator()(task<_Ty>&& __task, _Promise&) const
+    -> __task::__task_awaitable<_Promise, _Ty>
+  {
+    return __task::__task_awaitable<_Promise, _Ty>{::cuda::std::exchange(__task.__coro_, {})};
+  }
+};
+
+_CCCL_GLOBAL_CONSTANT as_awaitable_t as_awaitable{};
+
+//! @brief A lazily-started coroutine that is also a sender.
+//!
+//! A `task<T>` completes with `set_value(T)` (or `set_value()` for `task<void>`), with
+//! `set_error(exception_ptr)` if the coroutine exits with an exception, or with
+//! `set_stopped()` if a sender it awaits completes with "stopped".
+//!
+//! Inside the coroutine, `co_await` accepts senders and other tasks. The environment of
+//! the receiver the task is connected to is made available to the awaited senders: they
+//! see its stop token (as an `inplace_stop_token`), its scheduler (as a `task_scheduler`)
+//! and its allocator. Awaiting another task transfers control symmetrically, so long
+//! chains of nested tasks run in constant stack space.
+//!
+//! Coroutine frames are allocated from the receiver's allocator. Frames obtained from the
+//! default allocator are recycled through a per-thread, size-segregated cache, so repeated
+//! task calls do not touch the heap in steady state. A coroutine may also take
+//! `cuda::std::allocator_arg, alloc` as its leading arguments to allocate its own frame with
+//! `alloc`.
+//!
+//! @tparam _Ty The type of the value the task produces.
+template <class _Ty>
+class _CCCL_TYPE_VISIBILITY_DEFAULT task
+{
+public:
+  using sender_concept = sender_t;
+
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT promise_type : __task::__promise_value_base<_Ty>
+  {
+    [[nodiscard]] _CCCL_HOST_API auto get_return_object() noexcept -> task
+    {
+      return task{__task::__coro::coroutine_handle<promise_type>::from_promise(*this)};
+    }
+
+    [[nodiscard]] _CCCL_HOST_API auto final_suspend() noexcept -> __task::__final_awaiter
+    {
+      return {};
+    }
+
+    template <class _Awaitable>
+    [[nodiscard]] _CCCL_HOST_API auto await_transform(_Awaitable&& __awaitable)
+      -> decltype(execution::as_awaitable(static_cast<_Awaitable&&>(__awaitable), declval<promise_type&>()))
+    {
+      return execution::as_awaitable(static_cast<_Awaitable&&>(__awaitable), *this);
+    }
+
+    [[nodiscard]] _CCCL_HOST_API auto get_env() const noexcept -> __task::__env_t
+    {
+      return this->__get_env();
+    }
+  };
+
+  _CCCL_HOST_API task(task&& __other) noexcept
+      : __coro_(::cuda::std::exchange(__other.__coro_, {}))
+  {}
+
+  _CCCL_HOST_API auto operator=(task __other) noexcept -> task&
+  {
+    ::cuda::std::swap(__coro_, __other.__coro_);
+    return *this;
+  }
+
+  _CCCL_HOST_API ~task()
+  {
+    if (__coro_)
+    {
+      __coro_.destroy();
+    }
+  }
+
+  template <class _Self, class...>
+  [[nodiscard]] _CCCL_HOST_API static _CCCL_CONSTEVAL auto get_completion_signatures() noexcept
+  {
+    if constexpr (__same_as<_Ty, void>)
+    {
+      return completion_signatures<set_value_t(), set_error_t(exception_ptr), set_stopped_t()>{};
+    }
+    else
+    {
+      return completion_signatures<set_value_t(_Ty), set_error_t(exception_ptr), set_stopped_t()>{};
+    }
+  }
+
+  template <class _Rcvr>
+  [[nodiscard]] _CCCL_HOST_API auto connect(_Rcvr __rcvr) && -> __task::__opstate_t<_Ty, _Rcvr>
+  {
+    _CCCL_ASSERT(__coro_, "cannot connect a task that has already been connected or awaited");
+    return __task::__opstate_t<_Ty, _Rcvr>{::cuda::std::exchange(__coro_, {}), static_cast<_Rcvr&&>(__rcvr)};
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static constexpr auto get_env() noexcept -> env<>
+  {
+    return {};
+  }
+
+private:
+  friend struct as_awaitable_t;
+
+  _CCCL_HOST_API explicit task(__task::__coro::coroutine_handle<promise_type> __coro) noexcept
+      : __coro_(__coro)
+  {}
+
+  __task::__coro::coroutine_handle<promise_type> __coro_;
+};
+} // namespace cuda::experimental::execution
+
+#  include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // _CUDAX_HAS_EXECUTION_TASK()
+
+#endif // __CUDAX_EXECUTION_TASK
@@ -40,6 +40,7 @@
 #include <cuda/experimental/__execution/inline_scheduler.cuh>
 #include <cuda/experimental/__execution/parallel_scheduler_backend.cuh>
 #include <cuda/experimental/__execution/rcvr_ref.cuh>
+#include <cuda/experimental/__execution/trace.cuh>
 #include <cuda/experimental/__execution/transform_completion_signatures.cuh>
 #include <cuda/experimental/__execution/variant.cuh>
 #include <cuda/experimental/__utility/shared_ptr.cuh>
@@ -435,7 +436,19 @@ public:
       constexpr bool __parallelize =
         ::cuda::std::is_same_v<_Policy, ::cuda::std::execution::parallel_policy>
         || ::cuda::std::is_same_v<_Policy, ::cuda::std::execution::parallel_unsequenced_policy>;
+#if _CUDAX_HAS_EXECUTION_TRACING()
+      const auto __start_ns = __trace::__now();
+#endif // _CUDAX_HAS_EXECUTION_TRACING()
       __visit(__detail::__get_execute_bulk_fn<__parallelize>(_BulkTag(), __fn_, __shape_, __begin, __end), __values_);
+#if _CUDAX_HAS_EXECUTION_TRACING()
+      __trace::__record(execution::get_env(this->__rcvr_),
+                        "task_scheduler bulk",
+                        trace_event_kind::bulk_chunk,
+                        trace_completion::none,
+                        __start_ns,
+                        __begin,
+                        __end);
+#endif // _CUDAX_HAS_EXECUTION_TRACING()
     }
     _CCCL_CATCH_ALL
     {
@@ -0,0 +1,471 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_TRACE
+#define __CUDAX_EXECUTION_TRACE
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+// Tracing is opt-in. Define CUDAX_EXECUTION_ENABLE_TRACING before including any of the
+// execution headers to record when operations start and complete, how long work waits
+// in a run_loop, and how long bulk chunks take. Otherwise, none of the hooks are compiled
+// and the `traced` adaptor returns its sender unchanged.
+#if defined(CUDAX_EXECUTION_ENABLE_TRACING) && _CCCL_HOSTED() && !_CCCL_COMPILER(NVRTC)
+#  define _CUDAX_HAS_EXECUTION_TRACING() 1
+#else
+#  define _CUDAX_HAS_EXECUTION_TRACING() 0
+#endif
+
+#include <cuda/__utility/immovable.h>
+#include <cuda/std/__type_traits/copy_cvref.h>
+
+#include <cuda/experimental/__execution/completion_signatures.cuh>
+#include <cuda/experimental/__execution/concepts.cuh>
+#include <cuda/experimental/__execution/cpos.cuh>
+#include <cuda/experimental/__execution/env.cuh>
+#include <cuda/experimental/__execution/fwd.cuh>
+#include <cuda/experimental/__execution/get_completion_signatures.cuh>
+#include <cuda/experimental/__execution/queries.cuh>
+#include <cuda/experimental/__execution/utility.cuh>
+
+#if _CUDAX_HAS_EXECUTION_TRACING()
+#  include <cuda/std/cstddef>
+#  include <cuda/std/cstdint>
+
+#  include <chrono>
+#  include <cstdio>
+#  include <mutex>
+#  include <ostream>
+#  include <thread>
+#  include <vector>
+
+#  include <nv/target>
+#endif // _CUDAX_HAS_EXECUTION_TRACING()
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+#if _CUDAX_HAS_EXECUTION_TRACING()
+
+//! @brief What a trace_event measures.
+enum class trace_event_kind : unsigned char
+{
+  operation, //!< From the start of a `traced` operation to its completion.
+  queue_wait, //!< From the time work was enqueued in a run_loop to the time it ran.
+  bulk_chunk, //!< The execution of one chunk of a bulk operation.
+};
+
+//! @brief How a traced operation completed.
+enum class trace_completion : unsigned char
+{
+  none,
+  value,
+  error,
+  stopped,
+};
+
+//! @brief One interval recorded by a tracer. Times are nanoseconds of
+//! `std::chrono::steady_clock`.
+struct _CCCL_TYPE_VISIBILITY_DEFAULT trace_event
+{
+  const char* name;
+  trace_event_kind kind;
+  trace_completion completion;
+  ::cuda::std::uint64_t begin_ns;
+  ::cuda::std::uint64_t end_ns;
+  ::std::thread::id thread; //!< The thread that completed the work.
+  ::cuda::std::size_t chunk_begin; //!< For bulk chunks, the range of indices that were executed.
+  ::cuda::std::size_t chunk_end;
+};
+
+//! @brief A thread-safe collection of trace events.
+//!
+//! Make a tracer available to a sender pipeline with the `get_tracer` query, for
+//! instance with `write_env(sndr, prop{get_tracer, &my_tracer})`. Event names are not
+//! copied, so they must outlive the tracer; string literals are the intended use.
+class _CCCL_TYPE_VISIBILITY_DEFAULT tracer
+{
+public:
+  _CCCL_HOST_API tracer()
+      : __epoch_ns_(__now())
+  {}
+
+  [[nodiscard]] _CCCL_HOST_API static auto __now() noexcept -> ::cuda::std::uint64_t
+  {
+    return static_cast<::cuda::std::uint64_t>(::std::chrono::duration_cast<::std::chrono::nanoseconds>(
+                                                ::std::chrono::steady_clock::now().time_since_epoch())
+                                                .count());
+  }
+
+  _CCCL_HOST_API void record(const trace_event& __event)
+  {
+    ::std::lock_guard<::std::mutex> __lock{__mutex_};
+    __events_.push_back(__event);
+  }
+
+  //! @brief Returns a copy of the events recorded so far, in the order they were recorded.
+  [[nodiscard]] _CCCL_HOST_API auto events() const -> ::std::vector<trace_event>
+  {
+    ::std::lock_guard<::std::mutex> __lock{__mutex_};
+    return __events_;
+  }
+
+  _CCCL_HOST_API void clear()
+  {
+    ::std::lock_guard<::std::mutex> __lock{__mutex_};
+    __events_.clear();
+  }
+
+  //! @brief Writes the recorded events in the Trace Event Format understood by
+  //! `chrome://tracing` and https://ui.perfetto.dev. Timestamps are microseconds since
+  //! the tracer was created, and threads are numbered in order of appearance.
+  _CCCL_HOST_API void write_chrome_trace(::std::ostream& __os) const
+  {
+    const auto __events = events();
+    ::std::vector<::std::thread::id> __threads;
+
+    __os << "{\"traceEvents\":[";
+    for (::cuda::std::size_t __i = 0; __i < __events.size(); ++__i)
+    {
+      const trace_event& __event = __events[__i];
+
+      ::cuda::std::size_t __tid = 0;
+      while (__tid < __threads.size() && __threads[__tid] != __event.thread)
+      {
+        ++__tid;
+      }
+      if (__tid == __threads.size())
+      {
+        __threads.push_back(__event.thread);
+      }
+
+      __os << (__i == 0 ? "\n" : ",\n") << "{\"name\":";
+      __write_string(__os, __event.name);
+      __os << ",\"cat\":\"" << __kind_name(__event.kind) << "\",\"ph\":\"X\",\"ts\":";
+      __write_us(__os, __event.begin_ns < __epoch_ns_ ? 0 : __event.begin_ns - __epoch_ns_);
+      __os << ",\"dur\":";
+      __write_us(__os, __event.end_ns - __event.begin_ns);
+      __os << ",\"pid\":1,\"tid\":" << __tid + 1 << ",\"args\":{";
+      if (__event.kind == trace_event_kind::operation)
+      {
+        __os << "\"completion\":\"" << __completion_name(__event.completion) << "\"";
+      }
+      else if (__event.kind == trace_event_kind::bulk_chunk)
+      {
+        __os << "\"begin\":" << __event.chunk_begin << ",\"end\":" << __event.chunk_end;
+      }
+      __os << "}}";
+    }
+    __os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+  }
+
+private:
+  [[nodiscard]] _CCCL_HOST_API static auto __kind_name(trace_event_kind __kind) noexcept -> const char*
+  {
+    switch (__kind)
+    {
+      case trace_event_kind::operation:
+        return "operation";
+      case trace_event_kind::queue_wait:
+        return "queue_wait";
+      default:
+        return "bulk_chunk";
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static auto __completion_name(trace_completion __completion) noexcept -> const char*
+  {
+    switch (__completion)
+    {
+      case trace_completion::value:
+        return "value";
+      case trace_completion::error:
+        return "error";
+      case trace_completion::stopped:
+        return "stopped";
+      default:
+        return "none";
+    }
+  }
+
+  _CCCL_HOST_API static void __write_us(::std::ostream& __os, ::cuda::std::uint64_t __ns)
+  {
+    char __buf[32];
+    ::std::snprintf(
+      __buf, sizeof(__buf), "%llu.%03u", static_cast<unsigned long long>(__ns / 1000), static_cast<unsigned>(__ns % 1000));
+    __os << __buf;
+  }
+
+  _CCCL_HOST_API static void __write_string(::std::ostream& __os, const char* __str)
+  {
+    __os << '"';
+    for (; __str && *__str; ++__str)
+    {
+      const unsigned char __ch = static_cast<unsigned char>(*__str);
+      if (__ch == '"' || __ch == '\\')
+      {
+        __os << '\\' << *__str;
+      }
+      else if (__ch < 0x20)
+      {
+        char __buf[8];
+        ::std::snprintf(__buf, sizeof(__buf), "\\u%04x", static_cast<unsigned>(__ch));
+        __os << __buf;
+      }
+      else
+      {
+        __os << *__str;
+      }
+    }
+    __os << '"';
+  }
+
+  mutable ::std::mutex __mutex_;
+  ::std::vector<trace_event> __events_;
+  ::cuda::std::uint64_t __epoch_ns_;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// get_tracer
+_CCCL_GLOBAL_CONSTANT struct get_tracer_t
+{
+  template <class _Env>
+  [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr auto operator()(const _Env& __env) const noexcept -> tracer*
+  {
+    static_assert(__nothrow_queryable_with_or<_Env, get_tracer_t, true>, "The get_tracer query must be noexcept.");
+    return __query_or(__env, *this, static_cast<tracer*>(nullptr));
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr auto query(forwarding_query_t) noexcept -> bool
+  {
+    return true;
+  }
+} get_tracer{};
+
+namespace __trace
+{
+// Device code is not traced, so these are no-ops when called from a kernel.
+[[nodiscard]] _CCCL_HOST_DEVICE_API inline auto __now() noexcept -> ::cuda::std::uint64_t
+{
+  NV_IF_ELSE_TARGET(NV_IS_HOST, (return tracer::__now();), (return 0;))
+}
+
+template <class _Env>
+_CCCL_HOST_DEVICE_API void __record(
+  const _Env& __env,
+  const char* __name,
+  trace_event_kind __kind,
+  trace_completion __completion,
+  ::cuda::std::uint64_t __begin_ns,
+  ::cuda::std::size_t __chunk_begin = 0,
+  ::cuda::std::size_t __chunk_end   = 0) noexcept
+{
+  NV_IF_TARGET(
+    NV_IS_HOST,
+    (if (tracer* __tracer = get_tracer(__env)) {
+      _CCCL_TRY
+      {
+        __tracer->record(trace_event{
+          __name,
+          __kind,
+          __completion,
+          __begin_ns,
+          tracer::__now(),
+          ::std::this_thread::get_id(),
+          __chunk_begin,
+          __chunk_end});
+      }
+      _CCCL_CATCH_ALL
+      {
+        // Losing an event is preferable to failing the operation being traced.
+      }
+    }))
+}
+} // namespace __trace
+
+#endif // _CUDAX_HAS_EXECUTION_TRACING()
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// traced
+struct _CCCL_TYPE_VISIBILITY_DEFAULT traced_t
+{
+  _CUDAX_SEMI_PRIVATE :
+#if _CUDAX_HAS_EXECUTION_TRACING()
+  template <class _Rcvr>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __state_t
+  {
+    _CCCL_HOST_DEVICE_API void __record(trace_completion __completion) noexcept
+    {
+      __trace::__record(
+        execution::get_env(__rcvr_), __name_, trace_event_kind::operation, __completion, __start_ns_);
+    }
+
+    _Rcvr __rcvr_;
+    const char* __name_;
+    ::cuda::std::uint64_t __start_ns_;
+  };
+
+  template <class _Rcvr>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __rcvr_t
+  {
+    using receiver_concept = receiver_t;
+
+    template <class... _Ts>
+    _CCCL_HOST_DEVICE_API void set_value(_Ts&&... __ts) noexcept
+    {
+      __state_->__record(trace_completion::value);
+      execution::set_value(static_cast<_Rcvr&&>(__state_->__rcvr_), static_cast<_Ts&&>(__ts)...);
+    }
+
+    template <class _Error>
+    _CCCL_HOST_DEVICE_API void set_error(_Error&& __err) noexcept
+    {
+      __state_->__record(trace_completion::error);
+      execution::set_error(static_cast<_Rcvr&&>(__state_->__rcvr_), static_cast<_Error&&>(__err));
+    }
+
+    _CCCL_HOST_DEVICE_API void set_stopped() noexcept
+    {
+      __state_->__record(trace_completion::stopped);
+      execution::set_stopped(static_cast<_Rcvr&&>(__state_->__rcvr_));
+    }
+
+    [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr auto get_env() const noexcept -> __fwd_env_t<env_of_t<_Rcvr>>
+    {
+      return __fwd_env(execution::get_env(__state_->__rcvr_));
+    }
+
+    __state_t<_Rcvr>* __state_;
+  };
+
+  template <class _Rcvr, class _CvSndr>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __opstate_t
+  {
+    using operation_state_concept = operation_state_t;
+
+    _CCCL_HOST_DEVICE_API explicit __opstate_t(_CvSndr&& __sndr, _Rcvr __rcvr, const char* __name)
+        : __state_{static_cast<_Rcvr&&>(__rcvr), __name, 0}
+        , __opstate_(execution::connect(static_cast<_CvSndr&&>(__sndr), __rcvr_t<_Rcvr>{&__state_}))
+    {}
+
+    _CCCL_IMMOVABLE(__opstate_t);
+
+    _CCCL_HOST_DEVICE_API void start() noexcept
+    {
+      __state_.__start_ns_ = __trace::__now();
+      execution::start(__opstate_);
+    }
+
+    __state_t<_Rcvr> __state_;
+    connect_result_t<_CvSndr, __rcvr_t<_Rcvr>> __opstate_;
+  };
+
+public:
+  template <class _Sndr>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __sndr_t;
+#endif // _CUDAX_HAS_EXECUTION_TRACING()
+
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __closure_t;
+
+public:
+  //! @brief Wraps a sender so that the start and completion of its operations are
+  //! recorded, under the given name, in the tracer returned by the `get_tracer` query of
+  //! the receiver's environment. When tracing is disabled, returns the sender unchanged.
+  template <class _Sndr>
+  [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr auto operator()(_Sndr __sndr, [[maybe_unused]] const char* __name) const
+  {
+#if _CUDAX_HAS_EXECUTION_TRACING()
+    return __sndr_t<_Sndr>{{}, __name, static_cast<_Sndr&&>(__sndr)};
+#else // ^^^ _CUDAX_HAS_EXECUTION_TRACING() ^^^ / vvv !_CUDAX_HAS_EXECUTION_TRACING() vvv
+    return __sndr;
+#endif // ^^^ !_CUDAX_HAS_EXECUTION_TRACING() ^^^
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr auto operator()(const char* __name) const noexcept -> __closure_t;
+};
+
+#if _CUDAX_HAS_EXECUTION_TRACING()
+template <class _Sndr>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT traced_t::__sndr_t
+{
+  using sender_concept = sender_t;
+
+  template <class _Self, class... _Env>
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static _CCCL_CONSTEVAL auto get_completion_signatures()
+  {
+    return execution::get_child_completion_signatures<_Self, _Sndr, _Env...>();
+  }
+
+  template <class _Rcvr>
+  [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr auto connect(_Rcvr __rcvr) && -> __opstate_t<_Rcvr, _Sndr>
+  {
+    return __opstate_t<_Rcvr, _Sndr>{static_cast<_Sndr&&>(__sndr_), static_cast<_Rcvr&&>(__rcvr), __name_};
+  }
+
+  template <class _Rcvr>
+  [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr auto connect(_Rcvr __rcvr) const& -> __opstate_t<_Rcvr, const _Sndr&>
+  {
+    return __opstate_t<_Rcvr, const _Sndr&>{__sndr_, static_cast<_Rcvr&&>(__rcvr), __name_};
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr auto get_env() const noexcept -> __fwd_env_t<env_of_t<_Sndr>>
+  {
+    return __fwd_env(execution::get_env(__sndr_));
+  }
+
+  /*_CCCL_NO_UNIQUE_ADDRESS*/ traced_t __tag_;
+  const char* __name_;
+  _Sndr __sndr_;
+};
+#endif // _CUDAX_HAS_EXECUTION_TRACING()
+
+struct _CCCL_TYPE_VISIBILITY_DEFAULT traced_t::__closure_t
+{
+  template <class _Sndr>
+  [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr auto operator()(_Sndr __sndr) const
+  {
+    return traced_t{}(static_cast<_Sndr&&>(__sndr), __name_);
+  }
+
+  template <class _Sndr>
+  [[nodiscard]] _CCCL_HOST_DEVICE_API friend constexpr auto operator|(_Sndr __sndr, __closure_t __self)
+  {
+    return traced_t{}(static_cast<_Sndr&&>(__sndr), __self.__name_);
+  }
+
+  const char* __name_;
+};
+
+[[nodiscard]] _CCCL_HOST_DEVICE_API constexpr auto traced_t::operator()(const char* __name) const noexcept
+  -> __closure_t
+{
+  return __closure_t{__name};
+}
+
+#if _CUDAX_HAS_EXECUTION_TRACING()
+template <class _Sndr>
+inline constexpr int structured_binding_size<traced_t::__sndr_t<_Sndr>> = 3;
+#endif // _CUDAX_HAS_EXECUTION_TRACING()
+
+_CCCL_GLOBAL_CONSTANT traced_t traced{};
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_TRACE
@@ -37,9 +37,11 @@
 #include <cuda/experimental/__execution/stop_token.cuh>
 #include <cuda/experimental/__execution/stream_context.cuh>
 #include <cuda/experimental/__execution/sync_wait.cuh>
+#include <cuda/experimental/__execution/task.cuh>
 #include <cuda/experimental/__execution/task_scheduler.cuh>
 #include <cuda/experimental/__execution/then.cuh>
 #include <cuda/experimental/__execution/thread_context.cuh>
+#include <cuda/experimental/__execution/trace.cuh>
 #include <cuda/experimental/__execution/trampoline_scheduler.cuh>
 #include <cuda/experimental/__execution/transform_completion_signatures.cuh>
 #include <cuda/experimental/__execution/transform_sender.cuh>
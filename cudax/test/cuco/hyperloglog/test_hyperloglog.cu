@@ -9,6 +9,7 @@
 //===----------------------------------------------------------------------===//
 
 #include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
 #include <thrust/sequence.h>
 
 #include <cuda/functional>
@@ -245,3 +246,53 @@ C2H_TEST("Hyperloglog estimate works with pinned memory pool", "[hyperloglog]")
   REQUIRE(relative_error < tolerance_factor * relative_standard_deviation);
 }
 #endif // _CCCL_CTK_AT_LEAST(12, 9)
+
+C2H_TEST("HyperLogLog host sketch matches device sketch", "[hyperloglog]", test_types)
+{
+  using T              = c2h::get<0, TestType>;
+  using estimator_type = cudax::cuco::hyperloglog<T>;
+  using ref_type       = typename estimator_type::template ref_type<>;
+  using register_type  = typename estimator_type::register_type;
+
+  const std::size_t num_items = 1 << 20;
+  const int hll_precision     = GENERATE(4, 12, 18);
+  const unsigned num_threads  = GENERATE(1u, 4u);
+  const typename estimator_type::precision precision(hll_precision);
+
+  CAPTURE(num_items, hll_precision, num_threads);
+
+  thrust::host_vector<T> h_items(num_items);
+  thrust::sequence(h_items.begin(), h_items.end(), T{0});
+  thrust::device_vector<T> d_items = h_items;
+  const cuda::std::span<const T> items(thrust::raw_pointer_cast(h_items.data()), num_items);
+
+  estimator_type estimator{precision};
+  estimator.add(d_items.begin(), d_items.end());
+
+  // Sketch computed entirely on the host
+  thrust::host_vector<register_type> host_sketch(ref_type::sketch_bytes(precision) / sizeof(register_type));
+  ref_type host_ref{cuda::std::as_writable_bytes(
+    cuda::std::span<register_type>(thrust::raw_pointer_cast(host_sketch.data()), host_sketch.size()))};
+  host_ref.add_bulk(items.first(num_items / 2), num_threads);
+
+  // Merging the two halves yields the same sketch as adding everything at once
+  thrust::host_vector<register_type> other_sketch(host_sketch.size());
+  ref_type other_ref{cuda::std::as_writable_bytes(
+    cuda::std::span<register_type>(thrust::raw_pointer_cast(other_sketch.data()), other_sketch.size()))};
+  other_ref.add_bulk(items.subspan(num_items / 2), num_threads);
+  host_ref.merge_host(other_ref);
+
+  thrust::host_vector<register_type> device_sketch(host_sketch.size());
+  REQUIRE_CUDART(cudaMemcpy(thrust::raw_pointer_cast(device_sketch.data()),
+                            estimator.sketch().data(),
+                            estimator.sketch_bytes(),
+                            cudaMemcpyDeviceToHost));
+
+  REQUIRE(host_sketch == device_sketch);
+  REQUIRE(host_ref.estimate_host() == estimator.estimate());
+
+  // Staging through the host gives the same result as adding on the device
+  estimator_type staged{precision};
+  staged.add_bulk(items, {}, cuda::stream_ref{cudaStream_t{nullptr}}, num_threads);
+  REQUIRE(staged.estimate() == estimator.estimate());
+}
@@ -241,3 +241,36 @@ TEST_CASE("Test Hasher's on host and device", "")
 #endif // _CCCL_HAS_INT128()
   }
 }
+
+TEST_CASE("Bulk host hashing matches per-key hashing", "")
+{
+  constexpr std::size_t num_keys = 1027; // not a multiple of the lane count
+
+  cuda::std::array<int64_t, num_keys> keys{};
+  for (std::size_t i = 0; i < num_keys; ++i)
+  {
+    keys[i] = static_cast<int64_t>(i * 7919);
+  }
+
+  SECTION("xxhash_64")
+  {
+    cudax::cuco::hash<int64_t, cudax::cuco::hash_algorithm::xxhash_64> hasher(42);
+    cuda::std::array<uint64_t, num_keys> hashes{};
+    cudax::cuco::hash_bulk(hasher, cuda::std::span<const int64_t>(keys), cuda::std::span<uint64_t>(hashes));
+    for (std::size_t i = 0; i < num_keys; ++i)
+    {
+      REQUIRE(hashes[i] == hasher(keys[i]));
+    }
+  }
+
+  SECTION("32-bit hashes widened to 64 bits")
+  {
+    cudax::cuco::hash<int64_t, cudax::cuco::hash_algorithm::murmurhash3_32> hasher;
+    cuda::std::array<uint64_t, num_keys> hashes{};
+    cudax::cuco::hash_bulk(hasher, cuda::std::span<const int64_t>(keys), cuda::std::span<uint64_t>(hashes));
+    for (std::size_t i = 0; i < num_keys; ++i)
+    {
+      REQUIRE(hashes[i] == hasher(keys[i]));
+    }
+  }
+}
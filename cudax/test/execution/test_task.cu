@@ -0,0 +1,224 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Include this first
+#include <cuda/experimental/execution.cuh>
+
+// Then include the test helpers
+#include <memory>
+#include <stdexcept>
+
+#include "common/checked_receiver.cuh"
+#include "common/utility.cuh"
+#include "testing.cuh"
+
+#if _CUDAX_HAS_EXECUTION_TASK()
+
+namespace ex = cuda::experimental::execution;
+
+namespace
+{
+auto identity(int i) -> ex::task<int>
+{
+  co_return i;
+}
+
+auto sum_of_first(int n) -> ex::task<int>
+{
+  int sum = 0;
+  for (int i = 0; i < n; ++i)
+  {
+    sum += co_await identity(i);
+  }
+  co_return sum;
+}
+
+auto count_down(int n) -> ex::task<int>
+{
+  if (n == 0)
+  {
+    co_return 0;
+  }
+  co_return 1 + co_await count_down(n - 1);
+}
+
+auto await_senders() -> ex::task<int>
+{
+  int a = co_await ex::just(40);
+  int b = co_await (ex::just(1) | ex::then([](int i) {
+                      return i + 1;
+                    }));
+  co_return a + b;
+}
+
+auto throws() -> ex::task<void>
+{
+  co_await ex::just();
+  throw std::runtime_error("oops");
+}
+
+auto catches() -> ex::task<int>
+{
+  try
+  {
+    co_await throws();
+  }
+  catch (const std::runtime_error&)
+  {
+    co_return 42;
+  }
+  co_return 0;
+}
+
+auto awaits_error() -> ex::task<int>
+{
+  co_await ex::just_error(42);
+  co_return 0;
+}
+
+auto awaits_stopped() -> ex::task<int>
+{
+  co_await ex::just_stopped();
+  co_return 0;
+}
+
+auto awaits_stopped_task() -> ex::task<int>
+{
+  co_return co_await awaits_stopped();
+}
+
+auto sum_of_ones(int n) -> ex::task<int>
+{
+  int sum = 0;
+  for (int i = 0; i < n; ++i)
+  {
+    sum += co_await ex::just(1);
+  }
+  co_return sum;
+}
+
+auto reads_stop_token() -> ex::task<bool>
+{
+  auto token = co_await ex::read_env(ex::get_stop_token);
+  co_return token.stop_possible();
+}
+
+int allocation_count = 0;
+
+template <class Ty>
+struct counting_allocator
+{
+  using value_type = Ty;
+
+  counting_allocator() = default;
+
+  template <class Uy>
+  counting_allocator(const counting_allocator<Uy>&) noexcept
+  {}
+
+  auto allocate(std::size_t n) -> Ty*
+  {
+    ++allocation_count;
+    return std::allocator<Ty>{}.allocate(n);
+  }
+
+  void deallocate(Ty* p, std::size_t n) noexcept
+  {
+    std::allocator<Ty>{}.deallocate(p, n);
+  }
+
+  friend bool operator==(const counting_allocator&, const counting_allocator&) noexcept
+  {
+    return true;
+  }
+
+  friend bool operator!=(const counting_allocator&, const counting_allocator&) noexcept
+  {
+    return false;
+  }
+};
+
+auto with_allocator(std::allocator_arg_t, counting_allocator<int>, int i) -> ex::task<int>
+{
+  co_return i;
+}
+
+C2H_TEST("task is a sender", "[task]")
+{
+  auto sndr = identity(42);
+  STATIC_REQUIRE(ex::sender<decltype(sndr)>);
+  check_value_types<types<int>>(sndr);
+  check_error_types<ex::exception_ptr>(sndr);
+  check_sends_stopped<true>(sndr);
+
+  auto op = ex::connect(std::move(sndr), checked_value_receiver{42});
+  ex::start(op);
+}
+
+C2H_TEST("task can await other tasks", "[task]")
+{
+  auto [sum] = ex::sync_wait(sum_of_first(10)).value();
+  CHECK(sum == 45);
+
+  auto [depth] = ex::sync_wait(count_down(1000)).value();
+  CHECK(depth == 1000);
+}
+
+C2H_TEST("task can await senders", "[task]")
+{
+  auto [result] = ex::sync_wait(await_senders()).value();
+  CHECK(result == 42);
+
+  // Awaiting a sender that completes inline does not grow the stack.
+  auto [sum] = ex::sync_wait(sum_of_ones(100000)).value();
+  CHECK(sum == 100000);
+}
+
+C2H_TEST("task propagates exceptions", "[task]")
+{
+  auto [result] = ex::sync_wait(catches()).value();
+  CHECK(result == 42);
+
+  auto op = ex::connect(throws(), checked_error_receiver{std::runtime_error("oops")});
+  ex::start(op);
+
+  // Errors from awaited senders are thrown from the co_await expression.
+  CHECK_THROWS_AS(ex::sync_wait(awaits_error()), int);
+}
+
+C2H_TEST("task propagates the stopped signal", "[task]")
+{
+  auto op = ex::connect(awaits_stopped_task(), checked_stopped_receiver{});
+  ex::start(op);
+}
+
+C2H_TEST("task forwards the receiver's stop token", "[task]")
+{
+  auto [stop_possible] = ex::sync_wait(reads_stop_token()).value();
+  CHECK(stop_possible);
+}
+
+C2H_TEST("task allocates coroutine frames with the provided allocator", "[task]")
+{
+  allocation_count = 0;
+  auto [value] = ex::sync_wait(with_allocator(std::allocator_arg, {}, 42)).value();
+  CHECK(value == 42);
+  CHECK(allocation_count == 1);
+
+  // Frames of the coroutines a task awaits come from the receiver's allocator.
+  allocation_count = 0;
+  auto [sum] =
+    ex::sync_wait(ex::write_env(sum_of_first(10), ex::prop{ex::get_allocator, counting_allocator<std::byte>{}})).value();
+  CHECK(sum == 45);
+  CHECK(allocation_count == 10);
+}
+} // namespace
+
+#endif // _CUDAX_HAS_EXECUTION_TASK()
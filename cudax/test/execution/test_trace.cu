@@ -0,0 +1,137 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Tracing must be enabled before any of the execution headers are included.
+#ifndef CUDAX_EXECUTION_ENABLE_TRACING
+#  define CUDAX_EXECUTION_ENABLE_TRACING
+#endif
+
+#include <cuda/experimental/execution.cuh>
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "common/checked_receiver.cuh"
+#include "common/utility.cuh"
+#include "testing.cuh"
+
+#if _CUDAX_HAS_EXECUTION_TRACING()
+
+namespace ex = cuda::experimental::execution;
+
+namespace
+{
+auto find_event(const std::vector<ex::trace_event>& events, const char* name) -> const ex::trace_event*
+{
+  for (const auto& event : events)
+  {
+    if (std::string(event.name) == name)
+    {
+      return &event;
+    }
+  }
+  return nullptr;
+}
+
+C2H_TEST("traced records the completion of an operation", "[trace][adaptors]")
+{
+  ex::tracer tracer;
+  auto sndr = ex::just(42) | ex::traced("answer") | ex::write_env(ex::prop{ex::get_tracer, &tracer});
+
+  auto [result] = ex::sync_wait(std::move(sndr)).value();
+  CHECK(result == 42);
+
+  auto events = tracer.events();
+  REQUIRE(events.size() == 1);
+  CHECK(std::string(events[0].name) == "answer");
+  CHECK(events[0].kind == ex::trace_event_kind::operation);
+  CHECK(events[0].completion == ex::trace_completion::value);
+  CHECK(events[0].begin_ns <= events[0].end_ns);
+  CHECK(events[0].thread == std::this_thread::get_id());
+}
+
+C2H_TEST("traced records errors and cancellation", "[trace][adaptors]")
+{
+  ex::tracer tracer;
+  auto env = ex::prop{ex::get_tracer, &tracer};
+
+  auto op1 = ex::connect(ex::just_error(42) | ex::traced("error") | ex::write_env(env), checked_error_receiver{42});
+  ex::start(op1);
+  auto op2 = ex::connect(ex::just_stopped() | ex::traced("stopped") | ex::write_env(env), checked_stopped_receiver{});
+  ex::start(op2);
+
+  auto events = tracer.events();
+  REQUIRE(events.size() == 2);
+  CHECK(events[0].completion == ex::trace_completion::error);
+  CHECK(events[1].completion == ex::trace_completion::stopped);
+}
+
+C2H_TEST("traced is transparent without a tracer", "[trace][adaptors]")
+{
+  auto op = ex::connect(ex::just(42) | ex::traced("untraced"), checked_value_receiver{42});
+  ex::start(op);
+}
+
+C2H_TEST("run_loop records the time work waits in its queue", "[trace][run_loop]")
+{
+  ex::tracer tracer;
+  ex::thread_context ctx;
+  auto sndr = ex::starts_on(ctx.get_scheduler(), ex::just() | ex::traced("on_context"))
+            | ex::write_env(ex::prop{ex::get_tracer, &tracer});
+  ex::sync_wait(std::move(sndr));
+
+  auto events = tracer.events();
+  auto wait   = find_event(events, "run_loop");
+  auto op     = find_event(events, "on_context");
+  REQUIRE(wait != nullptr);
+  REQUIRE(op != nullptr);
+  CHECK(wait->kind == ex::trace_event_kind::queue_wait);
+  CHECK(wait->thread == ctx.get_id());
+  CHECK(op->thread == ctx.get_id());
+  CHECK(wait->end_ns <= op->end_ns);
+}
+
+C2H_TEST("bulk records the duration of its chunks", "[trace][bulk]")
+{
+  ex::tracer tracer;
+  auto sndr = ex::just(0) | ex::bulk_chunked(ex::par, 8, [](int, int, int&) {})
+            | ex::write_env(ex::prop{ex::get_tracer, &tracer});
+  ex::sync_wait(std::move(sndr));
+
+  auto events = tracer.events();
+  REQUIRE(events.size() == 1);
+  CHECK(events[0].kind == ex::trace_event_kind::bulk_chunk);
+  CHECK(events[0].chunk_begin == 0);
+  CHECK(events[0].chunk_end == 8);
+}
+
+C2H_TEST("tracer writes the Chrome trace event format", "[trace]")
+{
+  ex::tracer tracer;
+  auto env = ex::prop{ex::get_tracer, &tracer};
+  ex::sync_wait(ex::just() | ex::traced("say \"hi\"") | ex::write_env(env));
+  ex::sync_wait(ex::just(0) | ex::bulk_chunked(ex::par, 4, [](int, int, int&) {}) | ex::write_env(env));
+
+  std::ostringstream os;
+  tracer.write_chrome_trace(os);
+  const std::string json = os.str();
+  CHECK(json.find("{\"traceEvents\":[") == 0);
+  CHECK(json.find("\"name\":\"say \\\"hi\\\"\",\"cat\":\"operation\",\"ph\":\"X\"") != std::string::npos);
+  CHECK(json.find("\"completion\":\"value\"") != std::string::npos);
+  CHECK(json.find("\"cat\":\"bulk_chunk\"") != std::string::npos);
+  CHECK(json.find("\"begin\":0,\"end\":4") != std::string::npos);
+
+  tracer.clear();
+  CHECK(tracer.events().empty());
+}
+} // namespace
+
+#endif // _CUDAX_HAS_EXECUTION_TRACING()
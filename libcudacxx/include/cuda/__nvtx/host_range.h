@@ -0,0 +1,119 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___NVTX_HOST_RANGE_H
+#define _CUDA___NVTX_HOST_RANGE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#ifdef _CCCL_DOXYGEN_INVOKED // Only parse this during doxygen passes:
+//! When this macro is defined, the NVTX ranges of CCCL also call the host range hooks installed at runtime, e.g. by
+//! thrust/instrumentation.h, whether NVTX is available or not
+#  define CCCL_HOST_INSTRUMENTATION
+#endif // _CCCL_DOXYGEN_INVOKED
+
+#if !_CCCL_COMPILER(NVRTC)
+
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA
+
+// The callbacks invoked around the NVTX ranges of CCCL in host code, and with the work reported by the algorithms inside
+// them. They are null until an instrumentation backend installs them.
+struct __host_range_hooks
+{
+  // Returns a token passed to __end, or null to not track the range
+  void* (*__begin)(const char* __name) = nullptr;
+  void (*__end)(void* __token)         = nullptr;
+  // Reports the elements processed, the bytes accessed and the threads used by the innermost range of this thread
+  void (*__work)(::cuda::std::size_t __elements, ::cuda::std::size_t __bytes, int __threads) = nullptr;
+};
+
+[[nodiscard]] _CCCL_HOST_API inline __host_range_hooks& __get_host_range_hooks() noexcept
+{
+  static __host_range_hooks __hooks;
+  return __hooks;
+}
+
+_CCCL_HOST_API inline void
+__host_range_work(::cuda::std::size_t __elements, ::cuda::std::size_t __bytes, int __threads) noexcept
+{
+  const auto& __hooks = __get_host_range_hooks();
+  if (__hooks.__work)
+  {
+    __hooks.__work(__elements, __bytes, __threads);
+  }
+}
+
+// Like __nvtx_cccl_optional_range_host_only, started only in host code
+struct __host_range
+{
+  void* __token = nullptr;
+
+  __host_range()                               = default;
+  __host_range(const __host_range&)            = delete;
+  __host_range& operator=(const __host_range&) = delete;
+
+  _CCCL_HOST_API void __start(const char* __name)
+  {
+    const auto& __hooks = __get_host_range_hooks();
+    if (__hooks.__begin)
+    {
+      __token = __hooks.__begin(__name);
+    }
+  }
+
+  _CCCL_API ~__host_range()
+  {
+    NV_IF_TARGET(NV_IS_HOST, ({
+                   if (__token)
+                   {
+                     __get_host_range_hooks().__end(__token);
+                   }
+                 }));
+  }
+};
+
+_CCCL_END_NAMESPACE_CUDA
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // !_CCCL_COMPILER(NVRTC)
+
+#if defined(CCCL_HOST_INSTRUMENTATION) && !_CCCL_COMPILER(NVRTC) && _CCCL_HOST_COMPILATION()
+// Conditionally starts a host range until the end of the current function scope in host code
+#  define _CCCL_HOST_RANGE_SCOPE_IF(condition, name)  \
+    ::cuda::__host_range __cuda_host_range;           \
+    NV_IF_TARGET(NV_IS_HOST, ({                       \
+                   if (condition)                     \
+                   {                                  \
+                     __cuda_host_range.__start(name); \
+                   }                                  \
+                 }))
+// Reports the work of an algorithm to the innermost host range of the calling thread. The arguments are only evaluated
+// when CCCL_HOST_INSTRUMENTATION is defined.
+#  define _CCCL_HOST_RANGE_WORK(elements, bytes, threads) \
+    ::cuda::__host_range_work(                            \
+      static_cast<::cuda::std::size_t>(elements), static_cast<::cuda::std::size_t>(bytes), static_cast<int>(threads))
+#else // ^^^ CCCL_HOST_INSTRUMENTATION ^^^ / vvv !CCCL_HOST_INSTRUMENTATION vvv
+#  define _CCCL_HOST_RANGE_SCOPE_IF(condition, name)
+#  define _CCCL_HOST_RANGE_WORK(elements, bytes, threads)
+#endif // ^^^ !CCCL_HOST_INSTRUMENTATION ^^^
+
+#endif // _CUDA___NVTX_HOST_RANGE_H
@@ -25,6 +25,8 @@
 #  define CCCL_DISABLE_NVTX
 #endif // _CCCL_DOXYGEN_INVOKED
 
+#include <cuda/__nvtx/host_range.h>
+
 #define _CCCL_HAS_NVTX3() 0
 
 // Enable the functionality of this header if:
@@ -122,7 +124,7 @@ _CCCL_END_NAMESPACE_CUDA
 // The __nvtx_cccl_optional_range_host_only type (a simplified optional<T>) is needed to defer the construction of the
 // NVTX range and message string registration (static variables) into a region running only on the host, while
 // preserving the semantic scope where the range is declared.
-#    define _CCCL_NVTX_RANGE_SCOPE_IF(condition, name)                                                             \
+#    define _CCCL_NVTX3_RANGE_SCOPE_IF(condition, name)                                                            \
       _CCCL_BEFORE_NVTX_RANGE_SCOPE(name)                                                                          \
       ::cuda::__nvtx_cccl_optional_range_host_only __cuda_nvtx3_range;                                             \
       NV_IF_TARGET(                                                                                                \
@@ -135,16 +137,21 @@ _CCCL_END_NAMESPACE_CUDA
           }                                                                                                        \
         }))
 #  else // ^^^ _CCCL_HOST_COMPILATION() ^^^ / vvv !_CCCL_HOST_COMPILATION() vvv
-#    define _CCCL_NVTX_RANGE_SCOPE_IF(condition, name)
+#    define _CCCL_NVTX3_RANGE_SCOPE_IF(condition, name)
 #  endif // ^^^ !_CCCL_HOST_COMPILATION() ^^^
 
-#  define _CCCL_NVTX_RANGE_SCOPE(name) _CCCL_NVTX_RANGE_SCOPE_IF(true, name)
-
 #  include <cuda/std/__cccl/epilogue.h>
 
 #else // _CCCL_HAS_NVTX3()
-#  define _CCCL_NVTX_RANGE_SCOPE_IF(condition, name)
-#  define _CCCL_NVTX_RANGE_SCOPE(name)
+#  define _CCCL_NVTX3_RANGE_SCOPE_IF(condition, name)
 #endif // _CCCL_HAS_NVTX3()
 
+// The ranges are emitted to NVTX if nvtx_condition, and passed to the host range hooks with CCCL_HOST_INSTRUMENTATION if
+// host_condition
+#define _CCCL_NVTX_HOST_RANGE_SCOPE_IF(nvtx_condition, host_condition, name) \
+  _CCCL_HOST_RANGE_SCOPE_IF(host_condition, name)                            \
+  _CCCL_NVTX3_RANGE_SCOPE_IF(nvtx_condition, name)
+#define _CCCL_NVTX_RANGE_SCOPE_IF(condition, name) _CCCL_NVTX_HOST_RANGE_SCOPE_IF(condition, condition, name)
+#define _CCCL_NVTX_RANGE_SCOPE(name)               _CCCL_NVTX_RANGE_SCOPE_IF(true, name)
+
 #endif // _CUDA___NVTX_NVTX_H
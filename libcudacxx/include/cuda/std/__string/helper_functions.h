@@ -27,6 +27,7 @@
 #include <cuda/std/__cstddef/types.h>
 #include <cuda/std/__iterator/iterator_traits.h>
 #include <cuda/std/__string/char_traits.h>
+#include <cuda/std/__string/vectorized_search.h>
 
 #include <cuda/std/__cccl/prologue.h>
 
@@ -116,6 +117,16 @@ __cccl_str_find(const _CharT* __p, _SizeT __sz, const _CharT* __s, _SizeT __pos,
     return __pos;
   }
 
+  if constexpr (__cccl_has_vectorized_search<_CharT, _Traits>)
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST,
+                   (const _CharT* __r = ::cuda::std::__cccl_host_search_substring(__p + __pos, __sz - __pos, __s, __n);
+                    return (__r == nullptr) ? __npos : static_cast<_SizeT>(__r - __p);))
+    }
+  }
+
   const _CharT* __r = ::cuda::std::__cccl_search_substring<_CharT, _Traits>(__p + __pos, __p + __sz, __s, __s + __n);
 
   if (__r == __p + __sz)
@@ -140,6 +151,15 @@ _CCCL_API constexpr _SizeT __cccl_str_rfind(const _CharT* __p, _SizeT __sz, _Cha
   {
     __pos = __sz;
   }
+  if constexpr (__cccl_has_vectorized_search<_CharT, _Traits>)
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST,
+                   (const _CharT* __r = ::cuda::std::__cccl_host_find_last_of<false>(__p, __pos, &__c, 1);
+                    return (__r == nullptr) ? __npos : static_cast<_SizeT>(__r - __p);))
+    }
+  }
   _SizeT __result = __npos;
   for (const _CharT* __ps = __p + __pos; __ps != __p;)
   {
@@ -165,6 +185,21 @@ __cccl_str_rfind(const _CharT* __p, _SizeT __sz, const _CharT* __s, _SizeT __pos
   {
     __pos = __sz;
   }
+#if _CCCL_HAS_HOST_SSE2()
+  // Long needles keep the generic algorithm, see __cccl_host_rsearch_substring.
+  if constexpr (__cccl_has_vectorized_search<_CharT, _Traits>)
+  {
+    if (__n > 0 && __n <= __pos && __n <= __cccl_two_way_threshold)
+    {
+      _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+      {
+        NV_IF_TARGET(NV_IS_HOST,
+                     (const _CharT* __r = ::cuda::std::__cccl_host_rsearch_substring(__p, __pos, __s, __n);
+                      return (__r == nullptr) ? __npos : static_cast<_SizeT>(__r - __p);))
+      }
+    }
+  }
+#endif // _CCCL_HAS_HOST_SSE2()
   const _CharT* __r = ::cuda::std::__find_end(
     __p, __p + __pos, __s, __s + __n, _Traits::eq, random_access_iterator_tag(), random_access_iterator_tag());
   if (__n > 0 && __r == __p + __pos)
@@ -182,6 +217,15 @@ __cccl_str_find_first_of(const _CharT* __p, _SizeT __sz, const _CharT* __s, _Siz
   {
     return __npos;
   }
+  if constexpr (__cccl_has_vectorized_search<_CharT, _Traits>)
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST,
+                   (const _CharT* __r = ::cuda::std::__cccl_host_find_first_of<false>(__p + __pos, __sz - __pos, __s, __n);
+                    return (__r == nullptr) ? __npos : static_cast<_SizeT>(__r - __p);))
+    }
+  }
   const _CharT* __r = ::cuda::std::__find_first_of_ce(__p + __pos, __p + __sz, __s, __s + __n, _Traits::eq);
   if (__r == __p + __sz)
   {
@@ -206,6 +250,15 @@ __cccl_str_find_last_of(const _CharT* __p, _SizeT __sz, const _CharT* __s, _Size
   {
     __pos = __sz;
   }
+  if constexpr (__cccl_has_vectorized_search<_CharT, _Traits>)
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST,
+                   (const _CharT* __r = ::cuda::std::__cccl_host_find_last_of<false>(__p, __pos, __s, __n);
+                    return (__r == nullptr) ? __npos : static_cast<_SizeT>(__r - __p);))
+    }
+  }
   _SizeT __result = __npos;
   for (const _CharT* __ps = __p + __pos; __ps != __p;)
   {
@@ -226,6 +279,15 @@ __cccl_str_find_first_not_of(const _CharT* __p, _SizeT __sz, const _CharT* __s,
   {
     return __npos;
   }
+  if constexpr (__cccl_has_vectorized_search<_CharT, _Traits>)
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST,
+                   (const _CharT* __r = ::cuda::std::__cccl_host_find_first_of<true>(__p + __pos, __sz - __pos, __s, __n);
+                    return (__r == nullptr) ? __npos : static_cast<_SizeT>(__r - __p);))
+    }
+  }
   const _CharT* __pe = __p + __sz;
   _SizeT __result    = __npos;
   for (const _CharT* __ps = __p + __pos; __ps != __pe; ++__ps)
@@ -243,6 +305,18 @@ template <class _CharT, class _SizeT, class _Traits, _SizeT __npos>
 _CCCL_API constexpr _SizeT
 __cccl_str_find_first_not_of(const _CharT* __p, _SizeT __sz, _CharT __c, _SizeT __pos) noexcept
 {
+  if constexpr (__cccl_has_vectorized_search<_CharT, _Traits>)
+  {
+    if (__pos < __sz)
+    {
+      _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+      {
+        NV_IF_TARGET(NV_IS_HOST,
+                     (const _CharT* __r = ::cuda::std::__cccl_host_find_first_of<true>(__p + __pos, __sz - __pos, &__c, 1);
+                      return (__r == nullptr) ? __npos : static_cast<_SizeT>(__r - __p);))
+      }
+    }
+  }
   _SizeT __result = __npos;
   if (__pos < __sz)
   {
@@ -272,6 +346,15 @@ __cccl_str_find_last_not_of(const _CharT* __p, _SizeT __sz, const _CharT* __s, _
     __pos = __sz;
   }
 
+  if constexpr (__cccl_has_vectorized_search<_CharT, _Traits>)
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST,
+                   (const _CharT* __r = ::cuda::std::__cccl_host_find_last_of<true>(__p, __pos, __s, __n);
+                    return (__r == nullptr) ? __npos : static_cast<_SizeT>(__r - __p);))
+    }
+  }
   _SizeT __result = __npos;
   for (const _CharT* __ps = __p + __pos; __ps != __p;)
   {
@@ -295,6 +378,15 @@ _CCCL_API constexpr _SizeT __cccl_str_find_last_not_of(const _CharT* __p, _SizeT
   {
     __pos = __sz;
   }
+  if constexpr (__cccl_has_vectorized_search<_CharT, _Traits>)
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST,
+                   (const _CharT* __r = ::cuda::std::__cccl_host_find_last_of<true>(__p, __pos, &__c, 1);
+                    return (__r == nullptr) ? __npos : static_cast<_SizeT>(__r - __p);))
+    }
+  }
   _SizeT __result = __npos;
   for (const _CharT* __ps = __p + __pos; __ps != __p;)
   {
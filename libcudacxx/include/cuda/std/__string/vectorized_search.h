@@ -0,0 +1,631 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___STRING_VECTORIZED_SEARCH_H
+#define _CUDA_STD___STRING_VECTORIZED_SEARCH_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__bit/countl.h>
+#include <cuda/std/__bit/countr.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__fwd/char_traits.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/cstdint>
+
+#if !_CCCL_COMPILER(NVRTC)
+#  include <cstring>
+
+// SSE2 is part of the x86-64 baseline. AVX2 is only used when the host compiler targets it, and
+// never in CUDA compilations, where cudafe++ does not understand every builtin of <immintrin.h>.
+#  if _CCCL_HOST_ARCH(X86_64)
+#    include <emmintrin.h>
+#    define _CCCL_HAS_HOST_SSE2() 1
+#    if defined(__AVX2__) && !_CCCL_CUDA_COMPILATION()
+#      include <immintrin.h>
+#      define _CCCL_HAS_HOST_AVX2() 1
+#    else // ^^^ __AVX2__ ^^^ / vvv !__AVX2__ vvv
+#      define _CCCL_HAS_HOST_AVX2() 0
+#    endif // !__AVX2__
+#  else // ^^^ _CCCL_HOST_ARCH(X86_64) ^^^ / vvv !_CCCL_HOST_ARCH(X86_64) vvv
+#    define _CCCL_HAS_HOST_SSE2() 0
+#    define _CCCL_HAS_HOST_AVX2() 0
+#  endif // !_CCCL_HOST_ARCH(X86_64)
+#else // ^^^ !_CCCL_COMPILER(NVRTC) ^^^ / vvv _CCCL_COMPILER(NVRTC) vvv
+#  define _CCCL_HAS_HOST_SSE2() 0
+#  define _CCCL_HAS_HOST_AVX2() 0
+#endif // _CCCL_COMPILER(NVRTC)
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+// The helpers below implement the string search family for single-byte characters compared with
+// the default char_traits, i.e. for plain byte comparisons. They are only used on the host, and
+// only outside of constant evaluation; the constexpr implementations in helper_functions.h remain
+// the reference. All of them return nullptr when nothing is found.
+
+template <class _CharT, class _Traits>
+inline constexpr bool __cccl_has_vectorized_search =
+#if _CCCL_COMPILER(NVRTC)
+  false;
+#else // ^^^ _CCCL_COMPILER(NVRTC) ^^^ / vvv !_CCCL_COMPILER(NVRTC) vvv
+  sizeof(_CharT) == 1 && is_same_v<_Traits, char_traits<_CharT>>;
+#endif // !_CCCL_COMPILER(NVRTC)
+
+#if !_CCCL_COMPILER(NVRTC)
+
+using __cccl_uchar = unsigned char;
+
+//! @brief A set of bytes, stored as a 256-bit bitmap.
+struct __cccl_byte_set
+{
+  uint64_t __bits_[4] = {};
+
+  _CCCL_HOST_API __cccl_byte_set(const __cccl_uchar* __s, size_t __n) noexcept
+  {
+    for (size_t __i = 0; __i < __n; ++__i)
+    {
+      __bits_[__s[__i] >> 6] |= uint64_t{1} << (__s[__i] & 63);
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API bool __contains(__cccl_uchar __c) const noexcept
+  {
+    return (__bits_[__c >> 6] >> (__c & 63)) & 1;
+  }
+};
+
+#  if _CCCL_HAS_HOST_SSE2()
+struct __cccl_sse2_ops
+{
+  using __vec = __m128i;
+
+  static constexpr size_t __width = 16;
+
+  [[nodiscard]] _CCCL_HOST_API static __vec __load(const __cccl_uchar* __p) noexcept
+  {
+    return ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(__p));
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static __vec __splat(__cccl_uchar __c) noexcept
+  {
+    return ::_mm_set1_epi8(static_cast<char>(__c));
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static __vec __eq(__vec __a, __vec __b) noexcept
+  {
+    return ::_mm_cmpeq_epi8(__a, __b);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static __vec __and(__vec __a, __vec __b) noexcept
+  {
+    return ::_mm_and_si128(__a, __b);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static __vec __or(__vec __a, __vec __b) noexcept
+  {
+    return ::_mm_or_si128(__a, __b);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static __vec __zero() noexcept
+  {
+    return ::_mm_setzero_si128();
+  }
+
+  // One bit per byte, bit i set iff byte i of __v is 0xFF
+  [[nodiscard]] _CCCL_HOST_API static uint32_t __mask(__vec __v) noexcept
+  {
+    return static_cast<uint32_t>(::_mm_movemask_epi8(__v));
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static constexpr uint32_t __all() noexcept
+  {
+    return 0xFFFFu;
+  }
+};
+#  endif // _CCCL_HAS_HOST_SSE2()
+
+#  if _CCCL_HAS_HOST_AVX2()
+struct __cccl_avx2_ops
+{
+  using __vec = __m256i;
+
+  static constexpr size_t __width = 32;
+
+  [[nodiscard]] _CCCL_HOST_API static __vec __load(const __cccl_uchar* __p) noexcept
+  {
+    return ::_mm256_loadu_si256(reinterpret_cast<const __m256i*>(__p));
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static __vec __splat(__cccl_uchar __c) noexcept
+  {
+    return ::_mm256_set1_epi8(static_cast<char>(__c));
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static __vec __eq(__vec __a, __vec __b) noexcept
+  {
+    return ::_mm256_cmpeq_epi8(__a, __b);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static __vec __and(__vec __a, __vec __b) noexcept
+  {
+    return ::_mm256_and_si256(__a, __b);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static __vec __or(__vec __a, __vec __b) noexcept
+  {
+    return ::_mm256_or_si256(__a, __b);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static __vec __zero() noexcept
+  {
+    return ::_mm256_setzero_si256();
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static uint32_t __mask(__vec __v) noexcept
+  {
+    return static_cast<uint32_t>(::_mm256_movemask_epi8(__v));
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static constexpr uint32_t __all() noexcept
+  {
+    return 0xFFFFFFFFu;
+  }
+
+  // Byte-set membership of every byte of __v, using the low and high nibble of each byte to look
+  // up its bit in a 16-entry table (one table for each half of the high-nibble range).
+  struct __set_lookup
+  {
+    __vec __lo_rows_;
+    __vec __hi_rows_;
+
+    _CCCL_HOST_API explicit __set_lookup(const __cccl_byte_set& __set) noexcept
+    {
+      alignas(32) __cccl_uchar __lo[32] = {};
+      alignas(32) __cccl_uchar __hi[32] = {};
+      for (int __c = 0; __c < 256; ++__c)
+      {
+        if (__set.__contains(static_cast<__cccl_uchar>(__c)))
+        {
+          auto& __row = (__c >> 4) < 8 ? __lo[__c & 15] : __hi[__c & 15];
+          __row |= static_cast<__cccl_uchar>(1u << ((__c >> 4) & 7));
+        }
+      }
+      // vpshufb looks up within each 128-bit lane, so both lanes hold the same table.
+      for (int __i = 0; __i < 16; ++__i)
+      {
+        __lo[__i + 16] = __lo[__i];
+        __hi[__i + 16] = __hi[__i];
+      }
+      __lo_rows_ = ::_mm256_load_si256(reinterpret_cast<const __m256i*>(__lo));
+      __hi_rows_ = ::_mm256_load_si256(reinterpret_cast<const __m256i*>(__hi));
+    }
+
+    [[nodiscard]] _CCCL_HOST_API __vec __contains(__vec __v) const noexcept
+    {
+      const __vec __nibble   = ::_mm256_set1_epi8(0x0F);
+      const __vec __bits     = ::_mm256_setr_epi8(
+        1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+      const __vec __lo_nib   = ::_mm256_and_si256(__v, __nibble);
+      const __vec __hi_nib   = ::_mm256_and_si256(::_mm256_srli_epi16(__v, 4), __nibble);
+      const __vec __lo_row   = ::_mm256_shuffle_epi8(__lo_rows_, __lo_nib);
+      const __vec __hi_row   = ::_mm256_shuffle_epi8(__hi_rows_, __lo_nib);
+      const __vec __use_hi   = ::_mm256_cmpgt_epi8(__hi_nib, ::_mm256_set1_epi8(7));
+      const __vec __row      = ::_mm256_blendv_epi8(__lo_row, __hi_row, __use_hi);
+      const __vec __bit      = ::_mm256_shuffle_epi8(__bits, __hi_nib);
+      return ::_mm256_cmpeq_epi8(::_mm256_and_si256(__row, __bit), __bit);
+    }
+  };
+};
+#  endif // _CCCL_HAS_HOST_AVX2()
+
+#  if _CCCL_HAS_HOST_AVX2()
+using __cccl_simd_ops = __cccl_avx2_ops;
+#  elif _CCCL_HAS_HOST_SSE2()
+using __cccl_simd_ops = __cccl_sse2_ops;
+#  endif // _CCCL_HAS_HOST_SSE2()
+
+//! @brief Two-way string matching (Crochemore-Perrin), linear in the haystack length with
+//! constant extra space. Used for long needles, where filtering candidates by their first and
+//! last characters degrades to quadratic behavior on repetitive input.
+[[nodiscard]] _CCCL_HOST_API inline const __cccl_uchar* __cccl_two_way_search(
+  const __cccl_uchar* __h, size_t __hn, const __cccl_uchar* __n, size_t __nn) noexcept
+{
+  // Compute the critical factorization of the needle from its maximal suffixes under both
+  // orderings of the alphabet.
+  size_t __ms     = 0;
+  size_t __period = 1;
+  for (int __reversed = 0; __reversed < 2; ++__reversed)
+  {
+    size_t __ip = static_cast<size_t>(-1);
+    size_t __jp = 0;
+    size_t __k  = 1;
+    size_t __p  = 1;
+    while (__jp + __k < __nn)
+    {
+      const __cccl_uchar __a = __n[__ip + __k];
+      const __cccl_uchar __b = __n[__jp + __k];
+      if (__a == __b)
+      {
+        if (__k == __p)
+        {
+          __jp += __p;
+          __k = 1;
+        }
+        else
+        {
+          ++__k;
+        }
+      }
+      else if (__reversed ? __a < __b : __a > __b)
+      {
+        __jp += __k;
+        __k = 1;
+        __p = __jp - __ip;
+      }
+      else
+      {
+        __ip = __jp++;
+        __k = __p = 1;
+      }
+    }
+    if (__reversed == 0 || __ip + 1 > __ms + 1)
+    {
+      __ms     = __ip;
+      __period = __p;
+    }
+  }
+
+  // For periodic needles, matched prefixes can be remembered across shifts.
+  size_t __mem0 = 0;
+  if (::memcmp(__n, __n + __period, __ms + 1) != 0)
+  {
+    __period = ::cuda::std::max(__ms, __nn - __ms - 1) + 1;
+  }
+  else
+  {
+    __mem0 = __nn - __period;
+  }
+
+  // Bad-character shift for the last byte of the window.
+  size_t __shift[256] = {};
+  for (size_t __i = 0; __i < __nn; ++__i)
+  {
+    __shift[__n[__i]] = __i + 1;
+  }
+
+  size_t __pos = 0;
+  size_t __mem = 0;
+  while (__hn - __pos >= __nn)
+  {
+    const __cccl_uchar* const __w = __h + __pos;
+
+    // Check the last byte of the window first and skip ahead on a mismatch.
+    if (const size_t __last_shift = __shift[__w[__nn - 1]]; __last_shift != __nn)
+    {
+      __pos += ::cuda::std::max(__nn - __last_shift, __mem);
+      __mem = 0;
+      continue;
+    }
+
+    // Compare the right half of the needle.
+    size_t __k = ::cuda::std::max(__ms + 1, __mem);
+    while (__k < __nn && __n[__k] == __w[__k])
+    {
+      ++__k;
+    }
+    if (__k < __nn)
+    {
+      __pos += __k - __ms;
+      __mem = 0;
+      continue;
+    }
+
+    // Compare the left half of the needle.
+    __k = __ms + 1;
+    while (__k > __mem && __n[__k - 1] == __w[__k - 1])
+    {
+      --__k;
+    }
+    if (__k <= __mem)
+    {
+      return __w;
+    }
+    __pos += __period;
+    __mem = __mem0;
+  }
+  return nullptr;
+}
+
+// Needles longer than this are searched for with the two-way algorithm.
+inline constexpr size_t __cccl_two_way_threshold = 64;
+
+//! @brief Returns the first occurrence of the needle in the haystack. Requires 2 <= __nn <= __hn.
+template <class _Ops>
+[[nodiscard]] _CCCL_HOST_API const __cccl_uchar* __cccl_simd_search_substring(
+  const __cccl_uchar* __h, size_t __hn, const __cccl_uchar* __n, size_t __nn) noexcept
+{
+  // Compare the first and the last character of the needle against a whole block of candidate
+  // positions at once. Only candidates that match both are verified.
+  const auto __first = _Ops::__splat(__n[0]);
+  const auto __last  = _Ops::__splat(__n[__nn - 1]);
+
+  const size_t __num_candidates = __hn - __nn + 1;
+  size_t __i                    = 0;
+  for (; __i + _Ops::__width <= __num_candidates; __i += _Ops::__width)
+  {
+    const auto __block_first = _Ops::__load(__h + __i);
+    const auto __block_last  = _Ops::__load(__h + __i + __nn - 1);
+    uint32_t __mask = _Ops::__mask(_Ops::__and(_Ops::__eq(__first, __block_first), _Ops::__eq(__last, __block_last)));
+    while (__mask != 0)
+    {
+      const size_t __pos = __i + ::cuda::std::countr_zero(__mask);
+      if (::memcmp(__h + __pos + 1, __n + 1, __nn - 2) == 0)
+      {
+        return __h + __pos;
+      }
+      __mask &= __mask - 1;
+    }
+  }
+  for (; __i < __num_candidates; ++__i)
+  {
+    if (__h[__i] == __n[0] && __h[__i + __nn - 1] == __n[__nn - 1] && ::memcmp(__h + __i + 1, __n + 1, __nn - 2) == 0)
+    {
+      return __h + __i;
+    }
+  }
+  return nullptr;
+}
+
+//! @brief Returns the last occurrence of the needle in the haystack. Requires 2 <= __nn <= __hn.
+template <class _Ops>
+[[nodiscard]] _CCCL_HOST_API const __cccl_uchar* __cccl_simd_rsearch_substring(
+  const __cccl_uchar* __h, size_t __hn, const __cccl_uchar* __n, size_t __nn) noexcept
+{
+  const auto __first = _Ops::__splat(__n[0]);
+  const auto __last  = _Ops::__splat(__n[__nn - 1]);
+
+  size_t __end = __hn - __nn + 1; // one past the last candidate position
+  for (; __end >= _Ops::__width; __end -= _Ops::__width)
+  {
+    const size_t __i         = __end - _Ops::__width;
+    const auto __block_first = _Ops::__load(__h + __i);
+    const auto __block_last  = _Ops::__load(__h + __i + __nn - 1);
+    uint32_t __mask = _Ops::__mask(_Ops::__and(_Ops::__eq(__first, __block_first), _Ops::__eq(__last, __block_last)));
+    while (__mask != 0)
+    {
+      const int __bit    = 31 - ::cuda::std::countl_zero(__mask);
+      const size_t __pos = __i + __bit;
+      if (::memcmp(__h + __pos + 1, __n + 1, __nn - 2) == 0)
+      {
+        return __h + __pos;
+      }
+      __mask &= ~(uint32_t{1} << __bit);
+    }
+  }
+  while (__end-- > 0)
+  {
+    if (__h[__end] == __n[0] && __h[__end + __nn - 1] == __n[__nn - 1]
+        && ::memcmp(__h + __end + 1, __n + 1, __nn - 2) == 0)
+    {
+      return __h + __end;
+    }
+  }
+  return nullptr;
+}
+
+//! @brief Returns a mask of the bytes of the block at __p that are (or, if _Negate, are not) in
+//! the set.
+template <class _Ops, bool _Negate, class _Matcher>
+[[nodiscard]] _CCCL_HOST_API uint32_t __cccl_simd_set_mask(const __cccl_uchar* __p, const _Matcher& __matcher) noexcept
+{
+  const uint32_t __mask = _Ops::__mask(__matcher(_Ops::__load(__p)));
+  return _Negate ? (~__mask & _Ops::__all()) : __mask;
+}
+
+//! @brief Returns the first byte in [__p, __p + __n) that is (or, if _Negate, is not) in the set.
+template <bool _Negate>
+[[nodiscard]] _CCCL_HOST_API const __cccl_uchar*
+__cccl_find_first_in_set(const __cccl_uchar* __p, size_t __n, const __cccl_uchar* __s, size_t __sn) noexcept
+{
+  const __cccl_byte_set __set{__s, __sn};
+  size_t __i = 0;
+
+#  if _CCCL_HAS_HOST_SSE2()
+  const auto __scan = [&](const auto& __matcher) -> const __cccl_uchar* {
+    for (; __i + __cccl_simd_ops::__width <= __n; __i += __cccl_simd_ops::__width)
+    {
+      if (const uint32_t __mask = ::cuda::std::__cccl_simd_set_mask<__cccl_simd_ops, _Negate>(__p + __i, __matcher))
+      {
+        return __p + __i + ::cuda::std::countr_zero(__mask);
+      }
+    }
+    return nullptr;
+  };
+
+  const __cccl_uchar* __r = nullptr;
+#    if _CCCL_HAS_HOST_AVX2()
+  const __cccl_avx2_ops::__set_lookup __lookup{__set};
+  __r = __scan([&](__cccl_avx2_ops::__vec __v) {
+    return __lookup.__contains(__v);
+  });
+#    else // ^^^ _CCCL_HAS_HOST_AVX2() ^^^ / vvv !_CCCL_HAS_HOST_AVX2() vvv
+  // Without a byte shuffle, compare against every member of small sets.
+  if (__sn <= 16)
+  {
+    __r = __scan([&](__cccl_sse2_ops::__vec __v) {
+      auto __acc = __cccl_sse2_ops::__zero();
+      for (size_t __j = 0; __j < __sn; ++__j)
+      {
+        __acc = __cccl_sse2_ops::__or(__acc, __cccl_sse2_ops::__eq(__v, __cccl_sse2_ops::__splat(__s[__j])));
+      }
+      return __acc;
+    });
+  }
+#    endif // !_CCCL_HAS_HOST_AVX2()
+  if (__r != nullptr)
+  {
+    return __r;
+  }
+#  endif // _CCCL_HAS_HOST_SSE2()
+
+  for (; __i < __n; ++__i)
+  {
+    if (__set.__contains(__p[__i]) != _Negate)
+    {
+      return __p + __i;
+    }
+  }
+  return nullptr;
+}
+
+//! @brief Returns the last byte in [__p, __p + __n) that is (or, if _Negate, is not) in the set.
+template <bool _Negate>
+[[nodiscard]] _CCCL_HOST_API const __cccl_uchar*
+__cccl_find_last_in_set(const __cccl_uchar* __p, size_t __n, const __cccl_uchar* __s, size_t __sn) noexcept
+{
+  const __cccl_byte_set __set{__s, __sn};
+  size_t __end = __n;
+
+#  if _CCCL_HAS_HOST_SSE2()
+  const auto __scan = [&](const auto& __matcher) -> const __cccl_uchar* {
+    for (; __end >= __cccl_simd_ops::__width; __end -= __cccl_simd_ops::__width)
+    {
+      const size_t __i = __end - __cccl_simd_ops::__width;
+      if (const uint32_t __mask = ::cuda::std::__cccl_simd_set_mask<__cccl_simd_ops, _Negate>(__p + __i, __matcher))
+      {
+        return __p + __i + (31 - ::cuda::std::countl_zero(__mask));
+      }
+    }
+    return nullptr;
+  };
+
+  const __cccl_uchar* __r = nullptr;
+#    if _CCCL_HAS_HOST_AVX2()
+  const __cccl_avx2_ops::__set_lookup __lookup{__set};
+  __r = __scan([&](__cccl_avx2_ops::__vec __v) {
+    return __lookup.__contains(__v);
+  });
+#    else // ^^^ _CCCL_HAS_HOST_AVX2() ^^^ / vvv !_CCCL_HAS_HOST_AVX2() vvv
+  if (__sn <= 16)
+  {
+    __r = __scan([&](__cccl_sse2_ops::__vec __v) {
+      auto __acc = __cccl_sse2_ops::__zero();
+      for (size_t __j = 0; __j < __sn; ++__j)
+      {
+        __acc = __cccl_sse2_ops::__or(__acc, __cccl_sse2_ops::__eq(__v, __cccl_sse2_ops::__splat(__s[__j])));
+      }
+      return __acc;
+    });
+  }
+#    endif // !_CCCL_HAS_HOST_AVX2()
+  if (__r != nullptr)
+  {
+    return __r;
+  }
+#  endif // _CCCL_HAS_HOST_SSE2()
+
+  while (__end-- > 0)
+  {
+    if (__set.__contains(__p[__end]) != _Negate)
+    {
+      return __p + __end;
+    }
+  }
+  return nullptr;
+}
+
+// Typed entry points used by helper_functions.h.
+
+template <class _CharT>
+[[nodiscard]] _CCCL_HOST_API const _CharT*
+__cccl_host_search_substring(const _CharT* __h, size_t __hn, const _CharT* __n, size_t __nn) noexcept
+{
+  if (__nn == 0)
+  {
+    return __h;
+  }
+  if (__nn > __hn)
+  {
+    return nullptr;
+  }
+  const auto __uh = reinterpret_cast<const __cccl_uchar*>(__h);
+  const auto __un = reinterpret_cast<const __cccl_uchar*>(__n);
+  const __cccl_uchar* __r;
+  if (__nn == 1)
+  {
+    __r = static_cast<const __cccl_uchar*>(::memchr(__uh, __un[0], __hn));
+  }
+  else if (__nn > __cccl_two_way_threshold)
+  {
+    __r = ::cuda::std::__cccl_two_way_search(__uh, __hn, __un, __nn);
+  }
+  else
+  {
+#  if _CCCL_HAS_HOST_SSE2()
+    __r = ::cuda::std::__cccl_simd_search_substring<__cccl_simd_ops>(__uh, __hn, __un, __nn);
+#  else // ^^^ _CCCL_HAS_HOST_SSE2() ^^^ / vvv !_CCCL_HAS_HOST_SSE2() vvv
+    __r = ::cuda::std::__cccl_two_way_search(__uh, __hn, __un, __nn);
+#  endif // !_CCCL_HAS_HOST_SSE2()
+  }
+  return reinterpret_cast<const _CharT*>(__r);
+}
+
+//! @brief Returns the last occurrence of the needle, or nullptr if there is none. Requires
+//! 1 <= __nn <= __hn. Only available with SIMD support; callers keep the generic implementation
+//! for long needles, where filtering by the first and last character can degrade badly.
+#  if _CCCL_HAS_HOST_SSE2()
+template <class _CharT>
+[[nodiscard]] _CCCL_HOST_API const _CharT*
+__cccl_host_rsearch_substring(const _CharT* __h, size_t __hn, const _CharT* __n, size_t __nn) noexcept
+{
+  const auto __uh = reinterpret_cast<const __cccl_uchar*>(__h);
+  const auto __un = reinterpret_cast<const __cccl_uchar*>(__n);
+  if (__nn == 1)
+  {
+    return reinterpret_cast<const _CharT*>(::cuda::std::__cccl_find_last_in_set<false>(__uh, __hn, __un, 1));
+  }
+  return reinterpret_cast<const _CharT*>(::cuda::std::__cccl_simd_rsearch_substring<__cccl_simd_ops>(__uh, __hn, __un, __nn));
+}
+#  endif // _CCCL_HAS_HOST_SSE2()
+
+template <bool _Negate, class _CharT>
+[[nodiscard]] _CCCL_HOST_API const _CharT*
+__cccl_host_find_first_of(const _CharT* __p, size_t __n, const _CharT* __s, size_t __sn) noexcept
+{
+  return reinterpret_cast<const _CharT*>(::cuda::std::__cccl_find_first_in_set<_Negate>(
+    reinterpret_cast<const __cccl_uchar*>(__p), __n, reinterpret_cast<const __cccl_uchar*>(__s), __sn));
+}
+
+template <bool _Negate, class _CharT>
+[[nodiscard]] _CCCL_HOST_API const _CharT*
+__cccl_host_find_last_of(const _CharT* __p, size_t __n, const _CharT* __s, size_t __sn) noexcept
+{
+  return reinterpret_cast<const _CharT*>(::cuda::std::__cccl_find_last_in_set<_Negate>(
+    reinterpret_cast<const __cccl_uchar*>(__p), __n, reinterpret_cast<const __cccl_uchar*>(__s), __sn));
+}
+
+#endif // !_CCCL_COMPILER(NVRTC)
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___STRING_VECTORIZED_SEARCH_H
@@ -0,0 +1,194 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <cuda/std/string_view>
+
+// Searches in strings that span several SIMD blocks, with matches on and around block boundaries,
+// and with needles long enough to take the two-way search path on the host.
+
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+#include <cuda/std/string_view>
+
+constexpr cuda::std::size_t haystack_size = 300;
+
+template <class CharT>
+TEST_FUNC constexpr cuda::std::size_t
+naive_find(const CharT* h, cuda::std::size_t hn, const CharT* n, cuda::std::size_t nn, cuda::std::size_t pos)
+{
+  for (cuda::std::size_t i = pos; i + nn <= hn; ++i)
+  {
+    cuda::std::size_t j = 0;
+    while (j < nn && h[i + j] == n[j])
+    {
+      ++j;
+    }
+    if (j == nn)
+    {
+      return i;
+    }
+  }
+  return cuda::std::basic_string_view<CharT>::npos;
+}
+
+template <class CharT>
+TEST_FUNC constexpr cuda::std::size_t
+naive_rfind(const CharT* h, cuda::std::size_t hn, const CharT* n, cuda::std::size_t nn)
+{
+  for (cuda::std::size_t i = hn - nn + 1; nn <= hn && i-- > 0;)
+  {
+    cuda::std::size_t j = 0;
+    while (j < nn && h[i + j] == n[j])
+    {
+      ++j;
+    }
+    if (j == nn)
+    {
+      return i;
+    }
+  }
+  return cuda::std::basic_string_view<CharT>::npos;
+}
+
+template <class CharT>
+TEST_FUNC constexpr void fill(CharT* buf, cuda::std::size_t n, unsigned seed, unsigned alphabet)
+{
+  for (cuda::std::size_t i = 0; i < n; ++i)
+  {
+    seed   = seed * 1103515245u + 12345u;
+    buf[i] = static_cast<CharT>('a' + (seed >> 16) % alphabet);
+  }
+}
+
+template <class CharT>
+TEST_FUNC constexpr void test_substring(unsigned alphabet)
+{
+  using SV = cuda::std::basic_string_view<CharT>;
+
+  CharT h[haystack_size]{};
+  fill(h, haystack_size, 7u, alphabet);
+  const SV sv{h, haystack_size};
+
+  const cuda::std::size_t needle_sizes[] = {1, 2, 3, 15, 16, 17, 31, 32, 33, 64, 65, 100};
+  const cuda::std::size_t offsets[]      = {0, 1, 14, 15, 16, 31, 32, 33, 150, 199};
+  for (cuda::std::size_t nn : needle_sizes)
+  {
+    for (cuda::std::size_t off : offsets)
+    {
+      if (off + nn > haystack_size)
+      {
+        continue;
+      }
+      const SV needle = sv.substr(off, nn);
+      assert(sv.find(needle) == naive_find(h, haystack_size, needle.data(), nn, 0));
+      assert(sv.find(needle, off) == off);
+      assert(sv.find(needle, off + 1) == naive_find(h, haystack_size, needle.data(), nn, off + 1));
+      assert(sv.rfind(needle) == naive_rfind(h, haystack_size, needle.data(), nn));
+      assert(sv.rfind(needle, off) == off);
+    }
+  }
+
+  // A periodic needle that almost matches a periodic haystack.
+  CharT p[haystack_size]{};
+  CharT n[80]{};
+  for (cuda::std::size_t i = 0; i < haystack_size; ++i)
+  {
+    p[i] = static_cast<CharT>(i % 2 ? 'b' : 'a');
+  }
+  for (cuda::std::size_t i = 0; i < 80; ++i)
+  {
+    n[i] = static_cast<CharT>(i % 2 ? 'b' : 'a');
+  }
+  n[79] = 'c';
+  assert(SV(p, haystack_size).find(SV(n, 80)) == SV::npos);
+  assert(SV(p, haystack_size).rfind(SV(n, 80)) == SV::npos);
+  p[250] = 'c';
+  assert(SV(p, haystack_size).find(SV(n, 80)) == SV::npos);
+  p[250] = 'a';
+  p[251] = 'c';
+  assert(SV(p, haystack_size).find(SV(n, 80)) == 172);
+  assert(SV(p, haystack_size).rfind(SV(n, 80)) == 172);
+}
+
+template <class CharT>
+TEST_FUNC constexpr void test_sets()
+{
+  using SV = cuda::std::basic_string_view<CharT>;
+
+  CharT h[haystack_size]{};
+  for (cuda::std::size_t i = 0; i < haystack_size; ++i)
+  {
+    h[i] = static_cast<CharT>('a');
+  }
+  const SV sv{h, haystack_size};
+  const CharT a[]    = {'a'};
+  const CharT xyz[]  = {'x', 'y', 'z'};
+  const CharT many[] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'x', 'y', 'z', 'A', 'B', 'C', 'D', 'E', 'F'};
+
+  const cuda::std::size_t positions[] = {0, 15, 16, 17, 31, 32, 33, 63, 64, 200, 299};
+  for (cuda::std::size_t at : positions)
+  {
+    h[at] = 'z';
+    assert(sv.find_first_of(xyz, 0, 3) == at);
+    assert(sv.find_first_of(many, 0, 19) == at);
+    assert(sv.find_last_of(xyz, SV::npos, 3) == at);
+    assert(sv.find_last_of(many, SV::npos, 19) == at);
+    assert(sv.find_first_not_of(a, 0, 1) == at);
+    assert(sv.find_first_not_of(CharT('a')) == at);
+    assert(sv.find_last_not_of(a, SV::npos, 1) == at);
+    assert(sv.find_last_not_of(CharT('a')) == at);
+    assert(sv.rfind(CharT('z')) == at);
+    assert(sv.find_first_of(xyz, at + 1, 3) == SV::npos);
+    assert(sv.find_first_not_of(CharT('a'), at + 1) == SV::npos);
+    h[at] = 'a';
+  }
+  assert(sv.find_first_of(many, 0, 19) == SV::npos);
+  assert(sv.find_last_of(many, SV::npos, 19) == SV::npos);
+  assert(sv.find_first_not_of(a, 0, 1) == SV::npos);
+  assert(sv.find_last_not_of(a, SV::npos, 1) == SV::npos);
+  assert(sv.find_first_not_of(a, 0, 0) == 0);
+  assert(sv.find_last_not_of(a, SV::npos, 0) == haystack_size - 1);
+}
+
+template <class CharT>
+TEST_FUNC constexpr void test_type()
+{
+  test_substring<CharT>(2);
+  test_substring<CharT>(4);
+  test_substring<CharT>(26);
+  test_sets<CharT>();
+}
+
+TEST_FUNC constexpr bool test()
+{
+  test_type<char>();
+#if _CCCL_HAS_CHAR8_T()
+  test_type<char8_t>();
+#endif // _CCCL_HAS_CHAR8_T()
+  test_type<char16_t>();
+
+  return true;
+}
+
+// The full test exceeds the constant evaluation limits of some compilers.
+TEST_FUNC constexpr bool test_constexpr()
+{
+  test_substring<char>(26);
+  test_sets<char>();
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test_constexpr());
+  return 0;
+}
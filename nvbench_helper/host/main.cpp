@@ -0,0 +1,1719 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// The driver of the host benchmarks declared with nvbench/nvbench.cuh. It is built for one Thrust device system and
+// measures the benchmarks on the CPU:
+//
+// - Each sample times a single launch, after flushing the caches, like the cold measurements of NVBench. Sampling stops
+//   with the `stdrel` or the `entropy` criterion of NVBench.
+// - The memory bandwidth of each state is reported against the bandwidth ceiling of the machine, which is measured
+//   with the STREAM kernels on the device system before running the benchmarks.
+// - The number of threads of the OMP and TBB systems and their pinning to CPUs are controlled from the command line.
+// - Benchmarks and axes are selected with -b and -a, and the results are written as NVBench JSON with --json and
+//   --jsonbin, so that the scripts in benchmarks/scripts handle host benchmarks like GPU ones.
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/fill.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <nvbench/nvbench.cuh>
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+#  include <omp.h>
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+#  include <tbb/global_control.h>
+#  include <tbb/task_arena.h>
+#  include <tbb/task_scheduler_observer.h>
+#endif
+
+#if defined(__linux__)
+#  include <pthread.h>
+#  include <sched.h>
+#  include <unistd.h>
+#endif
+
+#if defined(__GNUC__)
+#  include <cxxabi.h>
+#endif
+
+namespace
+{
+using clock_type = std::chrono::steady_clock;
+
+struct options
+{
+  // Stopping criterion
+  std::string stopping_criterion = "stdrel";
+  std::size_t min_samples        = 10;
+  double min_time                = 0.5;
+  double max_noise               = 0.005;
+  double timeout                 = 15.0;
+  double max_angle               = 0.048;
+  double min_r2                  = 0.36;
+  bool cache_flush               = true;
+
+  // Execution
+  int threads = 0;
+  bool pin    = false;
+  // In bytes per second, measured if zero
+  double peak_bandwidth = 0.0;
+
+  // Output
+  std::string json_path;
+  std::string jsonbin_path;
+  std::string md_path;
+};
+
+options& get_options()
+{
+  static options instance;
+  return instance;
+}
+
+std::string to_string(double value)
+{
+  char buffer[64];
+  const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+  return std::string(buffer, result.ptr);
+}
+
+double seconds_since(clock_type::time_point begin)
+{
+  return std::chrono::duration<double>(clock_type::now() - begin).count();
+}
+
+// Caches and memory
+
+std::size_t last_level_cache_bytes()
+{
+  long bytes = 0;
+#if defined(_SC_LEVEL3_CACHE_SIZE)
+  bytes = sysconf(_SC_LEVEL3_CACHE_SIZE);
+  if (bytes <= 0)
+  {
+    bytes = sysconf(_SC_LEVEL2_CACHE_SIZE);
+  }
+#endif
+  return bytes > 0 ? static_cast<std::size_t>(bytes) : std::size_t{32} << 20;
+}
+
+std::size_t physical_memory_bytes()
+{
+#if defined(__linux__)
+  return static_cast<std::size_t>(sysconf(_SC_PHYS_PAGES)) * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#else
+  return 0;
+#endif
+}
+
+std::string cpu_name()
+{
+  std::ifstream cpuinfo("/proc/cpuinfo");
+  std::string line;
+  while (std::getline(cpuinfo, line))
+  {
+    if (line.rfind("model name", 0) == 0)
+    {
+      const auto colon = line.find(':');
+      if (colon != std::string::npos && colon + 2 <= line.size())
+      {
+        return line.substr(colon + 2);
+      }
+    }
+  }
+  return "Host CPU";
+}
+
+// Evicts the data of the previous sample from all caches, writing from every thread like the benchmarks do
+class cache_flusher
+{
+public:
+  void flush()
+  {
+    if (m_buffer.empty())
+    {
+      m_buffer.resize(2 * last_level_cache_bytes());
+    }
+    ++m_value;
+    thrust::fill(thrust::device, m_buffer.data(), m_buffer.data() + m_buffer.size(), m_value);
+  }
+
+private:
+  std::vector<unsigned char> m_buffer;
+  unsigned char m_value{};
+};
+
+cache_flusher& get_cache_flusher()
+{
+  static cache_flusher instance;
+  return instance;
+}
+
+// The bandwidth ceiling: the best rate of the four STREAM kernels, counting the bytes as STREAM does, with arrays of
+// at least four times the size of the last level cache
+double measure_stream_bandwidth()
+{
+  const std::size_t elements = std::max(4 * last_level_cache_bytes(), std::size_t{64} << 20) / sizeof(double);
+  thrust::device_vector<double> a_vec(elements, 1.0);
+  thrust::device_vector<double> b_vec(elements, 2.0);
+  thrust::device_vector<double> c_vec(elements, 0.0);
+  double* a = thrust::raw_pointer_cast(a_vec.data());
+  double* b = thrust::raw_pointer_cast(b_vec.data());
+  double* c = thrust::raw_pointer_cast(c_vec.data());
+
+  constexpr double scalar = 3.0;
+  const auto copy         = [](double x) {
+    return x;
+  };
+  const auto scale = [](double x) {
+    return scalar * x;
+  };
+  const auto add = [](double x, double y) {
+    return x + y;
+  };
+  const auto triad = [](double x, double y) {
+    return x + scalar * y;
+  };
+
+  constexpr int repetitions = 10;
+  constexpr double infinity = std::numeric_limits<double>::infinity();
+  double best[4]            = {infinity, infinity, infinity, infinity};
+  const double bytes[4] = {
+    2.0 * sizeof(double) * elements,
+    2.0 * sizeof(double) * elements,
+    3.0 * sizeof(double) * elements,
+    3.0 * sizeof(double) * elements};
+
+  for (int repetition = 0; repetition < repetitions; ++repetition)
+  {
+    auto begin = clock_type::now();
+    thrust::transform(thrust::device, a, a + elements, c, copy);
+    best[0] = std::min(best[0], seconds_since(begin));
+
+    begin = clock_type::now();
+    thrust::transform(thrust::device, c, c + elements, b, scale);
+    best[1] = std::min(best[1], seconds_since(begin));
+
+    begin = clock_type::now();
+    thrust::transform(thrust::device, a, a + elements, b, c, add);
+    best[2] = std::min(best[2], seconds_since(begin));
+
+    begin = clock_type::now();
+    thrust::transform(thrust::device, b, b + elements, c, a, triad);
+    best[3] = std::min(best[3], seconds_since(begin));
+  }
+
+  double result = 0.0;
+  for (int kernel = 0; kernel < 4; ++kernel)
+  {
+    result = std::max(result, bytes[kernel] / best[kernel]);
+  }
+  return result;
+}
+
+// Threads
+
+#if defined(__linux__)
+std::vector<int> allowed_cpus()
+{
+  std::vector<int> result;
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) == 0)
+  {
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+    {
+      if (CPU_ISSET(cpu, &set))
+      {
+        result.push_back(cpu);
+      }
+    }
+  }
+  return result;
+}
+
+// Pins the calling thread to the CPU of its index among the CPUs the process may run on
+void pin_thread(const std::vector<int>& cpus, std::size_t thread_index)
+{
+  if (cpus.empty())
+  {
+    return;
+  }
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpus[thread_index % cpus.size()], &set);
+  pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+#endif // __linux__
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB && defined(__linux__)
+class pinning_observer final : public tbb::task_scheduler_observer
+{
+public:
+  explicit pinning_observer(std::vector<int> cpus)
+      : m_cpus(std::move(cpus))
+  {
+    observe(true);
+  }
+
+  ~pinning_observer() override
+  {
+    observe(false);
+  }
+
+  void on_scheduler_entry(bool) override
+  {
+    const int index = tbb::this_task_arena::current_thread_index();
+    if (index >= 0)
+    {
+      pin_thread(m_cpus, static_cast<std::size_t>(index));
+    }
+  }
+
+private:
+  std::vector<int> m_cpus;
+};
+#endif // THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB && __linux__
+
+// Applies --threads and --pin, returns the number of threads running the benchmarks
+int configure_threads(const options& opts)
+{
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+  if (opts.threads > 0)
+  {
+    omp_set_num_threads(opts.threads);
+  }
+  const int threads = omp_get_max_threads();
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+  static std::optional<tbb::global_control> control;
+  if (opts.threads > 0)
+  {
+    control.emplace(tbb::global_control::max_allowed_parallelism, static_cast<std::size_t>(opts.threads));
+  }
+  const int threads =
+    static_cast<int>(tbb::global_control::active_value(tbb::global_control::max_allowed_parallelism));
+#else
+  if (opts.threads > 1)
+  {
+    std::cerr << "Warning: the CPP system is sequential, ignoring --threads\n";
+  }
+  const int threads = 1;
+#endif
+
+  if (opts.pin)
+  {
+#if defined(__linux__)
+    const auto cpus = allowed_cpus();
+#  if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+    // The threads of the pool are reused by the parallel regions of the benchmarks
+#    pragma omp parallel
+    pin_thread(cpus, static_cast<std::size_t>(omp_get_thread_num()));
+#  elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+    static pinning_observer observer(cpus);
+    pin_thread(cpus, 0);
+#  else
+    pin_thread(cpus, 0);
+#  endif
+#else
+    std::cerr << "Warning: pinning threads is only supported on Linux, ignoring --pin\n";
+#endif
+  }
+
+  return threads;
+}
+
+// Stopping criteria
+
+double mean(const std::vector<double>& samples)
+{
+  double sum = 0.0;
+  for (double sample : samples)
+  {
+    sum += sample;
+  }
+  return samples.empty() ? 0.0 : sum / static_cast<double>(samples.size());
+}
+
+double relative_stdev(const std::vector<double>& samples)
+{
+  if (samples.size() < 2)
+  {
+    return std::numeric_limits<double>::infinity();
+  }
+  const double average = mean(samples);
+  double sum           = 0.0;
+  for (double sample : samples)
+  {
+    sum += (sample - average) * (sample - average);
+  }
+  return std::sqrt(sum / static_cast<double>(samples.size() - 1)) / average;
+}
+
+class stopping_criterion
+{
+public:
+  explicit stopping_criterion(const options& opts)
+      : m_options(opts)
+      , m_is_entropy(opts.stopping_criterion == "entropy")
+  {}
+
+  // Whether enough samples were taken after adding the last one of `samples`
+  bool is_finished(const std::vector<double>& samples)
+  {
+    if (m_is_entropy)
+    {
+      add_entropy(samples.back(), samples.size());
+      return samples.size() >= m_options.min_samples && entropy_converged();
+    }
+
+    return samples.size() >= m_options.min_samples && m_options.min_time <= mean(samples) * samples.size()
+        && relative_stdev(samples) <= m_options.max_noise;
+  }
+
+private:
+  // The entropy of the distribution of the samples, binned with a relative resolution of 0.1%, stops changing once
+  // the distribution is known
+  void add_entropy(double sample, std::size_t num_samples)
+  {
+    constexpr double resolution = 0.001;
+    const auto bin = sample > 0.0 ? std::llround(std::log(sample) / std::log1p(resolution)) : 0LL;
+
+    // sum(count * log2(count)) over the bins, updated with the new count of the bin
+    auto& count = m_bins[bin];
+    m_weighted_log_counts -= count > 0 ? count * std::log2(static_cast<double>(count)) : 0.0;
+    ++count;
+    m_weighted_log_counts += count * std::log2(static_cast<double>(count));
+
+    const auto n = static_cast<double>(num_samples);
+    m_entropies.push_back(std::log2(n) - m_weighted_log_counts / n);
+  }
+
+  // Whether a linear fit of the recent entropies is flat
+  bool entropy_converged() const
+  {
+    constexpr std::size_t window = 300;
+    const std::size_t size       = std::min(window, m_entropies.size());
+    const std::size_t first      = m_entropies.size() - size;
+    if (size < 2)
+    {
+      return false;
+    }
+
+    double mean_x = 0.0;
+    double mean_y = 0.0;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      mean_x += static_cast<double>(i);
+      mean_y += m_entropies[first + i];
+    }
+    mean_x /= static_cast<double>(size);
+    mean_y /= static_cast<double>(size);
+
+    double sxx = 0.0;
+    double sxy = 0.0;
+    double syy = 0.0;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      const double dx = static_cast<double>(i) - mean_x;
+      const double dy = m_entropies[first + i] - mean_y;
+      sxx += dx * dx;
+      sxy += dx * dy;
+      syy += dy * dy;
+    }
+
+    const double slope = sxy / sxx;
+    const double r2    = syy > 0.0 ? (sxy * sxy) / (sxx * syy) : 1.0;
+    return std::abs(std::atan(slope)) <= m_options.max_angle && r2 >= m_options.min_r2;
+  }
+
+  const options& m_options;
+  bool m_is_entropy{};
+  std::unordered_map<long long, std::size_t> m_bins;
+  double m_weighted_log_counts{};
+  std::vector<double> m_entropies;
+};
+} // namespace
+
+namespace nvbench
+{
+std::string demangle(const std::type_info& type)
+{
+#if defined(__GNUC__)
+  int status = 0;
+  std::unique_ptr<char, void (*)(void*)> name(abi::__cxa_demangle(type.name(), nullptr, nullptr, &status), std::free);
+  if (status == 0 && name)
+  {
+    return name.get();
+  }
+#endif
+  return type.name();
+}
+
+void timer::start()
+{
+  m_start = clock_type::now().time_since_epoch().count();
+}
+
+void timer::stop()
+{
+  const auto start = clock_type::time_point(clock_type::duration(m_start));
+  m_duration       = seconds_since(start);
+}
+
+state::state(const benchmark_base& bench, std::vector<named_value> values)
+    : m_benchmark(bench)
+    , m_values(std::move(values))
+{}
+
+const named_value* state::try_find(const std::string& name, axis_type type) const
+{
+  for (const auto& value : m_values)
+  {
+    if (value.name == name)
+    {
+      if (value.type != type)
+      {
+        throw std::runtime_error("Axis '" + name + "' of benchmark '" + m_benchmark.get_name() + "' has another type");
+      }
+      return &value;
+    }
+  }
+  return nullptr;
+}
+
+const named_value& state::find(const std::string& name, axis_type type) const
+{
+  if (const auto* value = try_find(name, type))
+  {
+    return *value;
+  }
+  throw std::runtime_error("Benchmark '" + m_benchmark.get_name() + "' has no axis '" + name + "'");
+}
+
+int64_t state::get_int64(const std::string& name) const
+{
+  return find(name, axis_type::int64).value->int64_value;
+}
+
+int64_t state::get_int64_or_default(const std::string& name, int64_t default_value) const
+{
+  const auto* value = try_find(name, axis_type::int64);
+  return value ? value->value->int64_value : default_value;
+}
+
+float64_t state::get_float64(const std::string& name) const
+{
+  return find(name, axis_type::float64).value->float64_value;
+}
+
+float64_t state::get_float64_or_default(const std::string& name, float64_t default_value) const
+{
+  const auto* value = try_find(name, axis_type::float64);
+  return value ? value->value->float64_value : default_value;
+}
+
+const std::string& state::get_string(const std::string& name) const
+{
+  return find(name, axis_type::string).value->input_string;
+}
+
+std::string state::get_string_or_default(const std::string& name, std::string default_value) const
+{
+  const auto* value = try_find(name, axis_type::string);
+  return value ? value->value->input_string : default_value;
+}
+
+void state::measure(const std::function<void(launch&, timer&)>& sample)
+{
+  if (m_is_skipped)
+  {
+    return;
+  }
+
+  const auto& opts = get_options();
+  auto& flusher    = get_cache_flusher();
+  const auto begin = clock_type::now();
+  stopping_criterion criterion(opts);
+  launch l;
+
+  // Warm-up, which is not recorded
+  {
+    timer t;
+    sample(l, t);
+  }
+
+  for (;;)
+  {
+    if (opts.cache_flush)
+    {
+      flusher.flush();
+    }
+
+    timer t;
+    sample(l, t);
+    m_samples.push_back(t.get_duration());
+    m_walltime = seconds_since(begin);
+
+    if (criterion.is_finished(m_samples))
+    {
+      break;
+    }
+    if (m_walltime > opts.timeout)
+    {
+      std::cout << "Warn: Timeout reached after " << m_samples.size() << " samples\n";
+      break;
+    }
+  }
+}
+
+benchmark_base& benchmark_base::set_type_axes_names(std::vector<std::string> names)
+{
+  std::size_t index = 0;
+  for (auto& ax : m_axes)
+  {
+    if (ax.type == axis_type::type && index < names.size())
+    {
+      ax.name = std::move(names[index++]);
+    }
+  }
+  return *this;
+}
+
+namespace
+{
+axis_value make_int64_value(int64_t value)
+{
+  return {std::to_string(value), {}, 0, value, 0.0};
+}
+
+axis_value make_power_of_two_value(int64_t exponent)
+{
+  const int64_t value = int64_t{1} << exponent;
+  return {std::to_string(exponent), "2^" + std::to_string(exponent) + " = " + std::to_string(value), 0, value, 0.0};
+}
+
+axis_value make_float64_value(float64_t value)
+{
+  return {to_string(value), {}, 0, 0, value};
+}
+} // namespace
+
+benchmark_base& benchmark_base::add_int64_axis(std::string name, std::vector<int64_t> values)
+{
+  axis result{std::move(name), axis_type::int64, false, {}};
+  for (auto value : values)
+  {
+    result.values.push_back(make_int64_value(value));
+  }
+  m_axes.push_back(std::move(result));
+  return *this;
+}
+
+benchmark_base& benchmark_base::add_int64_power_of_two_axis(std::string name, std::vector<int64_t> exponents)
+{
+  axis result{std::move(name), axis_type::int64, true, {}};
+  for (auto exponent : exponents)
+  {
+    result.values.push_back(make_power_of_two_value(exponent));
+  }
+  m_axes.push_back(std::move(result));
+  return *this;
+}
+
+benchmark_base& benchmark_base::add_float64_axis(std::string name, std::vector<float64_t> values)
+{
+  axis result{std::move(name), axis_type::float64, false, {}};
+  for (auto value : values)
+  {
+    result.values.push_back(make_float64_value(value));
+  }
+  m_axes.push_back(std::move(result));
+  return *this;
+}
+
+benchmark_base& benchmark_base::add_string_axis(std::string name, std::vector<std::string> values)
+{
+  axis result{std::move(name), axis_type::string, false, {}};
+  for (auto& value : values)
+  {
+    result.values.push_back({std::move(value), {}, 0, 0, 0.0});
+  }
+  m_axes.push_back(std::move(result));
+  return *this;
+}
+} // namespace nvbench
+
+namespace
+{
+// Axis selection with -a, following NVBench: `Name=value`, `Name=[value,...]`, or `Name=[start:end:stride]`. The
+// values of int64 axes given with `Name[pow2]=...` are exponents of two.
+
+std::vector<std::string> split(const std::string& str, char delimiter)
+{
+  std::vector<std::string> result;
+  std::string item;
+  std::istringstream stream(str);
+  while (std::getline(stream, item, delimiter))
+  {
+    result.push_back(item);
+  }
+  return result;
+}
+
+template <typename T>
+T parse_number(const std::string& str)
+{
+  T value{};
+  std::istringstream stream(str);
+  if (!(stream >> value) || !stream.eof())
+  {
+    throw std::runtime_error("Cannot parse '" + str + "' as a number");
+  }
+  return value;
+}
+
+template <typename T>
+std::vector<T> parse_numbers(const std::vector<std::string>& items, bool is_range)
+{
+  std::vector<T> result;
+  if (is_range)
+  {
+    if (items.size() < 2 || items.size() > 3)
+    {
+      throw std::runtime_error("Ranges are given as [start:end] or [start:end:stride]");
+    }
+    const T stride = items.size() == 3 ? parse_number<T>(items[2]) : T{1};
+    for (auto value : nvbench::range(parse_number<T>(items[0]), parse_number<T>(items[1]), stride))
+    {
+      result.push_back(static_cast<T>(value));
+    }
+    return result;
+  }
+  for (const auto& item : items)
+  {
+    result.push_back(parse_number<T>(item));
+  }
+  return result;
+}
+
+void apply_axis_argument(std::vector<nvbench::axis>& axes, const std::string& argument)
+{
+  const auto equal = argument.find('=');
+  if (equal == std::string::npos)
+  {
+    throw std::runtime_error("Axis values are given as Name=value, got '" + argument + "'");
+  }
+  std::string name   = argument.substr(0, equal);
+  std::string values = argument.substr(equal + 1);
+
+  std::string flags;
+  if (const auto bracket = name.find('['); bracket != std::string::npos && name.back() == ']')
+  {
+    flags = name.substr(bracket + 1, name.size() - bracket - 2);
+    name  = name.substr(0, bracket);
+  }
+  if (!flags.empty() && flags != "pow2")
+  {
+    throw std::runtime_error("Unknown axis flags '" + flags + "'");
+  }
+
+  if (values.size() >= 2 && values.front() == '[' && values.back() == ']')
+  {
+    values = values.substr(1, values.size() - 2);
+  }
+  const bool is_range = values.find(':') != std::string::npos;
+  const auto items    = split(values, is_range ? ':' : ',');
+
+  const auto ax = std::find_if(axes.begin(), axes.end(), [&](const nvbench::axis& a) {
+    return a.name == name;
+  });
+  if (ax == axes.end())
+  {
+    throw std::runtime_error("Axis '" + name + "' does not exist");
+  }
+  if (!flags.empty() && ax->type != nvbench::axis_type::int64)
+  {
+    throw std::runtime_error("Only int64 axes are powers of two, got '" + argument + "'");
+  }
+
+  std::vector<nvbench::axis_value> selected;
+  switch (ax->type)
+  {
+    case nvbench::axis_type::type:
+      for (const auto& item : items)
+      {
+        const auto value = std::find_if(ax->values.begin(), ax->values.end(), [&](const nvbench::axis_value& v) {
+          return v.input_string == item;
+        });
+        if (value == ax->values.end())
+        {
+          throw std::runtime_error("Type axis '" + name + "' has no value '" + item + "'");
+        }
+        selected.push_back(*value);
+      }
+      break;
+    case nvbench::axis_type::int64:
+      ax->is_power_of_two = flags == "pow2";
+      for (auto value : parse_numbers<nvbench::int64_t>(items, is_range))
+      {
+        selected.push_back(ax->is_power_of_two ? nvbench::make_power_of_two_value(value)
+                                               : nvbench::make_int64_value(value));
+      }
+      break;
+    case nvbench::axis_type::float64:
+      for (auto value : parse_numbers<nvbench::float64_t>(items, is_range))
+      {
+        selected.push_back(nvbench::make_float64_value(value));
+      }
+      break;
+    case nvbench::axis_type::string:
+      for (const auto& item : items)
+      {
+        selected.push_back({item, {}, 0, 0, 0.0});
+      }
+      break;
+  }
+  ax->values = std::move(selected);
+}
+
+// Results
+
+struct run_result
+{
+  const nvbench::benchmark_base* bench{};
+  std::size_t index{};
+  std::vector<nvbench::axis> axes;
+  std::vector<nvbench::state> states;
+};
+
+std::string axis_label(const nvbench::axis& ax)
+{
+  return ax.is_power_of_two ? ax.name + "[pow2]" : ax.name;
+}
+
+std::string state_name(const nvbench::state& s)
+{
+  std::string result = "Device=0";
+  for (const auto& value : s.get_axis_values())
+  {
+    result += " " + value.name + (value.value->description.rfind("2^", 0) == 0 ? "[pow2]" : "") + "="
+            + value.value->input_string;
+  }
+  return result;
+}
+
+std::string format_duration(double seconds)
+{
+  std::ostringstream out;
+  out << std::fixed << std::setprecision(3);
+  if (seconds >= 1.0)
+  {
+    out << seconds << " s";
+  }
+  else if (seconds >= 1e-3)
+  {
+    out << seconds * 1e3 << " ms";
+  }
+  else if (seconds >= 1e-6)
+  {
+    out << seconds * 1e6 << " us";
+  }
+  else
+  {
+    out << seconds * 1e9 << " ns";
+  }
+  return out.str();
+}
+
+std::string format_rate(double rate, const char* unit)
+{
+  constexpr const char* prefixes[] = {"", "K", "M", "G", "T"};
+  int prefix                       = 0;
+  while (rate >= 1000.0 && prefix < 4)
+  {
+    rate /= 1000.0;
+    ++prefix;
+  }
+  std::ostringstream out;
+  out << std::fixed << std::setprecision(3) << rate << (unit[0] != '\0' ? " " : "") << prefixes[prefix] << unit;
+  return out.str();
+}
+
+std::string format_percentage(double fraction)
+{
+  std::ostringstream out;
+  out << std::fixed << std::setprecision(2) << fraction * 100.0 << "%";
+  return out.str();
+}
+
+void print_table(std::ostream& out, const std::vector<std::vector<std::string>>& rows)
+{
+  std::vector<std::size_t> widths(rows.front().size(), 0);
+  for (const auto& row : rows)
+  {
+    for (std::size_t column = 0; column < row.size(); ++column)
+    {
+      widths[column] = std::max(widths[column], row[column].size());
+    }
+  }
+
+  const auto print_row = [&](const std::vector<std::string>& row) {
+    out << "|";
+    for (std::size_t column = 0; column < row.size(); ++column)
+    {
+      out << " " << std::setw(static_cast<int>(widths[column])) << row[column] << " |";
+    }
+    out << "\n";
+  };
+
+  print_row(rows.front());
+  out << "|";
+  for (auto width : widths)
+  {
+    out << std::string(width + 2, '-') << "|";
+  }
+  out << "\n";
+  for (std::size_t row = 1; row < rows.size(); ++row)
+  {
+    print_row(rows[row]);
+  }
+}
+
+void print_results(std::ostream& out, const std::vector<run_result>& results, double peak_bandwidth)
+{
+  out << "\n# Benchmark Results\n";
+  for (const auto& result : results)
+  {
+    out << "\n## " << result.bench->get_name() << "\n\n";
+
+    std::vector<std::vector<std::string>> rows(1);
+    for (const auto& ax : result.axes)
+    {
+      rows[0].push_back(ax.name);
+    }
+    for (const char* column : {"Samples", "CPU Time", "Noise", "Elem/s", "GlobalMem BW", "BWUtil"})
+    {
+      rows[0].push_back(column);
+    }
+
+    for (const auto& s : result.states)
+    {
+      std::vector<std::string> row;
+      for (const auto& value : s.get_axis_values())
+      {
+        row.push_back(value.value->description.rfind("2^", 0) == 0 ? value.value->description
+                                                                     : value.value->input_string);
+      }
+      if (s.is_skipped())
+      {
+        row.insert(row.end(), {"skipped", "", "", "", "", ""});
+      }
+      else
+      {
+        const double time = mean(s.get_samples());
+        const double bw   = static_cast<double>(s.get_global_memory_rw_bytes()) / time;
+        row.push_back(std::to_string(s.get_samples().size()) + "x");
+        row.push_back(format_duration(time));
+        row.push_back(format_percentage(relative_stdev(s.get_samples())));
+        row.push_back(s.get_element_count() ? format_rate(static_cast<double>(s.get_element_count()) / time, "") : "");
+        row.push_back(s.get_global_memory_rw_bytes() ? format_rate(bw, "B/s") : "");
+        row.push_back(s.get_global_memory_rw_bytes() ? format_percentage(bw / peak_bandwidth) : "");
+      }
+      rows.push_back(std::move(row));
+    }
+    print_table(out, rows);
+  }
+}
+
+// A minimal JSON writer
+class json_writer
+{
+public:
+  explicit json_writer(std::ostream& out)
+      : m_out(out)
+  {}
+
+  void begin_object()
+  {
+    begin('{');
+  }
+
+  void end_object()
+  {
+    end('}');
+  }
+
+  void begin_array()
+  {
+    begin('[');
+  }
+
+  void end_array()
+  {
+    end(']');
+  }
+
+  void key(const std::string& name)
+  {
+    separate();
+    write_string(name);
+    m_out << ": ";
+    m_after_key = true;
+  }
+
+  void value(const std::string& str)
+  {
+    separate();
+    write_string(str);
+  }
+
+  void value(const char* str)
+  {
+    value(std::string(str));
+  }
+
+  void value(double number)
+  {
+    separate();
+    if (std::isfinite(number))
+    {
+      m_out << to_string(number);
+    }
+    else
+    {
+      m_out << "null";
+    }
+  }
+
+  void value(bool boolean)
+  {
+    separate();
+    m_out << (boolean ? "true" : "false");
+  }
+
+  // NVBench writes 64-bit integers as strings
+  void value_int64(long long number)
+  {
+    value(std::to_string(number));
+  }
+
+  template <typename T>
+  void member(const std::string& name, const T& v)
+  {
+    key(name);
+    value(v);
+  }
+
+  // An NVBench named value: {"name": ..., "type": ..., "value": ...}
+  template <typename T>
+  void named_value(const std::string& name, const char* type, const T& v)
+  {
+    begin_object();
+    member("name", name);
+    member("type", type);
+    member("value", v);
+    end_object();
+  }
+
+private:
+  void begin(char bracket)
+  {
+    separate();
+    m_out << bracket;
+    m_first.push_back(true);
+  }
+
+  void end(char bracket)
+  {
+    const bool empty = m_first.back();
+    m_first.pop_back();
+    if (!empty)
+    {
+      newline();
+    }
+    m_out << bracket;
+  }
+
+  void separate()
+  {
+    if (m_after_key)
+    {
+      m_after_key = false;
+      return;
+    }
+    if (!m_first.empty())
+    {
+      if (!m_first.back())
+      {
+        m_out << ",";
+      }
+      m_first.back() = false;
+      newline();
+    }
+  }
+
+  void newline()
+  {
+    m_out << "\n" << std::string(2 * m_first.size(), ' ');
+  }
+
+  void write_string(const std::string& str)
+  {
+    m_out << '"';
+    for (char c : str)
+    {
+      switch (c)
+      {
+        case '"':
+          m_out << "\\\"";
+          break;
+        case '\\':
+          m_out << "\\\\";
+          break;
+        case '\n':
+          m_out << "\\n";
+          break;
+        case '\t':
+          m_out << "\\t";
+          break;
+        default:
+          if (static_cast<unsigned char>(c) < 0x20)
+          {
+            char buffer[8];
+            std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned>(c));
+            m_out << buffer;
+          }
+          else
+          {
+            m_out << c;
+          }
+      }
+    }
+    m_out << '"';
+  }
+
+  std::ostream& m_out;
+  std::vector<bool> m_first;
+  bool m_after_key{};
+};
+
+const char* axis_type_name(nvbench::axis_type type)
+{
+  switch (type)
+  {
+    case nvbench::axis_type::type:
+      return "type";
+    case nvbench::axis_type::int64:
+      return "int64";
+    case nvbench::axis_type::float64:
+      return "float64";
+    case nvbench::axis_type::string:
+      return "string";
+  }
+  return "";
+}
+
+void write_device(json_writer& json, int threads, double peak_bandwidth)
+{
+  // The fields read by benchmarks/scripts, with the threads in place of the SMs of a GPU
+  json.begin_object();
+  json.member("id", 0.0);
+  json.member("name", cpu_name());
+  json.member("number_of_sms", static_cast<double>(threads));
+  json.member("global_memory_size", static_cast<double>(physical_memory_bytes()));
+  json.member("global_memory_bus_width", 0.0);
+  json.member("ecc_state", false);
+  if (peak_bandwidth > 0.0)
+  {
+    json.member("peak_global_memory_bandwidth", peak_bandwidth);
+  }
+  json.end_object();
+}
+
+void write_axes(json_writer& json, const std::vector<nvbench::axis>& axes)
+{
+  json.key("axes");
+  json.begin_array();
+  for (const auto& ax : axes)
+  {
+    json.begin_object();
+    json.member("name", ax.name);
+    json.member("type", axis_type_name(ax.type));
+    json.member("flags", ax.flags());
+    json.key("values");
+    json.begin_array();
+    for (const auto& value : ax.values)
+    {
+      json.begin_object();
+      json.member("input_string", value.input_string);
+      json.member("description", value.description);
+      if (ax.type != nvbench::axis_type::type)
+      {
+        // The same string as in the axis values of the states, by which the scripts match them
+        json.member("value", value.input_string);
+      }
+      json.end_object();
+    }
+    json.end_array();
+    json.end_object();
+  }
+  json.end_array();
+}
+
+void write_summary(
+  json_writer& json, const char* tag, const char* name, const char* hint, const char* type, const std::string& value)
+{
+  json.begin_object();
+  json.member("tag", tag);
+  json.key("data");
+  json.begin_array();
+  json.named_value("name", "string", name);
+  json.named_value("hint", "string", hint);
+  json.named_value("value", type, value);
+  json.end_array();
+  json.end_object();
+}
+
+void write_summary(json_writer& json, const char* tag, const char* name, const char* hint, double value)
+{
+  json.begin_object();
+  json.member("tag", tag);
+  json.key("data");
+  json.begin_array();
+  json.named_value("name", "string", name);
+  json.named_value("hint", "string", hint);
+  json.named_value("value", "float64", value);
+  json.end_array();
+  json.end_object();
+}
+
+// Writes the samples of a state as little-endian float32 like NVBench, returns the path of the file
+std::string write_samples(const std::string& jsonbin_path, std::size_t file_index, const std::vector<double>& samples)
+{
+  const std::filesystem::path directory(jsonbin_path + "-bin");
+  std::filesystem::create_directories(directory);
+  const auto path = (directory / (std::to_string(file_index) + ".bin")).string();
+
+  std::ofstream out(path, std::ios::binary);
+  for (double sample : samples)
+  {
+    const auto value = static_cast<float>(sample);
+    out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+  }
+  if (!out)
+  {
+    throw std::runtime_error("Cannot write the samples to '" + path + "'");
+  }
+  return path;
+}
+
+void write_json(const std::string& path,
+                bool with_samples,
+                const std::vector<std::string>& argv,
+                const std::vector<run_result>& results,
+                int threads,
+                double peak_bandwidth)
+{
+  std::ofstream out(path);
+  json_writer json(out);
+  std::size_t file_index = 0;
+
+  json.begin_object();
+  json.key("meta");
+  json.begin_object();
+  json.key("argv");
+  json.begin_array();
+  for (const auto& arg : argv)
+  {
+    json.value(arg);
+  }
+  json.end_array();
+  json.end_object();
+
+  json.key("devices");
+  json.begin_array();
+  write_device(json, threads, peak_bandwidth);
+  json.end_array();
+
+  json.key("benchmarks");
+  json.begin_array();
+  for (const auto& result : results)
+  {
+    json.begin_object();
+    json.member("name", result.bench->get_name());
+    json.member("index", static_cast<double>(result.index));
+    write_axes(json, result.axes);
+
+    json.key("states");
+    json.begin_array();
+    for (const auto& s : result.states)
+    {
+      json.begin_object();
+      json.member("name", state_name(s));
+      json.member("device", 0.0);
+
+      json.key("axis_values");
+      json.begin_array();
+      for (const auto& value : s.get_axis_values())
+      {
+        json.named_value(value.name, axis_type_name(value.type), value.value->input_string);
+      }
+      json.end_array();
+
+      json.key("summaries");
+      json.begin_array();
+      if (!s.is_skipped())
+      {
+        const auto& samples = s.get_samples();
+        const double time   = mean(samples);
+        write_summary(json, "nv/cold/sample_size", "Samples", "sample_size", "int64", std::to_string(samples.size()));
+        write_summary(json, "nv/cold/time/cpu/mean", "CPU Time", "duration", time);
+        write_summary(json, "nv/cold/time/cpu/stdev/relative", "Noise", "percentage", relative_stdev(samples));
+        write_summary(
+          json, "nv/cold/time/cpu/min", "Min CPU Time", "duration", *std::min_element(samples.begin(), samples.end()));
+        write_summary(
+          json, "nv/cold/time/cpu/max", "Max CPU Time", "duration", *std::max_element(samples.begin(), samples.end()));
+        write_summary(json, "nv/cold/walltime", "Walltime", "duration", s.get_walltime());
+        if (s.get_element_count())
+        {
+          write_summary(
+            json, "nv/cold/bw/item_rate", "Elem/s", "item_rate", static_cast<double>(s.get_element_count()) / time);
+        }
+        if (s.get_global_memory_rw_bytes())
+        {
+          const double bw = static_cast<double>(s.get_global_memory_rw_bytes()) / time;
+          write_summary(json, "nv/cold/bw/global/bytes_per_second", "GlobalMem BW", "byte_rate", bw);
+          write_summary(json, "nv/cold/bw/global/utilization", "BWUtil", "percentage", bw / peak_bandwidth);
+        }
+        if (with_samples)
+        {
+          const auto file = write_samples(path, file_index++, samples);
+          json.begin_object();
+          json.member("tag", "nv/json/bin:nv/cold/sample_times");
+          json.key("data");
+          json.begin_array();
+          json.named_value("name", "string", "Samples Times File");
+          json.named_value("hint", "string", "file/sample_times");
+          json.named_value("filename", "string", file);
+          json.named_value("size", "int64", std::to_string(samples.size()));
+          json.end_array();
+          json.end_object();
+        }
+      }
+      json.end_array();
+
+      json.member("is_skipped", s.is_skipped());
+      if (s.is_skipped())
+      {
+        json.member("skip_reason", s.get_skip_reason());
+      }
+      json.end_object();
+    }
+    json.end_array();
+    json.end_object();
+  }
+  json.end_array();
+  json.end_object();
+  out << "\n";
+
+  if (!out)
+  {
+    throw std::runtime_error("Cannot write '" + path + "'");
+  }
+}
+
+void print_usage(const char* program)
+{
+  std::cout
+    << "Usage: " << program << " [options]\n"
+    << "\n"
+    << "Runs the host benchmarks of this executable. The options follow NVBench:\n"
+    << "\n"
+    << "  -h, --help                   Print this message\n"
+    << "  -l, --list                   List the benchmarks and their axes\n"
+    << "  --jsonlist-benches           Print the benchmarks and their axes as JSON\n"
+    << "  --jsonlist-devices           Print the device (the host CPU) as JSON\n"
+    << "  -b, --benchmark <name|index> Run the benchmark; may be repeated, all are run by default\n"
+    << "  -a, --axis <axis=values>     Restrict the values of an axis, of the last benchmark given with -b\n"
+    << "                               or of all of them before any -b, e.g. 'T{ct}=[I32,I64]',\n"
+    << "                               'Elements[pow2]=[16:28:4]'\n"
+    << "  -d, --devices <0>            Only device 0, the host, exists\n"
+    << "  --stopping-criterion <name>  'stdrel' (default) or 'entropy'\n"
+    << "  --min-samples <n>            Minimum number of samples (10)\n"
+    << "  --min-time <seconds>         stdrel: minimum measured time (0.5)\n"
+    << "  --max-noise <percent>        stdrel: maximum relative standard deviation (0.5)\n"
+    << "  --max-angle <radians>        entropy: maximum slope of the entropy (0.048)\n"
+    << "  --min-r2 <value>             entropy: minimum fit of the entropy (0.36)\n"
+    << "  --timeout <seconds>          Maximum wall time per state (15)\n"
+    << "  --no-cache-flush             Do not flush the caches before each sample\n"
+    << "  --threads <n>                Number of threads of the OMP and TBB systems\n"
+    << "  --pin                        Pin the threads to the CPUs the process may run on (Linux)\n"
+    << "  --peak-bandwidth <GB/s>      Bandwidth ceiling, measured with STREAM by default\n"
+    << "  --json <path>                Write the results as NVBench JSON\n"
+    << "  --jsonbin <path>             Same as --json, and write the samples to <path>-bin/\n"
+    << "  --md <path>                  Write the results as Markdown\n";
+}
+
+struct selection
+{
+  const nvbench::benchmark_base* bench{};
+  std::size_t index{};
+  std::vector<std::string> axis_arguments;
+};
+
+const nvbench::benchmark_base* find_benchmark(const std::string& name_or_index, std::size_t& index)
+{
+  const auto& benches = nvbench::benchmark_manager::get().get_benchmarks();
+  for (std::size_t i = 0; i < benches.size(); ++i)
+  {
+    if (benches[i]->get_name() == name_or_index || std::to_string(i) == name_or_index)
+    {
+      index = i;
+      return benches[i].get();
+    }
+  }
+  throw std::runtime_error("Benchmark '" + name_or_index + "' does not exist");
+}
+
+std::vector<nvbench::state> run_benchmark(const selection& sel, std::vector<nvbench::axis>& axes)
+{
+  // Type axes vary slowest, the other axes in the order of their declaration, the first one fastest
+  std::vector<std::size_t> order;
+  for (std::size_t i = 0; i < axes.size(); ++i)
+  {
+    if (axes[i].type != nvbench::axis_type::type)
+    {
+      order.push_back(i);
+    }
+  }
+  for (std::size_t i = axes.size(); i-- > 0;)
+  {
+    if (axes[i].type == nvbench::axis_type::type)
+    {
+      order.push_back(i);
+    }
+  }
+
+  std::size_t num_states = 1;
+  for (const auto& ax : axes)
+  {
+    num_states *= ax.values.size();
+  }
+
+  std::vector<nvbench::state> states;
+  std::vector<std::size_t> indices(axes.size(), 0);
+  for (std::size_t state_index = 0; state_index < num_states; ++state_index)
+  {
+    std::vector<nvbench::named_value> values;
+    std::vector<std::size_t> type_indices;
+    for (std::size_t i = 0; i < axes.size(); ++i)
+    {
+      const auto& value = axes[i].values[indices[i]];
+      values.push_back({axes[i].name, axes[i].type, &value});
+      if (axes[i].type == nvbench::axis_type::type)
+      {
+        type_indices.push_back(value.type_index);
+      }
+    }
+
+    auto& s = states.emplace_back(*sel.bench, std::move(values));
+    std::cout << "Run:  [" << state_index + 1 << "/" << num_states << "] " << sel.bench->get_name() << " ["
+              << state_name(s) << "]" << std::endl;
+    try
+    {
+      sel.bench->run(s, type_indices.data());
+      if (!s.is_skipped() && s.get_samples().empty())
+      {
+        s.skip("The benchmark did not call state.exec()");
+      }
+    }
+    catch (const std::exception& e)
+    {
+      s.skip(e.what());
+    }
+
+    if (s.is_skipped())
+    {
+      std::cout << "Skip: " << s.get_skip_reason() << std::endl;
+    }
+    else
+    {
+      std::cout << "Pass: Cold: " << format_duration(mean(s.get_samples())) << " CPU, " << std::fixed
+                << std::setprecision(2) << s.get_walltime() << "s total wall, " << s.get_samples().size() << "x"
+                << std::defaultfloat << std::endl;
+    }
+
+    for (auto digit : order)
+    {
+      if (++indices[digit] < axes[digit].values.size())
+      {
+        break;
+      }
+      indices[digit] = 0;
+    }
+  }
+  return states;
+}
+
+int run(int argc, char** argv)
+{
+  auto& opts = get_options();
+  const std::vector<std::string> args(argv, argv + argc);
+
+  std::vector<std::string> global_axis_arguments;
+  std::vector<selection> selections;
+  bool list = false, jsonlist_benches = false, jsonlist_devices = false;
+
+  for (std::size_t i = 1; i < args.size(); ++i)
+  {
+    const auto& arg  = args[i];
+    const auto param = [&]() -> const std::string& {
+      if (i + 1 >= args.size())
+      {
+        throw std::runtime_error("Option '" + arg + "' requires a value");
+      }
+      return args[++i];
+    };
+
+    if (arg == "-h" || arg == "--help")
+    {
+      print_usage(argv[0]);
+      return 0;
+    }
+    else if (arg == "-l" || arg == "--list")
+    {
+      list = true;
+    }
+    else if (arg == "--jsonlist-benches")
+    {
+      jsonlist_benches = true;
+    }
+    else if (arg == "--jsonlist-devices")
+    {
+      jsonlist_devices = true;
+    }
+    else if (arg == "-b" || arg == "--benchmark")
+    {
+      selection sel;
+      sel.bench = find_benchmark(param(), sel.index);
+      selections.push_back(std::move(sel));
+    }
+    else if (arg == "-a" || arg == "--axis")
+    {
+      (selections.empty() ? global_axis_arguments : selections.back().axis_arguments).push_back(param());
+    }
+    else if (arg == "-d" || arg == "--device" || arg == "--devices")
+    {
+      const auto& device = param();
+      if (device != "0" && device != "all")
+      {
+        throw std::runtime_error("Device '" + device + "' does not exist, the host is device 0");
+      }
+    }
+    else if (arg == "--stopping-criterion")
+    {
+      opts.stopping_criterion = param();
+      if (opts.stopping_criterion != "stdrel" && opts.stopping_criterion != "entropy")
+      {
+        throw std::runtime_error("Unknown stopping criterion '" + opts.stopping_criterion + "'");
+      }
+    }
+    else if (arg == "--min-samples")
+    {
+      opts.min_samples = parse_number<std::size_t>(param());
+    }
+    else if (arg == "--min-time")
+    {
+      opts.min_time = parse_number<double>(param());
+    }
+    else if (arg == "--max-noise")
+    {
+      opts.max_noise = parse_number<double>(param()) / 100.0;
+    }
+    else if (arg == "--max-angle")
+    {
+      opts.max_angle = parse_number<double>(param());
+    }
+    else if (arg == "--min-r2")
+    {
+      opts.min_r2 = parse_number<double>(param());
+    }
+    else if (arg == "--timeout")
+    {
+      opts.timeout = parse_number<double>(param());
+    }
+    else if (arg == "--no-cache-flush")
+    {
+      opts.cache_flush = false;
+    }
+    else if (arg == "--threads")
+    {
+      opts.threads = parse_number<int>(param());
+    }
+    else if (arg == "--pin")
+    {
+      opts.pin = true;
+    }
+    else if (arg == "--peak-bandwidth")
+    {
+      opts.peak_bandwidth = parse_number<double>(param()) * 1e9;
+    }
+    else if (arg == "--json")
+    {
+      opts.json_path = param();
+    }
+    else if (arg == "--jsonbin")
+    {
+      opts.jsonbin_path = param();
+    }
+    else if (arg == "--md")
+    {
+      opts.md_path = param();
+    }
+    else
+    {
+      throw std::runtime_error("Unknown option '" + arg + "', see --help");
+    }
+  }
+
+  if (selections.empty())
+  {
+    const auto& benches = nvbench::benchmark_manager::get().get_benchmarks();
+    for (std::size_t i = 0; i < benches.size(); ++i)
+    {
+      selections.push_back({benches[i].get(), i, {}});
+    }
+  }
+
+  std::vector<run_result> results;
+  for (const auto& sel : selections)
+  {
+    auto axes = sel.bench->get_axes();
+    for (const auto& argument : global_axis_arguments)
+    {
+      apply_axis_argument(axes, argument);
+    }
+    for (const auto& argument : sel.axis_arguments)
+    {
+      apply_axis_argument(axes, argument);
+    }
+    results.push_back({sel.bench, sel.index, std::move(axes), {}});
+  }
+
+  if (jsonlist_devices)
+  {
+    json_writer json(std::cout);
+    json.begin_object();
+    json.key("devices");
+    json.begin_array();
+    write_device(json, configure_threads(opts), 0.0);
+    json.end_array();
+    json.end_object();
+    std::cout << "\n";
+    return 0;
+  }
+
+  if (jsonlist_benches)
+  {
+    json_writer json(std::cout);
+    json.begin_object();
+    json.key("benchmarks");
+    json.begin_array();
+    for (const auto& result : results)
+    {
+      json.begin_object();
+      json.member("name", result.bench->get_name());
+      json.member("index", static_cast<double>(result.index));
+      write_axes(json, result.axes);
+      json.end_object();
+    }
+    json.end_array();
+    json.end_object();
+    std::cout << "\n";
+    return 0;
+  }
+
+  if (list)
+  {
+    for (const auto& result : results)
+    {
+      std::cout << "# Benchmark: " << result.index << " `" << result.bench->get_name() << "`\n\n";
+      for (const auto& ax : result.axes)
+      {
+        std::cout << "* `" << axis_label(ax) << "` : " << axis_type_name(ax.type) << "\n";
+        for (const auto& value : ax.values)
+        {
+          std::cout << "  * `" << value.input_string << "`"
+                    << (value.description.empty() ? "" : " (" + value.description + ")") << "\n";
+        }
+      }
+      std::cout << "\n";
+    }
+    return 0;
+  }
+
+  const int threads = configure_threads(opts);
+  const double peak = opts.peak_bandwidth > 0.0 ? opts.peak_bandwidth : measure_stream_bandwidth();
+
+  std::cout << "# Devices\n\n"
+            << "## [0] `" << cpu_name() << "`\n"
+            << "* Threads: " << threads << (opts.pin ? " (pinned)" : "") << "\n"
+            << "* Last Level Cache: " << last_level_cache_bytes() / 1024 << " KiB\n"
+            << "* Bandwidth Ceiling: " << format_rate(peak, "B/s")
+            << (opts.peak_bandwidth > 0.0 ? " (given)" : " (STREAM)") << "\n\n"
+            << "# Log\n\n";
+
+  for (std::size_t i = 0; i < results.size(); ++i)
+  {
+    results[i].states = run_benchmark(selections[i], results[i].axes);
+  }
+
+  print_results(std::cout, results, peak);
+  if (!opts.md_path.empty())
+  {
+    std::ofstream md(opts.md_path);
+    print_results(md, results, peak);
+  }
+  if (!opts.json_path.empty())
+  {
+    write_json(opts.json_path, false, args, results, threads, peak);
+  }
+  if (!opts.jsonbin_path.empty())
+  {
+    write_json(opts.jsonbin_path, true, args, results, threads, peak);
+  }
+  return 0;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+  try
+  {
+    return run(argc, argv);
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "Error: " << e.what() << std::endl;
+    return 1;
+  }
+}
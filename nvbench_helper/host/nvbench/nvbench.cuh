@@ -0,0 +1,493 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// A host-only implementation of the part of NVBench used by the Thrust benchmarks. It stands in for NVBench in the
+// benchmarks of the CPP, OMP, and TBB device systems, which thus neither need a GPU nor the CUDA toolkit. Benchmarks
+// are declared, parameterized, and run as with NVBench, and the command line and the JSON output follow NVBench, so
+// that the scripts in benchmarks/scripts collect and compare host results like GPU ones. See main.cpp for the driver.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+// Execution space specifiers are provided by the CUDA runtime headers when NVBench is used
+#ifndef __host__
+#  define __host__
+#endif
+#ifndef __device__
+#  define __device__
+#endif
+#ifndef __forceinline__
+#  define __forceinline__ inline
+#endif
+
+namespace nvbench
+{
+using int8_t    = std::int8_t;
+using int16_t   = std::int16_t;
+using int32_t   = std::int32_t;
+using int64_t   = std::int64_t;
+using uint8_t   = std::uint8_t;
+using uint16_t  = std::uint16_t;
+using uint32_t  = std::uint32_t;
+using uint64_t  = std::uint64_t;
+using float32_t = float;
+using float64_t = double;
+
+template <typename... Ts>
+struct type_list
+{};
+
+std::string demangle(const std::type_info& type);
+
+template <typename T>
+struct type_strings
+{
+  static std::string input_string()
+  {
+    return demangle(typeid(T));
+  }
+
+  static std::string description()
+  {
+    return {};
+  }
+};
+} // namespace nvbench
+
+#define NVBENCH_DECLARE_TYPE_STRINGS(Type, InputString, Description) \
+  namespace nvbench                                                  \
+  {                                                                  \
+  template <>                                                        \
+  struct type_strings<Type>                                          \
+  {                                                                  \
+    static std::string input_string()                                \
+    {                                                                \
+      return InputString;                                            \
+    }                                                                \
+    static std::string description()                                 \
+    {                                                                \
+      return Description;                                            \
+    }                                                                \
+  };                                                                 \
+  }
+
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::int8_t, "I8", "int8");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::int16_t, "I16", "int16");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::int32_t, "I32", "int32");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::int64_t, "I64", "int64");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::uint8_t, "U8", "uint8");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::uint16_t, "U16", "uint16");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::uint32_t, "U32", "uint32");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::uint64_t, "U64", "uint64");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::float32_t, "F32", "float");
+NVBENCH_DECLARE_TYPE_STRINGS(nvbench::float64_t, "F64", "double");
+
+namespace nvbench
+{
+// The values start, start + stride, ... up to and including end
+template <typename T>
+auto range(T start, T end, T stride = T{1})
+{
+  using value_type = std::conditional_t<std::is_floating_point_v<T>, float64_t, int64_t>;
+
+  std::vector<value_type> result;
+  const auto size = static_cast<std::size_t>((end - start) / stride) + 1;
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    result.push_back(static_cast<value_type>(start) + static_cast<value_type>(i) * static_cast<value_type>(stride));
+  }
+  return result;
+}
+
+enum class axis_type
+{
+  type,
+  int64,
+  float64,
+  string
+};
+
+struct axis_value
+{
+  std::string input_string;
+  std::string description;
+  // Position of the value in the declaration of its type axis, which selects the type
+  std::size_t type_index{};
+  int64_t int64_value{};
+  float64_t float64_value{};
+};
+
+struct axis
+{
+  std::string name;
+  axis_type type{};
+  // Whether the values of an int64 axis are given as powers of two
+  bool is_power_of_two{};
+  std::vector<axis_value> values;
+
+  // The flags of the axis as spelled on the command line, e.g. `Elements[pow2]`
+  std::string flags() const
+  {
+    return is_power_of_two ? "pow2" : "";
+  }
+};
+
+// Measures the region of a sample explicitly, for benchmarks executed with `exec_tag::timer`
+class timer
+{
+public:
+  void start();
+  void stop();
+
+  float64_t get_duration() const
+  {
+    return m_duration;
+  }
+
+private:
+  std::int64_t m_start{};
+  float64_t m_duration{};
+};
+
+// There are no streams on the host
+struct launch
+{};
+
+namespace exec_tag
+{
+namespace impl
+{
+enum tag_flags : unsigned
+{
+  none_flag     = 0,
+  timer_flag    = 1,
+  no_batch_flag = 2,
+  sync_flag     = 4,
+  gpu_flag      = 8
+};
+
+template <unsigned Flags>
+struct tag
+{
+  static constexpr unsigned flags = Flags;
+};
+
+template <unsigned LhsFlags, unsigned RhsFlags>
+constexpr tag<LhsFlags | RhsFlags> operator|(tag<LhsFlags>, tag<RhsFlags>) noexcept
+{
+  return {};
+}
+} // namespace impl
+
+// Only `timer` affects host benchmarks: every sample runs a single launch and is synchronous
+inline constexpr impl::tag<impl::none_flag> none{};
+inline constexpr impl::tag<impl::timer_flag> timer{};
+inline constexpr impl::tag<impl::no_batch_flag> no_batch{};
+inline constexpr impl::tag<impl::sync_flag> sync{};
+inline constexpr impl::tag<impl::gpu_flag> gpu{};
+} // namespace exec_tag
+
+class benchmark_base;
+
+// The value of an axis in a state
+struct named_value
+{
+  std::string name;
+  axis_type type{};
+  const axis_value* value{};
+};
+
+class state
+{
+public:
+  state(const benchmark_base& bench, std::vector<named_value> values);
+
+  const benchmark_base& get_benchmark() const
+  {
+    return m_benchmark;
+  }
+
+  const std::vector<named_value>& get_axis_values() const
+  {
+    return m_values;
+  }
+
+  int64_t get_int64(const std::string& name) const;
+  int64_t get_int64_or_default(const std::string& name, int64_t default_value) const;
+  float64_t get_float64(const std::string& name) const;
+  float64_t get_float64_or_default(const std::string& name, float64_t default_value) const;
+  const std::string& get_string(const std::string& name) const;
+  std::string get_string_or_default(const std::string& name, std::string default_value) const;
+
+  void add_element_count(std::size_t elements, std::string = {})
+  {
+    m_element_count += elements;
+  }
+
+  std::size_t get_element_count() const
+  {
+    return m_element_count;
+  }
+
+  template <typename T>
+  void add_global_memory_reads(std::size_t count, std::string column_name = {})
+  {
+    add_global_memory_reads(count * sizeof(T), std::move(column_name));
+  }
+
+  void add_global_memory_reads(std::size_t bytes, std::string = {})
+  {
+    m_global_memory_reads += bytes;
+  }
+
+  template <typename T>
+  void add_global_memory_writes(std::size_t count, std::string column_name = {})
+  {
+    add_global_memory_writes(count * sizeof(T), std::move(column_name));
+  }
+
+  void add_global_memory_writes(std::size_t bytes, std::string = {})
+  {
+    m_global_memory_writes += bytes;
+  }
+
+  std::size_t get_global_memory_rw_bytes() const
+  {
+    return m_global_memory_reads + m_global_memory_writes;
+  }
+
+  void skip(std::string reason)
+  {
+    m_skip_reason = std::move(reason);
+    m_is_skipped  = true;
+  }
+
+  bool is_skipped() const
+  {
+    return m_is_skipped;
+  }
+
+  const std::string& get_skip_reason() const
+  {
+    return m_skip_reason;
+  }
+
+  // The durations of the samples in seconds
+  const std::vector<float64_t>& get_samples() const
+  {
+    return m_samples;
+  }
+
+  // The wall time spent measuring, including the preparation of each sample, in seconds
+  float64_t get_walltime() const
+  {
+    return m_walltime;
+  }
+
+  template <typename ExecTags, typename KernelLauncher>
+  void exec(ExecTags, KernelLauncher&& launcher)
+  {
+    if constexpr ((ExecTags::flags & exec_tag::impl::timer_flag) != 0)
+    {
+      measure([&](launch& l, timer& t) {
+        launcher(l, t);
+      });
+    }
+    else
+    {
+      measure([&](launch& l, timer& t) {
+        t.start();
+        launcher(l);
+        t.stop();
+      });
+    }
+  }
+
+  template <typename KernelLauncher>
+  void exec(KernelLauncher&& launcher)
+  {
+    exec(exec_tag::none, std::forward<KernelLauncher>(launcher));
+  }
+
+private:
+  const named_value& find(const std::string& name, axis_type type) const;
+  const named_value* try_find(const std::string& name, axis_type type) const;
+
+  // Samples `sample` until the stopping criterion is met, defined with the command line options in main.cpp
+  void measure(const std::function<void(launch&, timer&)>& sample);
+
+  const benchmark_base& m_benchmark;
+  std::vector<named_value> m_values;
+  std::size_t m_element_count{};
+  std::size_t m_global_memory_reads{};
+  std::size_t m_global_memory_writes{};
+  bool m_is_skipped{};
+  std::string m_skip_reason;
+  std::vector<float64_t> m_samples;
+  float64_t m_walltime{};
+};
+
+class benchmark_base
+{
+public:
+  virtual ~benchmark_base() = default;
+
+  benchmark_base& set_name(std::string name)
+  {
+    m_name = std::move(name);
+    return *this;
+  }
+
+  const std::string& get_name() const
+  {
+    return m_name;
+  }
+
+  benchmark_base& set_type_axes_names(std::vector<std::string> names);
+  benchmark_base& add_int64_axis(std::string name, std::vector<int64_t> values);
+  benchmark_base& add_int64_power_of_two_axis(std::string name, std::vector<int64_t> exponents);
+  benchmark_base& add_float64_axis(std::string name, std::vector<float64_t> values);
+  benchmark_base& add_string_axis(std::string name, std::vector<std::string> values);
+
+  // The type axes come first, in the order of the type lists
+  std::vector<axis>& get_axes()
+  {
+    return m_axes;
+  }
+
+  const std::vector<axis>& get_axes() const
+  {
+    return m_axes;
+  }
+
+  // Runs the benchmark on `s`, instantiated for the types selected by the `type_index` of its type axes
+  virtual void run(state& s, const std::size_t* type_indices) const = 0;
+
+protected:
+  template <typename... Ts>
+  void add_type_axis(type_list<Ts...>)
+  {
+    axis result{"T" + std::to_string(m_axes.size()), axis_type::type, false, {}};
+    std::size_t index = 0;
+    (result.values.push_back({type_strings<Ts>::input_string(), type_strings<Ts>::description(), index++, 0, 0.0}), ...);
+    m_axes.push_back(std::move(result));
+  }
+
+private:
+  std::string m_name;
+  std::vector<axis> m_axes;
+};
+
+namespace detail
+{
+template <typename KernelGenerator, typename... Chosen>
+void dispatch(const KernelGenerator& generator, state& s, const std::size_t*, type_list<Chosen...> chosen)
+{
+  generator(s, chosen);
+}
+
+// Instantiates `generator` for every combination of the types of the remaining type axes, and calls the one for the
+// types selected by `type_indices`
+template <typename KernelGenerator, typename... Chosen, typename... AxisTypes, typename... RemainingAxes>
+void dispatch(const KernelGenerator& generator,
+              state& s,
+              const std::size_t* type_indices,
+              type_list<Chosen...>,
+              type_list<AxisTypes...>,
+              RemainingAxes... remaining)
+{
+  std::size_t index = 0;
+  ((index++ == *type_indices
+      ? dispatch(generator, s, type_indices + 1, type_list<Chosen..., AxisTypes>{}, remaining...)
+      : void()),
+   ...);
+}
+} // namespace detail
+
+template <typename KernelGenerator, typename TypeAxes>
+class benchmark;
+
+template <typename KernelGenerator, typename... TypeAxes>
+class benchmark<KernelGenerator, type_list<TypeAxes...>> final : public benchmark_base
+{
+public:
+  benchmark()
+  {
+    (add_type_axis(TypeAxes{}), ...);
+  }
+
+  void run(state& s, const std::size_t* type_indices) const override
+  {
+    detail::dispatch(KernelGenerator{}, s, type_indices, type_list<>{}, TypeAxes{}...);
+  }
+};
+
+class benchmark_manager
+{
+public:
+  static benchmark_manager& get()
+  {
+    static benchmark_manager instance;
+    return instance;
+  }
+
+  benchmark_base& add(std::unique_ptr<benchmark_base> bench)
+  {
+    m_benchmarks.push_back(std::move(bench));
+    return *m_benchmarks.back();
+  }
+
+  const std::vector<std::unique_ptr<benchmark_base>>& get_benchmarks() const
+  {
+    return m_benchmarks;
+  }
+
+private:
+  std::vector<std::unique_ptr<benchmark_base>> m_benchmarks;
+};
+} // namespace nvbench
+
+#define NVBENCH_DETAIL_CONCAT_IMPL(lhs, rhs) lhs##rhs
+#define NVBENCH_DETAIL_CONCAT(lhs, rhs)      NVBENCH_DETAIL_CONCAT_IMPL(lhs, rhs)
+#define NVBENCH_DETAIL_UNIQUE_IDENTIFIER(prefix) \
+  NVBENCH_DETAIL_CONCAT(NVBENCH_DETAIL_CONCAT(nvbench_detail_, prefix), __LINE__)
+
+#define NVBENCH_TYPE_AXES(...) nvbench::type_list<__VA_ARGS__>
+
+#define NVBENCH_BENCH_TYPES(KernelGenerator, TypeAxes)                                          \
+  struct NVBENCH_DETAIL_UNIQUE_IDENTIFIER(KernelGenerator)                                      \
+  {                                                                                             \
+    template <typename... Ts>                                                                   \
+    void operator()(nvbench::state& state, nvbench::type_list<Ts...> types) const               \
+    {                                                                                           \
+      KernelGenerator(state, types);                                                            \
+    }                                                                                           \
+  };                                                                                            \
+  static nvbench::benchmark_base& NVBENCH_DETAIL_UNIQUE_IDENTIFIER(KernelGenerator##_bench) =   \
+    nvbench::benchmark_manager::get()                                                           \
+      .add(std::make_unique<nvbench::benchmark<NVBENCH_DETAIL_UNIQUE_IDENTIFIER(KernelGenerator), \
+                                               TypeAxes>>())                                    \
+      .set_name(#KernelGenerator)
+
+#define NVBENCH_BENCH(KernelGenerator)                                                          \
+  struct NVBENCH_DETAIL_UNIQUE_IDENTIFIER(KernelGenerator)                                      \
+  {                                                                                             \
+    void operator()(nvbench::state& state, nvbench::type_list<>) const                          \
+    {                                                                                           \
+      KernelGenerator(state);                                                                   \
+    }                                                                                           \
+  };                                                                                            \
+  static nvbench::benchmark_base& NVBENCH_DETAIL_UNIQUE_IDENTIFIER(KernelGenerator##_bench) =   \
+    nvbench::benchmark_manager::get()                                                           \
+      .add(std::make_unique<nvbench::benchmark<NVBENCH_DETAIL_UNIQUE_IDENTIFIER(KernelGenerator), \
+                                               nvbench::type_list<>>>())                        \
+      .set_name(#KernelGenerator)
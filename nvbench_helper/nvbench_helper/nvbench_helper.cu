@@ -1,5 +1,3 @@
-#include <cub/device/device_copy.cuh>
-
 #include <thrust/binary_search.h>
 #include <thrust/count.h>
 #include <thrust/detail/raw_pointer_cast.h>
@@ -22,11 +20,16 @@
 #include <random>
 #include <type_traits>
 
-#include <curand.h>
 #include <nvbench_helper.cuh>
 
 #include "thrust/device_vector.h"
 
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
+#  include <cub/device/device_copy.cuh>
+
+#  include <curand.h>
+#endif // THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
+
 namespace detail
 {
 constexpr double lognormal_mean  = 3.0;
@@ -92,6 +95,7 @@ const double* host_generator_t::new_constant(std::size_t num_items, double val)
   return h_distribution;
 }
 
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
 class device_generator_t
 {
 public:
@@ -116,6 +120,10 @@ private:
   curandGenerator_t m_gen;
   thrust::device_vector<double> m_distribution;
 };
+#else // THRUST_DEVICE_SYSTEM != THRUST_DEVICE_SYSTEM_CUDA
+// Without CUDA, the device system of Thrust runs on the host, and so does the device generator
+using device_generator_t = host_generator_t;
+#endif // THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
 
 template <typename T>
 struct random_to_item_t
@@ -141,6 +149,7 @@ struct random_to_item_t
   }
 };
 
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
 const double* device_generator_t::new_uniform_distribution(seed_t seed, std::size_t num_items)
 {
   m_distribution.resize(num_items);
@@ -170,6 +179,7 @@ const double* device_generator_t::new_constant(std::size_t num_items, double val
   thrust::fill_n(thrust::device, d_distribution, num_items, val);
   return d_distribution;
 }
+#endif // THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
 
 struct and_t
 {
@@ -605,7 +615,8 @@ struct offset_to_size_t
 };
 
 template <typename T>
-void gen_key_segments(executor exec, seed_t, cuda::std::span<T> keys, cuda::std::span<std::size_t> segment_offsets)
+void gen_key_segments(
+  [[maybe_unused]] executor exec, seed_t, cuda::std::span<T> keys, cuda::std::span<std::size_t> segment_offsets)
 {
   thrust::counting_iterator<int> iota(0);
   offset_to_iterator_t<T> dst_transform_op{keys.data()};
@@ -616,6 +627,7 @@ void gen_key_segments(executor exec, seed_t, cuda::std::span<T> keys, cuda::std:
   auto d_range_dsts  = thrust::make_transform_iterator(segment_offsets.data(), dst_transform_op);
   auto d_range_sizes = thrust::make_transform_iterator(iota, offset_to_size_t{segment_offsets.data()});
 
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
   if (exec == executor::device)
   {
     std::uint8_t* d_temp_storage   = nullptr;
@@ -629,13 +641,13 @@ void gen_key_segments(executor exec, seed_t, cuda::std::span<T> keys, cuda::std:
     cub::DeviceCopy::Batched(
       d_temp_storage, temp_storage_bytes, d_range_srcs, d_range_dsts, d_range_sizes, total_segments);
     cudaDeviceSynchronize();
+    return;
   }
-  else
+#endif // THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
+
+  for (std::size_t sid = 0; sid < total_segments; sid++)
   {
-    for (std::size_t sid = 0; sid < total_segments; sid++)
-    {
-      thrust::copy(d_range_srcs[sid], d_range_srcs[sid] + d_range_sizes[sid], d_range_dsts[sid]);
-    }
+    thrust::copy(d_range_srcs[sid], d_range_srcs[sid] + d_range_sizes[sid], d_range_dsts[sid]);
   }
 }
 
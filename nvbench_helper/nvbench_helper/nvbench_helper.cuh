@@ -1,7 +1,5 @@
 #pragma once
 
-#include <cub/thread/thread_operators.cuh>
-
 #include <thrust/device_vector.h>
 #include <thrust/execution_policy.h>
 
@@ -12,7 +10,10 @@
 #include <cuda/std/span>
 #include <cuda/std/type_traits>
 
+// CUB needs the vector types of the CTK, which the host systems are built without
 #if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
+#  include <cub/thread/thread_operators.cuh>
+
 #  include <cuda/memory_resource>
 #  include <cuda/std/execution>
 #  include <cuda/stream>
@@ -47,8 +48,10 @@ NVBENCH_DECLARE_TYPE_STRINGS(complex64, "C64", "complex64");
 
 NVBENCH_DECLARE_TYPE_STRINGS(::cuda::std::false_type, "false", "false_type");
 NVBENCH_DECLARE_TYPE_STRINGS(::cuda::std::true_type, "true", "true_type");
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
 NVBENCH_DECLARE_TYPE_STRINGS(cub::detail::arg_min, "arg_min", "cub::detail::arg_min");
 NVBENCH_DECLARE_TYPE_STRINGS(cub::detail::arg_max, "arg_max", "cub::detail::arg_max");
+#endif // THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
 
 template <typename T, T I>
 struct nvbench::type_strings<::cuda::std::integral_constant<T, I>>
@@ -726,7 +729,8 @@ auto cuda_policy(caching_allocator_t& alloc)
   return cuda::execution::gpu.with(cuda::mr::get_memory_resource, alloc);
 }
 #else
-auto policy(caching_allocator_t&)
+// Host compilers warn about the unused functions of the anonymous namespace
+[[maybe_unused]] auto policy(caching_allocator_t&)
 {
   return thrust::device;
 }
@@ -743,7 +747,7 @@ auto cuda_policy(caching_allocator_t& alloc, nvbench::launch& launch)
     .with(cuda::get_stream, launch.get_stream().get_stream());
 }
 #else
-auto policy(caching_allocator_t&, nvbench::launch&)
+[[maybe_unused]] auto policy(caching_allocator_t&, nvbench::launch&)
 {
   return thrust::device;
 }
@@ -42,9 +42,81 @@ def _configure_hostjit_paths() -> None:
 
 _configure_hostjit_paths()
 
-from ._bindings import _BINDINGS_AVAILABLE  # type: ignore[attr-defined]  # noqa: E402
 
-if not _BINDINGS_AVAILABLE:
+# Setting CUDA_COMPUTE_BACKEND=host selects the CPU backend (see _host/) even
+# when a device is available. Otherwise, it is only selected when the CUDA
+# bindings can't be loaded and there is no CUDA device, e.g. on CPU-only
+# machines without CUDA drivers. A broken CUDA install on a machine with a
+# device still raises. The device is only queried once the bindings failed to
+# load, since initializing the driver at import time would make forked
+# processes unable to use it.
+def _host_backend_requested() -> bool:
+    import os
+
+    return os.environ.get("CUDA_COMPUTE_BACKEND", "").lower() == "host"
+
+
+def _cuda_device_present() -> bool:
+    import ctypes
+    import os
+
+    try:
+        libcuda = ctypes.CDLL("nvcuda.dll" if os.name == "nt" else "libcuda.so.1")
+    except OSError:
+        return False
+    count = ctypes.c_int(0)
+    if libcuda.cuInit(0) != 0 or libcuda.cuDeviceGetCount(ctypes.byref(count)) != 0:
+        return False
+    return count.value > 0
+
+
+_use_host_backend = _host_backend_requested()
+if _use_host_backend:
+    _BINDINGS_AVAILABLE = False
+else:
+    _bindings_error: Exception | None = None
+    try:
+        from ._bindings import _BINDINGS_AVAILABLE  # type: ignore[attr-defined]
+    except (ImportError, OSError, RuntimeError) as e:
+        _BINDINGS_AVAILABLE = False
+        _bindings_error = e
+
+    if not _BINDINGS_AVAILABLE:
+        if _cuda_device_present():
+            if _bindings_error is not None:
+                raise _bindings_error
+        else:
+            import warnings
+
+            _message = (
+                "No CUDA device found, falling back to the CPU backend of cuda.compute"
+            )
+            if _bindings_error is not None:
+                _message += f" (the CUDA bindings failed to load: {_bindings_error})"
+            warnings.warn(
+                _message + ". Set CUDA_COMPUTE_BACKEND=host to select it explicitly.",
+                RuntimeWarning,
+            )
+            _use_host_backend = True
+
+if _use_host_backend:
+    try:
+        from ._host import *  # noqa: F403
+        from ._host import __all__ as _host_all
+
+        _BACKEND = "host"
+        __all__ = ["_BINDINGS_AVAILABLE", *_host_all]
+    except ImportError as e:
+        _host_backend_error = e
+        __all__ = ["_BINDINGS_AVAILABLE"]
+
+        def __getattr__(name):
+            raise AttributeError(
+                f"Cannot access 'cuda.compute.{name}' because CUDA bindings are not available."
+                "This typically means you're running on a CPU-only machine without CUDA drivers installed. "
+                f"The CPU backend is not available either: {_host_backend_error}"
+            )
+elif not _BINDINGS_AVAILABLE:
     __all__ = ["_BINDINGS_AVAILABLE"]
 
     def __getattr__(name):
@@ -53,6 +125,7 @@ if not _BINDINGS_AVAILABLE:
             "This typically means you're running on a CPU-only machine without CUDA drivers installed."
         )
 else:
+    _BACKEND = "cuda"
     from ._caching import clear_all_caches
     from .algorithms import (
         DoubleBuffer,
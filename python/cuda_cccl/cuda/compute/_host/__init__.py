@@ -0,0 +1,97 @@
+# Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. ALL RIGHTS RESERVED.
+#
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+"""
+CPU backend of ``cuda.compute``.
+
+The algorithms and iterators of this package have the API of their device
+counterparts, and operate in place on NumPy arrays (or any object exposing the
+array interface). User operators are compiled by Numba's CPU target, and the
+algorithms run on the Thrust host system (OpenMP, TBB or CPP) through
+``libcccl_host_shim``, which is built with
+``-DCCCL_PYTHON_ENABLE_HOST_BACKEND=ON``. Without it, they run sequentially in
+Python.
+
+``cuda.compute`` selects this backend when the ``CUDA_COMPUTE_BACKEND``
+environment variable is set to ``host``, or, with a warning, when the CUDA
+bindings are not available and there is no CUDA device.
+"""
+
+from __future__ import annotations
+
+from ._algorithms import (
+    DoubleBuffer,
+    SortOrder,
+    binary_transform,
+    clear_all_caches,
+    exclusive_scan,
+    inclusive_scan,
+    lower_bound,
+    make_binary_transform,
+    make_exclusive_scan,
+    make_inclusive_scan,
+    make_lower_bound,
+    make_merge_sort,
+    make_radix_sort,
+    make_reduce_into,
+    make_segmented_reduce,
+    make_unary_transform,
+    make_upper_bound,
+    merge_sort,
+    radix_sort,
+    reduce_into,
+    segmented_reduce,
+    unary_transform,
+    upper_bound,
+)
+from ._iterators import (
+    CacheModifiedInputIterator,
+    ConstantIterator,
+    CountingIterator,
+    DiscardIterator,
+    IteratorBase,
+    PermutationIterator,
+    ReverseIterator,
+    TransformIterator,
+    TransformOutputIterator,
+    ZipIterator,
+)
+from ._ops import OpKind
+
+__all__ = [
+    "CacheModifiedInputIterator",
+    "ConstantIterator",
+    "CountingIterator",
+    "DiscardIterator",
+    "DoubleBuffer",
+    "IteratorBase",
+    "OpKind",
+    "PermutationIterator",
+    "ReverseIterator",
+    "SortOrder",
+    "TransformIterator",
+    "TransformOutputIterator",
+    "ZipIterator",
+    "binary_transform",
+    "clear_all_caches",
+    "exclusive_scan",
+    "inclusive_scan",
+    "lower_bound",
+    "make_binary_transform",
+    "make_exclusive_scan",
+    "make_inclusive_scan",
+    "make_lower_bound",
+    "make_merge_sort",
+    "make_radix_sort",
+    "make_reduce_into",
+    "make_segmented_reduce",
+    "make_unary_transform",
+    "make_upper_bound",
+    "merge_sort",
+    "radix_sort",
+    "reduce_into",
+    "segmented_reduce",
+    "unary_transform",
+    "upper_bound",
+]
@@ -0,0 +1,1048 @@
+# Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. ALL RIGHTS RESERVED.
+#
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+"""
+Algorithms of the host backend, with the signatures of their counterparts in
+``cuda.compute.algorithms``.
+
+Each algorithm is a few passes of chunk kernels, which the shim runs in
+parallel on the Thrust host system. The kernels are compiled once per
+combination of iterator kinds, dtypes and operator, and cached for the
+lifetime of the process. The host backend needs no temporary storage: the
+``make_*`` objects report 0 bytes and allocate their (small) scratch arrays
+themselves. ``stream`` arguments are accepted and ignored.
+"""
+
+from __future__ import annotations
+
+from enum import Enum
+
+import numpy as np
+
+from . import _codegen, _shim
+from ._codegen import i64, u64
+from ._iterators import IteratorBase, PointerIterator, to_iterator
+from ._ops import OpKind, compile_op, op_key
+
+# Below this many items per chunk, the cost of a chunk outweighs the parallelism
+_MIN_ITEMS_PER_CHUNK = 1 << 12
+
+_UINT64_MASK = (1 << 64) - 1
+
+_kernels: dict = {}
+
+
+def clear_all_caches():
+    """Drop the compiled kernels of the host backend."""
+    _kernels.clear()
+
+
+def _cached(key, build):
+    kernels = _kernels.get(key)
+    if kernels is None:
+        kernels = _kernels[key] = build()
+    return kernels
+
+
+def _chunks(num_items: int) -> tuple[int, int]:
+    """The number and size of the chunks [0, num_items) is split into."""
+    if num_items <= 0:
+        return 0, 1
+    num_chunks = min(4 * _shim.concurrency(), -(-num_items // _MIN_ITEMS_PER_CHUNK))
+    chunk_size = -(-num_items // max(num_chunks, 1))
+    return -(-num_items // chunk_size), chunk_size
+
+
+def _slots(iterators, scalars=()) -> tuple[np.ndarray, list]:
+    """The slots of ``iterators`` followed by ``scalars``, and the buffers to keep alive."""
+    values = []
+    owners = []
+    for it in iterators:
+        for owner, address, stride in it.buffers():
+            owners.append(owner)
+            values += [address, stride & _UINT64_MASK]
+    values += [int(scalar) & _UINT64_MASK for scalar in scalars]
+    return np.array(values, dtype=np.uint64), owners
+
+
+def _first_slots(iterators) -> list[int]:
+    firsts = []
+    slot = 0
+    for it in iterators:
+        firsts.append(slot)
+        slot += it.num_slots
+    return firsts + [slot]
+
+
+def _run(kernel, slots: np.ndarray, num_items: int, num_chunks=None, chunk_size=None):
+    if num_chunks is None:
+        num_chunks, chunk_size = _chunks(num_items)
+    _shim.for_each_chunk(
+        slots.ctypes.data, num_chunks, chunk_size, num_items, kernel.address
+    )
+
+
+def _value_iterator(value) -> PointerIterator:
+    """A one element iterator over an initial value, a NumPy scalar or array."""
+    array = np.asarray(value)
+    return PointerIterator(array.reshape(-1)[:1])
+
+
+def _run_with_temp_storage(algorithm, **kwargs):
+    temp_storage_bytes = algorithm(temp_storage=None, **kwargs)
+    algorithm(temp_storage=np.empty(temp_storage_bytes, np.uint8), **kwargs)
+
+
+# ---------------------------------------------------------------------------
+# reduce_into
+# ---------------------------------------------------------------------------
+
+
+def _build_reduce_chunk(d_in, op, accum_dtype):
+    """A kernel storing the reduction of each chunk of ``d_in`` to the partials after its slots."""
+    read_in = d_in.make_reader(0)
+    write_partial = _codegen.make_array_writer(accum_dtype, d_in.num_slots)
+    cast = _codegen.make_caster(accum_dtype)
+
+    def reduce_chunk(slots, chunk, begin, end):
+        accum = cast(read_in(slots, begin))
+        for i in range(begin + 1, end):
+            accum = cast(op(accum, read_in(slots, i)))
+        write_partial(slots, chunk, accum)
+
+    return _codegen.chunk_kernel(reduce_chunk)
+
+
+def _build_reduce(d_in, d_out, op, accum_dtype):
+    cast = _codegen.make_caster(accum_dtype)
+
+    # Folds the partials in order, after the initial value
+    read_partial = _codegen.make_array_reader(accum_dtype, 0)
+    read_init = _codegen.make_array_reader(accum_dtype, 2)
+    write_out = d_out.make_writer(4)
+
+    def reduce_partials(slots, chunk, begin, end):
+        accum = read_init(slots, 0)
+        for c in range(begin, end):
+            accum = cast(op(accum, read_partial(slots, c)))
+        write_out(slots, 0, accum)
+
+    return (
+        _build_reduce_chunk(d_in, op, accum_dtype),
+        _codegen.chunk_kernel(reduce_partials),
+    )
+
+
+def _reduce(reduce_chunk, reduce_partials, d_in, d_out, h_init, num_items):
+    num_chunks, chunk_size = _chunks(num_items)
+    partials = PointerIterator(np.empty(num_chunks, h_init.value_dtype))
+    if num_chunks:
+        slots, _owners = _slots([d_in, partials])
+        _run(reduce_chunk, slots, num_items, num_chunks, chunk_size)
+    slots, _owners = _slots([partials, h_init, d_out])
+    _run(reduce_partials, slots, num_chunks, 1, max(num_chunks, 1))
+
+
+class _Reduce:
+    __slots__ = ["kernels"]
+
+    def __init__(self, d_in, d_out, op, h_init):
+        d_in, d_out, h_init = (
+            to_iterator(d_in),
+            to_iterator(d_out),
+            _value_iterator(h_init),
+        )
+        accum_dtype = h_init.value_dtype
+        key = ("reduce", d_in.kind, d_out.kind, accum_dtype, op_key(op))
+        self.kernels = _cached(
+            key, lambda: _build_reduce(d_in, d_out, compile_op(op), accum_dtype)
+        )
+
+    def __call__(
+        self, *, temp_storage, d_in, d_out, num_items: int, op, h_init, stream=None
+    ):
+        if temp_storage is None:
+            return 0
+        _reduce(
+            *self.kernels,
+            to_iterator(d_in),
+            to_iterator(d_out),
+            _value_iterator(h_init),
+            num_items,
+        )
+        return 0
+
+
+def make_reduce_into(*, d_in, d_out, op, h_init, **kwargs):
+    """Host counterpart of :func:`cuda.compute.algorithms.make_reduce_into`."""
+    return _Reduce(d_in, d_out, op, h_init)
+
+
+def reduce_into(*, d_in, d_out, num_items: int, op, h_init, stream=None, **kwargs):
+    """Host counterpart of :func:`cuda.compute.algorithms.reduce_into`."""
+    reducer = make_reduce_into(d_in=d_in, d_out=d_out, op=op, h_init=h_init, **kwargs)
+    _run_with_temp_storage(
+        reducer, d_in=d_in, d_out=d_out, num_items=num_items, op=op, h_init=h_init
+    )
+
+
+# ---------------------------------------------------------------------------
+# inclusive_scan, exclusive_scan
+# ---------------------------------------------------------------------------
+
+
+def _build_scan(d_in, d_out, op, accum_dtype, inclusive, has_init):
+    cast = _codegen.make_caster(accum_dtype)
+
+    # Replaces the partial of each chunk by the prefix of the chunks before it
+    read_partial = _codegen.make_array_reader(accum_dtype, 0)
+    write_partial = _codegen.make_array_writer(accum_dtype, 0)
+    read_init = _codegen.make_array_reader(accum_dtype, 2)
+
+    if has_init:
+
+        def scan_partials(slots, chunk, begin, end):
+            accum = read_init(slots, 0)
+            for c in range(begin, end):
+                partial = read_partial(slots, c)
+                write_partial(slots, c, accum)
+                accum = cast(op(accum, partial))
+
+    else:
+
+        def scan_partials(slots, chunk, begin, end):
+            accum = read_partial(slots, begin)
+            for c in range(begin + 1, end):
+                partial = read_partial(slots, c)
+                write_partial(slots, c, accum)
+                accum = cast(op(accum, partial))
+
+    # Scans each chunk from its prefix
+    read_in = d_in.make_reader(0)
+    prefixes = d_in.num_slots
+    read_prefix = _codegen.make_array_reader(accum_dtype, prefixes)
+    write_out = d_out.make_writer(prefixes + 2)
+
+    if not inclusive:
+
+        def scan_chunk(slots, chunk, begin, end):
+            accum = read_prefix(slots, chunk)
+            for i in range(begin, end):
+                value = read_in(slots, i)
+                write_out(slots, i, accum)
+                accum = cast(op(accum, value))
+
+    elif has_init:
+
+        def scan_chunk(slots, chunk, begin, end):
+            accum = read_prefix(slots, chunk)
+            for i in range(begin, end):
+                accum = cast(op(accum, read_in(slots, i)))
+                write_out(slots, i, accum)
+
+    else:
+
+        def scan_chunk(slots, chunk, begin, end):
+            if chunk == 0:
+                accum = cast(read_in(slots, begin))
+                write_out(slots, begin, accum)
+                begin += 1
+            else:
+                accum = read_prefix(slots, chunk)
+            for i in range(begin, end):
+                accum = cast(op(accum, read_in(slots, i)))
+                write_out(slots, i, accum)
+
+    return (
+        _build_reduce_chunk(d_in, op, accum_dtype),
+        _codegen.chunk_kernel(scan_partials),
+        _codegen.chunk_kernel(scan_chunk),
+    )
+
+
+class _Scan:
+    __slots__ = ["accum_dtype", "has_init", "kernels"]
+
+    def __init__(self, d_in, d_out, op, init_value, inclusive: bool):
+        if not inclusive and init_value is None:
+            raise ValueError("Exclusive scan with No init value is not supported")
+        d_in, d_out = to_iterator(d_in), to_iterator(d_out)
+        self.has_init = init_value is not None
+        self.accum_dtype = (
+            _value_iterator(init_value).value_dtype
+            if self.has_init
+            else d_in.value_dtype
+        )
+        if self.accum_dtype is None:
+            raise TypeError("The value type of d_in is unknown; pass an init_value")
+        key = (
+            "scan",
+            inclusive,
+            self.has_init,
+            d_in.kind,
+            d_out.kind,
+            self.accum_dtype,
+            op_key(op),
+        )
+        self.kernels = _cached(
+            key,
+            lambda: _build_scan(
+                d_in, d_out, compile_op(op), self.accum_dtype, inclusive, self.has_init
+            ),
+        )
+
+    def __call__(
+        self, *, temp_storage, d_in, d_out, op, init_value, num_items: int, stream=None
+    ):
+        if temp_storage is None or num_items <= 0:
+            return 0
+        reduce_chunk, scan_partials, scan_chunk = self.kernels
+        d_in, d_out = to_iterator(d_in), to_iterator(d_out)
+        init = _value_iterator(
+            init_value if self.has_init else np.empty(1, self.accum_dtype)
+        )
+
+        num_chunks, chunk_size = _chunks(num_items)
+        partials = PointerIterator(np.empty(num_chunks, self.accum_dtype))
+        if num_chunks > 1 or self.has_init:
+            slots, _owners = _slots([d_in, partials])
+            _run(reduce_chunk, slots, num_items, num_chunks, chunk_size)
+            slots, _owners = _slots([partials, init])
+            _run(scan_partials, slots, num_chunks, 1, num_chunks)
+        slots, _owners = _slots([d_in, partials, d_out])
+        _run(scan_chunk, slots, num_items, num_chunks, chunk_size)
+        return 0
+
+
+def make_exclusive_scan(*, d_in, d_out, op, init_value):
+    """Host counterpart of :func:`cuda.compute.algorithms.make_exclusive_scan`."""
+    return _Scan(d_in, d_out, op, init_value, False)
+
+
+def exclusive_scan(*, d_in, d_out, op, init_value, num_items: int, stream=None):
+    """Host counterpart of :func:`cuda.compute.algorithms.exclusive_scan`."""
+    scanner = make_exclusive_scan(d_in=d_in, d_out=d_out, op=op, init_value=init_value)
+    _run_with_temp_storage(
+        scanner,
+        d_in=d_in,
+        d_out=d_out,
+        op=op,
+        init_value=init_value,
+        num_items=num_items,
+    )
+
+
+def make_inclusive_scan(*, d_in, d_out, op, init_value=None):
+    """Host counterpart of :func:`cuda.compute.algorithms.make_inclusive_scan`."""
+    return _Scan(d_in, d_out, op, init_value, True)
+
+
+def inclusive_scan(*, d_in, d_out, op, init_value=None, num_items: int, stream=None):
+    """Host counterpart of :func:`cuda.compute.algorithms.inclusive_scan`."""
+    scanner = make_inclusive_scan(d_in=d_in, d_out=d_out, op=op, init_value=init_value)
+    _run_with_temp_storage(
+        scanner,
+        d_in=d_in,
+        d_out=d_out,
+        op=op,
+        init_value=init_value,
+        num_items=num_items,
+    )
+
+
+# ---------------------------------------------------------------------------
+# unary_transform, binary_transform
+# ---------------------------------------------------------------------------
+
+
+def _build_unary_transform(d_in, d_out, op):
+    read_in = d_in.make_reader(0)
+    write_out = d_out.make_writer(d_in.num_slots)
+
+    def transform_chunk(slots, chunk, begin, end):
+        for i in range(begin, end):
+            write_out(slots, i, op(read_in(slots, i)))
+
+    return _codegen.chunk_kernel(transform_chunk)
+
+
+def _build_binary_transform(d_in1, d_in2, d_out, op):
+    first_in1, first_in2, first_out, _ = _first_slots([d_in1, d_in2, d_out])
+    read_in1 = d_in1.make_reader(first_in1)
+    read_in2 = d_in2.make_reader(first_in2)
+    write_out = d_out.make_writer(first_out)
+
+    def transform_chunk(slots, chunk, begin, end):
+        for i in range(begin, end):
+            write_out(slots, i, op(read_in1(slots, i), read_in2(slots, i)))
+
+    return _codegen.chunk_kernel(transform_chunk)
+
+
+class _UnaryTransform:
+    __slots__ = ["kernel"]
+
+    def __init__(self, d_in, d_out, op):
+        d_in, d_out = to_iterator(d_in), to_iterator(d_out)
+        key = ("unary_transform", d_in.kind, d_out.kind, op_key(op))
+        self.kernel = _cached(
+            key, lambda: _build_unary_transform(d_in, d_out, compile_op(op))
+        )
+
+    def __call__(self, *, d_in, d_out, op, num_items: int, stream=None):
+        slots, _owners = _slots([to_iterator(d_in), to_iterator(d_out)])
+        _run(self.kernel, slots, num_items)
+
+
+class _BinaryTransform:
+    __slots__ = ["kernel"]
+
+    def __init__(self, d_in1, d_in2, d_out, op):
+        d_in1, d_in2, d_out = to_iterator(d_in1), to_iterator(d_in2), to_iterator(d_out)
+        key = ("binary_transform", d_in1.kind, d_in2.kind, d_out.kind, op_key(op))
+        self.kernel = _cached(
+            key, lambda: _build_binary_transform(d_in1, d_in2, d_out, compile_op(op))
+        )
+
+    def __call__(self, *, d_in1, d_in2, d_out, op, num_items: int, stream=None):
+        slots, _owners = _slots(
+            [to_iterator(d_in1), to_iterator(d_in2), to_iterator(d_out)]
+        )
+        _run(self.kernel, slots, num_items)
+
+
+def make_unary_transform(*, d_in, d_out, op):
+    """Host counterpart of :func:`cuda.compute.algorithms.make_unary_transform`."""
+    return _UnaryTransform(d_in, d_out, op)
+
+
+def make_binary_transform(*, d_in1, d_in2, d_out, op):
+    """Host counterpart of :func:`cuda.compute.algorithms.make_binary_transform`."""
+    return _BinaryTransform(d_in1, d_in2, d_out, op)
+
+
+def unary_transform(*, d_in, d_out, op, num_items: int, stream=None):
+    """Host counterpart of :func:`cuda.compute.algorithms.unary_transform`."""
+    make_unary_transform(d_in=d_in, d_out=d_out, op=op)(
+        d_in=d_in, d_out=d_out, op=op, num_items=num_items
+    )
+
+
+def binary_transform(*, d_in1, d_in2, d_out, op, num_items: int, stream=None):
+    """Host counterpart of :func:`cuda.compute.algorithms.binary_transform`."""
+    make_binary_transform(d_in1=d_in1, d_in2=d_in2, d_out=d_out, op=op)(
+        d_in1=d_in1, d_in2=d_in2, d_out=d_out, op=op, num_items=num_items
+    )
+
+
+# ---------------------------------------------------------------------------
+# segmented_reduce
+# ---------------------------------------------------------------------------
+
+
+def _build_segmented_reduce(d_in, d_out, start_offsets, end_offsets, op, accum_dtype):
+    first_in, first_out, first_start, first_end, first_init = _first_slots(
+        [d_in, d_out, start_offsets, end_offsets]
+    )
+    read_in = d_in.make_reader(first_in)
+    write_out = d_out.make_writer(first_out)
+    read_start = start_offsets.make_reader(first_start)
+    read_end = end_offsets.make_reader(first_end)
+    read_init = _codegen.make_array_reader(accum_dtype, first_init)
+    cast = _codegen.make_caster(accum_dtype)
+
+    def reduce_segments(slots, chunk, begin, end):
+        for segment in range(begin, end):
+            accum = read_init(slots, 0)
+            for i in range(
+                i64(read_start(slots, segment)), i64(read_end(slots, segment))
+            ):
+                accum = cast(op(accum, read_in(slots, i)))
+            write_out(slots, segment, accum)
+
+    return _codegen.chunk_kernel(reduce_segments)
+
+
+class _SegmentedReduce:
+    __slots__ = ["kernel"]
+
+    def __init__(self, d_in, d_out, start_offsets_in, end_offsets_in, op, h_init):
+        d_in, d_out = to_iterator(d_in), to_iterator(d_out)
+        start_offsets_in, end_offsets_in = (
+            to_iterator(start_offsets_in),
+            to_iterator(end_offsets_in),
+        )
+        accum_dtype = _value_iterator(h_init).value_dtype
+        key = (
+            "segmented_reduce",
+            d_in.kind,
+            d_out.kind,
+            start_offsets_in.kind,
+            end_offsets_in.kind,
+            accum_dtype,
+            op_key(op),
+        )
+        self.kernel = _cached(
+            key,
+            lambda: _build_segmented_reduce(
+                d_in,
+                d_out,
+                start_offsets_in,
+                end_offsets_in,
+                compile_op(op),
+                accum_dtype,
+            ),
+        )
+
+    def __call__(
+        self,
+        *,
+        temp_storage,
+        d_in,
+        d_out,
+        num_segments: int,
+        start_offsets_in,
+        end_offsets_in,
+        op,
+        h_init,
+        max_segment_size: int | None = None,
+        stream=None,
+    ):
+        if temp_storage is None:
+            return 0
+        slots, _owners = _slots(
+            [
+                to_iterator(d_in),
+                to_iterator(d_out),
+                to_iterator(start_offsets_in),
+                to_iterator(end_offsets_in),
+                _value_iterator(h_init),
+            ]
+        )
+        # Segments are uneven, so make more of smaller chunks
+        num_chunks = min(num_segments, 16 * _shim.concurrency())
+        if num_chunks:
+            chunk_size = -(-num_segments // num_chunks)
+            _run(
+                self.kernel,
+                slots,
+                num_segments,
+                -(-num_segments // chunk_size),
+                chunk_size,
+            )
+        return 0
+
+
+def make_segmented_reduce(*, d_in, d_out, start_offsets_in, end_offsets_in, op, h_init):
+    """Host counterpart of :func:`cuda.compute.algorithms.make_segmented_reduce`."""
+    return _SegmentedReduce(d_in, d_out, start_offsets_in, end_offsets_in, op, h_init)
+
+
+def segmented_reduce(
+    *,
+    d_in,
+    d_out,
+    num_segments: int,
+    start_offsets_in,
+    end_offsets_in,
+    op,
+    h_init,
+    max_segment_size: int | None = None,
+    stream=None,
+):
+    """Host counterpart of :func:`cuda.compute.algorithms.segmented_reduce`."""
+    reducer = make_segmented_reduce(
+        d_in=d_in,
+        d_out=d_out,
+        start_offsets_in=start_offsets_in,
+        end_offsets_in=end_offsets_in,
+        op=op,
+        h_init=h_init,
+    )
+    _run_with_temp_storage(
+        reducer,
+        d_in=d_in,
+        d_out=d_out,
+        num_segments=num_segments,
+        start_offsets_in=start_offsets_in,
+        end_offsets_in=end_offsets_in,
+        op=op,
+        h_init=h_init,
+        max_segment_size=max_segment_size,
+    )
+
+
+# ---------------------------------------------------------------------------
+# lower_bound, upper_bound
+# ---------------------------------------------------------------------------
+
+
+def _build_binary_search(d_data, d_values, d_out, comp, lower):
+    first_data, first_values, first_out, num_items_slot = _first_slots(
+        [d_data, d_values, d_out]
+    )
+    read_data = d_data.make_reader(first_data)
+    read_values = d_values.make_reader(first_values)
+    write_out = d_out.make_writer(first_out)
+
+    if lower:
+
+        def goes_right(slots, mid, value):
+            return comp(read_data(slots, mid), value)
+
+    else:
+
+        def goes_right(slots, mid, value):
+            return not comp(value, read_data(slots, mid))
+
+    goes_right = _codegen.jit(goes_right)
+
+    def search_chunk(slots, chunk, begin, end):
+        num_items = i64(slots[num_items_slot])
+        for v in range(begin, end):
+            value = read_values(slots, v)
+            first = i64(0)
+            last = num_items
+            while first < last:
+                mid = first + (last - first) // 2
+                if goes_right(slots, mid, value):
+                    first = mid + 1
+                else:
+                    last = mid
+            write_out(slots, v, first)
+
+    return _codegen.chunk_kernel(search_chunk)
+
+
+class _BinarySearch:
+    __slots__ = ["kernel"]
+
+    def __init__(self, d_data, d_values, d_out, comp, lower: bool):
+        d_data, d_values, d_out = (
+            to_iterator(d_data),
+            to_iterator(d_values),
+            to_iterator(d_out),
+        )
+        comp = OpKind.LESS if comp is None else comp
+        key = (
+            "binary_search",
+            lower,
+            d_data.kind,
+            d_values.kind,
+            d_out.kind,
+            op_key(comp),
+        )
+        self.kernel = _cached(
+            key,
+            lambda: _build_binary_search(
+                d_data, d_values, d_out, compile_op(comp), lower
+            ),
+        )
+
+    def __call__(
+        self,
+        *,
+        d_data,
+        num_items: int,
+        d_values,
+        num_values: int,
+        d_out,
+        comp,
+        stream=None,
+    ):
+        slots, _owners = _slots(
+            [to_iterator(d_data), to_iterator(d_values), to_iterator(d_out)],
+            [num_items],
+        )
+        _run(self.kernel, slots, num_values)
+
+
+def make_lower_bound(*, d_data, d_values, d_out, comp=None):
+    """Host counterpart of :func:`cuda.compute.algorithms.make_lower_bound`."""
+    return _BinarySearch(d_data, d_values, d_out, comp, True)
+
+
+def make_upper_bound(*, d_data, d_values, d_out, comp=None):
+    """Host counterpart of :func:`cuda.compute.algorithms.make_upper_bound`."""
+    return _BinarySearch(d_data, d_values, d_out, comp, False)
+
+
+def lower_bound(
+    *, d_data, num_items: int, d_values, num_values: int, d_out, comp=None, stream=None
+):
+    """Host counterpart of :func:`cuda.compute.algorithms.lower_bound`."""
+    make_lower_bound(d_data=d_data, d_values=d_values, d_out=d_out, comp=comp)(
+        d_data=d_data,
+        num_items=num_items,
+        d_values=d_values,
+        num_values=num_values,
+        d_out=d_out,
+        comp=comp,
+    )
+
+
+def upper_bound(
+    *, d_data, num_items: int, d_values, num_values: int, d_out, comp=None, stream=None
+):
+    """Host counterpart of :func:`cuda.compute.algorithms.upper_bound`."""
+    make_upper_bound(d_data=d_data, d_values=d_values, d_out=d_out, comp=comp)(
+        d_data=d_data,
+        num_items=num_items,
+        d_values=d_values,
+        num_values=num_values,
+        d_out=d_out,
+        comp=comp,
+    )
+
+
+# ---------------------------------------------------------------------------
+# merge_sort, radix_sort
+# ---------------------------------------------------------------------------
+
+
+class SortOrder(Enum):
+    ASCENDING = 0
+    DESCENDING = 1
+
+
+class DoubleBuffer:
+    def __init__(self, d_current, d_alternate):
+        self.d_buffers = [d_current, d_alternate]
+        self.selector = 0
+
+    def current(self):
+        return self.d_buffers[self.selector]
+
+    def alternate(self):
+        return self.d_buffers[1 - self.selector]
+
+
+class _NoIterator(IteratorBase):
+    """Takes the place of absent values in slot layouts."""
+
+    kind = None
+
+
+def _build_gather(d_in_keys, d_in_values, d_out_keys, d_out_values):
+    keys, keys_out = to_iterator(d_in_keys), to_iterator(d_out_keys)
+    values = _NoIterator() if d_in_values is None else to_iterator(d_in_values)
+    values_out = _NoIterator() if d_out_values is None else to_iterator(d_out_values)
+    indices = PointerIterator(np.empty(0, np.int64))
+
+    first_keys, first_values, first_indices, first_keys_out, first_values_out, _ = (
+        _first_slots([keys, values, indices, keys_out, values_out])
+    )
+    read_keys = keys.make_reader(first_keys)
+    read_index = indices.make_reader(first_indices)
+    write_keys = keys_out.make_writer(first_keys_out)
+
+    if d_in_values is None:
+
+        def gather_chunk(slots, chunk, begin, end):
+            for i in range(begin, end):
+                write_keys(slots, i, read_keys(slots, read_index(slots, i)))
+
+    else:
+        read_values = values.make_reader(first_values)
+        write_values = values_out.make_writer(first_values_out)
+
+        def gather_chunk(slots, chunk, begin, end):
+            for i in range(begin, end):
+                j = read_index(slots, i)
+                write_keys(slots, i, read_keys(slots, j))
+                write_values(slots, i, read_values(slots, j))
+
+    return _codegen.chunk_kernel(gather_chunk)
+
+
+def _gather_key(d_in_keys, d_in_values, d_out_keys, d_out_values):
+    kinds = [to_iterator(d_in_keys).kind, to_iterator(d_out_keys).kind]
+    if d_in_values is not None:
+        kinds += [to_iterator(d_in_values).kind, to_iterator(d_out_values).kind]
+    return ("gather", *kinds)
+
+
+def _unaliased(d_in, d_out):
+    """An iterator over ``d_in``, copied first if its array overlaps ``d_out``."""
+    d_in = to_iterator(d_in)
+    if isinstance(d_in, PointerIterator) and d_out is not None:
+        if np.may_share_memory(d_in.array, np.asarray(d_out)):
+            return PointerIterator(d_in.array.copy())
+    return d_in
+
+
+def _sort(
+    less,
+    gather,
+    d_in_keys,
+    d_in_values,
+    d_out_keys,
+    d_out_values,
+    num_items,
+    scalars=(),
+):
+    """Sorts the indices of the keys by ``less``, then gathers the keys and values in that order."""
+    if num_items <= 0:
+        return
+    keys = _unaliased(d_in_keys, d_out_keys)
+    values = (
+        _NoIterator() if d_in_values is None else _unaliased(d_in_values, d_out_values)
+    )
+    keys_out = to_iterator(d_out_keys)
+    values_out = _NoIterator() if d_out_values is None else to_iterator(d_out_values)
+
+    indices = np.empty(num_items, np.int64)
+    slots, _owners = _slots([keys], scalars)
+    _shim.stable_sort_indices(
+        slots.ctypes.data, indices.ctypes.data, num_items, less.address
+    )
+
+    slots, _owners = _slots(
+        [keys, values, PointerIterator(indices), keys_out, values_out]
+    )
+    _run(gather, slots, num_items)
+
+
+def _build_merge_sort_less(keys, op):
+    read_keys = keys.make_reader(0)
+
+    def less(slots, lhs, rhs):
+        return 1 if op(read_keys(slots, lhs), read_keys(slots, rhs)) else 0
+
+    return _codegen.less_function(less)
+
+
+class _MergeSort:
+    __slots__ = ["gather", "less"]
+
+    def __init__(self, d_in_keys, d_in_values, d_out_keys, d_out_values, op):
+        keys = to_iterator(d_in_keys)
+        self.less = _cached(
+            ("merge_sort_less", keys.kind, op_key(op)),
+            lambda: _build_merge_sort_less(keys, compile_op(op)),
+        )
+        self.gather = _cached(
+            _gather_key(d_in_keys, d_in_values, d_out_keys, d_out_values),
+            lambda: _build_gather(d_in_keys, d_in_values, d_out_keys, d_out_values),
+        )
+
+    def __call__(
+        self,
+        *,
+        temp_storage,
+        d_in_keys,
+        d_in_values,
+        d_out_keys,
+        d_out_values,
+        num_items: int,
+        op,
+        stream=None,
+    ):
+        assert (d_in_values is None) == (d_out_values is None)
+        if temp_storage is None:
+            return 0
+        _sort(
+            self.less,
+            self.gather,
+            d_in_keys,
+            d_in_values,
+            d_out_keys,
+            d_out_values,
+            num_items,
+        )
+        return 0
+
+
+def make_merge_sort(*, d_in_keys, d_in_values=None, d_out_keys, d_out_values=None, op):
+    """Host counterpart of :func:`cuda.compute.algorithms.make_merge_sort`."""
+    return _MergeSort(d_in_keys, d_in_values, d_out_keys, d_out_values, op)
+
+
+def merge_sort(
+    *,
+    d_in_keys,
+    d_in_values=None,
+    d_out_keys,
+    d_out_values=None,
+    num_items: int,
+    op,
+    stream=None,
+):
+    """Host counterpart of :func:`cuda.compute.algorithms.merge_sort`."""
+    sorter = make_merge_sort(
+        d_in_keys=d_in_keys,
+        d_in_values=d_in_values,
+        d_out_keys=d_out_keys,
+        d_out_values=d_out_values,
+        op=op,
+    )
+    _run_with_temp_storage(
+        sorter,
+        d_in_keys=d_in_keys,
+        d_in_values=d_in_values,
+        d_out_keys=d_out_keys,
+        d_out_values=d_out_values,
+        num_items=num_items,
+        op=op,
+    )
+
+
+def _build_radix_sort_less(keys, order):
+    """Orders keys by the bits a radix sort would see, restricted to [begin_bit, end_bit)."""
+    dtype = keys.value_dtype
+    if dtype.names is not None or dtype.kind not in "biuf":
+        raise TypeError(f"radix_sort does not support keys of dtype {dtype}")
+
+    read_keys = keys.make_reader(0)
+    bits = _codegen.bitcast_to_unsigned(_codegen.scalar_type(dtype))
+    width = 8 * dtype.itemsize
+    sign = np.uint64(1 << (width - 1))
+    full = np.uint64((1 << width) - 1)
+    shift_slot = keys.num_slots
+
+    if dtype.kind == "f":
+        # -0.0 sorts as +0.0; negative values sort in the reverse order of their bits
+        def ordered_bits(key):
+            value = u64(bits(key)) if key != 0 else u64(0)
+            return (~value & full) if (value & sign) != 0 else (value | sign)
+
+    elif dtype.kind == "i":
+
+        def ordered_bits(key):
+            return u64(bits(key)) ^ sign
+
+    else:
+
+        def ordered_bits(key):
+            return u64(bits(key))
+
+    ordered_bits = _codegen.jit(ordered_bits)
+
+    def digits(slots, i):
+        return (ordered_bits(read_keys(slots, i)) >> slots[shift_slot]) & slots[
+            shift_slot + 1
+        ]
+
+    digits = _codegen.jit(digits)
+
+    if order is SortOrder.ASCENDING:
+
+        def less(slots, lhs, rhs):
+            return 1 if digits(slots, lhs) < digits(slots, rhs) else 0
+
+    else:
+
+        def less(slots, lhs, rhs):
+            return 1 if digits(slots, rhs) < digits(slots, lhs) else 0
+
+    return _codegen.less_function(less)
+
+
+def _radix_sort_arrays(d_in_keys, d_out_keys, d_in_values, d_out_values):
+    if isinstance(d_in_keys, DoubleBuffer):
+        d_in_keys, d_out_keys = d_in_keys.current(), d_in_keys.alternate()
+        if d_in_values is not None:
+            assert isinstance(d_in_values, DoubleBuffer)
+            d_in_values, d_out_values = d_in_values.current(), d_in_values.alternate()
+    return d_in_keys, d_out_keys, d_in_values, d_out_values
+
+
+class _RadixSort:
+    __slots__ = ["gather", "less", "width"]
+
+    def __init__(
+        self, d_in_keys, d_out_keys, d_in_values, d_out_values, order: SortOrder
+    ):
+        arrays = _radix_sort_arrays(d_in_keys, d_out_keys, d_in_values, d_out_values)
+        keys = to_iterator(arrays[0])
+        self.width = 8 * keys.value_dtype.itemsize
+        self.less = _cached(
+            ("radix_sort_less", keys.kind, order),
+            lambda: _build_radix_sort_less(keys, order),
+        )
+        self.gather = _cached(
+            _gather_key(arrays[0], arrays[2], arrays[1], arrays[3]),
+            lambda: _build_gather(arrays[0], arrays[2], arrays[1], arrays[3]),
+        )
+
+    def __call__(
+        self,
+        *,
+        temp_storage,
+        d_in_keys,
+        d_out_keys,
+        d_in_values,
+        d_out_values,
+        num_items: int,
+        begin_bit: int | None = None,
+        end_bit: int | None = None,
+        stream=None,
+    ):
+        if temp_storage is None:
+            return 0
+
+        begin_bit = 0 if begin_bit is None else begin_bit
+        end_bit = self.width if end_bit is None else end_bit
+        if not 0 <= begin_bit <= end_bit <= self.width:
+            raise ValueError(f"Invalid bit range [{begin_bit}, {end_bit})")
+        mask = (1 << (end_bit - begin_bit)) - 1
+
+        keys, keys_out, values, values_out = _radix_sort_arrays(
+            d_in_keys, d_out_keys, d_in_values, d_out_values
+        )
+        _sort(
+            self.less,
+            self.gather,
+            keys,
+            values,
+            keys_out,
+            values_out,
+            num_items,
+            [begin_bit, mask],
+        )
+
+        if isinstance(d_in_keys, DoubleBuffer):
+            d_in_keys.selector = 1 - d_in_keys.selector
+            if d_in_values is not None:
+                d_in_values.selector = 1 - d_in_values.selector
+        return 0
+
+
+def make_radix_sort(
+    *, d_in_keys, d_out_keys, d_in_values=None, d_out_values=None, order: SortOrder
+):
+    """Host counterpart of :func:`cuda.compute.algorithms.make_radix_sort`."""
+    return _RadixSort(d_in_keys, d_out_keys, d_in_values, d_out_values, order)
+
+
+def radix_sort(
+    *,
+    d_in_keys,
+    d_out_keys,
+    d_in_values=None,
+    d_out_values=None,
+    num_items: int,
+    order: SortOrder,
+    begin_bit: int | None = None,
+    end_bit: int | None = None,
+    stream=None,
+):
+    """Host counterpart of :func:`cuda.compute.algorithms.radix_sort`."""
+    sorter = make_radix_sort(
+        d_in_keys=d_in_keys,
+        d_out_keys=d_out_keys,
+        d_in_values=d_in_values,
+        d_out_values=d_out_values,
+        order=order,
+    )
+    _run_with_temp_storage(
+        sorter,
+        d_in_keys=d_in_keys,
+        d_out_keys=d_out_keys,
+        d_in_values=d_in_values,
+        d_out_values=d_out_values,
+        num_items=num_items,
+        begin_bit=begin_bit,
+        end_bit=end_bit,
+    )
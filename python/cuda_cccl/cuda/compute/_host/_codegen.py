@@ -0,0 +1,267 @@
+# Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. ALL RIGHTS RESERVED.
+#
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+"""
+Numba CPU building blocks of the host iterators and algorithms.
+
+Iterators are compiled into ``read(slots, i)`` and ``write(slots, i, value)``
+functions. ``slots`` is a ``uint64`` array holding the address and the stride
+in bytes of each NumPy buffer the iterators access, followed by the scalar
+arguments of the algorithm. Since the buffers are only known through their
+slots, the same compiled code serves any buffers of the same dtypes, and the
+buffers themselves are never copied.
+
+Structured dtypes are read and written as (nested) tuples of their fields.
+"""
+
+from __future__ import annotations
+
+import functools
+
+import numba
+import numpy as np
+from llvmlite import ir
+from numba import types
+from numba.extending import intrinsic
+from numba.np.numpy_support import as_dtype, from_dtype
+
+SLOTS_PER_BUFFER = 2
+
+SLOTS = types.CPointer(types.uint64)
+CHUNK_KERNEL_SIGNATURE = types.void(SLOTS, types.int64, types.int64, types.int64)
+LESS_SIGNATURE = types.int32(SLOTS, types.int64, types.int64)
+
+
+def jit(fn):
+    """Compile a device-side helper for the CPU; integer division by zero does not raise."""
+    return numba.njit(fn, error_model="numpy")
+
+
+def chunk_kernel(fn):
+    """Compile ``fn(slots, chunk, begin, end)`` into a C callback for the shim."""
+    return numba.cfunc(CHUNK_KERNEL_SIGNATURE, error_model="numpy")(fn)
+
+
+def less_function(fn):
+    """Compile ``fn(slots, lhs, rhs)`` into a C comparator for the shim."""
+    return numba.cfunc(LESS_SIGNATURE, error_model="numpy")(fn)
+
+
+@jit
+def u64(i):
+    return types.uint64(i)
+
+
+@jit
+def i64(i):
+    return types.int64(i)
+
+
+def scalar_type(dtype: np.dtype) -> types.Type:
+    if dtype.kind == "f" and dtype.itemsize == 2:
+        raise TypeError("float16 is not supported by the host backend")
+    if dtype.subdtype is not None:
+        raise TypeError(f"Sub-array dtype {dtype} is not supported by the host backend")
+    return from_dtype(dtype)
+
+
+def value_type(dtype: np.dtype) -> types.Type:
+    """The Numba type of the values of ``dtype``; tuples for structured dtypes."""
+    if dtype.names is None:
+        return scalar_type(dtype)
+    return types.Tuple([value_type(dtype.fields[name][0]) for name in dtype.names])
+
+
+def dtype_of(nbtype: types.Type) -> np.dtype | None:
+    """The dtype storing values of ``nbtype``, or None if there is none."""
+    if isinstance(nbtype, types.BaseTuple):
+        fields = [dtype_of(t) for t in nbtype]
+        if any(f is None for f in fields):
+            return None
+        return np.dtype([(f"f{k}", f) for k, f in enumerate(fields)])
+    try:
+        return as_dtype(nbtype)
+    except (NotImplementedError, numba.core.errors.NumbaNotImplementedError):
+        return None
+
+
+@functools.cache
+def _load(nbtype: types.Type, align: int | None):
+    @intrinsic
+    def load(typingctx, address):
+        if not isinstance(address, types.Integer):
+            return None
+
+        def codegen(context, builder, signature, args):
+            address = context.cast(builder, args[0], signature.args[0], types.uint64)
+            pointer = builder.inttoptr(
+                address, context.get_data_type(nbtype).as_pointer()
+            )
+            return context.unpack_value(builder, nbtype, pointer, align=align)
+
+        return nbtype(address), codegen
+
+    return load
+
+
+@functools.cache
+def _store(nbtype: types.Type, align: int | None):
+    @intrinsic
+    def store(typingctx, address, value):
+        if not isinstance(address, types.Integer):
+            return None
+
+        def codegen(context, builder, signature, args):
+            address = context.cast(builder, args[0], signature.args[0], types.uint64)
+            pointer = builder.inttoptr(
+                address, context.get_data_type(nbtype).as_pointer()
+            )
+            value = context.cast(builder, args[1], signature.args[1], nbtype)
+            context.pack_value(builder, nbtype, value, pointer, align=align)
+            return context.get_dummy_value()
+
+        return types.none(address, value), codegen
+
+    return store
+
+
+@functools.cache
+def bitcast_to_unsigned(nbtype: types.Type):
+    """An intrinsic reinterpreting the bits of a scalar as an unsigned integer of the same width."""
+    width = nbtype.bitwidth
+    result = types.Integer.from_bitwidth(width, signed=False)
+
+    @intrinsic
+    def bitcast(typingctx, value):
+        def codegen(context, builder, signature, args):
+            value = context.cast(builder, args[0], signature.args[0], nbtype)
+            if isinstance(nbtype, types.Boolean):
+                return builder.zext(value, ir.IntType(width))
+            return builder.bitcast(value, ir.IntType(width))
+
+        return result(value), codegen
+
+    return bitcast
+
+
+def _fields(dtype: np.dtype, offset: int = 0):
+    """The (offset, dtype) of the scalar fields of ``dtype``, nested as its fields are."""
+    if dtype.names is None:
+        scalar_type(dtype)
+        return (offset, dtype)
+    return [
+        _fields(dtype.fields[name][0], offset + dtype.fields[name][1])
+        for name in dtype.names
+    ]
+
+
+def _compile(name: str, source: str, namespace: dict):
+    exec(source, namespace)
+    return jit(namespace[name])
+
+
+def make_array_reader(dtype: np.dtype, slot: int):
+    """``read(slots, i)`` loading element ``i`` of the buffer of ``slot``."""
+    if dtype.names is None:
+        load = _load(scalar_type(dtype), None)
+
+        def read(slots, i):
+            return load(slots[slot] + u64(i) * slots[slot + 1])
+
+        return jit(read)
+
+    namespace = {"u64": u64}
+
+    def expression(fields):
+        if isinstance(fields, tuple):
+            offset, field_dtype = fields
+            load = f"load_{len(namespace)}"
+            namespace[load] = _load(scalar_type(field_dtype), 1)
+            return f"{load}(base + u64({offset}))"
+        return "(" + "".join(f"{expression(f)}, " for f in fields) + ")"
+
+    body = expression(_fields(dtype))
+    source = (
+        "def read(slots, i):\n"
+        f"    base = slots[{slot}] + u64(i) * slots[{slot + 1}]\n"
+        f"    return {body}\n"
+    )
+    return _compile("read", source, namespace)
+
+
+def make_array_writer(dtype: np.dtype, slot: int):
+    """``write(slots, i, value)`` storing ``value`` to element ``i`` of the buffer of ``slot``."""
+    if dtype.names is None:
+        store = _store(scalar_type(dtype), None)
+
+        def write(slots, i, value):
+            store(slots[slot] + u64(i) * slots[slot + 1], value)
+
+        return jit(write)
+
+    namespace = {"u64": u64}
+    lines = []
+
+    def statements(fields, value):
+        if isinstance(fields, tuple):
+            offset, field_dtype = fields
+            store = f"store_{len(namespace)}"
+            namespace[store] = _store(scalar_type(field_dtype), 1)
+            lines.append(f"    {store}(base + u64({offset}), {value})\n")
+            return
+        for k, f in enumerate(fields):
+            statements(f, f"{value}[{k}]")
+
+    statements(_fields(dtype), "value")
+    source = (
+        "def write(slots, i, value):\n"
+        f"    base = slots[{slot}] + u64(i) * slots[{slot + 1}]\n" + "".join(lines)
+    )
+    return _compile("write", source, namespace)
+
+
+def make_caster(dtype: np.dtype):
+    """``cast(value)`` converting a value to the type of ``dtype``, field by field for structs."""
+    if dtype.names is None:
+        nbtype = scalar_type(dtype)
+
+        def cast(value):
+            return nbtype(value)
+
+        return jit(cast)
+
+    namespace: dict = {}
+
+    def expression(dtype, value):
+        if dtype.names is None:
+            name = f"type_{len(namespace)}"
+            namespace[name] = scalar_type(dtype)
+            return f"{name}({value})"
+        return (
+            "("
+            + "".join(
+                f"{expression(dtype.fields[n][0], f'{value}[{k}]')}, "
+                for k, n in enumerate(dtype.names)
+            )
+            + ")"
+        )
+
+    source = f"def cast(value):\n    return {expression(dtype, 'value')}\n"
+    return _compile("cast", source, namespace)
+
+
+def make_tuple_reader(readers):
+    """``read(slots, i)`` returning the tuple of the values of ``readers``."""
+    namespace = {f"read_{k}": r for k, r in enumerate(readers)}
+    body = "".join(f"read_{k}(slots, i), " for k in range(len(readers)))
+    return _compile("read", f"def read(slots, i):\n    return ({body})\n", namespace)
+
+
+def make_tuple_writer(writers):
+    """``write(slots, i, value)`` passing each element of the tuple ``value`` to its writer."""
+    namespace = {f"write_{k}": w for k, w in enumerate(writers)}
+    body = "".join(
+        f"    write_{k}(slots, i, value[{k}])\n" for k in range(len(writers))
+    )
+    return _compile("write", f"def write(slots, i, value):\n{body}", namespace)
@@ -0,0 +1,421 @@
+# Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. ALL RIGHTS RESERVED.
+#
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+"""
+Iterators of the host backend. They compose like their device counterparts in
+``cuda.compute.iterators``, and compile into the ``read``/``write`` functions
+of ``_codegen`` instead of LTO-IR.
+
+Each iterator describes:
+
+- ``kind``: a hashable description of its structure, on which the compiled
+  kernels are keyed;
+- ``buffers()``: the ``(owner, address, stride)`` of the NumPy buffers it
+  accesses, which fill its slots at call time;
+- ``make_reader(slot)``/``make_writer(slot)``: its compiled accessors, given
+  the first of its slots.
+
+State such as the start of a ``CountingIterator`` lives in a buffer, so that
+iterators differing only by state share their kernels.
+"""
+
+from __future__ import annotations
+
+import numpy as np
+from numba import types
+
+from . import _codegen, _ops
+from ._codegen import SLOTS_PER_BUFFER, i64, jit, u64
+
+
+class IteratorBase:
+    value_dtype: np.dtype | None = None
+
+    @property
+    def kind(self):
+        raise NotImplementedError
+
+    @property
+    def value_type(self) -> types.Type:
+        if self.value_dtype is None:
+            raise TypeError(f"The value type of {type(self).__name__} is unknown")
+        return _codegen.value_type(self.value_dtype)
+
+    def buffers(self) -> list:
+        return []
+
+    @property
+    def num_slots(self) -> int:
+        return SLOTS_PER_BUFFER * len(self.buffers())
+
+    def make_reader(self, slot: int):
+        raise TypeError(f"{type(self).__name__} cannot be read from")
+
+    def make_writer(self, slot: int):
+        raise TypeError(f"{type(self).__name__} cannot be written to")
+
+    def __add__(self, offset: int):
+        raise NotImplementedError(f"{type(self).__name__} does not support advancing")
+
+
+def _state_buffer(state: np.ndarray):
+    # Every element of a state iterator reads the same value
+    return (state, state.__array_interface__["data"][0], 0)
+
+
+class PointerIterator(IteratorBase):
+    """Iterates over a 1-D NumPy array (or any object exposing the array interface) in place."""
+
+    def __init__(self, array, offset: int = 0):
+        array = np.asarray(array)
+        if array.ndim != 1:
+            if not array.flags.c_contiguous:
+                raise ValueError(
+                    "Arrays with more than one dimension must be contiguous"
+                )
+            array = array.reshape(-1)
+        self._array = array
+        self._offset = offset
+        self.value_dtype = array.dtype
+
+    @property
+    def array(self) -> np.ndarray:
+        return self._array
+
+    @property
+    def kind(self):
+        return ("pointer", self.value_dtype)
+
+    def buffers(self):
+        # Like a pointer, the iterator may be advanced past either end of the array
+        stride = self._array.strides[0]
+        address = self._array.__array_interface__["data"][0] + self._offset * stride
+        return [(self._array, address, stride)]
+
+    def make_reader(self, slot):
+        return _codegen.make_array_reader(self.value_dtype, slot)
+
+    def make_writer(self, slot):
+        if not self._array.flags.writeable:
+            raise ValueError("Cannot write to a read-only array")
+        return _codegen.make_array_writer(self.value_dtype, slot)
+
+    def __add__(self, offset: int):
+        return PointerIterator(self._array, self._offset + offset)
+
+
+def to_iterator(array_or_iterator) -> IteratorBase:
+    if isinstance(array_or_iterator, IteratorBase):
+        return array_or_iterator
+    return PointerIterator(array_or_iterator)
+
+
+def _state(value) -> np.ndarray:
+    if not isinstance(value, np.generic):
+        value = np.array(value).flatten()[0]
+    return np.array([value])
+
+
+class CountingIterator(IteratorBase):
+    """Iterates over ``start``, ``start + 1``, ... in the dtype of ``start``."""
+
+    def __init__(self, start: np.number):
+        self._state = _state(start)
+        self.value_dtype = self._state.dtype
+
+    @property
+    def kind(self):
+        return ("counting", self.value_dtype)
+
+    def buffers(self):
+        return [_state_buffer(self._state)]
+
+    def make_reader(self, slot):
+        nbtype = _codegen.scalar_type(self.value_dtype)
+        load = _codegen.make_array_reader(self.value_dtype, slot)
+
+        if isinstance(nbtype, types.Integer):
+            # Wraps around like the C++ counterpart
+            def read(slots, i):
+                return nbtype(u64(load(slots, 0)) + u64(i))
+
+        else:
+
+            def read(slots, i):
+                return nbtype(load(slots, 0) + i)
+
+        return jit(read)
+
+    def __add__(self, offset: int):
+        return CountingIterator(self._state[0] + self.value_dtype.type(offset))
+
+
+class ConstantIterator(IteratorBase):
+    """Iterates over a sequence of ``value``."""
+
+    def __init__(self, value: np.number):
+        self._state = _state(value)
+        self.value_dtype = self._state.dtype
+
+    @property
+    def kind(self):
+        return ("constant", self.value_dtype)
+
+    def buffers(self):
+        return [_state_buffer(self._state)]
+
+    def make_reader(self, slot):
+        return _codegen.make_array_reader(self.value_dtype, slot)
+
+    def __add__(self, offset: int):
+        return self
+
+
+class CacheModifiedInputIterator(PointerIterator):
+    """Iterates over an array; the load ``modifier`` only applies to devices."""
+
+    def __init__(self, device_array, modifier: str):
+        if modifier != "stream":
+            raise NotImplementedError("Only 'stream' modifier is supported")
+        super().__init__(device_array)
+
+
+class DiscardIterator(IteratorBase):
+    """Discards the values written to it."""
+
+    def __init__(self, reference_iterator=None):
+        if reference_iterator is not None:
+            self.value_dtype = to_iterator(reference_iterator).value_dtype
+
+    @property
+    def kind(self):
+        return ("discard",)
+
+    def make_writer(self, slot):
+        def write(slots, i, value):
+            pass
+
+        return jit(write)
+
+    def __add__(self, offset: int):
+        return self
+
+
+class TransformIterator(IteratorBase):
+    """Applies the unary ``transform_op`` to the values read from ``underlying``."""
+
+    def __init__(
+        self, underlying, transform_op, value_type=None, is_input: bool = True
+    ):
+        self._underlying = to_iterator(underlying)
+        self._op = transform_op
+        self._is_input = is_input
+
+        if not is_input:
+            self.value_dtype = None if value_type is None else np.dtype(value_type)
+            self._value_type = None
+        elif value_type is not None:
+            self.value_dtype = np.dtype(value_type)
+            self._value_type = _codegen.value_type(self.value_dtype)
+        else:
+            self._value_type = _ops.return_type(
+                transform_op, (self._underlying.value_type,)
+            )
+            self.value_dtype = _codegen.dtype_of(self._value_type)
+
+    @property
+    def kind(self):
+        return (
+            "transform",
+            self._is_input,
+            self._underlying.kind,
+            _ops.op_key(self._op),
+            self.value_dtype,
+        )
+
+    @property
+    def value_type(self) -> types.Type:
+        if self._value_type is not None:
+            return self._value_type
+        return super().value_type
+
+    def buffers(self):
+        return self._underlying.buffers()
+
+    def make_reader(self, slot):
+        if not self._is_input:
+            return super().make_reader(slot)
+        read_underlying = self._underlying.make_reader(slot)
+        op = _ops.compile_op(self._op)
+
+        if self.value_dtype is None:
+
+            def read(slots, i):
+                return op(read_underlying(slots, i))
+
+        else:
+            cast = _codegen.make_caster(self.value_dtype)
+
+            def read(slots, i):
+                return cast(op(read_underlying(slots, i)))
+
+        return jit(read)
+
+    def make_writer(self, slot):
+        if self._is_input:
+            return super().make_writer(slot)
+        write_underlying = self._underlying.make_writer(slot)
+        op = _ops.compile_op(self._op)
+
+        def write(slots, i, value):
+            write_underlying(slots, i, op(value))
+
+        return jit(write)
+
+    def __add__(self, offset: int):
+        result = TransformIterator.__new__(type(self))
+        result.__dict__.update(self.__dict__)
+        result._underlying = self._underlying + offset
+        return result
+
+
+class TransformOutputIterator(TransformIterator):
+    """Applies the unary ``transform_op`` to the values written to ``underlying``."""
+
+    def __init__(self, underlying, transform_op, output_value_type=None):
+        super().__init__(underlying, transform_op, output_value_type, is_input=False)
+
+
+class ZipIterator(IteratorBase):
+    """Iterates over tuples of the values of several iterators or arrays."""
+
+    def __init__(self, *args):
+        if len(args) == 1 and isinstance(args[0], (list, tuple)):
+            iterators = args[0]
+        else:
+            iterators = args
+        if len(iterators) < 1:
+            raise ValueError("ZipIterator requires at least one iterator")
+
+        self._iterators = [to_iterator(it) for it in iterators]
+        dtypes = [it.value_dtype for it in self._iterators]
+        if all(dtype is not None for dtype in dtypes):
+            self.value_dtype = np.dtype(
+                [(f"f{k}", dtype) for k, dtype in enumerate(dtypes)]
+            )
+
+    @property
+    def kind(self):
+        return ("zip", tuple(it.kind for it in self._iterators))
+
+    @property
+    def value_type(self) -> types.Type:
+        return types.Tuple([it.value_type for it in self._iterators])
+
+    def buffers(self):
+        return [buffer for it in self._iterators for buffer in it.buffers()]
+
+    def _slots(self, slot):
+        for it in self._iterators:
+            yield it, slot
+            slot += it.num_slots
+
+    def make_reader(self, slot):
+        return _codegen.make_tuple_reader(
+            [it.make_reader(s) for it, s in self._slots(slot)]
+        )
+
+    def make_writer(self, slot):
+        return _codegen.make_tuple_writer(
+            [it.make_writer(s) for it, s in self._slots(slot)]
+        )
+
+    def __add__(self, offset: int):
+        return ZipIterator([it + offset for it in self._iterators])
+
+
+class PermutationIterator(IteratorBase):
+    """Iterates over ``values[indices[0]]``, ``values[indices[1]]``, ..."""
+
+    def __init__(self, values, indices):
+        self._values = to_iterator(values)
+        self._indices = to_iterator(indices)
+        self.value_dtype = self._values.value_dtype
+
+    @property
+    def kind(self):
+        return ("permutation", self._values.kind, self._indices.kind)
+
+    @property
+    def value_type(self) -> types.Type:
+        return self._values.value_type
+
+    def buffers(self):
+        return self._values.buffers() + self._indices.buffers()
+
+    def make_reader(self, slot):
+        read_values = self._values.make_reader(slot)
+        read_indices = self._indices.make_reader(slot + self._values.num_slots)
+
+        def read(slots, i):
+            return read_values(slots, i64(read_indices(slots, i)))
+
+        return jit(read)
+
+    def make_writer(self, slot):
+        write_values = self._values.make_writer(slot)
+        read_indices = self._indices.make_reader(slot + self._values.num_slots)
+
+        def write(slots, i, value):
+            write_values(slots, i64(read_indices(slots, i)), value)
+
+        return jit(write)
+
+    def __add__(self, offset: int):
+        return PermutationIterator(self._values, self._indices + offset)
+
+
+class ReverseIterator(IteratorBase):
+    """Iterates backwards; over an array, it starts at the last element."""
+
+    def __init__(self, underlying):
+        if isinstance(underlying, IteratorBase):
+            self._underlying = underlying
+        else:
+            array = PointerIterator(underlying)
+            self._underlying = array + (len(array.array) - 1)
+        self.value_dtype = self._underlying.value_dtype
+
+    @property
+    def kind(self):
+        return ("reverse", self._underlying.kind)
+
+    @property
+    def value_type(self) -> types.Type:
+        return self._underlying.value_type
+
+    def buffers(self):
+        return self._underlying.buffers()
+
+    def make_reader(self, slot):
+        read_underlying = self._underlying.make_reader(slot)
+
+        def read(slots, i):
+            return read_underlying(slots, -i64(i))
+
+        return jit(read)
+
+    def make_writer(self, slot):
+        write_underlying = self._underlying.make_writer(slot)
+
+        def write(slots, i, value):
+            write_underlying(slots, -i64(i), value)
+
+        return jit(write)
+
+    def __add__(self, offset: int):
+        result = ReverseIterator.__new__(ReverseIterator)
+        result._underlying = self._underlying + (-offset)
+        result.value_dtype = self.value_dtype
+        return result
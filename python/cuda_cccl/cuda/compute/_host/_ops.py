@@ -0,0 +1,164 @@
+# Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. ALL RIGHTS RESERVED.
+#
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+"""
+Operators of the host backend: the well-known ``OpKind`` operations, with the
+semantics of their C++ counterparts, and user callables compiled by Numba's CPU
+target.
+"""
+
+from __future__ import annotations
+
+import math
+from enum import IntEnum
+
+import numba
+from numba import types
+from numba.extending import overload
+
+from ._codegen import jit
+
+
+class OpKind(IntEnum):
+    STATELESS = 0
+    STATEFUL = 1
+    PLUS = 2
+    MINUS = 3
+    MULTIPLIES = 4
+    DIVIDES = 5
+    MODULUS = 6
+    EQUAL_TO = 7
+    NOT_EQUAL_TO = 8
+    GREATER = 9
+    LESS = 10
+    GREATER_EQUAL = 11
+    LESS_EQUAL = 12
+    LOGICAL_AND = 13
+    LOGICAL_OR = 14
+    LOGICAL_NOT = 15
+    BIT_AND = 16
+    BIT_OR = 17
+    BIT_XOR = 18
+    BIT_NOT = 19
+    IDENTITY = 20
+    NEGATE = 21
+    MINIMUM = 22
+    MAXIMUM = 23
+
+
+def _divides(lhs, rhs):
+    return lhs / rhs
+
+
+def _modulus(lhs, rhs):
+    return lhs % rhs
+
+
+# Integer division and modulus truncate towards zero in C++, where Python rounds
+# towards negative infinity
+@overload(_divides)
+def _divides_impl(lhs, rhs):
+    if isinstance(lhs, types.Integer) and isinstance(rhs, types.Integer):
+
+        def impl(lhs, rhs):
+            quotient = lhs // rhs
+            if (lhs % rhs != 0) and ((lhs < 0) != (rhs < 0)):
+                quotient += 1
+            return quotient
+
+        return impl
+    return lambda lhs, rhs: lhs / rhs
+
+
+@overload(_modulus)
+def _modulus_impl(lhs, rhs):
+    if isinstance(lhs, types.Integer) and isinstance(rhs, types.Integer):
+
+        def impl(lhs, rhs):
+            remainder = lhs % rhs
+            if remainder != 0 and ((remainder < 0) != (lhs < 0)):
+                remainder -= rhs
+            return remainder
+
+        return impl
+    return lambda lhs, rhs: math.fmod(lhs, rhs)
+
+
+_WELL_KNOWN_OPS = {
+    OpKind.PLUS: lambda lhs, rhs: lhs + rhs,
+    OpKind.MINUS: lambda lhs, rhs: lhs - rhs,
+    OpKind.MULTIPLIES: lambda lhs, rhs: lhs * rhs,
+    OpKind.DIVIDES: lambda lhs, rhs: _divides(lhs, rhs),
+    OpKind.MODULUS: lambda lhs, rhs: _modulus(lhs, rhs),
+    OpKind.EQUAL_TO: lambda lhs, rhs: lhs == rhs,
+    OpKind.NOT_EQUAL_TO: lambda lhs, rhs: lhs != rhs,
+    OpKind.GREATER: lambda lhs, rhs: lhs > rhs,
+    OpKind.LESS: lambda lhs, rhs: lhs < rhs,
+    OpKind.GREATER_EQUAL: lambda lhs, rhs: lhs >= rhs,
+    OpKind.LESS_EQUAL: lambda lhs, rhs: lhs <= rhs,
+    OpKind.LOGICAL_AND: lambda lhs, rhs: bool(lhs) and bool(rhs),
+    OpKind.LOGICAL_OR: lambda lhs, rhs: bool(lhs) or bool(rhs),
+    OpKind.LOGICAL_NOT: lambda x: not x,
+    OpKind.BIT_AND: lambda lhs, rhs: lhs & rhs,
+    OpKind.BIT_OR: lambda lhs, rhs: lhs | rhs,
+    OpKind.BIT_XOR: lambda lhs, rhs: lhs ^ rhs,
+    OpKind.BIT_NOT: lambda x: ~x,
+    OpKind.IDENTITY: lambda x: x,
+    OpKind.NEGATE: lambda x: -x,
+    OpKind.MINIMUM: lambda lhs, rhs: rhs if rhs < lhs else lhs,
+    OpKind.MAXIMUM: lambda lhs, rhs: rhs if lhs < rhs else lhs,
+}
+
+_compiled_ops: dict = {}
+
+
+def op_key(op):
+    """
+    A hashable key identifying ``op``, under which the kernels using it are
+    cached. Functions with the same code and closure share a key, so that
+    lambdas re-created for each call don't cause recompilation.
+    """
+    if isinstance(op, OpKind) or not hasattr(op, "__code__"):
+        return op
+    try:
+        closure = tuple(cell.cell_contents for cell in op.__closure__ or ())
+        key = (op.__code__, op.__defaults__, closure)
+        hash(key)
+        return key
+    except (TypeError, ValueError):
+        return op
+
+
+def compile_op(op):
+    """The Numba CPU dispatcher of ``op``, an ``OpKind`` or a Python callable."""
+    key = op_key(op)
+    if key in _compiled_ops:
+        return _compiled_ops[key]
+
+    if isinstance(op, OpKind):
+        if op not in _WELL_KNOWN_OPS:
+            raise ValueError(
+                f"OpKind.{op.name} is not a well-known operation. "
+                "Use OpKind.PLUS, OpKind.MAXIMUM, etc."
+            )
+        compiled = jit(_WELL_KNOWN_OPS[op])
+    elif isinstance(op, numba.core.registry.CPUDispatcher):
+        compiled = op
+    elif callable(op):
+        compiled = jit(op)
+    else:
+        raise TypeError(
+            f"The host backend supports OpKind values and Python callables, got {type(op).__name__}"
+        )
+
+    _compiled_ops[key] = compiled
+    return compiled
+
+
+def return_type(op, argument_types) -> types.Type:
+    """The Numba type ``op`` returns for arguments of ``argument_types``."""
+    compiled = compile_op(op)
+    argument_types = tuple(argument_types)
+    compiled.compile(argument_types)
+    return compiled.overloads[argument_types].signature.return_type
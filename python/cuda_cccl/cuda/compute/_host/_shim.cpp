@@ -0,0 +1,72 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// The entry points of the CPU backend of cuda.compute. The per-element work is compiled by Numba's CPU target into
+// C callbacks, which these functions run on the Thrust host system (OpenMP, TBB or sequential C++) this library was
+// built for.
+
+#include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#if THRUST_HOST_SYSTEM == THRUST_HOST_SYSTEM_OMP
+#  include <omp.h>
+#elif THRUST_HOST_SYSTEM == THRUST_HOST_SYSTEM_TBB
+#  include <tbb/info.h>
+#endif
+
+#if defined(_WIN32)
+#  define CCCL_HOST_SHIM_API extern "C" __declspec(dllexport)
+#else
+#  define CCCL_HOST_SHIM_API extern "C" __attribute__((visibility("default")))
+#endif
+
+using chunk_fn_t = void (*)(void* ctx, int64_t chunk, int64_t begin, int64_t end);
+using less_fn_t  = int32_t (*)(void* ctx, int64_t lhs, int64_t rhs);
+
+// The number of threads the host system runs on
+CCCL_HOST_SHIM_API int64_t cccl_host_concurrency()
+{
+#if THRUST_HOST_SYSTEM == THRUST_HOST_SYSTEM_OMP
+  return omp_get_max_threads();
+#elif THRUST_HOST_SYSTEM == THRUST_HOST_SYSTEM_TBB
+  return tbb::info::default_concurrency();
+#else
+  return 1;
+#endif
+}
+
+// Calls `fn(ctx, chunk, begin, end)` for each of the `num_chunks` chunks of `chunk_size` items in [0, num_items)
+CCCL_HOST_SHIM_API void
+cccl_host_for_each_chunk(void* ctx, int64_t num_chunks, int64_t chunk_size, int64_t num_items, chunk_fn_t fn)
+{
+  thrust::for_each(
+    thrust::host,
+    thrust::counting_iterator<int64_t>(0),
+    thrust::counting_iterator<int64_t>(num_chunks),
+    [=](int64_t chunk) {
+      const int64_t begin = chunk * chunk_size;
+      fn(ctx, chunk, begin, (std::min) (begin + chunk_size, num_items));
+    });
+}
+
+// Fills `indices` with the permutation which stably sorts [0, num_items) by `less(ctx, lhs, rhs)`
+CCCL_HOST_SHIM_API void cccl_host_stable_sort_indices(void* ctx, int64_t* indices, int64_t num_items, less_fn_t less)
+{
+  thrust::sequence(thrust::host, indices, indices + num_items);
+  thrust::stable_sort(thrust::host, indices, indices + num_items, [=](int64_t lhs, int64_t rhs) {
+    return less(ctx, lhs, rhs) != 0;
+  });
+}
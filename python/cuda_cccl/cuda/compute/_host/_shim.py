@@ -0,0 +1,111 @@
+# Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. ALL RIGHTS RESERVED.
+#
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+"""
+Loads ``libcccl_host_shim``, the C entry points which run the compiled chunk
+kernels and comparators on the Thrust host system. When the library was not
+built (e.g. in a source checkout), the same entry points fall back to a
+sequential implementation in Python.
+"""
+
+from __future__ import annotations
+
+import ctypes
+import functools
+import os
+import sys
+from pathlib import Path
+
+CHUNK_FN = ctypes.CFUNCTYPE(
+    None, ctypes.c_void_p, ctypes.c_int64, ctypes.c_int64, ctypes.c_int64
+)
+LESS_FN = ctypes.CFUNCTYPE(
+    ctypes.c_int32, ctypes.c_void_p, ctypes.c_int64, ctypes.c_int64
+)
+
+
+def _library_path() -> Path:
+    if path := os.environ.get("CCCL_HOST_SHIM_LIBRARY"):
+        return Path(path)
+    if sys.platform == "win32":
+        name = "cccl_host_shim.dll"
+    elif sys.platform == "darwin":
+        name = "libcccl_host_shim.dylib"
+    else:
+        name = "libcccl_host_shim.so"
+    return Path(__file__).resolve().parent / name
+
+
+@functools.cache
+def _load():
+    path = _library_path()
+    if not path.is_file():
+        return None
+
+    lib = ctypes.CDLL(str(path))
+    lib.cccl_host_concurrency.restype = ctypes.c_int64
+    lib.cccl_host_concurrency.argtypes = []
+    lib.cccl_host_for_each_chunk.restype = None
+    lib.cccl_host_for_each_chunk.argtypes = [
+        ctypes.c_void_p,
+        ctypes.c_int64,
+        ctypes.c_int64,
+        ctypes.c_int64,
+        ctypes.c_void_p,
+    ]
+    lib.cccl_host_stable_sort_indices.restype = None
+    lib.cccl_host_stable_sort_indices.argtypes = [
+        ctypes.c_void_p,
+        ctypes.c_void_p,
+        ctypes.c_int64,
+        ctypes.c_void_p,
+    ]
+    return lib
+
+
+def is_available() -> bool:
+    """Return True if the Thrust host system library could be loaded."""
+    return _load() is not None
+
+
+@functools.cache
+def concurrency() -> int:
+    lib = _load()
+    return int(lib.cccl_host_concurrency()) if lib is not None else 1
+
+
+def for_each_chunk(
+    ctx: int, num_chunks: int, chunk_size: int, num_items: int, fn: int
+) -> None:
+    """Calls the chunk kernel at address ``fn`` for each chunk of [0, num_items)."""
+    lib = _load()
+    if lib is not None:
+        # ctypes releases the GIL for the duration of the call
+        lib.cccl_host_for_each_chunk(ctx, num_chunks, chunk_size, num_items, fn)
+        return
+
+    kernel = CHUNK_FN(fn)
+    for chunk in range(num_chunks):
+        begin = chunk * chunk_size
+        kernel(ctx, chunk, begin, min(begin + chunk_size, num_items))
+
+
+def stable_sort_indices(ctx: int, indices: int, num_items: int, less: int) -> None:
+    """Stores the permutation which stably sorts [0, num_items) by the comparator at address ``less``."""
+    lib = _load()
+    if lib is not None:
+        lib.cccl_host_stable_sort_indices(ctx, indices, num_items, less)
+        return
+
+    compare = LESS_FN(less)
+    order = sorted(
+        range(num_items),
+        key=functools.cmp_to_key(
+            lambda lhs, rhs: (
+                -1 if compare(ctx, lhs, rhs) else int(bool(compare(ctx, rhs, lhs)))
+            )
+        ),
+    )
+    out = (ctypes.c_int64 * num_items).from_address(indices)
+    out[:] = order
@@ -0,0 +1,220 @@
+# Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. ALL RIGHTS RESERVED.
+#
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+import numpy as np
+import pytest
+
+pytest.importorskip("numba")
+
+import cuda.compute._host as host  # noqa: E402
+from cuda.compute._host import OpKind, SortOrder  # noqa: E402
+
+# Large enough to be split into several chunks
+NUM_ITEMS = 50_000
+
+
+@pytest.fixture(params=[np.int8, np.int32, np.uint64, np.float32, np.float64])
+def dtype(request):
+    return np.dtype(request.param)
+
+
+def random_array(size, dtype, seed=0):
+    rng = np.random.default_rng(seed)
+    if np.issubdtype(dtype, np.integer):
+        return rng.integers(0, 8, size).astype(dtype)
+    return rng.random(size).astype(dtype)
+
+
+def test_reduce(dtype):
+    h_in = random_array(NUM_ITEMS, dtype)
+    h_out = np.empty(1, np.float64 if dtype.kind == "f" else np.int64)
+    h_init = np.array([5], h_out.dtype)
+
+    host.reduce_into(
+        d_in=h_in, d_out=h_out, num_items=NUM_ITEMS, op=OpKind.PLUS, h_init=h_init
+    )
+    np.testing.assert_allclose(h_out[0], h_in.sum(dtype=h_out.dtype) + 5)
+
+    host.reduce_into(d_in=h_in, d_out=h_out, num_items=0, op=OpKind.PLUS, h_init=h_init)
+    assert h_out[0] == 5
+
+
+def test_reduce_struct():
+    dtype = np.dtype([("a", np.int32), ("b", np.float64)])
+    h_a = random_array(NUM_ITEMS, np.dtype(np.int32))
+    h_b = random_array(NUM_ITEMS, np.dtype(np.float64))
+    h_out = np.empty(1, dtype)
+
+    def add_pairs(x, y):
+        return (x[0] + y[0], x[1] + y[1])
+
+    host.reduce_into(
+        d_in=host.ZipIterator(h_a, h_b),
+        d_out=h_out,
+        num_items=NUM_ITEMS,
+        op=add_pairs,
+        h_init=np.zeros(1, dtype),
+    )
+    assert h_out["a"][0] == h_a.sum()
+    np.testing.assert_allclose(h_out["b"][0], h_b.sum())
+
+
+def test_scan(dtype):
+    h_in = random_array(NUM_ITEMS, dtype)
+    h_out = np.empty_like(h_in)
+
+    host.inclusive_scan(d_in=h_in, d_out=h_out, op=OpKind.PLUS, num_items=NUM_ITEMS)
+    np.testing.assert_allclose(h_out, np.cumsum(h_in, dtype=dtype), rtol=1e-4)
+
+    host.exclusive_scan(
+        d_in=h_in,
+        d_out=h_out,
+        op=OpKind.PLUS,
+        init_value=np.array([1], dtype),
+        num_items=NUM_ITEMS,
+    )
+    expected = np.cumsum(np.concatenate([[1], h_in[:-1]]).astype(dtype), dtype=dtype)
+    np.testing.assert_allclose(h_out, expected, rtol=1e-4)
+
+
+def test_scan_in_place():
+    h_in = random_array(NUM_ITEMS, np.dtype(np.int32))
+    h_data = h_in.copy()
+
+    host.inclusive_scan(
+        d_in=h_data, d_out=h_data, op=OpKind.MAXIMUM, num_items=NUM_ITEMS
+    )
+    np.testing.assert_array_equal(h_data, np.maximum.accumulate(h_in))
+
+
+def test_transform_iterators():
+    h_in = random_array(NUM_ITEMS, np.dtype(np.int32))
+    h_out = np.empty(NUM_ITEMS, np.int64)
+
+    host.binary_transform(
+        d_in1=host.TransformIterator(h_in, lambda x: x * 2),
+        d_in2=host.ReverseIterator(h_in),
+        d_out=host.TransformOutputIterator(h_out, lambda x: x + 1),
+        op=OpKind.MINUS,
+        num_items=NUM_ITEMS,
+    )
+    np.testing.assert_array_equal(h_out, 2 * h_in - h_in[::-1] + 1)
+
+    indices = np.array([3, 1, 2, 0], np.int64)
+    host.unary_transform(
+        d_in=host.PermutationIterator(host.CountingIterator(np.int32(10)), indices),
+        d_out=h_out,
+        op=OpKind.NEGATE,
+        num_items=4,
+    )
+    np.testing.assert_array_equal(h_out[:4], -(10 + indices))
+
+
+def test_divides_truncates():
+    lhs = np.array([-7, 7, -7, 7], np.int32)
+    rhs = np.array([2, 2, -2, -2], np.int32)
+    h_out = np.empty(4, np.int32)
+
+    host.binary_transform(
+        d_in1=lhs, d_in2=rhs, d_out=h_out, op=OpKind.DIVIDES, num_items=4
+    )
+    np.testing.assert_array_equal(h_out, [-3, 3, 3, -3])
+
+    host.binary_transform(
+        d_in1=lhs, d_in2=rhs, d_out=h_out, op=OpKind.MODULUS, num_items=4
+    )
+    np.testing.assert_array_equal(h_out, [-1, 1, -1, 1])
+
+
+def test_segmented_reduce():
+    h_in = random_array(NUM_ITEMS, np.dtype(np.int32))
+    start_offsets = np.array([0, 10, 10, 300], np.int64)
+    end_offsets = np.array([10, 10, 300, NUM_ITEMS], np.int64)
+    h_out = np.empty(4, np.int64)
+
+    host.segmented_reduce(
+        d_in=h_in,
+        d_out=h_out,
+        num_segments=4,
+        start_offsets_in=start_offsets,
+        end_offsets_in=end_offsets,
+        op=OpKind.PLUS,
+        h_init=np.int64(0),
+    )
+    expected = [h_in[b:e].sum() for b, e in zip(start_offsets, end_offsets)]
+    np.testing.assert_array_equal(h_out, expected)
+
+
+def test_binary_search():
+    h_data = np.sort(random_array(1000, np.dtype(np.int32)))
+    h_values = np.arange(-1, 10, dtype=np.int32)
+    h_out = np.empty(len(h_values), np.uint64)
+
+    for search, side in ((host.lower_bound, "left"), (host.upper_bound, "right")):
+        search(
+            d_data=h_data,
+            num_items=len(h_data),
+            d_values=h_values,
+            num_values=len(h_values),
+            d_out=h_out,
+        )
+        np.testing.assert_array_equal(h_out, np.searchsorted(h_data, h_values, side))
+
+
+def test_merge_sort_in_place():
+    h_keys = random_array(NUM_ITEMS, np.dtype(np.int32))
+    h_values = np.arange(NUM_ITEMS, dtype=np.int64)
+    order = np.argsort(h_keys, kind="stable")
+    expected_keys, expected_values = h_keys[order], h_values[order]
+
+    host.merge_sort(
+        d_in_keys=h_keys,
+        d_in_values=h_values,
+        d_out_keys=h_keys,
+        d_out_values=h_values,
+        num_items=NUM_ITEMS,
+        op=OpKind.LESS,
+    )
+    np.testing.assert_array_equal(h_keys, expected_keys)
+    np.testing.assert_array_equal(h_values, expected_values)
+
+
+def test_radix_sort(dtype):
+    h_keys = random_array(NUM_ITEMS, dtype)
+    h_out = np.empty_like(h_keys)
+
+    host.radix_sort(
+        d_in_keys=h_keys,
+        d_out_keys=h_out,
+        num_items=NUM_ITEMS,
+        order=SortOrder.DESCENDING,
+    )
+    np.testing.assert_array_equal(h_out, np.sort(h_keys)[::-1])
+
+
+def test_radix_sort_double_buffer_and_bits():
+    h_keys = np.array([-0.0, 0.5, np.inf, -1.5, 0.0, -np.inf], np.float32)
+    keys = host.DoubleBuffer(h_keys.copy(), np.empty_like(h_keys))
+
+    host.radix_sort(
+        d_in_keys=keys,
+        d_out_keys=None,
+        num_items=len(h_keys),
+        order=SortOrder.ASCENDING,
+    )
+    assert keys.selector == 1
+    np.testing.assert_array_equal(keys.current(), np.sort(h_keys))
+
+    h_keys = np.array([3, 1, 255, 2, 0], np.uint8)
+    h_out = np.empty_like(h_keys)
+    host.radix_sort(
+        d_in_keys=h_keys,
+        d_out_keys=h_out,
+        num_items=len(h_keys),
+        order=SortOrder.ASCENDING,
+        begin_bit=0,
+        end_bit=2,
+    )
+    # 255 and 3 have the same two low bits, and keep their order
+    np.testing.assert_array_equal(h_out, [0, 1, 2, 3, 255])
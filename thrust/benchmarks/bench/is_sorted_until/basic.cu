@@ -6,6 +6,7 @@
 #include <thrust/sort.h>
 
 #include <cuda/functional>
+#include <cuda/std/algorithm>
 #include <cuda/stream>
 
 #include "nvbench_helper.cuh"
@@ -0,0 +1,40 @@
+#include <thrust/autotune.h>
+#include <thrust/execution_policy.h>
+
+#include <cstdlib>
+#include <iostream>
+
+// This example calibrates the knobs of the algorithms of the device system on this machine, when the device system is
+// OpenMP or TBB, and prints the resulting profile. Given a path, it runs a full calibration instead, and saves the
+// profile there, where a program can load it with thrust::autotune::calibrate_once, or with thrust::autotune::load,
+// which also reads the path from the THRUST_AUTOTUNE_PROFILE environment variable.
+//
+//   autotune                      # quick calibration, printed
+//   autotune /etc/thrust.profile  # full calibration, saved
+
+int main(int argc, char** argv)
+{
+  thrust::autotune::calibration_options options;
+  if (argc < 2)
+  {
+    // keep the quick calibration short, at the cost of accuracy
+    options.problem_size  = 1 << 18;
+    options.max_threshold = 1 << 16;
+    options.repetitions   = 1;
+  }
+  else
+  {
+    options.value_sizes = {1, 2, 4, 8};
+  }
+
+  const thrust::autotune::profile profile = thrust::autotune::calibrate(thrust::device, options);
+
+  if (argc >= 2)
+  {
+    profile.save(argv[1]);
+    std::cout << "saved the profile to " << argv[1] << '\n';
+  }
+  std::cout << profile.to_string();
+
+  return EXIT_SUCCESS;
+}
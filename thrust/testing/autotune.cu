@@ -0,0 +1,281 @@
+#include <thrust/autotune.h>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/find.h>
+#include <thrust/functional.h>
+#include <thrust/host_vector.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include <unittest/unittest.h>
+
+// resets the active profile at the end of a test
+struct scoped_profile
+{
+  ~scoped_profile()
+  {
+    thrust::autotune::reset();
+  }
+};
+
+void TestAutotuneProfile()
+{
+  thrust::autotune::profile p;
+  ASSERT_EQUAL(p.empty(), true);
+  ASSERT_EQUAL(p.get("omp.scan.threshold", 4).has_value(), false);
+
+  p.set("omp.scan.threshold", 4, 2048);
+  p.set("omp.scan.threshold", 8, 4096);
+  p.set("tbb.sort.threshold", 4, 65536);
+  p.set_machine("threads=16");
+
+  ASSERT_EQUAL(p.empty(), false);
+  ASSERT_EQUAL(*p.get("omp.scan.threshold", 4), 2048);
+  ASSERT_EQUAL(*p.get("omp.scan.threshold", 8), 4096);
+  ASSERT_EQUAL(p.get("omp.scan.threshold", 2).has_value(), false);
+
+  const std::string text = p.to_string();
+  ASSERT_EQUAL(text,
+               "# thrust autotune profile\n"
+               "machine threads=16\n"
+               "omp.scan.threshold 4 2048\n"
+               "omp.scan.threshold 8 4096\n"
+               "tbb.sort.threshold 4 65536\n");
+
+  const thrust::autotune::profile parsed = thrust::autotune::profile::from_string(text);
+  ASSERT_EQUAL(parsed.machine(), "threads=16");
+  ASSERT_EQUAL(parsed.to_string(), text);
+
+  thrust::autotune::profile other;
+  other.set("omp.scan.threshold", 4, 1);
+  other.set("omp.find_if.sequential_threshold", 4, 2);
+  p.merge(other);
+  ASSERT_EQUAL(*p.get("omp.scan.threshold", 4), 1);
+  ASSERT_EQUAL(*p.get("omp.scan.threshold", 8), 4096);
+  ASSERT_EQUAL(*p.get("omp.find_if.sequential_threshold", 4), 2);
+
+  ASSERT_THROWS(thrust::autotune::profile::from_string("omp.scan.threshold 4\n"), std::runtime_error);
+  ASSERT_THROWS(thrust::autotune::profile::from_string("omp.scan.threshold 4 1 2\n"), std::runtime_error);
+}
+DECLARE_UNITTEST(TestAutotuneProfile);
+
+void TestAutotuneProfileFile()
+{
+  const char* directory  = std::getenv("TMPDIR");
+  const std::string path = std::string(directory ? directory : "/tmp") + "/thrust_autotune_test.profile";
+
+  thrust::autotune::profile p;
+  p.set("tbb.sort_by_key.threshold", 16, 1 << 15);
+  p.set_machine(thrust::autotune::profile::current_machine());
+  p.save(path);
+
+  thrust::autotune::profile loaded;
+  ASSERT_EQUAL(loaded.load(path), true);
+  ASSERT_EQUAL(loaded.to_string(), p.to_string());
+
+  std::remove(path.c_str());
+  ASSERT_EQUAL(loaded.load(path), false);
+}
+DECLARE_UNITTEST(TestAutotuneProfileFile);
+
+void TestAutotuneTunedValue()
+{
+  using knob = thrust::detail::autotune_knob;
+  scoped_profile scope;
+
+  ASSERT_EQUAL(thrust::detail::tuned_value(knob::omp_scan_threshold, 4, 1024), 1024);
+
+  thrust::autotune::profile p;
+  p.set("omp.scan.threshold", 4, 64);
+  p.set("tbb.sort.threshold", 4, -1);
+  p.set("tbb.sort.threshold", 8, std::int64_t{1} << 40);
+  p.set("tbb.sort.threshold", 32, 16);
+  thrust::autotune::use(p);
+
+  ASSERT_EQUAL(*thrust::autotune::active().get("omp.scan.threshold", 4), 64);
+  ASSERT_EQUAL(thrust::detail::tuned_value(knob::omp_scan_threshold, 4, 1024), 64);
+  ASSERT_EQUAL(thrust::detail::tuned_value(knob::omp_scan_threshold, 8, 1024), 1024);
+  ASSERT_EQUAL(thrust::detail::tuned_value(knob::omp_reduce_tiles_per_processor, 4, 1), 1);
+
+  // the values are clamped to the type of the knob
+  ASSERT_EQUAL(thrust::detail::tuned_value(knob::tbb_sort_threshold, 4, std::size_t{1}), std::size_t{0});
+  ASSERT_EQUAL(thrust::detail::tuned_value(knob::tbb_sort_threshold, 8, 1), (std::numeric_limits<int>::max)());
+
+  // the knobs are only tuned for values of up to 16 bytes
+  ASSERT_EQUAL(thrust::detail::tuned_value(knob::tbb_sort_threshold, 32, 1024), 1024);
+
+  thrust::autotune::reset();
+  ASSERT_EQUAL(thrust::detail::tuned_value(knob::omp_scan_threshold, 4, 1024), 1024);
+  ASSERT_EQUAL(thrust::autotune::active().empty(), true);
+}
+DECLARE_UNITTEST(TestAutotuneTunedValue);
+
+void TestAutotuneLoad()
+{
+  using knob = thrust::detail::autotune_knob;
+  scoped_profile scope;
+
+  const char* directory  = std::getenv("TMPDIR");
+  const std::string path = std::string(directory ? directory : "/tmp") + "/thrust_autotune_load_test.profile";
+
+  thrust::autotune::profile p;
+  p.set(thrust::autotune::knobs::omp_scan_threshold, 4, 64);
+  p.set_machine(thrust::autotune::profile::current_machine());
+  p.save(path);
+
+  ASSERT_EQUAL(thrust::autotune::load(path), true);
+  ASSERT_EQUAL(thrust::detail::tuned_value(knob::omp_scan_threshold, 4, 1024), 64);
+
+  // a profile made on another machine is not used
+  p.set_machine("threads=0");
+  p.save(path);
+  ASSERT_EQUAL(thrust::autotune::load(path), false);
+  ASSERT_EQUAL(thrust::detail::tuned_value(knob::omp_scan_threshold, 4, 1024), 1024);
+  ASSERT_EQUAL(thrust::autotune::active().empty(), true);
+
+  // neither is a malformed one, which does not throw
+  {
+    std::ofstream file(path, std::ios::trunc);
+    file << "omp.scan.threshold 4\n";
+  }
+  ASSERT_EQUAL(thrust::autotune::load(path), false);
+  ASSERT_EQUAL(thrust::detail::tuned_value(knob::omp_scan_threshold, 4, 1024), 1024);
+
+  std::remove(path.c_str());
+  ASSERT_EQUAL(thrust::autotune::load(path), false);
+
+  // the algorithms work with the defaults
+  thrust::device_vector<int> values(1000, 1);
+  ASSERT_EQUAL(thrust::reduce(values.begin(), values.end()), 1000);
+}
+DECLARE_UNITTEST(TestAutotuneLoad);
+
+// the algorithms are correct whatever the values of their knobs
+void TestAutotuneExtremeKnobs()
+{
+  scoped_profile scope;
+
+  for (std::int64_t value : {std::int64_t{0}, std::int64_t{1}, std::int64_t{2}, std::int64_t{1} << 40})
+  {
+    thrust::autotune::profile p;
+    for (const char* knob :
+         {thrust::autotune::knobs::tbb_sort_threshold,
+          thrust::autotune::knobs::tbb_sort_by_key_threshold,
+          thrust::autotune::knobs::tbb_find_if_sequential_threshold,
+          thrust::autotune::knobs::omp_scan_threshold,
+          thrust::autotune::knobs::omp_reduce_tiles_per_processor,
+          thrust::autotune::knobs::omp_find_if_sequential_threshold})
+    {
+      p.set(knob, sizeof(int), value);
+      p.set(knob, 2 * sizeof(int), value);
+    }
+    thrust::autotune::use(p);
+
+    const std::size_t n = 10000;
+    thrust::host_vector<int> h_keys(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      h_keys[i] = static_cast<int>((i * 7919) % n);
+    }
+
+    thrust::device_vector<int> keys = h_keys;
+    thrust::device_vector<int> values(n);
+    thrust::sequence(values.begin(), values.end());
+
+    thrust::stable_sort_by_key(keys.begin(), keys.end(), values.begin());
+    thrust::host_vector<int> h_sorted(n);
+    thrust::sequence(h_sorted.begin(), h_sorted.end());
+    ASSERT_EQUAL(keys, h_sorted);
+
+    thrust::stable_sort(values.begin(), values.end());
+    ASSERT_EQUAL(values, h_sorted);
+
+    ASSERT_EQUAL(thrust::reduce(keys.begin(), keys.end()), static_cast<int>(n * (n - 1) / 2));
+
+    thrust::device_vector<int> scanned(n);
+    thrust::inclusive_scan(keys.begin(), keys.end(), scanned.begin());
+    ASSERT_EQUAL(scanned.back(), static_cast<int>(n * (n - 1) / 2));
+
+    ASSERT_EQUAL(thrust::find(keys.begin(), keys.end(), 1234) - keys.begin(), 1234);
+  }
+}
+DECLARE_UNITTEST(TestAutotuneExtremeKnobs);
+
+void TestAutotuneCalibrate()
+{
+  scoped_profile scope;
+
+  thrust::autotune::calibration_options options;
+  options.value_sizes   = {4, 3};
+  options.problem_size  = 1 << 13;
+  options.max_threshold = 1 << 10;
+  options.repetitions   = 1;
+
+  const thrust::autotune::profile p = thrust::autotune::calibrate(thrust::device, options);
+  ASSERT_EQUAL(p.machine(), thrust::autotune::profile::current_machine());
+
+  // the calibration does not change the active profile
+  ASSERT_EQUAL(thrust::autotune::active().empty(), true);
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+  ASSERT_EQUAL(p.get(thrust::autotune::knobs::omp_scan_threshold, 4).has_value(), true);
+  ASSERT_EQUAL(p.get(thrust::autotune::knobs::omp_reduce_tiles_per_processor, 4).has_value(), true);
+  ASSERT_EQUAL(p.get(thrust::autotune::knobs::omp_find_if_sequential_threshold, 4).has_value(), true);
+  ASSERT_EQUAL(p.get(thrust::autotune::knobs::omp_scan_threshold, 3).has_value(), false);
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+  ASSERT_EQUAL(p.get(thrust::autotune::knobs::tbb_sort_threshold, 4).has_value(), true);
+  ASSERT_EQUAL(p.get(thrust::autotune::knobs::tbb_sort_by_key_threshold, 8).has_value(), true);
+  ASSERT_EQUAL(p.get(thrust::autotune::knobs::tbb_find_if_sequential_threshold, 4).has_value(), true);
+  ASSERT_EQUAL(p.get(thrust::autotune::knobs::tbb_sort_threshold, 3).has_value(), false);
+#else
+  ASSERT_EQUAL(p.empty(), true);
+#endif
+}
+DECLARE_UNITTEST(TestAutotuneCalibrate);
+
+void TestAutotuneCalibrateOnce()
+{
+  scoped_profile scope;
+
+  const char* directory  = std::getenv("TMPDIR");
+  const std::string path = std::string(directory ? directory : "/tmp") + "/thrust_autotune_once_test.profile";
+  std::remove(path.c_str());
+
+  thrust::autotune::calibration_options options;
+  options.value_sizes   = {4};
+  options.problem_size  = 1 << 13;
+  options.max_threshold = 1 << 10;
+  options.repetitions   = 1;
+
+  // the first use calibrates and saves the profile, and the second one loads it
+  const thrust::autotune::profile first = thrust::autotune::calibrate_once(thrust::device, path, options);
+  ASSERT_EQUAL(thrust::autotune::active().to_string(), first.to_string());
+
+  thrust::autotune::profile saved;
+  ASSERT_EQUAL(saved.load(path), true);
+  ASSERT_EQUAL(saved.to_string(), first.to_string());
+
+  // the values of other knobs are kept
+  saved.set("other.knob", 4, 42);
+  saved.save(path);
+  const thrust::autotune::profile second = thrust::autotune::calibrate_once(thrust::device, path, options);
+  ASSERT_EQUAL(*second.get("other.knob", 4), 42);
+
+  // a profile made on another machine is replaced
+  saved.set_machine("threads=0");
+  saved.save(path);
+  const thrust::autotune::profile third = thrust::autotune::calibrate_once(thrust::device, path, options);
+  ASSERT_EQUAL(third.machine(), thrust::autotune::profile::current_machine());
+  ASSERT_EQUAL(third.get("other.knob", 4).has_value(), false);
+
+  std::remove(path.c_str());
+}
+DECLARE_UNITTEST(TestAutotuneCalibrateOnce);
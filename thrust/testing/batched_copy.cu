@@ -0,0 +1,142 @@
+#include <thrust/batched_copy.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+
+#include <unittest/unittest.h>
+
+template <typename T>
+struct offset_pointer
+{
+  T* base;
+
+  _CCCL_HOST_DEVICE T* operator()(int offset) const
+  {
+    return base + offset;
+  }
+};
+
+void TestBatchedCopySimple()
+{
+  thrust::device_vector<int> values{1, 2, 3, 4, 5, 6};
+  thrust::device_vector<int> rows(6, -1);
+  int* values_ptr = thrust::raw_pointer_cast(values.data());
+  int* rows_ptr   = thrust::raw_pointer_cast(rows.data());
+
+  thrust::device_vector<int*> inputs{values_ptr + 3, values_ptr + 2, values_ptr};
+  thrust::device_vector<int*> outputs{rows_ptr, rows_ptr + 3, rows_ptr + 3};
+  thrust::device_vector<int> sizes{3, 0, 2};
+
+  thrust::batched_copy(inputs.begin(), outputs.begin(), sizes.begin(), 3);
+
+  thrust::device_vector<int> ref{4, 5, 6, 1, 2, -1};
+  ASSERT_EQUAL(ref, rows);
+
+  // nothing to copy
+  thrust::batched_copy(thrust::device, inputs.begin(), outputs.begin(), sizes.begin(), 0);
+  ASSERT_EQUAL(ref, rows);
+}
+DECLARE_UNITTEST(TestBatchedCopySimple);
+
+void TestBatchedMemcpySimple()
+{
+  const char text[] = "ApplesBananasGrapes";
+  thrust::device_vector<char> input(text, text + 19);
+  thrust::device_vector<char> output(20, '.');
+  const char* input_ptr = thrust::raw_pointer_cast(input.data());
+  char* output_ptr      = thrust::raw_pointer_cast(output.data());
+
+  thrust::device_vector<const char*> inputs{input_ptr + 13, input_ptr, input_ptr + 6};
+  thrust::device_vector<void*> outputs{output_ptr, output_ptr + 6, output_ptr + 12};
+  thrust::device_vector<size_t> sizes{6, 6, 7};
+
+  thrust::batched_memcpy(thrust::device, inputs.begin(), outputs.begin(), sizes.begin(), 3);
+
+  const char ref[] = "GrapesApplesBananas.";
+  ASSERT_EQUAL(thrust::host_vector<char>(ref, ref + 20), output);
+}
+DECLARE_UNITTEST(TestBatchedMemcpySimple);
+
+// the sizes of the buffers are mostly tiny or empty, with a few as large as the whole input
+thrust::host_vector<int> random_skewed_sizes(size_t n)
+{
+  thrust::host_vector<unsigned int> h_random = unittest::random_integers<unsigned int>(n + 1);
+  thrust::host_vector<int> h_sizes;
+  int total = 0;
+  while (total < static_cast<int>(n))
+  {
+    const unsigned int r = h_random[h_sizes.size() % h_random.size()];
+    const int max_size   = r % 64 == 0 ? static_cast<int>(n) : r % 8 == 0 ? 1000 : 40;
+    const int size       = (::cuda::std::min) (static_cast<int>(r / 64 % (max_size + 1)), static_cast<int>(n) - total);
+    h_sizes.push_back(size);
+    total += size;
+  }
+  return h_sizes;
+}
+
+template <typename T>
+void TestBatchedCopy(size_t n)
+{
+  thrust::host_vector<T> h_input     = unittest::random_integers<T>(n);
+  thrust::host_vector<int> h_sizes   = random_skewed_sizes(n);
+  const int num_ranges               = static_cast<int>(h_sizes.size());
+  thrust::host_vector<int> h_offsets = h_sizes;
+  thrust::exclusive_scan(h_sizes.begin(), h_sizes.end(), h_offsets.begin());
+
+  // copy the ranges in reverse order
+  thrust::host_vector<int> h_reversed_offsets(num_ranges);
+  for (int i = 0, offset = static_cast<int>(n); i < num_ranges; ++i)
+  {
+    offset -= h_sizes[i];
+    h_reversed_offsets[i] = offset;
+  }
+
+  thrust::host_vector<T> h_output(n);
+  for (int i = 0; i < num_ranges; ++i)
+  {
+    thrust::copy_n(h_input.begin() + h_offsets[i], h_sizes[i], h_output.begin() + h_reversed_offsets[i]);
+  }
+
+  thrust::device_vector<T> d_input              = h_input;
+  thrust::device_vector<int> d_sizes            = h_sizes;
+  thrust::device_vector<int> d_offsets          = h_offsets;
+  thrust::device_vector<int> d_reversed_offsets = h_reversed_offsets;
+  thrust::device_vector<T> d_output(n);
+
+  thrust::batched_copy(
+    thrust::make_transform_iterator(d_offsets.begin(), offset_pointer<T>{thrust::raw_pointer_cast(d_input.data())}),
+    thrust::make_transform_iterator(
+      d_reversed_offsets.begin(), offset_pointer<T>{thrust::raw_pointer_cast(d_output.data())}),
+    d_sizes.begin(),
+    num_ranges);
+
+  ASSERT_EQUAL(h_output, d_output);
+}
+DECLARE_VARIABLE_UNITTEST(TestBatchedCopy);
+
+void TestBatchedMemcpy(size_t n)
+{
+  thrust::host_vector<char> h_input  = unittest::random_integers<char>(n);
+  thrust::host_vector<int> h_sizes   = random_skewed_sizes(n);
+  const int num_buffers              = static_cast<int>(h_sizes.size());
+  thrust::host_vector<int> h_offsets = h_sizes;
+  thrust::exclusive_scan(h_sizes.begin(), h_sizes.end(), h_offsets.begin());
+
+  // move every buffer by one byte, so that the copies of the tiny buffers are not aligned
+  thrust::device_vector<char> d_input = h_input;
+  thrust::device_vector<char> d_output(n + 1, 0);
+  thrust::device_vector<int> d_sizes   = h_sizes;
+  thrust::device_vector<int> d_offsets = h_offsets;
+
+  thrust::batched_memcpy(
+    thrust::make_transform_iterator(d_offsets.begin(), offset_pointer<char>{thrust::raw_pointer_cast(d_input.data())}),
+    thrust::make_transform_iterator(
+      d_offsets.begin(), offset_pointer<char>{thrust::raw_pointer_cast(d_output.data()) + 1}),
+    d_sizes.begin(),
+    num_buffers);
+
+  thrust::host_vector<char> h_output(n + 1, 0);
+  thrust::copy(h_input.begin(), h_input.end(), h_output.begin() + 1);
+  ASSERT_EQUAL(h_output, d_output);
+}
+DECLARE_SIZED_UNITTEST(TestBatchedMemcpy);
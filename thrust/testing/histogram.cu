@@ -0,0 +1,228 @@
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/histogram.h>
+#include <thrust/host_vector.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include <unittest/unittest.h>
+
+// the bins of cub::DeviceHistogram::HistogramEven, for integral samples and levels
+template <typename T>
+int reference_even_bin(T sample, int num_levels, T lower_level, T upper_level)
+{
+  if (sample < lower_level || !(sample < upper_level))
+  {
+    return -1;
+  }
+  return static_cast<int>((std::int64_t(sample) - lower_level) * (num_levels - 1) / (std::int64_t(upper_level) - lower_level));
+}
+
+template <typename T>
+int reference_range_bin(T sample, const thrust::host_vector<T>& levels)
+{
+  const int bin = static_cast<int>(std::upper_bound(levels.begin(), levels.end(), sample) - levels.begin()) - 1;
+  return bin < static_cast<int>(levels.size()) - 1 ? bin : -1;
+}
+
+void TestHistogramEvenSimple()
+{
+  const float samples[] = {2.2f, 6.0f, 7.1f, 2.9f, 3.5f, 0.3f, 2.9f, 2.1f, 6.1f, 999.5f};
+  thrust::device_vector<float> d_samples(samples, samples + 10);
+
+  // the histogram is overwritten, not accumulated into
+  thrust::device_vector<int> d_histogram(4, 42);
+  thrust::histogram_even(d_samples.begin(), d_samples.end(), d_histogram.begin(), 5, 0.0f, 8.0f);
+
+  thrust::device_vector<int> ref{1, 5, 0, 3};
+  ASSERT_EQUAL(ref, d_histogram);
+
+  thrust::host_vector<int> h_histogram(4, 42);
+  thrust::histogram_even(thrust::host, samples, samples + 10, h_histogram.begin(), 5, 0.0f, 8.0f);
+  ASSERT_EQUAL(ref, h_histogram);
+}
+DECLARE_UNITTEST(TestHistogramEvenSimple);
+
+void TestHistogramEvenEmpty()
+{
+  thrust::device_vector<int> d_samples;
+  thrust::device_vector<unsigned int> d_histogram(3, 42);
+
+  thrust::histogram_even(d_samples.begin(), d_samples.end(), d_histogram.begin(), 4, 0, 3);
+
+  thrust::device_vector<unsigned int> ref(3, 0);
+  ASSERT_EQUAL(ref, d_histogram);
+}
+DECLARE_UNITTEST(TestHistogramEvenEmpty);
+
+template <typename T>
+void TestHistogramEven(size_t n)
+{
+  thrust::host_vector<T> h_samples = unittest::random_integers<T>(n);
+  thrust::device_vector<T> d_samples = h_samples;
+
+  // 7 bins that do not evenly divide the range, which does not contain all samples of the signed types
+  const int num_levels = 8;
+  const T lower_level  = T(3);
+  const T upper_level  = T(120);
+
+  thrust::host_vector<int> ref(num_levels - 1, 0);
+  for (const T& sample : h_samples)
+  {
+    const int bin = reference_even_bin(sample, num_levels, lower_level, upper_level);
+    if (bin >= 0)
+    {
+      ++ref[bin];
+    }
+  }
+
+  thrust::device_vector<int> d_histogram(num_levels - 1);
+  thrust::histogram_even(d_samples.begin(), d_samples.end(), d_histogram.begin(), num_levels, lower_level, upper_level);
+  ASSERT_EQUAL(ref, d_histogram);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestHistogramEven);
+
+void TestHistogramRangeSimple()
+{
+  const float samples[] = {2.2f, 6.0f, 7.1f, 2.9f, 3.5f, 0.3f, 2.9f, 2.1f, 6.1f, 999.5f};
+  thrust::device_vector<float> d_samples(samples, samples + 10);
+  thrust::device_vector<float> d_levels{0.0f, 2.0f, 4.0f, 6.0f, 8.0f};
+
+  thrust::device_vector<int> d_histogram(4, 42);
+  thrust::histogram_range(d_samples.begin(), d_samples.end(), d_histogram.begin(), 5, d_levels.begin());
+
+  thrust::device_vector<int> ref{1, 5, 0, 3};
+  ASSERT_EQUAL(ref, d_histogram);
+}
+DECLARE_UNITTEST(TestHistogramRangeSimple);
+
+template <typename T>
+void TestHistogramRange(size_t n)
+{
+  thrust::host_vector<T> h_samples = unittest::random_integers<T>(n);
+  thrust::device_vector<T> d_samples = h_samples;
+
+  thrust::host_vector<T> h_levels{T(0), T(1), T(5), T(6), T(40), T(41), T(100), T(127)};
+  thrust::device_vector<T> d_levels = h_levels;
+  const int num_levels              = static_cast<int>(h_levels.size());
+
+  thrust::host_vector<int> ref(num_levels - 1, 0);
+  for (const T& sample : h_samples)
+  {
+    const int bin = reference_range_bin(sample, h_levels);
+    if (bin >= 0)
+    {
+      ++ref[bin];
+    }
+  }
+
+  thrust::device_vector<int> d_histogram(num_levels - 1);
+  thrust::histogram_range(d_samples.begin(), d_samples.end(), d_histogram.begin(), num_levels, d_levels.begin());
+  ASSERT_EQUAL(ref, d_histogram);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestHistogramRange);
+
+void TestMultiHistogramEvenSimple()
+{
+  // RGBA pixels, of which only RGB is counted
+  const unsigned char pixels[] = {2, 6, 7, 5, 3, 0, 2, 6, 1, 255, 0, 0, 70, 2, 3, 0};
+  thrust::device_vector<unsigned char> d_pixels(pixels, pixels + 16);
+
+  thrust::device_vector<int> d_red(4), d_green(4), d_blue(4);
+  thrust::multi_histogram_even<4, 3>(
+    d_pixels.begin(),
+    d_pixels.end(),
+    ::cuda::std::array<thrust::device_vector<int>::iterator, 3>{d_red.begin(), d_green.begin(), d_blue.begin()},
+    ::cuda::std::array<int, 3>{5, 5, 5},
+    ::cuda::std::array<int, 3>{0, 0, 0},
+    ::cuda::std::array<int, 3>{256, 256, 256});
+
+  thrust::device_vector<int> ref_red{3, 1, 0, 0};
+  thrust::device_vector<int> ref_green{3, 0, 0, 1};
+  thrust::device_vector<int> ref_blue{4, 0, 0, 0};
+  ASSERT_EQUAL(ref_red, d_red);
+  ASSERT_EQUAL(ref_green, d_green);
+  ASSERT_EQUAL(ref_blue, d_blue);
+}
+DECLARE_UNITTEST(TestMultiHistogramEvenSimple);
+
+void TestMultiHistogramLarge()
+{
+  // enough pixels for the parallel systems to count them with several workers, and an incomplete trailing pixel
+  const size_t num_pixels = (1 << 18) + 3;
+  thrust::host_vector<unsigned char> h_pixels =
+    unittest::random_integers<unsigned char>(num_pixels * 4 + 2);
+  thrust::device_vector<unsigned char> d_pixels = h_pixels;
+
+  const ::cuda::std::array<int, 3> num_levels{257, 17, 4};
+  const ::cuda::std::array<int, 3> lower_level{0, 16, 100};
+  const ::cuda::std::array<int, 3> upper_level{256, 240, 101};
+
+  thrust::host_vector<unsigned char> h_levels{0, 10, 20, 30, 128, 129, 255};
+  thrust::device_vector<unsigned char> d_levels = h_levels;
+
+  thrust::host_vector<int> ref_even[3];
+  thrust::host_vector<int> ref_range[3];
+  for (int channel = 0; channel < 3; ++channel)
+  {
+    ref_even[channel].resize(num_levels[channel] - 1, 0);
+    ref_range[channel].resize(h_levels.size() - 1, 0);
+  }
+  for (size_t pixel = 0; pixel < num_pixels; ++pixel)
+  {
+    for (int channel = 0; channel < 3; ++channel)
+    {
+      const int sample = h_pixels[pixel * 4 + channel];
+
+      const int even_bin = reference_even_bin(sample, num_levels[channel], lower_level[channel], upper_level[channel]);
+      if (even_bin >= 0)
+      {
+        ++ref_even[channel][even_bin];
+      }
+
+      const int range_bin = reference_range_bin(h_pixels[pixel * 4 + channel], h_levels);
+      if (range_bin >= 0)
+      {
+        ++ref_range[channel][range_bin];
+      }
+    }
+  }
+
+  using iterator = thrust::device_vector<int>::iterator;
+  thrust::device_vector<int> d_histograms[3];
+
+  for (int channel = 0; channel < 3; ++channel)
+  {
+    d_histograms[channel].resize(num_levels[channel] - 1);
+  }
+  thrust::multi_histogram_even<4, 3>(
+    d_pixels.begin(),
+    d_pixels.end(),
+    ::cuda::std::array<iterator, 3>{d_histograms[0].begin(), d_histograms[1].begin(), d_histograms[2].begin()},
+    num_levels,
+    lower_level,
+    upper_level);
+  for (int channel = 0; channel < 3; ++channel)
+  {
+    ASSERT_EQUAL(ref_even[channel], d_histograms[channel]);
+  }
+
+  for (int channel = 0; channel < 3; ++channel)
+  {
+    d_histograms[channel].resize(h_levels.size() - 1);
+  }
+  const int num_range_levels = static_cast<int>(h_levels.size());
+  thrust::multi_histogram_range<4, 3>(
+    d_pixels.begin(),
+    d_pixels.end(),
+    ::cuda::std::array<iterator, 3>{d_histograms[0].begin(), d_histograms[1].begin(), d_histograms[2].begin()},
+    ::cuda::std::array<int, 3>{num_range_levels, num_range_levels, num_range_levels},
+    ::cuda::std::array<thrust::device_vector<unsigned char>::iterator, 3>{
+      d_levels.begin(), d_levels.begin(), d_levels.begin()});
+  for (int channel = 0; channel < 3; ++channel)
+  {
+    ASSERT_EQUAL(ref_range[channel], d_histograms[channel]);
+  }
+}
+DECLARE_UNITTEST(TestMultiHistogramLarge);
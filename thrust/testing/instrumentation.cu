@@ -0,0 +1,160 @@
+#define CCCL_HOST_INSTRUMENTATION
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/host_vector.h>
+#include <thrust/instrumentation.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <string>
+
+#include <unittest/unittest.h>
+
+// enables the instrumentation for the scope of a test, and starts it with an empty registry
+struct scoped_instrumentation
+{
+  explicit scoped_instrumentation(bool hardware_counters = false)
+  {
+    thrust::instrumentation::registry::get().reset();
+    thrust::instrumentation::enable(hardware_counters);
+  }
+
+  ~scoped_instrumentation()
+  {
+    thrust::instrumentation::disable();
+    thrust::instrumentation::registry::get().reset();
+  }
+};
+
+void TestInstrumentationRecordsCalls()
+{
+  thrust::device_vector<int> v(1000);
+  thrust::sequence(v.begin(), v.end());
+
+  scoped_instrumentation instrumentation;
+  ASSERT_EQUAL(thrust::instrumentation::is_enabled(), true);
+
+  ASSERT_EQUAL(thrust::reduce(v.begin(), v.end()), 499500);
+  ASSERT_EQUAL(thrust::reduce(v.begin(), v.begin() + 10), 45);
+
+  thrust::instrumentation::algorithm_stats stats;
+  ASSERT_EQUAL(thrust::instrumentation::registry::get().find("thrust::reduce", stats), true);
+  ASSERT_EQUAL(stats.name, "thrust::reduce");
+  ASSERT_EQUAL(stats.calls, 2u);
+  ASSERT_EQUAL(stats.min_seconds <= stats.max_seconds, true);
+  ASSERT_EQUAL(stats.total_seconds >= stats.max_seconds, true);
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP || THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+  ASSERT_EQUAL(stats.elements, 1010u);
+  ASSERT_EQUAL(stats.bytes, 1010 * sizeof(int));
+  ASSERT_EQUAL(stats.max_threads >= 1, true);
+#endif
+
+  ASSERT_EQUAL(thrust::instrumentation::registry::get().find("thrust::sort", stats), false);
+}
+DECLARE_UNITTEST(TestInstrumentationRecordsCalls);
+
+void TestInstrumentationNestedCalls()
+{
+  thrust::device_vector<int> v(1000);
+  thrust::sequence(v.begin(), v.end());
+
+  scoped_instrumentation instrumentation;
+
+  thrust::sort(v.begin(), v.end(), ::cuda::std::greater<int>());
+  ASSERT_EQUAL(v.front(), 999);
+
+  thrust::instrumentation::algorithm_stats sort_stats, stable_sort_stats;
+  ASSERT_EQUAL(thrust::instrumentation::registry::get().find("thrust::sort", sort_stats), true);
+  ASSERT_EQUAL(sort_stats.calls, 1u);
+
+  // thrust::sort calls thrust::stable_sort, and both are recorded. The sequential sorts of the worker threads are not.
+  ASSERT_EQUAL(thrust::instrumentation::registry::get().find("thrust::stable_sort", stable_sort_stats), true);
+  ASSERT_EQUAL(stable_sort_stats.calls, 1u);
+  ASSERT_EQUAL(sort_stats.total_seconds >= stable_sort_stats.total_seconds, true);
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP || THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+  // the work reported by the nested call is also the work of the outer one
+  ASSERT_EQUAL(stable_sort_stats.elements, 1000u);
+  ASSERT_EQUAL(sort_stats.elements, 1000u);
+  ASSERT_EQUAL(sort_stats.bytes, stable_sort_stats.bytes);
+#endif
+}
+DECLARE_UNITTEST(TestInstrumentationNestedCalls);
+
+void TestInstrumentationDisabled()
+{
+  thrust::device_vector<int> v(100, 1);
+
+  {
+    scoped_instrumentation instrumentation;
+  }
+  ASSERT_EQUAL(thrust::instrumentation::is_enabled(), false);
+  ASSERT_EQUAL(thrust::instrumentation::has_hardware_counters(), false);
+
+  ASSERT_EQUAL(thrust::reduce(v.begin(), v.end()), 100);
+  ASSERT_EQUAL(thrust::instrumentation::registry::get().snapshot().empty(), true);
+}
+DECLARE_UNITTEST(TestInstrumentationDisabled);
+
+void TestInstrumentationSequentialPolicy()
+{
+  thrust::host_vector<int> v(1000, 1);
+
+  scoped_instrumentation instrumentation;
+  ASSERT_EQUAL(thrust::reduce(thrust::seq, v.begin(), v.end()), 1000);
+  thrust::sort(thrust::seq, v.begin(), v.end());
+
+  ASSERT_EQUAL(thrust::instrumentation::registry::get().snapshot().empty(), true);
+
+  // the calls with the policy of the host system are
+  ASSERT_EQUAL(thrust::reduce(thrust::host, v.begin(), v.end()), 1000);
+  thrust::instrumentation::algorithm_stats stats;
+  ASSERT_EQUAL(thrust::instrumentation::registry::get().find("thrust::reduce", stats), true);
+}
+DECLARE_UNITTEST(TestInstrumentationSequentialPolicy);
+
+void TestInstrumentationHardwareCounters()
+{
+  thrust::device_vector<int> v(1000, 1);
+
+  scoped_instrumentation instrumentation(true);
+  ASSERT_EQUAL(thrust::reduce(v.begin(), v.end()), 1000);
+
+  thrust::instrumentation::algorithm_stats stats;
+  ASSERT_EQUAL(thrust::instrumentation::registry::get().find("thrust::reduce", stats), true);
+
+  // the counters are unavailable without permission to profile, in which case the calls are still recorded
+  ASSERT_EQUAL(stats.has_counters, thrust::instrumentation::has_hardware_counters());
+  if (stats.has_counters)
+  {
+    ASSERT_EQUAL(stats.cycles > 0, true);
+  }
+}
+DECLARE_UNITTEST(TestInstrumentationHardwareCounters);
+
+void TestInstrumentationExport()
+{
+  thrust::device_vector<int> v(100, 1);
+
+  scoped_instrumentation instrumentation;
+  thrust::reduce(v.begin(), v.end());
+
+  const std::string json = thrust::instrumentation::registry::get().to_json();
+  ASSERT_EQUAL(json.rfind("{\"algorithms\":[{\"name\":\"thrust::reduce\",\"calls\":1,", 0), 0u);
+  ASSERT_EQUAL(json.substr(json.size() - 3), "}]}");
+
+  const std::string prometheus = thrust::instrumentation::registry::get().to_prometheus("app");
+  ASSERT_EQUAL(prometheus.rfind("# HELP app_algorithm_calls_total ", 0), 0u);
+  ASSERT_EQUAL(prometheus.find("# TYPE app_algorithm_calls_total counter\n") != std::string::npos, true);
+  ASSERT_EQUAL(prometheus.find("app_algorithm_calls_total{algorithm=\"thrust::reduce\"} 1\n") != std::string::npos, true);
+  ASSERT_EQUAL(prometheus.find("app_algorithm_seconds_total{algorithm=\"thrust::reduce\"} ") != std::string::npos,
+               true);
+
+  thrust::instrumentation::registry::get().reset();
+  ASSERT_EQUAL(thrust::instrumentation::registry::get().to_json(), "{\"algorithms\":[]}");
+}
+DECLARE_UNITTEST(TestInstrumentationExport);
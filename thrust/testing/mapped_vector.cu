@@ -0,0 +1,151 @@
+#include <thrust/detail/config.h>
+
+#if !_CCCL_OS(WINDOWS)
+
+#  include <thrust/copy.h>
+#  include <thrust/equal.h>
+#  include <thrust/fill.h>
+#  include <thrust/functional.h>
+#  include <thrust/mapped_vector.h>
+#  include <thrust/reduce.h>
+#  include <thrust/sequence.h>
+
+#  include <algorithm>
+#  include <cstdio>
+#  include <cstdlib>
+#  include <vector>
+
+#  include <unistd.h>
+
+#  include <unittest/unittest.h>
+
+// a unique path in the temporary directory, which is removed at the end of the test
+struct temporary_file
+{
+  std::string path;
+
+  temporary_file()
+  {
+    const char* directory = std::getenv("TMPDIR");
+    path                  = std::string(directory ? directory : "/tmp") + "/thrust_mapped_vector_XXXXXX";
+    ::close(::mkstemp(&path[0]));
+  }
+
+  ~temporary_file()
+  {
+    std::remove(path.c_str());
+  }
+};
+
+template <typename T>
+struct is_even
+{
+  _CCCL_HOST_DEVICE bool operator()(T x) const
+  {
+    return x % 2 == 0;
+  }
+};
+
+template <typename T>
+void TestMappedVector(size_t n)
+{
+  temporary_file file;
+
+  // write an output file, sized from an upper bound of the results and shrunk to the results
+  {
+    thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+
+    thrust::mapped_vector<T> output = thrust::mapped_vector<T>::create(file.path, n);
+    ASSERT_EQUAL(n, output.size());
+    ASSERT_EQUAL(true, output.mode() == thrust::map_mode::read_write);
+
+    T* end = thrust::copy_if(h_data.begin(), h_data.end(), output.begin(), is_even<T>{});
+    output.resize(end - output.begin());
+    output.flush();
+
+    thrust::host_vector<T> h_ref(n);
+    h_ref.resize(thrust::copy_if(h_data.begin(), h_data.end(), h_ref.begin(), is_even<T>{}) - h_ref.begin());
+    ASSERT_EQUAL(h_ref, thrust::host_vector<T>(output.begin(), output.end()));
+  }
+
+  // read it back, with a hint for each half
+  {
+    thrust::mapped_vector<T> input(file.path);
+    thrust::mapped_span<const T> span = input.span();
+    span.subspan(0, span.size() / 2).advise(thrust::mapped_access::willneed);
+    span.subspan(span.size() / 2, span.size() - span.size() / 2).advise(thrust::mapped_access::sequential);
+
+    const T sum = thrust::reduce(input.begin(), input.end(), T(0), thrust::bit_xor<T>{});
+
+    thrust::mapped_vector<T> moved = std::move(input);
+    ASSERT_EQUAL(true, input.empty());
+    ASSERT_EQUAL(sum, thrust::reduce(moved.cbegin(), moved.cend(), T(0), thrust::bit_xor<T>{}));
+  }
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestMappedVector);
+
+void TestMappedVectorModes()
+{
+  temporary_file file;
+
+  {
+    thrust::mapped_vector<int> output = thrust::mapped_vector<int>::create(file.path, 4);
+    thrust::sequence(output.begin(), output.end());
+  }
+
+  // the writes to a copy-on-write mapping are not carried through to the file
+  {
+    thrust::mapped_vector<int> private_copy(file.path, thrust::map_mode::copy_on_write);
+    ASSERT_EQUAL(4u, private_copy.size());
+    thrust::fill(private_copy.begin(), private_copy.end(), 7);
+    ASSERT_EQUAL(28, thrust::reduce(private_copy.begin(), private_copy.end()));
+  }
+
+  // the writes to a shared mapping are, and growing the file adds zeros
+  {
+    thrust::mapped_vector<int> shared(file.path, thrust::map_mode::read_write);
+    ASSERT_EQUAL(6, thrust::reduce(shared.begin(), shared.end()));
+    shared.resize(6);
+    shared[5] = 10;
+  }
+
+  thrust::mapped_vector<int> input(file.path);
+  const int ref[] = {0, 1, 2, 3, 0, 10};
+  ASSERT_EQUAL(true, thrust::equal(input.begin(), input.end(), ref));
+
+  // an empty file maps to no elements
+  thrust::mapped_vector<int> empty = thrust::mapped_vector<int>::create(file.path, 0);
+  ASSERT_EQUAL(true, empty.empty());
+  ASSERT_EQUAL(0u, thrust::mapped_vector<int>(file.path).size());
+
+  ASSERT_THROWS(thrust::mapped_vector<int>(file.path + ".missing"), thrust::system_error);
+}
+DECLARE_UNITTEST(TestMappedVectorModes);
+
+// Dropping the pages of a range must not change the elements around it
+void TestMappedSpanDontneedKeepsNeighbors()
+{
+  const size_t n = 1 << 16;
+
+  std::vector<int> anonymous(n, 7);
+  thrust::mapped_span<int>(anonymous.data(), n).subspan(5000, 10).advise(thrust::mapped_access::dontneed);
+  ASSERT_EQUAL(n, static_cast<size_t>(std::count(anonymous.begin(), anonymous.end(), 7)));
+
+  temporary_file file;
+  {
+    thrust::mapped_vector<int> output = thrust::mapped_vector<int>::create(file.path, n);
+    thrust::fill(output.begin(), output.end(), 1);
+  }
+
+  for (auto mode : {thrust::map_mode::copy_on_write, thrust::map_mode::read_write})
+  {
+    thrust::mapped_vector<int> data(file.path, mode);
+    thrust::fill(data.begin(), data.end(), 7);
+    data.span().subspan(5000, 10).advise(thrust::mapped_access::dontneed);
+    data.span().subspan(1000, n - 2000).advise(thrust::mapped_access::dontneed);
+    ASSERT_EQUAL(7 * static_cast<long long>(n), thrust::reduce(data.begin(), data.end(), 0ll));
+  }
+}
+DECLARE_UNITTEST(TestMappedSpanDontneedKeepsNeighbors);
+
+#endif // !_CCCL_OS(WINDOWS)
@@ -505,3 +505,126 @@ void TestDisjointSynchronizedPoolSqueeze()
   TestDisjointPoolSqueeze<thrust::mr::disjoint_synchronized_pool_resource>();
 }
 DECLARE_UNITTEST(TestDisjointSynchronizedPoolSqueeze);
+
+template <template <typename, typename> class PoolTemplate>
+void TestDisjointPoolStatistics()
+{
+  dummy_resource upstream;
+  thrust::mr::new_delete_resource bookkeeper;
+
+  using Pool = PoolTemplate<dummy_resource, thrust::mr::new_delete_resource>;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.cache_oversized          = true;
+  opts.largest_block_size       = 1024;
+
+  Pool pool(&upstream, &bookkeeper, opts);
+
+  // the first block of a pool allocates a chunk, the next one is cut from it
+  upstream.id_to_allocate = 1;
+  alloc_id a1             = pool.do_allocate(12, THRUST_MR_DEFAULT_ALIGNMENT);
+  alloc_id a2             = pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+
+  thrust::mr::pool_statistics stats = pool.get_statistics();
+  ASSERT_EQUAL(stats.pooled_misses, 1u);
+  ASSERT_EQUAL(stats.pooled_hits, 1u);
+  ASSERT_EQUAL(stats.requested_bytes, 32u);
+  ASSERT_EQUAL(stats.upstream_bytes, upstream.used_bytes);
+
+  // a cached oversized block is reused
+  upstream.id_to_allocate = 2;
+  alloc_id a3             = pool.do_allocate(2048, 32);
+  pool.do_deallocate(a3, 2048, 32);
+  alloc_id a4 = pool.do_allocate(1536, 32);
+  ASSERT_EQUAL(a4.id, 2u);
+
+  stats = pool.get_statistics();
+  ASSERT_EQUAL(stats.oversized_misses, 1u);
+  ASSERT_EQUAL(stats.oversized_hits, 1u);
+  ASSERT_EQUAL(stats.requested_bytes, 32u + 1536u);
+  ASSERT_EQUAL(stats.upstream_bytes, upstream.used_bytes);
+  ASSERT_EQUAL(stats.cached_oversized_bytes, 0u);
+
+  pool.do_deallocate(a1, 12, THRUST_MR_DEFAULT_ALIGNMENT);
+  pool.do_deallocate(a2, 16, THRUST_MR_DEFAULT_ALIGNMENT);
+  pool.do_deallocate(a4, 1536, 32);
+
+  stats = pool.get_statistics();
+  ASSERT_EQUAL(stats.requested_bytes, 0u);
+  ASSERT_EQUAL(stats.cached_oversized_bytes, 2048u);
+
+  pool.release();
+
+  stats = pool.get_statistics();
+  ASSERT_EQUAL(stats.upstream_bytes, 0u);
+  ASSERT_EQUAL(stats.cached_oversized_bytes, 0u);
+}
+
+void TestDisjointUnsynchronizedPoolStatistics()
+{
+  TestDisjointPoolStatistics<thrust::mr::disjoint_unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointUnsynchronizedPoolStatistics);
+
+void TestDisjointSynchronizedPoolStatistics()
+{
+  TestDisjointPoolStatistics<thrust::mr::disjoint_synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointSynchronizedPoolStatistics);
+
+template <template <typename, typename> class PoolTemplate>
+void TestDisjointPoolManyOversized()
+{
+  using Pool = PoolTemplate<thrust::mr::new_delete_resource, thrust::mr::new_delete_resource>;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.cache_oversized          = true;
+  opts.largest_block_size       = 1024;
+
+  Pool pool(opts);
+
+  const std::size_t num_blocks = 5000;
+  std::vector<void*> blocks(num_blocks);
+  auto size = [](std::size_t i) {
+    return 2048 + i % 7 * 512;
+  };
+  auto alignment = [](std::size_t i) {
+    return std::size_t{32} << (i % 3);
+  };
+
+  for (int round = 0; round < 2; ++round)
+  {
+    for (std::size_t i = 0; i < num_blocks; ++i)
+    {
+      blocks[i] = pool.do_allocate(size(i), alignment(i));
+    }
+
+    // free the blocks out of order, to remove them from the middle of the probe sequences of the index
+    for (std::size_t first : {2, 0, 1})
+    {
+      for (std::size_t i = first; i < num_blocks; i += 3)
+      {
+        pool.do_deallocate(blocks[i], size(i), alignment(i));
+      }
+    }
+  }
+
+  // the blocks of the second round are all the cached blocks of the first one
+  thrust::mr::pool_statistics stats = pool.get_statistics();
+  ASSERT_EQUAL(stats.oversized_misses, num_blocks);
+  ASSERT_EQUAL(stats.oversized_hits, num_blocks);
+  ASSERT_EQUAL(stats.requested_bytes, 0u);
+  ASSERT_EQUAL(stats.cached_oversized_bytes, stats.upstream_bytes);
+}
+
+void TestDisjointUnsynchronizedPoolManyOversized()
+{
+  TestDisjointPoolManyOversized<thrust::mr::disjoint_unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointUnsynchronizedPoolManyOversized);
+
+void TestDisjointSynchronizedPoolManyOversized()
+{
+  TestDisjointPoolManyOversized<thrust::mr::disjoint_synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointSynchronizedPoolManyOversized);
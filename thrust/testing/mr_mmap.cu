@@ -0,0 +1,140 @@
+#include <thrust/detail/config.h>
+
+#if !_CCCL_OS(WINDOWS)
+
+#  include <thrust/fill.h>
+#  include <thrust/host_vector.h>
+#  include <thrust/mr/allocator.h>
+#  include <thrust/mr/mmap.h>
+#  include <thrust/mr/pool.h>
+#  include <thrust/sequence.h>
+
+#  include <unittest/unittest.h>
+
+thrust::mr::mmap_options make_options(thrust::mr::huge_page_policy huge_pages, thrust::mr::prefault_policy prefault)
+{
+  thrust::mr::mmap_options options;
+  options.huge_pages = huge_pages;
+  options.prefault   = prefault;
+  return options;
+}
+
+void TestMmapResource(thrust::mr::mmap_resource& memres)
+{
+  // from a fraction of a page to several huge pages
+  const std::size_t sizes[]      = {1, 100, 4096, 10000, std::size_t{5} << 20};
+  const std::size_t alignments[] = {16, 4096, std::size_t{1} << 16};
+
+  for (std::size_t size : sizes)
+  {
+    for (std::size_t alignment : alignments)
+    {
+      void* ptr = memres.allocate(size, alignment);
+      ASSERT_EQUAL(reinterpret_cast<std::size_t>(ptr) % alignment, 0u);
+
+      // the mappings are zeroed by the kernel, whether pre-faulted or not
+      char* char_ptr = static_cast<char*>(ptr);
+      ASSERT_EQUAL(char_ptr[0], char{});
+      ASSERT_EQUAL(char_ptr[size - 1], char{});
+
+      thrust::fill(char_ptr, char_ptr + size, char{1});
+      memres.deallocate(ptr, size, alignment);
+    }
+  }
+}
+
+void TestMmapResourceDefault()
+{
+  thrust::mr::mmap_resource memres;
+  TestMmapResource(memres);
+}
+DECLARE_UNITTEST(TestMmapResourceDefault);
+
+void TestMmapResourceOptions()
+{
+  using thrust::mr::huge_page_policy;
+  using thrust::mr::prefault_policy;
+
+  const huge_page_policy huge_pages[] = {
+    huge_page_policy::none, huge_page_policy::transparent, huge_page_policy::hugetlb};
+  const prefault_policy prefaults[] = {prefault_policy::none, prefault_policy::populate, prefault_policy::touch};
+
+  // explicit huge pages are seldom reserved, so they also exercise the fallback to transparent huge pages
+  for (huge_page_policy huge_page : huge_pages)
+  {
+    for (prefault_policy prefault : prefaults)
+    {
+      thrust::mr::mmap_resource memres(make_options(huge_page, prefault));
+      TestMmapResource(memres);
+    }
+  }
+
+  // node 0 exists on every system, with or without NUMA support
+  thrust::mr::mmap_options options = make_options(huge_page_policy::transparent, prefault_policy::populate);
+  options.numa_node                = 0;
+  thrust::mr::mmap_resource memres(options);
+  TestMmapResource(memres);
+}
+DECLARE_UNITTEST(TestMmapResourceOptions);
+
+void TestMmapResourceTouchLarge()
+{
+  thrust::mr::mmap_resource memres(
+    make_options(thrust::mr::huge_page_policy::none, thrust::mr::prefault_policy::touch));
+
+  // large enough to be touched by several threads, with a partial last page
+  const std::size_t size = (std::size_t{64} << 20) + 100;
+  char* ptr              = static_cast<char*>(memres.allocate(size));
+  for (std::size_t offset = 0; offset < size; offset += std::size_t{1} << 20)
+  {
+    ASSERT_EQUAL(ptr[offset], char{});
+  }
+  ASSERT_EQUAL(ptr[size - 1], char{});
+
+  thrust::fill(ptr, ptr + size, char{1});
+  ASSERT_EQUAL(ptr[size - 1], char{1});
+  memres.deallocate(ptr, size);
+}
+DECLARE_UNITTEST(TestMmapResourceTouchLarge);
+
+void TestMmapResourceReallocate()
+{
+  thrust::mr::mmap_resource memres(
+    make_options(thrust::mr::huge_page_policy::transparent, thrust::mr::prefault_policy::populate));
+
+  // grow a mapping from a page to several huge pages, which keeps its contents and the alignment of a new mapping
+  const std::size_t small_size = 4000;
+  const std::size_t large_size = std::size_t{5} << 20;
+  int* ptr                     = static_cast<int*>(memres.allocate(small_size * sizeof(int)));
+  thrust::sequence(ptr, ptr + small_size);
+
+  ptr = static_cast<int*>(memres.do_reallocate(ptr, small_size * sizeof(int), large_size * sizeof(int), alignof(int)));
+  ASSERT_EQUAL(ptr != nullptr, true);
+  ASSERT_EQUAL(reinterpret_cast<std::size_t>(ptr) % memres.options().huge_page_size, 0u);
+  ASSERT_EQUAL(ptr[small_size - 1], static_cast<int>(small_size - 1));
+  ASSERT_EQUAL(ptr[large_size - 1], 0);
+  thrust::sequence(ptr, ptr + large_size);
+
+  // and shrink it back
+  ptr = static_cast<int*>(memres.do_reallocate(ptr, large_size * sizeof(int), small_size * sizeof(int), alignof(int)));
+  ASSERT_EQUAL(ptr[small_size - 1], static_cast<int>(small_size - 1));
+  memres.deallocate(ptr, small_size * sizeof(int), alignof(int));
+}
+DECLARE_UNITTEST(TestMmapResourceReallocate);
+
+void TestMmapResourceAsPoolUpstream()
+{
+  thrust::mr::mmap_resource upstream(
+    make_options(thrust::mr::huge_page_policy::transparent, thrust::mr::prefault_policy::touch));
+  thrust::mr::unsynchronized_pool_resource<thrust::mr::mmap_resource> pool(&upstream);
+
+  using allocator = thrust::mr::allocator<int, thrust::mr::unsynchronized_pool_resource<thrust::mr::mmap_resource>>;
+  thrust::host_vector<int, allocator> vec(1 << 20, allocator(&pool));
+  thrust::sequence(vec.begin(), vec.end());
+
+  ASSERT_EQUAL(vec[0], 0);
+  ASSERT_EQUAL(vec[(1 << 20) - 1], (1 << 20) - 1);
+}
+DECLARE_UNITTEST(TestMmapResourceAsPoolUpstream);
+
+#endif // !_CCCL_OS(WINDOWS)
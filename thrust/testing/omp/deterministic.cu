@@ -0,0 +1,144 @@
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+#include <thrust/mr/memory_resource.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/system/omp/execution_policy.h>
+
+#include <cuda/__execution/determinism.h>
+#include <cuda/__execution/require.h>
+
+#include <new>
+
+#include <omp.h>
+
+#include <unittest/unittest.h>
+
+namespace
+{
+auto deterministic_par()
+{
+  return thrust::omp::par.with(cuda::execution::require(cuda::execution::determinism::run_to_run));
+}
+
+struct counting_resource final : thrust::mr::memory_resource<>
+{
+  int allocations = 0;
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override
+  {
+    ++allocations;
+    return ::operator new(bytes, std::align_val_t(alignment));
+  }
+
+  void do_deallocate(void* ptr, std::size_t, std::size_t alignment) override
+  {
+    ::operator delete(ptr, std::align_val_t(alignment));
+  }
+};
+
+// values of very different magnitudes, so that the rounding of a float sum depends on the order of the additions
+thrust::host_vector<float> badly_conditioned_input(size_t n)
+{
+  thrust::host_vector<float> h_data(n);
+  unsigned int state = 0x12345u;
+  for (size_t i = 0; i < n; ++i)
+  {
+    state     = state * 1664525u + 1013904223u;
+    h_data[i] = static_cast<float>(state >> 8) * ((i % 7 == 0) ? 1.0e6f : 1.0e-3f);
+  }
+  return h_data;
+}
+} // namespace
+
+// The results must not depend on the number of threads
+void TestOmpDeterministicThreadCountInvariant()
+{
+  const size_t n = (1 << 20) + 123;
+  thrust::device_vector<float> data(badly_conditioned_input(n));
+
+  const int max_threads = omp_get_max_threads();
+
+  omp_set_num_threads(1);
+  const float reference_sum = thrust::reduce(deterministic_par(), data.begin(), data.end(), 0.5f);
+  thrust::device_vector<float> reference_inclusive(n);
+  thrust::device_vector<float> reference_exclusive(n);
+  thrust::inclusive_scan(deterministic_par(), data.begin(), data.end(), reference_inclusive.begin());
+  thrust::exclusive_scan(deterministic_par(), data.begin(), data.end(), reference_exclusive.begin(), 0.5f);
+
+  for (int num_threads : {2, 3, 8})
+  {
+    omp_set_num_threads(num_threads);
+
+    ASSERT_EQUAL(reference_sum, thrust::reduce(deterministic_par(), data.begin(), data.end(), 0.5f));
+
+    thrust::device_vector<float> result(n);
+    thrust::inclusive_scan(deterministic_par(), data.begin(), data.end(), result.begin());
+    ASSERT_EQUAL(reference_inclusive, result);
+    thrust::exclusive_scan(deterministic_par(), data.begin(), data.end(), result.begin(), 0.5f);
+    ASSERT_EQUAL(reference_exclusive, result);
+  }
+
+  omp_set_num_threads(max_threads);
+}
+DECLARE_UNITTEST(TestOmpDeterministicThreadCountInvariant);
+
+template <typename T>
+void TestOmpDeterministicMatchesSequential(const size_t n)
+{
+  thrust::host_vector<T> h_data(n);
+  thrust::sequence(h_data.begin(), h_data.end(), T{1});
+  thrust::device_vector<T> d_data(h_data);
+
+  ASSERT_EQUAL(thrust::reduce(h_data.begin(), h_data.end(), T{13}),
+               thrust::reduce(deterministic_par(), d_data.begin(), d_data.end(), T{13}));
+
+  thrust::host_vector<T> h_result(n);
+  thrust::device_vector<T> d_result(n);
+
+  thrust::inclusive_scan(h_data.begin(), h_data.end(), h_result.begin());
+  thrust::inclusive_scan(deterministic_par(), d_data.begin(), d_data.end(), d_result.begin());
+  ASSERT_EQUAL(h_result, d_result);
+
+  thrust::inclusive_scan(h_data.begin(), h_data.end(), h_result.begin(), T{13}, ::cuda::std::plus<>{});
+  thrust::inclusive_scan(deterministic_par(), d_data.begin(), d_data.end(), d_result.begin(), T{13}, ::cuda::std::plus<>{});
+  ASSERT_EQUAL(h_result, d_result);
+
+  thrust::exclusive_scan(h_data.begin(), h_data.end(), h_result.begin(), T{13});
+  thrust::exclusive_scan(deterministic_par(), d_data.begin(), d_data.end(), d_result.begin(), T{13});
+  ASSERT_EQUAL(h_result, d_result);
+
+  // in place
+  thrust::exclusive_scan(deterministic_par(), d_data.begin(), d_data.end(), d_data.begin(), T{13});
+  ASSERT_EQUAL(h_result, d_data);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestOmpDeterministicMatchesSequential);
+
+// The environment must be kept when the policy is also given an allocator, which must be used for the temporary storage
+void TestOmpDeterministicWithAllocator()
+{
+  counting_resource resource;
+  const auto policy = deterministic_par()(&resource);
+  static_assert(thrust::detail::requires_determinism_v<::cuda::std::remove_const_t<decltype(policy)>>);
+
+  const size_t n = (1 << 20) + 123;
+  thrust::device_vector<float> data(badly_conditioned_input(n));
+
+  const int max_threads = omp_get_max_threads();
+
+  omp_set_num_threads(1);
+  thrust::device_vector<float> reference(n);
+  thrust::inclusive_scan(deterministic_par(), data.begin(), data.end(), reference.begin());
+  const float reference_sum = thrust::reduce(deterministic_par(), data.begin(), data.end(), 0.5f);
+
+  omp_set_num_threads(3);
+  thrust::device_vector<float> result(n);
+  thrust::inclusive_scan(policy, data.begin(), data.end(), result.begin());
+  ASSERT_EQUAL(reference, result);
+  ASSERT_EQUAL(reference_sum, thrust::reduce(policy, data.begin(), data.end(), 0.5f));
+  ASSERT_EQUAL(true, resource.allocations > 0);
+
+  omp_set_num_threads(max_threads);
+}
+DECLARE_UNITTEST(TestOmpDeterministicWithAllocator);
@@ -0,0 +1,78 @@
+#include <thrust/device_vector.h>
+#include <thrust/equal.h>
+#include <thrust/find.h>
+#include <thrust/logical.h>
+#include <thrust/mismatch.h>
+
+#include <atomic>
+
+#include <omp.h>
+
+#include <unittest/unittest.h>
+
+struct counting_equal_to
+{
+  int value;
+  std::atomic<long long>* calls;
+
+  bool operator()(int x) const
+  {
+    calls->fetch_add(1, std::memory_order_relaxed);
+    return x == value;
+  }
+};
+
+// A match near the beginning must not cost a scan of the whole input
+void TestOmpFindIfStopsEarly()
+{
+  const int n = 1 << 24;
+  thrust::device_vector<int> data(n, 0);
+  data[3] = 1;
+
+  const int max_threads = omp_get_max_threads();
+
+  for (int num_threads : {1, 4})
+  {
+    omp_set_num_threads(num_threads);
+
+    std::atomic<long long> calls{0};
+    auto result = thrust::find_if(data.begin(), data.end(), counting_equal_to{1, &calls});
+    ASSERT_EQUAL(3, result - data.begin());
+    ASSERT_EQUAL(true, calls.load() < (1 << 20));
+
+    calls = 0;
+    ASSERT_EQUAL(true, thrust::any_of(data.begin(), data.end(), counting_equal_to{1, &calls}));
+    ASSERT_EQUAL(true, calls.load() < (1 << 20));
+  }
+
+  omp_set_num_threads(max_threads);
+}
+DECLARE_UNITTEST(TestOmpFindIfStopsEarly);
+
+// The earliest match wins, wherever the other matches are
+void TestOmpFindIfEarliestMatch()
+{
+  const int n = (1 << 20) + 17;
+  thrust::device_vector<int> data(n, 0);
+
+  for (int pos : {0, 255, 256, 4095, 4096, 100000, n - 1})
+  {
+    data[pos]   = 1;
+    data[n - 1] = 1;
+    for (int num_threads : {1, 2, 3, 8})
+    {
+      omp_set_num_threads(num_threads);
+      ASSERT_EQUAL(pos, thrust::find(data.begin(), data.end(), 1) - data.begin());
+      ASSERT_EQUAL(pos, thrust::mismatch(data.begin(), data.end(), thrust::device_vector<int>(n, 0).begin()).first
+                          - data.begin());
+      ASSERT_EQUAL(false, thrust::all_of(data.begin(), data.end(), thrust::placeholders::_1 == 0));
+    }
+    data[pos] = 0;
+  }
+
+  data[n - 1] = 0;
+  ASSERT_EQUAL(n, thrust::find(data.begin(), data.end(), 1) - data.begin());
+  ASSERT_EQUAL(true, thrust::none_of(data.begin(), data.end(), thrust::placeholders::_1 == 1));
+  ASSERT_EQUAL(true, thrust::equal(data.begin(), data.end(), thrust::device_vector<int>(n, 0).begin()));
+}
+DECLARE_UNITTEST(TestOmpFindIfEarliestMatch);
@@ -0,0 +1,41 @@
+#include <thrust/device_vector.h>
+#include <thrust/equal.h>
+#include <thrust/random.h>
+#include <thrust/sequence.h>
+#include <thrust/shuffle.h>
+#include <thrust/sort.h>
+
+#include <omp.h>
+
+#include <unittest/unittest.h>
+
+// The permutation must only depend on the seed, not on the number of threads
+void TestOmpShuffleThreadCountInvariant()
+{
+  const size_t n = (1 << 20) + 123;
+  thrust::device_vector<int> data(n);
+  thrust::sequence(data.begin(), data.end());
+
+  const int max_threads = omp_get_max_threads();
+
+  omp_set_num_threads(1);
+  thrust::device_vector<int> reference(n);
+  thrust::default_random_engine g(0xD5);
+  thrust::shuffle_copy(data.begin(), data.end(), reference.begin(), g);
+
+  for (int num_threads : {2, 3, 8})
+  {
+    omp_set_num_threads(num_threads);
+    thrust::device_vector<int> result(data);
+    g.seed(0xD5);
+    thrust::shuffle(result.begin(), result.end(), g);
+    ASSERT_EQUAL(reference, result);
+  }
+
+  omp_set_num_threads(max_threads);
+
+  ASSERT_EQUAL(false, thrust::equal(reference.begin(), reference.end(), data.begin()));
+  thrust::sort(reference.begin(), reference.end());
+  ASSERT_EQUAL(reference, data);
+}
+DECLARE_UNITTEST(TestOmpShuffleThreadCountInvariant);
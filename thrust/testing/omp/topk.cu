@@ -0,0 +1,77 @@
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/system/omp/execution_policy.h>
+#include <thrust/topk.h>
+
+#include <cuda/__execution/output_ordering.h>
+#include <cuda/__execution/require.h>
+
+#include <omp.h>
+
+#include <unittest/unittest.h>
+
+// The selected elements and their order must not depend on the number of threads, even with many ties
+void TestOmpTopkThreadCountInvariant()
+{
+  const size_t n = (1 << 20) + 123;
+  const size_t k = 1000;
+
+  thrust::device_vector<int> keys(unittest::random_integers<unsigned char>(n));
+  thrust::device_vector<int> values(n);
+  thrust::sequence(values.begin(), values.end());
+
+  const int max_threads = omp_get_max_threads();
+
+  omp_set_num_threads(1);
+  thrust::device_vector<int> reference_keys(k);
+  thrust::device_vector<int> reference_values(k);
+  thrust::topk_by_key(
+    thrust::omp::par, keys.begin(), keys.end(), values.begin(), reference_keys.begin(), reference_values.begin(), k);
+
+  for (int num_threads : {2, 3, 8})
+  {
+    omp_set_num_threads(num_threads);
+
+    thrust::device_vector<int> result_keys(k);
+    thrust::device_vector<int> result_values(k);
+    thrust::topk_by_key(
+      thrust::omp::par, keys.begin(), keys.end(), values.begin(), result_keys.begin(), result_values.begin(), k);
+    ASSERT_EQUAL(reference_keys, result_keys);
+    ASSERT_EQUAL(reference_values, result_values);
+  }
+
+  omp_set_num_threads(max_threads);
+}
+DECLARE_UNITTEST(TestOmpTopkThreadCountInvariant);
+
+// Unsorted output selects the same elements, in any order
+void TestOmpTopkUnsorted()
+{
+  const size_t n = (1 << 20) + 123;
+  const size_t k = 100;
+
+  thrust::device_vector<int> keys(unittest::random_integers<int>(n));
+  thrust::device_vector<int> values(n);
+  thrust::sequence(values.begin(), values.end());
+
+  thrust::device_vector<int> sorted_keys(k);
+  thrust::device_vector<int> sorted_values(k);
+  thrust::topk_by_key(
+    thrust::omp::par, keys.begin(), keys.end(), values.begin(), sorted_keys.begin(), sorted_values.begin(), k);
+
+  const auto unsorted_par =
+    thrust::omp::par.with(cuda::execution::require(cuda::execution::output_ordering::unsorted));
+  thrust::device_vector<int> unsorted_keys(k);
+  thrust::device_vector<int> unsorted_values(k);
+  auto ends = thrust::topk_by_key(
+    unsorted_par, keys.begin(), keys.end(), values.begin(), unsorted_keys.begin(), unsorted_values.begin(), k);
+  ASSERT_EQUAL(true, ends.first == unsorted_keys.end());
+
+  thrust::stable_sort_by_key(unsorted_values.begin(), unsorted_values.end(), unsorted_keys.begin());
+  thrust::stable_sort_by_key(sorted_values.begin(), sorted_values.end(), sorted_keys.begin());
+  ASSERT_EQUAL(sorted_values, unsorted_values);
+  ASSERT_EQUAL(sorted_keys, unsorted_keys);
+}
+DECLARE_UNITTEST(TestOmpTopkUnsorted);
@@ -0,0 +1,325 @@
+#include <thrust/copy.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/pipeline.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <unittest/unittest.h>
+
+template <typename T>
+struct triple_plus_one
+{
+  _CCCL_HOST_DEVICE T operator()(T x) const
+  {
+    return 3 * x + 1;
+  }
+};
+
+template <typename T>
+struct is_multiple_of_four
+{
+  _CCCL_HOST_DEVICE bool operator()(T x) const
+  {
+    return x % 4 == 0;
+  }
+};
+
+// an associative operator which is not commutative, so the elements must be combined in order
+struct first_odd
+{
+  _CCCL_HOST_DEVICE long long operator()(long long a, long long b) const
+  {
+    return a % 2 != 0 ? a : b;
+  }
+};
+
+struct key_of_index
+{
+  int run_size;
+
+  _CCCL_HOST_DEVICE thrust::tuple<int, long long> operator()(thrust::tuple<int, long long> x) const
+  {
+    return thrust::make_tuple(thrust::get<0>(x) / run_size, thrust::get<1>(x));
+  }
+};
+
+// drops every element of some runs of keys, which leaves some tiles empty
+struct is_kept
+{
+  _CCCL_HOST_DEVICE bool operator()(thrust::tuple<int, long long> x) const
+  {
+    return thrust::get<0>(x) % 7 != 3 && thrust::get<1>(x) % 5 != 0;
+  }
+};
+
+struct to_reversed_position
+{
+  int size;
+
+  _CCCL_HOST_DEVICE thrust::tuple<long long, int> operator()(int i) const
+  {
+    return thrust::make_tuple(static_cast<long long>(i) * i, size - 1 - i);
+  }
+};
+
+template <typename T, typename Policy>
+void TestPipelineCopyAndReduce(Policy policy, size_t n)
+{
+  thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+
+  // the chain of algorithms that the pipeline fuses
+  thrust::host_vector<T> h_mapped(n);
+  thrust::transform(h_data.begin(), h_data.end(), h_mapped.begin(), triple_plus_one<T>{});
+  thrust::host_vector<T> h_ref(n);
+  h_ref.resize(
+    thrust::copy_if(h_mapped.begin(), h_mapped.end(), h_ref.begin(), is_multiple_of_four<T>{}) - h_ref.begin());
+  thrust::host_vector<T> h_scanned(h_ref.size());
+  thrust::inclusive_scan(h_ref.begin(), h_ref.end(), h_scanned.begin());
+
+  const auto stages = thrust::pipeline<>{}.map(triple_plus_one<T>{}).filter(is_multiple_of_four<T>{});
+
+  thrust::host_vector<T> h_result(n);
+  h_result.resize(stages.copy(policy, h_data.begin(), h_data.end(), h_result.begin()) - h_result.begin());
+  ASSERT_EQUAL(h_ref, h_result);
+
+  h_result.resize(n);
+  h_result.resize(stages.scan().copy(policy, h_data.begin(), h_data.end(), h_result.begin()) - h_result.begin());
+  ASSERT_EQUAL(h_scanned, h_result);
+
+  ASSERT_EQUAL(thrust::reduce(h_ref.begin(), h_ref.end(), T(5)),
+               stages.reduce(policy, h_data.begin(), h_data.end(), T(5)));
+}
+
+template <typename T>
+void TestPipelineCopyAndReduce(size_t n)
+{
+  TestPipelineCopyAndReduce<T>(thrust::host, n);
+  // the pipelines run on the host systems only
+#if THRUST_DEVICE_SYSTEM != THRUST_DEVICE_SYSTEM_CUDA
+  TestPipelineCopyAndReduce<T>(thrust::device, n);
+#endif
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestPipelineCopyAndReduce);
+
+template <typename Policy>
+void TestPipelineScansInOrder(Policy policy)
+{
+  // enough elements for many tiles
+  const size_t n                        = 100000;
+  thrust::host_vector<long long> h_data = unittest::random_integers<long long>(n);
+
+  thrust::host_vector<long long> h_ref(n);
+  thrust::inclusive_scan(h_data.begin(), h_data.end(), h_ref.begin(), first_odd{});
+  thrust::inclusive_scan(h_ref.begin(), h_ref.end(), h_ref.begin());
+
+  const auto stages = thrust::pipeline<>{}.scan(first_odd{}).scan();
+
+  thrust::host_vector<long long> h_result(n);
+  ASSERT_EQUAL(n, size_t(stages.copy(policy, h_data.begin(), h_data.end(), h_result.begin()) - h_result.begin()));
+  ASSERT_EQUAL(h_ref, h_result);
+
+  ASSERT_EQUAL(thrust::reduce(h_data.begin(), h_data.end(), 2LL, first_odd{}),
+               thrust::pipeline<>{}.reduce(policy, h_data.begin(), h_data.end(), 2LL, first_odd{}));
+
+  // no element reaches the terminal
+  const auto dropping_stages = stages.filter(is_multiple_of_four<long long>{})
+                                 .map(triple_plus_one<long long>{})
+                                 .filter(is_multiple_of_four<long long>{});
+  ASSERT_EQUAL(7LL, dropping_stages.reduce(policy, h_data.begin(), h_data.end(), 7LL));
+  ASSERT_EQUAL(7LL, stages.reduce(policy, h_data.begin(), h_data.begin(), 7LL));
+}
+
+void TestPipelineScansInOrder()
+{
+  TestPipelineScansInOrder(thrust::host);
+#if THRUST_DEVICE_SYSTEM != THRUST_DEVICE_SYSTEM_CUDA
+  TestPipelineScansInOrder(thrust::device);
+#endif
+}
+DECLARE_UNITTEST(TestPipelineScansInOrder);
+
+template <typename Policy>
+void TestPipelineReduceByKeyAndScatter(Policy policy)
+{
+  const int n = 100000;
+
+  // runs of every length, from single elements to runs spanning many tiles
+  for (int run_size : {1, 3, 1000, 30000})
+  {
+    thrust::host_vector<long long> h_values = unittest::random_integers<long long>(n);
+    auto first = thrust::make_zip_iterator(thrust::counting_iterator<int>(0), h_values.begin());
+
+    thrust::host_vector<thrust::tuple<int, long long>> h_pairs(n);
+    thrust::transform(first, first + n, h_pairs.begin(), key_of_index{run_size});
+    h_pairs.resize(thrust::copy_if(h_pairs.begin(), h_pairs.end(), h_pairs.begin(), is_kept{}) - h_pairs.begin());
+    thrust::host_vector<int> h_keys(h_pairs.size());
+    thrust::host_vector<long long> h_sums(h_pairs.size());
+    thrust::copy(h_pairs.begin(), h_pairs.end(), thrust::make_zip_iterator(h_keys.begin(), h_sums.begin()));
+
+    thrust::host_vector<int> h_ref_keys(n);
+    thrust::host_vector<long long> h_ref_values(n);
+    const auto ref_ends = thrust::reduce_by_key(
+      h_keys.begin(),
+      h_keys.end(),
+      h_sums.begin(),
+      h_ref_keys.begin(),
+      h_ref_values.begin(),
+      thrust::equal_to<int>{},
+      first_odd{});
+    h_ref_keys.resize(ref_ends.first - h_ref_keys.begin());
+    h_ref_values.resize(ref_ends.second - h_ref_values.begin());
+
+    thrust::host_vector<int> h_result_keys(n);
+    thrust::host_vector<long long> h_result_values(n);
+    const auto ends = thrust::pipeline<>{}.map(key_of_index{run_size}).filter(is_kept{}).reduce_by_key(
+      policy, first, first + n, h_result_keys.begin(), h_result_values.begin(), thrust::equal_to<int>{}, first_odd{});
+    h_result_keys.resize(ends.first - h_result_keys.begin());
+    h_result_values.resize(ends.second - h_result_values.begin());
+
+    ASSERT_EQUAL(h_ref_keys, h_result_keys);
+    ASSERT_EQUAL(h_ref_values, h_result_values);
+  }
+
+  thrust::host_vector<long long> h_ref(n);
+  for (int i = 0; i < n; ++i)
+  {
+    h_ref[n - 1 - i] = static_cast<long long>(i) * i;
+  }
+
+  thrust::host_vector<long long> h_result(n);
+  thrust::pipeline<>{}.map(to_reversed_position{n}).scatter(
+    policy, thrust::counting_iterator<int>(0), thrust::counting_iterator<int>(n), h_result.begin());
+  ASSERT_EQUAL(h_ref, h_result);
+}
+
+void TestPipelineReduceByKeyAndScatter()
+{
+  TestPipelineReduceByKeyAndScatter(thrust::host);
+#if THRUST_DEVICE_SYSTEM != THRUST_DEVICE_SYSTEM_CUDA
+  TestPipelineReduceByKeyAndScatter(thrust::device);
+#endif
+}
+DECLARE_UNITTEST(TestPipelineReduceByKeyAndScatter);
+
+// a predicate which is not transitive, so the runs depend on comparing each key with the previous one
+struct is_adjacent
+{
+  _CCCL_HOST_DEVICE bool operator()(int a, int b) const
+  {
+    return b - a == 1;
+  }
+};
+
+struct key_and_one
+{
+  _CCCL_HOST_DEVICE thrust::tuple<int, long long> operator()(int key) const
+  {
+    return thrust::make_tuple(key, 1ll);
+  }
+};
+
+template <typename Policy>
+void TestPipelineReduceByKeyComparesConsecutiveKeys(Policy policy)
+{
+  // runs of consecutive integers, some of which span many tiles
+  const int n = 100000;
+  thrust::host_vector<int> h_keys(n);
+  thrust::host_vector<int> h_ref_keys;
+  thrust::host_vector<long long> h_ref_counts;
+  for (int i = 0, run = 0; i < n; ++run)
+  {
+    const int run_size = (run % 3 == 0) ? 20000 : run % 5 + 1;
+    h_ref_keys.push_back(2 * i);
+    h_ref_counts.push_back(0);
+    for (int j = 0; j < run_size && i < n; ++j, ++i)
+    {
+      h_keys[i] = 2 * (i - j) + j;
+      ++h_ref_counts.back();
+    }
+  }
+
+  thrust::host_vector<int> h_result_keys(n);
+  thrust::host_vector<long long> h_result_counts(n);
+  const auto ends = thrust::pipeline<>{}.map(key_and_one{}).reduce_by_key(
+    policy,
+    h_keys.begin(),
+    h_keys.end(),
+    h_result_keys.begin(),
+    h_result_counts.begin(),
+    is_adjacent{},
+    ::cuda::std::plus<long long>{});
+  h_result_keys.resize(ends.first - h_result_keys.begin());
+  h_result_counts.resize(ends.second - h_result_counts.begin());
+
+  ASSERT_EQUAL(h_ref_keys, h_result_keys);
+  ASSERT_EQUAL(h_ref_counts, h_result_counts);
+}
+
+void TestPipelineReduceByKeyComparesConsecutiveKeys()
+{
+  TestPipelineReduceByKeyComparesConsecutiveKeys(thrust::host);
+#if THRUST_DEVICE_SYSTEM != THRUST_DEVICE_SYSTEM_CUDA
+  TestPipelineReduceByKeyComparesConsecutiveKeys(thrust::device);
+#endif
+}
+DECLARE_UNITTEST(TestPipelineReduceByKeyComparesConsecutiveKeys);
+
+struct pipeline_error
+{};
+
+struct throws_at
+{
+  int position;
+
+  int operator()(int i) const
+  {
+    if (i == position)
+    {
+      throw pipeline_error{};
+    }
+    return i;
+  }
+};
+
+template <typename Policy>
+void TestPipelinePropagatesExceptions(Policy policy)
+{
+  const int n = 1000000;
+  thrust::host_vector<int> h_result(n);
+
+  // in the first tile, the others wait for its carry; in the middle, some tiles are claimed after it
+  for (int position : {0, n / 2, n - 1})
+  {
+    bool thrown = false;
+    try
+    {
+      thrust::pipeline<>{}
+        .map(throws_at{position})
+        .scan(::cuda::std::plus<int>{})
+        .copy(policy, thrust::counting_iterator<int>(0), thrust::counting_iterator<int>(n), h_result.begin());
+    }
+    catch (const pipeline_error&)
+    {
+      thrown = true;
+    }
+    ASSERT_EQUAL(thrown, true);
+  }
+
+  // the pipelines run normally after a failed one
+  const int sum = thrust::pipeline<>{}.map(throws_at{-1}).reduce(
+    policy, thrust::counting_iterator<int>(0), thrust::counting_iterator<int>(1000), 0, ::cuda::std::plus<int>{});
+  ASSERT_EQUAL(sum, 499500);
+}
+
+void TestPipelinePropagatesExceptions()
+{
+  TestPipelinePropagatesExceptions(thrust::host);
+#if THRUST_DEVICE_SYSTEM != THRUST_DEVICE_SYSTEM_CUDA
+  TestPipelinePropagatesExceptions(thrust::device);
+#endif
+}
+DECLARE_UNITTEST(TestPipelinePropagatesExceptions);
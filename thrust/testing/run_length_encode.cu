@@ -0,0 +1,236 @@
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/host_vector.h>
+#include <thrust/reduce.h>
+#include <thrust/run_length_encode.h>
+#include <thrust/scan.h>
+
+#include <cuda/iterator>
+
+#include <unittest/unittest.h>
+
+template <typename T>
+struct is_equal_div_10
+{
+  _CCCL_HOST_DEVICE bool operator()(const T x, const T& y) const
+  {
+    return ((int) x / 10) == ((int) y / 10);
+  }
+};
+
+// runs of random lengths, some of them far longer than the chunks of the parallel systems
+template <typename T>
+thrust::host_vector<T> random_runs(size_t n)
+{
+  thrust::host_vector<unsigned int> lengths = unittest::random_integers<unsigned int>(n);
+  thrust::host_vector<T> values             = unittest::random_integers<T>(n);
+
+  thrust::host_vector<T> h_data(n);
+  for (size_t i = 0, run = 0; i < n; ++run)
+  {
+    const unsigned int length = 1 + (lengths[run] % 64 == 0 ? lengths[run] % 100000 : lengths[run] % 4);
+    for (size_t j = 0; j < length && i < n; ++j, ++i)
+    {
+      h_data[i] = values[run];
+    }
+  }
+  return h_data;
+}
+
+template <class Vector>
+void TestRunLengthEncodeSimple()
+{
+  using T = typename Vector::value_type;
+
+  Vector data{0, 2, 2, 9, 5, 5, 5, 8};
+  Vector unique(8);
+  thrust::device_vector<int> counts(8);
+
+  auto ends = thrust::run_length_encode(data.begin(), data.end(), unique.begin(), counts.begin());
+
+  ASSERT_EQUAL(5, ends.first - unique.begin());
+  ASSERT_EQUAL(5, ends.second - counts.begin());
+
+  unique.resize(5);
+  counts.resize(5);
+
+  Vector unique_ref{0, 2, 9, 5, 8};
+  thrust::device_vector<int> counts_ref{1, 2, 1, 3, 1};
+  ASSERT_EQUAL(unique_ref, unique);
+  ASSERT_EQUAL(counts_ref, counts);
+
+  // runs of equivalent elements begin with their first element
+  data = Vector{11, 15, 21, 3, 5, 7, 42};
+  unique.resize(7);
+  counts.resize(7);
+
+  ends = thrust::run_length_encode(data.begin(), data.end(), unique.begin(), counts.begin(), is_equal_div_10<T>());
+
+  ASSERT_EQUAL(4, ends.first - unique.begin());
+  unique.resize(4);
+  counts.resize(4);
+
+  unique_ref = Vector{11, 21, 3, 42};
+  counts_ref = {2, 1, 3, 1};
+  ASSERT_EQUAL(unique_ref, unique);
+  ASSERT_EQUAL(counts_ref, counts);
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestRunLengthEncodeSimple);
+
+void TestRunLengthEncodeEmpty()
+{
+  thrust::device_vector<int> data;
+  thrust::device_vector<int> unique(1);
+  thrust::device_vector<int> counts(1);
+
+  auto ends = thrust::run_length_encode(data.begin(), data.end(), unique.begin(), counts.begin());
+  ASSERT_EQUAL(true, ends.first == unique.begin());
+  ASSERT_EQUAL(true, ends.second == counts.begin());
+
+  ends = thrust::non_trivial_runs(data.begin(), data.end(), unique.begin(), counts.begin());
+  ASSERT_EQUAL(true, ends.first == unique.begin());
+  ASSERT_EQUAL(true, ends.second == counts.begin());
+}
+DECLARE_UNITTEST(TestRunLengthEncodeEmpty);
+
+template <typename T>
+void TestRunLengthEncode(size_t n)
+{
+  thrust::host_vector<T> h_data   = random_runs<T>(n);
+  thrust::device_vector<T> d_data = h_data;
+
+  thrust::host_vector<T> h_unique(n);
+  thrust::host_vector<size_t> h_counts(n);
+  auto h_ends = thrust::reduce_by_key(
+    h_data.begin(), h_data.end(), ::cuda::constant_iterator<size_t>(1), h_unique.begin(), h_counts.begin());
+  h_unique.resize(h_ends.first - h_unique.begin());
+  h_counts.resize(h_ends.second - h_counts.begin());
+
+  thrust::device_vector<T> d_unique(n);
+  thrust::device_vector<size_t> d_counts(n);
+  auto d_ends = thrust::run_length_encode(d_data.begin(), d_data.end(), d_unique.begin(), d_counts.begin());
+  d_unique.resize(d_ends.first - d_unique.begin());
+  d_counts.resize(d_ends.second - d_counts.begin());
+
+  ASSERT_EQUAL(h_unique, d_unique);
+  ASSERT_EQUAL(h_counts, d_counts);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestRunLengthEncode);
+
+template <class Vector>
+void TestNonTrivialRunsSimple()
+{
+  using T = typename Vector::value_type;
+
+  Vector data{0, 2, 2, 9, 5, 5, 5, 8};
+  thrust::device_vector<int> offsets(8);
+  thrust::device_vector<int> lengths(8);
+
+  auto ends = thrust::non_trivial_runs(data.begin(), data.end(), offsets.begin(), lengths.begin());
+
+  ASSERT_EQUAL(2, ends.first - offsets.begin());
+  ASSERT_EQUAL(2, ends.second - lengths.begin());
+
+  offsets.resize(2);
+  lengths.resize(2);
+
+  thrust::device_vector<int> offsets_ref{1, 4};
+  thrust::device_vector<int> lengths_ref{2, 3};
+  ASSERT_EQUAL(offsets_ref, offsets);
+  ASSERT_EQUAL(lengths_ref, lengths);
+
+  data = Vector{11, 15, 21, 3, 5, 7, 42};
+  offsets.resize(7);
+  lengths.resize(7);
+
+  ends = thrust::non_trivial_runs(data.begin(), data.end(), offsets.begin(), lengths.begin(), is_equal_div_10<T>());
+
+  ASSERT_EQUAL(2, ends.first - offsets.begin());
+  offsets.resize(2);
+  lengths.resize(2);
+
+  offsets_ref = {0, 3};
+  lengths_ref = {2, 3};
+  ASSERT_EQUAL(offsets_ref, offsets);
+  ASSERT_EQUAL(lengths_ref, lengths);
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestNonTrivialRunsSimple);
+
+template <typename T>
+void TestNonTrivialRuns(size_t n)
+{
+  thrust::host_vector<T> h_data   = random_runs<T>(n);
+  thrust::device_vector<T> d_data = h_data;
+
+  thrust::host_vector<size_t> h_offsets;
+  thrust::host_vector<size_t> h_lengths;
+  for (size_t i = 0; i < n;)
+  {
+    const size_t head = i++;
+    while (i < n && h_data[i] == h_data[head])
+    {
+      ++i;
+    }
+    if (i - head > 1)
+    {
+      h_offsets.push_back(head);
+      h_lengths.push_back(i - head);
+    }
+  }
+
+  thrust::device_vector<size_t> d_offsets(n);
+  thrust::device_vector<size_t> d_lengths(n);
+  auto d_ends = thrust::non_trivial_runs(d_data.begin(), d_data.end(), d_offsets.begin(), d_lengths.begin());
+  d_offsets.resize(d_ends.first - d_offsets.begin());
+  d_lengths.resize(d_ends.second - d_lengths.begin());
+
+  ASSERT_EQUAL(h_offsets, d_offsets);
+  ASSERT_EQUAL(h_lengths, d_lengths);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestNonTrivialRuns);
+
+// A mostly constant column, whose runs span many chunks of the parallel systems, with runs of two elements which
+// straddle the chunk boundaries
+void TestRunsAcrossChunks()
+{
+  const size_t n = 1 << 20;
+  thrust::host_vector<int> h_data(n, 0);
+  for (size_t i = 1 << 16; i < n; i += 1 << 16)
+  {
+    h_data[i - 1] = static_cast<int>(i >> 16);
+    h_data[i]     = static_cast<int>(i >> 16);
+  }
+  h_data[n - 1] = -1;
+  thrust::device_vector<int> d_data = h_data;
+
+  thrust::host_vector<int> h_unique(n);
+  thrust::host_vector<size_t> h_counts(n);
+  auto h_ends = thrust::reduce_by_key(
+    h_data.begin(), h_data.end(), ::cuda::constant_iterator<size_t>(1), h_unique.begin(), h_counts.begin());
+  h_unique.resize(h_ends.first - h_unique.begin());
+  h_counts.resize(h_ends.second - h_counts.begin());
+
+  thrust::device_vector<int> d_unique(n);
+  thrust::device_vector<size_t> d_counts(n);
+  auto d_ends = thrust::run_length_encode(d_data.begin(), d_data.end(), d_unique.begin(), d_counts.begin());
+  d_unique.resize(d_ends.first - d_unique.begin());
+  d_counts.resize(d_ends.second - d_counts.begin());
+
+  ASSERT_EQUAL(h_unique, d_unique);
+  ASSERT_EQUAL(h_counts, d_counts);
+
+  // every run is non-trivial but the last one
+  thrust::host_vector<size_t> h_offsets(h_counts.size() - 1);
+  thrust::exclusive_scan(h_counts.begin(), h_counts.end() - 1, h_offsets.begin());
+  h_counts.pop_back();
+
+  thrust::device_vector<size_t> d_offsets(n);
+  thrust::device_vector<size_t> d_lengths(n);
+  auto d_runs_ends = thrust::non_trivial_runs(d_data.begin(), d_data.end(), d_offsets.begin(), d_lengths.begin());
+  d_offsets.resize(d_runs_ends.first - d_offsets.begin());
+  d_lengths.resize(d_runs_ends.second - d_lengths.begin());
+
+  ASSERT_EQUAL(h_offsets, d_offsets);
+  ASSERT_EQUAL(h_counts, d_lengths);
+}
+DECLARE_UNITTEST(TestRunsAcrossChunks);
@@ -0,0 +1,173 @@
+#include <thrust/execution_policy.h>
+#include <thrust/extrema.h>
+#include <thrust/reduce.h>
+#include <thrust/segmented_reduce.h>
+
+#include <cuda/functional>
+#include <cuda/std/functional>
+
+#include <unittest/unittest.h>
+
+// an associative operator which is not commutative
+template <typename T>
+struct take_last
+{
+  _CCCL_HOST_DEVICE T operator()(T, T rhs) const
+  {
+    return rhs;
+  }
+};
+
+template <class Vector>
+void TestSegmentedReduceSimple()
+{
+  using T = typename Vector::value_type;
+
+  Vector values{1, 2, 3, 4, 5, 6};
+  Vector offsets{0, 3, 3, 6};
+  Vector result(3);
+
+  auto end = thrust::segmented_reduce(offsets.begin(), offsets.end(), values.begin(), result.begin());
+
+  Vector ref{6, 0, 15};
+  ASSERT_EQUAL_QUIET(result.end(), end);
+  ASSERT_EQUAL(ref, result);
+
+  thrust::segmented_reduce(offsets.begin(), offsets.end(), values.begin(), result.begin(), T(10));
+
+  ref = Vector{16, 10, 25};
+  ASSERT_EQUAL(ref, result);
+
+  thrust::segmented_reduce(offsets.begin(), offsets.end(), values.begin(), result.begin(), T(0), ::cuda::maximum<T>{});
+
+  ref = Vector{3, 0, 6};
+  ASSERT_EQUAL(ref, result);
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestSegmentedReduceSimple);
+
+template <class Vector>
+void TestSegmentedArgMinMaxSimple()
+{
+  Vector values{4, 1, 1, 7, 5, 7};
+  Vector offsets{0, 3, 3, 6};
+  Vector result(3);
+
+  auto end = thrust::segmented_arg_min(offsets.begin(), offsets.end(), values.begin(), result.begin());
+
+  Vector ref{1, 0, 1};
+  ASSERT_EQUAL_QUIET(result.end(), end);
+  ASSERT_EQUAL(ref, result);
+
+  thrust::segmented_arg_max(offsets.begin(), offsets.end(), values.begin(), result.begin());
+
+  ref = Vector{0, 0, 0};
+  ASSERT_EQUAL(ref, result);
+
+  thrust::segmented_arg_max(
+    thrust::device, offsets.begin(), offsets.end(), values.begin(), result.begin(), ::cuda::std::greater<>{});
+
+  ref = Vector{1, 0, 1};
+  ASSERT_EQUAL(ref, result);
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestSegmentedArgMinMaxSimple);
+
+void TestSegmentedReduceEmpty()
+{
+  thrust::device_vector<int> values{3, 2, 1};
+  thrust::device_vector<int> result{-1, -1};
+
+  // no offsets and a single offset are no segments
+  thrust::device_vector<int> offsets;
+  auto end = thrust::segmented_reduce(offsets.begin(), offsets.end(), values.begin(), result.begin());
+  ASSERT_EQUAL_QUIET(result.begin(), end);
+
+  offsets = thrust::device_vector<int>{1};
+  end     = thrust::segmented_arg_min(offsets.begin(), offsets.end(), values.begin(), result.begin());
+  ASSERT_EQUAL_QUIET(result.begin(), end);
+
+  // the elements outside of the segments are not reduced
+  offsets = thrust::device_vector<int>{1, 1, 3};
+  thrust::segmented_reduce(offsets.begin(), offsets.end(), values.begin(), result.begin());
+
+  thrust::device_vector<int> ref{0, 3};
+  ASSERT_EQUAL(ref, result);
+}
+DECLARE_UNITTEST(TestSegmentedReduceEmpty);
+
+// segments of sizes from empty to most of the input, which is skewed like the rows of a sparse matrix
+thrust::host_vector<int> random_skewed_offsets(size_t n)
+{
+  thrust::host_vector<unsigned int> h_sizes = unittest::random_integers<unsigned int>(n + 1);
+  thrust::host_vector<int> h_offsets(1, 0);
+  while (h_offsets.back() < static_cast<int>(n))
+  {
+    const unsigned int r = h_sizes[h_offsets.size() % h_sizes.size()];
+    const int max_size   = r % 16 == 0 ? static_cast<int>(n) : r % 4 == 0 ? 1000 : r % 2 == 0 ? 20 : 0;
+    const int size       = static_cast<int>(r / 16 % (max_size + 1));
+    const int remaining  = static_cast<int>(n) - h_offsets.back();
+    h_offsets.push_back(h_offsets.back() + (::cuda::std::min) (size, remaining));
+  }
+  return h_offsets;
+}
+
+template <typename T>
+void TestSegmentedReduce(size_t n)
+{
+  thrust::host_vector<T> h_values    = unittest::random_integers<T>(n);
+  thrust::host_vector<int> h_offsets = random_skewed_offsets(n);
+  const size_t num_segments          = h_offsets.size() - 1;
+
+  thrust::device_vector<T> d_values    = h_values;
+  thrust::device_vector<int> d_offsets = h_offsets;
+
+  thrust::host_vector<T> h_sums(num_segments);
+  thrust::host_vector<T> h_lasts(num_segments);
+  for (size_t segment = 0; segment < num_segments; ++segment)
+  {
+    const auto first = h_values.begin() + h_offsets[segment];
+    const auto last  = h_values.begin() + h_offsets[segment + 1];
+    h_sums[segment]  = thrust::reduce(first, last, T(13));
+    h_lasts[segment] = first == last ? T(13) : *(last - 1);
+  }
+
+  thrust::device_vector<T> d_result(num_segments);
+
+  thrust::segmented_reduce(d_offsets.begin(), d_offsets.end(), d_values.begin(), d_result.begin(), T(13));
+  ASSERT_EQUAL(h_sums, d_result);
+
+  // the pieces of the segments split among several threads are combined in order
+  thrust::segmented_reduce(
+    d_offsets.begin(), d_offsets.end(), d_values.begin(), d_result.begin(), T(13), take_last<T>{});
+  ASSERT_EQUAL(h_lasts, d_result);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestSegmentedReduce);
+
+template <typename T>
+void TestSegmentedArgMinMax(size_t n)
+{
+  thrust::host_vector<T> h_values    = unittest::random_integers<T>(n);
+  thrust::host_vector<int> h_offsets = random_skewed_offsets(n);
+  const size_t num_segments          = h_offsets.size() - 1;
+
+  thrust::device_vector<T> d_values    = h_values;
+  thrust::device_vector<int> d_offsets = h_offsets;
+
+  thrust::host_vector<int> h_arg_min(num_segments);
+  thrust::host_vector<int> h_arg_max(num_segments);
+  for (size_t segment = 0; segment < num_segments; ++segment)
+  {
+    const auto first   = h_values.begin() + h_offsets[segment];
+    const auto last    = h_values.begin() + h_offsets[segment + 1];
+    h_arg_min[segment] = static_cast<int>(thrust::min_element(first, last) - first);
+    h_arg_max[segment] = static_cast<int>(thrust::max_element(first, last) - first);
+  }
+
+  thrust::device_vector<int> d_result(num_segments);
+
+  thrust::segmented_arg_min(d_offsets.begin(), d_offsets.end(), d_values.begin(), d_result.begin());
+  ASSERT_EQUAL(h_arg_min, d_result);
+
+  thrust::segmented_arg_max(d_offsets.begin(), d_offsets.end(), d_values.begin(), d_result.begin());
+  ASSERT_EQUAL(h_arg_max, d_result);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestSegmentedArgMinMax);
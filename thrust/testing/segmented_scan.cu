@@ -0,0 +1,123 @@
+#include <thrust/execution_policy.h>
+#include <thrust/scan.h>
+#include <thrust/segmented_scan.h>
+
+#include <cuda/functional>
+
+#include <unittest/unittest.h>
+
+// an associative operator which is not commutative
+template <typename T>
+struct take_last
+{
+  _CCCL_HOST_DEVICE T operator()(T, T rhs) const
+  {
+    return rhs;
+  }
+};
+
+template <class Vector>
+void TestSegmentedInclusiveScanSimple()
+{
+  using T = typename Vector::value_type;
+
+  Vector data{1, 2, 3, 4, 5, 6, 7};
+  Vector offsets{0, 3, 3, 6};
+  Vector result(7, T(9));
+
+  auto end = thrust::segmented_inclusive_scan(offsets.begin(), offsets.end(), data.begin(), result.begin());
+
+  // the element after the last segment is not written
+  Vector ref{1, 3, 6, 4, 9, 15, 9};
+  ASSERT_EQUAL_QUIET(result.begin() + 6, end);
+  ASSERT_EQUAL(ref, result);
+
+  thrust::segmented_inclusive_scan(
+    thrust::device, offsets.begin(), offsets.end(), data.begin(), data.begin(), ::cuda::maximum<T>{});
+
+  ref = Vector{1, 2, 3, 4, 5, 6, 7};
+  ASSERT_EQUAL(ref, data);
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestSegmentedInclusiveScanSimple);
+
+template <class Vector>
+void TestSegmentedExclusiveScanSimple()
+{
+  using T = typename Vector::value_type;
+
+  Vector data{1, 2, 3, 4, 5, 6};
+  Vector offsets{0, 3, 3, 6};
+  Vector result(6);
+
+  auto end = thrust::segmented_exclusive_scan(offsets.begin(), offsets.end(), data.begin(), result.begin());
+
+  Vector ref{0, 1, 3, 0, 4, 9};
+  ASSERT_EQUAL_QUIET(result.end(), end);
+  ASSERT_EQUAL(ref, result);
+
+  thrust::segmented_exclusive_scan(offsets.begin(), offsets.end(), data.begin(), result.begin(), T(10));
+
+  ref = Vector{10, 11, 13, 10, 14, 19};
+  ASSERT_EQUAL(ref, result);
+
+  // in place
+  thrust::segmented_exclusive_scan(
+    offsets.begin(), offsets.end(), data.begin(), data.begin(), T(10), take_last<T>{});
+
+  ref = Vector{10, 1, 2, 10, 4, 5};
+  ASSERT_EQUAL(ref, data);
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestSegmentedExclusiveScanSimple);
+
+// segments of sizes from empty to most of the input, which is skewed like the rows of a sparse matrix
+thrust::host_vector<int> random_skewed_offsets(size_t n)
+{
+  thrust::host_vector<unsigned int> h_sizes = unittest::random_integers<unsigned int>(n + 1);
+  thrust::host_vector<int> h_offsets(1, 0);
+  while (h_offsets.back() < static_cast<int>(n))
+  {
+    const unsigned int r = h_sizes[h_offsets.size() % h_sizes.size()];
+    const int max_size   = r % 16 == 0 ? static_cast<int>(n) : r % 4 == 0 ? 1000 : r % 2 == 0 ? 20 : 0;
+    const int size       = static_cast<int>(r / 16 % (max_size + 1));
+    const int remaining  = static_cast<int>(n) - h_offsets.back();
+    h_offsets.push_back(h_offsets.back() + (::cuda::std::min) (size, remaining));
+  }
+  return h_offsets;
+}
+
+template <typename T>
+void TestSegmentedScan(size_t n)
+{
+  thrust::host_vector<T> h_data      = unittest::random_integers<T>(n);
+  thrust::host_vector<int> h_offsets = random_skewed_offsets(n);
+
+  thrust::device_vector<T> d_data      = h_data;
+  thrust::device_vector<int> d_offsets = h_offsets;
+
+  thrust::host_vector<T> h_inclusive(n);
+  thrust::host_vector<T> h_exclusive(n);
+  thrust::host_vector<T> h_lasts(n);
+  for (size_t segment = 0; segment + 1 < h_offsets.size(); ++segment)
+  {
+    const int begin = h_offsets[segment];
+    const int end   = h_offsets[segment + 1];
+    thrust::inclusive_scan(h_data.begin() + begin, h_data.begin() + end, h_inclusive.begin() + begin);
+    thrust::exclusive_scan(h_data.begin() + begin, h_data.begin() + end, h_exclusive.begin() + begin, T(13));
+    thrust::exclusive_scan(
+      h_data.begin() + begin, h_data.begin() + end, h_lasts.begin() + begin, T(13), take_last<T>{});
+  }
+
+  thrust::device_vector<T> d_result(n);
+
+  thrust::segmented_inclusive_scan(d_offsets.begin(), d_offsets.end(), d_data.begin(), d_result.begin());
+  ASSERT_EQUAL(h_inclusive, d_result);
+
+  thrust::segmented_exclusive_scan(d_offsets.begin(), d_offsets.end(), d_data.begin(), d_result.begin(), T(13));
+  ASSERT_EQUAL(h_exclusive, d_result);
+
+  // the prefixes of the segments split among several threads are combined in order
+  thrust::segmented_exclusive_scan(
+    d_offsets.begin(), d_offsets.end(), d_data.begin(), d_data.begin(), T(13), take_last<T>{});
+  ASSERT_EQUAL(h_lasts, d_data);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestSegmentedScan);
@@ -0,0 +1,127 @@
+#include <thrust/execution_policy.h>
+#include <thrust/segmented_sort.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <cuda/std/functional>
+
+#include <unittest/unittest.h>
+
+template <class Vector>
+void TestSegmentedSortSimple()
+{
+  Vector keys{1, 9, 4, 7, 2, 9, 3};
+  Vector offsets{0, 4, 5, 7};
+
+  thrust::segmented_sort(offsets.begin(), offsets.end(), keys.begin());
+
+  Vector ref{1, 4, 7, 9, 2, 3, 9};
+  ASSERT_EQUAL(ref, keys);
+
+  thrust::segmented_sort(offsets.begin(), offsets.end(), keys.begin(), ::cuda::std::greater<>{});
+
+  ref = Vector{9, 7, 4, 1, 2, 9, 3};
+  ASSERT_EQUAL(ref, keys);
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestSegmentedSortSimple);
+
+void TestSegmentedStableSortByKeySimple()
+{
+  thrust::device_vector<int> times{5, 3, 5, 1, 8, 8};
+  thrust::device_vector<int> events{0, 1, 2, 3, 4, 5};
+  thrust::device_vector<int> offsets{0, 4, 6};
+
+  thrust::segmented_stable_sort_by_key(thrust::device, offsets.begin(), offsets.end(), times.begin(), events.begin());
+
+  thrust::device_vector<int> times_ref{1, 3, 5, 5, 8, 8};
+  thrust::device_vector<int> events_ref{3, 1, 0, 2, 4, 5};
+  ASSERT_EQUAL(times_ref, times);
+  ASSERT_EQUAL(events_ref, events);
+}
+DECLARE_UNITTEST(TestSegmentedStableSortByKeySimple);
+
+void TestSegmentedSortEmpty()
+{
+  thrust::device_vector<int> keys{3, 2, 1};
+
+  // no offsets, a single offset, and empty segments leave the keys unchanged
+  thrust::device_vector<int> offsets;
+  thrust::segmented_sort(offsets.begin(), offsets.end(), keys.begin());
+
+  offsets = thrust::device_vector<int>{1};
+  thrust::segmented_sort(offsets.begin(), offsets.end(), keys.begin());
+
+  offsets = thrust::device_vector<int>{1, 1, 1};
+  thrust::segmented_sort(offsets.begin(), offsets.end(), keys.begin());
+
+  // the elements outside of the segments are not sorted
+  offsets = thrust::device_vector<int>{1, 3};
+  thrust::segmented_sort(offsets.begin(), offsets.end(), keys.begin());
+
+  thrust::device_vector<int> ref{3, 1, 2};
+  ASSERT_EQUAL(ref, keys);
+}
+DECLARE_UNITTEST(TestSegmentedSortEmpty);
+
+// segments of sizes from empty to most of the input, which is skewed like the event lists of users
+thrust::host_vector<int> random_skewed_offsets(size_t n)
+{
+  thrust::host_vector<unsigned int> h_sizes = unittest::random_integers<unsigned int>(n + 1);
+  thrust::host_vector<int> h_offsets(1, 0);
+  while (h_offsets.back() < static_cast<int>(n))
+  {
+    const unsigned int r = h_sizes[h_offsets.size()];
+    const int max_size   = r % 16 == 0 ? static_cast<int>(n) : r % 4 == 0 ? 1000 : 20;
+    const int size       = static_cast<int>(r / 16 % (max_size + 1));
+    const int remaining  = static_cast<int>(n) - h_offsets.back();
+    h_offsets.push_back(h_offsets.back() + (::cuda::std::min) (size, remaining));
+  }
+  return h_offsets;
+}
+
+template <typename T>
+void TestSegmentedStableSortByKey(size_t n)
+{
+  thrust::host_vector<T> h_keys = unittest::random_integers<T>(n);
+  thrust::host_vector<int> h_values(n);
+  thrust::sequence(h_values.begin(), h_values.end());
+  thrust::host_vector<int> h_offsets = random_skewed_offsets(n);
+
+  thrust::device_vector<T> d_keys      = h_keys;
+  thrust::device_vector<int> d_values  = h_values;
+  thrust::device_vector<int> d_offsets = h_offsets;
+
+  for (size_t segment = 0; segment + 1 < h_offsets.size(); ++segment)
+  {
+    thrust::stable_sort_by_key(h_keys.begin() + h_offsets[segment],
+                               h_keys.begin() + h_offsets[segment + 1],
+                               h_values.begin() + h_offsets[segment]);
+  }
+
+  thrust::segmented_stable_sort_by_key(d_offsets.begin(), d_offsets.end(), d_keys.begin(), d_values.begin());
+
+  ASSERT_EQUAL(h_keys, d_keys);
+  ASSERT_EQUAL(h_values, d_values);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestSegmentedStableSortByKey);
+
+template <typename T>
+void TestSegmentedSort(size_t n)
+{
+  thrust::host_vector<T> h_keys      = unittest::random_integers<T>(n);
+  thrust::host_vector<int> h_offsets = random_skewed_offsets(n);
+
+  thrust::device_vector<T> d_keys      = h_keys;
+  thrust::device_vector<int> d_offsets = h_offsets;
+
+  for (size_t segment = 0; segment + 1 < h_offsets.size(); ++segment)
+  {
+    thrust::sort(
+      h_keys.begin() + h_offsets[segment], h_keys.begin() + h_offsets[segment + 1], ::cuda::std::greater<T>{});
+  }
+
+  thrust::segmented_sort(d_offsets.begin(), d_offsets.end(), d_keys.begin(), ::cuda::std::greater<T>{});
+
+  ASSERT_EQUAL(h_keys, d_keys);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestSegmentedSort);
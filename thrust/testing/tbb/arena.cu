@@ -0,0 +1,191 @@
+#include <thrust/copy.h>
+#include <thrust/device_vector.h>
+#include <thrust/for_each.h>
+#include <thrust/host_vector.h>
+#include <thrust/mr/memory_resource.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/system/tbb/execution_policy.h>
+
+#include <cuda/__execution/determinism.h>
+#include <cuda/__execution/require.h>
+
+#include <atomic>
+#include <new>
+
+#include <tbb/task_arena.h>
+
+#include <unittest/unittest.h>
+
+struct record_arena
+{
+  std::atomic<int>* max_concurrency;
+  std::atomic<int>* max_thread_index;
+
+  void operator()(int) const
+  {
+    max_concurrency->store(::tbb::this_task_arena::max_concurrency(), std::memory_order_relaxed);
+
+    const int index = ::tbb::this_task_arena::current_thread_index();
+    int current     = max_thread_index->load(std::memory_order_relaxed);
+    while (index > current && !max_thread_index->compare_exchange_weak(current, index, std::memory_order_relaxed))
+    {
+    }
+  }
+};
+
+// The algorithms must run inside the arena, and only use its threads
+void TestTbbParOnArena()
+{
+  ::tbb::task_arena arena(::tbb::task_arena::constraints{}.set_max_concurrency(2));
+
+  thrust::device_vector<int> data(1 << 16);
+
+  for (auto policy : {thrust::tbb::par.on(arena), thrust::tbb::par.on(arena).isolated()})
+  {
+    std::atomic<int> max_concurrency{0};
+    std::atomic<int> max_thread_index{-1};
+    thrust::for_each(policy, data.begin(), data.end(), record_arena{&max_concurrency, &max_thread_index});
+
+    ASSERT_EQUAL(2, max_concurrency.load());
+    ASSERT_EQUAL(true, max_thread_index.load() >= 0 && max_thread_index.load() < 2);
+  }
+}
+DECLARE_UNITTEST(TestTbbParOnArena);
+
+struct is_even
+{
+  _CCCL_HOST_DEVICE bool operator()(int x) const
+  {
+    return x % 2 == 0;
+  }
+};
+
+void TestTbbParOnArenaAlgorithms()
+{
+  ::tbb::task_arena arena(2);
+  const auto policy = thrust::tbb::par.on(arena).isolated();
+
+  const int n = 100000;
+  thrust::host_vector<int> h_data(n);
+  for (int i = 0; i < n; ++i)
+  {
+    h_data[i] = (i * 7919) % 1009;
+  }
+  thrust::device_vector<int> d_data(h_data);
+
+  ASSERT_EQUAL(thrust::reduce(h_data.begin(), h_data.end()), thrust::reduce(policy, d_data.begin(), d_data.end()));
+
+  thrust::host_vector<int> h_result(n);
+  thrust::device_vector<int> d_result(n);
+  thrust::inclusive_scan(h_data.begin(), h_data.end(), h_result.begin());
+  thrust::inclusive_scan(policy, d_data.begin(), d_data.end(), d_result.begin());
+  ASSERT_EQUAL(h_result, d_result);
+
+  thrust::exclusive_scan(h_data.begin(), h_data.end(), h_result.begin(), 3);
+  thrust::exclusive_scan(policy, d_data.begin(), d_data.end(), d_result.begin(), 3);
+  ASSERT_EQUAL(h_result, d_result);
+
+  auto h_end = thrust::copy_if(h_data.begin(), h_data.end(), h_result.begin(), is_even{});
+  auto d_end = thrust::copy_if(policy, d_data.begin(), d_data.end(), d_result.begin(), is_even{});
+  ASSERT_EQUAL(h_end - h_result.begin(), d_end - d_result.begin());
+  h_result.resize(h_end - h_result.begin());
+  d_result.resize(d_end - d_result.begin());
+  ASSERT_EQUAL(h_result, d_result);
+
+  thrust::stable_sort(h_data.begin(), h_data.end());
+  thrust::stable_sort(policy, d_data.begin(), d_data.end());
+  ASSERT_EQUAL(h_data, d_data);
+}
+DECLARE_UNITTEST(TestTbbParOnArenaAlgorithms);
+
+struct counting_resource final : thrust::mr::memory_resource<>
+{
+  int allocations = 0;
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override
+  {
+    ++allocations;
+    return ::operator new(bytes, std::align_val_t(alignment));
+  }
+
+  void do_deallocate(void* ptr, std::size_t, std::size_t alignment) override
+  {
+    ::operator delete(ptr, std::align_val_t(alignment));
+  }
+};
+
+// The arena must be kept when the policy is given an allocator, which must be used for the temporary storage
+void TestTbbParOnArenaWithAllocator()
+{
+  ::tbb::task_arena arena(::tbb::task_arena::constraints{}.set_max_concurrency(2));
+  counting_resource resource;
+  const auto policy = thrust::tbb::par.on(arena).isolated()(&resource);
+  ASSERT_EQUAL(true, policy.is_isolated());
+
+  std::atomic<int> max_concurrency{0};
+  std::atomic<int> max_thread_index{-1};
+  thrust::device_vector<int> data(1 << 16);
+  thrust::for_each(policy, data.begin(), data.end(), record_arena{&max_concurrency, &max_thread_index});
+  ASSERT_EQUAL(2, max_concurrency.load());
+
+  thrust::host_vector<int> h_data(100000);
+  for (size_t i = 0; i < h_data.size(); ++i)
+  {
+    h_data[i] = static_cast<int>((i * 7919) % 1009);
+  }
+  thrust::device_vector<int> d_data(h_data);
+  thrust::stable_sort(h_data.begin(), h_data.end());
+  thrust::stable_sort(policy, d_data.begin(), d_data.end());
+  ASSERT_EQUAL(h_data, d_data);
+  ASSERT_EQUAL(true, resource.allocations > 0);
+}
+DECLARE_UNITTEST(TestTbbParOnArenaWithAllocator);
+
+struct recording_plus
+{
+  std::atomic<int>* max_concurrency;
+
+  int operator()(int x, int y) const
+  {
+    max_concurrency->store(::tbb::this_task_arena::max_concurrency(), std::memory_order_relaxed);
+    return x + y;
+  }
+};
+
+// .on() and .with() compose in either order, and the deterministic algorithms also run inside the arena
+void TestTbbParOnArenaWithEnv()
+{
+  ::tbb::task_arena arena(::tbb::task_arena::constraints{}.set_max_concurrency(2));
+  const auto env = cuda::execution::require(cuda::execution::determinism::run_to_run);
+
+  const auto on_with = thrust::tbb::par.on(arena).isolated().with(env);
+  const auto with_on = thrust::tbb::par.with(env).on(arena);
+  static_assert(thrust::detail::requires_determinism_v<::cuda::std::remove_const_t<decltype(on_with)>>);
+  static_assert(thrust::detail::requires_determinism_v<::cuda::std::remove_const_t<decltype(with_on)>>);
+  ASSERT_EQUAL(true, on_with.is_isolated());
+  ASSERT_EQUAL(false, with_on.is_isolated());
+
+  const int n = (1 << 20) + 123;
+  thrust::host_vector<int> h_data(n);
+  thrust::sequence(h_data.begin(), h_data.end());
+  thrust::device_vector<int> d_data(h_data);
+  thrust::host_vector<int> h_result(n);
+  thrust::inclusive_scan(h_data.begin(), h_data.end(), h_result.begin());
+
+  counting_resource resource;
+  for (auto policy : {on_with(&resource), with_on.isolated()(&resource)})
+  {
+    static_assert(thrust::detail::requires_determinism_v<decltype(policy)>);
+
+    std::atomic<int> max_concurrency{0};
+    thrust::device_vector<int> d_result(n);
+    thrust::inclusive_scan(policy, d_data.begin(), d_data.end(), d_result.begin(), recording_plus{&max_concurrency});
+    ASSERT_EQUAL(h_result, d_result);
+    ASSERT_EQUAL(2, max_concurrency.load());
+  }
+  ASSERT_EQUAL(true, resource.allocations > 0);
+}
+DECLARE_UNITTEST(TestTbbParOnArenaWithEnv);
@@ -0,0 +1,125 @@
+#include <thrust/execution_policy.h>
+#include <thrust/partition.h>
+
+#include <cuda/std/tuple>
+
+#include <unittest/unittest.h>
+
+template <typename T>
+struct is_less_than
+{
+  T bound;
+
+  _CCCL_HOST_DEVICE bool operator()(T x) const
+  {
+    return x < bound;
+  }
+};
+
+template <typename Vector>
+void TestThreeWayPartitionSimple()
+{
+  using T = typename Vector::value_type;
+
+  Vector data{0, 2, 3, 9, 5, 2, 81, 8};
+
+  auto ends = thrust::three_way_partition(data.begin(), data.end(), is_less_than<T>{7}, is_less_than<T>{51});
+
+  Vector ref{0, 2, 3, 5, 2, 9, 8, 81};
+
+  ASSERT_EQUAL(ends.first - data.begin(), 5);
+  ASSERT_EQUAL(ends.second - data.begin(), 7);
+  ASSERT_EQUAL(data, ref);
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestThreeWayPartitionSimple);
+
+template <typename Vector>
+void TestThreeWayPartitionCopySimple()
+{
+  using T = typename Vector::value_type;
+
+  Vector data{0, 2, 3, 9, 5, 2, 81, 8};
+
+  Vector first_part(5);
+  Vector second_part(2);
+  Vector unselected(1);
+
+  auto ends = thrust::three_way_partition_copy(
+    data.begin(),
+    data.end(),
+    first_part.begin(),
+    second_part.begin(),
+    unselected.begin(),
+    is_less_than<T>{7},
+    is_less_than<T>{51});
+
+  Vector first_part_ref{0, 2, 3, 5, 2};
+  Vector second_part_ref{9, 8};
+  Vector unselected_ref{81};
+
+  ASSERT_EQUAL_QUIET(first_part.end(), ::cuda::std::get<0>(ends));
+  ASSERT_EQUAL_QUIET(second_part.end(), ::cuda::std::get<1>(ends));
+  ASSERT_EQUAL_QUIET(unselected.end(), ::cuda::std::get<2>(ends));
+  ASSERT_EQUAL(first_part_ref, first_part);
+  ASSERT_EQUAL(second_part_ref, second_part);
+  ASSERT_EQUAL(unselected_ref, unselected);
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestThreeWayPartitionCopySimple);
+
+// the reference chains two stable partitions: the first group, then the second group among the rest
+template <typename T>
+void TestThreeWayPartition(size_t n)
+{
+  thrust::host_vector<T> h_data   = unittest::random_integers<T>(n);
+  thrust::device_vector<T> d_data = h_data;
+
+  const is_less_than<T> select_first_part{T(-50)};
+  const is_less_than<T> select_second_part{T(20)};
+
+  auto h_second_part = thrust::stable_partition(h_data.begin(), h_data.end(), select_first_part);
+  auto h_unselected  = thrust::stable_partition(h_second_part, h_data.end(), select_second_part);
+
+  auto d_ends = thrust::three_way_partition(d_data.begin(), d_data.end(), select_first_part, select_second_part);
+
+  ASSERT_EQUAL(h_second_part - h_data.begin(), d_ends.first - d_data.begin());
+  ASSERT_EQUAL(h_unselected - h_data.begin(), d_ends.second - d_data.begin());
+  ASSERT_EQUAL(h_data, d_data);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestThreeWayPartition);
+
+template <typename T>
+void TestThreeWayPartitionCopy(size_t n)
+{
+  thrust::host_vector<T> h_data   = unittest::random_integers<T>(n);
+  thrust::device_vector<T> d_data = h_data;
+
+  const is_less_than<T> select_first_part{T(-50)};
+  const is_less_than<T> select_second_part{T(20)};
+
+  thrust::host_vector<T> h_partitioned = h_data;
+  auto h_second_part = thrust::stable_partition(h_partitioned.begin(), h_partitioned.end(), select_first_part);
+  auto h_unselected  = thrust::stable_partition(h_second_part, h_partitioned.end(), select_second_part);
+
+  thrust::device_vector<T> d_first_part(n);
+  thrust::device_vector<T> d_second_part(n);
+  thrust::device_vector<T> d_unselected(n);
+
+  auto d_ends = thrust::three_way_partition_copy(
+    thrust::device,
+    d_data.begin(),
+    d_data.end(),
+    d_first_part.begin(),
+    d_second_part.begin(),
+    d_unselected.begin(),
+    select_first_part,
+    select_second_part);
+
+  d_first_part.resize(::cuda::std::get<0>(d_ends) - d_first_part.begin());
+  d_second_part.resize(::cuda::std::get<1>(d_ends) - d_second_part.begin());
+  d_unselected.resize(::cuda::std::get<2>(d_ends) - d_unselected.begin());
+
+  ASSERT_EQUAL(thrust::host_vector<T>(h_partitioned.begin(), h_second_part), d_first_part);
+  ASSERT_EQUAL(thrust::host_vector<T>(h_second_part, h_unselected), d_second_part);
+  ASSERT_EQUAL(thrust::host_vector<T>(h_unselected, h_partitioned.end()), d_unselected);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestThreeWayPartitionCopy);
@@ -0,0 +1,227 @@
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/topk.h>
+
+#include <cuda/std/functional>
+
+#include <unittest/unittest.h>
+
+template <class Vector>
+void TestTopkSimple()
+{
+  Vector data{1, 9, 4, 7, 2, 9, 3};
+  Vector result(3);
+
+  auto end = thrust::topk(data.begin(), data.end(), result.begin(), 3);
+  ASSERT_EQUAL(3, end - result.begin());
+
+  Vector ref{9, 9, 7};
+  ASSERT_EQUAL(ref, result);
+
+  thrust::topk(data.begin(), data.end(), result.begin(), 3, ::cuda::std::less<>{});
+  ref = Vector{1, 2, 3};
+  ASSERT_EQUAL(ref, result);
+
+  // k larger than the input selects all of it
+  result.resize(10);
+  end = thrust::topk(data.begin(), data.end(), result.begin(), 10);
+  ASSERT_EQUAL(7, end - result.begin());
+  result.resize(7);
+  ref = Vector{9, 9, 7, 4, 3, 2, 1};
+  ASSERT_EQUAL(ref, result);
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestTopkSimple);
+
+void TestTopkByKeySimple()
+{
+  thrust::device_vector<float> scores{0.5f, 0.9f, 0.1f, 0.7f, 0.9f};
+  thrust::device_vector<int> ids{10, 11, 12, 13, 14};
+  thrust::device_vector<float> top_scores(2);
+  thrust::device_vector<int> top_ids(2);
+
+  auto ends = thrust::topk_by_key(
+    scores.begin(), scores.end(), ids.begin(), top_scores.begin(), top_ids.begin(), 2);
+  ASSERT_EQUAL(2, ends.first - top_scores.begin());
+  ASSERT_EQUAL(2, ends.second - top_ids.begin());
+
+  // equivalent keys keep the order of the input
+  thrust::device_vector<float> top_scores_ref{0.9f, 0.9f};
+  thrust::device_vector<int> top_ids_ref{11, 14};
+  ASSERT_EQUAL(top_scores_ref, top_scores);
+  ASSERT_EQUAL(top_ids_ref, top_ids);
+}
+DECLARE_UNITTEST(TestTopkByKeySimple);
+
+void TestSegmentedTopkSimple()
+{
+  thrust::device_vector<int> data{1, 9, 4, 7, 2, 9, 3};
+  thrust::device_vector<int> offsets{0, 4, 5, 7};
+  thrust::device_vector<int> result(6, -1);
+
+  auto end = thrust::segmented_topk(offsets.begin(), offsets.end(), data.begin(), result.begin(), 2);
+  ASSERT_EQUAL(6, end - result.begin());
+
+  // the segment of a single element leaves the rest of its output unchanged
+  thrust::device_vector<int> ref{9, 7, 2, -1, 9, 3};
+  ASSERT_EQUAL(ref, result);
+}
+DECLARE_UNITTEST(TestSegmentedTopkSimple);
+
+void TestTopkEmpty()
+{
+  thrust::device_vector<int> data;
+  thrust::device_vector<int> result(1);
+
+  ASSERT_EQUAL(true, thrust::topk(data.begin(), data.end(), result.begin(), 5) == result.begin());
+
+  data = thrust::device_vector<int>{3, 1, 2};
+  ASSERT_EQUAL(true, thrust::topk(data.begin(), data.end(), result.begin(), 0) == result.begin());
+
+  thrust::device_vector<int> offsets{0};
+  ASSERT_EQUAL(true,
+               thrust::segmented_topk(offsets.begin(), offsets.end(), data.begin(), result.begin(), 1)
+                 == result.begin());
+}
+DECLARE_UNITTEST(TestTopkEmpty);
+
+// A negative k selects nothing, like k == 0
+void TestTopkNegativeK()
+{
+  thrust::device_vector<int> data{3, 1, 2};
+  thrust::device_vector<int> ids{0, 1, 2};
+  thrust::device_vector<int> result(3, -1);
+  thrust::device_vector<int> result_ids(3, -1);
+  const thrust::device_vector<int> untouched(3, -1);
+
+  ASSERT_EQUAL(true, thrust::topk(data.begin(), data.end(), result.begin(), -2) == result.begin());
+
+  auto ends = thrust::topk_by_key(data.begin(), data.end(), ids.begin(), result.begin(), result_ids.begin(), -1);
+  ASSERT_EQUAL(true, ends.first == result.begin());
+  ASSERT_EQUAL(true, ends.second == result_ids.begin());
+
+  // enough segments to use every thread, and too few
+  for (int num_segments : {1, 64})
+  {
+    thrust::device_vector<int> keys(2 * num_segments, 5);
+    thrust::device_vector<int> offsets(num_segments + 1);
+    thrust::sequence(offsets.begin(), offsets.end(), 0, 2);
+
+    ASSERT_EQUAL(true,
+                 thrust::segmented_topk(offsets.begin(), offsets.end(), keys.begin(), result.begin(), -3)
+                   == result.begin());
+
+    auto segmented_ends = thrust::segmented_topk_by_key(
+      offsets.begin(), offsets.end(), keys.begin(), keys.begin(), result.begin(), result_ids.begin(), -3);
+    ASSERT_EQUAL(true, segmented_ends.first == result.begin());
+    ASSERT_EQUAL(true, segmented_ends.second == result_ids.begin());
+  }
+
+  ASSERT_EQUAL(untouched, result);
+  ASSERT_EQUAL(untouched, result_ids);
+}
+DECLARE_UNITTEST(TestTopkNegativeK);
+
+template <typename T>
+void TestTopk(size_t n)
+{
+  thrust::host_vector<T> h_data   = unittest::random_integers<T>(n);
+  thrust::device_vector<T> d_data = h_data;
+
+  thrust::host_vector<T> h_sorted = h_data;
+  thrust::stable_sort(h_sorted.begin(), h_sorted.end(), ::cuda::std::greater<>{});
+
+  for (size_t k : {size_t{1}, size_t{100}, n / 2 + 1})
+  {
+    const size_t m = (std::min) (k, n);
+    thrust::host_vector<T> h_result(h_sorted.begin(), h_sorted.begin() + m);
+
+    thrust::device_vector<T> d_result(m);
+    auto end = thrust::topk(d_data.begin(), d_data.end(), d_result.begin(), k);
+
+    ASSERT_EQUAL(m, static_cast<size_t>(end - d_result.begin()));
+    ASSERT_EQUAL(h_result, d_result);
+  }
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestTopk);
+
+template <typename T>
+void TestTopkByKey(size_t n)
+{
+  thrust::host_vector<T> h_keys   = unittest::random_integers<T>(n);
+  thrust::device_vector<T> d_keys = h_keys;
+  thrust::device_vector<int> d_values(n);
+  thrust::sequence(d_values.begin(), d_values.end());
+
+  // the ties between the many equal keys of small types are broken by position
+  thrust::host_vector<int> h_values = d_values;
+  thrust::stable_sort_by_key(h_keys.begin(), h_keys.end(), h_values.begin(), ::cuda::std::less<>{});
+
+  const size_t k = 100;
+  const size_t m = (std::min) (k, n);
+  thrust::host_vector<T> h_top_keys(h_keys.begin(), h_keys.begin() + m);
+  thrust::host_vector<int> h_top_values(h_values.begin(), h_values.begin() + m);
+
+  thrust::device_vector<T> d_top_keys(m);
+  thrust::device_vector<int> d_top_values(m);
+  thrust::topk_by_key(
+    d_keys.begin(), d_keys.end(), d_values.begin(), d_top_keys.begin(), d_top_values.begin(), k, ::cuda::std::less<>{});
+
+  ASSERT_EQUAL(h_top_keys, d_top_keys);
+  ASSERT_EQUAL(h_top_values, d_top_values);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestTopkByKey);
+
+template <typename T>
+void TestSegmentedTopkByKey(size_t n)
+{
+  thrust::host_vector<T> h_keys   = unittest::random_integers<T>(n);
+  thrust::device_vector<T> d_keys = h_keys;
+  thrust::host_vector<int> h_values(n);
+  thrust::sequence(h_values.begin(), h_values.end());
+  thrust::device_vector<int> d_values = h_values;
+
+  // segments of random sizes, including empty ones
+  thrust::host_vector<unsigned int> h_sizes = unittest::random_integers<unsigned int>(n);
+  thrust::host_vector<int> h_offsets(1, 0);
+  while (h_offsets.back() < static_cast<int>(n))
+  {
+    const int size = h_sizes[h_offsets.size()] % 50;
+    h_offsets.push_back((std::min) (h_offsets.back() + size, static_cast<int>(n)));
+  }
+  thrust::device_vector<int> d_offsets = h_offsets;
+  const size_t num_segments           = h_offsets.size() - 1;
+
+  const size_t k = 10;
+  thrust::host_vector<T> h_top_keys(num_segments * k);
+  thrust::host_vector<int> h_top_values(num_segments * k, -1);
+  for (size_t segment = 0; segment < num_segments; ++segment)
+  {
+    thrust::host_vector<T> keys(h_keys.begin() + h_offsets[segment], h_keys.begin() + h_offsets[segment + 1]);
+    thrust::host_vector<int> values(h_values.begin() + h_offsets[segment], h_values.begin() + h_offsets[segment + 1]);
+    thrust::stable_sort_by_key(keys.begin(), keys.end(), values.begin(), ::cuda::std::greater<>{});
+
+    const size_t m = (std::min) (k, keys.size());
+    thrust::copy(keys.begin(), keys.begin() + m, h_top_keys.begin() + segment * k);
+    thrust::copy(values.begin(), values.begin() + m, h_top_values.begin() + segment * k);
+  }
+
+  thrust::device_vector<T> d_top_keys = h_top_keys;
+  thrust::device_vector<int> d_top_values(num_segments * k, -1);
+  auto ends = thrust::segmented_topk_by_key(
+    d_offsets.begin(),
+    d_offsets.end(),
+    d_keys.begin(),
+    d_values.begin(),
+    d_top_keys.begin(),
+    d_top_values.begin(),
+    k);
+
+  ASSERT_EQUAL(true, ends.first == d_top_keys.end());
+  ASSERT_EQUAL(true, ends.second == d_top_values.end());
+  ASSERT_EQUAL(h_top_keys, d_top_keys);
+  ASSERT_EQUAL(h_top_values, d_top_values);
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestSegmentedTopkByKey);
@@ -2,6 +2,11 @@
 
 #include <thrust/device_vector.h>
 #include <thrust/host_vector.h>
+#include <thrust/mr/allocator.h>
+#include <thrust/mr/malloc.h>
+#include <thrust/sequence.h>
+
+#include <cuda/std/ratio>
 
 #include <unittest/unittest.h>
 
@@ -272,3 +277,109 @@ void TestVectorAllocatorPropagateOnSwapDevice()
   TestVectorAllocatorPropagateOnSwap<device_vector_nsp>();
 }
 DECLARE_UNITTEST(TestVectorAllocatorPropagateOnSwapDevice);
+
+template <typename T>
+class growth_allocator : public std::allocator<T>
+{
+public:
+  using growth_factor = cuda::std::ratio<3, 2>;
+
+  template <typename U>
+  struct rebind
+  {
+    using other = growth_allocator<U>;
+  };
+};
+
+void TestVectorAllocatorGrowthFactor()
+{
+  thrust::host_vector<int, growth_allocator<int>> v;
+  v.reserve(4);
+  v.resize(4);
+  ASSERT_EQUAL(v.capacity(), 4u);
+
+  v.push_back(4);
+  ASSERT_EQUAL(v.capacity(), 6u);
+
+  v.resize(7);
+  ASSERT_EQUAL(v.capacity(), 9u);
+
+  // a larger request than the growth is allocated as is
+  v.resize(20);
+  ASSERT_EQUAL(v.capacity(), 20u);
+}
+DECLARE_UNITTEST(TestVectorAllocatorGrowthFactor);
+
+// a resource which counts the allocations grown by reallocating them
+class counting_malloc_resource final : public thrust::mr::memory_resource<>
+{
+public:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override
+  {
+    ++num_allocations;
+    return upstream.do_allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+  {
+    upstream.do_deallocate(p, bytes, alignment);
+  }
+
+  void* do_reallocate(void* p, std::size_t old_bytes, std::size_t new_bytes, std::size_t alignment)
+  {
+    ++num_reallocations;
+    return upstream.do_reallocate(p, old_bytes, new_bytes, alignment);
+  }
+
+  int num_allocations   = 0;
+  int num_reallocations = 0;
+
+private:
+  thrust::mr::malloc_resource upstream;
+};
+
+struct not_trivially_relocatable
+{
+  int value = 0;
+
+  not_trivially_relocatable() = default;
+  not_trivially_relocatable(const not_trivially_relocatable& other)
+      : value(other.value)
+  {}
+};
+
+void TestVectorAllocatorReallocate()
+{
+  counting_malloc_resource resource;
+
+  using allocator = thrust::mr::allocator<int, counting_malloc_resource>;
+  thrust::host_vector<int, allocator> v{allocator(&resource)};
+  v.push_back(0);
+  ASSERT_EQUAL(resource.num_allocations, 1);
+
+  // the storage grows without copying the elements, even when it moves; the pushed element is an element of the vector
+  for (int i = 1; i < 1000; ++i)
+  {
+    v.push_back(v.back());
+    v.back() = i;
+  }
+  v.resize(100000);
+  v.reserve(200000);
+
+  ASSERT_EQUAL(resource.num_allocations, 1);
+  ASSERT_EQUAL(resource.num_reallocations > 0, true);
+  ASSERT_EQUAL(v.capacity(), 200000u);
+
+  thrust::host_vector<int> ref(1000);
+  thrust::sequence(ref.begin(), ref.end());
+  ASSERT_EQUAL(thrust::equal(ref.begin(), ref.end(), v.begin()), true);
+  ASSERT_EQUAL(v.back(), 0);
+
+  // the elements which are not trivially relocatable are copied
+  using other_allocator = thrust::mr::allocator<not_trivially_relocatable, counting_malloc_resource>;
+  thrust::host_vector<not_trivially_relocatable, other_allocator> w(1, other_allocator(&resource));
+  const int num_reallocations = resource.num_reallocations;
+  w.resize(100);
+  ASSERT_EQUAL(resource.num_reallocations, num_reallocations);
+}
+DECLARE_UNITTEST(TestVectorAllocatorReallocate);
@@ -0,0 +1,741 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file autotune.h
+ *  \brief Per-machine tuning of the crossover constants of the host systems
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/autotune.h>
+#include <thrust/find.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+
+#include <cuda/std/__type_traits/is_base_of.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+
+// Forward declarations
+namespace system::omp::detail
+{
+template <class>
+struct execution_policy;
+} // namespace system::omp::detail
+
+namespace system::tbb::detail
+{
+template <class>
+struct execution_policy;
+} // namespace system::tbb::detail
+
+/*! \addtogroup autotune Autotuning
+ *  \{
+ */
+
+/*! \p thrust::autotune tunes the constants the algorithms of the OpenMP and TBB systems use to decide between
+ *  sequential and parallel execution and how finely to split their work, such as the size below which the TBB merge
+ *  sort stops splitting. Their best values depend on the machine and on the size of the values, so they are tuned per
+ *  machine, per knob and per value size, and kept in a \p profile file. Without a profile, the algorithms use their
+ *  built-in defaults.
+ *
+ *  \p calibrate_once loads a profile made on the same machine, or calibrates one and saves it on first use:
+ *
+ *  \code
+ *  #include <thrust/autotune.h>
+ *  #include <thrust/system/tbb/execution_policy.h>
+ *  ...
+ *  thrust::autotune::calibrate_once(thrust::tbb::par, "/var/cache/myapp/thrust.profile");
+ *  thrust::sort(thrust::tbb::par, keys.begin(), keys.end()); // uses the tuned thresholds
+ *  \endcode
+ *
+ *  A profile can also be made ahead of time, e.g. by the \c autotune example, and made active with \p load. Without
+ *  an argument, \p load reads the profile named by the \c THRUST_AUTOTUNE_PROFILE environment variable, so that the
+ *  profile can be chosen when the program runs:
+ *
+ *  \code
+ *  thrust::autotune::load(); // keeps the defaults if THRUST_AUTOTUNE_PROFILE is not set or names no valid profile
+ *  \endcode
+ *
+ *  Profiles are never loaded implicitly: the algorithms only read the values made active by \p use, \p load or
+ *  \p calibrate_once.
+ */
+namespace autotune
+{
+
+/*! The knobs of the host systems which can be tuned, as they are named in the profiles. Each knob is tuned separately
+ *  for each size of the values the algorithm processes, of up to 16 bytes.
+ */
+namespace knobs
+{
+/*! Below this number of elements, the TBB merge sort of \c stable_sort sorts sequentially instead of splitting further
+ */
+inline constexpr char tbb_sort_threshold[] = "tbb.sort.threshold";
+/*! Below this number of elements, the TBB merge sort of \c stable_sort_by_key sorts sequentially instead of splitting
+ */
+inline constexpr char tbb_sort_by_key_threshold[] = "tbb.sort_by_key.threshold";
+/*! Below this number of elements, the TBB \c find_if searches sequentially
+ */
+inline constexpr char tbb_find_if_sequential_threshold[] = "tbb.find_if.sequential_threshold";
+/*! Below this number of elements, the OpenMP \c inclusive_scan and \c exclusive_scan scan sequentially
+ */
+inline constexpr char omp_scan_threshold[] = "omp.scan.threshold";
+/*! The number of tiles per processor the OpenMP \c reduce splits its input into
+ */
+inline constexpr char omp_reduce_tiles_per_processor[] = "omp.reduce.tiles_per_processor";
+/*! Below this number of elements, the OpenMP \c find_if searches sequentially
+ */
+inline constexpr char omp_find_if_sequential_threshold[] = "omp.find_if.sequential_threshold";
+} // namespace knobs
+
+/*! \brief The tuned values of the knobs of the host algorithms on one machine.
+ *
+ *  A profile maps a knob and the size of the values an algorithm processes to the value of the knob. The algorithms of
+ *  the host systems use the values of the active profile (see \c use), and their built-in defaults for the knobs and
+ *  value sizes it does not have. Profiles are made by \c thrust::autotune::calibrate, and stored as text files of one
+ *  <tt>knob value_size value</tt> line per tuned value:
+ *
+ *  \code
+ *  # thrust autotune profile
+ *  machine threads=192
+ *  tbb.sort.threshold 4 262144
+ *  omp.scan.threshold 8 16384
+ *  \endcode
+ */
+class profile
+{
+public:
+  /*! Returns the value of \p knob for values of \p value_size bytes, if the profile has it.
+   */
+  std::optional<::cuda::std::int64_t> get(std::string_view knob, ::cuda::std::size_t value_size) const
+  {
+    const auto values = m_values.find(knob);
+    if (values == m_values.end())
+    {
+      return std::nullopt;
+    }
+    const auto value = values->second.find(value_size);
+    if (value == values->second.end())
+    {
+      return std::nullopt;
+    }
+    return value->second;
+  }
+
+  /*! Sets the value of \p knob for values of \p value_size bytes.
+   */
+  void set(std::string_view knob, ::cuda::std::size_t value_size, ::cuda::std::int64_t value)
+  {
+    auto values = m_values.find(knob);
+    if (values == m_values.end())
+    {
+      values = m_values.emplace(std::string(knob), std::map<::cuda::std::size_t, ::cuda::std::int64_t>{}).first;
+    }
+    values->second[value_size] = value;
+  }
+
+  /*! Sets the values of \p other in this profile, replacing those of the same knobs and value sizes.
+   */
+  void merge(const profile& other)
+  {
+    for (const auto& values : other.m_values)
+    {
+      for (const auto& value : values.second)
+      {
+        set(values.first, value.first, value.second);
+      }
+    }
+  }
+
+  /*! Returns whether the profile has no values.
+   */
+  bool empty() const
+  {
+    return m_values.empty();
+  }
+
+  /*! The machine the profile was made on, as returned by \c current_machine.
+   */
+  const std::string& machine() const
+  {
+    return m_machine;
+  }
+
+  void set_machine(std::string machine)
+  {
+    m_machine = std::move(machine);
+  }
+
+  /*! Returns the machine the calling process runs on, as recorded in the profiles it makes.
+   */
+  static std::string current_machine()
+  {
+    return "threads=" + std::to_string(std::thread::hardware_concurrency());
+  }
+
+  /*! Returns the profile in the format of the profile files.
+   */
+  std::string to_string() const
+  {
+    std::string out = "# thrust autotune profile\n";
+    if (!m_machine.empty())
+    {
+      out += "machine " + m_machine + "\n";
+    }
+    for (const auto& values : m_values)
+    {
+      for (const auto& value : values.second)
+      {
+        out += values.first + " " + std::to_string(value.first) + " " + std::to_string(value.second) + "\n";
+      }
+    }
+    return out;
+  }
+
+  /*! Parses a profile in the format of the profile files, and throws \c std::runtime_error if it is malformed.
+   */
+  static profile from_string(const std::string& text)
+  {
+    profile result;
+    std::istringstream lines(text);
+    std::string line;
+    while (std::getline(lines, line))
+    {
+      if (line.empty() || line[0] == '#')
+      {
+        continue;
+      }
+      std::istringstream fields(line);
+      std::string knob;
+      fields >> knob;
+      if (knob == "machine")
+      {
+        fields >> std::ws;
+        std::getline(fields, result.m_machine);
+        continue;
+      }
+      ::cuda::std::size_t value_size;
+      ::cuda::std::int64_t value;
+      if (!(fields >> value_size >> value) || !(fields >> std::ws).eof())
+      {
+        throw std::runtime_error("thrust::autotune: malformed profile line '" + line + "'");
+      }
+      result.set(knob, value_size, value);
+    }
+    return result;
+  }
+
+  /*! Loads the profile file at \p path. Returns \c false if it cannot be opened, and throws \c std::runtime_error if
+   *  it is malformed.
+   */
+  bool load(const std::string& path)
+  {
+    std::ifstream file(path);
+    if (!file)
+    {
+      return false;
+    }
+    std::ostringstream text;
+    text << file.rdbuf();
+    *this = from_string(text.str());
+    return true;
+  }
+
+  /*! Writes the profile file at \p path, and throws \c std::runtime_error if it cannot be written.
+   */
+  void save(const std::string& path) const
+  {
+    std::ofstream file(path, std::ios::trunc);
+    if (!(file << to_string()) || !file.flush())
+    {
+      throw std::runtime_error("thrust::autotune: cannot write the profile '" + path + "'");
+    }
+  }
+
+private:
+  std::string m_machine;
+  std::map<std::string, std::map<::cuda::std::size_t, ::cuda::std::int64_t>, std::less<>> m_values;
+};
+
+namespace detail
+{
+// The names of the knobs, in the order of thrust::detail::autotune_knob
+inline constexpr const char* knob_names[] = {
+  knobs::tbb_sort_threshold,
+  knobs::tbb_sort_by_key_threshold,
+  knobs::tbb_find_if_sequential_threshold,
+  knobs::omp_scan_threshold,
+  knobs::omp_reduce_tiles_per_processor,
+  knobs::omp_find_if_sequential_threshold};
+static_assert(sizeof(knob_names) / sizeof(knob_names[0]) == thrust::detail::autotune_table::num_knobs,
+              "every knob has a name");
+
+// The active profile, and every table which was active, since the algorithms running may still read them
+struct active_profile
+{
+  std::mutex mutex;
+  profile values;
+  std::vector<std::unique_ptr<const thrust::detail::autotune_table>> tables;
+};
+
+inline active_profile& get_active_profile()
+{
+  static active_profile p;
+  return p;
+}
+
+inline std::unique_ptr<const thrust::detail::autotune_table> make_table(const profile& p)
+{
+  auto table = std::make_unique<thrust::detail::autotune_table>();
+  for (::cuda::std::size_t knob = 0; knob < thrust::detail::autotune_table::num_knobs; ++knob)
+  {
+    for (::cuda::std::size_t value_size = 1; value_size <= thrust::detail::autotune_table::max_value_size; ++value_size)
+    {
+      if (const std::optional<::cuda::std::int64_t> value = p.get(knob_names[knob], value_size))
+      {
+        table->has_value[knob][value_size - 1] = true;
+        table->values[knob][value_size - 1]    = *value;
+      }
+    }
+  }
+  return table;
+}
+} // namespace detail
+
+/*! Makes \p p the profile the host algorithms read their knobs from. The algorithms already running keep the values
+ *  they have read.
+ */
+inline void use(profile p)
+{
+  std::unique_ptr<const thrust::detail::autotune_table> table = detail::make_table(p);
+
+  detail::active_profile& a = detail::get_active_profile();
+  std::lock_guard<std::mutex> lock(a.mutex);
+  a.values = std::move(p);
+  a.tables.push_back(std::move(table));
+  thrust::detail::active_autotune_table().store(a.tables.back().get(), std::memory_order_release);
+}
+
+/*! Returns the host algorithms to the built-in defaults of their knobs.
+ */
+inline void reset()
+{
+  detail::active_profile& a = detail::get_active_profile();
+  std::lock_guard<std::mutex> lock(a.mutex);
+  thrust::detail::active_autotune_table().store(nullptr, std::memory_order_release);
+  a.values = profile{};
+}
+
+/*! Returns the active profile, which is empty if there is none.
+ */
+inline profile active()
+{
+  detail::active_profile& a = detail::get_active_profile();
+  std::lock_guard<std::mutex> lock(a.mutex);
+  return a.values;
+}
+
+/*! Makes the profile file at \p path active if it was made on this machine. Otherwise, i.e. if it cannot be read, is
+ *  malformed or was made on another machine, the algorithms use the built-in defaults of their knobs.
+ *
+ *  \param path The path of the profile file.
+ *  \return Whether the profile was made active.
+ */
+inline bool load(const std::string& path)
+{
+  profile p;
+  try
+  {
+    if (!p.load(path) || p.machine() != profile::current_machine())
+    {
+      reset();
+      return false;
+    }
+  }
+  catch (const std::exception&)
+  {
+    reset();
+    return false;
+  }
+  use(std::move(p));
+  return true;
+}
+
+/*! Makes the profile file named by the \c THRUST_AUTOTUNE_PROFILE environment variable active, as \p load(path)
+ *  does. The algorithms use the built-in defaults of their knobs if the variable is not set.
+ *
+ *  \return Whether a profile was made active.
+ */
+inline bool load()
+{
+  const char* path = std::getenv("THRUST_AUTOTUNE_PROFILE");
+  if (!path)
+  {
+    reset();
+    return false;
+  }
+  return load(path);
+}
+
+/*! The parameters of a calibration.
+ */
+struct calibration_options
+{
+  /*! The sizes of the values to tune the knobs for, in bytes. Only sizes of 1, 2, 4 and 8 bytes are calibrated.
+   */
+  std::vector<::cuda::std::size_t> value_sizes{4, 8};
+  /*! The number of elements the knobs which are not thresholds are tuned on.
+   */
+  ::cuda::std::size_t problem_size = ::cuda::std::size_t{1} << 22;
+  /*! The largest number of elements the thresholds are searched up to. A threshold which is not reached is set past
+   *  it.
+   */
+  ::cuda::std::size_t max_threshold = ::cuda::std::size_t{1} << 20;
+  /*! The number of times each configuration is run, of which the fastest run counts.
+   */
+  int repetitions = 3;
+};
+
+namespace detail
+{
+template <typename DerivedPolicy>
+inline constexpr bool is_omp_policy_v =
+  ::cuda::std::is_base_of_v<thrust::system::omp::detail::execution_policy<DerivedPolicy>, DerivedPolicy>;
+
+template <typename DerivedPolicy>
+inline constexpr bool is_tbb_policy_v =
+  ::cuda::std::is_base_of_v<thrust::system::tbb::detail::execution_policy<DerivedPolicy>, DerivedPolicy>;
+
+// A knob value larger than any input, which makes a threshold always pick the sequential path
+inline constexpr ::cuda::std::int64_t never = (std::numeric_limits<::cuda::std::int64_t>::max)();
+
+template <typename T>
+std::vector<T> random_values(::cuda::std::size_t n)
+{
+  std::vector<T> values(n);
+  ::cuda::std::uint64_t state = 0x9e3779b97f4a7c15ull;
+  for (T& value : values)
+  {
+    // xorshift64
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    value = static_cast<T>(state);
+  }
+  return values;
+}
+
+// The fastest of the runs of f, each of which returns its time in seconds
+template <typename F>
+double fastest(int repetitions, F f)
+{
+  double best = (std::numeric_limits<double>::max)();
+  for (int i = 0; i < (std::max) (repetitions, 1); ++i)
+  {
+    best = (std::min) (best, f());
+  }
+  return best;
+}
+
+template <typename F>
+double time_of(F f)
+{
+  const auto start = std::chrono::steady_clock::now();
+  f();
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Tunes a threshold below which an algorithm runs sequentially: the smallest size, in a doubling sequence, at which
+// forcing the parallel path is faster than forcing the sequential one. run(n) runs the algorithm on n elements and
+// returns its time.
+template <typename Run>
+::cuda::std::int64_t calibrate_threshold(
+  profile& trial, const char* knob, ::cuda::std::size_t value_size, const calibration_options& options, Run run)
+{
+  for (::cuda::std::size_t n = 256; n <= options.max_threshold; n *= 2)
+  {
+    trial.set(knob, value_size, never);
+    use(trial);
+    const double sequential = fastest(options.repetitions, [&] {
+      return run(n);
+    });
+
+    trial.set(knob, value_size, 0);
+    use(trial);
+    const double parallel = fastest(options.repetitions, [&] {
+      return run(n);
+    });
+
+    // require a clear win, so that the noise of the timings does not pick a size where both paths are as fast
+    if (parallel < 0.95 * sequential)
+    {
+      return static_cast<::cuda::std::int64_t>(n);
+    }
+  }
+  return static_cast<::cuda::std::int64_t>(options.max_threshold * 2);
+}
+
+// Tunes a knob to the fastest of candidates. run() runs the algorithm and returns its time.
+template <typename Run>
+::cuda::std::int64_t calibrate_fastest(
+  profile& trial,
+  const char* knob,
+  ::cuda::std::size_t value_size,
+  const std::vector<::cuda::std::int64_t>& candidates,
+  const calibration_options& options,
+  Run run)
+{
+  ::cuda::std::int64_t best_value = candidates.front();
+  double best_time                = (std::numeric_limits<double>::max)();
+  for (::cuda::std::int64_t candidate : candidates)
+  {
+    trial.set(knob, value_size, candidate);
+    use(trial);
+    const double t = fastest(options.repetitions, run);
+    if (t < best_time)
+    {
+      best_time  = t;
+      best_value = candidate;
+    }
+  }
+  return best_value;
+}
+
+template <typename T, typename ExecutionPolicy>
+void calibrate_find_if(
+  const ExecutionPolicy& exec, const char* knob, profile& result, profile& trial, const calibration_options& options)
+{
+  // no element matches, so that the whole input is searched
+  const std::vector<T> data(options.max_threshold, T{0});
+  const auto threshold = calibrate_threshold(trial, knob, sizeof(T), options, [&](::cuda::std::size_t n) {
+    return time_of([&] {
+      thrust::find(exec, data.data(), data.data() + n, T{1});
+    });
+  });
+  result.set(knob, sizeof(T), threshold);
+  trial.set(knob, sizeof(T), threshold);
+}
+
+template <typename T, typename ExecutionPolicy>
+void calibrate_tbb(const ExecutionPolicy& exec, profile& result, profile& trial, const calibration_options& options)
+{
+  const std::vector<T> keys = random_values<T>(options.problem_size);
+  std::vector<T> sorted(keys.size()), values(keys.size());
+
+  std::vector<::cuda::std::int64_t> leaf_sizes;
+  for (::cuda::std::size_t leaf_size = 1 << 12; leaf_size <= options.problem_size; leaf_size *= 2)
+  {
+    leaf_sizes.push_back(static_cast<::cuda::std::int64_t>(leaf_size));
+  }
+  if (!leaf_sizes.empty())
+  {
+    const auto sort_threshold =
+      calibrate_fastest(trial, knobs::tbb_sort_threshold, sizeof(T), leaf_sizes, options, [&] {
+        std::copy(keys.begin(), keys.end(), sorted.begin());
+        return time_of([&] {
+          thrust::stable_sort(exec, sorted.data(), sorted.data() + sorted.size());
+        });
+      });
+    result.set(knobs::tbb_sort_threshold, sizeof(T), sort_threshold);
+    trial.set(knobs::tbb_sort_threshold, sizeof(T), sort_threshold);
+
+    // the keys and the values are both of type T
+    const auto sort_by_key_threshold =
+      calibrate_fastest(trial, knobs::tbb_sort_by_key_threshold, 2 * sizeof(T), leaf_sizes, options, [&] {
+        std::copy(keys.begin(), keys.end(), sorted.begin());
+        return time_of([&] {
+          thrust::stable_sort_by_key(exec, sorted.data(), sorted.data() + sorted.size(), values.data());
+        });
+      });
+    result.set(knobs::tbb_sort_by_key_threshold, 2 * sizeof(T), sort_by_key_threshold);
+    trial.set(knobs::tbb_sort_by_key_threshold, 2 * sizeof(T), sort_by_key_threshold);
+  }
+
+  calibrate_find_if<T>(exec, knobs::tbb_find_if_sequential_threshold, result, trial, options);
+}
+
+template <typename T, typename ExecutionPolicy>
+void calibrate_omp(const ExecutionPolicy& exec, profile& result, profile& trial, const calibration_options& options)
+{
+  const std::vector<T> input = random_values<T>((std::max) (options.problem_size, options.max_threshold));
+  std::vector<T> output(input.size());
+
+  const auto scan_threshold =
+    calibrate_threshold(trial, knobs::omp_scan_threshold, sizeof(T), options, [&](::cuda::std::size_t n) {
+      return time_of([&] {
+        thrust::inclusive_scan(exec, input.data(), input.data() + n, output.data());
+      });
+    });
+  result.set(knobs::omp_scan_threshold, sizeof(T), scan_threshold);
+  trial.set(knobs::omp_scan_threshold, sizeof(T), scan_threshold);
+
+  const auto tiles_per_processor = calibrate_fastest(
+    trial, knobs::omp_reduce_tiles_per_processor, sizeof(T), {1, 2, 4, 8, 16}, options, [&] {
+      return time_of([&] {
+        thrust::reduce(exec, input.data(), input.data() + options.problem_size);
+      });
+    });
+  result.set(knobs::omp_reduce_tiles_per_processor, sizeof(T), tiles_per_processor);
+  trial.set(knobs::omp_reduce_tiles_per_processor, sizeof(T), tiles_per_processor);
+
+  calibrate_find_if<T>(exec, knobs::omp_find_if_sequential_threshold, result, trial, options);
+}
+
+template <typename T, typename DerivedPolicy>
+void calibrate_value_type(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                          profile& result,
+                          profile& trial,
+                          const calibration_options& options)
+{
+  if constexpr (is_tbb_policy_v<DerivedPolicy>)
+  {
+    calibrate_tbb<T>(exec, result, trial, options);
+  }
+  else if constexpr (is_omp_policy_v<DerivedPolicy>)
+  {
+    calibrate_omp<T>(exec, result, trial, options);
+  }
+}
+} // namespace detail
+
+/*! Benchmarks the knobs of the system of \p exec on the calling machine, and returns their best values for the value
+ *  sizes of \p options. Only the OpenMP and TBB systems have knobs: the profile of another system is empty.
+ *
+ *  The calibration runs the algorithms of \p exec with the knobs set in turn to each of their candidate values, so it
+ *  should run on an otherwise idle machine, and not concurrently with other algorithms of the host systems. The
+ *  profile active before the calibration is active again after it.
+ *
+ *  \param exec The execution policy of the system to tune, e.g. \c thrust::omp::par.
+ *  \param options The value sizes, problem sizes and repetitions of the calibration.
+ *  \return A profile of the tuned knobs, which can be made active with \p use, or saved.
+ */
+template <typename DerivedPolicy>
+profile calibrate(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                  const calibration_options& options = {})
+{
+  const bool was_active    = thrust::detail::active_autotune_table().load(std::memory_order_acquire) != nullptr;
+  const profile previously = active();
+
+  profile result;
+  result.set_machine(profile::current_machine());
+  profile trial;
+
+  for (::cuda::std::size_t value_size : options.value_sizes)
+  {
+    switch (value_size)
+    {
+      case 1:
+        detail::calibrate_value_type<::cuda::std::uint8_t>(exec, result, trial, options);
+        break;
+      case 2:
+        detail::calibrate_value_type<::cuda::std::uint16_t>(exec, result, trial, options);
+        break;
+      case 4:
+        detail::calibrate_value_type<::cuda::std::uint32_t>(exec, result, trial, options);
+        break;
+      case 8:
+        detail::calibrate_value_type<::cuda::std::uint64_t>(exec, result, trial, options);
+        break;
+      default:
+        break;
+    }
+  }
+
+  if (was_active)
+  {
+    use(previously);
+  }
+  else
+  {
+    reset();
+  }
+  return result;
+}
+
+/*! Makes the profile at \p path active, after calibrating the knobs of the system of \p exec into it if it does not
+ *  have them or was made on another machine. A profile can hold the knobs of several systems: those of the other
+ *  systems are kept when the profile is calibrated and saved again.
+ *
+ *  \param exec The execution policy of the system to tune, e.g. \c thrust::tbb::par.
+ *  \param path The path of the profile file.
+ *  \param options The parameters of the calibration, if it is needed.
+ *  \return The active profile.
+ *  \throw std::runtime_error If the profile file is malformed or cannot be written.
+ */
+template <typename DerivedPolicy>
+profile calibrate_once(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                       const std::string& path,
+                       const calibration_options& options = {})
+{
+  profile p;
+  if (!p.load(path) || p.machine() != profile::current_machine())
+  {
+    p = profile{};
+  }
+
+  // the find_if threshold is the last knob a calibration tunes for a value size
+  const char* knob = nullptr;
+  if constexpr (detail::is_tbb_policy_v<DerivedPolicy>)
+  {
+    knob = knobs::tbb_find_if_sequential_threshold;
+  }
+  else if constexpr (detail::is_omp_policy_v<DerivedPolicy>)
+  {
+    knob = knobs::omp_find_if_sequential_threshold;
+  }
+  const bool calibrated =
+    p.machine() == profile::current_machine()
+    && std::all_of(options.value_sizes.begin(), options.value_sizes.end(), [&](::cuda::std::size_t value_size) {
+         const bool calibrated_size = value_size == 1 || value_size == 2 || value_size == 4 || value_size == 8;
+         return !knob || !calibrated_size || p.get(knob, value_size).has_value();
+       });
+
+  if (!calibrated)
+  {
+    p.merge(calibrate(exec, options));
+    p.set_machine(profile::current_machine());
+    p.save(path);
+  }
+
+  use(p);
+  return p;
+}
+
+} // namespace autotune
+
+/*! \} // autotune
+ */
+
+THRUST_NAMESPACE_END
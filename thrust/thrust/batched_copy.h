@@ -0,0 +1,229 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file batched_copy.h
+ *  \brief Copies many ranges or memory buffers of different sizes in a single call
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup algorithms
+ */
+
+/*! \addtogroup copying
+ *  \ingroup algorithms
+ *  \{
+ */
+
+/*! \p batched_copy copies \p num_ranges ranges of different sizes, like \p cub::DeviceCopy::Batched. Range \c i is
+ *  <tt>[input_ranges_first[i], input_ranges_first[i] + sizes_first[i])</tt>, and it is copied to
+ *  <tt>[output_ranges_first[i], output_ranges_first[i] + sizes_first[i])</tt>.
+ *
+ *  The host systems give every thread about the same number of elements to copy, whatever the sizes of the ranges: a
+ *  huge range is split among all threads, and millions of tiny ranges are handed out in chunks of the same total size.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param input_ranges_first The beginning of the sequence of the beginnings of the input ranges.
+ *  \param output_ranges_first The beginning of the sequence of the beginnings of the output ranges.
+ *  \param sizes_first The beginning of the sequence of the sizes of the ranges.
+ *  \param num_ranges The number of ranges to copy.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputRangeIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputRangeIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is a mutable model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam SizeIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam Size is an integral type.
+ *
+ *  \pre The output ranges shall not overlap the input ranges nor each other.
+ *
+ *  The following code snippet demonstrates how to use \p batched_copy to gather rows of different lengths using the
+ *  \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/batched_copy.h>
+ *  #include <thrust/execution_policy.h>
+ *  int values[] = {1, 2, 3, 4, 5, 6};
+ *  int rows[6];
+ *  int* inputs[]  = {values + 3, values};
+ *  int* outputs[] = {rows, rows + 3};
+ *  int sizes[]    = {3, 2};
+ *  thrust::batched_copy(thrust::host, inputs, outputs, sizes, 2);
+ *  // the first five elements of rows are now {4, 5, 6, 1, 2}
+ *  \endcode
+ *
+ *  \see copy_n
+ *  \see batched_memcpy
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename InputRangeIterator,
+          typename OutputRangeIterator,
+          typename SizeIterator,
+          typename Size>
+_CCCL_HOST_DEVICE void batched_copy(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputRangeIterator input_ranges_first,
+  OutputRangeIterator output_ranges_first,
+  SizeIterator sizes_first,
+  Size num_ranges);
+
+/*! \p batched_copy copies \p num_ranges ranges of different sizes. Range \c i is
+ *  <tt>[input_ranges_first[i], input_ranges_first[i] + sizes_first[i])</tt>, and it is copied to
+ *  <tt>[output_ranges_first[i], output_ranges_first[i] + sizes_first[i])</tt>.
+ *
+ *  \param input_ranges_first The beginning of the sequence of the beginnings of the input ranges.
+ *  \param output_ranges_first The beginning of the sequence of the beginnings of the output ranges.
+ *  \param sizes_first The beginning of the sequence of the sizes of the ranges.
+ *  \param num_ranges The number of ranges to copy.
+ *
+ *  \tparam InputRangeIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputRangeIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is a mutable model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam SizeIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam Size is an integral type.
+ *
+ *  \pre The output ranges shall not overlap the input ranges nor each other.
+ *
+ *  \see copy_n
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename InputRangeIterator, typename OutputRangeIterator, typename SizeIterator, typename Size>
+void batched_copy(InputRangeIterator input_ranges_first,
+                  OutputRangeIterator output_ranges_first,
+                  SizeIterator sizes_first,
+                  Size num_ranges);
+
+/*! \p batched_memcpy copies \p num_buffers memory buffers of different sizes, like \p cub::DeviceMemcpy::Batched. The
+ *  <tt>sizes_first[i]</tt> bytes at <tt>input_buffers_first[i]</tt> are copied to <tt>output_buffers_first[i]</tt>.
+ *
+ *  The host systems give every thread about the same number of bytes to copy, whatever the sizes of the buffers: a
+ *  huge buffer is split among all threads, and millions of tiny buffers are handed out in chunks of the same total
+ *  size. The buffers of up to a few words are copied with a couple of overlapping loads and stores rather than with a
+ *  call to \c memcpy.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param input_buffers_first The beginning of the sequence of pointers to the input buffers.
+ *  \param output_buffers_first The beginning of the sequence of pointers to the output buffers.
+ *  \param sizes_first The beginning of the sequence of the sizes of the buffers, in bytes.
+ *  \param num_buffers The number of buffers to copy.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputBufferIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is a pointer type.
+ *  \tparam OutputBufferIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is a pointer type to non-const.
+ *  \tparam SizeIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam Size is an integral type.
+ *
+ *  \pre The output buffers shall not overlap the input buffers nor each other.
+ *
+ *  The following code snippet demonstrates how to use \p batched_memcpy to gather strings using the \p thrust::host
+ *  execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/batched_copy.h>
+ *  #include <thrust/execution_policy.h>
+ *  const char text[] = "ApplesBananasGrapes";
+ *  char fruits[19];
+ *  const char* inputs[] = {text + 13, text, text + 6};
+ *  char* outputs[]      = {fruits, fruits + 6, fruits + 12};
+ *  size_t sizes[]       = {6, 6, 7};
+ *  thrust::batched_memcpy(thrust::host, inputs, outputs, sizes, 3);
+ *  // fruits is now "GrapesApplesBananas"
+ *  \endcode
+ *
+ *  \see batched_copy
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename InputBufferIterator,
+          typename OutputBufferIterator,
+          typename SizeIterator,
+          typename Size>
+_CCCL_HOST_DEVICE void batched_memcpy(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputBufferIterator input_buffers_first,
+  OutputBufferIterator output_buffers_first,
+  SizeIterator sizes_first,
+  Size num_buffers);
+
+/*! \p batched_memcpy copies \p num_buffers memory buffers of different sizes. The <tt>sizes_first[i]</tt> bytes at
+ *  <tt>input_buffers_first[i]</tt> are copied to <tt>output_buffers_first[i]</tt>.
+ *
+ *  \param input_buffers_first The beginning of the sequence of pointers to the input buffers.
+ *  \param output_buffers_first The beginning of the sequence of pointers to the output buffers.
+ *  \param sizes_first The beginning of the sequence of the sizes of the buffers, in bytes.
+ *  \param num_buffers The number of buffers to copy.
+ *
+ *  \tparam InputBufferIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is a pointer type.
+ *  \tparam OutputBufferIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is a pointer type to non-const.
+ *  \tparam SizeIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam Size is an integral type.
+ *
+ *  \pre The output buffers shall not overlap the input buffers nor each other.
+ *
+ *  \see batched_copy
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename InputBufferIterator, typename OutputBufferIterator, typename SizeIterator, typename Size>
+void batched_memcpy(InputBufferIterator input_buffers_first,
+                    OutputBufferIterator output_buffers_first,
+                    SizeIterator sizes_first,
+                    Size num_buffers);
+
+/*! \} // end copying
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/batched_copy.inl>
@@ -39,7 +39,7 @@ _CCCL_HOST_DEVICE OutputIterator adjacent_difference(
   InputIterator last,
   OutputIterator result)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::adjacent_difference");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::adjacent_difference");
   using thrust::system::detail::generic::adjacent_difference;
 
   return adjacent_difference(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
@@ -54,7 +54,7 @@ _CCCL_HOST_DEVICE OutputIterator adjacent_difference(
   OutputIterator result,
   BinaryFunction binary_op)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::adjacent_difference");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::adjacent_difference");
   using thrust::system::detail::generic::adjacent_difference;
 
   return adjacent_difference(
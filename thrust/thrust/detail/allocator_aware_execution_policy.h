@@ -75,6 +75,58 @@ struct allocator_aware_execution_policy
     return typename execute_with_allocator_type<Allocator>::type(::cuda::std::forward<Allocator>(alloc));
   }
 };
+
+//! Like \p allocator_aware_execution_policy, for a policy \p Derived whose CRTP base
+//! <tt>ExecutionPolicyCRTPBase<Derived></tt> carries state, such as an environment or a task arena. The policies it
+//! returns for an allocator keep that state: <tt>ExecutionPolicyCRTPBase</tt> must be constructible from \p Derived for
+//! any other derived policy.
+template <template <typename> class ExecutionPolicyCRTPBase, typename Derived>
+struct stateful_allocator_aware_execution_policy : allocator_aware_execution_policy<ExecutionPolicyCRTPBase>
+{
+private:
+  using super_t = allocator_aware_execution_policy<ExecutionPolicyCRTPBase>;
+
+  template <typename Policy, typename Allocator>
+  _CCCL_HOST_DEVICE Policy make_policy(Allocator&& alloc) const
+  {
+    return Policy(ExecutionPolicyCRTPBase<Policy>(static_cast<const Derived&>(*this)),
+                  ::cuda::std::forward<Allocator>(alloc));
+  }
+
+public:
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename MemoryResource>
+  _CCCL_HOST_DEVICE typename super_t::template execute_with_memory_resource_type<MemoryResource>::type
+  operator()(MemoryResource* mem_res) const
+  {
+    return make_policy<typename super_t::template execute_with_memory_resource_type<MemoryResource>::type>(mem_res);
+  }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename Allocator>
+  _CCCL_HOST_DEVICE typename super_t::template execute_with_allocator_type<Allocator&>::type
+  operator()(Allocator& alloc) const
+  {
+    return make_policy<typename super_t::template execute_with_allocator_type<Allocator&>::type>(alloc);
+  }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename Allocator>
+  _CCCL_HOST_DEVICE typename super_t::template execute_with_allocator_type<Allocator>::type
+  operator()(const Allocator& alloc) const
+  {
+    return make_policy<typename super_t::template execute_with_allocator_type<Allocator>::type>(alloc);
+  }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename Allocator, ::cuda::std::enable_if_t<!::cuda::std::is_lvalue_reference_v<Allocator>>* = nullptr>
+  _CCCL_HOST_DEVICE typename super_t::template execute_with_allocator_type<Allocator>::type
+  operator()(Allocator&& alloc) const
+  {
+    return make_policy<typename super_t::template execute_with_allocator_type<Allocator>::type>(
+      ::cuda::std::forward<Allocator>(alloc));
+  }
+};
 } // end namespace detail
 
 THRUST_NAMESPACE_END
@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__type_traits/is_integral.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/limits>
+
+#include <atomic>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace detail
+{
+// The knobs of the host algorithms which thrust::autotune tunes, named by thrust::autotune::knobs
+enum class autotune_knob : int
+{
+  tbb_sort_threshold,
+  tbb_sort_by_key_threshold,
+  tbb_find_if_sequential_threshold,
+  omp_scan_threshold,
+  omp_reduce_tiles_per_processor,
+  omp_find_if_sequential_threshold,
+  count
+};
+
+// The tuned values of the knobs, for values of 1 to max_value_size bytes. The algorithms only read the active table, so
+// a table is never modified once it is active, and is kept alive until the end of the program.
+struct autotune_table
+{
+  static constexpr ::cuda::std::size_t num_knobs      = static_cast<::cuda::std::size_t>(autotune_knob::count);
+  static constexpr ::cuda::std::size_t max_value_size = 16;
+
+  bool has_value[num_knobs][max_value_size]              = {};
+  ::cuda::std::int64_t values[num_knobs][max_value_size] = {};
+};
+
+// The active table, or nullptr when the algorithms use their built-in defaults. It is set by thrust::autotune::use and
+// thrust::autotune::load, and nothing is loaded implicitly.
+inline std::atomic<const autotune_table*>& active_autotune_table()
+{
+  static std::atomic<const autotune_table*> table{nullptr};
+  return table;
+}
+
+// The value of an autotuned knob for values of value_size bytes: the value of the active table, clamped to the range of
+// T, or default_value if there is no active table or it does not have the knob
+template <typename T>
+T tuned_value(autotune_knob knob, ::cuda::std::size_t value_size, T default_value)
+{
+  static_assert(::cuda::std::is_integral_v<T>, "the knobs are integers");
+
+  const autotune_table* table = active_autotune_table().load(std::memory_order_acquire);
+  if (!table || value_size == 0 || value_size > autotune_table::max_value_size)
+  {
+    return default_value;
+  }
+  const auto k = static_cast<::cuda::std::size_t>(knob);
+  if (!table->has_value[k][value_size - 1])
+  {
+    return default_value;
+  }
+
+  const ::cuda::std::int64_t value = table->values[k][value_size - 1];
+  using limits                     = ::cuda::std::numeric_limits<T>;
+  if (value < static_cast<::cuda::std::int64_t>(limits::min()))
+  {
+    return limits::min();
+  }
+  if (value > 0 && static_cast<::cuda::std::uint64_t>(value) > static_cast<::cuda::std::uint64_t>(limits::max()))
+  {
+    return limits::max();
+  }
+  return static_cast<T>(value);
+}
+} // namespace detail
+
+THRUST_NAMESPACE_END
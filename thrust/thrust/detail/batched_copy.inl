@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/batched_copy.h>
+#include <thrust/detail/nvtx_policy.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/select_system.h>
+
+// Include all active backend system implementations (generic, sequential, host and device)
+#include <thrust/system/detail/generic/batched_copy.h>
+#include <thrust/system/detail/sequential/batched_copy.h>
+#include __THRUST_HOST_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(batched_copy.h)
+#include __THRUST_DEVICE_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(batched_copy.h)
+
+// Some build systems need a hint to know which files we could include
+#if 0
+#  include <thrust/system/cpp/detail/batched_copy.h>
+#  include <thrust/system/cuda/detail/batched_copy.h>
+#  include <thrust/system/omp/detail/batched_copy.h>
+#  include <thrust/system/tbb/detail/batched_copy.h>
+#endif
+
+THRUST_NAMESPACE_BEGIN
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename InputRangeIterator,
+          typename OutputRangeIterator,
+          typename SizeIterator,
+          typename Size>
+_CCCL_HOST_DEVICE void batched_copy(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputRangeIterator input_ranges_first,
+  OutputRangeIterator output_ranges_first,
+  SizeIterator sizes_first,
+  Size num_ranges)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::batched_copy");
+  using thrust::system::detail::generic::batched_copy;
+  batched_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+               input_ranges_first,
+               output_ranges_first,
+               sizes_first,
+               num_ranges);
+} // end batched_copy()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename InputBufferIterator,
+          typename OutputBufferIterator,
+          typename SizeIterator,
+          typename Size>
+_CCCL_HOST_DEVICE void batched_memcpy(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputBufferIterator input_buffers_first,
+  OutputBufferIterator output_buffers_first,
+  SizeIterator sizes_first,
+  Size num_buffers)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::batched_memcpy");
+  using thrust::system::detail::generic::batched_memcpy;
+  batched_memcpy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+                 input_buffers_first,
+                 output_buffers_first,
+                 sizes_first,
+                 num_buffers);
+} // end batched_memcpy()
+
+template <typename InputRangeIterator, typename OutputRangeIterator, typename SizeIterator, typename Size>
+void batched_copy(InputRangeIterator input_ranges_first,
+                  OutputRangeIterator output_ranges_first,
+                  SizeIterator sizes_first,
+                  Size num_ranges)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::batched_copy");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<InputRangeIterator>::type;
+  using System2 = typename thrust::iterator_system<OutputRangeIterator>::type;
+  using System3 = typename thrust::iterator_system<SizeIterator>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  thrust::batched_copy(
+    select_system(system1, system2, system3), input_ranges_first, output_ranges_first, sizes_first, num_ranges);
+} // end batched_copy()
+
+template <typename InputBufferIterator, typename OutputBufferIterator, typename SizeIterator, typename Size>
+void batched_memcpy(InputBufferIterator input_buffers_first,
+                    OutputBufferIterator output_buffers_first,
+                    SizeIterator sizes_first,
+                    Size num_buffers)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::batched_memcpy");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<InputBufferIterator>::type;
+  using System2 = typename thrust::iterator_system<OutputBufferIterator>::type;
+  using System3 = typename thrust::iterator_system<SizeIterator>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  thrust::batched_memcpy(
+    select_system(system1, system2, system3), input_buffers_first, output_buffers_first, sizes_first, num_buffers);
+} // end batched_memcpy()
+
+THRUST_NAMESPACE_END
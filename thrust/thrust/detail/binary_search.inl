@@ -40,7 +40,7 @@ _CCCL_HOST_DEVICE ForwardIterator lower_bound(
   ForwardIterator last,
   const LessThanComparable& value)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::lower_bound");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::lower_bound");
   using thrust::system::detail::generic::lower_bound;
   return lower_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 }
@@ -54,7 +54,7 @@ _CCCL_HOST_DEVICE ForwardIterator lower_bound(
   const T& value,
   StrictWeakOrdering comp)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::lower_bound");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::lower_bound");
   using thrust::system::detail::generic::lower_bound;
   return lower_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value, comp);
 }
@@ -67,7 +67,7 @@ _CCCL_HOST_DEVICE ForwardIterator upper_bound(
   ForwardIterator last,
   const LessThanComparable& value)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::upper_bound");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::upper_bound");
   using thrust::system::detail::generic::upper_bound;
   return upper_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 }
@@ -81,7 +81,7 @@ _CCCL_HOST_DEVICE ForwardIterator upper_bound(
   const T& value,
   StrictWeakOrdering comp)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::upper_bound");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::upper_bound");
   using thrust::system::detail::generic::upper_bound;
   return upper_bound(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value, comp);
 }
@@ -94,7 +94,7 @@ _CCCL_HOST_DEVICE bool binary_search(
   ForwardIterator last,
   const LessThanComparable& value)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::binary_search");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::binary_search");
   using thrust::system::detail::generic::binary_search;
   return binary_search(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 }
@@ -108,7 +108,7 @@ _CCCL_HOST_DEVICE bool binary_search(
   const T& value,
   StrictWeakOrdering comp)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::binary_search");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::binary_search");
   using thrust::system::detail::generic::binary_search;
   return binary_search(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value, comp);
 }
@@ -122,7 +122,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<ForwardIterator, ForwardIterator> equal_rang
   const T& value,
   StrictWeakOrdering comp)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::equal_range");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::equal_range");
   using thrust::system::detail::generic::equal_range;
   return equal_range(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value, comp);
 }
@@ -135,7 +135,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<ForwardIterator, ForwardIterator> equal_rang
   ForwardIterator last,
   const LessThanComparable& value)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::equal_range");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::equal_range");
   using thrust::system::detail::generic::equal_range;
   return equal_range(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 }
@@ -150,7 +150,7 @@ _CCCL_HOST_DEVICE OutputIterator lower_bound(
   InputIterator values_last,
   OutputIterator output)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::lower_bound");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::lower_bound");
   using thrust::system::detail::generic::lower_bound;
   return lower_bound(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_first, values_last, output);
@@ -171,7 +171,7 @@ _CCCL_HOST_DEVICE OutputIterator lower_bound(
   OutputIterator output,
   StrictWeakOrdering comp)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::lower_bound");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::lower_bound");
   using thrust::system::detail::generic::lower_bound;
   return lower_bound(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -193,7 +193,7 @@ _CCCL_HOST_DEVICE OutputIterator upper_bound(
   InputIterator values_last,
   OutputIterator output)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::upper_bound");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::upper_bound");
   using thrust::system::detail::generic::upper_bound;
   return upper_bound(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_first, values_last, output);
@@ -214,7 +214,7 @@ _CCCL_HOST_DEVICE OutputIterator upper_bound(
   OutputIterator output,
   StrictWeakOrdering comp)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::upper_bound");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::upper_bound");
   using thrust::system::detail::generic::upper_bound;
   return upper_bound(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -236,7 +236,7 @@ _CCCL_HOST_DEVICE OutputIterator binary_search(
   InputIterator values_last,
   OutputIterator output)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::binary_search");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::binary_search");
   using thrust::system::detail::generic::binary_search;
   return binary_search(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_first, values_last, output);
@@ -257,7 +257,7 @@ _CCCL_HOST_DEVICE OutputIterator binary_search(
   OutputIterator output,
   StrictWeakOrdering comp)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::binary_search");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::binary_search");
   using thrust::system::detail::generic::binary_search;
   return binary_search(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -20,6 +20,8 @@
 #include <cuda/std/__iterator/iterator_traits.h>
 #include <cuda/std/__memory/allocator_traits.h>
 #include <cuda/std/__type_traits/is_swappable.h>
+#include <cuda/std/__type_traits/void_t.h>
+#include <cuda/std/__utility/declval.h>
 #include <cuda/std/__utility/move.h>
 #include <cuda/std/__utility/swap.h>
 
@@ -37,6 +39,19 @@ struct allocator_mismatch_on_swap : std::runtime_error
   {}
 };
 
+// an allocator may resize its allocations in place, or move them without copying their bytes, with
+// reallocate(p, old_n, new_n), which returns a null pointer when it cannot
+template <typename Alloc, typename = void>
+inline constexpr bool allocator_has_reallocate = false;
+
+template <typename Alloc>
+inline constexpr bool allocator_has_reallocate<
+  Alloc,
+  ::cuda::std::void_t<decltype(::cuda::std::declval<Alloc&>().reallocate(
+    ::cuda::std::declval<typename ::cuda::std::allocator_traits<Alloc>::pointer>(),
+    ::cuda::std::declval<typename ::cuda::std::allocator_traits<Alloc>::size_type>(),
+    ::cuda::std::declval<typename ::cuda::std::allocator_traits<Alloc>::size_type>()))>> = true;
+
 // XXX parameter T is redundant with parameter Alloc
 template <typename T, typename Alloc>
 class contiguous_storage
@@ -101,6 +116,10 @@ public:
 
   _CCCL_HOST_DEVICE void deallocate() noexcept;
 
+  // resizes the storage to n elements with the allocator's reallocate, which keeps their bytes, so only for trivially
+  // relocatable elements; returns false, leaving the storage as it was, if the allocator cannot
+  bool reallocate(size_type n);
+
 private:
   static constexpr bool is_swap_noexcept()
   {
@@ -18,6 +18,7 @@
 #include <thrust/detail/allocator/fill_construct_range.h>
 #include <thrust/detail/allocator/value_initialize_range.h>
 #include <thrust/detail/contiguous_storage.h>
+#include <thrust/detail/raw_pointer_cast.h>
 
 #include <cuda/std/__host_stdlib/stdexcept>
 #include <cuda/std/__utility/move.h>
@@ -168,6 +169,25 @@ _CCCL_HOST_DEVICE void contiguous_storage<T, Alloc>::deallocate() noexcept
   } // end if
 } // end contiguous_storage::deallocate()
 
+template <typename T, typename Alloc>
+bool contiguous_storage<T, Alloc>::reallocate([[maybe_unused]] size_type n)
+{
+  if constexpr (allocator_has_reallocate<Alloc>)
+  {
+    if (size() > 0 && n > 0)
+    {
+      pointer p = m_allocator.reallocate(m_begin.base(), size(), n);
+      if (thrust::raw_pointer_cast(p) != nullptr)
+      {
+        m_begin = iterator(p);
+        m_size  = n;
+        return true;
+      } // end if
+    } // end if
+  } // end if
+  return false;
+} // end contiguous_storage::reallocate()
+
 template <typename T, typename Alloc>
 _CCCL_HOST_DEVICE void contiguous_storage<T, Alloc>::value_initialize_n(iterator first, size_type n)
 {
@@ -40,7 +40,7 @@ copy(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
      InputIterator last,
      OutputIterator result)
 {
-  _CCCL_NVTX_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<DerivedPolicy>(), "thrust::copy");
+  _THRUST_POLICY_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<DerivedPolicy>(), DerivedPolicy, "thrust::copy");
   using thrust::system::detail::generic::copy;
   return copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end copy()
@@ -50,7 +50,8 @@ template <typename DerivedPolicy, typename InputIterator, typename Size, typenam
 _CCCL_HOST_DEVICE OutputIterator copy_n(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, InputIterator first, Size n, OutputIterator result)
 {
-  _CCCL_NVTX_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<DerivedPolicy>(), "thrust::copy_n");
+  _THRUST_POLICY_RANGE_SCOPE_IF(
+    detail::should_enable_nvtx_for_policy<DerivedPolicy>(), DerivedPolicy, "thrust::copy_n");
   using thrust::system::detail::generic::copy_n;
   return copy_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, result);
 } // end copy_n()
@@ -66,8 +67,10 @@ _CCCL_HOST_DEVICE OutputIterator two_system_copy(
   InputIterator last,
   OutputIterator result)
 {
-  _CCCL_NVTX_RANGE_SCOPE_IF(should_enable_nvtx_for_policy<System1>() || should_enable_nvtx_for_policy<System2>(),
-                            "thrust::two_system_copy");
+  _CCCL_NVTX_HOST_RANGE_SCOPE_IF(
+    should_enable_nvtx_for_policy<System1>() || should_enable_nvtx_for_policy<System2>(),
+    should_record_host_range_for_policy<System1>() || should_record_host_range_for_policy<System2>(),
+    "thrust::two_system_copy");
   using thrust::system::detail::generic::select_system;
 
   return thrust::copy(
@@ -87,8 +90,10 @@ _CCCL_HOST_DEVICE OutputIterator two_system_copy_n(
   Size n,
   OutputIterator result)
 {
-  _CCCL_NVTX_RANGE_SCOPE_IF(should_enable_nvtx_for_policy<System1>() || should_enable_nvtx_for_policy<System2>(),
-                            "thrust::two_system_copy_n");
+  _CCCL_NVTX_HOST_RANGE_SCOPE_IF(
+    should_enable_nvtx_for_policy<System1>() || should_enable_nvtx_for_policy<System2>(),
+    should_record_host_range_for_policy<System1>() || should_record_host_range_for_policy<System2>(),
+    "thrust::two_system_copy_n");
   using thrust::system::detail::generic::select_system;
 
   return thrust::copy_n(
@@ -105,8 +110,9 @@ OutputIterator copy(InputIterator first, InputIterator last, OutputIterator resu
 {
   using System1 = typename thrust::iterator_system<InputIterator>::type;
   using System2 = typename thrust::iterator_system<OutputIterator>::type;
-  _CCCL_NVTX_RANGE_SCOPE_IF(
+  _CCCL_NVTX_HOST_RANGE_SCOPE_IF(
     detail::should_enable_nvtx_for_policy<System1>() || detail::should_enable_nvtx_for_policy<System2>(),
+    detail::should_record_host_range_for_policy<System1>() || detail::should_record_host_range_for_policy<System2>(),
     "thrust::copy");
 
   System1 system1;
@@ -120,8 +126,9 @@ OutputIterator copy_n(InputIterator first, Size n, OutputIterator result)
 {
   using System1 = typename thrust::iterator_system<InputIterator>::type;
   using System2 = typename thrust::iterator_system<OutputIterator>::type;
-  _CCCL_NVTX_RANGE_SCOPE_IF(
+  _CCCL_NVTX_HOST_RANGE_SCOPE_IF(
     detail::should_enable_nvtx_for_policy<System1>() || detail::should_enable_nvtx_for_policy<System2>(),
+    detail::should_record_host_range_for_policy<System1>() || detail::should_record_host_range_for_policy<System2>(),
     "thrust::copy_n");
 
   System1 system1;
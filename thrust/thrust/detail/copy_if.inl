@@ -41,7 +41,7 @@ _CCCL_HOST_DEVICE OutputIterator copy_if(
   OutputIterator result,
   Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::copy_if");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::copy_if");
   using thrust::system::detail::generic::copy_if;
   return copy_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, pred);
 } // end copy_if()
@@ -60,7 +60,7 @@ _CCCL_HOST_DEVICE OutputIterator copy_if(
   OutputIterator result,
   Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::copy_if");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::copy_if");
   using thrust::system::detail::generic::copy_if;
   return copy_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, result, pred);
 } // end copy_if()
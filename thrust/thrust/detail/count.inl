@@ -40,7 +40,7 @@ count(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
       InputIterator last,
       const EqualityComparable& value)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::count");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::count");
   using thrust::system::detail::generic::count;
   return count(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 } // end count()
@@ -53,7 +53,7 @@ count_if(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
          InputIterator last,
          Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::count_if");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::count_if");
   using thrust::system::detail::generic::count_if;
   return count_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end count_if()
@@ -0,0 +1,151 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/allocator_aware_execution_policy.h>
+
+#include <cuda/__execution/determinism.h>
+#include <cuda/__execution/output_ordering.h>
+#include <cuda/__execution/require.h>
+#include <cuda/std/__execution/env.h>
+#include <cuda/std/__type_traits/decay.h>
+#include <cuda/std/__type_traits/is_constructible.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/__type_traits/void_t.h>
+#include <cuda/std/__utility/declval.h>
+#include <cuda/std/__utility/forward.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+//! The CRTP base of a policy of \p BaseSystem that carries an environment. <tt>with_env<Env, BaseSystem>::type</tt> is
+//! itself a \p BaseSystem, so the policy can be given an allocator and keep its environment, and \p BaseSystem may
+//! carry state of its own, such as the arena of a TBB policy.
+template <typename Env, template <typename> class BaseSystem>
+struct with_env
+{
+  template <typename Derived>
+  struct type : BaseSystem<Derived>
+  {
+  private:
+    using super_t = BaseSystem<Derived>;
+
+    Env env;
+
+    // the base of another policy, rebound to Derived if it carries state, or a new one if it does not
+    template <typename Other>
+    _CCCL_HOST_DEVICE static super_t rebind_base([[maybe_unused]] const BaseSystem<Other>& other)
+    {
+      if constexpr (::cuda::std::is_constructible_v<super_t, const BaseSystem<Other>&>)
+      {
+        return super_t(other);
+      }
+      else
+      {
+        return super_t();
+      }
+    }
+
+  public:
+    template <typename... BaseArgs>
+    _CCCL_HOST_DEVICE explicit type(Env env_, BaseArgs&&... base_args)
+        : super_t(::cuda::std::forward<BaseArgs>(base_args)...)
+        , env(env_)
+    {}
+
+    template <typename Other>
+    _CCCL_HOST_DEVICE type(const type<Other>& other)
+        : super_t(rebind_base(other))
+        , env(other.get_env())
+    {}
+
+    _CCCL_HOST_DEVICE const Env& get_env() const
+    {
+      return env;
+    }
+  };
+};
+
+//! An execution policy of \p BaseSystem that carries an environment, such as the one returned by
+//! <tt>cuda::execution::require(cuda::execution::determinism::run_to_run)</tt>. Like \p par, it can be given an
+//! allocator: <tt>thrust::omp::par.with(env)(alloc)</tt> carries both.
+template <typename Env, template <typename> class BaseSystem>
+struct execute_with_env
+    : with_env<Env, BaseSystem>::template type<execute_with_env<Env, BaseSystem>>
+    , stateful_allocator_aware_execution_policy<with_env<Env, BaseSystem>::template type,
+                                                execute_with_env<Env, BaseSystem>>
+{
+private:
+  using super_t = typename with_env<Env, BaseSystem>::template type<execute_with_env<Env, BaseSystem>>;
+
+public:
+  using super_t::super_t;
+};
+
+// the environment of any policy with a get_env() member, such as execute_with_env or an execute_with_allocator whose
+// base system is with_env<Env, BaseSystem>::type
+template <typename DerivedPolicy, typename = void>
+struct execution_policy_env
+{
+  using type = ::cuda::std::execution::env<>;
+};
+
+template <typename DerivedPolicy>
+struct execution_policy_env<DerivedPolicy,
+                            ::cuda::std::void_t<decltype(::cuda::std::declval<const DerivedPolicy&>().get_env())>>
+{
+  using type = ::cuda::std::decay_t<decltype(::cuda::std::declval<const DerivedPolicy&>().get_env())>;
+};
+
+//! True if \p DerivedPolicy carries an environment
+template <typename DerivedPolicy, typename = void>
+inline constexpr bool execution_policy_has_env_v = false;
+
+template <typename DerivedPolicy>
+inline constexpr bool execution_policy_has_env_v<
+  DerivedPolicy,
+  ::cuda::std::void_t<decltype(::cuda::std::declval<const DerivedPolicy&>().get_env())>> = true;
+
+template <typename DerivedPolicy>
+using execution_policy_determinism_t = ::cuda::std::execution::__query_result_or_t<
+  ::cuda::std::execution::__query_result_or_t<typename execution_policy_env<DerivedPolicy>::type,
+                                              ::cuda::execution::__get_requirements_t,
+                                              ::cuda::std::execution::env<>>,
+  ::cuda::execution::determinism::__get_determinism_t,
+  ::cuda::execution::determinism::not_guaranteed_t>;
+
+//! True if the environment of \p DerivedPolicy requires results that do not change from run to run. The host systems
+//! do not distinguish between \c run_to_run and \c gpu_to_gpu: both give the same results for any number of threads.
+template <typename DerivedPolicy>
+inline constexpr bool requires_determinism_v =
+  !::cuda::std::is_same_v<execution_policy_determinism_t<DerivedPolicy>,
+                          ::cuda::execution::determinism::not_guaranteed_t>;
+
+template <typename DerivedPolicy>
+using execution_policy_output_ordering_t = ::cuda::std::execution::__query_result_or_t<
+  ::cuda::std::execution::__query_result_or_t<typename execution_policy_env<DerivedPolicy>::type,
+                                              ::cuda::execution::__get_requirements_t,
+                                              ::cuda::std::execution::env<>>,
+  ::cuda::execution::output_ordering::__get_output_ordering_t,
+  ::cuda::execution::output_ordering::stable_sorted_t>;
+
+//! True unless the environment of \p DerivedPolicy allows an algorithm such as \p topk to write its results in any
+//! order. The host systems do not distinguish between \c sorted and \c stable_sorted: ties are always broken by the
+//! smaller index.
+template <typename DerivedPolicy>
+inline constexpr bool requires_sorted_output_v =
+  !::cuda::std::is_same_v<execution_policy_output_ordering_t<DerivedPolicy>,
+                          ::cuda::execution::output_ordering::unsorted_t>;
+} // namespace detail
+THRUST_NAMESPACE_END
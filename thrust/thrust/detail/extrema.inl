@@ -37,7 +37,7 @@ template <typename DerivedPolicy, typename ForwardIterator>
 _CCCL_HOST_DEVICE ForwardIterator min_element(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
-  _CCCL_NVTX_RANGE_SCOPE("min_element");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "min_element");
   using thrust::system::detail::generic::min_element;
   return min_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end min_element()
@@ -50,7 +50,7 @@ _CCCL_HOST_DEVICE ForwardIterator min_element(
   ForwardIterator last,
   BinaryPredicate comp)
 {
-  _CCCL_NVTX_RANGE_SCOPE("min_element");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "min_element");
   using thrust::system::detail::generic::min_element;
   return min_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end min_element()
@@ -60,7 +60,7 @@ template <typename DerivedPolicy, typename ForwardIterator>
 _CCCL_HOST_DEVICE ForwardIterator max_element(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
-  _CCCL_NVTX_RANGE_SCOPE("max_element");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "max_element");
   using thrust::system::detail::generic::max_element;
   return max_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end max_element()
@@ -73,7 +73,7 @@ _CCCL_HOST_DEVICE ForwardIterator max_element(
   ForwardIterator last,
   BinaryPredicate comp)
 {
-  _CCCL_NVTX_RANGE_SCOPE("max_element");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "max_element");
   using thrust::system::detail::generic::max_element;
   return max_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end max_element()
@@ -83,7 +83,7 @@ template <typename DerivedPolicy, typename ForwardIterator>
 _CCCL_HOST_DEVICE ::cuda::std::pair<ForwardIterator, ForwardIterator> minmax_element(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
-  _CCCL_NVTX_RANGE_SCOPE("minmax_element");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "minmax_element");
   using thrust::system::detail::generic::minmax_element;
   return minmax_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end minmax_element()
@@ -96,7 +96,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<ForwardIterator, ForwardIterator> minmax_ele
   ForwardIterator last,
   BinaryPredicate comp)
 {
-  _CCCL_NVTX_RANGE_SCOPE("minmax_element");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "minmax_element");
   using thrust::system::detail::generic::minmax_element;
   return minmax_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end minmax_element()
@@ -42,7 +42,7 @@ fill(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
      ForwardIterator last,
      const T& value)
 {
-  _CCCL_NVTX_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<DerivedPolicy>(), "thrust::fill");
+  _THRUST_POLICY_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<DerivedPolicy>(), DerivedPolicy, "thrust::fill");
   using thrust::system::detail::generic::fill;
   return fill(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 } // end fill()
@@ -52,7 +52,8 @@ template <typename DerivedPolicy, typename OutputIterator, typename Size, typena
 _CCCL_HOST_DEVICE OutputIterator
 fill_n(const thrust::detail::execution_policy_base<DerivedPolicy>& exec, OutputIterator first, Size n, const T& value)
 {
-  _CCCL_NVTX_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<DerivedPolicy>(), "thrust::fill_n");
+  _THRUST_POLICY_RANGE_SCOPE_IF(
+    detail::should_enable_nvtx_for_policy<DerivedPolicy>(), DerivedPolicy, "thrust::fill_n");
   using thrust::system::detail::generic::fill_n;
   return fill_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, value);
 } // end fill_n()
@@ -61,7 +62,7 @@ template <typename ForwardIterator, typename T>
 _CCCL_HOST_DEVICE void fill(ForwardIterator first, ForwardIterator last, const T& value)
 {
   using System = typename thrust::iterator_system<ForwardIterator>::type;
-  _CCCL_NVTX_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<System>(), "thrust::fill");
+  _THRUST_POLICY_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<System>(), System, "thrust::fill");
   using thrust::system::detail::generic::select_system;
 
   System system;
@@ -73,7 +74,7 @@ template <typename OutputIterator, typename Size, typename T>
 _CCCL_HOST_DEVICE OutputIterator fill_n(OutputIterator first, Size n, const T& value)
 {
   using System = typename thrust::iterator_system<OutputIterator>::type;
-  _CCCL_NVTX_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<System>(), "thrust::fill_n");
+  _THRUST_POLICY_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<System>(), System, "thrust::fill_n");
   using thrust::system::detail::generic::select_system;
 
   System system;
@@ -39,7 +39,7 @@ find(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
      InputIterator last,
      const T& value)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::find");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::find");
   using thrust::system::detail::generic::find;
   return find(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 } // end find()
@@ -52,7 +52,7 @@ _CCCL_HOST_DEVICE InputIterator find_if(
   InputIterator last,
   Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::find_if");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::find_if");
   using thrust::system::detail::generic::find_if;
   return find_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end find_if()
@@ -65,7 +65,7 @@ _CCCL_HOST_DEVICE InputIterator find_if_not(
   InputIterator last,
   Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::find_if_not");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::find_if_not");
   using thrust::system::detail::generic::find_if_not;
   return find_if_not(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end find_if_not()
@@ -41,7 +41,8 @@ _CCCL_HOST_DEVICE InputIterator for_each(
   InputIterator last,
   UnaryFunction f)
 {
-  _CCCL_NVTX_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<DerivedPolicy>(), "thrust::for_each");
+  _THRUST_POLICY_RANGE_SCOPE_IF(
+    detail::should_enable_nvtx_for_policy<DerivedPolicy>(), DerivedPolicy, "thrust::for_each");
   using thrust::system::detail::generic::for_each;
 
   return for_each(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, f);
@@ -51,7 +52,7 @@ template <typename InputIterator, typename UnaryFunction>
 InputIterator for_each(InputIterator first, InputIterator last, UnaryFunction f)
 {
   using System = typename thrust::iterator_system<InputIterator>::type;
-  _CCCL_NVTX_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<System>(), "thrust::for_each");
+  _THRUST_POLICY_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<System>(), System, "thrust::for_each");
   using thrust::system::detail::generic::select_system;
 
   System system;
@@ -63,7 +64,8 @@ template <typename DerivedPolicy, typename InputIterator, typename Size, typenam
 _CCCL_HOST_DEVICE InputIterator for_each_n(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, InputIterator first, Size n, UnaryFunction f)
 {
-  _CCCL_NVTX_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<DerivedPolicy>(), "thrust::for_each_n");
+  _THRUST_POLICY_RANGE_SCOPE_IF(
+    detail::should_enable_nvtx_for_policy<DerivedPolicy>(), DerivedPolicy, "thrust::for_each_n");
   using thrust::system::detail::generic::for_each_n;
 
   return for_each_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, f);
@@ -73,7 +75,7 @@ template <typename InputIterator, typename Size, typename UnaryFunction>
 InputIterator for_each_n(InputIterator first, Size n, UnaryFunction f)
 {
   using System = typename thrust::iterator_system<InputIterator>::type;
-  _CCCL_NVTX_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<System>(), "thrust::for_each_n");
+  _THRUST_POLICY_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<System>(), System, "thrust::for_each_n");
   using thrust::system::detail::generic::select_system;
 
   System system;
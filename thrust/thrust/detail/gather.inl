@@ -42,7 +42,7 @@ _CCCL_HOST_DEVICE OutputIterator gather(
   RandomAccessIterator input_first,
   OutputIterator result)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::gather");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::gather");
   using thrust::system::detail::generic::gather;
   return gather(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), map_first, map_last, input_first, result);
@@ -62,7 +62,7 @@ _CCCL_HOST_DEVICE OutputIterator gather_if(
   RandomAccessIterator input_first,
   OutputIterator result)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::gather_if");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::gather_if");
   using thrust::system::detail::generic::gather_if;
   return gather_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), map_first, map_last, stencil, input_first, result);
@@ -84,7 +84,7 @@ _CCCL_HOST_DEVICE OutputIterator gather_if(
   OutputIterator result,
   Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::gather_if");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::gather_if");
   using thrust::system::detail::generic::gather_if;
   return gather_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -42,7 +42,8 @@ generate(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
          ForwardIterator last,
          Generator gen)
 {
-  _CCCL_NVTX_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<DerivedPolicy>(), "thrust::generate");
+  _THRUST_POLICY_RANGE_SCOPE_IF(
+    detail::should_enable_nvtx_for_policy<DerivedPolicy>(), DerivedPolicy, "thrust::generate");
   using thrust::system::detail::generic::generate;
   return generate(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, gen);
 } // end generate()
@@ -52,7 +53,8 @@ template <typename DerivedPolicy, typename OutputIterator, typename Size, typena
 _CCCL_HOST_DEVICE OutputIterator generate_n(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, OutputIterator first, Size n, Generator gen)
 {
-  _CCCL_NVTX_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<DerivedPolicy>(), "thrust::generate_n");
+  _THRUST_POLICY_RANGE_SCOPE_IF(
+    detail::should_enable_nvtx_for_policy<DerivedPolicy>(), DerivedPolicy, "thrust::generate_n");
   using thrust::system::detail::generic::generate_n;
   return generate_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, gen);
 } // end generate_n()
@@ -61,7 +63,7 @@ template <typename ForwardIterator, typename Generator>
 void generate(ForwardIterator first, ForwardIterator last, Generator gen)
 {
   using System = typename thrust::iterator_system<ForwardIterator>::type;
-  _CCCL_NVTX_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<System>(), "thrust::generate");
+  _THRUST_POLICY_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<System>(), System, "thrust::generate");
   using thrust::system::detail::generic::select_system;
 
   System system;
@@ -73,7 +75,7 @@ template <typename OutputIterator, typename Size, typename Generator>
 OutputIterator generate_n(OutputIterator first, Size n, Generator gen)
 {
   using System = typename thrust::iterator_system<OutputIterator>::type;
-  _CCCL_NVTX_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<System>(), "thrust::generate_n");
+  _THRUST_POLICY_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<System>(), System, "thrust::generate_n");
   using thrust::system::detail::generic::select_system;
 
   System system;
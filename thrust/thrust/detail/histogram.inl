@@ -0,0 +1,235 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/nvtx_policy.h>
+#include <thrust/histogram.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/internal/histogram_bins.h>
+
+#include <cuda/std/__utility/integer_sequence.h>
+#include <cuda/std/cstddef>
+
+// Include all active backend system implementations (generic, sequential, host and device)
+#include <thrust/system/detail/generic/histogram.h>
+#include <thrust/system/detail/sequential/histogram.h>
+#include __THRUST_HOST_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(histogram.h)
+#include __THRUST_DEVICE_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(histogram.h)
+
+// Some build systems need a hint to know which files we could include
+#if 0
+#  include <thrust/system/cpp/detail/histogram.h>
+#  include <thrust/system/cuda/detail/histogram.h>
+#  include <thrust/system/omp/detail/histogram.h>
+#  include <thrust/system/tbb/detail/histogram.h>
+#endif
+
+THRUST_NAMESPACE_BEGIN
+
+namespace detail
+{
+template <typename SampleT, ::cuda::std::size_t NumActiveChannels, typename LevelT, ::cuda::std::size_t... Channels>
+_CCCL_HOST_DEVICE ::cuda::std::array<system::detail::internal::even_bins<SampleT, LevelT>, NumActiveChannels>
+make_even_bins(const ::cuda::std::array<int, NumActiveChannels>& num_levels,
+               const ::cuda::std::array<LevelT, NumActiveChannels>& lower_level,
+               const ::cuda::std::array<LevelT, NumActiveChannels>& upper_level,
+               ::cuda::std::index_sequence<Channels...>)
+{
+  return {{system::detail::internal::even_bins<SampleT, LevelT>(
+    num_levels[Channels], lower_level[Channels], upper_level[Channels])...}};
+}
+
+template <::cuda::std::size_t NumActiveChannels, typename LevelIterator, ::cuda::std::size_t... Channels>
+_CCCL_HOST_DEVICE ::cuda::std::array<system::detail::internal::range_bins<LevelIterator>, NumActiveChannels>
+make_range_bins(const ::cuda::std::array<int, NumActiveChannels>& num_levels,
+                const ::cuda::std::array<LevelIterator, NumActiveChannels>& levels,
+                ::cuda::std::index_sequence<Channels...>)
+{
+  return {{system::detail::internal::range_bins<LevelIterator>(num_levels[Channels], levels[Channels])...}};
+}
+} // namespace detail
+
+_CCCL_EXEC_CHECK_DISABLE
+template <int NumChannels,
+          int NumActiveChannels,
+          typename DerivedPolicy,
+          typename InputIterator,
+          typename CounterIterator,
+          typename LevelT>
+_CCCL_HOST_DEVICE void multi_histogram_even(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  ::cuda::std::array<CounterIterator, NumActiveChannels> histograms,
+  ::cuda::std::array<int, NumActiveChannels> num_levels,
+  ::cuda::std::array<LevelT, NumActiveChannels> lower_level,
+  ::cuda::std::array<LevelT, NumActiveChannels> upper_level)
+{
+  static_assert(0 < NumActiveChannels && NumActiveChannels <= NumChannels,
+                "NumActiveChannels must be positive and at most NumChannels");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::multi_histogram_even");
+  using thrust::system::detail::generic::histogram;
+  histogram<NumChannels>(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    first,
+    last,
+    histograms,
+    thrust::detail::make_even_bins<thrust::detail::it_value_t<InputIterator>>(
+      num_levels, lower_level, upper_level, ::cuda::std::make_index_sequence<NumActiveChannels>{}));
+}
+
+template <int NumChannels, int NumActiveChannels, typename InputIterator, typename CounterIterator, typename LevelT>
+void multi_histogram_even(
+  InputIterator first,
+  InputIterator last,
+  ::cuda::std::array<CounterIterator, NumActiveChannels> histograms,
+  ::cuda::std::array<int, NumActiveChannels> num_levels,
+  ::cuda::std::array<LevelT, NumActiveChannels> lower_level,
+  ::cuda::std::array<LevelT, NumActiveChannels> upper_level)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::multi_histogram_even");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<InputIterator>::type;
+  using System2 = typename thrust::iterator_system<CounterIterator>::type;
+
+  System1 system1;
+  System2 system2;
+
+  thrust::multi_histogram_even<NumChannels, NumActiveChannels>(
+    select_system(system1, system2), first, last, histograms, num_levels, lower_level, upper_level);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <int NumChannels,
+          int NumActiveChannels,
+          typename DerivedPolicy,
+          typename InputIterator,
+          typename CounterIterator,
+          typename LevelIterator>
+_CCCL_HOST_DEVICE void multi_histogram_range(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  ::cuda::std::array<CounterIterator, NumActiveChannels> histograms,
+  ::cuda::std::array<int, NumActiveChannels> num_levels,
+  ::cuda::std::array<LevelIterator, NumActiveChannels> levels)
+{
+  static_assert(0 < NumActiveChannels && NumActiveChannels <= NumChannels,
+                "NumActiveChannels must be positive and at most NumChannels");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::multi_histogram_range");
+  using thrust::system::detail::generic::histogram;
+  histogram<NumChannels>(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    first,
+    last,
+    histograms,
+    thrust::detail::make_range_bins(num_levels, levels, ::cuda::std::make_index_sequence<NumActiveChannels>{}));
+}
+
+template <int NumChannels,
+          int NumActiveChannels,
+          typename InputIterator,
+          typename CounterIterator,
+          typename LevelIterator>
+void multi_histogram_range(
+  InputIterator first,
+  InputIterator last,
+  ::cuda::std::array<CounterIterator, NumActiveChannels> histograms,
+  ::cuda::std::array<int, NumActiveChannels> num_levels,
+  ::cuda::std::array<LevelIterator, NumActiveChannels> levels)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::multi_histogram_range");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<InputIterator>::type;
+  using System2 = typename thrust::iterator_system<CounterIterator>::type;
+
+  System1 system1;
+  System2 system2;
+
+  thrust::multi_histogram_range<NumChannels, NumActiveChannels>(
+    select_system(system1, system2), first, last, histograms, num_levels, levels);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename InputIterator, typename CounterIterator, typename LevelT>
+_CCCL_HOST_DEVICE void histogram_even(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  CounterIterator histogram,
+  int num_levels,
+  LevelT lower_level,
+  LevelT upper_level)
+{
+  thrust::multi_histogram_even<1, 1>(
+    exec,
+    first,
+    last,
+    ::cuda::std::array<CounterIterator, 1>{histogram},
+    ::cuda::std::array<int, 1>{num_levels},
+    ::cuda::std::array<LevelT, 1>{lower_level},
+    ::cuda::std::array<LevelT, 1>{upper_level});
+}
+
+template <typename InputIterator, typename CounterIterator, typename LevelT>
+void histogram_even(InputIterator first,
+                    InputIterator last,
+                    CounterIterator histogram,
+                    int num_levels,
+                    LevelT lower_level,
+                    LevelT upper_level)
+{
+  thrust::multi_histogram_even<1, 1>(
+    first,
+    last,
+    ::cuda::std::array<CounterIterator, 1>{histogram},
+    ::cuda::std::array<int, 1>{num_levels},
+    ::cuda::std::array<LevelT, 1>{lower_level},
+    ::cuda::std::array<LevelT, 1>{upper_level});
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename InputIterator, typename CounterIterator, typename LevelIterator>
+_CCCL_HOST_DEVICE void histogram_range(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  CounterIterator histogram,
+  int num_levels,
+  LevelIterator levels)
+{
+  thrust::multi_histogram_range<1, 1>(
+    exec,
+    first,
+    last,
+    ::cuda::std::array<CounterIterator, 1>{histogram},
+    ::cuda::std::array<int, 1>{num_levels},
+    ::cuda::std::array<LevelIterator, 1>{levels});
+}
+
+template <typename InputIterator, typename CounterIterator, typename LevelIterator>
+void histogram_range(
+  InputIterator first, InputIterator last, CounterIterator histogram, int num_levels, LevelIterator levels)
+{
+  thrust::multi_histogram_range<1, 1>(
+    first,
+    last,
+    ::cuda::std::array<CounterIterator, 1>{histogram},
+    ::cuda::std::array<int, 1>{num_levels},
+    ::cuda::std::array<LevelIterator, 1>{levels});
+}
+
+THRUST_NAMESPACE_END
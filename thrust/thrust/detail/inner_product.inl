@@ -41,7 +41,7 @@ _CCCL_HOST_DEVICE OutputType inner_product(
   InputIterator2 first2,
   OutputType init)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::inner_product");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::inner_product");
   using thrust::system::detail::generic::inner_product;
   return inner_product(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, init);
 } // end inner_product()
@@ -62,7 +62,7 @@ _CCCL_HOST_DEVICE OutputType inner_product(
   BinaryFunction1 binary_op1,
   BinaryFunction2 binary_op2)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::inner_product");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::inner_product");
   using thrust::system::detail::generic::inner_product;
   return inner_product(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
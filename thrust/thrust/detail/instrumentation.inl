@@ -0,0 +1,517 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/instrumentation.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#if _CCCL_OS(LINUX) && __has_include(<linux/perf_event.h>)
+#  define _THRUST_HAS_PERF_EVENT 1
+#  include <linux/perf_event.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#else
+#  define _THRUST_HAS_PERF_EVENT 0
+#endif
+
+THRUST_NAMESPACE_BEGIN
+
+namespace instrumentation
+{
+namespace detail
+{
+struct state
+{
+  std::atomic<bool> enabled{false};
+  std::atomic<bool> hardware_counters{false};
+};
+
+inline state& get_state()
+{
+  static state s;
+  return s;
+}
+
+inline constexpr int num_counters = 3;
+
+// The cycles, LLC misses and branch misses of the calling thread, read together as one perf_event group
+struct counter_group
+{
+  int fds[num_counters] = {-1, -1, -1};
+  bool opened           = false;
+
+  counter_group() = default;
+  counter_group(const counter_group&) = delete;
+  counter_group& operator=(const counter_group&) = delete;
+
+  ~counter_group()
+  {
+#if _THRUST_HAS_PERF_EVENT
+    for (int fd : fds)
+    {
+      if (fd != -1)
+      {
+        ::close(fd);
+      }
+    }
+#endif // _THRUST_HAS_PERF_EVENT
+  }
+
+  // Opens the group on first use, and returns whether it is available
+  bool open()
+  {
+#if _THRUST_HAS_PERF_EVENT
+    if (!opened)
+    {
+      opened = true;
+
+      constexpr ::cuda::std::uint64_t configs[num_counters] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+      for (int i = 0; i < num_counters; ++i)
+      {
+        perf_event_attr attr{};
+        attr.type           = PERF_TYPE_HARDWARE;
+        attr.size           = sizeof(attr);
+        attr.config         = configs[i];
+        attr.read_format    = PERF_FORMAT_GROUP;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+        fds[i] = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, i == 0 ? -1 : fds[0], 0));
+        if (fds[i] == -1)
+        {
+          close_all();
+          break;
+        }
+      }
+    }
+    return fds[0] != -1;
+#else // ^^^ _THRUST_HAS_PERF_EVENT ^^^ / vvv !_THRUST_HAS_PERF_EVENT vvv
+    return false;
+#endif // !_THRUST_HAS_PERF_EVENT
+  }
+
+  // Reads the counters of the group, which must be open, and returns whether they could be read
+  bool read(::cuda::std::uint64_t (&values)[num_counters]) const
+  {
+#if _THRUST_HAS_PERF_EVENT
+    // The format of PERF_FORMAT_GROUP: the number of counters, followed by their values
+    ::cuda::std::uint64_t buffer[1 + num_counters];
+    if (::read(fds[0], buffer, sizeof(buffer)) != static_cast<ssize_t>(sizeof(buffer)) || buffer[0] != num_counters)
+    {
+      return false;
+    }
+    std::copy(buffer + 1, buffer + 1 + num_counters, values);
+    return true;
+#else // ^^^ _THRUST_HAS_PERF_EVENT ^^^ / vvv !_THRUST_HAS_PERF_EVENT vvv
+    (void) values;
+    return false;
+#endif // !_THRUST_HAS_PERF_EVENT
+  }
+
+private:
+  void close_all()
+  {
+#if _THRUST_HAS_PERF_EVENT
+    for (int& fd : fds)
+    {
+      if (fd != -1)
+      {
+        ::close(fd);
+        fd = -1;
+      }
+    }
+#endif // _THRUST_HAS_PERF_EVENT
+  }
+};
+
+inline counter_group& get_counter_group()
+{
+  thread_local counter_group group;
+  return group;
+}
+
+// A call in progress on the calling thread
+struct active_call
+{
+  const char* name = nullptr;
+  std::chrono::steady_clock::time_point start;
+  ::cuda::std::uint64_t elements = 0;
+  ::cuda::std::uint64_t bytes    = 0;
+  int threads                    = 0;
+  bool has_counters              = false;
+  ::cuda::std::uint64_t counters[num_counters]{};
+};
+
+// The calls in progress on a thread form a stack, since the ranges are scopes. The calls nested deeper than the stack
+// are not recorded.
+struct call_stack
+{
+  static constexpr int max_depth = 32;
+
+  active_call calls[max_depth];
+  int depth = 0;
+
+  active_call* top()
+  {
+    return depth > 0 ? &calls[depth - 1] : nullptr;
+  }
+};
+
+inline call_stack& get_call_stack()
+{
+  thread_local call_stack stack;
+  return stack;
+}
+
+inline void* begin_call(const char* name)
+{
+  const state& s = get_state();
+  if (!s.enabled.load(std::memory_order_relaxed))
+  {
+    return nullptr;
+  }
+
+  // The overloads of an algorithm forward to each other, each in its own range: only the outermost one is a call
+  call_stack& stack   = get_call_stack();
+  active_call* parent = stack.top();
+  if ((parent && std::strcmp(parent->name, name) == 0) || stack.depth == call_stack::max_depth)
+  {
+    return nullptr;
+  }
+
+  active_call* call = &stack.calls[stack.depth++];
+  *call             = active_call{};
+  call->name        = name;
+
+  if (s.hardware_counters.load(std::memory_order_relaxed) && get_counter_group().open())
+  {
+    call->has_counters = get_counter_group().read(call->counters);
+  }
+  // Start the clock last, so that the time does not include reading the counters
+  call->start = std::chrono::steady_clock::now();
+  return call;
+}
+
+inline void end_call(void* token)
+{
+  const auto stop   = std::chrono::steady_clock::now();
+  active_call* call = static_cast<active_call*>(token);
+
+  algorithm_stats stats;
+  stats.calls         = 1;
+  stats.total_seconds = std::chrono::duration<double>(stop - call->start).count();
+  stats.min_seconds   = stats.total_seconds;
+  stats.max_seconds   = stats.total_seconds;
+  stats.elements      = call->elements;
+  stats.bytes         = call->bytes;
+  stats.max_threads   = call->threads;
+
+  ::cuda::std::uint64_t counters[num_counters];
+  if (call->has_counters && get_counter_group().read(counters))
+  {
+    stats.has_counters  = true;
+    stats.cycles        = counters[0] - call->counters[0];
+    stats.llc_misses    = counters[1] - call->counters[1];
+    stats.branch_misses = counters[2] - call->counters[2];
+  }
+
+  registry::get().record(call->name, stats);
+
+  // The work of a call is also the work of the algorithm calling it
+  call_stack& stack = get_call_stack();
+  --stack.depth;
+  if (active_call* parent = stack.top())
+  {
+    parent->elements = (std::max)(parent->elements, call->elements);
+    parent->bytes    = (std::max)(parent->bytes, call->bytes);
+    parent->threads  = (std::max)(parent->threads, call->threads);
+  }
+}
+
+// An algorithm may report its work several times, e.g. once for its size and once for the threads of its arena
+inline void report_work(::cuda::std::size_t elements, ::cuda::std::size_t bytes, int threads)
+{
+  if (active_call* call = get_call_stack().top())
+  {
+    call->elements = (std::max)(call->elements, static_cast<::cuda::std::uint64_t>(elements));
+    call->bytes    = (std::max)(call->bytes, static_cast<::cuda::std::uint64_t>(bytes));
+    call->threads  = (std::max)(call->threads, threads);
+  }
+}
+
+inline void append_json_string(std::string& out, const std::string& str)
+{
+  out += '"';
+  for (char c : str)
+  {
+    if (c == '"' || c == '\\')
+    {
+      out += '\\';
+      out += c;
+    }
+    else if (static_cast<unsigned char>(c) < 0x20)
+    {
+      char escaped[8];
+      std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+      out += escaped;
+    }
+    else
+    {
+      out += c;
+    }
+  }
+  out += '"';
+}
+
+inline std::string format_double(double value)
+{
+  char buffer[32];
+  std::snprintf(buffer, sizeof(buffer), "%.9g", value);
+  return buffer;
+}
+} // namespace detail
+
+inline registry& registry::get()
+{
+  static registry r;
+  return r;
+}
+
+inline std::vector<algorithm_stats> registry::snapshot() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::vector<algorithm_stats> result;
+  result.reserve(m_stats.size());
+  for (const auto& entry : m_stats)
+  {
+    result.push_back(entry.second);
+  }
+  return result;
+}
+
+inline bool registry::find(const std::string& name, algorithm_stats& stats) const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const auto it = m_stats.find(name);
+  if (it == m_stats.end())
+  {
+    return false;
+  }
+  stats = it->second;
+  return true;
+}
+
+inline void registry::reset()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_stats.clear();
+}
+
+inline void registry::record(const char* name, const algorithm_stats& call)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto [it, inserted] = m_stats.try_emplace(name);
+  algorithm_stats& stats = it->second;
+  if (inserted)
+  {
+    stats.name         = name;
+    stats.min_seconds  = call.min_seconds;
+    stats.has_counters = call.has_counters;
+  }
+  stats.calls += call.calls;
+  stats.total_seconds += call.total_seconds;
+  stats.min_seconds = (std::min)(stats.min_seconds, call.min_seconds);
+  stats.max_seconds = (std::max)(stats.max_seconds, call.max_seconds);
+  stats.elements += call.elements;
+  stats.bytes += call.bytes;
+  stats.max_threads  = (std::max)(stats.max_threads, call.max_threads);
+  stats.has_counters = stats.has_counters && call.has_counters;
+  stats.cycles += call.cycles;
+  stats.llc_misses += call.llc_misses;
+  stats.branch_misses += call.branch_misses;
+}
+
+inline std::string registry::to_json() const
+{
+  std::string out = "{\"algorithms\":[";
+  bool first      = true;
+  for (const algorithm_stats& stats : snapshot())
+  {
+    out += first ? "{" : ",{";
+    first = false;
+    out += "\"name\":";
+    detail::append_json_string(out, stats.name);
+    out += ",\"calls\":" + std::to_string(stats.calls);
+    out += ",\"total_seconds\":" + detail::format_double(stats.total_seconds);
+    out += ",\"min_seconds\":" + detail::format_double(stats.min_seconds);
+    out += ",\"max_seconds\":" + detail::format_double(stats.max_seconds);
+    out += ",\"elements\":" + std::to_string(stats.elements);
+    out += ",\"bytes\":" + std::to_string(stats.bytes);
+    out += ",\"max_threads\":" + std::to_string(stats.max_threads);
+    if (stats.has_counters)
+    {
+      out += ",\"cycles\":" + std::to_string(stats.cycles);
+      out += ",\"llc_misses\":" + std::to_string(stats.llc_misses);
+      out += ",\"branch_misses\":" + std::to_string(stats.branch_misses);
+    }
+    out += "}";
+  }
+  out += "]}";
+  return out;
+}
+
+inline std::string registry::to_prometheus(const std::string& prefix) const
+{
+  struct metric
+  {
+    const char* name;
+    const char* type;
+    const char* help;
+    bool counters_only;
+    std::string (*value)(const algorithm_stats&);
+  };
+
+  static constexpr metric metrics[] = {
+    {"calls_total",
+     "counter",
+     "Calls of the algorithm.",
+     false,
+     [](const algorithm_stats& s) {
+       return std::to_string(s.calls);
+     }},
+    {"seconds_total",
+     "counter",
+     "Wall time of the calls of the algorithm.",
+     false,
+     [](const algorithm_stats& s) {
+       return detail::format_double(s.total_seconds);
+     }},
+    {"seconds_min",
+     "gauge",
+     "Shortest wall time of a call of the algorithm.",
+     false,
+     [](const algorithm_stats& s) {
+       return detail::format_double(s.min_seconds);
+     }},
+    {"seconds_max",
+     "gauge",
+     "Longest wall time of a call of the algorithm.",
+     false,
+     [](const algorithm_stats& s) {
+       return detail::format_double(s.max_seconds);
+     }},
+    {"elements_total",
+     "counter",
+     "Elements processed by the algorithm.",
+     false,
+     [](const algorithm_stats& s) {
+       return std::to_string(s.elements);
+     }},
+    {"bytes_total",
+     "counter",
+     "Bytes of input and output accessed by the algorithm.",
+     false,
+     [](const algorithm_stats& s) {
+       return std::to_string(s.bytes);
+     }},
+    {"threads_max",
+     "gauge",
+     "Most threads used by a call of the algorithm.",
+     false,
+     [](const algorithm_stats& s) {
+       return std::to_string(s.max_threads);
+     }},
+    {"cycles_total",
+     "counter",
+     "CPU cycles of the threads calling the algorithm.",
+     true,
+     [](const algorithm_stats& s) {
+       return std::to_string(s.cycles);
+     }},
+    {"llc_misses_total",
+     "counter",
+     "Last-level cache misses of the threads calling the algorithm.",
+     true,
+     [](const algorithm_stats& s) {
+       return std::to_string(s.llc_misses);
+     }},
+    {"branch_misses_total",
+     "counter",
+     "Branch misses of the threads calling the algorithm.",
+     true,
+     [](const algorithm_stats& s) {
+       return std::to_string(s.branch_misses);
+     }},
+  };
+
+  const std::vector<algorithm_stats> all = snapshot();
+  std::string out;
+  for (const metric& m : metrics)
+  {
+    const std::string name = prefix + "_algorithm_" + m.name;
+    out += "# HELP " + name + " " + m.help + "\n";
+    out += "# TYPE " + name + " " + m.type + "\n";
+    for (const algorithm_stats& stats : all)
+    {
+      if (m.counters_only && !stats.has_counters)
+      {
+        continue;
+      }
+      // The label values are escaped like JSON strings
+      out += name + "{algorithm=";
+      detail::append_json_string(out, stats.name);
+      out += "} " + m.value(stats) + "\n";
+    }
+  }
+  return out;
+}
+
+inline void enable(bool hardware_counters)
+{
+  detail::state& s = detail::get_state();
+  s.hardware_counters.store(hardware_counters, std::memory_order_relaxed);
+
+  ::cuda::__host_range_hooks& hooks = ::cuda::__get_host_range_hooks();
+  hooks.__begin                     = detail::begin_call;
+  hooks.__end                       = detail::end_call;
+  hooks.__work                      = detail::report_work;
+  s.enabled.store(true, std::memory_order_release);
+}
+
+inline void disable()
+{
+  // The calls in progress still end: only the new calls are no longer recorded
+  detail::get_state().enabled.store(false, std::memory_order_release);
+}
+
+inline bool is_enabled()
+{
+  return detail::get_state().enabled.load(std::memory_order_acquire);
+}
+
+inline bool has_hardware_counters()
+{
+  return is_enabled() && detail::get_state().hardware_counters.load(std::memory_order_relaxed)
+      && detail::get_counter_group().open();
+}
+} // namespace instrumentation
+
+THRUST_NAMESPACE_END
+
+#undef _THRUST_HAS_PERF_EVENT
@@ -39,7 +39,7 @@ all_of(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
        InputIterator last,
        Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("all_of");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "all_of");
   using thrust::system::detail::generic::all_of;
   return all_of(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end all_of()
@@ -52,7 +52,7 @@ any_of(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
        InputIterator last,
        Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("any_of");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "any_of");
   using thrust::system::detail::generic::any_of;
   return any_of(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end any_of()
@@ -65,7 +65,7 @@ none_of(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
         InputIterator last,
         Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("none_of");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "none_of");
   using thrust::system::detail::generic::none_of;
   return none_of(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end none_of()
@@ -0,0 +1,224 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/mapped_vector.h>
+#include <thrust/system_error.h>
+
+#include <cuda/std/__utility/exchange.h>
+#include <cuda/std/cstdint>
+
+#include <cassert>
+#include <cerrno>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace detail
+{
+[[noreturn]] inline void throw_mapped_file_error(const std::string& what)
+{
+  throw thrust::system_error(errno, thrust::system_category(), what);
+}
+
+inline int to_madvise_advice(mapped_access access)
+{
+  switch (access)
+  {
+    case mapped_access::sequential:
+      return MADV_SEQUENTIAL;
+    case mapped_access::random:
+      return MADV_RANDOM;
+    case mapped_access::willneed:
+      return MADV_WILLNEED;
+    case mapped_access::dontneed:
+      return MADV_DONTNEED;
+    default:
+      return MADV_NORMAL;
+  }
+}
+} // namespace detail
+
+template <typename T>
+void mapped_span<T>::advise(mapped_access access) const
+{
+  if (m_size == 0)
+  {
+    return;
+  }
+
+  const auto page_size = static_cast<::cuda::std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+  auto first           = reinterpret_cast<::cuda::std::uintptr_t>(m_data);
+  auto last            = first + m_size * sizeof(T);
+
+  // madvise takes whole pages. Dropping a page loses the data of the elements outside the range which share it, so
+  // the range is shrunk to the pages within it, and it is only dropped if it can be read from the file again. The
+  // other hints do not change the data, so the range is extended to the pages it touches.
+  if (access == mapped_access::dontneed)
+  {
+    first = (first + page_size - 1) & ~(page_size - 1);
+    last  = last & ~(page_size - 1);
+    if (!m_discardable || first >= last)
+    {
+      return;
+    }
+  }
+  else
+  {
+    first = first & ~(page_size - 1);
+  }
+
+  // only a hint, so the errors are ignored
+  ::madvise(reinterpret_cast<void*>(first), last - first, detail::to_madvise_advice(access));
+} // end mapped_span::advise()
+
+template <typename T>
+mapped_vector<T>::mapped_vector(const std::string& path, map_mode mode)
+    : m_mode(mode)
+{
+  m_file = ::open(path.c_str(), (mode == map_mode::read_write ? O_RDWR : O_RDONLY) | O_CLOEXEC);
+  if (m_file < 0)
+  {
+    detail::throw_mapped_file_error("mapped_vector: cannot open " + path);
+  }
+
+  // the destructor is not run if the constructor throws, so the file is closed here
+  struct stat status;
+  if (::fstat(m_file, &status) != 0)
+  {
+    const int error = errno;
+    ::close(m_file);
+    errno = error;
+    detail::throw_mapped_file_error("mapped_vector: cannot stat " + path);
+  }
+  try
+  {
+    map(static_cast<size_type>(status.st_size) / sizeof(T));
+  }
+  catch (...)
+  {
+    ::close(m_file);
+    throw;
+  }
+} // end mapped_vector::mapped_vector()
+
+template <typename T>
+mapped_vector<T> mapped_vector<T>::create(const std::string& path, size_type n)
+{
+  mapped_vector result;
+  result.m_mode = map_mode::read_write;
+  result.m_file = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (result.m_file < 0)
+  {
+    detail::throw_mapped_file_error("mapped_vector: cannot create " + path);
+  }
+  result.resize(n);
+  return result;
+} // end mapped_vector::create()
+
+template <typename T>
+mapped_vector<T>::mapped_vector(mapped_vector&& other) noexcept
+    : m_file(::cuda::std::exchange(other.m_file, -1))
+    , m_mode(other.m_mode)
+    , m_data(::cuda::std::exchange(other.m_data, nullptr))
+    , m_size(::cuda::std::exchange(other.m_size, 0))
+{} // end mapped_vector::mapped_vector()
+
+template <typename T>
+mapped_vector<T>& mapped_vector<T>::operator=(mapped_vector&& other) noexcept
+{
+  if (this != &other)
+  {
+    unmap();
+    if (m_file >= 0)
+    {
+      ::close(m_file);
+    }
+    m_file = ::cuda::std::exchange(other.m_file, -1);
+    m_mode = other.m_mode;
+    m_data = ::cuda::std::exchange(other.m_data, nullptr);
+    m_size = ::cuda::std::exchange(other.m_size, 0);
+  }
+  return *this;
+} // end mapped_vector::operator=()
+
+template <typename T>
+mapped_vector<T>::~mapped_vector()
+{
+  unmap();
+  if (m_file >= 0)
+  {
+    ::close(m_file);
+  }
+} // end mapped_vector::~mapped_vector()
+
+template <typename T>
+void mapped_vector<T>::resize(size_type n)
+{
+  assert(m_mode == map_mode::read_write);
+
+  // the file is unmapped first, so that no page of the mapping lies past the end of a shrunk file
+  unmap();
+  if (::ftruncate(m_file, static_cast<off_t>(n * sizeof(T))) != 0)
+  {
+    detail::throw_mapped_file_error("mapped_vector: cannot resize the file");
+  }
+  map(n);
+} // end mapped_vector::resize()
+
+template <typename T>
+void mapped_vector<T>::flush()
+{
+  if (m_mode == map_mode::read_write && m_data != nullptr && ::msync(m_data, m_size * sizeof(T), MS_SYNC) != 0)
+  {
+    detail::throw_mapped_file_error("mapped_vector: cannot write the file");
+  }
+} // end mapped_vector::flush()
+
+template <typename T>
+void mapped_vector<T>::map(size_type n)
+{
+  // mmap rejects empty mappings, so an empty file maps to no elements
+  if (n == 0)
+  {
+    return;
+  }
+
+  const int protection = m_mode == map_mode::read_only ? PROT_READ : PROT_READ | PROT_WRITE;
+  const int flags      = m_mode == map_mode::read_write ? MAP_SHARED : MAP_PRIVATE;
+  void* p              = ::mmap(nullptr, n * sizeof(T), protection, flags, m_file, 0);
+  if (p == MAP_FAILED)
+  {
+    detail::throw_mapped_file_error("mapped_vector: cannot map the file");
+  }
+  m_data = static_cast<pointer>(p);
+  m_size = n;
+} // end mapped_vector::map()
+
+template <typename T>
+void mapped_vector<T>::unmap() noexcept
+{
+  if (m_data != nullptr)
+  {
+    ::munmap(m_data, m_size * sizeof(T));
+    m_data = nullptr;
+    m_size = 0;
+  }
+} // end mapped_vector::unmap()
+
+THRUST_NAMESPACE_END
@@ -43,7 +43,7 @@ _CCCL_HOST_DEVICE OutputIterator merge(
   InputIterator2 last2,
   OutputIterator result)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::merge");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::merge");
   using thrust::system::detail::generic::merge;
   return merge(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
 } // end merge()
@@ -63,7 +63,7 @@ _CCCL_HOST_DEVICE OutputIterator merge(
   OutputIterator result,
   StrictWeakCompare comp)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::merge");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::merge");
   using thrust::system::detail::generic::merge;
   return merge(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
@@ -88,7 +88,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> merge_by_k
   OutputIterator1 keys_result,
   OutputIterator2 values_result)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::merge_by_key");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::merge_by_key");
   using thrust::system::detail::generic::merge_by_key;
   return merge_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -123,7 +123,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> merge_by_k
   OutputIterator2 values_result,
   Compare comp)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::merge_by_key");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::merge_by_key");
   using thrust::system::detail::generic::merge_by_key;
   return merge_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
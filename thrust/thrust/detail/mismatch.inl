@@ -40,7 +40,7 @@ mismatch(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
          InputIterator1 last1,
          InputIterator2 first2)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::mismatch");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::mismatch");
   using thrust::system::detail::generic::mismatch;
   return mismatch(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2);
 } // end mismatch()
@@ -54,7 +54,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<InputIterator1, InputIterator2> mismatch(
   InputIterator2 first2,
   BinaryPredicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::mismatch");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::mismatch");
   using thrust::system::detail::generic::mismatch;
   return mismatch(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, pred);
 } // end mismatch()
@@ -100,7 +100,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<InputIterator1, InputIterator2> mismatch(
   InputIterator2 first2,
   InputIterator2 last2)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::mismatch");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::mismatch");
   using thrust::system::detail::generic::mismatch;
   return mismatch(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2);
 } // end mismatch()
@@ -115,7 +115,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<InputIterator1, InputIterator2> mismatch(
   InputIterator2 last2,
   BinaryPredicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::mismatch");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::mismatch");
   using thrust::system::detail::generic::mismatch;
   return mismatch(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, pred);
 } // end mismatch()
@@ -12,8 +12,13 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/iterator/iterator_traits.h>
+
+#include <cuda/__nvtx/nvtx.h>
 #include <cuda/std/__type_traits/decay.h>
 #include <cuda/std/__type_traits/is_base_of.h>
+#include <cuda/std/__type_traits/is_void.h>
+#include <cuda/std/cstddef>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -24,6 +29,12 @@ template <class>
 struct execution_policy;
 } // namespace system::detail::sequential
 
+namespace system::cpp::detail
+{
+template <class>
+struct execution_policy;
+} // namespace system::cpp::detail
+
 namespace detail
 {
 // Helper to determine if NVTX should be enabled for a given policy
@@ -36,6 +47,40 @@ inline constexpr bool should_enable_nvtx_for_policy()
   // This catches thrust::seq, cpp::tag, and any other sequential-based policy
   return !::cuda::std::is_base_of_v<thrust::system::detail::sequential::execution_policy<Policy>, Policy>;
 }
+
+// Whether the host range hooks record the calls of an algorithm with a given policy: all of them but the calls with
+// thrust::seq, which the parallel host systems make from their workers. The CPP, OMP and TBB policies derive from the
+// sequential one through the CPP one.
+template <typename DerivedPolicy>
+inline constexpr bool should_record_host_range_for_policy()
+{
+  using Policy = ::cuda::std::decay_t<DerivedPolicy>;
+  return ::cuda::std::is_base_of_v<thrust::system::cpp::detail::execution_policy<Policy>, Policy>
+      || !::cuda::std::is_base_of_v<thrust::system::detail::sequential::execution_policy<Policy>, Policy>;
+}
+
+// The bytes of n values of Iterator, which the host systems report with _CCCL_HOST_RANGE_WORK as the bytes accessed by
+// an algorithm. Iterators without values (e.g. output iterators) account for no bytes.
+template <typename Iterator, typename Size>
+_CCCL_HOST ::cuda::std::size_t host_range_bytes(Size n)
+{
+  using value_type = it_value_t<Iterator>;
+  if constexpr (::cuda::std::is_void_v<value_type>)
+  {
+    return 0;
+  }
+  else
+  {
+    return static_cast<::cuda::std::size_t>(n) * sizeof(value_type);
+  }
+}
 } // namespace detail
 
 THRUST_NAMESPACE_END
+
+// Inserts the range of an algorithm called with a policy of type Policy, like _CCCL_NVTX_RANGE_SCOPE_IF, except that
+// the host range hooks only record it for the policies selected by should_record_host_range_for_policy
+#define _THRUST_POLICY_RANGE_SCOPE_IF(condition, Policy, name) \
+  _CCCL_NVTX_HOST_RANGE_SCOPE_IF(                               \
+    condition, THRUST_NS_QUALIFIER::detail::should_record_host_range_for_policy<Policy>(), name)
+#define _THRUST_POLICY_RANGE_SCOPE(Policy, name) _THRUST_POLICY_RANGE_SCOPE_IF(true, Policy, name)
@@ -40,7 +40,7 @@ _CCCL_HOST_DEVICE ForwardIterator partition(
   ForwardIterator last,
   Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::partition");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::partition");
   using thrust::system::detail::generic::partition;
   return partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end partition()
@@ -54,7 +54,7 @@ _CCCL_HOST_DEVICE ForwardIterator partition(
   InputIterator stencil,
   Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::partition");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::partition");
   using thrust::system::detail::generic::partition;
   return partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, pred);
 } // end partition()
@@ -73,7 +73,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> partition_
   OutputIterator2 out_false,
   Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::partition_copy");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::partition_copy");
   using thrust::system::detail::generic::partition_copy;
   return partition_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, out_true, out_false, pred);
@@ -95,7 +95,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> partition_
   OutputIterator2 out_false,
   Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::partition_copy");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::partition_copy");
   using thrust::system::detail::generic::partition_copy;
   return partition_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, out_true, out_false, pred);
@@ -109,7 +109,7 @@ _CCCL_HOST_DEVICE ForwardIterator stable_partition(
   ForwardIterator last,
   Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::stable_partition");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::stable_partition");
   using thrust::system::detail::generic::stable_partition;
   return stable_partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end stable_partition()
@@ -123,7 +123,7 @@ _CCCL_HOST_DEVICE ForwardIterator stable_partition(
   InputIterator stencil,
   Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::stable_partition");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::stable_partition");
   using thrust::system::detail::generic::stable_partition;
   return stable_partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, pred);
 } // end stable_partition()
@@ -142,7 +142,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> stable_par
   OutputIterator2 out_false,
   Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::stable_partition_copy");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::stable_partition_copy");
   using thrust::system::detail::generic::stable_partition_copy;
   return stable_partition_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, out_true, out_false, pred);
@@ -164,12 +164,62 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> stable_par
   OutputIterator2 out_false,
   Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::stable_partition_copy");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::stable_partition_copy");
   using thrust::system::detail::generic::stable_partition_copy;
   return stable_partition_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, out_true, out_false, pred);
 } // end stable_partition_copy()
 
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator, typename Predicate1, typename Predicate2>
+_CCCL_HOST_DEVICE ::cuda::std::pair<RandomAccessIterator, RandomAccessIterator> three_way_partition(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  Predicate1 select_first_part,
+  Predicate2 select_second_part)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::three_way_partition");
+  using thrust::system::detail::generic::three_way_partition;
+  return three_way_partition(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    first,
+    last,
+    select_first_part,
+    select_second_part);
+} // end three_way_partition()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename OutputIterator3,
+          typename Predicate1,
+          typename Predicate2>
+_CCCL_HOST_DEVICE ::cuda::std::tuple<OutputIterator1, OutputIterator2, OutputIterator3> three_way_partition_copy(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator1 out_first_part,
+  OutputIterator2 out_second_part,
+  OutputIterator3 out_unselected,
+  Predicate1 select_first_part,
+  Predicate2 select_second_part)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::three_way_partition_copy");
+  using thrust::system::detail::generic::three_way_partition_copy;
+  return three_way_partition_copy(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    first,
+    last,
+    out_first_part,
+    out_second_part,
+    out_unselected,
+    select_first_part,
+    select_second_part);
+} // end three_way_partition_copy()
+
 _CCCL_EXEC_CHECK_DISABLE
 template <typename DerivedPolicy, typename ForwardIterator, typename Predicate>
 _CCCL_HOST_DEVICE ForwardIterator partition_point(
@@ -178,7 +228,7 @@ _CCCL_HOST_DEVICE ForwardIterator partition_point(
   ForwardIterator last,
   Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::partition_point");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::partition_point");
   using thrust::system::detail::generic::partition_point;
   return partition_point(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end partition_point()
@@ -191,7 +241,7 @@ _CCCL_HOST_DEVICE bool is_partitioned(
   InputIterator last,
   Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::is_partitioned");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::is_partitioned");
   using thrust::system::detail::generic::is_partitioned;
   return is_partitioned(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end is_partitioned()
@@ -348,6 +398,59 @@ template <typename InputIterator1,
     select_system(system1, system2, system3, system4), first, last, stencil, out_true, out_false, pred);
 } // end stable_partition_copy()
 
+template <typename RandomAccessIterator, typename Predicate1, typename Predicate2>
+::cuda::std::pair<RandomAccessIterator, RandomAccessIterator> three_way_partition(
+  RandomAccessIterator first, RandomAccessIterator last, Predicate1 select_first_part, Predicate2 select_second_part)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::three_way_partition");
+  using thrust::system::detail::generic::select_system;
+
+  using System = typename thrust::iterator_system<RandomAccessIterator>::type;
+
+  System system;
+
+  return thrust::three_way_partition(select_system(system), first, last, select_first_part, select_second_part);
+} // end three_way_partition()
+
+template <typename RandomAccessIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename OutputIterator3,
+          typename Predicate1,
+          typename Predicate2>
+::cuda::std::tuple<OutputIterator1, OutputIterator2, OutputIterator3> three_way_partition_copy(
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator1 out_first_part,
+  OutputIterator2 out_second_part,
+  OutputIterator3 out_unselected,
+  Predicate1 select_first_part,
+  Predicate2 select_second_part)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::three_way_partition_copy");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System2 = typename thrust::iterator_system<OutputIterator1>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator2>::type;
+  using System4 = typename thrust::iterator_system<OutputIterator3>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::three_way_partition_copy(
+    select_system(system1, system2, system3, system4),
+    first,
+    last,
+    out_first_part,
+    out_second_part,
+    out_unselected,
+    select_first_part,
+    select_second_part);
+} // end three_way_partition_copy()
+
 template <typename ForwardIterator, typename Predicate>
 ForwardIterator partition_point(ForwardIterator first, ForwardIterator last, Predicate pred)
 {
@@ -0,0 +1,239 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/nvtx_policy.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pipeline.h>
+#include <thrust/system/detail/generic/select_system.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__type_traits/decay.h>
+#include <cuda/std/cstddef>
+
+// Include all active backend system implementations (generic, sequential, host and device)
+#include <thrust/system/detail/generic/pipeline.h>
+#include <thrust/system/detail/sequential/pipeline.h>
+#include __THRUST_HOST_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(pipeline.h)
+#include __THRUST_DEVICE_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(pipeline.h)
+
+// Some build systems need a hint to know which files we could include
+#if 0
+#  include <thrust/system/cpp/detail/pipeline.h>
+#  include <thrust/system/cuda/detail/pipeline.h>
+#  include <thrust/system/omp/detail/pipeline.h>
+#  include <thrust/system/tbb/detail/pipeline.h>
+#endif
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+// the number of input elements of a tile, which keeps a tile and the buffers of its stages in the L1 and L2 caches
+template <typename T>
+constexpr ::cuda::std::size_t pipeline_tile_size()
+{
+  return ::cuda::std::max<::cuda::std::size_t>(256, (::cuda::std::size_t{1} << 15) / sizeof(T));
+}
+} // namespace detail
+
+template <typename... Stages>
+template <typename UnaryFunction>
+pipeline<Stages..., system::detail::internal::pipeline_map<UnaryFunction>>
+pipeline<Stages...>::map(UnaryFunction f) const
+{
+  using stage_type = system::detail::internal::pipeline_map<UnaryFunction>;
+  return pipeline<Stages..., stage_type>(::cuda::std::tuple_cat(m_stages, ::cuda::std::make_tuple(stage_type{f})));
+} // end pipeline::map()
+
+template <typename... Stages>
+template <typename Predicate>
+pipeline<Stages..., system::detail::internal::pipeline_filter<Predicate>>
+pipeline<Stages...>::filter(Predicate pred) const
+{
+  using stage_type = system::detail::internal::pipeline_filter<Predicate>;
+  return pipeline<Stages..., stage_type>(::cuda::std::tuple_cat(m_stages, ::cuda::std::make_tuple(stage_type{pred})));
+} // end pipeline::filter()
+
+template <typename... Stages>
+template <typename AssociativeOperator>
+pipeline<Stages..., system::detail::internal::pipeline_scan<AssociativeOperator>>
+pipeline<Stages...>::scan(AssociativeOperator op) const
+{
+  using stage_type = system::detail::internal::pipeline_scan<AssociativeOperator>;
+  return pipeline<Stages..., stage_type>(::cuda::std::tuple_cat(m_stages, ::cuda::std::make_tuple(stage_type{op})));
+} // end pipeline::scan()
+
+template <typename... Stages>
+template <typename DerivedPolicy, typename RandomAccessIterator, typename Terminal>
+auto pipeline<Stages...>::run(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                              RandomAccessIterator first,
+                              RandomAccessIterator last,
+                              const Terminal& terminal) const
+{
+  using pass_type = system::detail::internal::fused_pipeline<RandomAccessIterator, stages_type, Terminal>;
+
+  pass_type pass(first,
+                 static_cast<::cuda::std::size_t>(thrust::distance(first, last)),
+                 m_stages,
+                 terminal,
+                 thrust::detail::pipeline_tile_size<thrust::detail::it_value_t<RandomAccessIterator>>());
+
+  using thrust::system::detail::generic::run_pipeline;
+  run_pipeline(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), pass);
+  pass.rethrow_if_failed();
+  return pass.result();
+} // end pipeline::run()
+
+template <typename... Stages>
+template <typename DerivedPolicy, typename RandomAccessIterator, typename T, typename AssociativeOperator>
+T pipeline<Stages...>::reduce(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                              RandomAccessIterator first,
+                              RandomAccessIterator last,
+                              T init,
+                              AssociativeOperator op) const
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::pipeline::reduce");
+  using terminal_type = system::detail::internal::pipeline_reduce_terminal<T, AssociativeOperator>;
+  return run(exec, first, last, terminal_type{init, op});
+} // end pipeline::reduce()
+
+template <typename... Stages>
+template <typename RandomAccessIterator, typename T, typename AssociativeOperator>
+T pipeline<Stages...>::reduce(
+  RandomAccessIterator first, RandomAccessIterator last, T init, AssociativeOperator op) const
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System = typename thrust::iterator_system<RandomAccessIterator>::type;
+
+  System system;
+
+  return reduce(select_system(system), first, last, init, op);
+} // end pipeline::reduce()
+
+template <typename... Stages>
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator>
+OutputIterator pipeline<Stages...>::copy(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                                         RandomAccessIterator first,
+                                         RandomAccessIterator last,
+                                         OutputIterator result) const
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::pipeline::copy");
+  using terminal_type =
+    system::detail::internal::pipeline_copy_terminal<OutputIterator, result_type<RandomAccessIterator>>;
+  return run(exec, first, last, terminal_type{result});
+} // end pipeline::copy()
+
+template <typename... Stages>
+template <typename RandomAccessIterator, typename OutputIterator>
+OutputIterator
+pipeline<Stages...>::copy(RandomAccessIterator first, RandomAccessIterator last, OutputIterator result) const
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System2 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+
+  return copy(select_system(system1, system2), first, last, result);
+} // end pipeline::copy()
+
+template <typename... Stages>
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename KeysOutputIterator,
+          typename ValuesOutputIterator,
+          typename BinaryPredicate,
+          typename AssociativeOperator>
+thrust::pair<KeysOutputIterator, ValuesOutputIterator>
+pipeline<Stages...>::reduce_by_key(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                                   RandomAccessIterator first,
+                                   RandomAccessIterator last,
+                                   KeysOutputIterator keys_result,
+                                   ValuesOutputIterator values_result,
+                                   BinaryPredicate binary_pred,
+                                   AssociativeOperator op) const
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::pipeline::reduce_by_key");
+  using tuple_type    = result_type<RandomAccessIterator>;
+  using key_type      = ::cuda::std::decay_t<::cuda::std::tuple_element_t<0, tuple_type>>;
+  using value_type    = ::cuda::std::decay_t<::cuda::std::tuple_element_t<1, tuple_type>>;
+  using terminal_type = system::detail::internal::pipeline_reduce_by_key_terminal<
+    KeysOutputIterator,
+    ValuesOutputIterator,
+    key_type,
+    value_type,
+    BinaryPredicate,
+    AssociativeOperator>;
+  return run(exec, first, last, terminal_type{keys_result, values_result, binary_pred, op});
+} // end pipeline::reduce_by_key()
+
+template <typename... Stages>
+template <typename RandomAccessIterator,
+          typename KeysOutputIterator,
+          typename ValuesOutputIterator,
+          typename BinaryPredicate,
+          typename AssociativeOperator>
+thrust::pair<KeysOutputIterator, ValuesOutputIterator> pipeline<Stages...>::reduce_by_key(
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  KeysOutputIterator keys_result,
+  ValuesOutputIterator values_result,
+  BinaryPredicate binary_pred,
+  AssociativeOperator op) const
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System2 = typename thrust::iterator_system<KeysOutputIterator>::type;
+  using System3 = typename thrust::iterator_system<ValuesOutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return reduce_by_key(
+    select_system(system1, system2, system3), first, last, keys_result, values_result, binary_pred, op);
+} // end pipeline::reduce_by_key()
+
+template <typename... Stages>
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator>
+void pipeline<Stages...>::scatter(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                                  RandomAccessIterator first,
+                                  RandomAccessIterator last,
+                                  OutputIterator result) const
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::pipeline::scatter");
+  using terminal_type = system::detail::internal::pipeline_scatter_terminal<OutputIterator>;
+  run(exec, first, last, terminal_type{result});
+} // end pipeline::scatter()
+
+template <typename... Stages>
+template <typename RandomAccessIterator, typename OutputIterator>
+void pipeline<Stages...>::scatter(RandomAccessIterator first, RandomAccessIterator last, OutputIterator result) const
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System2 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+
+  scatter(select_system(system1, system2), first, last, result);
+} // end pipeline::scatter()
+
+THRUST_NAMESPACE_END
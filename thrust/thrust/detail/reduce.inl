@@ -47,7 +47,8 @@ template <typename DerivedPolicy, typename InputIterator>
 _CCCL_HOST_DEVICE detail::it_value_t<InputIterator>
 reduce(const thrust::detail::execution_policy_base<DerivedPolicy>& exec, InputIterator first, InputIterator last)
 {
-  _CCCL_NVTX_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<DerivedPolicy>(), "thrust::reduce");
+  _THRUST_POLICY_RANGE_SCOPE_IF(
+    detail::should_enable_nvtx_for_policy<DerivedPolicy>(), DerivedPolicy, "thrust::reduce");
   using thrust::system::detail::generic::reduce;
   return reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end reduce()
@@ -57,7 +58,7 @@ template <typename DerivedPolicy, typename InputIterator, typename T>
 _CCCL_HOST_DEVICE T reduce(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, InputIterator first, InputIterator last, T init)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::reduce");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::reduce");
   using thrust::system::detail::generic::reduce;
   return reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, init);
 } // end reduce()
@@ -71,7 +72,7 @@ _CCCL_HOST_DEVICE T reduce(
   T init,
   BinaryFunction binary_op)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::reduce");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::reduce");
   using thrust::system::detail::generic::reduce;
   return reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, init, binary_op);
 } // end reduce()
@@ -129,7 +130,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> reduce_by_
   OutputIterator1 keys_output,
   OutputIterator2 values_output)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::reduce_by_key");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::reduce_by_key");
   using thrust::system::detail::generic::reduce_by_key;
   return reduce_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -156,7 +157,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> reduce_by_
   OutputIterator2 values_output,
   BinaryPredicate binary_pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::reduce_by_key");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::reduce_by_key");
   using thrust::system::detail::generic::reduce_by_key;
   return reduce_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -186,7 +187,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> reduce_by_
   BinaryPredicate binary_pred,
   BinaryFunction binary_op)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::reduce_by_key");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::reduce_by_key");
   using thrust::system::detail::generic::reduce_by_key;
   return reduce_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -40,7 +40,7 @@ _CCCL_HOST_DEVICE ForwardIterator remove(
   ForwardIterator last,
   const T& value)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::remove");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::remove");
   using thrust::system::detail::generic::remove;
   return remove(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 } // end remove()
@@ -54,7 +54,7 @@ _CCCL_HOST_DEVICE OutputIterator remove_copy(
   OutputIterator result,
   const T& value)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::remove_copy");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::remove_copy");
   using thrust::system::detail::generic::remove_copy;
   return remove_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, value);
 } // end remove_copy()
@@ -67,7 +67,7 @@ _CCCL_HOST_DEVICE ForwardIterator remove_if(
   ForwardIterator last,
   Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::remove_if");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::remove_if");
   using thrust::system::detail::generic::remove_if;
   return remove_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end remove_if()
@@ -81,7 +81,7 @@ _CCCL_HOST_DEVICE OutputIterator remove_copy_if(
   OutputIterator result,
   Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::remove_copy_if");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::remove_copy_if");
   using thrust::system::detail::generic::remove_copy_if;
   return remove_copy_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, pred);
 } // end remove_copy_if()
@@ -95,7 +95,7 @@ _CCCL_HOST_DEVICE ForwardIterator remove_if(
   InputIterator stencil,
   Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::remove_if");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::remove_if");
   using thrust::system::detail::generic::remove_if;
   return remove_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, pred);
 } // end remove_if()
@@ -114,7 +114,7 @@ _CCCL_HOST_DEVICE OutputIterator remove_copy_if(
   OutputIterator result,
   Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::remove_copy_if");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::remove_copy_if");
   using thrust::system::detail::generic::remove_copy_if;
   return remove_copy_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, result, pred);
@@ -41,7 +41,7 @@ replace(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
         const T& old_value,
         const T& new_value)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::replace");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::replace");
   using thrust::system::detail::generic::replace;
   return replace(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, old_value, new_value);
 } // end replace()
@@ -55,7 +55,7 @@ _CCCL_HOST_DEVICE void replace_if(
   Predicate pred,
   const T& new_value)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::replace_if");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::replace_if");
   using thrust::system::detail::generic::replace_if;
   return replace_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred, new_value);
 } // end replace_if()
@@ -70,7 +70,7 @@ _CCCL_HOST_DEVICE void replace_if(
   Predicate pred,
   const T& new_value)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::replace_if");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::replace_if");
   using thrust::system::detail::generic::replace_if;
   return replace_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, pred, new_value);
@@ -86,7 +86,7 @@ _CCCL_HOST_DEVICE OutputIterator replace_copy(
   const T& old_value,
   const T& new_value)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::replace_copy");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::replace_copy");
   using thrust::system::detail::generic::replace_copy;
   return replace_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, old_value, new_value);
@@ -102,7 +102,7 @@ _CCCL_HOST_DEVICE OutputIterator replace_copy_if(
   Predicate pred,
   const T& new_value)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::replace_copy_if");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::replace_copy_if");
   using thrust::system::detail::generic::replace_copy_if;
   return replace_copy_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, pred, new_value);
@@ -124,7 +124,7 @@ _CCCL_HOST_DEVICE OutputIterator replace_copy_if(
   Predicate pred,
   const T& new_value)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::replace_copy_if");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::replace_copy_if");
   using thrust::system::detail::generic::replace_copy_if;
   return replace_copy_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, result, pred, new_value);
@@ -38,7 +38,7 @@ _CCCL_HOST_DEVICE void reverse(const thrust::detail::execution_policy_base<Deriv
                                BidirectionalIterator first,
                                BidirectionalIterator last)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::reverse");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::reverse");
   using thrust::system::detail::generic::reverse;
   return reverse(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end reverse()
@@ -51,7 +51,7 @@ _CCCL_HOST_DEVICE OutputIterator reverse_copy(
   BidirectionalIterator last,
   OutputIterator result)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::reverse_copy");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::reverse_copy");
   using thrust::system::detail::generic::reverse_copy;
   return reverse_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end reverse_copy()
@@ -0,0 +1,205 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/nvtx_policy.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/run_length_encode.h>
+#include <thrust/system/detail/generic/select_system.h>
+
+// Include all active backend system implementations (generic, sequential, host and device)
+#include <thrust/system/detail/generic/run_length_encode.h>
+#include <thrust/system/detail/sequential/run_length_encode.h>
+#include __THRUST_HOST_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(run_length_encode.h)
+#include __THRUST_DEVICE_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(run_length_encode.h)
+
+// Some build systems need a hint to know which files we could include
+#if 0
+#  include <thrust/system/cpp/detail/run_length_encode.h>
+#  include <thrust/system/cuda/detail/run_length_encode.h>
+#  include <thrust/system/omp/detail/run_length_encode.h>
+#  include <thrust/system/tbb/detail/run_length_encode.h>
+#endif
+
+THRUST_NAMESPACE_BEGIN
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator1, typename OutputIterator2>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 unique_output,
+  OutputIterator2 counts_output)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::run_length_encode");
+  using thrust::system::detail::generic::run_length_encode;
+  return run_length_encode(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, unique_output, counts_output);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 unique_output,
+  OutputIterator2 counts_output,
+  BinaryPredicate binary_pred)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::run_length_encode");
+  using thrust::system::detail::generic::run_length_encode;
+  return run_length_encode(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    first,
+    last,
+    unique_output,
+    counts_output,
+    binary_pred);
+}
+
+template <typename InputIterator, typename OutputIterator1, typename OutputIterator2>
+::cuda::std::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 unique_output,
+  OutputIterator2 counts_output)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::run_length_encode");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<InputIterator>::type;
+  using System2 = typename thrust::iterator_system<OutputIterator1>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::run_length_encode(select_system(system1, system2, system3), first, last, unique_output, counts_output);
+}
+
+template <typename InputIterator, typename OutputIterator1, typename OutputIterator2, typename BinaryPredicate>
+::cuda::std::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 unique_output,
+  OutputIterator2 counts_output,
+  BinaryPredicate binary_pred)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::run_length_encode");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<InputIterator>::type;
+  using System2 = typename thrust::iterator_system<OutputIterator1>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::run_length_encode(
+    select_system(system1, system2, system3), first, last, unique_output, counts_output, binary_pred);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator1, typename OutputIterator2>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> non_trivial_runs(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 offsets_output,
+  OutputIterator2 lengths_output)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::non_trivial_runs");
+  using thrust::system::detail::generic::non_trivial_runs;
+  return non_trivial_runs(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, offsets_output, lengths_output);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> non_trivial_runs(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 offsets_output,
+  OutputIterator2 lengths_output,
+  BinaryPredicate binary_pred)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::non_trivial_runs");
+  using thrust::system::detail::generic::non_trivial_runs;
+  return non_trivial_runs(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    first,
+    last,
+    offsets_output,
+    lengths_output,
+    binary_pred);
+}
+
+template <typename InputIterator, typename OutputIterator1, typename OutputIterator2>
+::cuda::std::pair<OutputIterator1, OutputIterator2> non_trivial_runs(
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 offsets_output,
+  OutputIterator2 lengths_output)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::non_trivial_runs");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<InputIterator>::type;
+  using System2 = typename thrust::iterator_system<OutputIterator1>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::non_trivial_runs(
+    select_system(system1, system2, system3), first, last, offsets_output, lengths_output);
+}
+
+template <typename InputIterator, typename OutputIterator1, typename OutputIterator2, typename BinaryPredicate>
+::cuda::std::pair<OutputIterator1, OutputIterator2> non_trivial_runs(
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 offsets_output,
+  OutputIterator2 lengths_output,
+  BinaryPredicate binary_pred)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::non_trivial_runs");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<InputIterator>::type;
+  using System2 = typename thrust::iterator_system<OutputIterator1>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::non_trivial_runs(
+    select_system(system1, system2, system3), first, last, offsets_output, lengths_output, binary_pred);
+}
+
+THRUST_NAMESPACE_END
@@ -48,7 +48,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan(
   InputIterator last,
   OutputIterator result)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::inclusive_scan");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::inclusive_scan");
   using thrust::system::detail::generic::inclusive_scan;
   return inclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end inclusive_scan()
@@ -62,7 +62,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan(
   OutputIterator result,
   AssociativeOperator binary_op)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::inclusive_scan");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::inclusive_scan");
   using thrust::system::detail::generic::inclusive_scan;
   return inclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, binary_op);
 } // end inclusive_scan()
@@ -77,7 +77,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan(
   T init,
   AssociativeOperator binary_op)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::inclusive_scan");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::inclusive_scan");
   using thrust::system::detail::generic::inclusive_scan;
   return inclusive_scan(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, init, binary_op);
@@ -91,7 +91,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan(
   InputIterator last,
   OutputIterator result)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::exclusive_scan");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::exclusive_scan");
   using thrust::system::detail::generic::exclusive_scan;
   return exclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end exclusive_scan()
@@ -105,7 +105,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan(
   OutputIterator result,
   T init)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::exclusive_scan");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::exclusive_scan");
   using thrust::system::detail::generic::exclusive_scan;
   return exclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, init);
 } // end exclusive_scan()
@@ -120,7 +120,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan(
   T init,
   AssociativeOperator binary_op)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::exclusive_scan");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::exclusive_scan");
   using thrust::system::detail::generic::exclusive_scan;
   return exclusive_scan(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, init, binary_op);
@@ -135,7 +135,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan_by_key(
   InputIterator2 first2,
   OutputIterator result)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::inclusive_scan_by_key");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::inclusive_scan_by_key");
   using thrust::system::detail::generic::inclusive_scan_by_key;
   return inclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result);
@@ -155,7 +155,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan_by_key(
   OutputIterator result,
   BinaryPredicate binary_pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::inclusive_scan_by_key");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::inclusive_scan_by_key");
   using thrust::system::detail::generic::inclusive_scan_by_key;
   return inclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, binary_pred);
@@ -177,7 +177,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan_by_key(
   BinaryPredicate binary_pred,
   AssociativeOperator binary_op)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::inclusive_scan_by_key");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::inclusive_scan_by_key");
   using thrust::system::detail::generic::inclusive_scan_by_key;
   return inclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -198,7 +198,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan_by_key(
   InputIterator2 first2,
   OutputIterator result)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::exclusive_scan_by_key");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::exclusive_scan_by_key");
   using thrust::system::detail::generic::exclusive_scan_by_key;
   return exclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result);
@@ -214,7 +214,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan_by_key(
   OutputIterator result,
   T init)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::exclusive_scan_by_key");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::exclusive_scan_by_key");
   using thrust::system::detail::generic::exclusive_scan_by_key;
   return exclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, init);
@@ -236,7 +236,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan_by_key(
   T init,
   BinaryPredicate binary_pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::exclusive_scan_by_key");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::exclusive_scan_by_key");
   using thrust::system::detail::generic::exclusive_scan_by_key;
   return exclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, init, binary_pred);
@@ -260,7 +260,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan_by_key(
   BinaryPredicate binary_pred,
   AssociativeOperator binary_op)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::exclusive_scan_by_key");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::exclusive_scan_by_key");
   using thrust::system::detail::generic::exclusive_scan_by_key;
   return exclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
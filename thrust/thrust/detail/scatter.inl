@@ -42,7 +42,7 @@ scatter(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
         InputIterator2 map,
         RandomAccessIterator output)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::scatter");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::scatter");
   using thrust::system::detail::generic::scatter;
   return scatter(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, map, output);
 } // end scatter()
@@ -61,7 +61,7 @@ _CCCL_HOST_DEVICE void scatter_if(
   InputIterator3 stencil,
   RandomAccessIterator output)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::scatter_if");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::scatter_if");
   using thrust::system::detail::generic::scatter_if;
   return scatter_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, map, stencil, output);
 } // end scatter_if()
@@ -82,7 +82,7 @@ _CCCL_HOST_DEVICE void scatter_if(
   RandomAccessIterator output,
   Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::scatter_if");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::scatter_if");
   using thrust::system::detail::generic::scatter_if;
   return scatter_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, map, stencil, output, pred);
@@ -0,0 +1,317 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/nvtx_policy.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/segmented_reduce.h>
+#include <thrust/system/detail/generic/select_system.h>
+
+// Include all active backend system implementations (generic, sequential, host and device)
+#include <thrust/system/detail/generic/segmented_reduce.h>
+#include <thrust/system/detail/sequential/segmented_reduce.h>
+#include __THRUST_HOST_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(segmented_reduce.h)
+#include __THRUST_DEVICE_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(segmented_reduce.h)
+
+// Some build systems need a hint to know which files we could include
+#if 0
+#  include <thrust/system/cpp/detail/segmented_reduce.h>
+#  include <thrust/system/cuda/detail/segmented_reduce.h>
+#  include <thrust/system/omp/detail/segmented_reduce.h>
+#  include <thrust/system/tbb/detail/segmented_reduce.h>
+#endif
+
+THRUST_NAMESPACE_BEGIN
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::segmented_reduce");
+  using thrust::system::detail::generic::segmented_reduce;
+  return segmented_reduce(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), offsets_first, offsets_last, first, result);
+} // end segmented_reduce()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename T>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  T init)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::segmented_reduce");
+  using thrust::system::detail::generic::segmented_reduce;
+  return segmented_reduce(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), offsets_first, offsets_last, first, result, init);
+} // end segmented_reduce()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::segmented_reduce");
+  using thrust::system::detail::generic::segmented_reduce;
+  return segmented_reduce(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    offsets_first,
+    offsets_last,
+    first,
+    result,
+    init,
+    binary_op);
+} // end segmented_reduce()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator segmented_arg_min(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::segmented_arg_min");
+  using thrust::system::detail::generic::segmented_arg_min;
+  return segmented_arg_min(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), offsets_first, offsets_last, first, result);
+} // end segmented_arg_min()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator segmented_arg_min(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::segmented_arg_min");
+  using thrust::system::detail::generic::segmented_arg_min;
+  return segmented_arg_min(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), offsets_first, offsets_last, first, result, comp);
+} // end segmented_arg_min()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator segmented_arg_max(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::segmented_arg_max");
+  using thrust::system::detail::generic::segmented_arg_max;
+  return segmented_arg_max(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), offsets_first, offsets_last, first, result);
+} // end segmented_arg_max()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator segmented_arg_max(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::segmented_arg_max");
+  using thrust::system::detail::generic::segmented_arg_max;
+  return segmented_arg_max(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), offsets_first, offsets_last, first, result, comp);
+} // end segmented_arg_max()
+
+template <typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator>
+OutputIterator segmented_reduce(
+  OffsetIterator offsets_first, OffsetIterator offsets_last, RandomAccessIterator first, OutputIterator result)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_reduce");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<OffsetIterator>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::segmented_reduce(select_system(system1, system2, system3), offsets_first, offsets_last, first, result);
+} // end segmented_reduce()
+
+template <typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator, typename T>
+OutputIterator segmented_reduce(
+  OffsetIterator offsets_first, OffsetIterator offsets_last, RandomAccessIterator first, OutputIterator result, T init)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_reduce");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<OffsetIterator>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::segmented_reduce(
+    select_system(system1, system2, system3), offsets_first, offsets_last, first, result, init);
+} // end segmented_reduce()
+
+template <typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+OutputIterator segmented_reduce(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_reduce");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<OffsetIterator>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::segmented_reduce(
+    select_system(system1, system2, system3), offsets_first, offsets_last, first, result, init, binary_op);
+} // end segmented_reduce()
+
+template <typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator>
+OutputIterator segmented_arg_min(
+  OffsetIterator offsets_first, OffsetIterator offsets_last, RandomAccessIterator first, OutputIterator result)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_arg_min");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<OffsetIterator>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::segmented_arg_min(
+    select_system(system1, system2, system3), offsets_first, offsets_last, first, result);
+} // end segmented_arg_min()
+
+template <typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator, typename StrictWeakOrdering>
+OutputIterator segmented_arg_min(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_arg_min");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<OffsetIterator>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::segmented_arg_min(
+    select_system(system1, system2, system3), offsets_first, offsets_last, first, result, comp);
+} // end segmented_arg_min()
+
+template <typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator>
+OutputIterator segmented_arg_max(
+  OffsetIterator offsets_first, OffsetIterator offsets_last, RandomAccessIterator first, OutputIterator result)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_arg_max");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<OffsetIterator>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::segmented_arg_max(
+    select_system(system1, system2, system3), offsets_first, offsets_last, first, result);
+} // end segmented_arg_max()
+
+template <typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator, typename StrictWeakOrdering>
+OutputIterator segmented_arg_max(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_arg_max");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<OffsetIterator>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::segmented_arg_max(
+    select_system(system1, system2, system3), offsets_first, offsets_last, first, result, comp);
+} // end segmented_arg_max()
+
+THRUST_NAMESPACE_END
@@ -0,0 +1,357 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/nvtx_policy.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/segmented_sort.h>
+#include <thrust/system/detail/generic/select_system.h>
+
+// Include all active backend system implementations (generic, sequential, host and device)
+#include <thrust/system/detail/generic/segmented_sort.h>
+#include <thrust/system/detail/sequential/segmented_sort.h>
+#include __THRUST_HOST_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(segmented_sort.h)
+#include __THRUST_DEVICE_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(segmented_sort.h)
+
+// Some build systems need a hint to know which files we could include
+#if 0
+#  include <thrust/system/cpp/detail/segmented_sort.h>
+#  include <thrust/system/cuda/detail/segmented_sort.h>
+#  include <thrust/system/omp/detail/segmented_sort.h>
+#  include <thrust/system/tbb/detail/segmented_sort.h>
+#endif
+
+THRUST_NAMESPACE_BEGIN
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename OffsetIterator, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void segmented_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator keys_first)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::segmented_sort");
+  using thrust::system::detail::generic::segmented_sort;
+  segmented_sort(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), offsets_first, offsets_last, keys_first);
+} // end segmented_sort()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename OffsetIterator, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator keys_first,
+  StrictWeakOrdering comp)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::segmented_sort");
+  using thrust::system::detail::generic::segmented_sort;
+  segmented_sort(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), offsets_first, offsets_last, keys_first, comp);
+} // end segmented_sort()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename OffsetIterator, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void segmented_stable_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator keys_first)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::segmented_stable_sort");
+  using thrust::system::detail::generic::segmented_stable_sort;
+  segmented_stable_sort(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), offsets_first, offsets_last, keys_first);
+} // end segmented_stable_sort()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename OffsetIterator, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_stable_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator keys_first,
+  StrictWeakOrdering comp)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::segmented_stable_sort");
+  using thrust::system::detail::generic::segmented_stable_sort;
+  segmented_stable_sort(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), offsets_first, offsets_last, keys_first, comp);
+} // end segmented_stable_sort()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2>
+_CCCL_HOST_DEVICE void segmented_sort_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::segmented_sort_by_key");
+  using thrust::system::detail::generic::segmented_sort_by_key;
+  segmented_sort_by_key(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    offsets_first,
+    offsets_last,
+    keys_first,
+    values_first);
+} // end segmented_sort_by_key()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::segmented_sort_by_key");
+  using thrust::system::detail::generic::segmented_sort_by_key;
+  segmented_sort_by_key(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    offsets_first,
+    offsets_last,
+    keys_first,
+    values_first,
+    comp);
+} // end segmented_sort_by_key()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2>
+_CCCL_HOST_DEVICE void segmented_stable_sort_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::segmented_stable_sort_by_key");
+  using thrust::system::detail::generic::segmented_stable_sort_by_key;
+  segmented_stable_sort_by_key(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    offsets_first,
+    offsets_last,
+    keys_first,
+    values_first);
+} // end segmented_stable_sort_by_key()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_stable_sort_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::segmented_stable_sort_by_key");
+  using thrust::system::detail::generic::segmented_stable_sort_by_key;
+  segmented_stable_sort_by_key(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    offsets_first,
+    offsets_last,
+    keys_first,
+    values_first,
+    comp);
+} // end segmented_stable_sort_by_key()
+
+template <typename OffsetIterator, typename RandomAccessIterator>
+void segmented_sort(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator keys_first)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_sort");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<OffsetIterator>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator>::type;
+
+  System1 system1;
+  System2 system2;
+
+  thrust::segmented_sort(select_system(system1, system2), offsets_first, offsets_last, keys_first);
+} // end segmented_sort()
+
+template <typename OffsetIterator, typename RandomAccessIterator, typename StrictWeakOrdering>
+void segmented_sort(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator keys_first,
+  StrictWeakOrdering comp)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_sort");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<OffsetIterator>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator>::type;
+
+  System1 system1;
+  System2 system2;
+
+  thrust::segmented_sort(select_system(system1, system2), offsets_first, offsets_last, keys_first, comp);
+} // end segmented_sort()
+
+template <typename OffsetIterator, typename RandomAccessIterator>
+void segmented_stable_sort(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator keys_first)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_stable_sort");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<OffsetIterator>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator>::type;
+
+  System1 system1;
+  System2 system2;
+
+  thrust::segmented_stable_sort(select_system(system1, system2), offsets_first, offsets_last, keys_first);
+} // end segmented_stable_sort()
+
+template <typename OffsetIterator, typename RandomAccessIterator, typename StrictWeakOrdering>
+void segmented_stable_sort(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator keys_first,
+  StrictWeakOrdering comp)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_stable_sort");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<OffsetIterator>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator>::type;
+
+  System1 system1;
+  System2 system2;
+
+  thrust::segmented_stable_sort(select_system(system1, system2), offsets_first, offsets_last, keys_first, comp);
+} // end segmented_stable_sort()
+
+template <typename OffsetIterator, typename RandomAccessIterator1, typename RandomAccessIterator2>
+void segmented_sort_by_key(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_sort_by_key");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<OffsetIterator>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System3 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  thrust::segmented_sort_by_key(
+    select_system(system1, system2, system3), offsets_first, offsets_last, keys_first, values_first);
+} // end segmented_sort_by_key()
+
+template <typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void segmented_sort_by_key(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_sort_by_key");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<OffsetIterator>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System3 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  thrust::segmented_sort_by_key(
+    select_system(system1, system2, system3), offsets_first, offsets_last, keys_first, values_first, comp);
+} // end segmented_sort_by_key()
+
+template <typename OffsetIterator, typename RandomAccessIterator1, typename RandomAccessIterator2>
+void segmented_stable_sort_by_key(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_stable_sort_by_key");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<OffsetIterator>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System3 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  thrust::segmented_stable_sort_by_key(
+    select_system(system1, system2, system3), offsets_first, offsets_last, keys_first, values_first);
+} // end segmented_stable_sort_by_key()
+
+template <typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void segmented_stable_sort_by_key(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_stable_sort_by_key");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<OffsetIterator>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System3 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  thrust::segmented_stable_sort_by_key(
+    select_system(system1, system2, system3), offsets_first, offsets_last, keys_first, values_first, comp);
+} // end segmented_stable_sort_by_key()
+
+THRUST_NAMESPACE_END
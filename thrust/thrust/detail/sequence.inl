@@ -37,7 +37,7 @@ template <typename DerivedPolicy, typename ForwardIterator>
 _CCCL_HOST_DEVICE void
 sequence(const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::sequence");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::sequence");
   using thrust::system::detail::generic::sequence;
   return sequence(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end sequence()
@@ -47,7 +47,7 @@ template <typename DerivedPolicy, typename ForwardIterator, typename T>
 _CCCL_HOST_DEVICE void sequence(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, T init)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::sequence");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::sequence");
   using thrust::system::detail::generic::sequence;
   return sequence(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, init);
 } // end sequence()
@@ -61,7 +61,7 @@ _CCCL_HOST_DEVICE void sequence(
   T init,
   T step)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::sequence");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::sequence");
   using thrust::system::detail::generic::sequence;
   return sequence(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, init, step);
 } // end sequence()
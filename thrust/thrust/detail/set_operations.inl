@@ -41,7 +41,7 @@ _CCCL_HOST_DEVICE OutputIterator set_difference(
   InputIterator2 last2,
   OutputIterator result)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::set_difference");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::set_difference");
   using thrust::system::detail::generic::set_difference;
   return set_difference(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
@@ -62,7 +62,7 @@ _CCCL_HOST_DEVICE OutputIterator set_difference(
   OutputIterator result,
   StrictWeakCompare comp)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::set_difference");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::set_difference");
   using thrust::system::detail::generic::set_difference;
   return set_difference(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
@@ -87,7 +87,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> set_differ
   OutputIterator1 keys_result,
   OutputIterator2 values_result)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::set_difference_by_key");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::set_difference_by_key");
   using thrust::system::detail::generic::set_difference_by_key;
   return set_difference_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -122,7 +122,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> set_differ
   OutputIterator2 values_result,
   StrictWeakCompare comp)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::set_difference_by_key");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::set_difference_by_key");
   using thrust::system::detail::generic::set_difference_by_key;
   return set_difference_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -147,7 +147,7 @@ _CCCL_HOST_DEVICE OutputIterator set_intersection(
   InputIterator2 last2,
   OutputIterator result)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::set_intersection");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::set_intersection");
   using thrust::system::detail::generic::set_intersection;
   return set_intersection(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
@@ -168,7 +168,7 @@ _CCCL_HOST_DEVICE OutputIterator set_intersection(
   OutputIterator result,
   StrictWeakCompare comp)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::set_intersection");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::set_intersection");
   using thrust::system::detail::generic::set_intersection;
   return set_intersection(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
@@ -191,7 +191,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> set_inters
   OutputIterator1 keys_result,
   OutputIterator2 values_result)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::set_intersection_by_key");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::set_intersection_by_key");
   using thrust::system::detail::generic::set_intersection_by_key;
   return set_intersection_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -223,7 +223,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> set_inters
   OutputIterator2 values_result,
   StrictWeakCompare comp)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::set_intersection_by_key");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::set_intersection_by_key");
   using thrust::system::detail::generic::set_intersection_by_key;
   return set_intersection_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -247,7 +247,7 @@ _CCCL_HOST_DEVICE OutputIterator set_symmetric_difference(
   InputIterator2 last2,
   OutputIterator result)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::set_symmetric_difference");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::set_symmetric_difference");
   using thrust::system::detail::generic::set_symmetric_difference;
   return set_symmetric_difference(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
@@ -268,7 +268,7 @@ _CCCL_HOST_DEVICE OutputIterator set_symmetric_difference(
   OutputIterator result,
   StrictWeakCompare comp)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::set_symmetric_difference");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::set_symmetric_difference");
   using thrust::system::detail::generic::set_symmetric_difference;
   return set_symmetric_difference(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
@@ -293,7 +293,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> set_symmet
   OutputIterator1 keys_result,
   OutputIterator2 values_result)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::set_symmetric_difference_by_key");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::set_symmetric_difference_by_key");
   using thrust::system::detail::generic::set_symmetric_difference_by_key;
   return set_symmetric_difference_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -328,7 +328,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> set_symmet
   OutputIterator2 values_result,
   StrictWeakCompare comp)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::set_symmetric_difference_by_key");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::set_symmetric_difference_by_key");
   using thrust::system::detail::generic::set_symmetric_difference_by_key;
   return set_symmetric_difference_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -353,7 +353,7 @@ _CCCL_HOST_DEVICE OutputIterator set_union(
   InputIterator2 last2,
   OutputIterator result)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::set_union");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::set_union");
   using thrust::system::detail::generic::set_union;
   return set_union(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
@@ -374,7 +374,7 @@ _CCCL_HOST_DEVICE OutputIterator set_union(
   OutputIterator result,
   StrictWeakCompare comp)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::set_union");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::set_union");
   using thrust::system::detail::generic::set_union;
   return set_union(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
@@ -399,7 +399,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> set_union_
   OutputIterator1 keys_result,
   OutputIterator2 values_result)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::set_union_by_key");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::set_union_by_key");
   using thrust::system::detail::generic::set_union_by_key;
   return set_union_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -434,7 +434,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> set_union_
   OutputIterator2 values_result,
   StrictWeakCompare comp)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::set_union_by_key");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::set_union_by_key");
   using thrust::system::detail::generic::set_union_by_key;
   return set_union_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
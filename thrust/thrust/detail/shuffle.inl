@@ -15,7 +15,19 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/shuffle.h>
 #include <thrust/system/detail/generic/select_system.h>
+
+// Include all active backend system implementations (generic, sequential, host and device)
 #include <thrust/system/detail/generic/shuffle.h>
+#include __THRUST_HOST_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(shuffle.h)
+#include __THRUST_DEVICE_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(shuffle.h)
+
+// Some build systems need a hint to know which files we could include
+#if 0
+#  include <thrust/system/cpp/detail/shuffle.h>
+#  include <thrust/system/cuda/detail/shuffle.h>
+#  include <thrust/system/omp/detail/shuffle.h>
+#  include <thrust/system/tbb/detail/shuffle.h>
+#endif
 
 THRUST_NAMESPACE_BEGIN
 
@@ -24,7 +36,7 @@ template <typename DerivedPolicy, typename RandomIterator, typename URBG>
 _CCCL_HOST_DEVICE void shuffle(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, URBG&& g)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::shuffle");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::shuffle");
   using thrust::system::detail::generic::shuffle;
   return shuffle(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, g);
 }
@@ -50,7 +62,7 @@ _CCCL_HOST_DEVICE void shuffle_copy(
   OutputIterator result,
   URBG&& g)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::shuffle_copy");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::shuffle_copy");
   using thrust::system::detail::generic::shuffle_copy;
   return shuffle_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, g);
 }
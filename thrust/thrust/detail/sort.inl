@@ -38,7 +38,7 @@ _CCCL_HOST_DEVICE void sort(const thrust::detail::execution_policy_base<DerivedP
                             RandomAccessIterator first,
                             RandomAccessIterator last)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::sort");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::sort");
   using thrust::system::detail::generic::sort;
   return sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end sort()
@@ -51,7 +51,7 @@ sort(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
      RandomAccessIterator last,
      StrictWeakOrdering comp)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::sort");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::sort");
   using thrust::system::detail::generic::sort;
   return sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end sort()
@@ -62,7 +62,7 @@ _CCCL_HOST_DEVICE void stable_sort(const thrust::detail::execution_policy_base<D
                                    RandomAccessIterator first,
                                    RandomAccessIterator last)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::stable_sort");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::stable_sort");
   using thrust::system::detail::generic::stable_sort;
   return stable_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end stable_sort()
@@ -75,7 +75,7 @@ _CCCL_HOST_DEVICE void stable_sort(
   RandomAccessIterator last,
   StrictWeakOrdering comp)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::stable_sort");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::stable_sort");
   using thrust::system::detail::generic::stable_sort;
   return stable_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end stable_sort()
@@ -88,7 +88,7 @@ _CCCL_HOST_DEVICE void sort_by_key(
   RandomAccessIterator1 keys_last,
   RandomAccessIterator2 values_first)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::sort_by_key");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::sort_by_key");
   using thrust::system::detail::generic::sort_by_key;
   return sort_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first);
@@ -106,7 +106,7 @@ _CCCL_HOST_DEVICE void sort_by_key(
   RandomAccessIterator2 values_first,
   StrictWeakOrdering comp)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::sort_by_key");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::sort_by_key");
   using thrust::system::detail::generic::sort_by_key;
   return sort_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, comp);
@@ -120,7 +120,7 @@ _CCCL_HOST_DEVICE void stable_sort_by_key(
   RandomAccessIterator1 keys_last,
   RandomAccessIterator2 values_first)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::stable_sort_by_key");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::stable_sort_by_key");
   using thrust::system::detail::generic::stable_sort_by_key;
   return stable_sort_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first);
@@ -138,7 +138,7 @@ _CCCL_HOST_DEVICE void stable_sort_by_key(
   RandomAccessIterator2 values_first,
   StrictWeakOrdering comp)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::stable_sort_by_key");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::stable_sort_by_key");
   using thrust::system::detail::generic::stable_sort_by_key;
   return stable_sort_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, comp);
@@ -149,7 +149,7 @@ template <typename DerivedPolicy, typename ForwardIterator>
 _CCCL_HOST_DEVICE bool
 is_sorted(const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::is_sorted");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::is_sorted");
   using thrust::system::detail::generic::is_sorted;
   return is_sorted(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end is_sorted()
@@ -162,7 +162,7 @@ is_sorted(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
           ForwardIterator last,
           Compare comp)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::is_sorted");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::is_sorted");
   using thrust::system::detail::generic::is_sorted;
   return is_sorted(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end is_sorted()
@@ -172,7 +172,7 @@ template <typename DerivedPolicy, typename ForwardIterator>
 _CCCL_HOST_DEVICE ForwardIterator is_sorted_until(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::is_sorted_until");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::is_sorted_until");
   using thrust::system::detail::generic::is_sorted_until;
   return is_sorted_until(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end is_sorted_until()
@@ -185,7 +185,7 @@ _CCCL_HOST_DEVICE ForwardIterator is_sorted_until(
   ForwardIterator last,
   Compare comp)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::is_sorted_until");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::is_sorted_until");
   using thrust::system::detail::generic::is_sorted_until;
   return is_sorted_until(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end is_sorted_until()
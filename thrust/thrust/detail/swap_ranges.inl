@@ -41,7 +41,7 @@ _CCCL_HOST_DEVICE ForwardIterator2 swap_ranges(
   ForwardIterator1 last1,
   ForwardIterator2 first2)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::swap_ranges");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::swap_ranges");
   using thrust::system::detail::generic::swap_ranges;
   return swap_ranges(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2);
 } // end swap_ranges()
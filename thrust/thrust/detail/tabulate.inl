@@ -40,7 +40,7 @@ tabulate(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
          ForwardIterator last,
          UnaryOperation unary_op)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::tabulate");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::tabulate");
   using thrust::system::detail::generic::tabulate;
   return tabulate(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, unary_op);
 } // end tabulate()
@@ -0,0 +1,490 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/nvtx_policy.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/select_system.h>
+#include <thrust/topk.h>
+
+// Include all active backend system implementations (generic, sequential, host and device)
+#include <thrust/system/detail/generic/topk.h>
+#include <thrust/system/detail/sequential/topk.h>
+#include __THRUST_HOST_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(topk.h)
+#include __THRUST_DEVICE_SYSTEM_ALGORITH_DETAIL_HEADER_INCLUDE(topk.h)
+
+// Some build systems need a hint to know which files we could include
+#if 0
+#  include <thrust/system/cpp/detail/topk.h>
+#  include <thrust/system/cuda/detail/topk.h>
+#  include <thrust/system/omp/detail/topk.h>
+#  include <thrust/system/tbb/detail/topk.h>
+#endif
+
+THRUST_NAMESPACE_BEGIN
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator, typename Size>
+_CCCL_HOST_DEVICE OutputIterator topk(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator result,
+  Size k)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::topk");
+  using thrust::system::detail::generic::topk;
+  return topk(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, k);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename Size,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator topk(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator result,
+  Size k,
+  StrictWeakOrdering comp)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::topk");
+  using thrust::system::detail::generic::topk;
+  return topk(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, k, comp);
+}
+
+template <typename RandomAccessIterator, typename OutputIterator, typename Size>
+OutputIterator topk(
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator result,
+  Size k)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::topk");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System2 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::topk(select_system(system1, system2), first, last, result, k);
+}
+
+template <typename RandomAccessIterator, typename OutputIterator, typename Size, typename StrictWeakOrdering>
+OutputIterator topk(
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator result,
+  Size k,
+  StrictWeakOrdering comp)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::topk");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System2 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::topk(select_system(system1, system2), first, last, result, k, comp);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> topk_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::topk_by_key");
+  using thrust::system::detail::generic::topk_by_key;
+  return topk_by_key(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    keys_first,
+    keys_last,
+    values_first,
+    keys_result,
+    values_result,
+    k);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> topk_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k,
+  StrictWeakOrdering comp)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::topk_by_key");
+  using thrust::system::detail::generic::topk_by_key;
+  return topk_by_key(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    keys_first,
+    keys_last,
+    values_first,
+    keys_result,
+    values_result,
+    k,
+    comp);
+}
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size>
+::cuda::std::pair<OutputIterator1, OutputIterator2> topk_by_key(
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::topk_by_key");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator1>::type;
+  using System4 = typename thrust::iterator_system<OutputIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::topk_by_key(
+    select_system(system1, system2, system3, system4),
+    keys_first,
+    keys_last,
+    values_first,
+    keys_result,
+    values_result,
+    k);
+}
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size,
+          typename StrictWeakOrdering>
+::cuda::std::pair<OutputIterator1, OutputIterator2> topk_by_key(
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k,
+  StrictWeakOrdering comp)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::topk_by_key");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator1>::type;
+  using System4 = typename thrust::iterator_system<OutputIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::topk_by_key(
+    select_system(system1, system2, system3, system4),
+    keys_first,
+    keys_last,
+    values_first,
+    keys_result,
+    values_result,
+    k,
+    comp);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename Size>
+_CCCL_HOST_DEVICE OutputIterator segmented_topk(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  Size k)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::segmented_topk");
+  using thrust::system::detail::generic::segmented_topk;
+  return segmented_topk(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), offsets_first, offsets_last, first, result, k);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename Size,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator segmented_topk(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  Size k,
+  StrictWeakOrdering comp)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::segmented_topk");
+  using thrust::system::detail::generic::segmented_topk;
+  return segmented_topk(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    offsets_first,
+    offsets_last,
+    first,
+    result,
+    k,
+    comp);
+}
+
+template <typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator, typename Size>
+OutputIterator segmented_topk(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  Size k)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_topk");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<OffsetIterator>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::segmented_topk(
+    select_system(system1, system2, system3), offsets_first, offsets_last, first, result, k);
+}
+
+template <typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename Size,
+          typename StrictWeakOrdering>
+OutputIterator segmented_topk(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  Size k,
+  StrictWeakOrdering comp)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_topk");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<OffsetIterator>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::segmented_topk(
+    select_system(system1, system2, system3), offsets_first, offsets_last, first, result, k, comp);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> segmented_topk_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::segmented_topk_by_key");
+  using thrust::system::detail::generic::segmented_topk_by_key;
+  return segmented_topk_by_key(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    offsets_first,
+    offsets_last,
+    keys_first,
+    values_first,
+    keys_result,
+    values_result,
+    k);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> segmented_topk_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k,
+  StrictWeakOrdering comp)
+{
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::segmented_topk_by_key");
+  using thrust::system::detail::generic::segmented_topk_by_key;
+  return segmented_topk_by_key(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    offsets_first,
+    offsets_last,
+    keys_first,
+    values_first,
+    keys_result,
+    values_result,
+    k,
+    comp);
+}
+
+template <typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size>
+::cuda::std::pair<OutputIterator1, OutputIterator2> segmented_topk_by_key(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_topk_by_key");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<OffsetIterator>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System3 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+  using System4 = typename thrust::iterator_system<OutputIterator1>::type;
+  using System5 = typename thrust::iterator_system<OutputIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+  System5 system5;
+
+  return thrust::segmented_topk_by_key(
+    select_system(system1, system2, system3, system4, system5),
+    offsets_first,
+    offsets_last,
+    keys_first,
+    values_first,
+    keys_result,
+    values_result,
+    k);
+}
+
+template <typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size,
+          typename StrictWeakOrdering>
+::cuda::std::pair<OutputIterator1, OutputIterator2> segmented_topk_by_key(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k,
+  StrictWeakOrdering comp)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::segmented_topk_by_key");
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<OffsetIterator>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System3 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+  using System4 = typename thrust::iterator_system<OutputIterator1>::type;
+  using System5 = typename thrust::iterator_system<OutputIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+  System5 system5;
+
+  return thrust::segmented_topk_by_key(
+    select_system(system1, system2, system3, system4, system5),
+    offsets_first,
+    offsets_last,
+    keys_first,
+    values_first,
+    keys_result,
+    values_result,
+    k,
+    comp);
+}
+
+THRUST_NAMESPACE_END
@@ -45,7 +45,7 @@ _CCCL_HOST_DEVICE OutputType transform_reduce(
   OutputType init,
   BinaryFunction binary_op)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::transform_reduce");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::transform_reduce");
   using thrust::system::detail::generic::transform_reduce;
   return transform_reduce(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, unary_op, init, binary_op);
@@ -47,7 +47,7 @@ _CCCL_HOST_DEVICE OutputIterator transform_inclusive_scan(
   UnaryFunction unary_op,
   AssociativeOperator binary_op)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::transform_inclusive_scan");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::transform_inclusive_scan");
   using thrust::system::detail::generic::transform_inclusive_scan;
   return transform_inclusive_scan(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, unary_op, binary_op);
@@ -69,7 +69,7 @@ _CCCL_HOST_DEVICE OutputIterator transform_inclusive_scan(
   T init,
   AssociativeOperator binary_op)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::transform_inclusive_scan");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::transform_inclusive_scan");
   using thrust::system::detail::generic::transform_inclusive_scan;
   return transform_inclusive_scan(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, unary_op, init, binary_op);
@@ -91,7 +91,7 @@ _CCCL_HOST_DEVICE OutputIterator transform_exclusive_scan(
   T init,
   AssociativeOperator binary_op)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::transform_exclusive_scan");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::transform_exclusive_scan");
   using thrust::system::detail::generic::transform_exclusive_scan;
   return transform_exclusive_scan(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, unary_op, init, binary_op);
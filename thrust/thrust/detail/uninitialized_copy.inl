@@ -41,7 +41,7 @@ _CCCL_HOST_DEVICE ForwardIterator uninitialized_copy(
   InputIterator last,
   ForwardIterator result)
 {
-  _CCCL_NVTX_RANGE_SCOPE("uninitialized_copy");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "uninitialized_copy");
   using thrust::system::detail::generic::uninitialized_copy;
   return uninitialized_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end uninitialized_copy()
@@ -51,7 +51,7 @@ template <typename DerivedPolicy, typename InputIterator, typename Size, typenam
 _CCCL_HOST_DEVICE ForwardIterator uninitialized_copy_n(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, InputIterator first, Size n, ForwardIterator result)
 {
-  _CCCL_NVTX_RANGE_SCOPE("uninitialized_copy_n");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "uninitialized_copy_n");
   using thrust::system::detail::generic::uninitialized_copy_n;
   return uninitialized_copy_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, result);
 } // end uninitialized_copy_n()
@@ -42,7 +42,8 @@ _CCCL_HOST_DEVICE void uninitialized_fill(
   ForwardIterator last,
   const T& x)
 {
-  _CCCL_NVTX_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<DerivedPolicy>(), "uninitialized_fill");
+  _THRUST_POLICY_RANGE_SCOPE_IF(
+    detail::should_enable_nvtx_for_policy<DerivedPolicy>(), DerivedPolicy, "uninitialized_fill");
   using thrust::system::detail::generic::uninitialized_fill;
   return uninitialized_fill(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, x);
 } // end uninitialized_fill()
@@ -52,7 +53,8 @@ template <typename DerivedPolicy, typename ForwardIterator, typename Size, typen
 _CCCL_HOST_DEVICE ForwardIterator uninitialized_fill_n(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, Size n, const T& x)
 {
-  _CCCL_NVTX_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<DerivedPolicy>(), "uninitialized_fill_n");
+  _THRUST_POLICY_RANGE_SCOPE_IF(
+    detail::should_enable_nvtx_for_policy<DerivedPolicy>(), DerivedPolicy, "uninitialized_fill_n");
   using thrust::system::detail::generic::uninitialized_fill_n;
   return uninitialized_fill_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, x);
 } // end uninitialized_fill_n()
@@ -61,7 +63,7 @@ template <typename ForwardIterator, typename T>
 void uninitialized_fill(ForwardIterator first, ForwardIterator last, const T& x)
 {
   using System = typename thrust::iterator_system<ForwardIterator>::type;
-  _CCCL_NVTX_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<System>(), "uninitialized_fill");
+  _THRUST_POLICY_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<System>(), System, "uninitialized_fill");
   using thrust::system::detail::generic::select_system;
 
   System system;
@@ -73,7 +75,7 @@ template <typename ForwardIterator, typename Size, typename T>
 ForwardIterator uninitialized_fill_n(ForwardIterator first, Size n, const T& x)
 {
   using System = typename thrust::iterator_system<ForwardIterator>::type;
-  _CCCL_NVTX_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<System>(), "uninitialized_fill_n");
+  _THRUST_POLICY_RANGE_SCOPE_IF(detail::should_enable_nvtx_for_policy<System>(), System, "uninitialized_fill_n");
   using thrust::system::detail::generic::select_system;
 
   System system;
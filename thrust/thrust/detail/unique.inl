@@ -46,7 +46,7 @@ template <typename DerivedPolicy, typename ForwardIterator>
 _CCCL_HOST_DEVICE ForwardIterator
 unique(const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
-  _CCCL_NVTX_RANGE_SCOPE("unique");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "unique");
   using thrust::system::detail::generic::unique;
   return unique(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end unique()
@@ -59,7 +59,7 @@ _CCCL_HOST_DEVICE ForwardIterator unique(
   ForwardIterator last,
   BinaryPredicate binary_pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("unique");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "unique");
   using thrust::system::detail::generic::unique;
   return unique(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, binary_pred);
 } // end unique()
@@ -72,7 +72,7 @@ _CCCL_HOST_DEVICE OutputIterator unique_copy(
   InputIterator last,
   OutputIterator output)
 {
-  _CCCL_NVTX_RANGE_SCOPE("unique_copy");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "unique_copy");
   using thrust::system::detail::generic::unique_copy;
   return unique_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, output);
 } // end unique_copy()
@@ -86,7 +86,7 @@ _CCCL_HOST_DEVICE OutputIterator unique_copy(
   OutputIterator output,
   BinaryPredicate binary_pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("unique_copy");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "unique_copy");
   using thrust::system::detail::generic::unique_copy;
   return unique_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, output, binary_pred);
 } // end unique_copy()
@@ -99,7 +99,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<ForwardIterator1, ForwardIterator2> unique_b
   ForwardIterator1 keys_last,
   ForwardIterator2 values_first)
 {
-  _CCCL_NVTX_RANGE_SCOPE("unique_by_key");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "unique_by_key");
   using thrust::system::detail::generic::unique_by_key;
   return unique_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first);
@@ -114,7 +114,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<ForwardIterator1, ForwardIterator2> unique_b
   ForwardIterator2 values_first,
   BinaryPredicate binary_pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("unique_by_key");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "unique_by_key");
   using thrust::system::detail::generic::unique_by_key;
   return unique_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, binary_pred);
@@ -134,7 +134,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> unique_by_
   OutputIterator1 keys_output,
   OutputIterator2 values_output)
 {
-  _CCCL_NVTX_RANGE_SCOPE("unique_by_key_copy");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "unique_by_key_copy");
   using thrust::system::detail::generic::unique_by_key_copy;
   return unique_by_key_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -161,7 +161,7 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> unique_by_
   OutputIterator2 values_output,
   BinaryPredicate binary_pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("unique_by_key_copy");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "unique_by_key_copy");
   using thrust::system::detail::generic::unique_by_key_copy;
   return unique_by_key_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -330,7 +330,7 @@ _CCCL_HOST_DEVICE thrust::detail::it_difference_t<ForwardIterator> unique_count(
   ForwardIterator last,
   BinaryPredicate binary_pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("unique_count");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "unique_count");
   using thrust::system::detail::generic::unique_count;
   return unique_count(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, binary_pred);
 } // end unique_count()
@@ -340,7 +340,7 @@ template <typename DerivedPolicy, typename ForwardIterator>
 _CCCL_HOST_DEVICE thrust::detail::it_difference_t<ForwardIterator> unique_count(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
-  _CCCL_NVTX_RANGE_SCOPE("unique_count");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "unique_count");
   using thrust::system::detail::generic::unique_count;
   return unique_count(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end unique_count()
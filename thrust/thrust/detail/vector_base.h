@@ -22,14 +22,17 @@
 #include <thrust/detail/type_traits.h>
 #include <thrust/iterator/detail/normal_iterator.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/type_traits/is_trivially_relocatable.h>
 
 #include <cuda/std/__iterator/iterator_traits.h>
 #include <cuda/std/__iterator/reverse_iterator.h>
 #include <cuda/std/__type_traits/enable_if.h>
 #include <cuda/std/__type_traits/is_swappable.h>
+#include <cuda/std/__type_traits/void_t.h>
 #include <cuda/std/__utility/move.h>
 #include <cuda/std/__utility/swap.h>
 #include <cuda/std/initializer_list>
+#include <cuda/std/ratio>
 
 #include <vector>
 
@@ -48,6 +51,20 @@ inline constexpr no_init_t no_init;
 
 namespace detail
 {
+// the factor by which a vector multiplies its capacity when it runs out of room: 2, unless the allocator declares a
+// nested growth_factor, which is a ::cuda::std::ratio
+template <typename Alloc, typename = void>
+struct vector_growth_factor
+{
+  using type = ::cuda::std::ratio<2>;
+};
+
+template <typename Alloc>
+struct vector_growth_factor<Alloc, ::cuda::std::void_t<typename Alloc::growth_factor>>
+{
+  using type = typename Alloc::growth_factor;
+};
+
 template <typename T, typename Alloc>
 class vector_base
 {
@@ -547,6 +564,17 @@ private:
   // this method performs assignment from a fill value
   void fill_assign(size_type n, const T& x);
 
+  // this method computes the capacity to allocate for required_size elements when the vector runs out of room
+  size_type recommended_capacity(size_type required_size) const;
+
+  // whether the storage can grow in place, or move without copying the elements, with the allocator's reallocate
+  static constexpr bool can_reallocate_storage =
+    thrust::is_trivially_relocatable_v<T> && allocator_has_reallocate<Alloc>;
+
+  // this method resizes the storage with the allocator's reallocate, if can_reallocate_storage; it returns false,
+  // leaving the storage as it was, otherwise
+  bool reallocate_storage(size_type new_capacity);
+
   // this method allocates new storage and construct copies the given range
   template <typename ForwardIterator>
   void
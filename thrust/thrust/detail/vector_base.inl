@@ -22,7 +22,6 @@
 #include <thrust/fill.h>
 #include <thrust/iterator/iterator_traits.h>
 
-#include <cuda/std/__algorithm/clamp.h>
 #include <cuda/std/__algorithm/max.h>
 #include <cuda/std/__algorithm/min.h>
 #include <cuda/std/__functional/operations.h>
@@ -388,6 +387,12 @@ void vector_base<T, Alloc>::reserve(size_type n)
     // do not exceed maximum storage
     new_capacity = ::cuda::std::min<size_type>(new_capacity, max_size());
 
+    // grow the storage without copying the elements, if possible
+    if (reallocate_storage(new_capacity))
+    {
+      return;
+    } // end if
+
     // create new storage
     storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
 
@@ -753,15 +758,8 @@ void vector_base<T, Alloc>::copy_insert(iterator position, ForwardIterator first
     {
       const size_type old_size = size();
 
-      // compute the new capacity after the allocation
-      size_type new_capacity =
-        old_size + ::cuda::std::max THRUST_PREVENT_MACRO_SUBSTITUTION(old_size, num_new_elements);
-
       // allocate exponentially larger new storage
-      new_capacity = ::cuda::std::max<size_type>(new_capacity, 2 * capacity());
-
-      // do not exceed maximum storage
-      new_capacity = ::cuda::std::min<size_type>(new_capacity, max_size());
+      const size_type new_capacity = recommended_capacity(old_size + num_new_elements);
 
       if (new_capacity > max_size())
       {
@@ -812,9 +810,9 @@ void vector_base<T, Alloc>::append(size_type n)
 {
   if (n != 0)
   {
-    if (capacity() - size() >= n)
+    if (capacity() - size() >= n || reallocate_storage(recommended_capacity(size() + n)))
     {
-      // we've got room for all of them
+      // we've got room for all of them, possibly after growing the storage
 
       if constexpr (!SkipInit)
       {
@@ -829,14 +827,8 @@ void vector_base<T, Alloc>::append(size_type n)
     {
       const size_type old_size = size();
 
-      // compute the new capacity after the allocation
-      size_type new_capacity = old_size + ::cuda::std::max THRUST_PREVENT_MACRO_SUBSTITUTION(old_size, n);
-
       // allocate exponentially larger new storage
-      new_capacity = ::cuda::std::max<size_type>(new_capacity, 2 * capacity());
-
-      // do not exceed maximum storage
-      new_capacity = ::cuda::std::min<size_type>(new_capacity, max_size());
+      const size_type new_capacity = recommended_capacity(old_size + n);
 
       // create new storage
       storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
@@ -885,6 +877,21 @@ void vector_base<T, Alloc>::fill_insert(iterator position, size_type n, const T&
     return;
   }
 
+  if constexpr (can_reallocate_storage)
+  {
+    if (n > static_cast<size_type>(capacity() - m_size))
+    {
+      // x may be an element of this vector, which growing the storage may move
+      const T value          = x;
+      const size_type offset = position - begin();
+      if (reallocate_storage(recommended_capacity(m_size + n)))
+      {
+        fill_insert(begin() + offset, n, value);
+        return;
+      } // end if
+    } // end if
+  } // end if
+
   if (n <= static_cast<size_type>(capacity() - m_size))
   {
     // we've got room for all of them
@@ -930,8 +937,7 @@ void vector_base<T, Alloc>::fill_insert(iterator position, size_type n, const T&
     const size_type old_size = size();
 
     // Ensure allocation grows exponentially within bounds
-    const size_type new_capacity =
-      ::cuda::std::clamp<size_type>(old_size + n, static_cast<size_type>(2 * capacity()), max_size());
+    const size_type new_capacity = recommended_capacity(old_size + n);
 
     storage_type new_storage(copy_allocator_t(), m_storage, new_capacity);
 
@@ -1076,6 +1082,33 @@ void vector_base<T, Alloc>::fill_assign(size_type n, const T& x)
   } // end else
 } // end vector_base::fill_assign()
 
+template <typename T, typename Alloc>
+typename vector_base<T, Alloc>::size_type vector_base<T, Alloc>::recommended_capacity(size_type required_size) const
+{
+  using growth_factor = typename vector_growth_factor<Alloc>::type;
+  static_assert(growth_factor::num > growth_factor::den, "the growth factor of a vector must be greater than 1");
+
+  // multiply the capacity by the growth factor, rounding down
+  const size_type grown_capacity = capacity() / growth_factor::den * growth_factor::num
+                                 + capacity() % growth_factor::den * growth_factor::num / growth_factor::den;
+
+  // do not exceed maximum storage
+  return ::cuda::std::min<size_type>(::cuda::std::max<size_type>(required_size, grown_capacity), max_size());
+} // end vector_base::recommended_capacity()
+
+template <typename T, typename Alloc>
+bool vector_base<T, Alloc>::reallocate_storage([[maybe_unused]] size_type new_capacity)
+{
+  if constexpr (can_reallocate_storage)
+  {
+    return m_storage.reallocate(new_capacity);
+  } // end if
+  else
+  {
+    return false;
+  } // end else
+} // end vector_base::reallocate_storage()
+
 template <typename T, typename Alloc>
 template <typename ForwardIterator>
 void vector_base<T, Alloc>::allocate_and_copy(
@@ -1088,10 +1121,7 @@ void vector_base<T, Alloc>::allocate_and_copy(
   } // end if
 
   // allocate exponentially larger new storage
-  size_type allocated_size = ::cuda::std::max<size_type>(requested_size, 2 * capacity());
-
-  // do not exceed maximum storage
-  allocated_size = ::cuda::std::min<size_type>(allocated_size, max_size());
+  const size_type allocated_size = recommended_capacity(requested_size);
 
   if (requested_size > allocated_size)
   {
@@ -0,0 +1,376 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file histogram.h
+ *  \brief Counts the samples of a range that fall into each of a set of bins
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/execution_policy.h>
+
+#include <cuda/std/array>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup reductions
+ *  \{
+ *  \addtogroup histograms
+ *  \ingroup reductions
+ *  \{
+ */
+
+/*! \p histogram_even counts the samples of <tt>[first, last)</tt> that fall into each of <tt>num_levels - 1</tt> bins
+ *  of equal width, which evenly split <tt>[lower_level, upper_level)</tt>. The count of the <tt>i</tt>th bin is
+ *  written to <tt>histogram[i]</tt>. Samples outside of <tt>[lower_level, upper_level)</tt> are not counted.
+ *
+ *  Samples are mapped to bins like \p cub::DeviceHistogram::HistogramEven does: they are compared and scaled in the
+ *  common type of the sample and level types, integral samples are scaled exactly and floating-point samples with
+ *  the reciprocal of the bin width. Both therefore produce the same histogram for the same input.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the samples.
+ *  \param last The end of the samples.
+ *  \param histogram The beginning of the <tt>num_levels - 1</tt> counters.
+ *  \param num_levels The number of bin boundaries, which is one more than the number of bins.
+ *  \param lower_level The lower bound, inclusive, of the first bin.
+ *  \param upper_level The upper bound, exclusive, of the last bin.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>.
+ *  \tparam CounterIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a> whose \c value_type is an integral type.
+ *  \tparam LevelT is an arithmetic type.
+ *
+ *  The following code snippet demonstrates how to use \p histogram_even to count values in four bins of width 2 using
+ *  the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/execution_policy.h>
+ *  float samples[] = {2.2f, 6.0f, 7.1f, 2.9f, 3.5f, 0.3f, 2.9f, 2.1f, 6.1f, 999.5f};
+ *  int histogram[4];
+ *  thrust::histogram_even(thrust::host, samples, samples + 10, histogram, 5, 0.0f, 8.0f);
+ *  // histogram is now {1, 5, 0, 3}
+ *  \endcode
+ *
+ *  \see https://nvidia.github.io/cccl/cub/api/structcub_1_1DeviceHistogram.html
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy, typename InputIterator, typename CounterIterator, typename LevelT>
+_CCCL_HOST_DEVICE void histogram_even(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  CounterIterator histogram,
+  int num_levels,
+  LevelT lower_level,
+  LevelT upper_level);
+
+/*! \p histogram_even counts the samples of <tt>[first, last)</tt> that fall into each of <tt>num_levels - 1</tt> bins
+ *  of equal width, which evenly split <tt>[lower_level, upper_level)</tt>. The count of the <tt>i</tt>th bin is
+ *  written to <tt>histogram[i]</tt>. Samples outside of <tt>[lower_level, upper_level)</tt> are not counted.
+ *
+ *  \param first The beginning of the samples.
+ *  \param last The end of the samples.
+ *  \param histogram The beginning of the <tt>num_levels - 1</tt> counters.
+ *  \param num_levels The number of bin boundaries, which is one more than the number of bins.
+ *  \param lower_level The lower bound, inclusive, of the first bin.
+ *  \param upper_level The upper bound, exclusive, of the last bin.
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>.
+ *  \tparam CounterIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a> whose \c value_type is an integral type.
+ *  \tparam LevelT is an arithmetic type.
+ *
+ *  \see https://nvidia.github.io/cccl/cub/api/structcub_1_1DeviceHistogram.html
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename InputIterator, typename CounterIterator, typename LevelT>
+void histogram_even(InputIterator first,
+                    InputIterator last,
+                    CounterIterator histogram,
+                    int num_levels,
+                    LevelT lower_level,
+                    LevelT upper_level);
+
+/*! \p histogram_range counts the samples of <tt>[first, last)</tt> that fall into each of the <tt>num_levels - 1</tt>
+ *  bins <tt>[levels[i], levels[i + 1])</tt>. The count of the <tt>i</tt>th bin is written to <tt>histogram[i]</tt>.
+ *  Samples outside of <tt>[levels[0], levels[num_levels - 1])</tt> are not counted.
+ *
+ *  Samples are converted to the value type of \p levels and mapped to bins with a binary search, like
+ *  \p cub::DeviceHistogram::HistogramRange does.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the samples.
+ *  \param last The end of the samples.
+ *  \param histogram The beginning of the <tt>num_levels - 1</tt> counters.
+ *  \param num_levels The number of bin boundaries, which is one more than the number of bins.
+ *  \param levels The beginning of the \p num_levels bin boundaries, in ascending order.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>.
+ *  \tparam CounterIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a> whose \c value_type is an integral type.
+ *  \tparam LevelIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>.
+ *
+ *  The following code snippet demonstrates how to use \p histogram_range to count values in four bins of different
+ *  widths using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/execution_policy.h>
+ *  float samples[] = {2.2f, 6.0f, 7.1f, 2.9f, 3.5f, 0.3f, 2.9f, 2.1f, 6.1f, 999.5f};
+ *  float levels[]  = {0.0f, 2.0f, 4.0f, 6.0f, 8.0f};
+ *  int histogram[4];
+ *  thrust::histogram_range(thrust::host, samples, samples + 10, histogram, 5, levels);
+ *  // histogram is now {1, 5, 0, 3}
+ *  \endcode
+ *
+ *  \see https://nvidia.github.io/cccl/cub/api/structcub_1_1DeviceHistogram.html
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy, typename InputIterator, typename CounterIterator, typename LevelIterator>
+_CCCL_HOST_DEVICE void histogram_range(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  CounterIterator histogram,
+  int num_levels,
+  LevelIterator levels);
+
+/*! \p histogram_range counts the samples of <tt>[first, last)</tt> that fall into each of the <tt>num_levels - 1</tt>
+ *  bins <tt>[levels[i], levels[i + 1])</tt>. The count of the <tt>i</tt>th bin is written to <tt>histogram[i]</tt>.
+ *  Samples outside of <tt>[levels[0], levels[num_levels - 1])</tt> are not counted.
+ *
+ *  \param first The beginning of the samples.
+ *  \param last The end of the samples.
+ *  \param histogram The beginning of the <tt>num_levels - 1</tt> counters.
+ *  \param num_levels The number of bin boundaries, which is one more than the number of bins.
+ *  \param levels The beginning of the \p num_levels bin boundaries, in ascending order.
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>.
+ *  \tparam CounterIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a> whose \c value_type is an integral type.
+ *  \tparam LevelIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>.
+ *
+ *  \see https://nvidia.github.io/cccl/cub/api/structcub_1_1DeviceHistogram.html
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename InputIterator, typename CounterIterator, typename LevelIterator>
+void histogram_range(
+  InputIterator first, InputIterator last, CounterIterator histogram, int num_levels, LevelIterator levels);
+
+/*! \p multi_histogram_even computes a \p histogram_even of each of the first \p NumActiveChannels channels of pixels
+ *  whose \p NumChannels samples are interleaved in <tt>[first, last)</tt>, such as the RGBA pixels of an image. The
+ *  <tt>c</tt>th channel of the <tt>p</tt>th pixel is <tt>first[p * NumChannels + c]</tt>, and a trailing incomplete
+ *  pixel is ignored. The histogram of channel <tt>c</tt> has <tt>num_levels[c] - 1</tt> bins, which evenly split
+ *  <tt>[lower_level[c], upper_level[c])</tt>, and is written to <tt>histograms[c]</tt>.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the interleaved samples.
+ *  \param last The end of the interleaved samples.
+ *  \param histograms The beginning of the counters of each active channel.
+ *  \param num_levels The number of bin boundaries of each active channel.
+ *  \param lower_level The lower bound, inclusive, of the first bin of each active channel.
+ *  \param upper_level The upper bound, exclusive, of the last bin of each active channel.
+ *
+ *  \tparam NumChannels The number of interleaved samples per pixel.
+ *  \tparam NumActiveChannels The number of leading channels to compute histograms of.
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>.
+ *  \tparam CounterIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a> whose \c value_type is an integral type.
+ *  \tparam LevelT is an arithmetic type.
+ *
+ *  The following code snippet demonstrates how to use \p multi_histogram_even to count the red, green and blue values
+ *  of RGBA pixels in four bins each:
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/execution_policy.h>
+ *  unsigned char pixels[] = {2, 6, 7, 5,   3, 0, 2, 6,   1, 255, 0, 0,   70, 2, 3, 0};
+ *  int red[4], green[4], blue[4];
+ *  thrust::multi_histogram_even<4, 3>(
+ *    thrust::host, pixels, pixels + 16, cuda::std::array{red, green, blue},
+ *    cuda::std::array{5, 5, 5}, cuda::std::array{0, 0, 0}, cuda::std::array{256, 256, 256});
+ *  // red is now {3, 1, 0, 0}, green is {3, 0, 0, 1} and blue is {4, 0, 0, 0}
+ *  \endcode
+ *
+ *  \see histogram_even
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <int NumChannels,
+          int NumActiveChannels,
+          typename DerivedPolicy,
+          typename InputIterator,
+          typename CounterIterator,
+          typename LevelT>
+_CCCL_HOST_DEVICE void multi_histogram_even(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  ::cuda::std::array<CounterIterator, NumActiveChannels> histograms,
+  ::cuda::std::array<int, NumActiveChannels> num_levels,
+  ::cuda::std::array<LevelT, NumActiveChannels> lower_level,
+  ::cuda::std::array<LevelT, NumActiveChannels> upper_level);
+
+/*! \p multi_histogram_even computes a \p histogram_even of each of the first \p NumActiveChannels channels of pixels
+ *  whose \p NumChannels samples are interleaved in <tt>[first, last)</tt>.
+ *
+ *  \param first The beginning of the interleaved samples.
+ *  \param last The end of the interleaved samples.
+ *  \param histograms The beginning of the counters of each active channel.
+ *  \param num_levels The number of bin boundaries of each active channel.
+ *  \param lower_level The lower bound, inclusive, of the first bin of each active channel.
+ *  \param upper_level The upper bound, exclusive, of the last bin of each active channel.
+ *
+ *  \tparam NumChannels The number of interleaved samples per pixel.
+ *  \tparam NumActiveChannels The number of leading channels to compute histograms of.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>.
+ *  \tparam CounterIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a> whose \c value_type is an integral type.
+ *  \tparam LevelT is an arithmetic type.
+ *
+ *  \see histogram_even
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <int NumChannels, int NumActiveChannels, typename InputIterator, typename CounterIterator, typename LevelT>
+void multi_histogram_even(
+  InputIterator first,
+  InputIterator last,
+  ::cuda::std::array<CounterIterator, NumActiveChannels> histograms,
+  ::cuda::std::array<int, NumActiveChannels> num_levels,
+  ::cuda::std::array<LevelT, NumActiveChannels> lower_level,
+  ::cuda::std::array<LevelT, NumActiveChannels> upper_level);
+
+/*! \p multi_histogram_range computes a \p histogram_range of each of the first \p NumActiveChannels channels of
+ *  pixels whose \p NumChannels samples are interleaved in <tt>[first, last)</tt>. The <tt>c</tt>th channel of the
+ *  <tt>p</tt>th pixel is <tt>first[p * NumChannels + c]</tt>, and a trailing incomplete pixel is ignored. The
+ *  histogram of channel <tt>c</tt> has the <tt>num_levels[c] - 1</tt> bins delimited by <tt>levels[c]</tt>, and is
+ *  written to <tt>histograms[c]</tt>.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the interleaved samples.
+ *  \param last The end of the interleaved samples.
+ *  \param histograms The beginning of the counters of each active channel.
+ *  \param num_levels The number of bin boundaries of each active channel.
+ *  \param levels The beginning of the bin boundaries, in ascending order, of each active channel.
+ *
+ *  \tparam NumChannels The number of interleaved samples per pixel.
+ *  \tparam NumActiveChannels The number of leading channels to compute histograms of.
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>.
+ *  \tparam CounterIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a> whose \c value_type is an integral type.
+ *  \tparam LevelIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>.
+ *
+ *  \see histogram_range
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <int NumChannels,
+          int NumActiveChannels,
+          typename DerivedPolicy,
+          typename InputIterator,
+          typename CounterIterator,
+          typename LevelIterator>
+_CCCL_HOST_DEVICE void multi_histogram_range(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  ::cuda::std::array<CounterIterator, NumActiveChannels> histograms,
+  ::cuda::std::array<int, NumActiveChannels> num_levels,
+  ::cuda::std::array<LevelIterator, NumActiveChannels> levels);
+
+/*! \p multi_histogram_range computes a \p histogram_range of each of the first \p NumActiveChannels channels of
+ *  pixels whose \p NumChannels samples are interleaved in <tt>[first, last)</tt>.
+ *
+ *  \param first The beginning of the interleaved samples.
+ *  \param last The end of the interleaved samples.
+ *  \param histograms The beginning of the counters of each active channel.
+ *  \param num_levels The number of bin boundaries of each active channel.
+ *  \param levels The beginning of the bin boundaries, in ascending order, of each active channel.
+ *
+ *  \tparam NumChannels The number of interleaved samples per pixel.
+ *  \tparam NumActiveChannels The number of leading channels to compute histograms of.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>.
+ *  \tparam CounterIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a> whose \c value_type is an integral type.
+ *  \tparam LevelIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>.
+ *
+ *  \see histogram_range
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <int NumChannels,
+          int NumActiveChannels,
+          typename InputIterator,
+          typename CounterIterator,
+          typename LevelIterator>
+void multi_histogram_range(
+  InputIterator first,
+  InputIterator last,
+  ::cuda::std::array<CounterIterator, NumActiveChannels> histograms,
+  ::cuda::std::array<int, NumActiveChannels> num_levels,
+  ::cuda::std::array<LevelIterator, NumActiveChannels> levels);
+
+/*! \} // end histograms
+ *  \} // end reductions
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/histogram.inl>
@@ -0,0 +1,179 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file instrumentation.h
+ *  \brief Per-algorithm timing and hardware counters of the Thrust algorithms running on the host
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__nvtx/host_range.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup instrumentation Instrumentation
+ *  \{
+ */
+
+/*! \p thrust::instrumentation records every call of a Thrust algorithm on the host, through the same scopes that emit
+ *  the NVTX ranges of the algorithms, and aggregates them per algorithm in a registry which can be queried at runtime,
+ *  or dumped as JSON or in the Prometheus text format.
+ *
+ *  The scopes only call into the instrumentation in translation units compiled with \c CCCL_HOST_INSTRUMENTATION
+ *  defined, and otherwise cost nothing. Recording starts with \p enable:
+ *
+ *  \code
+ *  #define CCCL_HOST_INSTRUMENTATION
+ *  #include <thrust/instrumentation.h>
+ *  #include <thrust/reduce.h>
+ *  #include <thrust/system/omp/execution_policy.h>
+ *  ...
+ *  thrust::instrumentation::enable(true);
+ *  int sum = thrust::reduce(thrust::omp::par, data.begin(), data.end());
+ *  ...
+ *  std::cout << thrust::instrumentation::registry::get().to_prometheus();
+ *  \endcode
+ *
+ *  For each call, the registry records the wall time, and the elements processed, the bytes accessed and the threads
+ *  used, as reported by the parallel primitives of the OpenMP and TBB systems. The bytes are those of the input and
+ *  output ranges, without temporary storage, and are zero for algorithms which do not report them. With hardware
+ *  counters, the CPU cycles, last-level cache misses and branch misses of the calling thread during the call are
+ *  recorded too, through \c perf_event_open on Linux. They do not include the work of the other threads of the
+ *  algorithm, and are unavailable where \c perf_event_open is, e.g. without permission to profile user space.
+ *
+ *  A call of an algorithm from another algorithm is recorded under both. \p enable and \p disable must not be called
+ *  concurrently with an algorithm.
+ */
+namespace instrumentation
+{
+
+/*! The aggregated calls of one algorithm.
+ */
+struct algorithm_stats
+{
+  /*! The name of the algorithm, e.g. \c "thrust::reduce".
+   */
+  std::string name;
+  /*! The number of calls.
+   */
+  ::cuda::std::uint64_t calls = 0;
+  /*! The total, smallest and largest wall time of a call, in seconds.
+   */
+  double total_seconds = 0.0;
+  double min_seconds   = 0.0;
+  double max_seconds   = 0.0;
+  /*! The total elements processed and bytes accessed by all calls.
+   */
+  ::cuda::std::uint64_t elements = 0;
+  ::cuda::std::uint64_t bytes    = 0;
+  /*! The most threads used by a call.
+   */
+  int max_threads = 0;
+  /*! Whether the hardware counters were recorded for all calls.
+   */
+  bool has_counters = false;
+  /*! The total CPU cycles, last-level cache misses and branch misses of the calling threads, when \p has_counters.
+   */
+  ::cuda::std::uint64_t cycles        = 0;
+  ::cuda::std::uint64_t llc_misses    = 0;
+  ::cuda::std::uint64_t branch_misses = 0;
+
+  /*! The mean wall time of a call, in seconds.
+   */
+  double mean_seconds() const
+  {
+    return calls ? total_seconds / static_cast<double>(calls) : 0.0;
+  }
+
+  /*! The bytes accessed per second of wall time.
+   */
+  double bytes_per_second() const
+  {
+    return total_seconds > 0.0 ? static_cast<double>(bytes) / total_seconds : 0.0;
+  }
+};
+
+/*! The process-wide registry of the recorded algorithms.
+ */
+class registry
+{
+public:
+  /*! Returns the registry of the process.
+   */
+  static registry& get();
+
+  /*! Returns the statistics of all the recorded algorithms, ordered by name.
+   */
+  std::vector<algorithm_stats> snapshot() const;
+
+  /*! Returns whether \p name was recorded, and if so copies its statistics to \p stats.
+   */
+  bool find(const std::string& name, algorithm_stats& stats) const;
+
+  /*! Forgets all the recorded calls.
+   */
+  void reset();
+
+  /*! Returns the statistics as a JSON object, with an \c "algorithms" array of one object per algorithm.
+   */
+  std::string to_json() const;
+
+  /*! Returns the statistics in the Prometheus text exposition format, as metrics named \p prefix followed by
+   *  \c "_algorithm_", labeled with the name of the algorithm.
+   */
+  std::string to_prometheus(const std::string& prefix = "thrust") const;
+
+  /*! Records a call of \p name. This is called by the instrumentation when a call ends.
+   */
+  void record(const char* name, const algorithm_stats& call);
+
+private:
+  registry() = default;
+
+  mutable std::mutex m_mutex;
+  std::map<std::string, algorithm_stats> m_stats;
+};
+
+/*! Starts recording the calls of the algorithms, with the hardware counters if \p hardware_counters is \c true and they
+ *  are available.
+ */
+void enable(bool hardware_counters = false);
+
+/*! Stops recording the calls of the algorithms. The registry keeps the calls recorded so far.
+ */
+void disable();
+
+/*! Returns whether the calls of the algorithms are being recorded.
+ */
+bool is_enabled();
+
+/*! Returns whether the hardware counters are recorded, which requires them to be enabled and \c perf_event_open to
+ *  succeed on the calling thread.
+ */
+bool has_hardware_counters();
+
+} // namespace instrumentation
+
+/*! \} // instrumentation
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/instrumentation.inl>
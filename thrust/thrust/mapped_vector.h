@@ -0,0 +1,383 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file mapped_vector.h
+ *  \brief A vector of elements backed by a memory-mapped file
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if !_CCCL_OS(WINDOWS)
+
+#  include <cuda/std/__type_traits/enable_if.h>
+#  include <cuda/std/__type_traits/is_convertible.h>
+#  include <cuda/std/__type_traits/is_trivially_copyable.h>
+#  include <cuda/std/__type_traits/remove_cv.h>
+#  include <cuda/std/cstddef>
+
+#  include <string>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup containers Containers
+ *  \{
+ */
+
+/*! The ways a file is mapped by \p mapped_vector.
+ */
+enum class map_mode
+{
+  /*! The file is mapped read-only. Writing to the elements is undefined behavior.
+   */
+  read_only,
+  /*! The file is mapped privately: the elements can be written, but the writes are not carried through to the file,
+   *      and only the pages written to are copied.
+   */
+  copy_on_write,
+  /*! The file is mapped shared: the writes to the elements are carried through to the file.
+   */
+  read_write
+};
+
+/*! Hints on how a range of a memory-mapped file is going to be accessed, which are passed to \c madvise.
+ */
+enum class mapped_access
+{
+  /*! No particular access pattern, with the default read-ahead of the kernel.
+   */
+  normal,
+  /*! The range is read sequentially: the kernel reads ahead aggressively, and drops the pages soon after they are read.
+   */
+  sequential,
+  /*! The range is read in no particular order: the kernel does not read ahead.
+   */
+  random,
+  /*! The range is going to be read soon: the kernel starts reading it from the file in the background.
+   */
+  willneed,
+  /*! The range is not going to be read soon: the kernel may drop the pages which lie entirely within it, which are
+   *      read from the file again when they are accessed. The hint is ignored for a file mapped with
+   *      \p map_mode::copy_on_write, and for memory which is not mapped by a \p mapped_vector, whose dropped pages
+   *      would lose their contents.
+   */
+  dontneed
+};
+
+/*! A \p mapped_span is a view of a contiguous range of elements of a memory-mapped file, which does not own them.
+ *
+ *  It exposes the range as raw pointers, so every algorithm of the host systems runs on it unchanged. A parallel
+ *  algorithm splits the range into contiguous chunks, one per thread or task: \p subspan gives the chunk of a thread,
+ *  and \p advise tells the kernel how that chunk is going to be read, so that it is read ahead of the computation.
+ *
+ *  \see mapped_vector
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename T>
+class mapped_span
+{
+public:
+  /*! \cond
+   */
+  using element_type    = T;
+  using value_type      = ::cuda::std::remove_cv_t<T>;
+  using size_type       = ::cuda::std::size_t;
+  using difference_type = ::cuda::std::ptrdiff_t;
+  using pointer         = T*;
+  using reference       = T&;
+  using iterator        = T*;
+  /*! \endcond
+   */
+
+  /*! This constructor creates an empty \p mapped_span.
+   */
+  mapped_span() noexcept = default;
+
+  /*! This constructor creates a \p mapped_span of the range <tt>[data, data + size)</tt>.
+   *  \param data The first element of the range.
+   *  \param size The number of elements of the range.
+   */
+  mapped_span(pointer data, size_type size) noexcept
+      : m_data(data)
+      , m_size(size)
+  {}
+
+  /*! This constructor converts a \p mapped_span of mutable elements to a \p mapped_span of const elements.
+   */
+  template <typename U, ::cuda::std::enable_if_t<::cuda::std::is_convertible_v<U (*)[], T (*)[]>, int> = 0>
+  mapped_span(const mapped_span<U>& other) noexcept
+      : m_data(other.data())
+      , m_size(other.size())
+      , m_discardable(other.m_discardable)
+  {}
+
+  pointer data() const noexcept
+  {
+    return m_data;
+  }
+
+  size_type size() const noexcept
+  {
+    return m_size;
+  }
+
+  bool empty() const noexcept
+  {
+    return m_size == 0;
+  }
+
+  iterator begin() const noexcept
+  {
+    return m_data;
+  }
+
+  iterator end() const noexcept
+  {
+    return m_data + m_size;
+  }
+
+  reference operator[](size_type n) const
+  {
+    return m_data[n];
+  }
+
+  /*! Returns the view of the \p count elements starting at \p offset.
+   */
+  mapped_span subspan(size_type offset, size_type count) const noexcept
+  {
+    return mapped_span(m_data + offset, count, m_discardable);
+  }
+
+  /*! Passes the hint \p access about the pages spanned by this range to the kernel. The hint is not binding. The
+   *  hint \p mapped_access::dontneed only applies to the pages which lie entirely within the range, and only to a
+   *  range of a \p mapped_vector which is not mapped with \p map_mode::copy_on_write, so that it never loses data.
+   */
+  void advise(mapped_access access) const;
+
+private:
+  template <typename>
+  friend class mapped_span;
+
+  template <typename>
+  friend class mapped_vector;
+
+  mapped_span(pointer data, size_type size, bool discardable) noexcept
+      : m_data(data)
+      , m_size(size)
+      , m_discardable(discardable)
+  {}
+
+  pointer m_data   = nullptr;
+  size_type m_size = 0;
+  // whether the pages can be dropped and read from the file again, i.e. they are a mapping of a mapped_vector whose
+  // writes are carried through to the file, or which is never written to
+  bool m_discardable = false;
+};
+
+/*! A \p mapped_vector is a container of the elements stored in a file, which is mapped into memory with \c mmap
+ *  rather than read into a \p host_vector.
+ *
+ *  The file is paged in on demand by the algorithms which read it, so reading the elements overlaps with the
+ *  computation, and the elements are not held twice in memory. The elements are exposed as raw pointers, so every
+ *  algorithm of the cpp, OpenMP and TBB systems runs on a \p mapped_vector unchanged.
+ *
+ *  A \p mapped_vector either maps an existing file, whose size decides the number of elements, or creates a file of a
+ *  given number of elements to write the results of an algorithm to. Such an output file is typically sized from an
+ *  upper bound of the results, then shrunk to the number of results with \p resize.
+ *
+ *  \p mapped_vector is move-only. It is not available on Windows.
+ *
+ *  \tparam T The type of the elements, which must be trivially copyable.
+ *
+ *  \see host_vector
+ *  \see mapped_span
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename T>
+class mapped_vector
+{
+  static_assert(::cuda::std::is_trivially_copyable_v<T>, "the elements of a file must be trivially copyable");
+
+public:
+  /*! \cond
+   */
+  using value_type      = T;
+  using size_type       = ::cuda::std::size_t;
+  using difference_type = ::cuda::std::ptrdiff_t;
+  using pointer         = T*;
+  using const_pointer   = const T*;
+  using reference       = T&;
+  using const_reference = const T&;
+  using iterator        = T*;
+  using const_iterator  = const T*;
+  /*! \endcond
+   */
+
+  /*! This constructor creates an empty \p mapped_vector, which maps no file.
+   */
+  mapped_vector() noexcept = default;
+
+  /*! This constructor maps the existing file \p path. The number of elements is the size of the file divided by the
+   *  size of an element; the trailing bytes of the file, if any, are not mapped.
+   *
+   *  \param path The path to the file.
+   *  \param mode How the file is mapped.
+   *  \throws thrust::system_error if the file cannot be opened or mapped.
+   */
+  explicit mapped_vector(const std::string& path, map_mode mode = map_mode::read_only);
+
+  /*! Creates the file \p path, or truncates it if it exists, with room for \p n elements, and maps it with
+   *  \p map_mode::read_write. The elements are zero.
+   *
+   *  \param path The path to the file.
+   *  \param n The number of elements of the file.
+   *  \return A \p mapped_vector of the elements of the new file.
+   *  \throws thrust::system_error if the file cannot be created or mapped.
+   */
+  static mapped_vector create(const std::string& path, size_type n);
+
+  mapped_vector(mapped_vector&& other) noexcept;
+
+  mapped_vector& operator=(mapped_vector&& other) noexcept;
+
+  mapped_vector(const mapped_vector&)            = delete;
+  mapped_vector& operator=(const mapped_vector&) = delete;
+
+  /*! This destructor unmaps the file and closes it. The writes to a file mapped with \p map_mode::read_write are
+   *  carried through to it by the kernel, even if they are not flushed.
+   */
+  ~mapped_vector();
+
+  size_type size() const noexcept
+  {
+    return m_size;
+  }
+
+  bool empty() const noexcept
+  {
+    return m_size == 0;
+  }
+
+  map_mode mode() const noexcept
+  {
+    return m_mode;
+  }
+
+  pointer data() noexcept
+  {
+    return m_data;
+  }
+
+  const_pointer data() const noexcept
+  {
+    return m_data;
+  }
+
+  iterator begin() noexcept
+  {
+    return m_data;
+  }
+
+  const_iterator begin() const noexcept
+  {
+    return m_data;
+  }
+
+  const_iterator cbegin() const noexcept
+  {
+    return m_data;
+  }
+
+  iterator end() noexcept
+  {
+    return m_data + m_size;
+  }
+
+  const_iterator end() const noexcept
+  {
+    return m_data + m_size;
+  }
+
+  const_iterator cend() const noexcept
+  {
+    return m_data + m_size;
+  }
+
+  reference operator[](size_type n)
+  {
+    return m_data[n];
+  }
+
+  const_reference operator[](size_type n) const
+  {
+    return m_data[n];
+  }
+
+  /*! Returns a view of all elements.
+   */
+  mapped_span<T> span() noexcept
+  {
+    return mapped_span<T>(m_data, m_size, m_mode != map_mode::copy_on_write);
+  }
+
+  /*! Returns a view of all elements.
+   */
+  mapped_span<const T> span() const noexcept
+  {
+    return mapped_span<const T>(m_data, m_size, m_mode != map_mode::copy_on_write);
+  }
+
+  /*! Passes the hint \p access about all elements to the kernel.
+   */
+  void advise(mapped_access access) const
+  {
+    span().advise(access);
+  }
+
+  /*! Resizes the file to \p n elements and maps it again. The elements past the former end of the file are zero.
+   *
+   *  \pre The file is mapped with \p map_mode::read_write.
+   *  \throws thrust::system_error if the file cannot be resized or mapped.
+   */
+  void resize(size_type n);
+
+  /*! Writes the elements changed in memory to a file mapped with \p map_mode::read_write, and waits for the writes to
+   *  complete.
+   *
+   *  \throws thrust::system_error if the elements cannot be written.
+   */
+  void flush();
+
+private:
+  void map(size_type n);
+  void unmap() noexcept;
+
+  int m_file       = -1;
+  map_mode m_mode  = map_mode::read_only;
+  pointer m_data   = nullptr;
+  size_type m_size = 0;
+};
+
+/*! \} // containers
+ */
+
+THRUST_NAMESPACE_END
+
+#  include <thrust/detail/mapped_vector.inl>
+
+#endif // !_CCCL_OS(WINDOWS)
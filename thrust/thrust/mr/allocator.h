@@ -25,6 +25,7 @@
 
 #include <cuda/std/__iterator/iterator_traits.h>
 #include <cuda/std/__memory/pointer_traits.h>
+#include <cuda/std/__utility/declval.h>
 #include <cuda/std/limits>
 
 THRUST_NAMESPACE_BEGIN
@@ -129,6 +130,24 @@ public:
     return mem_res->do_deallocate(p, n * sizeof(T), alignof(T));
   }
 
+  /*! Resizes the storage of objects of type \p T in place, or moves it without copying its bytes. Only available when
+   *  \p MR has a \p do_reallocate member, like \p mmap_resource and \p malloc_resource. The containers use it to grow
+   *  the storage of trivially relocatable objects.
+   *
+   *  \param p pointer returned by a previous call to \p allocate or \p reallocate
+   *  \param old_n number of elements of the storage at \p p
+   *  \param new_n number of elements of the resized storage
+   *  \return a pointer to the resized storage, which holds the bytes of the first <tt>min(old_n, new_n)</tt> elements,
+   *      or a null pointer if the storage cannot be resized, in which case the storage at \p p is left as it was.
+   */
+  template <typename Resource = MR,
+            typename = decltype(::cuda::std::declval<Resource&>().do_reallocate(
+              ::cuda::std::declval<void_pointer>(), size_type{}, size_type{}, size_type{}))>
+  _CCCL_HOST pointer reallocate(pointer p, size_type old_n, size_type new_n)
+  {
+    return static_cast<pointer>(mem_res->do_reallocate(p, old_n * sizeof(T), new_n * sizeof(T), alignof(T)));
+  }
+
   /*! Extracts the memory resource used by this allocator.
    *
    *  \return the memory resource used by this allocator.
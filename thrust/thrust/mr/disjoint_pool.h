@@ -44,6 +44,39 @@ namespace mr
  *  \{
  */
 
+/*! Statistics of a pooling memory resource adaptor, which tell how well it serves the allocation requests.
+ *
+ *  The hit rate of the pools is <tt>pooled_hits / (pooled_hits + pooled_misses)</tt>, and the hit rate of the cache of
+ *  oversized and overaligned blocks is <tt>oversized_hits / (oversized_hits + oversized_misses)</tt>. The share of the
+ *  memory held from upstream which is not requested by the allocations in use,
+ *  <tt>1 - requested_bytes / upstream_bytes</tt>, measures the fragmentation of the pools and of the cache.
+ */
+struct pool_statistics
+{
+  /*! The number of allocations served from the free list of a pool.
+   */
+  std::size_t pooled_hits;
+  /*! The number of allocations from a pool which allocated a new chunk from upstream.
+   */
+  std::size_t pooled_misses;
+  /*! The number of oversized and overaligned allocations served from the cache.
+   */
+  std::size_t oversized_hits;
+  /*! The number of oversized and overaligned allocations which allocated a new block from upstream.
+   */
+  std::size_t oversized_misses;
+  /*! The number of bytes requested by the allocations in use.
+   */
+  std::size_t requested_bytes;
+  /*! The number of bytes currently allocated from upstream, for the chunks of the pools and for the oversized and
+   *      overaligned blocks, cached or not.
+   */
+  std::size_t upstream_bytes;
+  /*! The number of bytes of the cached oversized and overaligned blocks.
+   */
+  std::size_t cached_oversized_bytes;
+};
+
 /*! A memory resource adaptor allowing for pooling and caching allocations from \p Upstream, using \p Bookkeeper for
  *      management of that cached and pooled memory, allowing to cache portions of memory inaccessible from the host.
  *
@@ -114,8 +147,9 @@ public:
       , m_smallest_block_log2(::cuda::ceil_ilog2(m_options.smallest_block_size))
       , m_pools(m_bookkeeper)
       , m_allocated(m_bookkeeper)
-      , m_cached_oversized(m_bookkeeper)
       , m_oversized(m_bookkeeper)
+      , m_cached_blocks(m_bookkeeper)
+      , m_cache_bins(m_bookkeeper)
   {
     assert(m_options.validate());
 
@@ -137,8 +171,9 @@ public:
       , m_smallest_block_log2(::cuda::ceil_ilog2(m_options.smallest_block_size))
       , m_pools(m_bookkeeper)
       , m_allocated(m_bookkeeper)
-      , m_cached_oversized(m_bookkeeper)
       , m_oversized(m_bookkeeper)
+      , m_cached_blocks(m_bookkeeper)
+      , m_cache_bins(m_bookkeeper)
   {
     assert(m_options.validate());
 
@@ -172,52 +207,42 @@ private:
     std::size_t size;
     std::size_t alignment;
     void_ptr pointer;
-
-    _CCCL_HOST_DEVICE bool operator==(const oversized_block_descriptor& other) const
-    {
-      return size == other.size && alignment == other.alignment && pointer == other.pointer;
-    }
-
-    _CCCL_HOST_DEVICE bool operator<(const oversized_block_descriptor& other) const
-    {
-      return size < other.size || (size == other.size && alignment < other.alignment);
-    }
   };
 
-  struct equal_pointers
+  static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+  // a slot of the open addressing hash table of the oversized/overaligned blocks, indexed by their pointers
+  struct oversized_slot
   {
-  public:
-    _CCCL_HOST_DEVICE equal_pointers(void_ptr p)
-        : p(p)
-    {}
+    oversized_block_descriptor block;
+    bool occupied;
+  };
 
-    _CCCL_HOST_DEVICE bool operator()(const oversized_block_descriptor& desc) const
-    {
-      return desc.pointer == p;
-    }
+  using oversized_slot_vector = thrust::host_vector<oversized_slot, allocator<oversized_slot, Bookkeeper>>;
 
-  private:
-    void_ptr p;
+  // a cached oversized/overaligned block, linked into the list of its bin, or into the list of unused nodes
+  struct cached_block
+  {
+    oversized_block_descriptor block;
+    std::size_t prev;
+    std::size_t next;
   };
 
-  struct matching_alignment
+  using cached_block_vector = thrust::host_vector<cached_block, allocator<cached_block, Bookkeeper>>;
+
+  // the head of the list of the cached blocks of a single alignment and of a narrow range of sizes
+  struct cache_bin
   {
-  public:
-    _CCCL_HOST_DEVICE matching_alignment(std::size_t requested)
-        : requested(requested)
-    {}
+    std::size_t key;
+    std::size_t head;
 
-    _CCCL_HOST_DEVICE bool operator()(const oversized_block_descriptor& desc) const
+    _CCCL_HOST_DEVICE bool operator<(const cache_bin& other) const
     {
-      return desc.alignment >= requested;
+      return key < other.key;
     }
-
-  private:
-    std::size_t requested;
   };
 
-  using oversized_block_vector =
-    thrust::host_vector<oversized_block_descriptor, allocator<oversized_block_descriptor, Bookkeeper>>;
+  using cache_bin_vector = thrust::host_vector<cache_bin, allocator<cache_bin, Bookkeeper>>;
 
   using pointer_vector = thrust::host_vector<void_ptr, allocator<void_ptr, Bookkeeper>>;
 
@@ -257,12 +282,238 @@ private:
   pool_vector m_pools;
   // list of all allocations from upstream for the above
   chunk_vector m_allocated;
-  // list of all cached oversized/overaligned blocks that have been returned to the pool to cache
-  oversized_block_vector m_cached_oversized;
-  // list of all oversized/overaligned allocations from upstream
-  oversized_block_vector m_oversized;
+  // hash table of all oversized/overaligned allocations from upstream, indexed by their pointers
+  oversized_slot_vector m_oversized;
+  std::size_t m_oversized_count = 0;
+  // all cached oversized/overaligned blocks that have been returned to the pool to cache, and the unused nodes
+  cached_block_vector m_cached_blocks;
+  std::size_t m_unused_cached_block = npos;
+  // bins of the cached oversized/overaligned blocks, sorted by alignment, then by size
+  cache_bin_vector m_cache_bins;
+
+  pool_statistics m_statistics{};
+
+  static std::size_t hash(void_ptr p)
+  {
+    // Fibonacci hashing, which spreads the aligned addresses over the whole table
+    const auto address = reinterpret_cast<::cuda::std::uintptr_t>(::cuda::std::to_address(p));
+    return static_cast<std::size_t>((static_cast<::cuda::std::uint64_t>(address) * 0x9E3779B97F4A7C15ull) >> 32);
+  }
+
+  // the slot of the oversized/overaligned block at p, or npos
+  std::size_t find_oversized(void_ptr p) const
+  {
+    if (m_oversized_count == 0)
+    {
+      return npos;
+    }
+
+    const std::size_t mask = m_oversized.size() - 1;
+    for (std::size_t i = hash(p) & mask; m_oversized[i].occupied; i = (i + 1) & mask)
+    {
+      if (m_oversized[i].block.pointer == p)
+      {
+        return i;
+      }
+    }
+    return npos;
+  }
+
+  void insert_oversized(const oversized_block_descriptor& block)
+  {
+    // keep the table at most half full, so that the probe sequences stay short
+    if (2 * (m_oversized_count + 1) > m_oversized.size())
+    {
+      oversized_slot_vector slots(m_bookkeeper);
+      slots.resize((::cuda::std::max) (std::size_t{16}, 2 * m_oversized.size()), oversized_slot{});
+      slots.swap(m_oversized);
+      m_oversized_count = 0;
+
+      for (std::size_t i = 0; i < slots.size(); ++i)
+      {
+        if (slots[i].occupied)
+        {
+          insert_oversized(slots[i].block);
+        }
+      }
+    }
+
+    const std::size_t mask = m_oversized.size() - 1;
+    std::size_t i          = hash(block.pointer) & mask;
+    while (m_oversized[i].occupied)
+    {
+      i = (i + 1) & mask;
+    }
+    m_oversized[i] = oversized_slot{block, true};
+    ++m_oversized_count;
+  }
+
+  void erase_oversized(std::size_t i)
+  {
+    // shift the following blocks of the probe sequence back, instead of leaving a tombstone
+    const std::size_t mask = m_oversized.size() - 1;
+    for (std::size_t j = (i + 1) & mask; m_oversized[j].occupied; j = (j + 1) & mask)
+    {
+      // the block at j can move to i if i is not before its home slot, cyclically
+      const std::size_t home = hash(m_oversized[j].block.pointer) & mask;
+      if (((j - home) & mask) >= ((j - i) & mask))
+      {
+        m_oversized[i] = m_oversized[j];
+        i              = j;
+      }
+    }
+    m_oversized[i].occupied = false;
+    --m_oversized_count;
+  }
+
+  // the sizes are binned with four bins per power of two, so that the blocks of a bin differ by at most 25%
+  static std::size_t size_bin(std::size_t size)
+  {
+    if (size < 4)
+    {
+      return size;
+    }
+    const int log2 = ::cuda::ilog2(size);
+    return static_cast<std::size_t>(log2) * 4 + ((size >> (log2 - 2)) & 3);
+  }
+
+  static std::size_t smallest_size_of_bin(std::size_t bin)
+  {
+    if (bin < 4)
+    {
+      return bin;
+    }
+    return (4 + bin % 4) << (bin / 4 - 2);
+  }
+
+  static std::size_t bin_key(std::size_t alignment_log2, std::size_t bin)
+  {
+    return alignment_log2 << 16 | bin;
+  }
+
+  void cache_oversized(const oversized_block_descriptor& block)
+  {
+    const cache_bin key{bin_key(::cuda::ilog2(block.alignment), size_bin(block.size)), npos};
+    auto bin = thrust::lower_bound(thrust::seq, m_cache_bins.begin(), m_cache_bins.end(), key);
+    if (bin == m_cache_bins.end() || (*bin).key != key.key)
+    {
+      // empty bins are kept, there are at most as many as the alignments and the sizes in use
+      bin = m_cache_bins.insert(bin, key);
+    }
+
+    std::size_t node = m_unused_cached_block;
+    if (node == npos)
+    {
+      node = m_cached_blocks.size();
+      m_cached_blocks.push_back(cached_block{});
+    }
+    else
+    {
+      m_unused_cached_block = m_cached_blocks[node].next;
+    }
+
+    const std::size_t head = (*bin).head;
+    m_cached_blocks[node]  = cached_block{block, npos, head};
+    if (head != npos)
+    {
+      m_cached_blocks[head].prev = node;
+    }
+    (*bin).head = node;
+
+    m_statistics.cached_oversized_bytes += block.size;
+  }
+
+  oversized_block_descriptor uncache_oversized(std::size_t node)
+  {
+    const cached_block cached = m_cached_blocks[node];
+    if (cached.prev != npos)
+    {
+      m_cached_blocks[cached.prev].next = cached.next;
+    }
+    else
+    {
+      const cache_bin key{bin_key(::cuda::ilog2(cached.block.alignment), size_bin(cached.block.size)), npos};
+      (*thrust::lower_bound(thrust::seq, m_cache_bins.begin(), m_cache_bins.end(), key)).head = cached.next;
+    }
+    if (cached.next != npos)
+    {
+      m_cached_blocks[cached.next].prev = cached.prev;
+    }
+
+    m_cached_blocks[node].next = m_unused_cached_block;
+    m_unused_cached_block      = node;
+
+    m_statistics.cached_oversized_bytes -= cached.block.size;
+    return cached.block;
+  }
+
+  // the node of the smallest, then least aligned, cached block which fits a request within the cutoff factors, or npos
+  std::size_t find_cached_oversized(std::size_t bytes, std::size_t alignment) const
+  {
+    std::size_t best = npos;
+
+    const std::size_t requested_log2 = ::cuda::ilog2(alignment);
+    for (std::size_t log2 = requested_log2; log2 < 64; ++log2)
+    {
+      if ((static_cast<std::size_t>(1) << (log2 - requested_log2)) >= m_options.cached_alignment_cutoff_factor)
+      {
+        break;
+      }
+
+      // walk the bins of this alignment from the bin of the requested size, up to the first one with a fitting block
+      const cache_bin key{bin_key(log2, size_bin(bytes)), npos};
+      for (auto bin = thrust::lower_bound(thrust::seq, m_cache_bins.begin(), m_cache_bins.end(), key);
+           bin != m_cache_bins.end() && (*bin).key >> 16 == log2;
+           ++bin)
+      {
+        // the blocks of this bin and of the following ones are too large, or larger than the best fit so far
+        const std::size_t smallest = smallest_size_of_bin((*bin).key & 0xffff);
+        if (smallest / bytes >= m_options.cached_size_cutoff_factor
+            || (best != npos && smallest >= m_cached_blocks[best].block.size))
+        {
+          break;
+        }
+
+        // the bin of the requested size also holds smaller blocks, so look for the best fit in it, while the blocks of
+        // the following bins all fit, within 25% of each other
+        const bool exact_bin = (*bin).key == key.key;
+        std::size_t found    = npos;
+        for (std::size_t node = (*bin).head; node != npos; node = m_cached_blocks[node].next)
+        {
+          const std::size_t size = m_cached_blocks[node].block.size;
+          if (size >= bytes && size / bytes < m_options.cached_size_cutoff_factor
+              && (found == npos || size < m_cached_blocks[found].block.size))
+          {
+            found = node;
+            if (!exact_bin || size == bytes)
+            {
+              break;
+            }
+          }
+        }
+
+        if (found != npos)
+        {
+          if (best == npos || m_cached_blocks[found].block.size < m_cached_blocks[best].block.size)
+          {
+            best = found;
+          }
+          break;
+        }
+      }
+    }
+
+    return best;
+  }
 
 public:
+  /*! Get the statistics of the allocations served by the pool so far.
+   */
+  pool_statistics get_statistics() const
+  {
+    return m_statistics;
+  }
+
   /*! Releases all held memory to upstream.
    */
   void release()
@@ -280,15 +531,26 @@ public:
       m_upstream->do_deallocate(m_allocated[i].pointer, m_allocated[i].size, m_options.alignment);
     }
 
-    // deallocate cached oversized/overaligned memory
+    // deallocate oversized/overaligned memory, cached or not
     for (std::size_t i = 0; i < m_oversized.size(); ++i)
     {
-      m_upstream->do_deallocate(m_oversized[i].pointer, m_oversized[i].size, m_oversized[i].alignment);
+      if (m_oversized[i].occupied)
+      {
+        const oversized_block_descriptor& oversized = m_oversized[i].block;
+        m_upstream->do_deallocate(oversized.pointer, oversized.size, oversized.alignment);
+      }
     }
 
     m_allocated.clear();
     m_oversized.clear();
-    m_cached_oversized.clear();
+    m_oversized_count = 0;
+    m_cached_blocks.clear();
+    m_unused_cached_block = npos;
+    m_cache_bins.clear();
+
+    m_statistics.requested_bytes        = 0;
+    m_statistics.upstream_bytes         = 0;
+    m_statistics.cached_oversized_bytes = 0;
   }
 
   void squeeze()
@@ -326,6 +588,7 @@ public:
 
         // Deallocate and remove this chunk from the list of allocated chunks
         m_upstream->do_deallocate((*it).pointer, (*it).size, m_options.alignment);
+        m_statistics.upstream_bytes -= (*it).size;
         it = m_allocated.erase(it);
       }
       else
@@ -335,12 +598,19 @@ public:
     }
 
     // Remove all cached oversized allocations
-    for (auto it = m_cached_oversized.begin(); it != m_cached_oversized.end();)
+    for (std::size_t i = 0; i < m_cache_bins.size(); ++i)
     {
-      m_upstream->do_deallocate((*it).pointer, (*it).size, (*it).alignment);
-      m_oversized.erase(find(m_oversized.begin(), m_oversized.end(), *it));
-      it = m_cached_oversized.erase(it);
+      while (m_cache_bins[i].head != npos)
+      {
+        const oversized_block_descriptor oversized = uncache_oversized(m_cache_bins[i].head);
+        erase_oversized(find_oversized(oversized.pointer));
+        m_statistics.upstream_bytes -= oversized.size;
+        m_upstream->do_deallocate(oversized.pointer, oversized.size, oversized.alignment);
+      }
     }
+    m_cached_blocks.clear();
+    m_unused_cached_block = npos;
+    m_cache_bins.clear();
   }
 
   [[nodiscard]] void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
@@ -369,51 +639,24 @@ public:
       oversized.size      = bytes;
       oversized.alignment = alignment;
 
-      if (m_options.cache_oversized && !m_cached_oversized.empty())
+      if (m_options.cache_oversized)
       {
-        typename oversized_block_vector::iterator it =
-          thrust::lower_bound(thrust::seq, m_cached_oversized.begin(), m_cached_oversized.end(), oversized);
-
-        // if the size is bigger than the requested size by a factor
-        // bigger than or equal to the specified cutoff for size,
-        // allocate a new block
-        if (it != m_cached_oversized.end())
+        const std::size_t node = find_cached_oversized(bytes, alignment);
+        if (node != npos)
         {
-          std::size_t size_factor = (*it).size / bytes;
-          if (size_factor >= m_options.cached_size_cutoff_factor)
-          {
-            it = m_cached_oversized.end();
-          }
-        }
-
-        if (it != m_cached_oversized.end() && (*it).alignment < alignment)
-        {
-          it = find_if(it + 1, m_cached_oversized.end(), matching_alignment(alignment));
-        }
-
-        // if the alignment is bigger than the requested one by a factor
-        // bigger than or equal to the specified cutoff for alignment,
-        // allocate a new block
-        if (it != m_cached_oversized.end())
-        {
-          std::size_t alignment_factor = (*it).alignment / alignment;
-          if (alignment_factor >= m_options.cached_alignment_cutoff_factor)
-          {
-            it = m_cached_oversized.end();
-          }
-        }
-
-        if (it != m_cached_oversized.end())
-        {
-          oversized.pointer = (*it).pointer;
-          m_cached_oversized.erase(it);
-          return oversized.pointer;
+          ++m_statistics.oversized_hits;
+          m_statistics.requested_bytes += bytes;
+          return uncache_oversized(node).pointer;
         }
       }
 
       // no fitting cached block found; allocate a new one that's just up to the specs
       oversized.pointer = m_upstream->do_allocate(bytes, alignment);
-      m_oversized.push_back(oversized);
+      insert_oversized(oversized);
+
+      ++m_statistics.oversized_misses;
+      m_statistics.requested_bytes += bytes;
+      m_statistics.upstream_bytes += bytes;
 
       return oversized.pointer;
     }
@@ -424,9 +667,15 @@ public:
     std::size_t pool_idx   = bytes_log2 - m_smallest_block_log2;
     pool& bucket           = m_pools[pool_idx];
 
+    m_statistics.requested_bytes += bytes;
+
     // if the free list of the bucket has no elements, allocate a new chunk
     // and split it into blocks pushed to the free list
-    if (bucket.free_blocks.empty())
+    if (!bucket.free_blocks.empty())
+    {
+      ++m_statistics.pooled_hits;
+    }
+    else
     {
       std::size_t bucket_size = static_cast<std::size_t>(1) << bytes_log2;
 
@@ -457,6 +706,9 @@ public:
       m_allocated.push_back(allocated);
       bucket.previous_allocated_count = n;
 
+      ++m_statistics.pooled_misses;
+      m_statistics.upstream_bytes += bytes;
+
       for (std::size_t i = 0; i < n; ++i)
       {
         bucket.free_blocks.push_back(static_cast<void_ptr>(static_cast<char_ptr>(allocated.pointer) + i * bucket_size));
@@ -480,20 +732,20 @@ public:
     // the deallocated block is oversized and/or overaligned
     if (n > m_options.largest_block_size || alignment > m_options.alignment)
     {
-      typename oversized_block_vector::iterator it = find_if(m_oversized.begin(), m_oversized.end(), equal_pointers(p));
-      assert(it != m_oversized.end());
+      const std::size_t slot = find_oversized(p);
+      assert(slot != npos);
 
-      oversized_block_descriptor oversized = *it;
+      const oversized_block_descriptor oversized = m_oversized[slot].block;
+      m_statistics.requested_bytes -= n;
 
       if (m_options.cache_oversized)
       {
-        typename oversized_block_vector::iterator position =
-          lower_bound(m_cached_oversized.begin(), m_cached_oversized.end(), oversized);
-        m_cached_oversized.insert(position, oversized);
+        cache_oversized(oversized);
         return;
       }
 
-      m_oversized.erase(it);
+      erase_oversized(slot);
+      m_statistics.upstream_bytes -= oversized.size;
 
       m_upstream->do_deallocate(p, oversized.size, oversized.alignment);
 
@@ -505,6 +757,7 @@ public:
     std::size_t pool_idx = n_log2 - m_smallest_block_log2;
     pool& bucket         = m_pools[pool_idx];
 
+    m_statistics.requested_bytes -= n;
     bucket.free_blocks.push_back(p);
   }
 };
@@ -71,6 +71,14 @@ public:
       : upstream_pool(get_global_resource<Upstream>(), get_global_resource<Bookkeeper>(), options)
   {}
 
+  /*! Get the statistics of the allocations served by the pool so far.
+   */
+  pool_statistics get_statistics()
+  {
+    lock_t lock(mtx);
+    return upstream_pool.get_statistics();
+  }
+
   /*! Releases all held memory to upstream.
    */
   void release()
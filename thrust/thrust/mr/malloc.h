@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file
+ *  \brief \c malloc-based memory resource, which grows allocations with \c realloc.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/mr/memory_resource.h>
+#include <thrust/system/detail/bad_alloc.h>
+
+#include <cuda/__cmath/round_up.h>
+
+#include <cstddef>
+#include <cstdlib>
+
+#if _CCCL_OS(WINDOWS)
+#  include <malloc.h>
+#endif // _CCCL_OS(WINDOWS)
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+/** \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A memory resource that uses \c std::malloc and \c std::free to allocate and deallocate memory, and overaligned
+ *  allocation functions for the alignments larger than that of \c std::max_align_t.
+ *
+ *  Unlike \p new_delete_resource, it can resize an allocation in place with \c std::realloc, which the containers of
+ *  trivially relocatable elements use to grow through \p allocator::reallocate.
+ */
+class malloc_resource final : public memory_resource<>
+{
+public:
+  void* do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    // malloc may return a null pointer for an empty allocation
+    bytes   = bytes == 0 ? 1 : bytes;
+    void* p = nullptr;
+    if (alignment <= alignof(std::max_align_t))
+    {
+      p = std::malloc(bytes);
+    }
+    else
+    {
+#if _CCCL_OS(WINDOWS)
+      p = ::_aligned_malloc(bytes, alignment);
+#else // ^^^ _CCCL_OS(WINDOWS) ^^^ / vvv !_CCCL_OS(WINDOWS) vvv
+      p = ::aligned_alloc(alignment, ::cuda::round_up(bytes, alignment));
+#endif // ^^^ !_CCCL_OS(WINDOWS) ^^^
+    }
+
+    if (p == nullptr)
+    {
+      throw thrust::system::detail::bad_alloc("malloc_resource::allocate: malloc failed");
+    }
+    return p;
+  }
+
+  void do_deallocate(void* p, std::size_t, [[maybe_unused]] std::size_t alignment) override
+  {
+#if _CCCL_OS(WINDOWS)
+    if (alignment > alignof(std::max_align_t))
+    {
+      ::_aligned_free(p);
+      return;
+    }
+#endif // _CCCL_OS(WINDOWS)
+    std::free(p);
+  }
+
+  /*! Resizes an allocation with \c std::realloc, which extends it in place when the memory after it is free, and
+   *  otherwise moves it, with \c mremap for the large allocations of some C libraries.
+   *
+   *  \return the address of the resized allocation, or \c nullptr if it cannot be resized, in which case the allocation
+   *      at \p p is left as it was. The allocations aligned beyond \c std::max_align_t are never resized, because
+   *      \c std::realloc does not keep their alignment.
+   */
+  void* do_reallocate(void* p, std::size_t, std::size_t new_bytes, std::size_t alignment)
+  {
+    if (alignment > alignof(std::max_align_t) || new_bytes == 0)
+    {
+      return nullptr;
+    }
+    return std::realloc(p, new_bytes);
+  }
+};
+
+/*! \} // memory_resources
+ */
+} // namespace mr
+THRUST_NAMESPACE_END
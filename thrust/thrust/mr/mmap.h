@@ -0,0 +1,475 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file
+ *  \brief A host memory resource which maps anonymous memory with \c mmap, backed by huge pages, pre-faulted and bound
+ *  to a NUMA node on request.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if !_CCCL_OS(WINDOWS)
+
+#  include <thrust/execution_policy.h>
+#  include <thrust/for_each.h>
+#  include <thrust/iterator/counting_iterator.h>
+#  include <thrust/mr/memory_resource.h>
+#  include <thrust/system/detail/bad_alloc.h>
+
+#  include <cuda/__cmath/ceil_div.h>
+#  include <cuda/__cmath/ilog.h>
+#  include <cuda/__cmath/pow2.h>
+#  include <cuda/__cmath/round_up.h>
+#  include <cuda/__memory/align_up.h>
+#  include <cuda/__memory/is_aligned.h>
+#  include <cuda/std/__algorithm/max.h>
+#  include <cuda/std/__algorithm/min.h>
+
+#  include <cassert>
+#  include <cerrno>
+#  include <cstring>
+#  include <system_error>
+#  include <thread>
+#  include <vector>
+
+#  include <sys/mman.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+/** \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! The kinds of pages backing the memory mapped by \p mmap_resource.
+ */
+enum class huge_page_policy
+{
+  /*! Base pages, usually of 4 KiB.
+   */
+  none,
+  /*! Transparent huge pages, requested with <tt>madvise(MADV_HUGEPAGE)</tt> for the mappings of at least
+   *      \p mmap_options::huge_page_size bytes, which are aligned to that size.
+   */
+  transparent,
+  /*! Huge pages of \p mmap_options::huge_page_size bytes reserved by the administrator, mapped with \c MAP_HUGETLB.
+   *      When no reserved huge page is left, the mapping falls back to transparent huge pages.
+   */
+  hugetlb
+};
+
+/*! The ways \p mmap_resource faults in the pages of a new mapping, so that the first pass of an algorithm over it does
+ *  not pay for the page faults.
+ */
+enum class prefault_policy
+{
+  /*! The pages are faulted in by their first access.
+   */
+  none,
+  /*! The kernel faults in all pages before the allocation returns, with \c MAP_POPULATE, or with
+   *      <tt>madvise(MADV_POPULATE_WRITE)</tt> when the pages must first be advised or bound to a NUMA node.
+   */
+  populate,
+  /*! The pages are touched in parallel, with \p thrust::for_each when the host system is OpenMP or TBB, and by a
+   *      few \c std::thread otherwise.
+   */
+  touch
+};
+
+/*! A type used for configuring \p mmap_resource.
+ */
+struct mmap_options
+{
+  /*! The kind of pages backing the mappings.
+   */
+  huge_page_policy huge_pages = huge_page_policy::none;
+  /*! The size of the huge pages, which must be a power of two supported by the system.
+   */
+  std::size_t huge_page_size = std::size_t{2} << 20;
+  /*! How the pages of a new mapping are faulted in.
+   */
+  prefault_policy prefault = prefault_policy::none;
+  /*! The NUMA node on which the pages are allocated, or -1 to follow the policy of the calling thread.
+   */
+  int numa_node = -1;
+
+  /*! Checks if the options are self-consistent.
+   *
+   *  \returns true if the options are self-consistent, false otherwise.
+   */
+  bool validate() const
+  {
+    return ::cuda::is_power_of_two(huge_page_size) && numa_node >= -1;
+  }
+};
+
+/*! A memory resource which maps anonymous private memory with \c mmap for every allocation, and unmaps it on
+ *  deallocation.
+ *
+ *  Fresh memory from \p new_delete_resource is paged in 4 KiB at a time by the first pass over it, which pays a page
+ *  fault per page and a TLB miss for nearly every access of a multi-gigabyte range. This resource backs the mappings
+ *  with huge pages, faults them in ahead of time, and binds them to a NUMA node, as configured by \p mmap_options.
+ *
+ *  Every allocation is rounded up to whole pages, so this resource is meant for large allocations, or as the upstream
+ *  resource of a pooling resource, like <tt>unsynchronized_pool_resource<mmap_resource></tt>.
+ *
+ *  This resource is not available on Windows.
+ */
+class mmap_resource final : public memory_resource<>
+{
+public:
+  /*! Constructor with the default options: base pages, neither pre-faulted nor bound to a NUMA node.
+   */
+  mmap_resource()
+      : mmap_resource(mmap_options{})
+  {}
+
+  /*! Constructor.
+   *
+   *  \param options options to use for the mappings
+   */
+  explicit mmap_resource(const mmap_options& options)
+      : m_options(options)
+      , m_page_size(static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)))
+  {
+    assert(m_options.validate());
+  }
+
+  /*! Returns the options used for the mappings.
+   */
+  const mmap_options& options() const
+  {
+    return m_options;
+  }
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    const std::size_t length = mapped_length(bytes);
+    alignment                = mapping_alignment(length, alignment);
+
+    // the pages must be advised and bound before they are faulted in, so MAP_POPULATE is only used when neither is
+    // needed; otherwise the pages are populated once the mapping is set up
+    const bool populate_on_map = m_options.prefault == prefault_policy::populate && m_options.numa_node < 0
+                              && m_options.huge_pages != huge_page_policy::transparent;
+
+    void* p         = nullptr;
+    bool is_hugetlb = false;
+    bool populated  = false;
+#  if defined(MAP_HUGETLB)
+    if (m_options.huge_pages == huge_page_policy::hugetlb)
+    {
+      p          = map(length, alignment, MAP_HUGETLB | hugetlb_size_flag() | populate_flag(populate_on_map));
+      is_hugetlb = p != nullptr;
+      populated  = is_hugetlb && populate_on_map;
+    }
+#  endif // MAP_HUGETLB
+    if (p == nullptr)
+    {
+      const bool advise = m_options.huge_pages != huge_page_policy::none && length >= m_options.huge_page_size;
+      populated         = populate_on_map && !advise;
+      p                 = map(length, alignment, populate_flag(populated));
+      if (p == nullptr)
+      {
+        throw thrust::system::detail::bad_alloc(std::strerror(errno));
+      }
+#  if defined(MADV_HUGEPAGE)
+      if (advise)
+      {
+        // only a hint: the mapping works with base pages when transparent huge pages are disabled
+        ::madvise(p, length, MADV_HUGEPAGE);
+      }
+#  endif // MADV_HUGEPAGE
+    }
+
+    if (!bind(p, length))
+    {
+      const int error = errno;
+      ::munmap(p, length);
+      throw thrust::system::detail::bad_alloc(std::strerror(error));
+    }
+
+    if (m_options.prefault == prefault_policy::touch
+        || (m_options.prefault == prefault_policy::populate && !populated && !populate(p, length)))
+    {
+      touch(p, length, is_hugetlb ? m_options.huge_page_size : m_page_size);
+    }
+
+    return p;
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t) override
+  {
+    ::munmap(p, mapped_length(bytes));
+  }
+
+  /*! Resizes a mapping in place, or moves its pages to a new address without copying them, with \c mremap. The pages
+   *  added to a mapping are advised, bound and pre-faulted like those of a new mapping. This lets the containers of
+   *  trivially relocatable elements grow without copying them, through \p allocator::reallocate.
+   *
+   *  \return the address of the resized mapping, or \c nullptr if it cannot be resized, in which case the mapping at
+   *      \p p is left as it was.
+   */
+  void* do_reallocate([[maybe_unused]] void* p,
+                      [[maybe_unused]] std::size_t old_bytes,
+                      [[maybe_unused]] std::size_t new_bytes,
+                      [[maybe_unused]] std::size_t alignment)
+  {
+#  if defined(MREMAP_MAYMOVE) && defined(MREMAP_FIXED)
+    const std::size_t old_length = mapped_length(old_bytes);
+    const std::size_t new_length = mapped_length(new_bytes);
+    if (new_length == old_length)
+    {
+      return p;
+    }
+
+    // a mapping is only resized in place if it has the alignment of a new mapping of its new length, so that a mapping
+    // growing past a huge page is backed by huge pages; otherwise its pages are moved over a range reserved with that
+    // alignment
+    const std::size_t new_alignment = mapping_alignment(new_length, alignment);
+    void* q                         = MAP_FAILED;
+    if (::cuda::is_aligned(p, new_alignment))
+    {
+      q = ::mremap(p, old_length, new_length, 0);
+    }
+    if (q == MAP_FAILED)
+    {
+      void* target = map(new_length, new_alignment, 0);
+      if (target == nullptr)
+      {
+        return nullptr;
+      }
+      q = ::mremap(p, old_length, new_length, MREMAP_MAYMOVE | MREMAP_FIXED, target);
+      if (q == MAP_FAILED)
+      {
+        ::munmap(target, new_length);
+        return nullptr;
+      }
+    }
+
+    if (new_length > old_length)
+    {
+      char* tail                    = static_cast<char*>(q) + old_length;
+      const std::size_t tail_length = new_length - old_length;
+#    if defined(MADV_HUGEPAGE)
+      if (m_options.huge_pages != huge_page_policy::none && new_length >= m_options.huge_page_size)
+      {
+        ::madvise(q, new_length, MADV_HUGEPAGE);
+      }
+#    endif // MADV_HUGEPAGE
+      // the binding of the former pages already succeeded, so the binding of the new ones is only a hint
+      bind(tail, tail_length);
+      if (m_options.prefault == prefault_policy::touch
+          || (m_options.prefault == prefault_policy::populate && !populate(tail, tail_length)))
+      {
+        // like a new mapping, a mapping of the hugetlb policy is touched once per huge page; if it fell back to base
+        // pages, the pages which are not touched are faulted in on their first use
+        touch(tail,
+              tail_length,
+              m_options.huge_pages == huge_page_policy::hugetlb ? m_options.huge_page_size : m_page_size);
+      }
+    }
+    return q;
+#  else // ^^^ MREMAP_MAYMOVE && MREMAP_FIXED ^^^ / vvv !MREMAP_MAYMOVE || !MREMAP_FIXED vvv
+    return nullptr;
+#  endif // ^^^ !MREMAP_MAYMOVE || !MREMAP_FIXED ^^^
+  }
+
+private:
+  // writes a byte of every page of a mapping, which is still zero
+  struct touch_page
+  {
+    volatile char* first;
+    std::size_t page_size;
+
+    void operator()(std::size_t page) const
+    {
+      first[page * page_size] = 0;
+    }
+  };
+
+  // the mappings are rounded up to whole huge pages with MAP_HUGETLB, so that they can be unmapped with the same length
+  // if MAP_HUGETLB failed and the mapping fell back to base pages
+  std::size_t mapped_length(std::size_t bytes) const
+  {
+    const std::size_t granularity =
+      m_options.huge_pages == huge_page_policy::hugetlb ? m_options.huge_page_size : m_page_size;
+    return (::cuda::std::max) (::cuda::round_up(bytes, granularity), granularity);
+  }
+
+  // the mappings large enough for a huge page are aligned to the huge page size, so that they are entirely backed by
+  // huge pages
+  std::size_t mapping_alignment(std::size_t length, std::size_t alignment) const
+  {
+    alignment = (::cuda::std::max) (alignment, m_page_size);
+    if (m_options.huge_pages != huge_page_policy::none && length >= m_options.huge_page_size)
+    {
+      alignment = (::cuda::std::max) (alignment, m_options.huge_page_size);
+    }
+    return alignment;
+  }
+
+  static int populate_flag([[maybe_unused]] bool populate)
+  {
+#  if defined(MAP_POPULATE)
+    return populate ? MAP_POPULATE : 0;
+#  else // ^^^ MAP_POPULATE ^^^ / vvv !MAP_POPULATE vvv
+    return 0;
+#  endif // ^^^ !MAP_POPULATE ^^^
+  }
+
+#  if defined(MAP_HUGETLB)
+  int hugetlb_size_flag() const
+  {
+#    if defined(MAP_HUGE_SHIFT)
+    return ::cuda::ilog2(m_options.huge_page_size) << MAP_HUGE_SHIFT;
+#    else // ^^^ MAP_HUGE_SHIFT ^^^ / vvv !MAP_HUGE_SHIFT vvv
+    return 0;
+#    endif // ^^^ !MAP_HUGE_SHIFT ^^^
+  }
+#  endif // MAP_HUGETLB
+
+  // maps length bytes aligned to alignment, by mapping more and unmapping the unaligned head and the tail, or returns
+  // nullptr on failure
+  void* map(std::size_t length, std::size_t alignment, int flags) const
+  {
+    std::size_t natural_alignment = m_page_size;
+#  if defined(MAP_HUGETLB)
+    if (flags & MAP_HUGETLB)
+    {
+      natural_alignment = m_options.huge_page_size;
+    }
+#  endif // MAP_HUGETLB
+    const std::size_t extra = alignment > natural_alignment ? alignment - natural_alignment : 0;
+
+    void* p = ::mmap(nullptr, length + extra, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+    if (p == MAP_FAILED)
+    {
+      return nullptr;
+    }
+    if (extra != 0)
+    {
+      char* first            = static_cast<char*>(p);
+      char* aligned          = static_cast<char*>(::cuda::align_up(p, alignment));
+      const std::size_t head = static_cast<std::size_t>(aligned - first);
+      if (head != 0)
+      {
+        ::munmap(first, head);
+      }
+      if (extra - head != 0)
+      {
+        ::munmap(aligned + length, extra - head);
+      }
+      p = aligned;
+    }
+    return p;
+  }
+
+  // binds the pages of a mapping to the NUMA node of the options, if any; kernels without NUMA support have a single
+  // node, so the binding is skipped on them
+  bool bind([[maybe_unused]] void* p, [[maybe_unused]] std::size_t length) const
+  {
+#  if defined(SYS_mbind)
+    if (m_options.numa_node >= 0)
+    {
+      constexpr int mpol_bind         = 2; // MPOL_BIND, from <linux/mempolicy.h>
+      constexpr std::size_t mask_bits = sizeof(unsigned long) * 8;
+      const std::size_t node          = static_cast<std::size_t>(m_options.numa_node);
+
+      std::vector<unsigned long> mask(node / mask_bits + 1, 0);
+      mask[node / mask_bits] |= 1ul << (node % mask_bits);
+      // the kernel reads one bit less than maxnode
+      if (::syscall(SYS_mbind, p, length, mpol_bind, mask.data(), mask.size() * mask_bits + 1, 0) != 0)
+      {
+        return errno == ENOSYS;
+      }
+    }
+#  endif // SYS_mbind
+    return true;
+  }
+
+  // asks the kernel to fault in the pages of a mapping, and returns false if it cannot
+  static bool populate([[maybe_unused]] void* p, [[maybe_unused]] std::size_t length)
+  {
+#  if defined(MADV_POPULATE_WRITE)
+    return ::madvise(p, length, MADV_POPULATE_WRITE) == 0;
+#  else // ^^^ MADV_POPULATE_WRITE ^^^ / vvv !MADV_POPULATE_WRITE vvv
+    return false;
+#  endif // ^^^ !MADV_POPULATE_WRITE ^^^
+  }
+
+  // faults in the pages of a mapping from several threads, so that their first touch happens in parallel
+  static void touch(void* p, std::size_t length, std::size_t page_size)
+  {
+    const std::size_t num_pages = length / page_size;
+    const touch_page f{static_cast<volatile char*>(p), page_size};
+
+#  if THRUST_HOST_SYSTEM == THRUST_HOST_SYSTEM_OMP || THRUST_HOST_SYSTEM == THRUST_HOST_SYSTEM_TBB
+    thrust::for_each_n(thrust::host, thrust::counting_iterator<std::size_t>(0), num_pages, f);
+#  else // ^^^ parallel host system ^^^ / vvv sequential host system vvv
+    // the sequential host system would touch every page from the calling thread, so the pages are split over threads,
+    // each of which zeroes enough memory to pay for its start
+    constexpr std::size_t min_bytes_per_thread = std::size_t{4} << 20;
+    const std::size_t hardware_threads         = (::cuda::std::max) (std::thread::hardware_concurrency(), 1u);
+    const std::size_t num_threads =
+      (::cuda::std::max) (std::size_t{1}, (::cuda::std::min) (hardware_threads, length / min_bytes_per_thread));
+    const std::size_t pages_per_thread = ::cuda::ceil_div(num_pages, num_threads);
+
+    // the calling thread touches the first pages, and those of the threads which could not be started
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads - 1);
+    std::size_t first = pages_per_thread;
+    for (; first < num_pages; first += pages_per_thread)
+    {
+      const std::size_t last = (::cuda::std::min) (first + pages_per_thread, num_pages);
+      try
+      {
+        threads.emplace_back([f, first, last] {
+          for (std::size_t page = first; page < last; ++page)
+          {
+            f(page);
+          }
+        });
+      }
+      catch (const std::system_error&)
+      {
+        break;
+      }
+    }
+    for (std::size_t page = 0; page < (::cuda::std::min) (pages_per_thread, num_pages); ++page)
+    {
+      f(page);
+    }
+    for (std::size_t page = first; page < num_pages; ++page)
+    {
+      f(page);
+    }
+    for (std::thread& thread : threads)
+    {
+      thread.join();
+    }
+#  endif // ^^^ sequential host system ^^^
+  }
+
+  mmap_options m_options;
+  std::size_t m_page_size;
+};
+
+/*! \} // memory_resources
+ */
+} // namespace mr
+THRUST_NAMESPACE_END
+
+#endif // !_CCCL_OS(WINDOWS)
@@ -19,6 +19,7 @@
 #include <thrust/detail/execution_policy.h>
 
 #include <cuda/std/__utility/pair.h>
+#include <cuda/std/tuple>
 
 THRUST_NAMESPACE_BEGIN
 
@@ -1207,6 +1208,234 @@ template <typename InputIterator1,
   OutputIterator2 out_false,
   Predicate pred);
 
+/*! \p three_way_partition reorders the elements <tt>[first, last)</tt> into three groups, like
+ *  \p cub::DevicePartition::If with two selection operators: first the elements which satisfy \p select_first_part,
+ *  then the elements which do not but satisfy \p select_second_part, and then the remaining, unselected elements.
+ *  \p select_second_part is not applied to the elements which satisfy \p select_first_part.
+ *
+ *  \p three_way_partition is stable: the relative order of the elements of every group is preserved. It replaces two
+ *  consecutive calls to \p stable_partition, and the host systems read the input once to count the elements of every
+ *  group and once to move them to their final position.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence to reorder.
+ *  \param last The end of the sequence to reorder.
+ *  \param select_first_part A function object which selects the elements of the first group.
+ *  \param select_second_part A function object which selects the elements of the second group among the others.
+ *  \return A \p pair p such that <tt>p.first</tt> is the end of the first group and the beginning of the second, and
+ *          <tt>p.second</tt> is the end of the second group and the beginning of the unselected elements.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is convertible to the argument types of \p Predicate1 and \p Predicate2.
+ *  \tparam Predicate1 is a model of <a href="https://en.cppreference.com/w/cpp/concepts/predicate">Predicate</a>.
+ *  \tparam Predicate2 is a model of <a href="https://en.cppreference.com/w/cpp/concepts/predicate">Predicate</a>.
+ *
+ *  The following code snippet demonstrates how to use \p three_way_partition to split a sequence into small, medium
+ *  and large numbers using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/partition.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  struct is_small
+ *  {
+ *    __host__ __device__
+ *    bool operator()(int x) const
+ *    {
+ *      return x < 7;
+ *    }
+ *  };
+ *
+ *  struct is_medium
+ *  {
+ *    __host__ __device__
+ *    bool operator()(int x) const
+ *    {
+ *      return x <= 50;
+ *    }
+ *  };
+ *  ...
+ *  int A[] = {0, 2, 3, 9, 5, 2, 81, 8};
+ *  auto ends = thrust::three_way_partition(thrust::host, A, A + 8, is_small{}, is_medium{});
+ *  // A is now {0, 2, 3, 5, 2, 9, 8, 81}
+ *  // ends.first == A + 5
+ *  // ends.second == A + 7
+ *  \endcode
+ *
+ *  \see \p three_way_partition_copy
+ *  \see \p stable_partition
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy, typename RandomAccessIterator, typename Predicate1, typename Predicate2>
+_CCCL_HOST_DEVICE ::cuda::std::pair<RandomAccessIterator, RandomAccessIterator> three_way_partition(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  Predicate1 select_first_part,
+  Predicate2 select_second_part);
+
+/*! \p three_way_partition reorders the elements <tt>[first, last)</tt> into three groups: first the elements which
+ *  satisfy \p select_first_part, then the elements which do not but satisfy \p select_second_part, and then the
+ *  remaining, unselected elements. The relative order of the elements of every group is preserved.
+ *
+ *  \param first The beginning of the sequence to reorder.
+ *  \param last The end of the sequence to reorder.
+ *  \param select_first_part A function object which selects the elements of the first group.
+ *  \param select_second_part A function object which selects the elements of the second group among the others.
+ *  \return A \p pair p such that <tt>p.first</tt> is the end of the first group and the beginning of the second, and
+ *          <tt>p.second</tt> is the end of the second group and the beginning of the unselected elements.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is convertible to the argument types of \p Predicate1 and \p Predicate2.
+ *  \tparam Predicate1 is a model of <a href="https://en.cppreference.com/w/cpp/concepts/predicate">Predicate</a>.
+ *  \tparam Predicate2 is a model of <a href="https://en.cppreference.com/w/cpp/concepts/predicate">Predicate</a>.
+ *
+ *  \see \p three_way_partition_copy
+ *  \see \p stable_partition
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename RandomAccessIterator, typename Predicate1, typename Predicate2>
+::cuda::std::pair<RandomAccessIterator, RandomAccessIterator> three_way_partition(
+  RandomAccessIterator first, RandomAccessIterator last, Predicate1 select_first_part, Predicate2 select_second_part);
+
+/*! \p three_way_partition_copy differs from \p three_way_partition only in that the three groups of elements are
+ *  written to different output sequences, rather than in place: the elements which satisfy \p select_first_part are
+ *  copied to \p out_first_part, the elements which do not but satisfy \p select_second_part to \p out_second_part, and
+ *  the remaining elements to \p out_unselected, all in the order of the input.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence to partition.
+ *  \param last The end of the sequence to partition.
+ *  \param out_first_part The destination of the elements of the first group.
+ *  \param out_second_part The destination of the elements of the second group.
+ *  \param out_unselected The destination of the unselected elements.
+ *  \param select_first_part A function object which selects the elements of the first group.
+ *  \param select_second_part A function object which selects the elements of the second group among the others.
+ *  \return A \p tuple of the ends of the output ranges beginning at \p out_first_part, \p out_second_part and
+ *          \p out_unselected.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is convertible to the argument types of \p Predicate1 and \p Predicate2 and to the
+ *          \c value_types of the output iterators.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>.
+ *  \tparam OutputIterator3 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>.
+ *  \tparam Predicate1 is a model of <a href="https://en.cppreference.com/w/cpp/concepts/predicate">Predicate</a>.
+ *  \tparam Predicate2 is a model of <a href="https://en.cppreference.com/w/cpp/concepts/predicate">Predicate</a>.
+ *
+ *  \pre The input range shall not overlap with any output range.
+ *
+ *  The following code snippet demonstrates how to use \p three_way_partition_copy using the \p thrust::host execution
+ *  policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/partition.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int A[] = {0, 2, 3, 9, 5, 2, 81, 8};
+ *  int small[8];
+ *  int medium[8];
+ *  int large[8];
+ *  auto ends = thrust::three_way_partition_copy(thrust::host, A, A + 8, small, medium, large, is_small{}, is_medium{});
+ *  // small is now {0, 2, 3, 5, 2}
+ *  // medium is now {9, 8}
+ *  // large is now {81}
+ *  // cuda::std::get<0>(ends) == small + 5
+ *  \endcode
+ *
+ *  \see \p three_way_partition
+ *  \see \p stable_partition_copy
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename OutputIterator3,
+          typename Predicate1,
+          typename Predicate2>
+_CCCL_HOST_DEVICE ::cuda::std::tuple<OutputIterator1, OutputIterator2, OutputIterator3> three_way_partition_copy(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator1 out_first_part,
+  OutputIterator2 out_second_part,
+  OutputIterator3 out_unselected,
+  Predicate1 select_first_part,
+  Predicate2 select_second_part);
+
+/*! \p three_way_partition_copy copies the elements of <tt>[first, last)</tt> which satisfy \p select_first_part to
+ *  \p out_first_part, the elements which do not but satisfy \p select_second_part to \p out_second_part, and the
+ *  remaining elements to \p out_unselected, all in the order of the input.
+ *
+ *  \param first The beginning of the sequence to partition.
+ *  \param last The end of the sequence to partition.
+ *  \param out_first_part The destination of the elements of the first group.
+ *  \param out_second_part The destination of the elements of the second group.
+ *  \param out_unselected The destination of the unselected elements.
+ *  \param select_first_part A function object which selects the elements of the first group.
+ *  \param select_second_part A function object which selects the elements of the second group among the others.
+ *  \return A \p tuple of the ends of the output ranges beginning at \p out_first_part, \p out_second_part and
+ *          \p out_unselected.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is convertible to the argument types of \p Predicate1 and \p Predicate2 and to the
+ *          \c value_types of the output iterators.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>.
+ *  \tparam OutputIterator3 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>.
+ *  \tparam Predicate1 is a model of <a href="https://en.cppreference.com/w/cpp/concepts/predicate">Predicate</a>.
+ *  \tparam Predicate2 is a model of <a href="https://en.cppreference.com/w/cpp/concepts/predicate">Predicate</a>.
+ *
+ *  \pre The input range shall not overlap with any output range.
+ *
+ *  \see \p three_way_partition
+ *  \see \p stable_partition_copy
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename RandomAccessIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename OutputIterator3,
+          typename Predicate1,
+          typename Predicate2>
+::cuda::std::tuple<OutputIterator1, OutputIterator2, OutputIterator3> three_way_partition_copy(
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator1 out_first_part,
+  OutputIterator2 out_second_part,
+  OutputIterator3 out_unselected,
+  Predicate1 select_first_part,
+  Predicate2 select_second_part);
+
 /*!
  * \} end group partitioning
  */
@@ -0,0 +1,297 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file pipeline.h
+ *  \brief Chains of algorithms fused into a single pass over their input
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/execution_policy.h>
+#include <thrust/pair.h>
+#include <thrust/system/detail/internal/fused_pipeline.h>
+
+#include <cuda/std/__functional/operations.h>
+#include <cuda/std/tuple>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup algorithms
+ */
+
+/*! \addtogroup transformations
+ *  \ingroup algorithms
+ *  \{
+ */
+
+/*! A \p pipeline is a chain of stages, which is run over a range in a single pass, in place of a chain of algorithms
+ *  which would each make a pass over memory and store their results in an intermediate range.
+ *
+ *  A \p pipeline is built from an empty one, by appending the stages that each element of the input goes through:
+ *
+ *  - \p map transforms the elements with a function, like \p transform.
+ *  - \p filter drops the elements for which a predicate is \c false, like \p copy_if.
+ *  - \p scan replaces the elements with their inclusive prefix sums, like \p inclusive_scan.
+ *
+ *  Each of these functions returns a new \p pipeline, which is its type with the new stage. The pipeline is then run
+ *  over an input range by one of its terminal stages, which consumes the elements that reach the end of the pipeline:
+ *
+ *  - \p reduce folds them, like \p reduce.
+ *  - \p copy writes them to an output range, like \p copy.
+ *  - \p reduce_by_key reduces the runs of equal keys of the (key, value) tuples, like \p reduce_by_key.
+ *  - \p scatter writes the first element of every (value, position) tuple to its position, like \p scatter.
+ *
+ *  The stages are composed at compile time into a single loop over the input. The host systems split the input into
+ *  tiles whose intermediate results stay in the cache, and process the tiles in parallel: the filters compact the
+ *  elements within their tile, and the scans and the terminals which write their results in order pass a carry from
+ *  every tile to the next. A chain of \c k algorithms thus reads and writes memory about once instead of \c k times.
+ *
+ *  The stages take their function objects by value. Like the algorithms they replace, the operators of \p scan, \p
+ *  reduce and \p reduce_by_key shall be associative, and are applied to the elements in order. If a function object
+ *  throws, the other workers stop, and the exception of the first one that failed is rethrown by the terminal.
+ *
+ *  \p pipeline is implemented for the host systems: the cpp, OpenMP and TBB systems. The CUDA system does not support
+ *  it.
+ *
+ *  The following code snippet demonstrates how to use a \p pipeline to sum the squares of the even elements of a
+ *  range, in a single pass with the \p thrust::host execution policy:
+ *
+ *  \code
+ *  #include <thrust/pipeline.h>
+ *  #include <thrust/execution_policy.h>
+ *
+ *  struct is_even
+ *  {
+ *    bool operator()(int x) const { return x % 2 == 0; }
+ *  };
+ *
+ *  struct square
+ *  {
+ *    int operator()(int x) const { return x * x; }
+ *  };
+ *
+ *  ...
+ *  int data[6] = {1, 2, 3, 4, 5, 6};
+ *
+ *  int sum = thrust::pipeline<>{}.filter(is_even{}).map(square{}).reduce(thrust::host, data, data + 6, 0);
+ *  // sum is now 56
+ *  \endcode
+ *
+ *  \tparam Stages The types of the stages, which are built by \p map, \p filter and \p scan.
+ *
+ *  \see transform
+ *  \see copy_if
+ *  \see inclusive_scan
+ *  \see transform_reduce
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename... Stages>
+class pipeline
+{
+  template <typename... OtherStages>
+  friend class pipeline;
+
+  using stages_type = ::cuda::std::tuple<Stages...>;
+
+  template <typename InputIterator>
+  using result_type =
+    system::detail::internal::pipeline_stream_t<thrust::detail::it_value_t<InputIterator>, stages_type>;
+
+public:
+  /*! This constructor creates an empty \p pipeline, whose elements are those of its input.
+   */
+  pipeline() = default;
+
+  /*! Appends a stage which transforms the elements with \p f.
+   *
+   *  \param f The function which transforms an element, whose result is the next element.
+   *  \return A \p pipeline with the stages of this one, followed by the new stage.
+   */
+  template <typename UnaryFunction>
+  pipeline<Stages..., system::detail::internal::pipeline_map<UnaryFunction>> map(UnaryFunction f) const;
+
+  /*! Appends a stage which drops the elements for which \p pred is \c false.
+   *
+   *  \param pred The predicate which an element must satisfy to be passed on.
+   *  \return A \p pipeline with the stages of this one, followed by the new stage.
+   */
+  template <typename Predicate>
+  pipeline<Stages..., system::detail::internal::pipeline_filter<Predicate>> filter(Predicate pred) const;
+
+  /*! Appends a stage which replaces the elements with their inclusive prefix sums under \p op.
+   *
+   *  \param op The associative operator of the scan, which is \c plus by default.
+   *  \return A \p pipeline with the stages of this one, followed by the new stage.
+   */
+  template <typename AssociativeOperator = ::cuda::std::plus<>>
+  pipeline<Stages..., system::detail::internal::pipeline_scan<AssociativeOperator>>
+  scan(AssociativeOperator op = AssociativeOperator{}) const;
+
+  /*! Runs the pipeline over <tt>[first, last)</tt>, and folds the resulting elements with \p init under \p op.
+   *
+   *  \param exec The execution policy to use for parallelization.
+   *  \param first The beginning of the input range.
+   *  \param last The end of the input range.
+   *  \param init The initial value of the reduction.
+   *  \param op The associative operator of the reduction, which is \c plus by default.
+   *  \return The result of the reduction, which is \p init if no element reaches the end of the pipeline.
+   *
+   *  \tparam RandomAccessIterator is a model of <a
+   *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+   */
+  template <typename DerivedPolicy,
+            typename RandomAccessIterator,
+            typename T,
+            typename AssociativeOperator = ::cuda::std::plus<>>
+  T reduce(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+           RandomAccessIterator first,
+           RandomAccessIterator last,
+           T init,
+           AssociativeOperator op = AssociativeOperator{}) const;
+
+  /*! Runs the pipeline over <tt>[first, last)</tt>, and folds the resulting elements with \p init under \p op.
+   */
+  template <typename RandomAccessIterator, typename T, typename AssociativeOperator = ::cuda::std::plus<>>
+  T reduce(RandomAccessIterator first, RandomAccessIterator last, T init, AssociativeOperator op = {}) const;
+
+  /*! Runs the pipeline over <tt>[first, last)</tt>, and writes the resulting elements to the range beginning at
+   *  \p result, in order.
+   *
+   *  \param exec The execution policy to use for parallelization.
+   *  \param first The beginning of the input range.
+   *  \param last The end of the input range.
+   *  \param result The beginning of the output range, which shall not overlap the input range.
+   *  \return The end of the output range.
+   *
+   *  \tparam RandomAccessIterator is a model of <a
+   *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+   *  \tparam OutputIterator is a model of <a
+   *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+   *          \p OutputIterator is mutable.
+   */
+  template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator>
+  OutputIterator copy(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                      RandomAccessIterator first,
+                      RandomAccessIterator last,
+                      OutputIterator result) const;
+
+  /*! Runs the pipeline over <tt>[first, last)</tt>, and writes the resulting elements to the range beginning at
+   *  \p result, in order.
+   */
+  template <typename RandomAccessIterator, typename OutputIterator>
+  OutputIterator copy(RandomAccessIterator first, RandomAccessIterator last, OutputIterator result) const;
+
+  /*! Runs the pipeline over <tt>[first, last)</tt>, whose resulting elements are (key, value) tuples, and reduces the
+   *  values of every run of consecutive equal keys. The key and the reduced value of every run are written to the
+   *  ranges beginning at \p keys_result and \p values_result, in order.
+   *
+   *  \param exec The execution policy to use for parallelization.
+   *  \param first The beginning of the input range.
+   *  \param last The end of the input range.
+   *  \param keys_result The beginning of the output range of keys.
+   *  \param values_result The beginning of the output range of values.
+   *  \param binary_pred The predicate which compares consecutive keys, which is \c equal_to by default.
+   *  \param op The associative operator of the reductions, which is \c plus by default.
+   *  \return The ends of the output ranges of keys and values.
+   *
+   *  \tparam RandomAccessIterator is a model of <a
+   *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+   *  \tparam KeysOutputIterator is a model of <a
+   *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+   *          \p KeysOutputIterator is mutable.
+   *  \tparam ValuesOutputIterator is a model of <a
+   *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+   *          \p ValuesOutputIterator is mutable.
+   */
+  template <typename DerivedPolicy,
+            typename RandomAccessIterator,
+            typename KeysOutputIterator,
+            typename ValuesOutputIterator,
+            typename BinaryPredicate     = ::cuda::std::equal_to<>,
+            typename AssociativeOperator = ::cuda::std::plus<>>
+  thrust::pair<KeysOutputIterator, ValuesOutputIterator>
+  reduce_by_key(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                RandomAccessIterator first,
+                RandomAccessIterator last,
+                KeysOutputIterator keys_result,
+                ValuesOutputIterator values_result,
+                BinaryPredicate binary_pred = BinaryPredicate{},
+                AssociativeOperator op      = AssociativeOperator{}) const;
+
+  /*! Runs the pipeline over <tt>[first, last)</tt>, whose resulting elements are (key, value) tuples, and reduces the
+   *  values of every run of consecutive equal keys.
+   */
+  template <typename RandomAccessIterator,
+            typename KeysOutputIterator,
+            typename ValuesOutputIterator,
+            typename BinaryPredicate     = ::cuda::std::equal_to<>,
+            typename AssociativeOperator = ::cuda::std::plus<>>
+  thrust::pair<KeysOutputIterator, ValuesOutputIterator> reduce_by_key(
+    RandomAccessIterator first,
+    RandomAccessIterator last,
+    KeysOutputIterator keys_result,
+    ValuesOutputIterator values_result,
+    BinaryPredicate binary_pred = {},
+    AssociativeOperator op      = {}) const;
+
+  /*! Runs the pipeline over <tt>[first, last)</tt>, whose resulting elements are (value, position) tuples, and writes
+   *  every value to <tt>result[position]</tt>.
+   *
+   *  \param exec The execution policy to use for parallelization.
+   *  \param first The beginning of the input range.
+   *  \param last The end of the input range.
+   *  \param result The beginning of the output range.
+   *
+   *  \tparam RandomAccessIterator is a model of <a
+   *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+   *  \tparam OutputIterator is a model of <a
+   *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+   *          \p OutputIterator is mutable.
+   *
+   *  \pre The positions shall be unique, or the value written to a position which is repeated is unspecified.
+   */
+  template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator>
+  void scatter(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+               RandomAccessIterator first,
+               RandomAccessIterator last,
+               OutputIterator result) const;
+
+  /*! Runs the pipeline over <tt>[first, last)</tt>, whose resulting elements are (value, position) tuples, and writes
+   *  every value to <tt>result[position]</tt>.
+   */
+  template <typename RandomAccessIterator, typename OutputIterator>
+  void scatter(RandomAccessIterator first, RandomAccessIterator last, OutputIterator result) const;
+
+private:
+  explicit pipeline(const stages_type& stages)
+      : m_stages(stages)
+  {}
+
+  template <typename DerivedPolicy, typename RandomAccessIterator, typename Terminal>
+  auto run(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+           RandomAccessIterator first,
+           RandomAccessIterator last,
+           const Terminal& terminal) const;
+
+  stages_type m_stages;
+};
+
+/*! \} // end transformations
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/pipeline.inl>
@@ -0,0 +1,376 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file run_length_encode.h
+ *  \brief Finds the runs of consecutive equivalent elements of a range
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+
+#include <cuda/std/__utility/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup stream_compaction
+ *  \{
+ */
+
+/*! \p run_length_encode finds every maximal run of consecutive equal elements in the range <tt>[first, last)</tt>,
+ *  copies its first element to \p unique_output and its number of elements to \p counts_output, like
+ *  \p cub::DeviceRunLengthEncode::Encode. It is equivalent to a \p reduce_by_key of a \p constant_iterator of ones,
+ *  but does not need a column of values.
+ *
+ *  This version of \p run_length_encode uses \c operator== to test for equality.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input range.
+ *  \param last The end of the input range.
+ *  \param unique_output The beginning of the output range of the first element of every run.
+ *  \param counts_output The beginning of the output range of the length of every run.
+ *  \return A pair of iterators at the end of the ranges <tt>[unique_output, unique_output_last)</tt> and
+ *          <tt>[counts_output, counts_output_last)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/concepts/equality_comparable">Equality Comparable</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p InputIterator's \c value_type is convertible to its \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p InputIterator's \c difference_type is convertible to its \c value_type.
+ *
+ *  \pre The output ranges shall not overlap the input range.
+ *
+ *  The following code snippet demonstrates how to use \p run_length_encode using the \p thrust::host execution policy
+ *  for parallelization:
+ *
+ *  \code
+ *  #include <thrust/run_length_encode.h>
+ *  #include <thrust/execution_policy.h>
+ *  int A[] = {0, 2, 2, 9, 5, 5, 5, 8};
+ *  int unique[8];
+ *  int counts[8];
+ *  auto ends = thrust::run_length_encode(thrust::host, A, A + 8, unique, counts);
+ *  // ends.first - unique == 5
+ *  // unique is now {0, 2, 9, 5, 8}
+ *  // counts is now {1, 2, 1, 3, 1}
+ *  \endcode
+ *
+ *  \see reduce_by_key
+ *  \see non_trivial_runs
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator1, typename OutputIterator2>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 unique_output,
+  OutputIterator2 counts_output);
+
+/*! \p run_length_encode finds every maximal run of consecutive equivalent elements in the range
+ *  <tt>[first, last)</tt>, copies its first element to \p unique_output and its number of elements to
+ *  \p counts_output. Two consecutive elements are equivalent if \p binary_pred returns \c true for them.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input range.
+ *  \param last The end of the input range.
+ *  \param unique_output The beginning of the output range of the first element of every run.
+ *  \param counts_output The beginning of the output range of the length of every run.
+ *  \param binary_pred The equivalence relation used to compare consecutive elements.
+ *  \return A pair of iterators at the end of the ranges <tt>[unique_output, unique_output_last)</tt> and
+ *          <tt>[counts_output, counts_output_last)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p InputIterator's \c value_type is convertible to its \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p InputIterator's \c difference_type is convertible to its \c value_type.
+ *  \tparam BinaryPredicate is a model of <a href="https://en.cppreference.com/w/cpp/named_req/BinaryPredicate">Binary
+ *          Predicate</a>.
+ *
+ *  \pre The output ranges shall not overlap the input range.
+ *
+ *  \see reduce_by_key
+ *  \see non_trivial_runs
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 unique_output,
+  OutputIterator2 counts_output,
+  BinaryPredicate binary_pred);
+
+/*! \p run_length_encode finds every maximal run of consecutive equal elements in the range <tt>[first, last)</tt>,
+ *  copies its first element to \p unique_output and its number of elements to \p counts_output.
+ *
+ *  This version of \p run_length_encode uses \c operator== to test for equality.
+ *
+ *  \param first The beginning of the input range.
+ *  \param last The end of the input range.
+ *  \param unique_output The beginning of the output range of the first element of every run.
+ *  \param counts_output The beginning of the output range of the length of every run.
+ *  \return A pair of iterators at the end of the ranges <tt>[unique_output, unique_output_last)</tt> and
+ *          <tt>[counts_output, counts_output_last)</tt>.
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/concepts/equality_comparable">Equality Comparable</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p InputIterator's \c value_type is convertible to its \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p InputIterator's \c difference_type is convertible to its \c value_type.
+ *
+ *  \pre The output ranges shall not overlap the input range.
+ *
+ *  \see reduce_by_key
+ *  \see non_trivial_runs
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename InputIterator, typename OutputIterator1, typename OutputIterator2>
+::cuda::std::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  InputIterator first, InputIterator last, OutputIterator1 unique_output, OutputIterator2 counts_output);
+
+/*! \p run_length_encode finds every maximal run of consecutive equivalent elements in the range
+ *  <tt>[first, last)</tt>, copies its first element to \p unique_output and its number of elements to
+ *  \p counts_output. Two consecutive elements are equivalent if \p binary_pred returns \c true for them.
+ *
+ *  \param first The beginning of the input range.
+ *  \param last The end of the input range.
+ *  \param unique_output The beginning of the output range of the first element of every run.
+ *  \param counts_output The beginning of the output range of the length of every run.
+ *  \param binary_pred The equivalence relation used to compare consecutive elements.
+ *  \return A pair of iterators at the end of the ranges <tt>[unique_output, unique_output_last)</tt> and
+ *          <tt>[counts_output, counts_output_last)</tt>.
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p InputIterator's \c value_type is convertible to its \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p InputIterator's \c difference_type is convertible to its \c value_type.
+ *  \tparam BinaryPredicate is a model of <a href="https://en.cppreference.com/w/cpp/named_req/BinaryPredicate">Binary
+ *          Predicate</a>.
+ *
+ *  \pre The output ranges shall not overlap the input range.
+ *
+ *  \see reduce_by_key
+ *  \see non_trivial_runs
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename InputIterator, typename OutputIterator1, typename OutputIterator2, typename BinaryPredicate>
+::cuda::std::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 unique_output,
+  OutputIterator2 counts_output,
+  BinaryPredicate binary_pred);
+
+/*! \p non_trivial_runs finds every maximal run of more than one consecutive equal elements in the range
+ *  <tt>[first, last)</tt>, and writes the offset of its first element from \p first to \p offsets_output and its
+ *  number of elements to \p lengths_output, like \p cub::DeviceRunLengthEncode::NonTrivialRuns.
+ *
+ *  This version of \p non_trivial_runs uses \c operator== to test for equality.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input range.
+ *  \param last The end of the input range.
+ *  \param offsets_output The beginning of the output range of the offset of every non-trivial run.
+ *  \param lengths_output The beginning of the output range of the length of every non-trivial run.
+ *  \return A pair of iterators at the end of the ranges <tt>[offsets_output, offsets_output_last)</tt> and
+ *          <tt>[lengths_output, lengths_output_last)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/concepts/equality_comparable">Equality Comparable</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p InputIterator's \c difference_type is convertible to its \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p InputIterator's \c difference_type is convertible to its \c value_type.
+ *
+ *  The following code snippet demonstrates how to use \p non_trivial_runs using the \p thrust::host execution policy
+ *  for parallelization:
+ *
+ *  \code
+ *  #include <thrust/run_length_encode.h>
+ *  #include <thrust/execution_policy.h>
+ *  int A[] = {0, 2, 2, 9, 5, 5, 5, 8};
+ *  int offsets[8];
+ *  int lengths[8];
+ *  auto ends = thrust::non_trivial_runs(thrust::host, A, A + 8, offsets, lengths);
+ *  // ends.first - offsets == 2
+ *  // offsets is now {1, 4}
+ *  // lengths is now {2, 3}
+ *  \endcode
+ *
+ *  \see run_length_encode
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator1, typename OutputIterator2>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> non_trivial_runs(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 offsets_output,
+  OutputIterator2 lengths_output);
+
+/*! \p non_trivial_runs finds every maximal run of more than one consecutive equivalent elements in the range
+ *  <tt>[first, last)</tt>, and writes the offset of its first element from \p first to \p offsets_output and its
+ *  number of elements to \p lengths_output. Two consecutive elements are equivalent if \p binary_pred returns \c true
+ *  for them.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input range.
+ *  \param last The end of the input range.
+ *  \param offsets_output The beginning of the output range of the offset of every non-trivial run.
+ *  \param lengths_output The beginning of the output range of the length of every non-trivial run.
+ *  \param binary_pred The equivalence relation used to compare consecutive elements.
+ *  \return A pair of iterators at the end of the ranges <tt>[offsets_output, offsets_output_last)</tt> and
+ *          <tt>[lengths_output, lengths_output_last)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p InputIterator's \c difference_type is convertible to its \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p InputIterator's \c difference_type is convertible to its \c value_type.
+ *  \tparam BinaryPredicate is a model of <a href="https://en.cppreference.com/w/cpp/named_req/BinaryPredicate">Binary
+ *          Predicate</a>.
+ *
+ *  \see run_length_encode
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> non_trivial_runs(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 offsets_output,
+  OutputIterator2 lengths_output,
+  BinaryPredicate binary_pred);
+
+/*! \p non_trivial_runs finds every maximal run of more than one consecutive equal elements in the range
+ *  <tt>[first, last)</tt>, and writes the offset of its first element from \p first to \p offsets_output and its
+ *  number of elements to \p lengths_output.
+ *
+ *  This version of \p non_trivial_runs uses \c operator== to test for equality.
+ *
+ *  \param first The beginning of the input range.
+ *  \param last The end of the input range.
+ *  \param offsets_output The beginning of the output range of the offset of every non-trivial run.
+ *  \param lengths_output The beginning of the output range of the length of every non-trivial run.
+ *  \return A pair of iterators at the end of the ranges <tt>[offsets_output, offsets_output_last)</tt> and
+ *          <tt>[lengths_output, lengths_output_last)</tt>.
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/concepts/equality_comparable">Equality Comparable</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p InputIterator's \c difference_type is convertible to its \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p InputIterator's \c difference_type is convertible to its \c value_type.
+ *
+ *  \see run_length_encode
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename InputIterator, typename OutputIterator1, typename OutputIterator2>
+::cuda::std::pair<OutputIterator1, OutputIterator2> non_trivial_runs(
+  InputIterator first, InputIterator last, OutputIterator1 offsets_output, OutputIterator2 lengths_output);
+
+/*! \p non_trivial_runs finds every maximal run of more than one consecutive equivalent elements in the range
+ *  <tt>[first, last)</tt>, and writes the offset of its first element from \p first to \p offsets_output and its
+ *  number of elements to \p lengths_output. Two consecutive elements are equivalent if \p binary_pred returns \c true
+ *  for them.
+ *
+ *  \param first The beginning of the input range.
+ *  \param last The end of the input range.
+ *  \param offsets_output The beginning of the output range of the offset of every non-trivial run.
+ *  \param lengths_output The beginning of the output range of the length of every non-trivial run.
+ *  \param binary_pred The equivalence relation used to compare consecutive elements.
+ *  \return A pair of iterators at the end of the ranges <tt>[offsets_output, offsets_output_last)</tt> and
+ *          <tt>[lengths_output, lengths_output_last)</tt>.
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p InputIterator's \c difference_type is convertible to its \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p InputIterator's \c difference_type is convertible to its \c value_type.
+ *  \tparam BinaryPredicate is a model of <a href="https://en.cppreference.com/w/cpp/named_req/BinaryPredicate">Binary
+ *          Predicate</a>.
+ *
+ *  \see run_length_encode
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename InputIterator, typename OutputIterator1, typename OutputIterator2, typename BinaryPredicate>
+::cuda::std::pair<OutputIterator1, OutputIterator2> non_trivial_runs(
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 offsets_output,
+  OutputIterator2 lengths_output,
+  BinaryPredicate binary_pred);
+
+/*! \} // end stream_compaction
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/run_length_encode.inl>
@@ -0,0 +1,674 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file segmented_reduce.h
+ *  \brief Reduces every segment of a range independently
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup reductions
+ *  \{
+ */
+
+/*! \p segmented_reduce reduces every segment of a range to a single value, like
+ *  \p cub::DeviceSegmentedReduce::Sum. The <tt>offsets_last - offsets_first - 1</tt> segments are delimited by the
+ *  offsets: segment \c i is <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, and its sum is written
+ *  to <tt>result[i]</tt>. An empty segment has a sum of zero.
+ *
+ *  The host systems give every thread the same number of segments plus elements, so the segments of a few huge rows
+ *  and of millions of empty ones are reduced at the same speed. The segments split among several threads are combined
+ *  afterwards, in order.
+ *
+ *  This version of \p segmented_reduce uses \c 0 as the initial value of every reduction and \c plus as the
+ *  associative operator.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range, with one element per segment.
+ *  \return The end of the output range.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type can be added and converted to \p OutputIterator's \c value_type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p OutputIterator is mutable.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_reduce to sum the rows of a sparse matrix in the CSR
+ *  format using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/segmented_reduce.h>
+ *  #include <thrust/execution_policy.h>
+ *  int values[]  = {1, 2, 3, 4, 5, 6};
+ *  int offsets[] = {0, 3, 3, 6};
+ *  int sums[3];
+ *  thrust::segmented_reduce(thrust::host, offsets, offsets + 4, values, sums);
+ *  // sums is now {6, 0, 15}
+ *  \endcode
+ *
+ *  \see reduce
+ *  \see reduce_by_key
+ *  \see segmented_inclusive_scan
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy, typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result);
+
+/*! \p segmented_reduce reduces every segment of a range to a single value. Segment \c i is
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, and its sum is written to <tt>result[i]</tt>.
+ *
+ *  This version of \p segmented_reduce uses \c 0 as the initial value of every reduction and \c plus as the
+ *  associative operator.
+ *
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range, with one element per segment.
+ *  \return The end of the output range.
+ *
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type can be added and converted to \p OutputIterator's \c value_type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p OutputIterator is mutable.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  \see reduce
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator>
+OutputIterator segmented_reduce(
+  OffsetIterator offsets_first, OffsetIterator offsets_last, RandomAccessIterator first, OutputIterator result);
+
+/*! \p segmented_reduce reduces every segment of a range to a single value. Segment \c i is
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, and its sum is written to <tt>result[i]</tt>.
+ *
+ *  This version of \p segmented_reduce uses \p init as the initial value of every reduction, which is also the sum of
+ *  an empty segment, and \c plus as the associative operator.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range, with one element per segment.
+ *  \param init The initial value of every reduction.
+ *  \return The end of the output range.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type can be added to \p T.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p OutputIterator is mutable.
+ *  \tparam T is convertible to \p OutputIterator's \c value_type.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  \see reduce
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename T>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  T init);
+
+/*! \p segmented_reduce reduces every segment of a range to a single value. Segment \c i is
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, and its sum is written to <tt>result[i]</tt>.
+ *
+ *  This version of \p segmented_reduce uses \p init as the initial value of every reduction, which is also the sum of
+ *  an empty segment, and \c plus as the associative operator.
+ *
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range, with one element per segment.
+ *  \param init The initial value of every reduction.
+ *  \return The end of the output range.
+ *
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type can be added to \p T.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p OutputIterator is mutable.
+ *  \tparam T is convertible to \p OutputIterator's \c value_type.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  \see reduce
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator, typename T>
+OutputIterator segmented_reduce(
+  OffsetIterator offsets_first, OffsetIterator offsets_last, RandomAccessIterator first, OutputIterator result, T init);
+
+/*! \p segmented_reduce reduces every segment of a range to a single value, like
+ *  \p cub::DeviceSegmentedReduce::Reduce. Segment \c i is
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, and its reduction is written to
+ *  <tt>result[i]</tt>.
+ *
+ *  This version of \p segmented_reduce uses \p init as the initial value of every reduction, which is also the
+ *  reduction of an empty segment, and \p binary_op as the associative operator. \p binary_op is not required to be
+ *  commutative.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range, with one element per segment.
+ *  \param init The initial value of every reduction.
+ *  \param binary_op The associative operator used to reduce the segments.
+ *  \return The end of the output range.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is convertible to \p T.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p OutputIterator is mutable.
+ *  \tparam T is a model of <a href="https://en.cppreference.com/w/cpp/named_req/CopyAssignable">Assignable</a>, and is
+ *          convertible to \p BinaryFunction's arguments and to \p OutputIterator's \c value_type.
+ *  \tparam BinaryFunction The function's return type must be convertible to \p T.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_reduce to find the largest element of every
+ *  segment:
+ *
+ *  \code
+ *  #include <thrust/segmented_reduce.h>
+ *  #include <thrust/execution_policy.h>
+ *  #include <cuda/std/functional>
+ *  int values[]  = {1, 9, 3, 4, 5, 6};
+ *  int offsets[] = {0, 3, 3, 6};
+ *  int maxima[3];
+ *  thrust::segmented_reduce(thrust::host, offsets, offsets + 4, values, maxima, -1, cuda::maximum<int>{});
+ *  // maxima is now {9, -1, 6}
+ *  \endcode
+ *
+ *  \see reduce
+ *  \see reduce_by_key
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op);
+
+/*! \p segmented_reduce reduces every segment of a range to a single value. Segment \c i is
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, and its reduction is written to
+ *  <tt>result[i]</tt>.
+ *
+ *  This version of \p segmented_reduce uses \p init as the initial value of every reduction, which is also the
+ *  reduction of an empty segment, and \p binary_op as the associative operator. \p binary_op is not required to be
+ *  commutative.
+ *
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range, with one element per segment.
+ *  \param init The initial value of every reduction.
+ *  \param binary_op The associative operator used to reduce the segments.
+ *  \return The end of the output range.
+ *
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is convertible to \p T.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p OutputIterator is mutable.
+ *  \tparam T is a model of <a href="https://en.cppreference.com/w/cpp/named_req/CopyAssignable">Assignable</a>, and is
+ *          convertible to \p BinaryFunction's arguments and to \p OutputIterator's \c value_type.
+ *  \tparam BinaryFunction The function's return type must be convertible to \p T.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  \see reduce
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+OutputIterator segmented_reduce(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op);
+
+/*! \p segmented_arg_min finds the first smallest element of every segment of a range, like
+ *  \p cub::DeviceSegmentedReduce::ArgMin. Segment \c i is
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, and the position of its first smallest element
+ *  relative to the beginning of the segment is written to <tt>result[i]</tt>. Like \p min_element, which returns the
+ *  end of an empty range, an empty segment yields \c 0.
+ *
+ *  This version of \p segmented_arg_min compares objects using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range, with one position per segment.
+ *  \return The end of the output range.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">
+ *          LessThan Comparable</a>.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, \p OutputIterator is mutable, and its \c value_type is an integral type.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_arg_min using the \p thrust::host execution policy
+ *  for parallelization:
+ *
+ *  \code
+ *  #include <thrust/segmented_reduce.h>
+ *  #include <thrust/execution_policy.h>
+ *  int values[]  = {4, 1, 1, 7, 5, 2};
+ *  int offsets[] = {0, 3, 3, 6};
+ *  int positions[3];
+ *  thrust::segmented_arg_min(thrust::host, offsets, offsets + 4, values, positions);
+ *  // positions is now {1, 0, 2}
+ *  \endcode
+ *
+ *  \see min_element
+ *  \see segmented_arg_max
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy, typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator segmented_arg_min(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result);
+
+/*! \p segmented_arg_min finds the first smallest element of every segment of a range. Segment \c i is
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, and the position of its first smallest element
+ *  relative to the beginning of the segment is written to <tt>result[i]</tt>. An empty segment yields \c 0.
+ *
+ *  This version of \p segmented_arg_min compares objects using \c operator<.
+ *
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range, with one position per segment.
+ *  \return The end of the output range.
+ *
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">
+ *          LessThan Comparable</a>.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, \p OutputIterator is mutable, and its \c value_type is an integral type.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  \see min_element
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator>
+OutputIterator segmented_arg_min(
+  OffsetIterator offsets_first, OffsetIterator offsets_last, RandomAccessIterator first, OutputIterator result);
+
+/*! \p segmented_arg_min finds the first element of every segment of a range that no other element of the segment
+ *  comes before in the order \p comp. Segment \c i is
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, and the position of that element relative to the
+ *  beginning of the segment is written to <tt>result[i]</tt>. An empty segment yields \c 0.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range, with one position per segment.
+ *  \param comp The comparison operator, which returns \c true if its first argument comes before its second argument.
+ *  \return The end of the output range.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is convertible to \p StrictWeakOrdering's arguments.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, \p OutputIterator is mutable, and its \c value_type is an integral type.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">
+ *          Strict Weak Ordering</a>.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  \see min_element
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator segmented_arg_min(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  StrictWeakOrdering comp);
+
+/*! \p segmented_arg_min finds the first element of every segment of a range that no other element of the segment
+ *  comes before in the order \p comp. Segment \c i is
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, and the position of that element relative to the
+ *  beginning of the segment is written to <tt>result[i]</tt>. An empty segment yields \c 0.
+ *
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range, with one position per segment.
+ *  \param comp The comparison operator, which returns \c true if its first argument comes before its second argument.
+ *  \return The end of the output range.
+ *
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is convertible to \p StrictWeakOrdering's arguments.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, \p OutputIterator is mutable, and its \c value_type is an integral type.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">
+ *          Strict Weak Ordering</a>.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  \see min_element
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator, typename StrictWeakOrdering>
+OutputIterator segmented_arg_min(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  StrictWeakOrdering comp);
+
+/*! \p segmented_arg_max finds the first largest element of every segment of a range, like
+ *  \p cub::DeviceSegmentedReduce::ArgMax. Segment \c i is
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, and the position of its first largest element
+ *  relative to the beginning of the segment is written to <tt>result[i]</tt>. Like \p max_element, which returns the
+ *  end of an empty range, an empty segment yields \c 0.
+ *
+ *  This version of \p segmented_arg_max compares objects using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range, with one position per segment.
+ *  \return The end of the output range.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">
+ *          LessThan Comparable</a>.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, \p OutputIterator is mutable, and its \c value_type is an integral type.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_arg_max using the \p thrust::host execution policy
+ *  for parallelization:
+ *
+ *  \code
+ *  #include <thrust/segmented_reduce.h>
+ *  #include <thrust/execution_policy.h>
+ *  int values[]  = {4, 7, 7, 1, 5, 2};
+ *  int offsets[] = {0, 3, 3, 6};
+ *  int positions[3];
+ *  thrust::segmented_arg_max(thrust::host, offsets, offsets + 4, values, positions);
+ *  // positions is now {1, 0, 1}
+ *  \endcode
+ *
+ *  \see max_element
+ *  \see segmented_arg_min
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy, typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator segmented_arg_max(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result);
+
+/*! \p segmented_arg_max finds the first largest element of every segment of a range. Segment \c i is
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, and the position of its first largest element
+ *  relative to the beginning of the segment is written to <tt>result[i]</tt>. An empty segment yields \c 0.
+ *
+ *  This version of \p segmented_arg_max compares objects using \c operator<.
+ *
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range, with one position per segment.
+ *  \return The end of the output range.
+ *
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">
+ *          LessThan Comparable</a>.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, \p OutputIterator is mutable, and its \c value_type is an integral type.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  \see max_element
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator>
+OutputIterator segmented_arg_max(
+  OffsetIterator offsets_first, OffsetIterator offsets_last, RandomAccessIterator first, OutputIterator result);
+
+/*! \p segmented_arg_max finds the first element of every segment of a range that comes before no other element of
+ *  the segment in the order \p comp. Segment \c i is <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>,
+ *  and the position of that element relative to the beginning of the segment is written to <tt>result[i]</tt>. An
+ *  empty segment yields \c 0.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range, with one position per segment.
+ *  \param comp The comparison operator, which returns \c true if its first argument comes before its second argument.
+ *  \return The end of the output range.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is convertible to \p StrictWeakOrdering's arguments.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, \p OutputIterator is mutable, and its \c value_type is an integral type.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">
+ *          Strict Weak Ordering</a>.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  \see max_element
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator segmented_arg_max(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  StrictWeakOrdering comp);
+
+/*! \p segmented_arg_max finds the first element of every segment of a range that comes before no other element of
+ *  the segment in the order \p comp. Segment \c i is <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>,
+ *  and the position of that element relative to the beginning of the segment is written to <tt>result[i]</tt>. An
+ *  empty segment yields \c 0.
+ *
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range, with one position per segment.
+ *  \param comp The comparison operator, which returns \c true if its first argument comes before its second argument.
+ *  \return The end of the output range.
+ *
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is convertible to \p StrictWeakOrdering's arguments.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, \p OutputIterator is mutable, and its \c value_type is an integral type.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">
+ *          Strict Weak Ordering</a>.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  \see max_element
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator, typename StrictWeakOrdering>
+OutputIterator segmented_arg_max(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  StrictWeakOrdering comp);
+
+/*! \} // end reductions
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/segmented_reduce.inl>
@@ -0,0 +1,506 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file segmented_scan.h
+ *  \brief Computes the prefix sums of every segment of a range independently
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup algorithms
+ */
+
+/*! \addtogroup prefixsums Prefix Sums
+ *  \ingroup algorithms
+ *  \{
+ */
+
+/*! \p segmented_inclusive_scan computes an inclusive prefix sum of every segment of a range. The
+ *  <tt>offsets_last - offsets_first - 1</tt> segments are delimited by the offsets: segment \c i is
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, and its scan is written to the same positions
+ *  of the output range. It produces the same result as an \p inclusive_scan_by_key with a key per segment, but
+ *  without the keys.
+ *
+ *  The host systems give every thread the same number of segments plus elements, so the segments of a few huge rows
+ *  and of millions of tiny ones are scanned at the same speed. Each thread first reduces the piece of a segment that
+ *  it shares with the next thread, then scans its elements from the prefixes of these pieces.
+ *
+ *  This version of \p segmented_inclusive_scan uses \c plus as the associative operator. The elements outside of the
+ *  segments are not written. \p first may equal \p result.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range.
+ *  \return The end of the output of the last segment.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type can be added and converted to \p OutputIterator's \c value_type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p OutputIterator is mutable.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_inclusive_scan using the \p thrust::host execution
+ *  policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/segmented_scan.h>
+ *  #include <thrust/execution_policy.h>
+ *  int data[]    = {1, 2, 3, 4, 5, 6};
+ *  int offsets[] = {0, 3, 3, 6};
+ *  thrust::segmented_inclusive_scan(thrust::host, offsets, offsets + 4, data, data); // in-place scan
+ *  // data is now {1, 3, 6, 4, 9, 15}
+ *  \endcode
+ *
+ *  \see inclusive_scan
+ *  \see inclusive_scan_by_key
+ *  \see segmented_reduce
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy, typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator segmented_inclusive_scan(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result);
+
+/*! \p segmented_inclusive_scan computes an inclusive prefix sum of every segment of a range. Segment \c i is
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, and its scan is written to the same positions
+ *  of the output range.
+ *
+ *  This version of \p segmented_inclusive_scan uses \c plus as the associative operator. The elements outside of the
+ *  segments are not written. \p first may equal \p result.
+ *
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range.
+ *  \return The end of the output of the last segment.
+ *
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type can be added and converted to \p OutputIterator's \c value_type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p OutputIterator is mutable.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  \see inclusive_scan
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator>
+OutputIterator segmented_inclusive_scan(
+  OffsetIterator offsets_first, OffsetIterator offsets_last, RandomAccessIterator first, OutputIterator result);
+
+/*! \p segmented_inclusive_scan computes an inclusive prefix sum of every segment of a range. Segment \c i is
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, and its scan is written to the same positions
+ *  of the output range.
+ *
+ *  This version of \p segmented_inclusive_scan uses \p binary_op as the associative operator, which is not required
+ *  to be commutative. The elements outside of the segments are not written. \p first may equal \p result.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range.
+ *  \param binary_op The associative operator used to scan the segments.
+ *  \return The end of the output of the last segment.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is convertible to \p BinaryFunction's arguments and to \p OutputIterator's
+ *          \c value_type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p OutputIterator is mutable.
+ *  \tparam BinaryFunction The function's return type must be convertible to \p RandomAccessIterator's
+ *          \c value_type.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_inclusive_scan to compute the running maximum of
+ *  every segment:
+ *
+ *  \code
+ *  #include <thrust/segmented_scan.h>
+ *  #include <thrust/execution_policy.h>
+ *  #include <cuda/std/functional>
+ *  int data[]    = {1, 0, 2, 2, 1, 3};
+ *  int offsets[] = {0, 3, 3, 6};
+ *  thrust::segmented_inclusive_scan(thrust::host, offsets, offsets + 4, data, data, cuda::maximum<int>{});
+ *  // data is now {1, 1, 2, 2, 2, 3}
+ *  \endcode
+ *
+ *  \see inclusive_scan
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename BinaryFunction>
+_CCCL_HOST_DEVICE OutputIterator segmented_inclusive_scan(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  BinaryFunction binary_op);
+
+/*! \p segmented_inclusive_scan computes an inclusive prefix sum of every segment of a range. Segment \c i is
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, and its scan is written to the same positions
+ *  of the output range.
+ *
+ *  This version of \p segmented_inclusive_scan uses \p binary_op as the associative operator, which is not required
+ *  to be commutative. The elements outside of the segments are not written. \p first may equal \p result.
+ *
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range.
+ *  \param binary_op The associative operator used to scan the segments.
+ *  \return The end of the output of the last segment.
+ *
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is convertible to \p BinaryFunction's arguments and to \p OutputIterator's
+ *          \c value_type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p OutputIterator is mutable.
+ *  \tparam BinaryFunction The function's return type must be convertible to \p RandomAccessIterator's
+ *          \c value_type.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  \see inclusive_scan
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator, typename BinaryFunction>
+OutputIterator segmented_inclusive_scan(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  BinaryFunction binary_op);
+
+/*! \p segmented_exclusive_scan computes an exclusive prefix sum of every segment of a range. The
+ *  <tt>offsets_last - offsets_first - 1</tt> segments are delimited by the offsets: segment \c i is
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, and its scan is written to the same positions
+ *  of the output range. It produces the same result as an \p exclusive_scan_by_key with a key per segment, but
+ *  without the keys.
+ *
+ *  This version of \p segmented_exclusive_scan uses \c 0 as the initial value of every scan and \c plus as the
+ *  associative operator. The elements outside of the segments are not written. \p first may equal \p result.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range.
+ *  \return The end of the output of the last segment.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type can be added and converted to \p OutputIterator's \c value_type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p OutputIterator is mutable.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_exclusive_scan to turn the sizes of the rows of
+ *  every matrix of a batch into the offsets of the rows in their matrix:
+ *
+ *  \code
+ *  #include <thrust/segmented_scan.h>
+ *  #include <thrust/execution_policy.h>
+ *  int sizes[]   = {1, 2, 3, 4, 5, 6};
+ *  int offsets[] = {0, 3, 3, 6};
+ *  thrust::segmented_exclusive_scan(thrust::host, offsets, offsets + 4, sizes, sizes); // in-place scan
+ *  // sizes is now {0, 1, 3, 0, 4, 9}
+ *  \endcode
+ *
+ *  \see exclusive_scan
+ *  \see exclusive_scan_by_key
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy, typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator segmented_exclusive_scan(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result);
+
+/*! \p segmented_exclusive_scan computes an exclusive prefix sum of every segment of a range. Segment \c i is
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, and its scan is written to the same positions
+ *  of the output range.
+ *
+ *  This version of \p segmented_exclusive_scan uses \c 0 as the initial value of every scan and \c plus as the
+ *  associative operator. The elements outside of the segments are not written. \p first may equal \p result.
+ *
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range.
+ *  \return The end of the output of the last segment.
+ *
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type can be added and converted to \p OutputIterator's \c value_type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p OutputIterator is mutable.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  \see exclusive_scan
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator>
+OutputIterator segmented_exclusive_scan(
+  OffsetIterator offsets_first, OffsetIterator offsets_last, RandomAccessIterator first, OutputIterator result);
+
+/*! \p segmented_exclusive_scan computes an exclusive prefix sum of every segment of a range. Segment \c i is
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, and its scan is written to the same positions
+ *  of the output range.
+ *
+ *  This version of \p segmented_exclusive_scan uses \p init as the initial value of every scan and \c plus as the
+ *  associative operator. The elements outside of the segments are not written. \p first may equal \p result.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range.
+ *  \param init The initial value of every scan.
+ *  \return The end of the output of the last segment.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type can be added to \p T.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p OutputIterator is mutable.
+ *  \tparam T is convertible to \p OutputIterator's \c value_type.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  \see exclusive_scan
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename T>
+_CCCL_HOST_DEVICE OutputIterator segmented_exclusive_scan(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  T init);
+
+/*! \p segmented_exclusive_scan computes an exclusive prefix sum of every segment of a range. Segment \c i is
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, and its scan is written to the same positions
+ *  of the output range.
+ *
+ *  This version of \p segmented_exclusive_scan uses \p init as the initial value of every scan and \c plus as the
+ *  associative operator. The elements outside of the segments are not written. \p first may equal \p result.
+ *
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range.
+ *  \param init The initial value of every scan.
+ *  \return The end of the output of the last segment.
+ *
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type can be added to \p T.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p OutputIterator is mutable.
+ *  \tparam T is convertible to \p OutputIterator's \c value_type.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  \see exclusive_scan
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator, typename T>
+OutputIterator segmented_exclusive_scan(
+  OffsetIterator offsets_first, OffsetIterator offsets_last, RandomAccessIterator first, OutputIterator result, T init);
+
+/*! \p segmented_exclusive_scan computes an exclusive prefix sum of every segment of a range. Segment \c i is
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, and its scan is written to the same positions
+ *  of the output range.
+ *
+ *  This version of \p segmented_exclusive_scan uses \p init as the initial value of every scan and \p binary_op as
+ *  the associative operator, which is not required to be commutative. The elements outside of the segments are not
+ *  written. \p first may equal \p result.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range.
+ *  \param init The initial value of every scan.
+ *  \param binary_op The associative operator used to scan the segments.
+ *  \return The end of the output of the last segment.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is convertible to \p BinaryFunction's second argument.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p OutputIterator is mutable.
+ *  \tparam T is convertible to \p BinaryFunction's first argument and to \p OutputIterator's \c value_type.
+ *  \tparam BinaryFunction The function's return type must be convertible to \p T.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  \see exclusive_scan
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+_CCCL_HOST_DEVICE OutputIterator segmented_exclusive_scan(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op);
+
+/*! \p segmented_exclusive_scan computes an exclusive prefix sum of every segment of a range. Segment \c i is
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, and its scan is written to the same positions
+ *  of the output range.
+ *
+ *  This version of \p segmented_exclusive_scan uses \p init as the initial value of every scan and \p binary_op as
+ *  the associative operator, which is not required to be commutative. The elements outside of the segments are not
+ *  written. \p first may equal \p result.
+ *
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range.
+ *  \param init The initial value of every scan.
+ *  \param binary_op The associative operator used to scan the segments.
+ *  \return The end of the output of the last segment.
+ *
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is convertible to \p BinaryFunction's second argument.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p OutputIterator is mutable.
+ *  \tparam T is convertible to \p BinaryFunction's first argument and to \p OutputIterator's \c value_type.
+ *  \tparam BinaryFunction The function's return type must be convertible to \p T.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  \see exclusive_scan
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+OutputIterator segmented_exclusive_scan(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op);
+
+/*! \} // end prefixsums
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/segmented_scan.inl>
@@ -0,0 +1,737 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file segmented_sort.h
+ *  \brief Sorts every segment of a range independently
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup sorting
+ *  \ingroup algorithms
+ *  \{
+ */
+
+/*! \p segmented_sort sorts every segment of a range into ascending order, like \p cub::DeviceSegmentedSort::SortKeys.
+ *  The <tt>offsets_last - offsets_first - 1</tt> segments are delimited by the offsets: segment \c i is
+ *  <tt>[keys_first + offsets_first[i], keys_first + offsets_first[i + 1])</tt>. It produces the same result as a
+ *  \p sort of every segment, but without sorting the whole range by segment and key.
+ *
+ *  The host systems sort the segments in batches of about the same number of elements, so that a few large segments
+ *  among many small ones do not leave threads idle. Segments of a few elements are sorted by insertion, and the
+ *  segments larger than the share of a single thread are sorted one after the other with the parallel \p sort.
+ *
+ *  The relative order of equivalent elements is not guaranteed to be preserved. This version of \p segmented_sort
+ *  compares objects using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param keys_first The beginning of the range of keys.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable, and its \c value_type is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_sort using the \p thrust::host execution policy
+ *  for parallelization:
+ *
+ *  \code
+ *  #include <thrust/segmented_sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  int A[]       = {1, 9, 4, 7, 2, 9, 3};
+ *  int offsets[] = {0, 4, 5, 7};
+ *  thrust::segmented_sort(thrust::host, offsets, offsets + 4, A);
+ *  // A is now {1, 4, 7, 9, 2, 3, 9}
+ *  \endcode
+ *
+ *  \see sort
+ *  \see segmented_stable_sort
+ *  \see segmented_sort_by_key
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy, typename OffsetIterator, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void segmented_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator keys_first);
+
+/*! \p segmented_sort sorts every segment of a range into ascending order. Segment \c i is
+ *  <tt>[keys_first + offsets_first[i], keys_first + offsets_first[i + 1])</tt>.
+ *
+ *  The relative order of equivalent elements is not guaranteed to be preserved. This version of \p segmented_sort
+ *  compares objects using \c operator<.
+ *
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param keys_first The beginning of the range of keys.
+ *
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable, and its \c value_type is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  \see sort
+ *  \see segmented_stable_sort
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename OffsetIterator, typename RandomAccessIterator>
+void segmented_sort(OffsetIterator offsets_first, OffsetIterator offsets_last, RandomAccessIterator keys_first);
+
+/*! \p segmented_sort sorts every segment of a range into the order \p comp. Segment \c i is
+ *  <tt>[keys_first + offsets_first[i], keys_first + offsets_first[i + 1])</tt>.
+ *
+ *  The relative order of equivalent elements is not guaranteed to be preserved.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param keys_first The beginning of the range of keys.
+ *  \param comp The comparison operator, which returns \c true if its first argument comes before its second argument.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable, and its \c value_type is convertible to \p StrictWeakOrdering's
+ *          arguments.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">
+ *          Strict Weak Ordering</a>.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_sort to sort every segment into descending order:
+ *
+ *  \code
+ *  #include <thrust/segmented_sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  #include <cuda/std/functional>
+ *  int A[]       = {1, 9, 4, 7, 2, 9, 3};
+ *  int offsets[] = {0, 4, 5, 7};
+ *  thrust::segmented_sort(thrust::host, offsets, offsets + 4, A, cuda::std::greater<int>{});
+ *  // A is now {9, 7, 4, 1, 2, 9, 3}
+ *  \endcode
+ *
+ *  \see sort
+ *  \see segmented_stable_sort
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy, typename OffsetIterator, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator keys_first,
+  StrictWeakOrdering comp);
+
+/*! \p segmented_sort sorts every segment of a range into the order \p comp. Segment \c i is
+ *  <tt>[keys_first + offsets_first[i], keys_first + offsets_first[i + 1])</tt>.
+ *
+ *  The relative order of equivalent elements is not guaranteed to be preserved.
+ *
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param keys_first The beginning of the range of keys.
+ *  \param comp The comparison operator, which returns \c true if its first argument comes before its second argument.
+ *
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable, and its \c value_type is convertible to \p StrictWeakOrdering's
+ *          arguments.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">
+ *          Strict Weak Ordering</a>.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  \see sort
+ *  \see segmented_stable_sort
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename OffsetIterator, typename RandomAccessIterator, typename StrictWeakOrdering>
+void segmented_sort(
+  OffsetIterator offsets_first, OffsetIterator offsets_last, RandomAccessIterator keys_first, StrictWeakOrdering comp);
+
+/*! \p segmented_stable_sort sorts every segment of a range into ascending order, like
+ *  \p cub::DeviceSegmentedSort::StableSortKeys. Segment \c i is
+ *  <tt>[keys_first + offsets_first[i], keys_first + offsets_first[i + 1])</tt>.
+ *
+ *  \p segmented_stable_sort is stable: equivalent elements keep their relative order. This version of
+ *  \p segmented_stable_sort compares objects using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param keys_first The beginning of the range of keys.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable, and its \c value_type is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  \see stable_sort
+ *  \see segmented_sort
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy, typename OffsetIterator, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void segmented_stable_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator keys_first);
+
+/*! \p segmented_stable_sort sorts every segment of a range into ascending order. Segment \c i is
+ *  <tt>[keys_first + offsets_first[i], keys_first + offsets_first[i + 1])</tt>.
+ *
+ *  \p segmented_stable_sort is stable: equivalent elements keep their relative order. This version of
+ *  \p segmented_stable_sort compares objects using \c operator<.
+ *
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param keys_first The beginning of the range of keys.
+ *
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable, and its \c value_type is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  \see stable_sort
+ *  \see segmented_sort
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename OffsetIterator, typename RandomAccessIterator>
+void segmented_stable_sort(OffsetIterator offsets_first, OffsetIterator offsets_last, RandomAccessIterator keys_first);
+
+/*! \p segmented_stable_sort sorts every segment of a range into the order \p comp. Segment \c i is
+ *  <tt>[keys_first + offsets_first[i], keys_first + offsets_first[i + 1])</tt>.
+ *
+ *  \p segmented_stable_sort is stable: equivalent elements keep their relative order.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param keys_first The beginning of the range of keys.
+ *  \param comp The comparison operator, which returns \c true if its first argument comes before its second argument.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable, and its \c value_type is convertible to \p StrictWeakOrdering's
+ *          arguments.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">
+ *          Strict Weak Ordering</a>.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  \see stable_sort
+ *  \see segmented_sort
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy, typename OffsetIterator, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_stable_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator keys_first,
+  StrictWeakOrdering comp);
+
+/*! \p segmented_stable_sort sorts every segment of a range into the order \p comp. Segment \c i is
+ *  <tt>[keys_first + offsets_first[i], keys_first + offsets_first[i + 1])</tt>.
+ *
+ *  \p segmented_stable_sort is stable: equivalent elements keep their relative order.
+ *
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param keys_first The beginning of the range of keys.
+ *  \param comp The comparison operator, which returns \c true if its first argument comes before its second argument.
+ *
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable, and its \c value_type is convertible to \p StrictWeakOrdering's
+ *          arguments.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">
+ *          Strict Weak Ordering</a>.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *
+ *  \see stable_sort
+ *  \see segmented_sort
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename OffsetIterator, typename RandomAccessIterator, typename StrictWeakOrdering>
+void segmented_stable_sort(
+  OffsetIterator offsets_first, OffsetIterator offsets_last, RandomAccessIterator keys_first, StrictWeakOrdering comp);
+
+/*! \p segmented_sort_by_key sorts the keys of every segment into ascending order, and the values along with them,
+ *  like \p cub::DeviceSegmentedSort::SortPairs. Segment \c i is the keys
+ *  <tt>[keys_first + offsets_first[i], keys_first + offsets_first[i + 1])</tt> and the values at the same positions
+ *  from \p values_first.
+ *
+ *  The relative order of equivalent keys is not guaranteed to be preserved. This version of \p segmented_sort_by_key
+ *  compares keys using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param keys_first The beginning of the range of keys.
+ *  \param values_first The beginning of the range of values.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator1 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable, and its \c value_type is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>.
+ *  \tparam RandomAccessIterator2 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2 is mutable.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *  \pre The range of keys shall not overlap the range of values.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_sort_by_key using the \p thrust::host execution
+ *  policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/segmented_sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  int keys[]    = {1, 9, 4, 7, 2, 9, 3};
+ *  char values[] = {'a', 'b', 'c', 'd', 'e', 'f', 'g'};
+ *  int offsets[] = {0, 4, 5, 7};
+ *  thrust::segmented_sort_by_key(thrust::host, offsets, offsets + 4, keys, values);
+ *  // keys is now   {  1,   4,   7,   9,   2,   3,   9}
+ *  // values is now {'a', 'c', 'd', 'b', 'e', 'g', 'f'}
+ *  \endcode
+ *
+ *  \see sort_by_key
+ *  \see segmented_stable_sort_by_key
+ *  \see segmented_sort
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2>
+_CCCL_HOST_DEVICE void segmented_sort_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first);
+
+/*! \p segmented_sort_by_key sorts the keys of every segment into ascending order, and the values along with them.
+ *  Segment \c i is the keys <tt>[keys_first + offsets_first[i], keys_first + offsets_first[i + 1])</tt> and the values
+ *  at the same positions from \p values_first.
+ *
+ *  The relative order of equivalent keys is not guaranteed to be preserved. This version of \p segmented_sort_by_key
+ *  compares keys using \c operator<.
+ *
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param keys_first The beginning of the range of keys.
+ *  \param values_first The beginning of the range of values.
+ *
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator1 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable, and its \c value_type is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>.
+ *  \tparam RandomAccessIterator2 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2 is mutable.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *  \pre The range of keys shall not overlap the range of values.
+ *
+ *  \see sort_by_key
+ *  \see segmented_stable_sort_by_key
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename OffsetIterator, typename RandomAccessIterator1, typename RandomAccessIterator2>
+void segmented_sort_by_key(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first);
+
+/*! \p segmented_sort_by_key sorts the keys of every segment into the order \p comp, and the values along with them.
+ *  Segment \c i is the keys <tt>[keys_first + offsets_first[i], keys_first + offsets_first[i + 1])</tt> and the values
+ *  at the same positions from \p values_first.
+ *
+ *  The relative order of equivalent keys is not guaranteed to be preserved.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param keys_first The beginning of the range of keys.
+ *  \param values_first The beginning of the range of values.
+ *  \param comp The comparison operator, which returns \c true if its first argument comes before its second argument.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator1 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable, and its \c value_type is convertible to \p StrictWeakOrdering's
+ *          arguments.
+ *  \tparam RandomAccessIterator2 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2 is mutable.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">
+ *          Strict Weak Ordering</a>.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *  \pre The range of keys shall not overlap the range of values.
+ *
+ *  \see sort_by_key
+ *  \see segmented_stable_sort_by_key
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp);
+
+/*! \p segmented_sort_by_key sorts the keys of every segment into the order \p comp, and the values along with them.
+ *  Segment \c i is the keys <tt>[keys_first + offsets_first[i], keys_first + offsets_first[i + 1])</tt> and the values
+ *  at the same positions from \p values_first.
+ *
+ *  The relative order of equivalent keys is not guaranteed to be preserved.
+ *
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param keys_first The beginning of the range of keys.
+ *  \param values_first The beginning of the range of values.
+ *  \param comp The comparison operator, which returns \c true if its first argument comes before its second argument.
+ *
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator1 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable, and its \c value_type is convertible to \p StrictWeakOrdering's
+ *          arguments.
+ *  \tparam RandomAccessIterator2 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2 is mutable.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">
+ *          Strict Weak Ordering</a>.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *  \pre The range of keys shall not overlap the range of values.
+ *
+ *  \see sort_by_key
+ *  \see segmented_stable_sort_by_key
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void segmented_sort_by_key(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp);
+
+/*! \p segmented_stable_sort_by_key sorts the keys of every segment into ascending order, and the values along with
+ *  them, like \p cub::DeviceSegmentedSort::StableSortPairs. Segment \c i is the keys
+ *  <tt>[keys_first + offsets_first[i], keys_first + offsets_first[i + 1])</tt> and the values at the same positions
+ *  from \p values_first.
+ *
+ *  \p segmented_stable_sort_by_key is stable: equivalent keys keep their relative order. This version of
+ *  \p segmented_stable_sort_by_key compares keys using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param keys_first The beginning of the range of keys.
+ *  \param values_first The beginning of the range of values.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator1 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable, and its \c value_type is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>.
+ *  \tparam RandomAccessIterator2 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2 is mutable.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *  \pre The range of keys shall not overlap the range of values.
+ *
+ *  \see stable_sort_by_key
+ *  \see segmented_sort_by_key
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2>
+_CCCL_HOST_DEVICE void segmented_stable_sort_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first);
+
+/*! \p segmented_stable_sort_by_key sorts the keys of every segment into ascending order, and the values along with
+ *  them. Segment \c i is the keys <tt>[keys_first + offsets_first[i], keys_first + offsets_first[i + 1])</tt> and the
+ *  values at the same positions from \p values_first.
+ *
+ *  \p segmented_stable_sort_by_key is stable: equivalent keys keep their relative order. This version of
+ *  \p segmented_stable_sort_by_key compares keys using \c operator<.
+ *
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param keys_first The beginning of the range of keys.
+ *  \param values_first The beginning of the range of values.
+ *
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator1 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable, and its \c value_type is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>.
+ *  \tparam RandomAccessIterator2 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2 is mutable.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *  \pre The range of keys shall not overlap the range of values.
+ *
+ *  \see stable_sort_by_key
+ *  \see segmented_sort_by_key
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename OffsetIterator, typename RandomAccessIterator1, typename RandomAccessIterator2>
+void segmented_stable_sort_by_key(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first);
+
+/*! \p segmented_stable_sort_by_key sorts the keys of every segment into the order \p comp, and the values along with
+ *  them. Segment \c i is the keys <tt>[keys_first + offsets_first[i], keys_first + offsets_first[i + 1])</tt> and the
+ *  values at the same positions from \p values_first.
+ *
+ *  \p segmented_stable_sort_by_key is stable: equivalent keys keep their relative order.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param keys_first The beginning of the range of keys.
+ *  \param values_first The beginning of the range of values.
+ *  \param comp The comparison operator, which returns \c true if its first argument comes before its second argument.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator1 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable, and its \c value_type is convertible to \p StrictWeakOrdering's
+ *          arguments.
+ *  \tparam RandomAccessIterator2 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2 is mutable.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">
+ *          Strict Weak Ordering</a>.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *  \pre The range of keys shall not overlap the range of values.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_stable_sort_by_key to order the events of every
+ *  user by time, keeping events at the same time in the order they were recorded:
+ *
+ *  \code
+ *  #include <thrust/segmented_sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  #include <cuda/std/functional>
+ *  int times[]   = {5, 3, 5, 1, 8, 8};
+ *  int events[]  = {0, 1, 2, 3, 4, 5};
+ *  int offsets[] = {0, 4, 6};
+ *  thrust::segmented_stable_sort_by_key(thrust::host, offsets, offsets + 3, times, events, cuda::std::less<int>{});
+ *  // times is now  {1, 3, 5, 5, 8, 8}
+ *  // events is now {3, 1, 0, 2, 4, 5}
+ *  \endcode
+ *
+ *  \see stable_sort_by_key
+ *  \see segmented_sort_by_key
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_stable_sort_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp);
+
+/*! \p segmented_stable_sort_by_key sorts the keys of every segment into the order \p comp, and the values along with
+ *  them. Segment \c i is the keys <tt>[keys_first + offsets_first[i], keys_first + offsets_first[i + 1])</tt> and the
+ *  values at the same positions from \p values_first.
+ *
+ *  \p segmented_stable_sort_by_key is stable: equivalent keys keep their relative order.
+ *
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param keys_first The beginning of the range of keys.
+ *  \param values_first The beginning of the range of values.
+ *  \param comp The comparison operator, which returns \c true if its first argument comes before its second argument.
+ *
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator1 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable, and its \c value_type is convertible to \p StrictWeakOrdering's
+ *          arguments.
+ *  \tparam RandomAccessIterator2 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2 is mutable.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">
+ *          Strict Weak Ordering</a>.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *  \pre The range of keys shall not overlap the range of values.
+ *
+ *  \see stable_sort_by_key
+ *  \see segmented_sort_by_key
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void segmented_stable_sort_by_key(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp);
+
+/*! \} // end sorting
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/segmented_sort.inl>
@@ -32,7 +32,8 @@ THRUST_NAMESPACE_BEGIN
 /*! \p shuffle reorders the elements <tt>[first, last)</tt> by a uniform pseudorandom permutation, defined by
  *  random engine \p g.
  *
- *  The algorithm's execution is parallelized as determined by \p exec.
+ *  The algorithm's execution is parallelized as determined by \p exec. The permutation produced for a given \p g may
+ *  differ between systems. The OpenMP and TBB systems produce the same permutation regardless of the number of threads.
  *
  *  \param exec The execution policy to use for parallelization.
  *  \param first The beginning of the sequence to shuffle.
@@ -103,7 +104,8 @@ _CCCL_HOST_DEVICE void shuffle(RandomIterator first, RandomIterator last, URBG&&
  *  \p shuffle_copy reorders the elements <tt>[first, last)</tt> by a uniform pseudorandom permutation, defined by
  *  random engine \p g.
  *
- *  The algorithm's execution is parallelized as determined by \p exec.
+ *  The algorithm's execution is parallelized as determined by \p exec. The permutation produced for a given \p g may
+ *  differ between systems. The OpenMP and TBB systems produce the same permutation regardless of the number of threads.
 
  *  \param exec The execution policy to use for parallelization.
  *  \param first The beginning of the sequence to shuffle.
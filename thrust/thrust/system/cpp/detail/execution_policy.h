@@ -13,6 +13,7 @@
 #endif // no system header
 
 #include <thrust/detail/allocator_aware_execution_policy.h>
+#include <thrust/detail/execute_with_env.h>
 #include <thrust/system/cpp/detail/execution_policy.h>
 #include <thrust/system/detail/sequential/execution_policy.h>
 
@@ -51,7 +52,16 @@ struct execution_policy : system::detail::sequential::execution_policy<Derived>
 struct par_t
     : execution_policy<par_t>
     , thrust::detail::allocator_aware_execution_policy<execution_policy>
-{};
+{
+  //! Returns a policy that also carries the environment \p env. For example, \p thrust::topk invoked with
+  //! <tt>thrust::cpp::par.with(cuda::execution::require(cuda::execution::output_ordering::unsorted))</tt> may write
+  //! its results in any order.
+  template <typename Env>
+  thrust::detail::execute_with_env<Env, execution_policy> with(Env env) const
+  {
+    return thrust::detail::execute_with_env<Env, execution_policy>(env);
+  }
+};
 } // namespace detail
 
 //! \addtogroup execution_policies
@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/detail/generic/tag.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::generic
+{
+template <typename ExecutionPolicy,
+          typename InputRangeIterator,
+          typename OutputRangeIterator,
+          typename SizeIterator,
+          typename Size>
+_CCCL_HOST_DEVICE void batched_copy(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  InputRangeIterator input_ranges_first,
+  OutputRangeIterator output_ranges_first,
+  SizeIterator sizes_first,
+  Size num_ranges);
+
+template <typename ExecutionPolicy,
+          typename InputBufferIterator,
+          typename OutputBufferIterator,
+          typename SizeIterator,
+          typename Size>
+_CCCL_HOST_DEVICE void batched_memcpy(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  InputBufferIterator input_buffers_first,
+  OutputBufferIterator output_buffers_first,
+  SizeIterator sizes_first,
+  Size num_buffers);
+} // namespace system::detail::generic
+THRUST_NAMESPACE_END
+
+#include <thrust/system/detail/generic/batched_copy.inl>
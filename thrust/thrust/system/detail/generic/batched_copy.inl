@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/batched_copy.h>
+#include <thrust/copy.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/batched_copy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::generic
+{
+template <typename ExecutionPolicy,
+          typename InputRangeIterator,
+          typename OutputRangeIterator,
+          typename SizeIterator,
+          typename Size>
+_CCCL_HOST_DEVICE void batched_copy(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  InputRangeIterator input_ranges_first,
+  OutputRangeIterator output_ranges_first,
+  SizeIterator sizes_first,
+  Size num_ranges)
+{
+  using InputIterator  = thrust::detail::it_value_t<InputRangeIterator>;
+  using OutputIterator = thrust::detail::it_value_t<OutputRangeIterator>;
+
+  // copy every range on its own
+  for (Size i = 0; i < num_ranges; ++i)
+  {
+    const InputIterator input   = input_ranges_first[i];
+    const OutputIterator output = output_ranges_first[i];
+    thrust::copy_n(exec, input, sizes_first[i], output);
+  }
+} // end batched_copy()
+
+template <typename ExecutionPolicy,
+          typename InputBufferIterator,
+          typename OutputBufferIterator,
+          typename SizeIterator,
+          typename Size>
+_CCCL_HOST_DEVICE void batched_memcpy(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  InputBufferIterator input_buffers_first,
+  OutputBufferIterator output_buffers_first,
+  SizeIterator sizes_first,
+  Size num_buffers)
+{
+  // copy the bytes of every buffer on its own
+  for (Size i = 0; i < num_buffers; ++i)
+  {
+    const void* input = thrust::detail::it_value_t<InputBufferIterator>(input_buffers_first[i]);
+    void* output      = thrust::detail::it_value_t<OutputBufferIterator>(output_buffers_first[i]);
+    thrust::copy_n(exec, static_cast<const char*>(input), sizes_first[i], static_cast<char*>(output));
+  }
+} // end batched_memcpy()
+} // namespace system::detail::generic
+THRUST_NAMESPACE_END
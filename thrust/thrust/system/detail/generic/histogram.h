@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file histogram.h
+ *  \brief Generic implementation of histogram.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/system/detail/generic/tag.h>
+
+#include <cuda/std/array>
+#include <cuda/std/cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::generic
+{
+template <int NumChannels,
+          typename ExecutionPolicy,
+          typename InputIterator,
+          typename CounterIterator,
+          ::cuda::std::size_t NumActiveChannels,
+          typename BinOp>
+_CCCL_HOST_DEVICE void histogram(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  ::cuda::std::array<CounterIterator, NumActiveChannels> histograms,
+  ::cuda::std::array<BinOp, NumActiveChannels> bin_ops);
+} // namespace system::detail::generic
+THRUST_NAMESPACE_END
+
+#include <thrust/system/detail/generic/histogram.inl>
@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/adjacent_difference.h>
+#include <thrust/binary_search.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/generic/histogram.h>
+#include <thrust/transform.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::generic
+{
+namespace histogram_detail
+{
+// maps a pixel to the bin of one of its channels, and samples outside of all bins to one past the last bin
+template <int NumChannels, typename InputIterator, typename BinOp>
+struct pixel_to_bin
+{
+  InputIterator samples;
+  BinOp bin_op;
+
+  template <typename Size>
+  _CCCL_HOST_DEVICE int operator()(Size pixel) const
+  {
+    const int bin = bin_op(samples[pixel * NumChannels]);
+    return bin < 0 ? bin_op.num_bins() : bin;
+  }
+};
+} // namespace histogram_detail
+
+// sorts the bins of the samples, and finds where each bin ends in the sorted sequence
+template <int NumChannels,
+          typename ExecutionPolicy,
+          typename InputIterator,
+          typename CounterIterator,
+          ::cuda::std::size_t NumActiveChannels,
+          typename BinOp>
+_CCCL_HOST_DEVICE void histogram(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  ::cuda::std::array<CounterIterator, NumActiveChannels> histograms,
+  ::cuda::std::array<BinOp, NumActiveChannels> bin_ops)
+{
+  using size_type = thrust::detail::it_difference_t<InputIterator>;
+
+  const size_type num_pixels = (last - first) / NumChannels;
+  thrust::detail::temporary_array<int, ExecutionPolicy> bins(0, exec, num_pixels);
+
+  for (::cuda::std::size_t channel = 0; channel < NumActiveChannels; ++channel)
+  {
+    const int num_bins = bin_ops[channel].num_bins();
+    if (num_bins <= 0)
+    {
+      continue;
+    }
+
+    thrust::transform(
+      exec,
+      thrust::counting_iterator<size_type>(0),
+      thrust::counting_iterator<size_type>(num_pixels),
+      bins.begin(),
+      histogram_detail::pixel_to_bin<NumChannels, InputIterator, BinOp>{first + channel, bin_ops[channel]});
+
+    thrust::sort(exec, bins.begin(), bins.end());
+
+    thrust::upper_bound(
+      exec,
+      bins.begin(),
+      bins.end(),
+      thrust::counting_iterator<int>(0),
+      thrust::counting_iterator<int>(num_bins),
+      histograms[channel]);
+
+    thrust::adjacent_difference(exec, histograms[channel], histograms[channel] + num_bins, histograms[channel]);
+  }
+}
+} // namespace system::detail::generic
+THRUST_NAMESPACE_END
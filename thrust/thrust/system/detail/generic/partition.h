@@ -18,6 +18,9 @@
 #endif // no system header
 #include <thrust/system/detail/generic/tag.h>
 
+#include <cuda/std/__utility/pair.h>
+#include <cuda/std/tuple>
+
 THRUST_NAMESPACE_BEGIN
 namespace system::detail::generic
 {
@@ -101,6 +104,31 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> partition_
   OutputIterator2 out_false,
   Predicate pred);
 
+template <typename ExecutionPolicy, typename RandomAccessIterator, typename Predicate1, typename Predicate2>
+_CCCL_HOST_DEVICE ::cuda::std::pair<RandomAccessIterator, RandomAccessIterator> three_way_partition(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  Predicate1 select_first_part,
+  Predicate2 select_second_part);
+
+template <typename ExecutionPolicy,
+          typename RandomAccessIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename OutputIterator3,
+          typename Predicate1,
+          typename Predicate2>
+_CCCL_HOST_DEVICE ::cuda::std::tuple<OutputIterator1, OutputIterator2, OutputIterator3> three_way_partition_copy(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator1 out_first_part,
+  OutputIterator2 out_second_part,
+  OutputIterator3 out_unselected,
+  Predicate1 select_first_part,
+  Predicate2 select_second_part);
+
 template <typename ExecutionPolicy, typename ForwardIterator, typename Predicate>
 _CCCL_HOST_DEVICE ForwardIterator partition_point(
   thrust::execution_policy<ExecutionPolicy>& exec, ForwardIterator first, ForwardIterator last, Predicate pred);
@@ -13,6 +13,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/copy.h>
 #include <thrust/count.h>
 #include <thrust/detail/internal_functional.h>
 #include <thrust/detail/temporary_array.h>
@@ -26,10 +27,42 @@
 #include <cuda/std/__functional/not_fn.h>
 #include <cuda/std/__iterator/advance.h>
 #include <cuda/std/__utility/pair.h>
+#include <cuda/std/tuple>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::detail::generic
 {
+namespace three_way_partition_detail
+{
+template <typename Predicate1, typename Predicate2>
+struct is_second_part
+{
+  mutable Predicate1 select_first_part;
+  mutable Predicate2 select_second_part;
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename T>
+  _CCCL_HOST_DEVICE bool operator()(const T& x) const
+  {
+    return !select_first_part(x) && select_second_part(x);
+  }
+};
+
+template <typename Predicate1, typename Predicate2>
+struct is_unselected
+{
+  mutable Predicate1 select_first_part;
+  mutable Predicate2 select_second_part;
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename T>
+  _CCCL_HOST_DEVICE bool operator()(const T& x) const
+  {
+    return !select_first_part(x) && !select_second_part(x);
+  }
+};
+} // namespace three_way_partition_detail
+
 template <typename DerivedPolicy, typename ForwardIterator, typename Predicate>
 _CCCL_HOST_DEVICE ForwardIterator stable_partition(
   thrust::execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, Predicate pred)
@@ -191,5 +224,69 @@ is_partitioned(thrust::execution_policy<DerivedPolicy>& exec, InputIterator firs
                            thrust::make_transform_iterator(first, ::cuda::std::not_fn(pred)),
                            thrust::make_transform_iterator(last, ::cuda::std::not_fn(pred)));
 } // end is_partitioned()
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename Predicate1, typename Predicate2>
+_CCCL_HOST_DEVICE ::cuda::std::pair<RandomAccessIterator, RandomAccessIterator> three_way_partition(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  Predicate1 select_first_part,
+  Predicate2 select_second_part)
+{
+  using InputType = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  // copy input to temp buffer
+  thrust::detail::temporary_array<InputType, DerivedPolicy> temp(exec, first, last);
+
+  // every group begins where the previous one ends
+  const RandomAccessIterator second_part = thrust::copy_if(exec, temp.begin(), temp.end(), first, select_first_part);
+  const RandomAccessIterator unselected  = thrust::copy_if(
+    exec,
+    temp.begin(),
+    temp.end(),
+    second_part,
+    three_way_partition_detail::is_second_part<Predicate1, Predicate2>{select_first_part, select_second_part});
+  thrust::copy_if(
+    exec,
+    temp.begin(),
+    temp.end(),
+    unselected,
+    three_way_partition_detail::is_unselected<Predicate1, Predicate2>{select_first_part, select_second_part});
+
+  return {second_part, unselected};
+} // end three_way_partition()
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename OutputIterator3,
+          typename Predicate1,
+          typename Predicate2>
+_CCCL_HOST_DEVICE ::cuda::std::tuple<OutputIterator1, OutputIterator2, OutputIterator3> three_way_partition_copy(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator1 out_first_part,
+  OutputIterator2 out_second_part,
+  OutputIterator3 out_unselected,
+  Predicate1 select_first_part,
+  Predicate2 select_second_part)
+{
+  return ::cuda::std::tuple<OutputIterator1, OutputIterator2, OutputIterator3>(
+    thrust::copy_if(exec, first, last, out_first_part, select_first_part),
+    thrust::copy_if(
+      exec,
+      first,
+      last,
+      out_second_part,
+      three_way_partition_detail::is_second_part<Predicate1, Predicate2>{select_first_part, select_second_part}),
+    thrust::copy_if(
+      exec,
+      first,
+      last,
+      out_unselected,
+      three_way_partition_detail::is_unselected<Predicate1, Predicate2>{select_first_part, select_second_part}));
+} // end three_way_partition_copy()
 } // namespace system::detail::generic
 THRUST_NAMESPACE_END
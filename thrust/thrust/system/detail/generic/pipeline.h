@@ -0,0 +1,34 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file pipeline.h
+ *  \brief Generic implementation of pipeline.
+ *         It is an error to run a pipeline on a system without an implementation.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/system/detail/generic/tag.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::generic
+{
+template <typename DerivedPolicy, typename Pipeline>
+void run_pipeline(thrust::execution_policy<DerivedPolicy>&, Pipeline&)
+{
+  static_assert(thrust::detail::depend_on_instantiation<Pipeline, false>::value,
+                "thrust::pipeline is only implemented for the host systems");
+} // end run_pipeline()
+} // namespace system::detail::generic
+THRUST_NAMESPACE_END
@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/copy.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/run_length_encode.h>
+#include <thrust/system/detail/generic/run_length_encode.h>
+
+#include <cuda/__iterator/constant_iterator.h>
+#include <cuda/std/__functional/operations.h>
+#include <cuda/std/tuple>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::generic
+{
+namespace run_length_encode_detail
+{
+// combines the (offset, length) of two consecutive parts of a run
+struct merge_runs
+{
+  template <typename Tuple>
+  _CCCL_HOST_DEVICE Tuple operator()(const Tuple& lhs, const Tuple& rhs) const
+  {
+    return Tuple(::cuda::std::get<0>(lhs), ::cuda::std::get<1>(lhs) + ::cuda::std::get<1>(rhs));
+  }
+};
+
+struct is_non_trivial
+{
+  template <typename Size>
+  _CCCL_HOST_DEVICE bool operator()(Size length) const
+  {
+    return length > 1;
+  }
+};
+} // namespace run_length_encode_detail
+
+template <typename ExecutionPolicy, typename InputIterator, typename OutputIterator1, typename OutputIterator2>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 unique_output,
+  OutputIterator2 counts_output)
+{
+  return thrust::run_length_encode(exec, first, last, unique_output, counts_output, ::cuda::std::equal_to<>{});
+} // end run_length_encode()
+
+template <typename ExecutionPolicy,
+          typename InputIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 unique_output,
+  OutputIterator2 counts_output,
+  BinaryPredicate binary_pred)
+{
+  using size_type = thrust::detail::it_difference_t<InputIterator>;
+
+  return thrust::reduce_by_key(
+    exec, first, last, ::cuda::constant_iterator<size_type>(1), unique_output, counts_output, binary_pred);
+} // end run_length_encode()
+
+template <typename ExecutionPolicy, typename InputIterator, typename OutputIterator1, typename OutputIterator2>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> non_trivial_runs(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 offsets_output,
+  OutputIterator2 lengths_output)
+{
+  return thrust::non_trivial_runs(exec, first, last, offsets_output, lengths_output, ::cuda::std::equal_to<>{});
+} // end non_trivial_runs()
+
+template <typename ExecutionPolicy,
+          typename InputIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> non_trivial_runs(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 offsets_output,
+  OutputIterator2 lengths_output,
+  BinaryPredicate binary_pred)
+{
+  using size_type = thrust::detail::it_difference_t<InputIterator>;
+
+  const size_type n = last - first;
+  thrust::detail::temporary_array<size_type, ExecutionPolicy> offsets(0, exec, n);
+  thrust::detail::temporary_array<size_type, ExecutionPolicy> lengths(0, exec, n);
+
+  // find the offset and length of all runs, then keep the non-trivial ones
+  const auto runs = thrust::make_zip_iterator(offsets.begin(), lengths.begin());
+  const auto runs_end =
+    thrust::reduce_by_key(
+      exec,
+      first,
+      last,
+      thrust::make_zip_iterator(thrust::counting_iterator<size_type>(0), ::cuda::constant_iterator<size_type>(1)),
+      thrust::make_discard_iterator(),
+      runs,
+      binary_pred,
+      run_length_encode_detail::merge_runs{})
+      .second;
+
+  const auto result_end = thrust::copy_if(
+    exec,
+    runs,
+    runs_end,
+    lengths.begin(),
+    thrust::make_zip_iterator(offsets_output, lengths_output),
+    run_length_encode_detail::is_non_trivial{});
+
+  return {::cuda::std::get<0>(result_end.get_iterator_tuple()), ::cuda::std::get<1>(result_end.get_iterator_tuple())};
+} // end non_trivial_runs()
+} // namespace system::detail::generic
+THRUST_NAMESPACE_END
@@ -0,0 +1,179 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/extrema.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/reduce.h>
+#include <thrust/segmented_reduce.h>
+#include <thrust/system/detail/generic/segmented_reduce.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__functional/operations.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::generic
+{
+namespace segmented_reduce_detail
+{
+template <typename StrictWeakOrdering>
+struct reversed_order
+{
+  StrictWeakOrdering comp;
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename T1, typename T2>
+  _CCCL_HOST_DEVICE bool operator()(const T1& lhs, const T2& rhs)
+  {
+    return comp(rhs, lhs);
+  }
+};
+} // namespace segmented_reduce_detail
+
+template <typename ExecutionPolicy, typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result)
+{
+  using T = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  // use T(0) as init by default
+  return thrust::segmented_reduce(exec, offsets_first, offsets_last, first, result, T(0));
+} // end segmented_reduce()
+
+template <typename ExecutionPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename T>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  T init)
+{
+  // use plus<T> by default
+  return thrust::segmented_reduce(exec, offsets_first, offsets_last, first, result, init, ::cuda::std::plus<T>());
+} // end segmented_reduce()
+
+template <typename ExecutionPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op)
+{
+  using size_type = thrust::detail::it_difference_t<RandomAccessIterator>;
+
+  const size_type num_segments = (::cuda::std::max) (size_type{0}, size_type(offsets_last - offsets_first) - 1);
+
+  // one reduction per segment
+  for (size_type segment = 0; segment < num_segments; ++segment)
+  {
+    const size_type begin = offsets_first[segment];
+    const size_type end   = offsets_first[segment + 1];
+    result[segment] = thrust::reduce(exec, first + begin, first + end, init, binary_op);
+  }
+
+  return result + num_segments;
+} // end segmented_reduce()
+
+template <typename ExecutionPolicy, typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator segmented_arg_min(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+  return thrust::segmented_arg_min(exec, offsets_first, offsets_last, first, result, ::cuda::std::less<value_type>());
+} // end segmented_arg_min()
+
+template <typename ExecutionPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator segmented_arg_min(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  using size_type = thrust::detail::it_difference_t<RandomAccessIterator>;
+
+  const size_type num_segments = (::cuda::std::max) (size_type{0}, size_type(offsets_last - offsets_first) - 1);
+
+  // one min_element per segment
+  for (size_type segment = 0; segment < num_segments; ++segment)
+  {
+    const size_type begin = offsets_first[segment];
+    const size_type end   = offsets_first[segment + 1];
+    result[segment] = thrust::min_element(exec, first + begin, first + end, comp) - (first + begin);
+  }
+
+  return result + num_segments;
+} // end segmented_arg_min()
+
+template <typename ExecutionPolicy, typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator segmented_arg_max(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+  return thrust::segmented_arg_max(exec, offsets_first, offsets_last, first, result, ::cuda::std::less<value_type>());
+} // end segmented_arg_max()
+
+template <typename ExecutionPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator segmented_arg_max(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  // the first largest element is the first smallest one in the reversed order
+  return thrust::segmented_arg_min(
+    exec,
+    offsets_first,
+    offsets_last,
+    first,
+    result,
+    segmented_reduce_detail::reversed_order<StrictWeakOrdering>{comp});
+} // end segmented_arg_max()
+} // namespace system::detail::generic
+THRUST_NAMESPACE_END
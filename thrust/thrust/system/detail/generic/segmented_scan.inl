@@ -0,0 +1,128 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/scan.h>
+#include <thrust/segmented_scan.h>
+#include <thrust/system/detail/generic/segmented_scan.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__functional/operations.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::generic
+{
+template <typename ExecutionPolicy, typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator segmented_inclusive_scan(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result)
+{
+  // assume plus as the associative operator
+  return thrust::segmented_inclusive_scan(exec, offsets_first, offsets_last, first, result, ::cuda::std::plus<>());
+} // end segmented_inclusive_scan()
+
+template <typename ExecutionPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename BinaryFunction>
+_CCCL_HOST_DEVICE OutputIterator segmented_inclusive_scan(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  BinaryFunction binary_op)
+{
+  using size_type = thrust::detail::it_difference_t<RandomAccessIterator>;
+
+  const size_type num_segments = (::cuda::std::max) (size_type{0}, size_type(offsets_last - offsets_first) - 1);
+
+  // one scan per segment
+  for (size_type segment = 0; segment < num_segments; ++segment)
+  {
+    const size_type begin = offsets_first[segment];
+    const size_type end   = offsets_first[segment + 1];
+    thrust::inclusive_scan(exec, first + begin, first + end, result + begin, binary_op);
+  }
+
+  return num_segments > 0 ? result + offsets_first[num_segments] : result;
+} // end segmented_inclusive_scan()
+
+template <typename ExecutionPolicy, typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator segmented_exclusive_scan(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result)
+{
+  using ValueType = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  // assume 0 as the initialization value
+  return thrust::segmented_exclusive_scan(exec, offsets_first, offsets_last, first, result, ValueType(0));
+} // end segmented_exclusive_scan()
+
+template <typename ExecutionPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename T>
+_CCCL_HOST_DEVICE OutputIterator segmented_exclusive_scan(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  T init)
+{
+  // assume plus as the associative operator
+  return thrust::segmented_exclusive_scan(
+    exec, offsets_first, offsets_last, first, result, init, ::cuda::std::plus<>());
+} // end segmented_exclusive_scan()
+
+template <typename ExecutionPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+_CCCL_HOST_DEVICE OutputIterator segmented_exclusive_scan(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op)
+{
+  using size_type = thrust::detail::it_difference_t<RandomAccessIterator>;
+
+  const size_type num_segments = (::cuda::std::max) (size_type{0}, size_type(offsets_last - offsets_first) - 1);
+
+  // one scan per segment
+  for (size_type segment = 0; segment < num_segments; ++segment)
+  {
+    const size_type begin = offsets_first[segment];
+    const size_type end   = offsets_first[segment + 1];
+    thrust::exclusive_scan(exec, first + begin, first + end, result + begin, init, binary_op);
+  }
+
+  return num_segments > 0 ? result + offsets_first[num_segments] : result;
+} // end segmented_exclusive_scan()
+} // namespace system::detail::generic
+THRUST_NAMESPACE_END
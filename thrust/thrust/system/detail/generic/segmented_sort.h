@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/system/detail/generic/tag.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::generic
+{
+template <typename ExecutionPolicy, typename OffsetIterator, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void segmented_sort(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator keys_first);
+
+template <typename ExecutionPolicy, typename OffsetIterator, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator keys_first,
+  StrictWeakOrdering comp);
+
+template <typename ExecutionPolicy, typename OffsetIterator, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void segmented_stable_sort(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator keys_first);
+
+template <typename ExecutionPolicy, typename OffsetIterator, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_stable_sort(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator keys_first,
+  StrictWeakOrdering comp);
+
+template <typename ExecutionPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2>
+_CCCL_HOST_DEVICE void segmented_sort_by_key(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first);
+
+template <typename ExecutionPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort_by_key(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp);
+
+template <typename ExecutionPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2>
+_CCCL_HOST_DEVICE void segmented_stable_sort_by_key(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first);
+
+template <typename ExecutionPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_stable_sort_by_key(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp);
+} // namespace system::detail::generic
+THRUST_NAMESPACE_END
+
+#include <thrust/system/detail/generic/segmented_sort.inl>
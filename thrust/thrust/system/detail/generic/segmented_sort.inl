@@ -0,0 +1,156 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/segmented_sort.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/generic/segmented_sort.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__functional/operations.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::generic
+{
+template <typename ExecutionPolicy, typename OffsetIterator, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void segmented_sort(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator keys_first)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+  thrust::segmented_sort(exec, offsets_first, offsets_last, keys_first, ::cuda::std::less<value_type>());
+} // end segmented_sort()
+
+template <typename ExecutionPolicy, typename OffsetIterator, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator keys_first,
+  StrictWeakOrdering comp)
+{
+  // implement with segmented_stable_sort
+  thrust::segmented_stable_sort(exec, offsets_first, offsets_last, keys_first, comp);
+} // end segmented_sort()
+
+template <typename ExecutionPolicy, typename OffsetIterator, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void segmented_stable_sort(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator keys_first)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+  thrust::segmented_stable_sort(exec, offsets_first, offsets_last, keys_first, ::cuda::std::less<value_type>());
+} // end segmented_stable_sort()
+
+template <typename ExecutionPolicy, typename OffsetIterator, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_stable_sort(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator keys_first,
+  StrictWeakOrdering comp)
+{
+  using size_type = thrust::detail::it_difference_t<RandomAccessIterator>;
+
+  const size_type num_segments = (::cuda::std::max) (size_type{0}, size_type(offsets_last - offsets_first) - 1);
+
+  // one sort per segment
+  for (size_type segment = 0; segment < num_segments; ++segment)
+  {
+    const size_type begin = offsets_first[segment];
+    const size_type end   = offsets_first[segment + 1];
+    thrust::stable_sort(exec, keys_first + begin, keys_first + end, comp);
+  }
+} // end segmented_stable_sort()
+
+template <typename ExecutionPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2>
+_CCCL_HOST_DEVICE void segmented_sort_by_key(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator1>;
+  thrust::segmented_sort_by_key(
+    exec, offsets_first, offsets_last, keys_first, values_first, ::cuda::std::less<value_type>());
+} // end segmented_sort_by_key()
+
+template <typename ExecutionPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort_by_key(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp)
+{
+  // implement with segmented_stable_sort_by_key
+  thrust::segmented_stable_sort_by_key(exec, offsets_first, offsets_last, keys_first, values_first, comp);
+} // end segmented_sort_by_key()
+
+template <typename ExecutionPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2>
+_CCCL_HOST_DEVICE void segmented_stable_sort_by_key(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator1>;
+  thrust::segmented_stable_sort_by_key(
+    exec, offsets_first, offsets_last, keys_first, values_first, ::cuda::std::less<value_type>());
+} // end segmented_stable_sort_by_key()
+
+template <typename ExecutionPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_stable_sort_by_key(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp)
+{
+  using size_type = thrust::detail::it_difference_t<RandomAccessIterator1>;
+
+  const size_type num_segments = (::cuda::std::max) (size_type{0}, size_type(offsets_last - offsets_first) - 1);
+
+  // one sort per segment
+  for (size_type segment = 0; segment < num_segments; ++segment)
+  {
+    const size_type begin = offsets_first[segment];
+    const size_type end   = offsets_first[segment + 1];
+    thrust::stable_sort_by_key(exec, keys_first + begin, keys_first + end, values_first + begin, comp);
+  }
+} // end segmented_stable_sort_by_key()
+} // namespace system::detail::generic
+THRUST_NAMESPACE_END
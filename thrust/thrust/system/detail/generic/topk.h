@@ -0,0 +1,142 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/system/detail/generic/tag.h>
+
+#include <cuda/std/__utility/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::generic
+{
+template <typename ExecutionPolicy, typename RandomAccessIterator, typename OutputIterator, typename Size>
+_CCCL_HOST_DEVICE OutputIterator topk(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator result,
+  Size k);
+
+template <typename ExecutionPolicy,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename Size,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator topk(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator result,
+  Size k,
+  StrictWeakOrdering comp);
+
+template <typename ExecutionPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> topk_by_key(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k);
+
+template <typename ExecutionPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> topk_by_key(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k,
+  StrictWeakOrdering comp);
+
+template <typename ExecutionPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename Size>
+_CCCL_HOST_DEVICE OutputIterator segmented_topk(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  Size k);
+
+template <typename ExecutionPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename Size,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator segmented_topk(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  Size k,
+  StrictWeakOrdering comp);
+
+template <typename ExecutionPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> segmented_topk_by_key(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k);
+
+template <typename ExecutionPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> segmented_topk_by_key(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k,
+  StrictWeakOrdering comp);
+} // namespace system::detail::generic
+THRUST_NAMESPACE_END
+
+#include <thrust/system/detail/generic/topk.inl>
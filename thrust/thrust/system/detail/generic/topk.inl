@@ -0,0 +1,242 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/copy.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/generic/topk.h>
+#include <thrust/topk.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__functional/operations.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::generic
+{
+template <typename ExecutionPolicy, typename RandomAccessIterator, typename OutputIterator, typename Size>
+_CCCL_HOST_DEVICE OutputIterator topk(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator result,
+  Size k)
+{
+  return thrust::topk(exec, first, last, result, k, ::cuda::std::greater<>{});
+} // end topk()
+
+template <typename ExecutionPolicy,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename Size,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator topk(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator result,
+  Size k,
+  StrictWeakOrdering comp)
+{
+  using size_type = thrust::detail::it_difference_t<RandomAccessIterator>;
+
+  return thrust::topk_by_key(
+           exec,
+           first,
+           last,
+           thrust::counting_iterator<size_type>(0),
+           result,
+           thrust::make_discard_iterator(),
+           k,
+           comp)
+    .first;
+} // end topk()
+
+template <typename ExecutionPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> topk_by_key(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k)
+{
+  return thrust::topk_by_key(
+    exec, keys_first, keys_last, values_first, keys_result, values_result, k, ::cuda::std::greater<>{});
+} // end topk_by_key()
+
+template <typename ExecutionPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> topk_by_key(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k,
+  StrictWeakOrdering comp)
+{
+  using key_type  = thrust::detail::it_value_t<RandomAccessIterator1>;
+  using size_type = thrust::detail::it_difference_t<RandomAccessIterator1>;
+
+  // a negative k selects nothing, like k == 0
+  const size_type n = keys_last - keys_first;
+  const size_type m = (::cuda::std::min) (n, (::cuda::std::max) (size_type{0}, static_cast<size_type>(k)));
+
+  // stable sort a copy of the keys along with their positions, then keep the first m
+  thrust::detail::temporary_array<key_type, ExecutionPolicy> keys(exec, keys_first, keys_last);
+  thrust::detail::temporary_array<size_type, ExecutionPolicy> positions(0, exec, n);
+  thrust::sequence(exec, positions.begin(), positions.end());
+  thrust::stable_sort_by_key(exec, keys.begin(), keys.end(), positions.begin(), comp);
+
+  thrust::gather(exec, positions.begin(), positions.begin() + m, values_first, values_result);
+  return {thrust::copy_n(exec, keys.begin(), m, keys_result), values_result + m};
+} // end topk_by_key()
+
+template <typename ExecutionPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename Size>
+_CCCL_HOST_DEVICE OutputIterator segmented_topk(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  Size k)
+{
+  return thrust::segmented_topk(exec, offsets_first, offsets_last, first, result, k, ::cuda::std::greater<>{});
+} // end segmented_topk()
+
+template <typename ExecutionPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename Size,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator segmented_topk(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  Size k,
+  StrictWeakOrdering comp)
+{
+  using size_type = thrust::detail::it_difference_t<RandomAccessIterator>;
+
+  return thrust::segmented_topk_by_key(
+           exec,
+           offsets_first,
+           offsets_last,
+           first,
+           thrust::counting_iterator<size_type>(0),
+           result,
+           thrust::make_discard_iterator(),
+           k,
+           comp)
+    .first;
+} // end segmented_topk()
+
+template <typename ExecutionPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> segmented_topk_by_key(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k)
+{
+  return thrust::segmented_topk_by_key(
+    exec,
+    offsets_first,
+    offsets_last,
+    keys_first,
+    values_first,
+    keys_result,
+    values_result,
+    k,
+    ::cuda::std::greater<>{});
+} // end segmented_topk_by_key()
+
+template <typename ExecutionPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> segmented_topk_by_key(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k,
+  StrictWeakOrdering comp)
+{
+  using size_type = thrust::detail::it_difference_t<RandomAccessIterator1>;
+
+  const size_type num_segments = (::cuda::std::max) (size_type{0}, size_type(offsets_last - offsets_first) - 1);
+  const size_type stride       = (::cuda::std::max) (size_type{0}, static_cast<size_type>(k));
+
+  // one top-k per segment
+  for (size_type segment = 0; segment < num_segments; ++segment)
+  {
+    const size_type begin = offsets_first[segment];
+    const size_type end   = offsets_first[segment + 1];
+    thrust::topk_by_key(
+      exec,
+      keys_first + begin,
+      keys_first + end,
+      values_first + begin,
+      keys_result + segment * stride,
+      values_result + segment * stride,
+      stride,
+      comp);
+  }
+
+  return {keys_result + num_segments * stride, values_result + num_segments * stride};
+} // end segmented_topk_by_key()
+} // namespace system::detail::generic
+THRUST_NAMESPACE_END
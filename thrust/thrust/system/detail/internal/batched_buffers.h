@@ -0,0 +1,159 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file batched_buffers.h
+ *  \brief Copies many buffers of different sizes, with shares of the same number of bytes per worker.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/merge_path_segments.h>
+
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/cstring>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+namespace batched_buffers_detail
+{
+template <typename Word>
+_CCCL_HOST_DEVICE inline void copy_overlapping_words(char* dst, const char* src, ::cuda::std::size_t n)
+{
+  // load both words before storing, so that the overlapping bytes are copied once
+  Word head;
+  Word tail;
+  ::cuda::std::memcpy(&head, src, sizeof(Word));
+  ::cuda::std::memcpy(&tail, src + n - sizeof(Word), sizeof(Word));
+  ::cuda::std::memcpy(dst, &head, sizeof(Word));
+  ::cuda::std::memcpy(dst + n - sizeof(Word), &tail, sizeof(Word));
+}
+
+struct alignas(16) two_words
+{
+  ::cuda::std::uint64_t lo;
+  ::cuda::std::uint64_t hi;
+};
+} // namespace batched_buffers_detail
+
+//! \brief Copies \p n bytes from \p src to \p dst. Buffers of up to 32 bytes are copied with two loads and two stores
+//! of the largest words which fit in them, overlapping in the middle, rather than with a call to \c memcpy, which
+//! dominates the cost of copying millions of tiny buffers. Larger buffers are left to \c memcpy, which switches to
+//! non-temporal stores for the buffers which do not fit in the cache.
+_CCCL_HOST_DEVICE inline void copy_bytes(char* dst, const char* src, ::cuda::std::size_t n)
+{
+  using namespace batched_buffers_detail;
+
+  if (n > 32)
+  {
+    ::cuda::std::memcpy(dst, src, n);
+  }
+  else if (n >= 16)
+  {
+    copy_overlapping_words<two_words>(dst, src, n);
+  }
+  else if (n >= 8)
+  {
+    copy_overlapping_words<::cuda::std::uint64_t>(dst, src, n);
+  }
+  else if (n >= 4)
+  {
+    copy_overlapping_words<::cuda::std::uint32_t>(dst, src, n);
+  }
+  else if (n >= 2)
+  {
+    copy_overlapping_words<::cuda::std::uint16_t>(dst, src, n);
+  }
+  else if (n == 1)
+  {
+    *dst = *src;
+  }
+}
+
+//! \brief Copies the elements <tt>[first, first + n)</tt> of a range to the same positions of another.
+struct copy_range_piece
+{
+  template <typename InputIterator, typename OutputIterator, typename Size>
+  _CCCL_HOST_DEVICE void operator()(InputIterator input, OutputIterator output, Size first, Size n) const
+  {
+    for (Size i = first; i < first + n; ++i)
+    {
+      output[i] = input[i];
+    }
+  }
+};
+
+//! \brief Copies the bytes <tt>[first, first + n)</tt> of a buffer to the same positions of another.
+struct copy_buffer_piece
+{
+  template <typename InputPointer, typename OutputPointer, typename Size>
+  _CCCL_HOST_DEVICE void operator()(InputPointer input, OutputPointer output, Size first, Size n) const
+  {
+    copy_bytes(static_cast<char*>(static_cast<void*>(output)) + first,
+               static_cast<const char*>(static_cast<const void*>(input)) + first,
+               static_cast<::cuda::std::size_t>(n));
+  }
+};
+
+//! \brief Plan of a parallel copy of the buffers <tt>[input_first[i], input_first[i] + size(i))</tt>, which gives every
+//! worker about the same number of buffers plus elements.
+//!
+//! The buffers are laid out as the segments of a single range, whose offsets are the prefix sums of their sizes, so a
+//! huge buffer is split among all workers, and millions of tiny buffers are handed out in chunks of the same total
+//! size. \c CopyPiece copies the elements <tt>[first, first + n)</tt> of one buffer.
+template <typename InputRangeIterator, typename OutputRangeIterator, typename CopyPiece, typename Size>
+class batched_copy_plan
+{
+public:
+  //! \p offsets holds the <tt>num_buffers + 1</tt> prefix sums of the sizes of the buffers, starting from 0.
+  batched_copy_plan(InputRangeIterator input_first,
+                    OutputRangeIterator output_first,
+                    const Size* offsets,
+                    Size num_buffers,
+                    Size max_workers,
+                    CopyPiece copy_piece = {})
+      : m_path(offsets, num_buffers, max_workers)
+      , m_input_first(input_first)
+      , m_output_first(output_first)
+      , m_copy_piece(copy_piece)
+  {}
+
+  Size num_workers() const
+  {
+    return m_path.num_workers();
+  }
+
+  void copy(Size worker) const
+  {
+    m_path.for_each_piece(worker, [&](Size buffer, Size first, Size last, bool) {
+      if (first < last)
+      {
+        const Size begin = m_path.segment_begin(buffer);
+        m_copy_piece(
+          thrust::detail::it_value_t<InputRangeIterator>(m_input_first[buffer]),
+          thrust::detail::it_value_t<OutputRangeIterator>(m_output_first[buffer]),
+          first - begin,
+          last - first);
+      }
+    });
+  }
+
+private:
+  merge_path_segments<const Size*, Size> m_path;
+  InputRangeIterator m_input_first;
+  OutputRangeIterator m_output_first;
+  CopyPiece m_copy_piece;
+};
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
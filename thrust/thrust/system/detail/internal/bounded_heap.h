@@ -0,0 +1,260 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file bounded_heap.h
+ *  \brief Selects the k first elements of a range in the order of a comparison, with a heap of at most k indices.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/function.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+//! \brief Orders the indices of a range by \p comp applied to their elements, and the indices of equivalent elements
+//! by their value. The order is total, so the k first indices are those of a stable sort, for any number of workers.
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+struct index_order
+{
+  RandomAccessIterator first;
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> comp;
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename Size>
+  _CCCL_HOST_DEVICE bool operator()(Size i, Size j) const
+  {
+    if (comp(first[i], first[j]))
+    {
+      return true;
+    }
+    if (comp(first[j], first[i]))
+    {
+      return false;
+    }
+    return i < j;
+  }
+};
+
+//! \brief Keeps the \c capacity first of the indices pushed into it, in the order \p Order, in a binary heap stored in
+//! <tt>[storage, storage + capacity)</tt>. The top of the heap is the last index kept, so an index that does not come
+//! before it is rejected with a single comparison, which is the fate of most indices when \c capacity is small.
+template <typename Size, typename Order>
+class bounded_heap
+{
+public:
+  _CCCL_HOST_DEVICE bounded_heap(Size* storage, Size capacity, Order order)
+      : m_storage(storage)
+      , m_capacity(capacity)
+      , m_size(0)
+      , m_order(order)
+  {}
+
+  _CCCL_HOST_DEVICE Size size() const
+  {
+    return m_size;
+  }
+
+  _CCCL_HOST_DEVICE const Size* data() const
+  {
+    return m_storage;
+  }
+
+  _CCCL_HOST_DEVICE void push(Size i)
+  {
+    if (m_size < m_capacity)
+    {
+      m_storage[m_size] = i;
+      sift_up(m_size++);
+    }
+    else if (m_capacity > 0 && m_order(i, m_storage[0]))
+    {
+      m_storage[0] = i;
+      sift_down(0, m_size);
+    }
+  }
+
+  //! \brief Pushes the indices <tt>[begin, end)</tt>.
+  _CCCL_HOST_DEVICE void push(Size begin, Size end)
+  {
+    for (Size i = begin; i < end; ++i)
+    {
+      push(i);
+    }
+  }
+
+  //! \brief Sorts the indices kept in the order \p Order. No index can be pushed afterwards.
+  _CCCL_HOST_DEVICE void sort()
+  {
+    for (Size end = m_size; end > 1; --end)
+    {
+      const Size last    = m_storage[end - 1];
+      m_storage[end - 1] = m_storage[0];
+      m_storage[0]       = last;
+      sift_down(0, end - 1);
+    }
+  }
+
+private:
+  _CCCL_HOST_DEVICE void sift_up(Size hole)
+  {
+    const Size i = m_storage[hole];
+    while (hole > 0)
+    {
+      const Size parent = (hole - 1) / 2;
+      if (!m_order(m_storage[parent], i))
+      {
+        break;
+      }
+      m_storage[hole] = m_storage[parent];
+      hole            = parent;
+    }
+    m_storage[hole] = i;
+  }
+
+  _CCCL_HOST_DEVICE void sift_down(Size hole, Size size)
+  {
+    const Size i = m_storage[hole];
+    for (Size child = 2 * hole + 1; child < size; child = 2 * hole + 1)
+    {
+      if (child + 1 < size && m_order(m_storage[child], m_storage[child + 1]))
+      {
+        ++child;
+      }
+      if (!m_order(i, m_storage[child]))
+      {
+        break;
+      }
+      m_storage[hole] = m_storage[child];
+      hole            = child;
+    }
+    m_storage[hole] = i;
+  }
+
+  Size* m_storage;
+  Size m_capacity;
+  Size m_size;
+  Order m_order;
+};
+
+//! \brief Copies the \p k first elements of <tt>[keys_first, keys_first + n)</tt> in the order \p comp, and the
+//! corresponding values, with \p storage as the heap of at most \p k indices. Returns the number of elements copied.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename Size,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE Size select_topk(
+  RandomAccessIterator1 keys_first,
+  Size n,
+  RandomAccessIterator2 values_first,
+  RandomAccessIterator3 keys_result,
+  RandomAccessIterator4 values_result,
+  Size k,
+  StrictWeakOrdering comp,
+  Size* storage,
+  bool sorted)
+{
+  using order_type = index_order<RandomAccessIterator1, StrictWeakOrdering>;
+
+  bounded_heap<Size, order_type> heap(storage, (::cuda::std::min) (k, n), order_type{keys_first, {comp}});
+  heap.push(Size{0}, n);
+  if (sorted)
+  {
+    heap.sort();
+  }
+
+  for (Size i = 0; i < heap.size(); ++i)
+  {
+    keys_result[i]   = keys_first[heap.data()[i]];
+    values_result[i] = values_first[heap.data()[i]];
+  }
+  return heap.size();
+}
+
+//! \brief Plan of a parallel selection of the \c k first elements of <tt>[first, first + n)</tt> in the order \c comp.
+//!
+//! A parallel system
+//!   1. calls \c select for every chunk, in parallel, which keeps the \c k first indices of the chunk in its own slice
+//!      of <tt>num_chunks() * k()</tt> candidates;
+//!   2. calls \c merge, which keeps the \c k first of all candidates.
+//! Because the order of indices is total, the result does not depend on the number of chunks.
+template <typename RandomAccessIterator, typename StrictWeakOrdering, typename Size>
+class chunked_topk
+{
+  using order_type = index_order<RandomAccessIterator, StrictWeakOrdering>;
+
+public:
+  // Below this number of elements per chunk, the merge of the candidates dominates.
+  static constexpr Size min_chunk_size = Size{1} << 14;
+
+  chunked_topk(RandomAccessIterator first, Size n, Size k, StrictWeakOrdering comp, Size max_chunks)
+      : m_n(n)
+      , m_k((::cuda::std::min) (k, n))
+      , m_order{first, {comp}}
+      , m_num_chunks(
+          (::cuda::std::max) (Size{1},
+                              (::cuda::std::min) (max_chunks, n / (::cuda::std::max) (min_chunk_size, 4 * m_k))))
+  {}
+
+  Size num_chunks() const
+  {
+    return m_num_chunks;
+  }
+
+  Size k() const
+  {
+    return m_k;
+  }
+
+  //! \brief Keeps the \c k first indices of \p chunk in <tt>candidates[chunk * k(), (chunk + 1) * k())</tt> and their
+  //! number in <tt>counts[chunk]</tt>.
+  void select(Size chunk, Size* candidates, Size* counts) const
+  {
+    bounded_heap<Size, order_type> heap(candidates + chunk * m_k, m_k, m_order);
+    heap.push(chunk * m_n / m_num_chunks, (chunk + 1) * m_n / m_num_chunks);
+    counts[chunk] = heap.size();
+  }
+
+  //! \brief Stores the \c k first of all candidates in \p result, sorted if \p sorted is \c true, and returns their
+  //! number.
+  Size merge(const Size* candidates, const Size* counts, Size* result, bool sorted) const
+  {
+    bounded_heap<Size, order_type> heap(result, m_k, m_order);
+    for (Size chunk = 0; chunk < m_num_chunks; ++chunk)
+    {
+      for (Size i = 0; i < counts[chunk]; ++i)
+      {
+        heap.push(candidates[chunk * m_k + i]);
+      }
+    }
+    if (sorted)
+    {
+      heap.sort();
+    }
+    return heap.size();
+  }
+
+private:
+  Size m_n;
+  Size m_k;
+  order_type m_order;
+  Size m_num_chunks;
+};
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
@@ -0,0 +1,251 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file bucket_shuffle.h
+ *  \brief Building blocks of a parallel shuffle for the host systems.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/random/uniform_int_distribution.h>
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__bit/integral.h>
+#include <cuda/std/__random/philox_engine.h>
+#include <cuda/std/__utility/swap.h>
+#include <cuda/std/array>
+#include <cuda/std/cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+//! \brief A shuffle that scatters every element into a random bucket and then shuffles each bucket on its own.
+//!
+//! Each element independently picks one of \c num_buckets() buckets uniformly at random, so the bucket sizes follow a
+//! multinomial distribution. Concatenating the uniformly shuffled buckets then yields a uniformly random permutation
+//! (Sanders, "Random permutations on distributed, external and hierarchical memory", 1998). Unlike a bijection-based
+//! shuffle, no work is wasted on padding, and the final random accesses stay within a cache-sized bucket.
+//!
+//! The work is split into blocks of the input and buckets of the output, and every block and every bucket draws from
+//! its own Philox stream. The partitioning only depends on the input size, so the permutation for a given seed does not
+//! depend on the number of threads.
+//!
+//! A parallel system drives the algorithm as follows:
+//!   1. \c count_block for every block, in parallel;
+//!   2. \c compute_offsets, sequentially;
+//!   3. \c scatter_block for every block, in parallel;
+//!   4. \c shuffle_bucket for every bucket, in parallel.
+//! Since the input is completely read in step 3, the output may alias the input.
+class bucket_shuffle
+{
+public:
+  using size_type = std::uint64_t;
+
+  // Buckets of about this many elements are shuffled in cache.
+  static constexpr size_type target_bucket_size = size_type{1} << 15;
+  static constexpr size_type max_buckets        = 1024;
+  static constexpr size_type target_block_size  = size_type{1} << 16;
+  static constexpr size_type max_blocks         = 256;
+
+  template <class URBG>
+  bucket_shuffle(size_type n, URBG&& g)
+      : m_n(n)
+  {
+    // thrust engines do not fully implement the URBG requirements, so draw the key through a distribution.
+    thrust::uniform_int_distribution<std::uint32_t> dist;
+    const size_type hi = dist(g);
+    const size_type lo = dist(g);
+    m_key              = (hi << 32) | lo;
+
+    // Round the number of buckets up to a power of two, so that a bucket is just the top bits of a random number.
+    const size_type wanted_buckets = (n + target_bucket_size - 1) / target_bucket_size;
+    if (wanted_buckets > 1)
+    {
+      m_log2_buckets = ::cuda::std::bit_width(::cuda::std::min(wanted_buckets, max_buckets) - 1);
+    }
+
+    m_num_blocks = ::cuda::std::min((n + target_block_size - 1) / target_block_size, max_blocks);
+    m_block_size = m_num_blocks == 0 ? 0 : (n + m_num_blocks - 1) / m_num_blocks;
+  }
+
+  size_type size() const
+  {
+    return m_n;
+  }
+
+  size_type num_blocks() const
+  {
+    return m_num_blocks;
+  }
+
+  size_type num_buckets() const
+  {
+    return size_type{1} << m_log2_buckets;
+  }
+
+  //! \brief Counts how many elements of \p block go to each bucket. \p counts points to \c num_buckets() values.
+  void count_block(size_type block, size_type* counts) const
+  {
+    for (size_type j = 0; j < num_buckets(); ++j)
+    {
+      counts[j] = 0;
+    }
+    bucket_generator buckets(*this, block);
+    for (size_type i = block_begin(block); i < block_end(block); ++i)
+    {
+      ++counts[buckets()];
+    }
+  }
+
+  //! \brief Turns the per-block counts (\c num_blocks() rows of \c num_buckets() values) into the output position of
+  //! the first element each block sends to each bucket, and writes the \c num_buckets() + 1 bucket boundaries to \p
+  //! bucket_begin.
+  void compute_offsets(size_type* counts, size_type* bucket_begin) const
+  {
+    size_type offset = 0;
+    for (size_type j = 0; j < num_buckets(); ++j)
+    {
+      bucket_begin[j] = offset;
+      for (size_type b = 0; b < m_num_blocks; ++b)
+      {
+        const size_type count         = counts[b * num_buckets() + j];
+        counts[b * num_buckets() + j] = offset;
+        offset += count;
+      }
+    }
+    bucket_begin[num_buckets()] = offset;
+  }
+
+  //! \brief Moves the elements of \p block into their buckets of \p temp, using the row of offsets computed for it.
+  template <typename InputIterator, typename T>
+  void scatter_block(size_type block, InputIterator first, T* temp, size_type* offsets) const
+  {
+    bucket_generator buckets(*this, block);
+    for (size_type i = block_begin(block); i < block_end(block); ++i)
+    {
+      temp[offsets[buckets()]++] = first[i];
+    }
+  }
+
+  //! \brief Shuffles \p bucket of \p temp in place and copies it to its final position in \p result.
+  template <typename T, typename OutputIterator>
+  void shuffle_bucket(size_type bucket, T* temp, OutputIterator result, const size_type* bucket_begin) const
+  {
+    const size_type begin = bucket_begin[bucket];
+    const size_type end   = bucket_begin[bucket + 1];
+
+    // Fisher-Yates
+    engine_type engine = make_engine(shuffle_stream, bucket);
+    for (size_type i = end - begin; i > 1; --i)
+    {
+      using ::cuda::std::swap;
+      swap(temp[begin + i - 1], temp[begin + uniform_below(engine, i)]);
+    }
+
+    for (size_type i = begin; i < end; ++i)
+    {
+      result[i] = temp[i];
+    }
+  }
+
+private:
+  using engine_type = ::cuda::std::philox4x64;
+
+  static constexpr size_type scatter_stream = 0;
+  static constexpr size_type shuffle_stream = 1;
+
+  size_type m_n;
+  size_type m_key;
+  int m_log2_buckets = 0;
+  size_type m_num_blocks;
+  size_type m_block_size;
+
+  size_type block_begin(size_type block) const
+  {
+    return ::cuda::std::min(block * m_block_size, m_n);
+  }
+
+  size_type block_end(size_type block) const
+  {
+    return ::cuda::std::min((block + 1) * m_block_size, m_n);
+  }
+
+  // Every (kind, index) pair gets its own stream, 2^128 draws away from all others.
+  engine_type make_engine(size_type kind, size_type index) const
+  {
+    engine_type engine(m_key);
+    engine.set_counter(::cuda::std::array<engine_type::result_type, 4>{kind, index, 0, 0});
+    return engine;
+  }
+
+  // Uniform integer in [0, bound), without bias.
+  static size_type uniform_below(engine_type& engine, size_type bound)
+  {
+    if (bound <= (size_type{1} << 32))
+    {
+      // Lemire, "Fast random integer generation in an interval", 2019
+      size_type product = (engine() >> 32) * bound;
+      if (static_cast<std::uint32_t>(product) < bound)
+      {
+        const std::uint32_t threshold = static_cast<std::uint32_t>((size_type{1} << 32) % bound);
+        while (static_cast<std::uint32_t>(product) < threshold)
+        {
+          product = (engine() >> 32) * bound;
+        }
+      }
+      return product >> 32;
+    }
+    const size_type threshold = (0 - bound) % bound;
+    size_type r               = engine();
+    while (r < threshold)
+    {
+      r = engine();
+    }
+    return r % bound;
+  }
+
+  // The bucket of each element of a block, two per engine draw.
+  class bucket_generator
+  {
+  public:
+    bucket_generator(const bucket_shuffle& plan, size_type block)
+        : m_engine(plan.make_engine(scatter_stream, block))
+        , m_shift(32 - plan.m_log2_buckets)
+    {}
+
+    size_type operator()()
+    {
+      if (m_shift == 32)
+      {
+        return 0;
+      }
+      if (m_available == 0)
+      {
+        m_bits      = m_engine();
+        m_available = 2;
+      }
+      --m_available;
+      const size_type bucket = (m_bits & 0xFFFFFFFFu) >> m_shift;
+      m_bits >>= 32;
+      return bucket;
+    }
+
+  private:
+    engine_type m_engine;
+    int m_shift;
+    size_type m_bits = 0;
+    int m_available  = 0;
+  };
+};
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
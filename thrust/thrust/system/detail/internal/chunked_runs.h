@@ -0,0 +1,228 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file chunked_runs.h
+ *  \brief Finds the runs of equivalent elements of a range in parallel, one chunk of the range per worker.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/function.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+//! \brief Plan of a parallel run-length encoding of <tt>[first, first + n)</tt>, in which a run of equivalent elements
+//! belongs to the chunk that contains its first element, even if it continues into the following chunks.
+//!
+//! A parallel system
+//!   1. calls \c count for every chunk, in parallel, which summarizes the chunk in a \c chunk_summary;
+//!   2. calls \c scan on the <tt>num_chunks()</tt> summaries, which stitches the runs that cross chunk boundaries and
+//!      finds the position of the first run of every chunk in the output;
+//!   3. calls \c write for every chunk, in parallel.
+//! Only runs of at least \c min_length elements are counted and written, which is 1 for all runs and 2 for the
+//! non-trivial ones. Every chunk stops at its end, so a long run, e.g. of a mostly constant column, is inspected by the
+//! workers of all the chunks it spans: the scan adds their leading continuations to the length of the run.
+template <typename InputIterator, typename BinaryPredicate, typename Size>
+class chunked_runs
+{
+public:
+  // Below this number of elements per chunk, the cost of the scan and of the parallel loops dominates.
+  static constexpr Size min_chunk_size = Size{1} << 14;
+
+  //! \brief What \c count finds out about a chunk, and \c scan completes.
+  struct chunk_summary
+  {
+    // the number of runs which start and end in the chunk and are long enough
+    Size num_runs;
+    // the number of elements at the beginning of the chunk which continue the last run of the previous chunk, which is
+    // the size of the chunk if all of them do
+    Size lead;
+    // the first element of the last run which starts in the chunk, which is the end of the chunk if there is none
+    Size tail_head;
+    // the length of that run within the chunk, and after the scan its whole length, or 0 if it is too short
+    Size tail_length;
+    // the output position of the first run of the chunk, which is set by the scan
+    Size position;
+  };
+
+  chunked_runs(InputIterator first, Size n, BinaryPredicate pred, Size min_length, Size max_chunks)
+      : m_first(first)
+      , m_n(n)
+      , m_pred{pred}
+      , m_min_length(min_length)
+      , m_num_chunks((::cuda::std::max) (Size{1}, (::cuda::std::min) (max_chunks, n / min_chunk_size)))
+  {}
+
+  Size num_chunks() const
+  {
+    return m_num_chunks;
+  }
+
+  //! \brief Summarizes \p chunk in <tt>summaries[chunk]</tt>.
+  void count(Size chunk, chunk_summary* summaries) const
+  {
+    const Size begin = chunk_begin(chunk);
+    const Size end   = chunk_begin(chunk + 1);
+
+    Size i = begin;
+    if (begin > 0)
+    {
+      while (i < end && continues_run(i))
+      {
+        ++i;
+      }
+    }
+
+    chunk_summary summary{0, i - begin, end, 0, 0};
+    while (i < end)
+    {
+      const Size head = i++;
+      while (i < end && continues_run(i))
+      {
+        ++i;
+      }
+      if (i == end)
+      {
+        summary.tail_head   = head;
+        summary.tail_length = end - head;
+      }
+      else if (i - head >= m_min_length)
+      {
+        ++summary.num_runs;
+      }
+    }
+    summaries[chunk] = summary;
+  }
+
+  //! \brief Adds the continuation in the following chunks to the last run of every chunk, finds the output position of
+  //! the first run of every chunk, and returns the total number of runs.
+  Size scan(chunk_summary* summaries) const
+  {
+    Size position = 0;
+    for (Size chunk = 0; chunk < m_num_chunks; ++chunk)
+    {
+      chunk_summary& summary = summaries[chunk];
+      summary.position       = position;
+      position += summary.num_runs;
+
+      if (summary.tail_length == 0)
+      {
+        continue;
+      }
+
+      // the run continues through every following chunk which only continues it, and ends in the next one
+      Size next = chunk + 1;
+      while (next < m_num_chunks && summaries[next].lead == chunk_begin(next + 1) - chunk_begin(next))
+      {
+        summary.tail_length += summaries[next].lead;
+        ++next;
+      }
+      if (next < m_num_chunks)
+      {
+        summary.tail_length += summaries[next].lead;
+      }
+
+      if (summary.tail_length >= m_min_length)
+      {
+        ++position;
+      }
+      else
+      {
+        summary.tail_length = 0;
+      }
+    }
+    return position;
+  }
+
+  //! \brief Calls <tt>writer(position, head, length)</tt> for every run of \p chunk, where \c head is the index of its
+  //! first element and \c position its index in the output.
+  template <typename Writer>
+  void write(Size chunk, const chunk_summary* summaries, Writer writer) const
+  {
+    const chunk_summary& summary = summaries[chunk];
+
+    Size position = summary.position;
+    Size i        = chunk_begin(chunk) + summary.lead;
+    while (i < summary.tail_head)
+    {
+      const Size head = i++;
+      while (i < summary.tail_head && continues_run(i))
+      {
+        ++i;
+      }
+      if (i - head >= m_min_length)
+      {
+        writer(position++, head, i - head);
+      }
+    }
+
+    if (summary.tail_length != 0)
+    {
+      writer(position, summary.tail_head, summary.tail_length);
+    }
+  }
+
+private:
+  Size chunk_begin(Size chunk) const
+  {
+    return chunk * m_n / m_num_chunks;
+  }
+
+  bool continues_run(Size i) const
+  {
+    return m_pred(m_first[i - 1], m_first[i]);
+  }
+
+  InputIterator m_first;
+  Size m_n;
+  thrust::detail::wrapped_function<BinaryPredicate, bool> m_pred;
+  Size m_min_length;
+  Size m_num_chunks;
+};
+
+//! \brief Writes the first element and the length of every run, for \c run_length_encode.
+template <typename InputIterator, typename OutputIterator1, typename OutputIterator2>
+struct run_length_encode_writer
+{
+  InputIterator first;
+  OutputIterator1 unique_output;
+  OutputIterator2 counts_output;
+
+  template <typename Size>
+  void operator()(Size position, Size head, Size length) const
+  {
+    unique_output[position] = first[head];
+    counts_output[position] = length;
+  }
+};
+
+//! \brief Writes the offset and the length of every run, for \c non_trivial_runs.
+template <typename OutputIterator1, typename OutputIterator2>
+struct non_trivial_runs_writer
+{
+  OutputIterator1 offsets_output;
+  OutputIterator2 lengths_output;
+
+  template <typename Size>
+  void operator()(Size position, Size head, Size length) const
+  {
+    offsets_output[position] = head;
+    lengths_output[position] = length;
+  }
+};
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
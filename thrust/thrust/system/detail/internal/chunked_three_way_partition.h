@@ -0,0 +1,156 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file chunked_three_way_partition.h
+ *  \brief Partitions a range into three groups in parallel, one chunk of the range per worker.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/function.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+//! \brief Plan of a parallel, stable partition of <tt>[first, first + n)</tt> into the elements that satisfy
+//! \c select_first_part, the other elements that satisfy \c select_second_part, and the unselected elements.
+//!
+//! A parallel system
+//!   1. calls \c count for every chunk, in parallel, which stores the sizes of the three groups of the chunk in
+//!      <tt>3 * (num_chunks() + 1)</tt> slots;
+//!   2. calls \c scan on those slots, a single prefix sum of the sizes of the three groups of all chunks;
+//!   3. calls \c write for every chunk, in parallel, which copies every element straight to its final position.
+template <typename RandomAccessIterator, typename Predicate1, typename Predicate2, typename Size>
+class chunked_three_way_partition
+{
+public:
+  // Below this number of elements per chunk, the cost of the scan and of the parallel loops dominates.
+  static constexpr Size min_chunk_size = Size{1} << 14;
+
+  chunked_three_way_partition(RandomAccessIterator first,
+                              Size n,
+                              Predicate1 select_first_part,
+                              Predicate2 select_second_part,
+                              Size max_chunks)
+      : m_first(first)
+      , m_n(n)
+      , m_select_first_part{select_first_part}
+      , m_select_second_part{select_second_part}
+      , m_num_chunks((::cuda::std::max) (Size{1}, (::cuda::std::min) (max_chunks, n / min_chunk_size)))
+  {}
+
+  Size num_chunks() const
+  {
+    return m_num_chunks;
+  }
+
+  //! \brief Stores the sizes of the three groups of \p chunk in <tt>counts[3 * (chunk + 1), 3 * (chunk + 2))</tt>.
+  void count(Size chunk, Size* counts) const
+  {
+    Size sizes[3] = {0, 0, 0};
+    for (Size i = begin(chunk); i < end(chunk); ++i)
+    {
+      ++sizes[group(i)];
+    }
+    for (int g = 0; g < 3; ++g)
+    {
+      counts[3 * (chunk + 1) + g] = sizes[g];
+    }
+  }
+
+  //! \brief Turns the <tt>3 * (num_chunks() + 1)</tt> slots filled by \c count into the output positions of the first
+  //! element of every group of every chunk. The last three slots end up with the ends of the three groups. If
+  //! \p concatenate is \c true, the groups follow each other in a single output, otherwise each has its own.
+  void scan(Size* counts, bool concatenate) const
+  {
+    for (int g = 0; g < 3; ++g)
+    {
+      counts[g] = 0;
+    }
+    for (Size i = 3; i < 3 * (m_num_chunks + 1); ++i)
+    {
+      counts[i] += counts[i - 3];
+    }
+
+    if (concatenate)
+    {
+      const Size second_part = counts[3 * m_num_chunks];
+      const Size unselected  = second_part + counts[3 * m_num_chunks + 1];
+      for (Size chunk = 0; chunk <= m_num_chunks; ++chunk)
+      {
+        counts[3 * chunk + 1] += second_part;
+        counts[3 * chunk + 2] += unselected;
+      }
+    }
+  }
+
+  //! \brief Copies every element of \p chunk to \p out_first_part, \p out_second_part or \p out_unselected, at the
+  //! positions found by \c scan.
+  template <typename OutputIterator1, typename OutputIterator2, typename OutputIterator3>
+  void write(Size chunk,
+             const Size* positions,
+             OutputIterator1 out_first_part,
+             OutputIterator2 out_second_part,
+             OutputIterator3 out_unselected) const
+  {
+    Size first_part  = positions[3 * chunk];
+    Size second_part = positions[3 * chunk + 1];
+    Size unselected  = positions[3 * chunk + 2];
+    for (Size i = begin(chunk); i < end(chunk); ++i)
+    {
+      switch (group(i))
+      {
+        case 0:
+          out_first_part[first_part++] = m_first[i];
+          break;
+        case 1:
+          out_second_part[second_part++] = m_first[i];
+          break;
+        default:
+          out_unselected[unselected++] = m_first[i];
+          break;
+      }
+    }
+  }
+
+private:
+  Size begin(Size chunk) const
+  {
+    return chunk * m_n / m_num_chunks;
+  }
+
+  Size end(Size chunk) const
+  {
+    return (chunk + 1) * m_n / m_num_chunks;
+  }
+
+  int group(Size i) const
+  {
+    if (m_select_first_part(m_first[i]))
+    {
+      return 0;
+    }
+    return m_select_second_part(m_first[i]) ? 1 : 2;
+  }
+
+  RandomAccessIterator m_first;
+  Size m_n;
+  thrust::detail::wrapped_function<Predicate1, bool> m_select_first_part;
+  thrust::detail::wrapped_function<Predicate2, bool> m_select_second_part;
+  Size m_num_chunks;
+};
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
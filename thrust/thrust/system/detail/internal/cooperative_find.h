@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file cooperative_find.h
+ *  \brief A find_if for the parallel host systems that stops as soon as the result is known.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/function.h>
+
+#include <cuda/std/__algorithm/min.h>
+
+#include <atomic>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+//! \brief Shared state of a find_if whose workers stop as soon as no earlier match can appear.
+//!
+//! Every worker calls \c run, which repeatedly claims the next block of the input from a shared cursor and scans it.
+//! Blocks are claimed in increasing order, so once a worker finds a match, no block that starts after it has to be
+//! looked at. The earliest match is published with an atomic min, and workers stop claiming blocks that start at or
+//! after it. Each worker starts with a small block, so that matches near the beginning are found quickly, and doubles
+//! its block size after every block, so that the cursor is not contended when there is no early match.
+//!
+//! The result is only meaningful once all workers have returned from \c run.
+template <typename Size>
+class cooperative_find
+{
+public:
+  static constexpr Size initial_block_size = 256;
+  static constexpr Size max_block_size     = Size{1} << 14;
+
+  // Below this size, forking workers costs more than scanning the input sequentially.
+  static constexpr Size sequential_threshold = Size{1} << 12;
+
+  explicit cooperative_find(Size n)
+      : m_n(n)
+      , m_next(0)
+      , m_result(n)
+  {}
+
+  //! \brief Scans blocks of <tt>[first, first + n)</tt> until no earlier match than the current one can appear.
+  template <typename InputIterator, typename Predicate>
+  void run(InputIterator first, Predicate pred)
+  {
+    thrust::detail::wrapped_function<Predicate, bool> wrapped_pred{pred};
+
+    Size block_size = initial_block_size;
+    for (;;)
+    {
+      const Size begin = m_next.fetch_add(block_size, std::memory_order_relaxed);
+
+      // the result is at most n, so this also stops at the end of the input
+      if (begin >= m_result.load(std::memory_order_relaxed))
+      {
+        return;
+      }
+
+      const Size end    = (::cuda::std::min) (begin + block_size, m_n);
+      InputIterator pos = first + begin;
+      for (Size i = begin; i < end; ++i, ++pos)
+      {
+        if (wrapped_pred(*pos))
+        {
+          publish(i);
+          return;
+        }
+      }
+
+      block_size = (::cuda::std::min) (block_size * 2, max_block_size);
+    }
+  }
+
+  //! \brief The index of the first match, or \c n if there is none.
+  Size result() const
+  {
+    return m_result.load(std::memory_order_relaxed);
+  }
+
+private:
+  Size m_n;
+  std::atomic<Size> m_next;
+  std::atomic<Size> m_result;
+
+  void publish(Size i)
+  {
+    Size current = m_result.load(std::memory_order_relaxed);
+    while (i < current && !m_result.compare_exchange_weak(current, i, std::memory_order_relaxed))
+    {
+    }
+  }
+};
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
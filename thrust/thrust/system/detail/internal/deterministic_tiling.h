@@ -0,0 +1,163 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file deterministic_tiling.h
+ *  \brief Building blocks of reductions and scans whose results do not depend on the number of threads.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/raw_reference_cast.h>
+
+#include <cuda/std/__algorithm/min.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+//! \brief Splits an input into tiles whose size only depends on the input size.
+//!
+//! A parallel system reduces or scans every tile sequentially, in any order and on any thread, and then combines the
+//! per-tile results in a fixed order. Since neither the tiles nor the order in which their results are combined depend
+//! on the number of threads, the result is the same for every run, even for operators that are not associative, such
+//! as floating-point addition.
+//!
+//! A reduction:
+//!   1. \c reduce_tile for every tile, in parallel;
+//!   2. \c combine, sequentially.
+//! A scan:
+//!   1. \c reduce_tile for every tile, in parallel;
+//!   2. \c prefixes, sequentially;
+//!   3. \c inclusive_scan_tile or \c exclusive_scan_tile for every tile, in parallel.
+//! An input of at most \c tile_size elements is a single tile, and its results are those of a sequential algorithm.
+template <typename Size>
+class deterministic_tiling
+{
+public:
+  static constexpr Size tile_size = Size{1} << 12;
+
+  explicit deterministic_tiling(Size n)
+      : m_n(n)
+      , m_num_tiles((n + tile_size - 1) / tile_size)
+  {}
+
+  Size size() const
+  {
+    return m_num_tiles;
+  }
+
+  Size tile_begin(Size tile) const
+  {
+    return tile * tile_size;
+  }
+
+  Size tile_end(Size tile) const
+  {
+    return (::cuda::std::min) (tile_begin(tile) + tile_size, m_n);
+  }
+
+  //! \brief Writes the left fold of \p tile, starting with its first element, to <tt>partials[tile]</tt>.
+  template <typename InputIterator, typename T, typename BinaryFunction>
+  void reduce_tile(Size tile, InputIterator first, T* partials, BinaryFunction binary_op) const
+  {
+    InputIterator iter = first + tile_begin(tile);
+    T sum              = thrust::raw_reference_cast(*iter);
+    ++iter;
+    for (Size i = tile_begin(tile) + 1; i < tile_end(tile); ++i, ++iter)
+    {
+      sum = binary_op(sum, *iter);
+    }
+    partials[tile] = sum;
+  }
+
+  //! \brief Combines the per-tile results in a fixed pairwise tree, which also bounds the rounding error of a
+  //! floating-point sum by O(log n) instead of O(n), and returns <tt>binary_op(init, total)</tt>.
+  template <typename T, typename BinaryFunction>
+  T combine(T init, T* partials, BinaryFunction binary_op) const
+  {
+    for (Size stride = 1; stride < m_num_tiles; stride *= 2)
+    {
+      for (Size i = 0; i + stride < m_num_tiles; i += 2 * stride)
+      {
+        partials[i] = binary_op(partials[i], partials[i + stride]);
+      }
+    }
+    return binary_op(init, partials[0]);
+  }
+
+  //! \brief Replaces the per-tile results with the value that precedes each tile in a scan without an initial value.
+  //! The first tile has no prefix, and <tt>partials[0]</tt> is left unchanged.
+  template <typename T, typename BinaryFunction>
+  void prefixes(T* partials, BinaryFunction binary_op) const
+  {
+    exclusive_prefixes(partials, 1, partials[0], binary_op);
+  }
+
+  //! \brief Replaces the per-tile results with the value that precedes each tile in a scan that starts with \p init.
+  template <typename T, typename InitialValueType, typename BinaryFunction>
+  void prefixes(T* partials, InitialValueType init, BinaryFunction binary_op) const
+  {
+    exclusive_prefixes(partials, 0, T(init), binary_op);
+  }
+
+  template <bool HasInit, typename InputIterator, typename OutputIterator, typename T, typename BinaryFunction>
+  void inclusive_scan_tile(
+    Size tile, InputIterator first, OutputIterator result, const T* partials, BinaryFunction binary_op) const
+  {
+    InputIterator iter   = first + tile_begin(tile);
+    OutputIterator out   = result + tile_begin(tile);
+    Size i               = tile_begin(tile);
+    const bool no_prefix = !HasInit && tile == 0;
+
+    T sum = no_prefix ? T(thrust::raw_reference_cast(*iter)) : binary_op(partials[tile], *iter);
+    *out  = sum;
+    for (++i, ++iter, ++out; i < tile_end(tile); ++i, ++iter, ++out)
+    {
+      sum  = binary_op(sum, *iter);
+      *out = sum;
+    }
+  }
+
+  template <typename InputIterator, typename OutputIterator, typename T, typename BinaryFunction>
+  void exclusive_scan_tile(
+    Size tile, InputIterator first, OutputIterator result, const T* partials, BinaryFunction binary_op) const
+  {
+    InputIterator iter = first + tile_begin(tile);
+    OutputIterator out = result + tile_begin(tile);
+
+    T sum = partials[tile];
+    for (Size i = tile_begin(tile); i < tile_end(tile); ++i, ++iter, ++out)
+    {
+      // read the input before writing the output, which may alias it
+      T next = binary_op(sum, *iter);
+      *out   = sum;
+      sum    = next;
+    }
+  }
+
+private:
+  Size m_n;
+  Size m_num_tiles;
+
+  template <typename T, typename BinaryFunction>
+  void exclusive_prefixes(T* partials, Size tile, T running, BinaryFunction binary_op) const
+  {
+    for (; tile < m_num_tiles; ++tile)
+    {
+      T sum          = partials[tile];
+      partials[tile] = running;
+      running        = binary_op(running, sum);
+    }
+  }
+};
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
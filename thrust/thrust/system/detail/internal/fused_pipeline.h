@@ -0,0 +1,605 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/iterator/iterator_traits.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__type_traits/decay.h>
+#include <cuda/std/__functional/invoke.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/optional>
+#include <cuda/std/tuple>
+#include <cuda/std/utility>
+
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+// The machinery behind thrust::pipeline: the stages, the terminals, and fused_pipeline, which runs a pipeline in a
+// single pass over its input.
+//
+// The input is split into tiles, which are small enough for their intermediate results to stay in the cache. The
+// workers claim the tiles in order, and push the elements of a tile through the map and filter stages one at a time.
+// The elements that reach a scan stage, or the terminal, are collected in a buffer of the tile, so filters compact
+// within the tile. A scan stage scans its buffer, then waits for the carry of the previous tile, which it publishes
+// combined with the aggregate of the tile for the next one, before it applies the carry and pushes the elements on.
+// The terminals which write their results in order, copy and reduce_by_key, carry the output position in the same
+// way. Only these short handovers are ordered: the tiles are otherwise processed concurrently by all workers.
+
+template <typename F>
+struct pipeline_map
+{
+  F f;
+};
+
+template <typename Predicate>
+struct pipeline_filter
+{
+  Predicate pred;
+};
+
+template <typename BinaryFunction>
+struct pipeline_scan
+{
+  BinaryFunction op;
+};
+
+// the type of the elements after a stage, given the type of the elements before it
+template <typename Stage, typename T>
+struct pipeline_stage_result
+{
+  using type = T;
+};
+
+template <typename F, typename T>
+struct pipeline_stage_result<pipeline_map<F>, T>
+{
+  using type = ::cuda::std::decay_t<::cuda::std::invoke_result_t<const F&, T&>>;
+};
+
+// the type of the elements after the first I stages of Stages, a tuple of stages, given the type of the input
+template <typename T, typename Stages, ::cuda::std::size_t I>
+struct pipeline_stream
+{
+  using type = typename pipeline_stage_result<::cuda::std::tuple_element_t<I - 1, Stages>,
+                                              typename pipeline_stream<T, Stages, I - 1>::type>::type;
+};
+
+template <typename T, typename Stages>
+struct pipeline_stream<T, Stages, 0>
+{
+  using type = T;
+};
+
+template <typename T, typename Stages, ::cuda::std::size_t I = ::cuda::std::tuple_size_v<Stages>>
+using pipeline_stream_t = typename pipeline_stream<T, Stages, I>::type;
+
+template <typename Stage>
+inline constexpr bool is_pipeline_map_v = false;
+
+template <typename F>
+inline constexpr bool is_pipeline_map_v<pipeline_map<F>> = true;
+
+template <typename Stage>
+inline constexpr bool is_pipeline_scan_v = false;
+
+template <typename BinaryFunction>
+inline constexpr bool is_pipeline_scan_v<pipeline_scan<BinaryFunction>> = true;
+
+// the terminal which folds the elements with init, in order
+template <typename T, typename BinaryFunction>
+struct pipeline_reduce_terminal
+{
+  using carry_type = ::cuda::std::optional<T>;
+  using local_type = ::cuda::std::optional<T>;
+
+  T init;
+  BinaryFunction op;
+
+  template <typename U>
+  void push(local_type& partial, U& x) const
+  {
+    if (partial)
+    {
+      *partial = op(*partial, x);
+    }
+    else
+    {
+      partial.emplace(x);
+    }
+  }
+
+  template <typename Context>
+  void finish_tile(local_type& partial, Context& context) const
+  {
+    // the partial results are folded in order once all tiles are done, so the tiles do not wait for each other
+    context.own() = ::cuda::std::move(partial);
+    partial.reset();
+  }
+
+  template <typename Carries>
+  T result(Carries carries, ::cuda::std::size_t num_tiles) const
+  {
+    T sum = init;
+    for (::cuda::std::size_t tile = 0; tile < num_tiles; ++tile)
+    {
+      if (carries(tile))
+      {
+        sum = op(sum, *carries(tile));
+      }
+    }
+    return sum;
+  }
+};
+
+// the terminal which writes the elements to consecutive outputs
+template <typename OutputIterator, typename T>
+struct pipeline_copy_terminal
+{
+  // the number of elements written by the tiles up to this one
+  using carry_type = ::cuda::std::size_t;
+  using local_type = std::vector<T>;
+
+  OutputIterator output;
+
+  template <typename U>
+  void push(local_type& buffer, U& x) const
+  {
+    buffer.push_back(x);
+  }
+
+  template <typename Context>
+  void finish_tile(local_type& buffer, Context& context) const
+  {
+    const carry_type* predecessor = context.predecessor();
+    const carry_type offset       = predecessor ? *predecessor : 0;
+    context.own()                 = offset + buffer.size();
+    context.publish();
+
+    OutputIterator result = output + offset;
+    for (T& x : buffer)
+    {
+      *result = ::cuda::std::move(x);
+      ++result;
+    }
+    buffer.clear();
+  }
+
+  template <typename Carries>
+  OutputIterator result(Carries carries, ::cuda::std::size_t num_tiles) const
+  {
+    return num_tiles == 0 ? output : output + carries(num_tiles - 1);
+  }
+};
+
+// the terminal which writes the first element of every tuple to the position given by the second
+template <typename OutputIterator>
+struct pipeline_scatter_terminal
+{
+  struct carry_type
+  {};
+  struct local_type
+  {};
+
+  OutputIterator output;
+
+  template <typename U>
+  void push(local_type&, U& x) const
+  {
+    output[::cuda::std::get<1>(x)] = ::cuda::std::get<0>(x);
+  }
+
+  template <typename Context>
+  void finish_tile(local_type&, Context&) const
+  {}
+
+  template <typename Carries>
+  void result(Carries, ::cuda::std::size_t) const
+  {}
+};
+
+// the terminal which reduces the runs of equal keys of (key, value) tuples. Like thrust::reduce_by_key, it compares each
+// key with the previous one, so a run continues as long as consecutive keys are equal.
+template <typename KeysOutputIterator,
+          typename ValuesOutputIterator,
+          typename Key,
+          typename Value,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+struct pipeline_reduce_by_key_terminal
+{
+  struct run_type
+  {
+    // the first key of the run, which is written to the output
+    Key key;
+    // the last key of the run, which the next key is compared with
+    Key last_key;
+    Value value;
+  };
+
+  struct carry_type
+  {
+    // the number of runs written by the tiles up to this one
+    ::cuda::std::size_t flushed = 0;
+    // the last run of these tiles, which the next tiles may extend
+    ::cuda::std::optional<run_type> pending;
+  };
+
+  // the runs of the tile, reduced before waiting for the previous tile
+  using local_type = std::vector<run_type>;
+
+  KeysOutputIterator keys_output;
+  ValuesOutputIterator values_output;
+  BinaryPredicate pred;
+  BinaryFunction op;
+
+  template <typename U>
+  void push(local_type& runs, U& x) const
+  {
+    if (!runs.empty() && pred(runs.back().last_key, ::cuda::std::get<0>(x)))
+    {
+      runs.back().last_key = ::cuda::std::get<0>(x);
+      runs.back().value    = op(runs.back().value, ::cuda::std::get<1>(x));
+    }
+    else
+    {
+      runs.push_back(run_type{::cuda::std::get<0>(x), ::cuda::std::get<0>(x), ::cuda::std::get<1>(x)});
+    }
+  }
+
+  void write(::cuda::std::size_t position, run_type& run) const
+  {
+    keys_output[position]   = ::cuda::std::move(run.key);
+    values_output[position] = ::cuda::std::move(run.value);
+  }
+
+  template <typename Context>
+  void finish_tile(local_type& runs, Context& context) const
+  {
+    const carry_type* predecessor = context.predecessor();
+    carry_type& carry             = context.own();
+    if (predecessor)
+    {
+      carry = *predecessor;
+    }
+    if (runs.empty())
+    {
+      context.publish();
+      return;
+    }
+
+    // the last run of the previous tiles either continues into the first run of this tile, or ends before it
+    ::cuda::std::size_t position = carry.flushed;
+    ::cuda::std::optional<run_type> ended;
+    if (carry.pending)
+    {
+      if (pred(carry.pending->last_key, runs.front().key))
+      {
+        runs.front().key   = ::cuda::std::move(carry.pending->key);
+        runs.front().value = op(carry.pending->value, runs.front().value);
+      }
+      else
+      {
+        ended = ::cuda::std::move(carry.pending);
+      }
+    }
+    carry.flushed = position + (ended ? 1 : 0) + runs.size() - 1;
+    carry.pending.emplace(runs.back());
+    context.publish();
+
+    if (ended)
+    {
+      write(position++, *ended);
+    }
+    for (::cuda::std::size_t i = 0; i + 1 < runs.size(); ++i)
+    {
+      write(position++, runs[i]);
+    }
+    runs.clear();
+  }
+
+  template <typename Carries>
+  ::cuda::std::pair<KeysOutputIterator, ValuesOutputIterator>
+  result(Carries carries, ::cuda::std::size_t num_tiles) const
+  {
+    ::cuda::std::size_t size = 0;
+    if (num_tiles != 0)
+    {
+      carry_type& last = carries(num_tiles - 1);
+      size             = last.flushed;
+      if (last.pending)
+      {
+        write(size++, *last.pending);
+      }
+    }
+    return ::cuda::std::make_pair(keys_output + size, values_output + size);
+  }
+};
+
+// thrown to the workers that wait for a tile whose worker failed
+struct pipeline_cancelled
+{};
+
+template <typename InputIterator, typename Stages, typename Terminal>
+class fused_pipeline
+{
+  static constexpr ::cuda::std::size_t num_stages = ::cuda::std::tuple_size_v<Stages>;
+
+  using input_type = thrust::detail::it_value_t<InputIterator>;
+
+  template <::cuda::std::size_t I>
+  using stream_t = pipeline_stream_t<input_type, Stages, I>;
+
+  using carry_type = typename Terminal::carry_type;
+
+  template <typename Indices>
+  struct stage_types;
+
+  template <::cuda::std::size_t... I>
+  struct stage_types<::cuda::std::index_sequence<I...>>
+  {
+    // the carry of every stage, of which only those of the scan stages are used
+    using carries = ::cuda::std::tuple<::cuda::std::optional<stream_t<I>>...>;
+    // the buffer of every stage, of which only those of the scan stages are used
+    using buffers = ::cuda::std::tuple<std::vector<stream_t<I>>...>;
+  };
+
+  using types = stage_types<::cuda::std::make_index_sequence<num_stages>>;
+
+  struct tile_state
+  {
+    // the number of stages whose carry the tile has published, where the terminal is the last stage
+    std::atomic<::cuda::std::size_t> progress{0};
+    typename types::carries carries;
+    carry_type terminal_carry;
+  };
+
+  struct worker_state
+  {
+    typename types::buffers buffers;
+    typename Terminal::local_type terminal;
+  };
+
+  // the view of the carries of the terminal for a tile
+  struct terminal_context
+  {
+    const fused_pipeline& pipeline;
+    ::cuda::std::size_t tile;
+
+    const carry_type* predecessor() const
+    {
+      const tile_state* state = pipeline.wait_for_predecessor(tile, num_stages);
+      return state ? &state->terminal_carry : nullptr;
+    }
+
+    carry_type& own() const
+    {
+      return pipeline.m_tiles[tile].terminal_carry;
+    }
+
+    void publish() const
+    {
+      pipeline.publish(tile, num_stages);
+    }
+  };
+
+public:
+  fused_pipeline(InputIterator first,
+                 ::cuda::std::size_t num_items,
+                 const Stages& stages,
+                 const Terminal& terminal,
+                 ::cuda::std::size_t tile_size)
+      : m_first(first)
+      , m_num_items(num_items)
+      , m_stages(stages)
+      , m_terminal(terminal)
+      , m_tile_size(::cuda::std::max<::cuda::std::size_t>(tile_size, 1))
+      , m_num_tiles((num_items + m_tile_size - 1) / m_tile_size)
+      , m_tiles(new tile_state[m_num_tiles])
+  {}
+
+  ::cuda::std::size_t num_tiles() const
+  {
+    return m_num_tiles;
+  }
+
+  // processes tiles until none is left; the tiles are shared between all workers that run concurrently. The workers
+  // do not throw, since an exception cannot leave an OpenMP parallel region: the exception of the first worker that
+  // fails cancels the others, and is rethrown by rethrow_if_failed once all workers are done.
+  void run_worker() noexcept
+  {
+    try
+    {
+      worker_state worker;
+      for (::cuda::std::size_t tile = m_next_tile.fetch_add(1, std::memory_order_relaxed);
+           tile < m_num_tiles && !m_cancelled.load(std::memory_order_relaxed);
+           tile = m_next_tile.fetch_add(1, std::memory_order_relaxed))
+      {
+        process(tile, worker);
+      }
+    }
+    catch (const pipeline_cancelled&)
+    {
+      // another worker failed, and its exception is rethrown
+    }
+    catch (...)
+    {
+      // the workers waiting for the carries of the tiles of this worker see the cancellation and stop
+      if (!m_cancelled.exchange(true, std::memory_order_relaxed))
+      {
+        m_exception = std::current_exception();
+      }
+    }
+  }
+
+  // rethrows the exception of the worker that failed, if any, once all workers are done
+  void rethrow_if_failed() const
+  {
+    if (m_exception)
+    {
+      std::rethrow_exception(m_exception);
+    }
+  }
+
+  // the result of the terminal, once all workers are done
+  auto result() const
+  {
+    return m_terminal.result(
+      [this](::cuda::std::size_t tile) -> carry_type& {
+        return m_tiles[tile].terminal_carry;
+      },
+      m_num_tiles);
+  }
+
+private:
+  void process(::cuda::std::size_t tile, worker_state& worker) const
+  {
+    const ::cuda::std::size_t first = tile * m_tile_size;
+    const ::cuda::std::size_t last  = ::cuda::std::min(first + m_tile_size, m_num_items);
+    for (::cuda::std::size_t i = first; i < last; ++i)
+    {
+      input_type x = m_first[i];
+      push<0>(worker, x);
+    }
+    drain<0>(tile, worker);
+
+    terminal_context context{*this, tile};
+    m_terminal.finish_tile(worker.terminal, context);
+  }
+
+  // pushes an element into stage I, which passes it on to the next stages up to the next scan stage, or the terminal
+  template <::cuda::std::size_t I, typename T>
+  void push(worker_state& worker, T& x) const
+  {
+    if constexpr (I == num_stages)
+    {
+      m_terminal.push(worker.terminal, x);
+    }
+    else
+    {
+      using stage_type        = ::cuda::std::tuple_element_t<I, Stages>;
+      const stage_type& stage = ::cuda::std::get<I>(m_stages);
+      if constexpr (is_pipeline_map_v<stage_type>)
+      {
+        stream_t<I + 1> y = stage.f(x);
+        push<I + 1>(worker, y);
+      }
+      else if constexpr (is_pipeline_scan_v<stage_type>)
+      {
+        ::cuda::std::get<I>(worker.buffers).push_back(x);
+      }
+      else
+      {
+        if (stage.pred(x))
+        {
+          push<I + 1>(worker, x);
+        }
+      }
+    }
+  }
+
+  // runs the scan stages from stage I on, in order, on the elements of the tile collected in their buffers
+  template <::cuda::std::size_t I>
+  void drain(::cuda::std::size_t tile, worker_state& worker) const
+  {
+    if constexpr (I < num_stages)
+    {
+      if constexpr (is_pipeline_scan_v<::cuda::std::tuple_element_t<I, Stages>>)
+      {
+        const auto& op = ::cuda::std::get<I>(m_stages).op;
+        auto& buffer   = ::cuda::std::get<I>(worker.buffers);
+        for (::cuda::std::size_t i = 1; i < buffer.size(); ++i)
+        {
+          buffer[i] = op(buffer[i - 1], buffer[i]);
+        }
+
+        // hand the total of the tiles up to this one over to the next tile, before applying the carry
+        const tile_state* predecessor = wait_for_predecessor(tile, I);
+        const auto* carry_in          = predecessor ? &::cuda::std::get<I>(predecessor->carries) : nullptr;
+        if (carry_in && !*carry_in)
+        {
+          // no element of the previous tiles reached this stage
+          carry_in = nullptr;
+        }
+        auto& carry_out = ::cuda::std::get<I>(m_tiles[tile].carries);
+        if (carry_in)
+        {
+          carry_out.emplace(buffer.empty() ? **carry_in : op(**carry_in, buffer.back()));
+        }
+        else if (!buffer.empty())
+        {
+          carry_out.emplace(buffer.back());
+        }
+        publish(tile, I);
+
+        for (auto& x : buffer)
+        {
+          if (carry_in)
+          {
+            x = op(**carry_in, x);
+          }
+          push<I + 1>(worker, x);
+        }
+        buffer.clear();
+      }
+      drain<I + 1>(tile, worker);
+    }
+  }
+
+  const tile_state* wait_for_predecessor(::cuda::std::size_t tile, ::cuda::std::size_t stage) const
+  {
+    if (tile == 0)
+    {
+      return nullptr;
+    }
+
+    // the previous tile was claimed before this one, by a worker that is running, so it makes progress
+    const tile_state& predecessor = m_tiles[tile - 1];
+    while (predecessor.progress.load(std::memory_order_acquire) <= stage)
+    {
+      if (m_cancelled.load(std::memory_order_relaxed))
+      {
+        throw pipeline_cancelled{};
+      }
+      std::this_thread::yield();
+    }
+    return &predecessor;
+  }
+
+  void publish(::cuda::std::size_t tile, ::cuda::std::size_t stage) const
+  {
+    m_tiles[tile].progress.store(stage + 1, std::memory_order_release);
+  }
+
+  InputIterator m_first;
+  ::cuda::std::size_t m_num_items;
+  Stages m_stages;
+  Terminal m_terminal;
+  ::cuda::std::size_t m_tile_size;
+  ::cuda::std::size_t m_num_tiles;
+  std::unique_ptr<tile_state[]> m_tiles;
+  std::atomic<::cuda::std::size_t> m_next_tile{0};
+  std::atomic<bool> m_cancelled{false};
+  std::exception_ptr m_exception;
+};
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
@@ -0,0 +1,151 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file histogram_bins.h
+ *  \brief Maps samples to histogram bins the same way cub::DeviceHistogram does.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/iterator/iterator_traits.h>
+
+#include <cuda/std/__type_traits/common_type.h>
+#include <cuda/std/__type_traits/conditional.h>
+#include <cuda/std/__type_traits/is_floating_point.h>
+#include <cuda/std/__type_traits/is_integral.h>
+#include <cuda/std/cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+//! \brief Maps a sample to one of <tt>num_levels - 1</tt> bins of equal width in <tt>[lower_level, upper_level)</tt>,
+//! or to -1 if it is outside of that range.
+//!
+//! Samples are compared and scaled in the common type of the sample and level types. Integral samples are scaled with
+//! an exact integer fraction, and floating-point samples with a precomputed reciprocal, like cub::DeviceHistogram::
+//! HistogramEven, so that both give the same bins for the same input.
+template <typename SampleT, typename LevelT>
+class even_bins
+{
+  using common_t = ::cuda::std::common_type_t<LevelT, SampleT>;
+
+  // large enough for (sample - lower_level) * num_bins, see cub::detail::histogram::Transforms::ScaleTransform
+  using int_arithmetic_t =
+    ::cuda::std::conditional_t<sizeof(SampleT) + sizeof(common_t) <= sizeof(::cuda::std::uint32_t),
+                               ::cuda::std::uint32_t,
+                               ::cuda::std::uint64_t>;
+
+public:
+  _CCCL_HOST_DEVICE even_bins(int num_levels, LevelT lower_level, LevelT upper_level)
+      : m_num_bins(num_levels - 1)
+      , m_min(static_cast<common_t>(lower_level))
+      , m_max(static_cast<common_t>(upper_level))
+      , m_bins(static_cast<common_t>(num_levels - 1))
+      , m_range(static_cast<common_t>(m_max - m_min))
+      , m_reciprocal(m_bins)
+  {
+    if constexpr (::cuda::std::is_floating_point_v<common_t>)
+    {
+      m_reciprocal = static_cast<common_t>(m_bins / m_range);
+    }
+  }
+
+  _CCCL_HOST_DEVICE int num_bins() const
+  {
+    return m_num_bins;
+  }
+
+  _CCCL_HOST_DEVICE int operator()(SampleT sample) const
+  {
+    const common_t value = static_cast<common_t>(sample);
+    if (!(value >= m_min && value < m_max))
+    {
+      return -1;
+    }
+
+    int bin;
+    if constexpr (::cuda::std::is_floating_point_v<common_t>)
+    {
+      bin = static_cast<int>((value - m_min) * m_reciprocal);
+    }
+    else if constexpr (::cuda::std::is_integral_v<common_t> && sizeof(common_t) <= sizeof(::cuda::std::uint64_t))
+    {
+      bin = static_cast<int>(static_cast<int_arithmetic_t>(value - m_min) * static_cast<int_arithmetic_t>(m_bins)
+                             / static_cast<int_arithmetic_t>(m_range));
+    }
+    else
+    {
+      bin = static_cast<int>(((value - m_min) * m_bins) / m_range);
+    }
+
+    // the rounding of the reciprocal may push samples just below upper_level past the last bin
+    return bin < m_num_bins ? bin : m_num_bins - 1;
+  }
+
+private:
+  int m_num_bins;
+  common_t m_min;
+  common_t m_max;
+  common_t m_bins;
+  common_t m_range;
+  common_t m_reciprocal;
+};
+
+//! \brief Maps a sample to the bin <tt>[levels[i], levels[i + 1])</tt> that contains it, or to -1 if there is none.
+//! \p levels is sorted, and the sample is converted to its value type before it is compared, like
+//! cub::DeviceHistogram::HistogramRange.
+template <typename LevelIterator, typename LevelT = thrust::detail::it_value_t<LevelIterator>>
+class range_bins
+{
+public:
+  _CCCL_HOST_DEVICE range_bins(int num_levels, LevelIterator levels)
+      : m_num_levels(num_levels)
+      , m_levels(levels)
+  {}
+
+  _CCCL_HOST_DEVICE int num_bins() const
+  {
+    return m_num_levels - 1;
+  }
+
+  template <typename SampleT>
+  _CCCL_HOST_DEVICE int operator()(SampleT sample) const
+  {
+    const LevelT value = static_cast<LevelT>(sample);
+
+    // upper bound of value in levels
+    int begin = 0;
+    int end   = m_num_levels;
+    while (begin < end)
+    {
+      const int mid = begin + (end - begin) / 2;
+      if (value < static_cast<LevelT>(m_levels[mid]))
+      {
+        end = mid;
+      }
+      else
+      {
+        begin = mid + 1;
+      }
+    }
+
+    const int bin = begin - 1;
+    return bin < num_bins() ? bin : -1;
+  }
+
+private:
+  int m_num_levels;
+  LevelIterator m_levels;
+};
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
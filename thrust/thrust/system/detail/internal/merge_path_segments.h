@@ -0,0 +1,425 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file merge_path_segments.h
+ *  \brief Splits the segments of a range and their elements into shares of the same size along a merge path.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/function.h>
+#include <thrust/iterator/iterator_traits.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+//! \brief Plan of a parallel loop over the segments <tt>[offsets_first[i], offsets_first[i + 1])</tt> of a range, which
+//! hands out the segments and their elements together.
+//!
+//! Walking the elements in order, the end of every segment is placed right after its last element, which lays out the
+//! segments and the elements along a single path. Every worker gets a share of the same length of this path, that is
+//! about the same number of segments plus elements, whatever the sizes of the segments: a segment with most of the
+//! elements is split among all workers, and so are millions of empty segments. A worker owns the segments which end in
+//! its share, and the pieces of the segments split among several workers are combined afterwards, in order.
+//!
+//! Every share has at least one segment end or element, so the elements right before the share of a worker which
+//! continues a segment are the last piece of the previous worker.
+template <typename OffsetIterator, typename Size>
+class merge_path_segments
+{
+public:
+  // Below this number of segments plus elements per worker, the cost of the parallel loops dominates.
+  static constexpr Size min_share_size = Size{1} << 14;
+
+  //! \brief A point of the path: the segments before it have ended, and \c element is the next element.
+  struct coordinate
+  {
+    Size segment;
+    Size element;
+  };
+
+  merge_path_segments(OffsetIterator offsets_first, Size num_segments, Size max_workers)
+      : m_offsets_first(offsets_first)
+      , m_num_segments(num_segments)
+      , m_begin(num_segments > 0 ? Size(offsets_first[0]) : Size{0})
+      , m_n(num_segments > 0 ? Size(offsets_first[num_segments]) - m_begin : Size{0})
+      , m_num_workers(
+          (::cuda::std::max) (Size{1}, (::cuda::std::min) (max_workers, (num_segments + m_n) / min_share_size)))
+  {}
+
+  Size num_workers() const
+  {
+    return m_num_workers;
+  }
+
+  Size num_segments() const
+  {
+    return m_num_segments;
+  }
+
+  Size segment_begin(Size segment) const
+  {
+    return Size(m_offsets_first[segment]);
+  }
+
+  Size segment_end(Size segment) const
+  {
+    return Size(m_offsets_first[segment + 1]);
+  }
+
+  //! \brief The point where the share of \p worker begins, found by a binary search along the diagonal of the segments
+  //! and the elements.
+  coordinate split(Size worker) const
+  {
+    const Size diagonal = worker * (m_num_segments + m_n) / m_num_workers;
+
+    Size first = (::cuda::std::max) (Size{0}, diagonal - m_n);
+    Size last  = (::cuda::std::min) (diagonal, m_num_segments);
+    while (first < last)
+    {
+      // a segment ends before the elements that follow its last element
+      const Size pivot = first + (last - first) / 2;
+      if (segment_end(pivot) - m_begin <= diagonal - pivot - 1)
+      {
+        first = pivot + 1;
+      }
+      else
+      {
+        last = pivot;
+      }
+    }
+    return {first, m_begin + diagonal - first};
+  }
+
+  //! \brief Whether the share beginning at \p b continues a segment which began in an earlier share.
+  bool continues_segment(coordinate b) const
+  {
+    return b.segment < m_num_segments && segment_begin(b.segment) < b.element;
+  }
+
+  //! \brief Calls <tt>f(segment, first, last, ends)</tt> for the elements <tt>[first, last)</tt> of every segment in
+  //! the share of \p worker, in order. \c ends tells whether the segment ends in the share, in which case \c f is
+  //! called even if the share has none of its elements.
+  template <typename F>
+  void for_each_piece(Size worker, F f) const
+  {
+    const coordinate b = split(worker);
+    const coordinate e = split(worker + 1);
+    for (Size segment = b.segment; segment < e.segment; ++segment)
+    {
+      f(segment, (::cuda::std::max) (b.element, segment_begin(segment)), segment_end(segment), true);
+    }
+    if (e.segment < m_num_segments)
+    {
+      const Size first = (::cuda::std::max) (b.element, segment_begin(e.segment));
+      if (first < e.element)
+      {
+        f(e.segment, first, e.element, false);
+      }
+    }
+  }
+
+private:
+  OffsetIterator m_offsets_first;
+  Size m_num_segments;
+  Size m_begin;
+  Size m_n;
+  Size m_num_workers;
+};
+
+//! \brief Plan of a parallel reduction of every segment of <tt>[first, first + n)</tt>, which starts from
+//! <tt>init(segment)</tt>.
+//!
+//! A parallel system
+//!   1. calls \c reduce for every worker, in parallel, which hands the reductions of the segments that begin and end in
+//!      the share of the worker to \c output, and keeps the pieces of the segments split among several workers in
+//!      <tt>heads[worker]</tt> and <tt>tails[worker]</tt>;
+//!   2. calls \c fixup, which combines these pieces in order and hands the reductions of the split segments to
+//!      \c output.
+template <typename OffsetIterator,
+          typename InputIterator,
+          typename T,
+          typename InitFunction,
+          typename BinaryFunction,
+          typename Size>
+class segmented_reduce_plan
+{
+public:
+  using value_type = T;
+
+  segmented_reduce_plan(const merge_path_segments<OffsetIterator, Size>& path,
+                        InputIterator first,
+                        InitFunction init,
+                        BinaryFunction binary_op)
+      : m_path(path)
+      , m_first(first)
+      , m_init(init)
+      , m_binary_op{binary_op}
+  {}
+
+  Size num_workers() const
+  {
+    return m_path.num_workers();
+  }
+
+  //! \brief Calls <tt>output(segment, reduction)</tt> for the segments that begin and end in the share of \p worker,
+  //! and keeps the reductions of its first and last pieces in <tt>heads[worker]</tt> and <tt>tails[worker]</tt> if
+  //! their segments are split with other workers.
+  template <typename OutputFunction>
+  void reduce(Size worker, OutputFunction output, T* heads, T* tails) const
+  {
+    m_path.for_each_piece(worker, [&](Size segment, Size first, Size last, bool ends) {
+      if (first == m_path.segment_begin(segment))
+      {
+        const T sum = accumulate(m_init(segment), first, last);
+        if (ends)
+        {
+          output(segment, sum);
+        }
+        else
+        {
+          tails[worker] = sum;
+        }
+      }
+      else if (first < last)
+      {
+        const T sum = accumulate(m_first[first], first + 1, last);
+        if (ends)
+        {
+          heads[worker] = sum;
+        }
+        else
+        {
+          tails[worker] = sum;
+        }
+      }
+    });
+  }
+
+  //! \brief Combines the pieces kept by \c reduce, in order, and calls <tt>output(segment, reduction)</tt> for the
+  //! segments split among several workers.
+  template <typename OutputFunction>
+  void fixup(OutputFunction output, const T* heads, T* tails) const
+  {
+    for (Size worker = 1; worker < m_path.num_workers(); ++worker)
+    {
+      const auto b = m_path.split(worker);
+      if (!m_path.continues_segment(b))
+      {
+        continue;
+      }
+
+      if (b.segment < m_path.split(worker + 1).segment)
+      {
+        // the segment ends in this share, maybe right at its beginning
+        output(b.segment,
+               b.element < m_path.segment_end(b.segment) ? m_binary_op(tails[worker - 1], heads[worker])
+                                                         : tails[worker - 1]);
+      }
+      else
+      {
+        // the segment goes on after this share
+        tails[worker] = m_binary_op(tails[worker - 1], tails[worker]);
+      }
+    }
+  }
+
+private:
+  T accumulate(T sum, Size first, Size last) const
+  {
+    for (; first < last; ++first)
+    {
+      sum = m_binary_op(sum, m_first[first]);
+    }
+    return sum;
+  }
+
+  merge_path_segments<OffsetIterator, Size> m_path;
+  InputIterator m_first;
+  InitFunction m_init;
+  thrust::detail::wrapped_function<BinaryFunction, T> m_binary_op;
+};
+
+//! \brief The initial value of the reductions of all segments, for \c segmented_reduce_plan.
+template <typename T>
+struct same_init
+{
+  T init;
+
+  template <typename Size>
+  T operator()(Size) const
+  {
+    return init;
+  }
+};
+
+//! \brief The initial value of the reductions of positions, for \c segmented_reduce_plan: the position of the first
+//! element of the segment, which is also where an empty segment points to.
+template <typename OffsetIterator, typename Size>
+struct segment_begin_init
+{
+  OffsetIterator offsets_first;
+
+  Size operator()(Size segment) const
+  {
+    return Size(offsets_first[segment]);
+  }
+};
+
+//! \brief Reduces two positions in <tt>[first, first + n)</tt> to the one of the first element that no other element
+//! comes before in the order \c comp. The reduction of the positions of a segment starting from \c segment_begin_init
+//! is the position of the first smallest element of the segment.
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+struct first_smallest_position
+{
+  RandomAccessIterator first;
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> comp;
+
+  template <typename Size>
+  Size operator()(Size lhs, Size rhs) const
+  {
+    return comp(first[rhs], first[lhs]) ? rhs : lhs;
+  }
+};
+
+//! \brief Plan of a parallel inclusive or exclusive scan of every segment of <tt>[first, first + n)</tt>. The exclusive
+//! scans start from \c init.
+//!
+//! A parallel system
+//!   1. calls \c reduce_tail for every worker, in parallel, which keeps the reduction of the last piece of the worker
+//!      in <tt>tails[worker]</tt> if its segment goes on in the next share;
+//!   2. calls \c fixup, which turns these reductions into the prefixes that every worker continues from;
+//!   3. calls \c scan for every worker, in parallel, which writes the scans of the pieces in the share of the worker.
+template <typename OffsetIterator, typename InputIterator, typename T, typename BinaryFunction, typename Size>
+class segmented_scan_plan
+{
+public:
+  using value_type = T;
+
+  segmented_scan_plan(const merge_path_segments<OffsetIterator, Size>& path,
+                      InputIterator first,
+                      bool exclusive,
+                      T init,
+                      BinaryFunction binary_op)
+      : m_path(path)
+      , m_first(first)
+      , m_exclusive(exclusive)
+      , m_init(init)
+      , m_binary_op{binary_op}
+  {}
+
+  Size num_workers() const
+  {
+    return m_path.num_workers();
+  }
+
+  //! \brief Keeps the reduction of the last piece of \p worker in <tt>tails[worker]</tt> if its segment goes on in
+  //! the next share.
+  void reduce_tail(Size worker, T* tails) const
+  {
+    const auto e = m_path.split(worker + 1);
+    if (!m_path.continues_segment(e))
+    {
+      return;
+    }
+
+    const Size first = (::cuda::std::max) (m_path.split(worker).element, m_path.segment_begin(e.segment));
+    if (m_exclusive && first == m_path.segment_begin(e.segment))
+    {
+      tails[worker] = accumulate(m_init, first, e.element);
+    }
+    else
+    {
+      tails[worker] = accumulate(m_first[first], first + 1, e.element);
+    }
+  }
+
+  //! \brief Turns the reductions kept by \c reduce_tail into the prefixes of the segments where the next shares begin.
+  void fixup(T* tails) const
+  {
+    for (Size worker = 1; worker + 1 < m_path.num_workers(); ++worker)
+    {
+      const auto e = m_path.split(worker + 1);
+      if (m_path.continues_segment(e) && m_path.split(worker).segment == e.segment
+          && m_path.continues_segment(m_path.split(worker)))
+      {
+        tails[worker] = m_binary_op(tails[worker - 1], tails[worker]);
+      }
+    }
+  }
+
+  //! \brief Writes the scans of the pieces in the share of \p worker to \p result, continuing from the prefixes found
+  //! by \c fixup.
+  template <typename OutputIterator>
+  void scan(Size worker, OutputIterator result, const T* prefixes) const
+  {
+    m_path.for_each_piece(worker, [&](Size segment, Size first, Size last, bool) {
+      if (first != m_path.segment_begin(segment))
+      {
+        // only the first piece of a share continues a segment
+        scan_piece(prefixes[worker - 1], first, last, result);
+      }
+      else if (m_exclusive)
+      {
+        scan_piece(m_init, first, last, result);
+      }
+      else if (first < last)
+      {
+        const T sum   = m_first[first];
+        result[first] = sum;
+        scan_piece(sum, first + 1, last, result);
+      }
+    });
+  }
+
+private:
+  T accumulate(T sum, Size first, Size last) const
+  {
+    for (; first < last; ++first)
+    {
+      sum = m_binary_op(sum, m_first[first]);
+    }
+    return sum;
+  }
+
+  template <typename OutputIterator>
+  void scan_piece(T sum, Size first, Size last, OutputIterator result) const
+  {
+    for (; first < last; ++first)
+    {
+      // read the element before writing its result, so that the scan can be in place
+      const thrust::detail::it_value_t<InputIterator> value = m_first[first];
+      if (m_exclusive)
+      {
+        result[first] = sum;
+        sum           = m_binary_op(sum, value);
+      }
+      else
+      {
+        sum           = m_binary_op(sum, value);
+        result[first] = sum;
+      }
+    }
+  }
+
+  merge_path_segments<OffsetIterator, Size> m_path;
+  InputIterator m_first;
+  bool m_exclusive;
+  T m_init;
+  thrust::detail::wrapped_function<BinaryFunction, T> m_binary_op;
+};
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
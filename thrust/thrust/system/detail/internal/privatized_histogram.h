@@ -0,0 +1,136 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file privatized_histogram.h
+ *  \brief A histogram for the parallel host systems in which every worker counts into its own bins.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/array>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+//! \brief Plan of a histogram over the interleaved channels of <tt>num_pixels</tt> pixels, in which every worker counts
+//! a contiguous range of pixels into its own, private bins, and the private bins are summed afterwards.
+//!
+//! A parallel system
+//!   1. allocates <tt>num_workers() * size()</tt> counters, which need not be initialized;
+//!   2. calls \c count for every worker, in parallel, with the worker's counters;
+//!   3. calls \c merge for every bin of every active channel, in parallel.
+//! Workers do not share counters, so counting needs neither atomics nor locks, and every output bin is written once.
+template <int NumChannels, int NumActiveChannels, typename Size, typename BinOp>
+class privatized_histogram
+{
+public:
+  // Pixels whose bins are computed before any of them is counted. Computing the bins of a whole block in a separate
+  // loop, which has no dependency between iterations, lets the compiler vectorize it.
+  static constexpr Size block_size = 256;
+
+  // Below this number of pixels per worker, the cost of merging the private bins dominates.
+  static constexpr Size min_pixels_per_worker = Size{1} << 14;
+
+  privatized_histogram(::cuda::std::array<BinOp, NumActiveChannels> bin_ops, Size num_pixels, Size max_workers)
+      : m_bin_ops(bin_ops)
+      , m_num_pixels(num_pixels)
+      , m_num_workers(
+          (::cuda::std::max) (Size{1}, (::cuda::std::min) (max_workers, num_pixels / min_pixels_per_worker)))
+  {
+    m_offsets[0] = 0;
+    for (int channel = 0; channel < NumActiveChannels; ++channel)
+    {
+      m_offsets[channel + 1] = m_offsets[channel] + (::cuda::std::max) (0, m_bin_ops[channel].num_bins());
+    }
+  }
+
+  Size num_workers() const
+  {
+    return m_num_workers;
+  }
+
+  //! \brief The number of counters of each worker, which is the total number of bins of all active channels.
+  Size size() const
+  {
+    return m_offsets[NumActiveChannels];
+  }
+
+  Size num_bins(int channel) const
+  {
+    return m_offsets[channel + 1] - m_offsets[channel];
+  }
+
+  //! \brief Counts the pixels of \p worker into its \c size() counters.
+  template <typename InputIterator, typename Counter>
+  void count(Size worker, InputIterator first, Counter* counters) const
+  {
+    // zeroed by the worker itself, so that its counters are local to the thread that uses them
+    for (Size i = 0; i < size(); ++i)
+    {
+      counters[i] = 0;
+    }
+
+    const Size begin = worker * m_num_pixels / m_num_workers;
+    const Size end   = (worker + 1) * m_num_pixels / m_num_workers;
+
+    int bins[block_size];
+    for (Size block_begin = begin; block_begin < end; block_begin += block_size)
+    {
+      const Size n = (::cuda::std::min) (block_size, end - block_begin);
+      for (int channel = 0; channel < NumActiveChannels; ++channel)
+      {
+        const BinOp bin_op      = m_bin_ops[channel];
+        InputIterator samples   = first + block_begin * NumChannels + channel;
+        Counter* channel_counts = counters + m_offsets[channel];
+
+        for (Size i = 0; i < n; ++i)
+        {
+          bins[i] = bin_op(samples[i * NumChannels]);
+        }
+        for (Size i = 0; i < n; ++i)
+        {
+          if (bins[i] >= 0)
+          {
+            ++channel_counts[bins[i]];
+          }
+        }
+      }
+    }
+  }
+
+  //! \brief Writes the sum of the workers' counters of \p bin of \p channel to <tt>histogram[bin]</tt>.
+  template <typename Counter, typename CounterIterator>
+  void merge(int channel, Size bin, const Counter* counters, CounterIterator histogram) const
+  {
+    const Counter* counter = counters + m_offsets[channel] + bin;
+
+    Counter sum = 0;
+    for (Size worker = 0; worker < m_num_workers; ++worker, counter += size())
+    {
+      sum += *counter;
+    }
+
+    histogram += bin;
+    *histogram = sum;
+  }
+
+private:
+  ::cuda::std::array<BinOp, NumActiveChannels> m_bin_ops;
+  ::cuda::std::array<Size, NumActiveChannels + 1> m_offsets;
+  Size m_num_pixels;
+  Size m_num_workers;
+};
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file segment_batches.h
+ *  \brief Splits the segments of a range into batches of about the same number of elements.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/max.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+//! \brief Plan of a parallel loop over the segments <tt>[offsets_first[i], offsets_first[i + 1])</tt> of a range whose
+//! sizes may vary wildly.
+//!
+//! The elements of the range are cut into batches of the same size, and a segment belongs to the batch that contains
+//! its first element, so a batch has either many small segments or a few larger ones. A parallel system
+//!   1. calls \c for_each_segment for every batch, in parallel, handing out several batches per worker so that the
+//!      workers which drew the larger segments do not hold up the others;
+//!   2. calls \c for_each_large_segment, and processes each of these segments with all of its workers.
+//! A segment is large when it has more elements than the share of a single worker, which is also what would keep the
+//! worker that drew it busy long after the others finished.
+template <typename OffsetIterator, typename Size>
+class segment_batches
+{
+public:
+  // Below this number of elements per batch, the cost of the parallel loop dominates.
+  static constexpr Size min_batch_size = Size{1} << 14;
+
+  // Below this number of elements, a segment is not worth the synchronization of all workers.
+  static constexpr Size min_large_segment_size = Size{1} << 16;
+
+  // Every worker gets about this number of batches.
+  static constexpr Size batches_per_worker = 8;
+
+  segment_batches(OffsetIterator offsets_first, Size num_segments, Size num_workers)
+      : m_offsets_first(offsets_first)
+      , m_num_segments(num_segments)
+      , m_begin(num_segments > 0 ? Size(offsets_first[0]) : Size{0})
+      , m_n(num_segments > 0 ? Size(offsets_first[num_segments]) - m_begin : Size{0})
+      , m_batch_size((::cuda::std::max) (min_batch_size, m_n / (batches_per_worker * num_workers)))
+      , m_large_segment_size((::cuda::std::max) (min_large_segment_size, m_n / num_workers))
+  {}
+
+  Size num_batches() const
+  {
+    return (m_n + m_batch_size - 1) / m_batch_size;
+  }
+
+  //! \brief Calls <tt>f(begin, end)</tt> for the offsets of every segment of \p batch which is not large.
+  template <typename F>
+  void for_each_segment(Size batch, F f) const
+  {
+    const Size first_segment = lower_bound(m_begin + batch * m_batch_size);
+    const Size last_segment =
+      batch + 1 < num_batches() ? lower_bound(m_begin + (batch + 1) * m_batch_size) : m_num_segments;
+    for (Size segment = first_segment; segment < last_segment; ++segment)
+    {
+      const Size begin = m_offsets_first[segment];
+      const Size end   = m_offsets_first[segment + 1];
+      if (end - begin <= m_large_segment_size)
+      {
+        f(begin, end);
+      }
+    }
+  }
+
+  //! \brief Calls <tt>f(begin, end)</tt> for the offsets of every large segment, one after the other.
+  template <typename F>
+  void for_each_large_segment(F f) const
+  {
+    for (Size segment = 0; segment < m_num_segments; ++segment)
+    {
+      const Size begin = m_offsets_first[segment];
+      const Size end   = m_offsets_first[segment + 1];
+      if (end - begin > m_large_segment_size)
+      {
+        f(begin, end);
+      }
+    }
+  }
+
+private:
+  // the first segment that begins at or after offset
+  Size lower_bound(Size offset) const
+  {
+    Size first = 0;
+    Size count = m_num_segments;
+    while (count > 0)
+    {
+      const Size half = count / 2;
+      if (Size(m_offsets_first[first + half]) < offset)
+      {
+        first += half + 1;
+        count -= half + 1;
+      }
+      else
+      {
+        count = half;
+      }
+    }
+    return first;
+  }
+
+  OffsetIterator m_offsets_first;
+  Size m_num_segments;
+  Size m_begin;
+  Size m_n;
+  Size m_batch_size;
+  Size m_large_segment_size;
+};
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
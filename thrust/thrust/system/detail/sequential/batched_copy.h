@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/batched_buffers.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::sequential
+{
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename InputRangeIterator,
+          typename OutputRangeIterator,
+          typename SizeIterator,
+          typename Size>
+_CCCL_HOST_DEVICE void batched_copy(
+  sequential::execution_policy<DerivedPolicy>&,
+  InputRangeIterator input_ranges_first,
+  OutputRangeIterator output_ranges_first,
+  SizeIterator sizes_first,
+  Size num_ranges)
+{
+  using InputIterator  = thrust::detail::it_value_t<InputRangeIterator>;
+  using OutputIterator = thrust::detail::it_value_t<OutputRangeIterator>;
+
+  for (Size i = 0; i < num_ranges; ++i)
+  {
+    InputIterator input   = input_ranges_first[i];
+    OutputIterator output = output_ranges_first[i];
+    for (auto n = sizes_first[i]; n > 0; --n, ++input, ++output)
+    {
+      *output = *input;
+    }
+  }
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename InputBufferIterator,
+          typename OutputBufferIterator,
+          typename SizeIterator,
+          typename Size>
+_CCCL_HOST_DEVICE void batched_memcpy(
+  sequential::execution_policy<DerivedPolicy>&,
+  InputBufferIterator input_buffers_first,
+  OutputBufferIterator output_buffers_first,
+  SizeIterator sizes_first,
+  Size num_buffers)
+{
+  for (Size i = 0; i < num_buffers; ++i)
+  {
+    thrust::system::detail::internal::copy_buffer_piece{}(
+      thrust::detail::it_value_t<InputBufferIterator>(input_buffers_first[i]),
+      thrust::detail::it_value_t<OutputBufferIterator>(output_buffers_first[i]),
+      ::cuda::std::size_t{0},
+      static_cast<::cuda::std::size_t>(sizes_first[i]));
+  }
+}
+} // namespace system::detail::sequential
+THRUST_NAMESPACE_END
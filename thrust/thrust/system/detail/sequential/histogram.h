@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file histogram.h
+ *  \brief Sequential implementation of histogram.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+#include <cuda/std/array>
+#include <cuda/std/cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::sequential
+{
+_CCCL_EXEC_CHECK_DISABLE
+template <int NumChannels,
+          typename DerivedPolicy,
+          typename InputIterator,
+          typename CounterIterator,
+          ::cuda::std::size_t NumActiveChannels,
+          typename BinOp>
+_CCCL_HOST_DEVICE void histogram(
+  sequential::execution_policy<DerivedPolicy>&,
+  InputIterator first,
+  InputIterator last,
+  ::cuda::std::array<CounterIterator, NumActiveChannels> histograms,
+  ::cuda::std::array<BinOp, NumActiveChannels> bin_ops)
+{
+  using size_type    = thrust::detail::it_difference_t<InputIterator>;
+  using counter_type = thrust::detail::it_value_t<CounterIterator>;
+
+  for (::cuda::std::size_t channel = 0; channel < NumActiveChannels; ++channel)
+  {
+    for (int bin = 0; bin < bin_ops[channel].num_bins(); ++bin)
+    {
+      histograms[channel][bin] = counter_type(0);
+    }
+  }
+
+  const size_type num_pixels = (last - first) / NumChannels;
+  for (size_type pixel = 0; pixel < num_pixels; ++pixel, first += NumChannels)
+  {
+    for (::cuda::std::size_t channel = 0; channel < NumActiveChannels; ++channel)
+    {
+      const int bin = bin_ops[channel](first[channel]);
+      if (bin >= 0)
+      {
+        ++histograms[channel][bin];
+      }
+    }
+  }
+}
+} // namespace system::detail::sequential
+THRUST_NAMESPACE_END
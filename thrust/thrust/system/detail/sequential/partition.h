@@ -21,6 +21,7 @@
 #include <thrust/system/detail/sequential/execution_policy.h>
 
 #include <cuda/std/__utility/pair.h>
+#include <cuda/std/tuple>
 
 THRUST_NAMESPACE_BEGIN
 namespace detail
@@ -281,5 +282,111 @@ _CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> stable_par
 
   return ::cuda::std::make_pair(out_true, out_false);
 }
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator, typename Predicate1, typename Predicate2>
+_CCCL_HOST_DEVICE ::cuda::std::pair<RandomAccessIterator, RandomAccessIterator> three_way_partition(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  Predicate1 select_first_part,
+  Predicate2 select_second_part)
+{
+  // wrap preds
+  thrust::detail::wrapped_function<Predicate1, bool> wrapped_select_first_part{select_first_part};
+  thrust::detail::wrapped_function<Predicate2, bool> wrapped_select_second_part{select_second_part};
+
+  using T = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  using TempRange    = thrust::detail::temporary_array<T, DerivedPolicy>;
+  using TempIterator = typename TempRange::iterator;
+
+  TempRange temp(exec, first, last);
+
+  // write the first group and move the rest of the elements to the front of temp
+  TempIterator rest_last = temp.begin();
+  for (TempIterator iter = temp.begin(); iter != temp.end(); ++iter)
+  {
+    if (wrapped_select_first_part(*iter))
+    {
+      *first = *iter;
+      ++first;
+    }
+    else
+    {
+      *rest_last = *iter;
+      ++rest_last;
+    }
+  }
+
+  RandomAccessIterator second_part = first;
+
+  for (TempIterator iter = temp.begin(); iter != rest_last; ++iter)
+  {
+    if (wrapped_select_second_part(*iter))
+    {
+      *first = *iter;
+      ++first;
+    }
+  }
+
+  RandomAccessIterator unselected = first;
+
+  for (TempIterator iter = temp.begin(); iter != rest_last; ++iter)
+  {
+    if (!wrapped_select_second_part(*iter))
+    {
+      *first = *iter;
+      ++first;
+    }
+  }
+
+  return ::cuda::std::make_pair(second_part, unselected);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename OutputIterator3,
+          typename Predicate1,
+          typename Predicate2>
+_CCCL_HOST_DEVICE ::cuda::std::tuple<OutputIterator1, OutputIterator2, OutputIterator3> three_way_partition_copy(
+  sequential::execution_policy<DerivedPolicy>&,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator1 out_first_part,
+  OutputIterator2 out_second_part,
+  OutputIterator3 out_unselected,
+  Predicate1 select_first_part,
+  Predicate2 select_second_part)
+{
+  // wrap preds
+  thrust::detail::wrapped_function<Predicate1, bool> wrapped_select_first_part{select_first_part};
+  thrust::detail::wrapped_function<Predicate2, bool> wrapped_select_second_part{select_second_part};
+
+  for (; first != last; ++first)
+  {
+    if (wrapped_select_first_part(*first))
+    {
+      *out_first_part = *first;
+      ++out_first_part;
+    } // end if
+    else if (wrapped_select_second_part(*first))
+    {
+      *out_second_part = *first;
+      ++out_second_part;
+    } // end else if
+    else
+    {
+      *out_unselected = *first;
+      ++out_unselected;
+    } // end else
+  }
+
+  return ::cuda::std::tuple<OutputIterator1, OutputIterator2, OutputIterator3>(
+    out_first_part, out_second_part, out_unselected);
+}
 } // namespace system::detail::sequential
 THRUST_NAMESPACE_END
@@ -0,0 +1,27 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::sequential
+{
+template <typename DerivedPolicy, typename Pipeline>
+void run_pipeline(sequential::execution_policy<DerivedPolicy>&, Pipeline& pipeline)
+{
+  // a single worker processes the tiles in order, so it never waits for a carry
+  pipeline.run_worker();
+} // end run_pipeline()
+} // namespace system::detail::sequential
+THRUST_NAMESPACE_END
@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file run_length_encode.h
+ *  \brief Sequential implementations of run_length_encode and non_trivial_runs.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+#include <cuda/std/__utility/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::sequential
+{
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  sequential::execution_policy<DerivedPolicy>&,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 unique_output,
+  OutputIterator2 counts_output,
+  BinaryPredicate binary_pred)
+{
+  using size_type = thrust::detail::it_difference_t<InputIterator>;
+
+  // wrap binary_pred
+  thrust::detail::wrapped_function<BinaryPredicate, bool> wrapped_binary_pred{binary_pred};
+
+  const size_type n = last - first;
+  for (size_type i = 0; i < n;)
+  {
+    const size_type head = i++;
+    while (i < n && wrapped_binary_pred(first[i - 1], first[i]))
+    {
+      ++i;
+    }
+
+    *unique_output = first[head];
+    *counts_output = i - head;
+    ++unique_output;
+    ++counts_output;
+  }
+
+  return {unique_output, counts_output};
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> non_trivial_runs(
+  sequential::execution_policy<DerivedPolicy>&,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 offsets_output,
+  OutputIterator2 lengths_output,
+  BinaryPredicate binary_pred)
+{
+  using size_type = thrust::detail::it_difference_t<InputIterator>;
+
+  // wrap binary_pred
+  thrust::detail::wrapped_function<BinaryPredicate, bool> wrapped_binary_pred{binary_pred};
+
+  const size_type n = last - first;
+  for (size_type i = 0; i < n;)
+  {
+    const size_type head = i++;
+    while (i < n && wrapped_binary_pred(first[i - 1], first[i]))
+    {
+      ++i;
+    }
+
+    if (i - head > 1)
+    {
+      *offsets_output = head;
+      *lengths_output = i - head;
+      ++offsets_output;
+      ++lengths_output;
+    }
+  }
+
+  return {offsets_output, lengths_output};
+}
+} // namespace system::detail::sequential
+THRUST_NAMESPACE_END
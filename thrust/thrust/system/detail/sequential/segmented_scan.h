@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file segmented_scan.h
+ *  \brief Sequential implementations of segmented_inclusive_scan and segmented_exclusive_scan.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+#include <cuda/std/__algorithm/max.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::sequential
+{
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename BinaryFunction>
+_CCCL_HOST_DEVICE OutputIterator segmented_inclusive_scan(
+  sequential::execution_policy<DerivedPolicy>&,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  BinaryFunction binary_op)
+{
+  using size_type = thrust::detail::it_difference_t<RandomAccessIterator>;
+  using ValueType = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  // wrap binary_op
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op{binary_op};
+
+  const size_type num_segments = (::cuda::std::max) (size_type{0}, size_type(offsets_last - offsets_first) - 1);
+
+  for (size_type segment = 0; segment < num_segments; ++segment)
+  {
+    const size_type begin = offsets_first[segment];
+    const size_type end   = offsets_first[segment + 1];
+    if (begin == end)
+    {
+      continue;
+    }
+
+    ValueType sum = first[begin];
+    result[begin] = sum;
+    for (size_type i = begin + 1; i < end; ++i)
+    {
+      sum       = wrapped_binary_op(sum, first[i]);
+      result[i] = sum;
+    }
+  }
+
+  return num_segments > 0 ? result + offsets_first[num_segments] : result;
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+_CCCL_HOST_DEVICE OutputIterator segmented_exclusive_scan(
+  sequential::execution_policy<DerivedPolicy>&,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op)
+{
+  using size_type = thrust::detail::it_difference_t<RandomAccessIterator>;
+  using ValueType = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  // wrap binary_op
+  thrust::detail::wrapped_function<BinaryFunction, T> wrapped_binary_op{binary_op};
+
+  const size_type num_segments = (::cuda::std::max) (size_type{0}, size_type(offsets_last - offsets_first) - 1);
+
+  for (size_type segment = 0; segment < num_segments; ++segment)
+  {
+    const size_type begin = offsets_first[segment];
+    const size_type end   = offsets_first[segment + 1];
+
+    T sum = init;
+    for (size_type i = begin; i < end; ++i)
+    {
+      // temporary value allows in-situ scan
+      const ValueType tmp = first[i];
+      result[i]           = sum;
+      sum                 = wrapped_binary_op(sum, tmp);
+    }
+  }
+
+  return num_segments > 0 ? result + offsets_first[num_segments] : result;
+}
+} // namespace system::detail::sequential
+THRUST_NAMESPACE_END
@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file segmented_sort.h
+ *  \brief Sequential implementations of segmented_stable_sort and segmented_stable_sort_by_key.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+#include <thrust/system/detail/sequential/insertion_sort.h>
+#include <thrust/system/detail/sequential/sort.h>
+
+#include <cuda/std/__algorithm/max.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::sequential
+{
+namespace segmented_sort_detail
+{
+// Up to this number of elements, a segment is sorted by insertion, which needs no temporary storage.
+inline constexpr int insertion_sort_threshold = 16;
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void stable_sort_segment(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  StrictWeakOrdering comp)
+{
+  if (last - first <= insertion_sort_threshold)
+  {
+    sequential::insertion_sort(first, last, comp);
+  }
+  else
+  {
+    sequential::stable_sort(exec, first, last, comp);
+  }
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void stable_sort_segment_by_key(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp)
+{
+  if (keys_last - keys_first <= insertion_sort_threshold)
+  {
+    sequential::insertion_sort_by_key(keys_first, keys_last, values_first, comp);
+  }
+  else
+  {
+    sequential::stable_sort_by_key(exec, keys_first, keys_last, values_first, comp);
+  }
+}
+} // namespace segmented_sort_detail
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename OffsetIterator, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_stable_sort(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator keys_first,
+  StrictWeakOrdering comp)
+{
+  using size_type = thrust::detail::it_difference_t<RandomAccessIterator>;
+
+  const size_type num_segments = (::cuda::std::max) (size_type{0}, size_type(offsets_last - offsets_first) - 1);
+
+  for (size_type segment = 0; segment < num_segments; ++segment)
+  {
+    const size_type begin = offsets_first[segment];
+    const size_type end   = offsets_first[segment + 1];
+    segmented_sort_detail::stable_sort_segment(exec, keys_first + begin, keys_first + end, comp);
+  }
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_stable_sort_by_key(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp)
+{
+  using size_type = thrust::detail::it_difference_t<RandomAccessIterator1>;
+
+  const size_type num_segments = (::cuda::std::max) (size_type{0}, size_type(offsets_last - offsets_first) - 1);
+
+  for (size_type segment = 0; segment < num_segments; ++segment)
+  {
+    const size_type begin = offsets_first[segment];
+    const size_type end   = offsets_first[segment + 1];
+    segmented_sort_detail::stable_sort_segment_by_key(
+      exec, keys_first + begin, keys_first + end, values_first + begin, comp);
+  }
+}
+} // namespace system::detail::sequential
+THRUST_NAMESPACE_END
@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file topk.h
+ *  \brief Sequential implementations of topk_by_key and segmented_topk_by_key.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execute_with_env.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/bounded_heap.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__utility/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::sequential
+{
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> topk_by_key(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k,
+  StrictWeakOrdering comp)
+{
+  using size_type = thrust::detail::it_difference_t<RandomAccessIterator1>;
+
+  // a negative k selects nothing, like k == 0
+  const size_type max_count = (::cuda::std::max) (size_type{0}, static_cast<size_type>(k));
+
+  const size_type n = keys_last - keys_first;
+  thrust::detail::temporary_array<size_type, DerivedPolicy> heap(0, exec, (::cuda::std::min) (n, max_count));
+
+  const size_type m = thrust::system::detail::internal::select_topk(
+    keys_first,
+    n,
+    values_first,
+    keys_result,
+    values_result,
+    max_count,
+    comp,
+    thrust::raw_pointer_cast(heap.data()),
+    thrust::detail::requires_sorted_output_v<DerivedPolicy>);
+
+  return {keys_result + m, values_result + m};
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> segmented_topk_by_key(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k,
+  StrictWeakOrdering comp)
+{
+  using size_type = thrust::detail::it_difference_t<RandomAccessIterator1>;
+
+  const size_type num_segments = (::cuda::std::max) (size_type{0}, size_type(offsets_last - offsets_first) - 1);
+  const size_type stride       = (::cuda::std::max) (size_type{0}, static_cast<size_type>(k));
+
+  // every segment reuses the same heap
+  thrust::detail::temporary_array<size_type, DerivedPolicy> heap(0, exec, num_segments > 0 ? stride : 0);
+
+  for (size_type segment = 0; segment < num_segments; ++segment)
+  {
+    const size_type begin = offsets_first[segment];
+    const size_type end   = offsets_first[segment + 1];
+    thrust::system::detail::internal::select_topk(
+      keys_first + begin,
+      end - begin,
+      values_first + begin,
+      keys_result + segment * stride,
+      values_result + segment * stride,
+      stride,
+      comp,
+      thrust::raw_pointer_cast(heap.data()),
+      thrust::detail::requires_sorted_output_v<DerivedPolicy>);
+  }
+
+  return {keys_result + num_segments * stride, values_result + num_segments * stride};
+}
+} // namespace system::detail::sequential
+THRUST_NAMESPACE_END
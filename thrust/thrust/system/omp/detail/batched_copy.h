@@ -0,0 +1,136 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file batched_copy.h
+ *  \brief OpenMP implementations of batched_copy and batched_memcpy.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/system/detail/internal/batched_buffers.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/transform_scan.h>
+
+#include <cuda/std/__functional/operations.h>
+#include <cuda/std/cstdint>
+
+#include <omp.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+namespace batched_copy_detail
+{
+// use a signed type for the iteration variable or suffer the consequences of warnings
+using size_type = ::cuda::std::int64_t;
+
+struct size_cast
+{
+  template <typename Size>
+  size_type operator()(Size size) const
+  {
+    return static_cast<size_type>(size);
+  }
+};
+
+template <typename DerivedPolicy,
+          typename InputRangeIterator,
+          typename OutputRangeIterator,
+          typename SizeIterator,
+          typename CopyPiece>
+void copy(execution_policy<DerivedPolicy>& exec,
+          InputRangeIterator input_ranges_first,
+          OutputRangeIterator output_ranges_first,
+          SizeIterator sizes_first,
+          size_type num_ranges,
+          CopyPiece copy_piece)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<SizeIterator,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  if (num_ranges <= 0)
+  {
+    return;
+  }
+
+  // the ranges are the segments of a single range, delimited by the prefix sums of their sizes
+  thrust::detail::temporary_array<size_type, DerivedPolicy> offsets(0, exec, num_ranges + 1);
+  size_type* offsets_ptr = thrust::raw_pointer_cast(offsets.data());
+  offsets_ptr[0]         = 0;
+  thrust::transform_inclusive_scan(
+    exec, sizes_first, sizes_first + num_ranges, offsets_ptr + 1, size_cast{}, ::cuda::std::plus<size_type>());
+
+  const thrust::system::detail::internal::
+    batched_copy_plan<InputRangeIterator, OutputRangeIterator, CopyPiece, size_type>
+      plan(input_ranges_first, output_ranges_first, offsets_ptr, num_ranges, omp_get_max_threads(), copy_piece);
+  const size_type num_workers = plan.num_workers();
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (size_type worker = 0; worker < num_workers; ++worker)
+  {
+    plan.copy(worker);
+  }
+}
+} // namespace batched_copy_detail
+
+template <typename DerivedPolicy,
+          typename InputRangeIterator,
+          typename OutputRangeIterator,
+          typename SizeIterator,
+          typename Size>
+void batched_copy(execution_policy<DerivedPolicy>& exec,
+                  InputRangeIterator input_ranges_first,
+                  OutputRangeIterator output_ranges_first,
+                  SizeIterator sizes_first,
+                  Size num_ranges)
+{
+  batched_copy_detail::copy(
+    exec,
+    input_ranges_first,
+    output_ranges_first,
+    sizes_first,
+    batched_copy_detail::size_type(num_ranges),
+    thrust::system::detail::internal::copy_range_piece{});
+}
+
+template <typename DerivedPolicy,
+          typename InputBufferIterator,
+          typename OutputBufferIterator,
+          typename SizeIterator,
+          typename Size>
+void batched_memcpy(execution_policy<DerivedPolicy>& exec,
+                    InputBufferIterator input_buffers_first,
+                    OutputBufferIterator output_buffers_first,
+                    SizeIterator sizes_first,
+                    Size num_buffers)
+{
+  batched_copy_detail::copy(
+    exec,
+    input_buffers_first,
+    output_buffers_first,
+    sizes_first,
+    batched_copy_detail::size_type(num_buffers),
+    thrust::system::detail::internal::copy_buffer_piece{});
+}
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
@@ -16,13 +16,65 @@
 #include <thrust/detail/type_traits/minimum_type.h>
 #include <thrust/system/detail/generic/copy.h>
 #include <thrust/system/detail/sequential/copy.h>
+#include <thrust/system/detail/sequential/trivial_copy.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/type_traits/is_trivially_relocatable.h>
 
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__memory/pointer_traits.h>
 #include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/cstdint>
+
+#include <omp.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
+namespace copy_detail
+{
+// use a signed type for the iteration variable or suffer the consequences of warnings
+using size_type = ::cuda::std::int64_t;
+
+// the number of bytes below which copying with one more thread does not pay for waking it up
+constexpr size_type min_bytes_per_thread = size_type{1} << 16;
+
+// copies trivially relocatable elements with a memmove per thread, of one contiguous chunk each; overlapping ranges,
+// which thrust::copy allows when result precedes first, are left to a single memmove
+template <typename T>
+void trivial_copy_n(const T* first, size_type n, T* result)
+{
+  const size_type num_chunks = (::cuda::std::min) (
+    static_cast<size_type>(omp_get_max_threads()),
+    ::cuda::ceil_div(n * static_cast<size_type>(sizeof(T)), min_bytes_per_thread));
+
+  const auto input   = reinterpret_cast<::cuda::std::uintptr_t>(first);
+  const auto output  = reinterpret_cast<::cuda::std::uintptr_t>(result);
+  const auto bytes   = static_cast<::cuda::std::uintptr_t>(n) * sizeof(T);
+  const bool overlap = input < output + bytes && output < input + bytes;
+
+  if (num_chunks <= 1 || overlap)
+  {
+    system::detail::sequential::trivial_copy_n(first, n, result);
+    return;
+  }
+
+  const size_type chunk_size = ::cuda::ceil_div(n, num_chunks);
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (size_type chunk = 0; chunk < num_chunks; ++chunk)
+  {
+    const size_type begin = chunk * chunk_size;
+    const size_type count = (::cuda::std::min) (chunk_size, n - begin);
+    if (count > 0)
+    {
+      system::detail::sequential::trivial_copy_n(first + begin, count, result + begin);
+    }
+  }
+}
+} // namespace copy_detail
+
 template <typename DerivedPolicy, typename InputIterator, typename OutputIterator>
 OutputIterator
 copy(execution_policy<DerivedPolicy>& exec, InputIterator first, InputIterator last, OutputIterator result)
@@ -32,7 +84,13 @@ copy(execution_policy<DerivedPolicy>& exec, InputIterator first, InputIterator l
 
   using traversal = thrust::detail::minimum_type<traversal1, traversal2>;
 
-  if constexpr (::cuda::std::is_convertible_v<traversal, random_access_traversal_tag>)
+  if constexpr (thrust::is_indirectly_trivially_relocatable_to<InputIterator, OutputIterator>::value)
+  {
+    const copy_detail::size_type n = last - first;
+    copy_detail::trivial_copy_n(::cuda::std::to_address(first), n, ::cuda::std::to_address(result));
+    return result + n;
+  }
+  else if constexpr (::cuda::std::is_convertible_v<traversal, random_access_traversal_tag>)
   {
     return system::detail::generic::copy(exec, first, last, result);
   }
@@ -48,7 +106,13 @@ OutputIterator copy_n(execution_policy<DerivedPolicy>& exec, InputIterator first
   using traversal1 = typename iterator_traversal<InputIterator>::type;
   using traversal2 = typename iterator_traversal<OutputIterator>::type;
   using traversal  = thrust::detail::minimum_type<traversal1, traversal2>;
-  if constexpr (::cuda::std::is_convertible_v<traversal, random_access_traversal_tag>)
+  if constexpr (thrust::is_indirectly_trivially_relocatable_to<InputIterator, OutputIterator>::value)
+  {
+    copy_detail::trivial_copy_n(
+      ::cuda::std::to_address(first), static_cast<copy_detail::size_type>(n), ::cuda::std::to_address(result));
+    return result + n;
+  }
+  else if constexpr (::cuda::std::is_convertible_v<traversal, random_access_traversal_tag>)
   {
     return system::detail::generic::copy_n(exec, first, n, result);
   }
@@ -18,6 +18,8 @@
 #endif // no system header
 #include <thrust/system/detail/internal/decompose.h>
 
+#include <cuda/std/__algorithm/max.h>
+
 // don't attempt to #include this file without omp support
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
 #  include <omp.h>
@@ -26,8 +28,10 @@
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
+// Splits n elements into tiles_per_processor tiles per processor
 template <typename IndexType>
-thrust::system::detail::internal::uniform_decomposition<IndexType> default_decomposition(IndexType n)
+thrust::system::detail::internal::uniform_decomposition<IndexType>
+default_decomposition(IndexType n, [[maybe_unused]] int tiles_per_processor = 1)
 {
   // we're attempting to launch an omp kernel, assert we're compiling with omp support
   // ========================================================================
@@ -39,7 +43,8 @@ thrust::system::detail::internal::uniform_decomposition<IndexType> default_decom
     "OpenMP compiler support is not enabled");
 
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-  return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, 1, omp_get_num_procs());
+  return thrust::system::detail::internal::uniform_decomposition<IndexType>(
+    n, 1, static_cast<IndexType>(omp_get_num_procs() * (::cuda::std::max) (tiles_per_processor, 1)));
 #else
   return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, 1, 1);
 #endif
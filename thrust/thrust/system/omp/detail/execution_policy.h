@@ -14,6 +14,7 @@
 #endif // no system header
 
 #include <thrust/detail/allocator_aware_execution_policy.h>
+#include <thrust/detail/execute_with_env.h>
 #include <thrust/detail/type_traits.h>
 #include <thrust/iterator/detail/any_system_tag.h>
 #include <thrust/system/cpp/detail/execution_policy.h>
@@ -55,7 +56,16 @@ struct execution_policy : cpp::execution_policy<Derived>
 struct par_t
     : execution_policy<par_t>
     , thrust::detail::allocator_aware_execution_policy<execution_policy>
-{};
+{
+  //! Returns a policy that also carries the environment \p env. For example, algorithms invoked with
+  //! <tt>thrust::omp::par.with(cuda::execution::require(cuda::execution::determinism::run_to_run))</tt> return
+  //! the same results for any number of threads.
+  template <typename Env>
+  thrust::detail::execute_with_env<Env, execution_policy> with(Env env) const
+  {
+    return thrust::detail::execute_with_env<Env, execution_policy>(env);
+  }
+};
 
 // select_system(tbb, omp) & select_system(omp, tbb) are ambiguous because both convert to cpp without these overloads,
 // which we arbitrarily define in the omp backend
@@ -17,17 +17,51 @@
 #  pragma system_header
 #endif // no system header
 
-#include <thrust/system/detail/generic/find.h>
+#include <thrust/detail/autotune.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/cooperative_find.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/std/__iterator/distance.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
 template <typename DerivedPolicy, typename InputIterator, typename Predicate>
-InputIterator find_if(execution_policy<DerivedPolicy>& exec, InputIterator first, InputIterator last, Predicate pred)
+InputIterator find_if(execution_policy<DerivedPolicy>&, InputIterator first, InputIterator last, Predicate pred)
 {
-  // omp prefers generic::find_if to cpp::find_if
-  return thrust::system::detail::generic::find_if(exec, first, last, pred);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(
+    thrust::detail::depend_on_instantiation<InputIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+    "OpenMP compiler support is not enabled");
+
+  using difference_type = thrust::detail::it_difference_t<InputIterator>;
+
+  const difference_type n = ::cuda::std::distance(first, last);
+  thrust::system::detail::internal::cooperative_find<difference_type> find(n);
+
+  const difference_type sequential_threshold = thrust::detail::tuned_value(
+    thrust::detail::autotune_knob::omp_find_if_sequential_threshold,
+    sizeof(thrust::detail::it_value_t<InputIterator>),
+    find.sequential_threshold);
+
+  if (n < sequential_threshold)
+  {
+    find.run(first, pred);
+  }
+  else
+  {
+    THRUST_PRAGMA_OMP(parallel)
+    find.run(first, pred);
+  }
+
+  return first + find.result();
 }
 } // end namespace system::omp::detail
 THRUST_NAMESPACE_END
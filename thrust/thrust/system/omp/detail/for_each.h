@@ -19,6 +19,7 @@
 #endif // no system header
 
 #include <thrust/detail/function.h>
+#include <thrust/detail/nvtx_policy.h>
 #include <thrust/detail/static_assert.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/iterator_traits.h>
@@ -27,6 +28,8 @@
 
 #include <cuda/std/__iterator/distance.h>
 
+#include <omp.h>
+
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
@@ -47,6 +50,8 @@ RandomAccessIterator for_each_n(execution_policy<DerivedPolicy>&, RandomAccessIt
     return first; // empty range
   }
 
+  _CCCL_HOST_RANGE_WORK(n, thrust::detail::host_range_bytes<RandomAccessIterator>(n), omp_get_max_threads());
+
   // create a wrapped function for f
   thrust::detail::wrapped_function<UnaryFunction, void> wrapped_f{f};
 
@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file histogram.h
+ *  \brief OpenMP implementation of histogram.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/privatized_histogram.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/std/array>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+
+#include <omp.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+template <int NumChannels,
+          typename DerivedPolicy,
+          typename InputIterator,
+          typename CounterIterator,
+          ::cuda::std::size_t NumActiveChannels,
+          typename BinOp>
+void histogram(execution_policy<DerivedPolicy>& exec,
+               InputIterator first,
+               InputIterator last,
+               ::cuda::std::array<CounterIterator, NumActiveChannels> histograms,
+               ::cuda::std::array<BinOp, NumActiveChannels> bin_ops)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(
+    thrust::detail::depend_on_instantiation<InputIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+    "OpenMP compiler support is not enabled");
+
+  // use a signed type for the iteration variable or suffer the consequences of warnings
+  using size_type = ::cuda::std::int64_t;
+
+  using plan_type = thrust::system::detail::internal::
+    privatized_histogram<NumChannels, static_cast<int>(NumActiveChannels), size_type, BinOp>;
+
+  const plan_type plan(bin_ops, static_cast<size_type>((last - first) / NumChannels), omp_get_max_threads());
+
+  const size_type num_workers = plan.num_workers();
+  thrust::detail::temporary_array<size_type, DerivedPolicy> counters(0, exec, num_workers * plan.size());
+  size_type* counters_ptr = thrust::raw_pointer_cast(counters.data());
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (size_type worker = 0; worker < num_workers; ++worker)
+  {
+    plan.count(worker, first, counters_ptr + worker * plan.size());
+  }
+
+  for (int channel = 0; channel < static_cast<int>(NumActiveChannels); ++channel)
+  {
+    const size_type num_bins        = plan.num_bins(channel);
+    const CounterIterator histogram = histograms[channel];
+
+    THRUST_PRAGMA_OMP(parallel for)
+    for (size_type bin = 0; bin < num_bins; ++bin)
+    {
+      plan.merge(channel, bin, counters_ptr, histogram);
+    }
+  }
+}
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
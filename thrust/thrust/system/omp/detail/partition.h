@@ -17,14 +17,82 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
 #include <thrust/system/detail/generic/partition.h>
+#include <thrust/system/detail/internal/chunked_three_way_partition.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
 
 #include <cuda/std/__utility/pair.h>
+#include <cuda/std/cstdint>
+#include <cuda/std/tuple>
+
+#include <omp.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
+namespace three_way_partition_detail
+{
+// use a signed type for the iteration variable or suffer the consequences of warnings
+using size_type = ::cuda::std::int64_t;
+
+// returns the ends of the three groups in their outputs
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename OutputIterator3,
+          typename Predicate1,
+          typename Predicate2>
+::cuda::std::tuple<size_type, size_type, size_type> partition_chunks(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator1 out_first_part,
+  OutputIterator2 out_second_part,
+  OutputIterator3 out_unselected,
+  Predicate1 select_first_part,
+  Predicate2 select_second_part,
+  bool concatenate)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<RandomAccessIterator,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  const thrust::system::detail::internal::
+    chunked_three_way_partition<RandomAccessIterator, Predicate1, Predicate2, size_type>
+      plan(first, static_cast<size_type>(last - first), select_first_part, select_second_part, omp_get_max_threads());
+
+  const size_type num_chunks = plan.num_chunks();
+  thrust::detail::temporary_array<size_type, DerivedPolicy> positions(0, exec, 3 * (num_chunks + 1));
+  size_type* positions_ptr = thrust::raw_pointer_cast(positions.data());
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (size_type chunk = 0; chunk < num_chunks; ++chunk)
+  {
+    plan.count(chunk, positions_ptr);
+  }
+
+  plan.scan(positions_ptr, concatenate);
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (size_type chunk = 0; chunk < num_chunks; ++chunk)
+  {
+    plan.write(chunk, positions_ptr, out_first_part, out_second_part, out_unselected);
+  }
+
+  const size_type* ends = positions_ptr + 3 * num_chunks;
+  return ::cuda::std::make_tuple(ends[0], ends[1], ends[2]);
+}
+} // namespace three_way_partition_detail
+
 template <typename DerivedPolicy, typename ForwardIterator, typename Predicate>
 ForwardIterator
 stable_partition(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, Predicate pred)
@@ -80,5 +148,48 @@ template <typename DerivedPolicy,
   // omp prefers generic::stable_partition_copy to cpp::stable_partition_copy
   return thrust::system::detail::generic::stable_partition_copy(exec, first, last, stencil, out_true, out_false, pred);
 } // end stable_partition_copy()
+template <typename DerivedPolicy, typename RandomAccessIterator, typename Predicate1, typename Predicate2>
+::cuda::std::pair<RandomAccessIterator, RandomAccessIterator> three_way_partition(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  Predicate1 select_first_part,
+  Predicate2 select_second_part)
+{
+  using T = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  // partition a copy of the input back into it, with the groups one after the other
+  thrust::detail::temporary_array<T, DerivedPolicy> temp(exec, first, last);
+  const auto ends = three_way_partition_detail::partition_chunks(
+    exec, temp.begin(), temp.end(), first, first, first, select_first_part, select_second_part, true);
+
+  return {first + ::cuda::std::get<0>(ends), first + ::cuda::std::get<1>(ends)};
+} // end three_way_partition()
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename OutputIterator3,
+          typename Predicate1,
+          typename Predicate2>
+::cuda::std::tuple<OutputIterator1, OutputIterator2, OutputIterator3> three_way_partition_copy(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator1 out_first_part,
+  OutputIterator2 out_second_part,
+  OutputIterator3 out_unselected,
+  Predicate1 select_first_part,
+  Predicate2 select_second_part)
+{
+  const auto ends = three_way_partition_detail::partition_chunks(
+    exec, first, last, out_first_part, out_second_part, out_unselected, select_first_part, select_second_part, false);
+
+  return ::cuda::std::tuple<OutputIterator1, OutputIterator2, OutputIterator3>(
+    out_first_part + ::cuda::std::get<0>(ends),
+    out_second_part + ::cuda::std::get<1>(ends),
+    out_unselected + ::cuda::std::get<2>(ends));
+} // end three_way_partition_copy()
 } // end namespace system::omp::detail
 THRUST_NAMESPACE_END
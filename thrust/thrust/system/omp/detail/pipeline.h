@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file pipeline.h
+ *  \brief OpenMP implementation of pipeline.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/static_assert.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/cstddef>
+
+#include <omp.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+template <typename DerivedPolicy, typename Pipeline>
+void run_pipeline(execution_policy<DerivedPolicy>&, Pipeline& pipeline)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<Pipeline,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  const int num_threads = static_cast<int>(::cuda::std::min<::cuda::std::size_t>(
+    static_cast<::cuda::std::size_t>(omp_get_max_threads()), pipeline.num_tiles()));
+  if (num_threads <= 1)
+  {
+    pipeline.run_worker();
+    return;
+  }
+
+  // every thread claims tiles until none is left
+  THRUST_PRAGMA_OMP(parallel num_threads(num_threads))
+  {
+    pipeline.run_worker();
+  }
+} // end run_pipeline()
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
@@ -17,17 +17,63 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/autotune.h>
+#include <thrust/detail/execute_with_env.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/nvtx_policy.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/static_assert.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/deterministic_tiling.h>
 #include <thrust/system/omp/detail/default_decomposition.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
 #include <thrust/system/omp/detail/reduce_intervals.h>
 
 #include <cuda/std/__iterator/distance.h>
 
+#include <omp.h>
+
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
+// Reduces fixed-size tiles, so that the result does not depend on the number of threads
+template <typename DerivedPolicy, typename InputIterator, typename Size, typename OutputType, typename BinaryFunction>
+OutputType deterministic_reduce(
+  execution_policy<DerivedPolicy>& exec, InputIterator first, Size n, OutputType init, BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(
+    thrust::detail::depend_on_instantiation<InputIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+    "OpenMP compiler support is not enabled");
+
+  if (n == 0)
+  {
+    return init;
+  }
+
+  thrust::detail::wrapped_function<BinaryFunction, OutputType> wrapped_binary_op{binary_op};
+
+  const thrust::system::detail::internal::deterministic_tiling<Size> tiling(n);
+  const Size num_tiles = tiling.size();
+
+  thrust::detail::temporary_array<OutputType, DerivedPolicy> partial_sums(exec, num_tiles);
+  OutputType* partials = thrust::raw_pointer_cast(partial_sums.data());
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (Size tile = 0; tile < num_tiles; ++tile)
+  {
+    tiling.reduce_tile(tile, first, partials, wrapped_binary_op);
+  }
+
+  return tiling.combine(init, partials, wrapped_binary_op);
+}
+
 template <typename DerivedPolicy, typename InputIterator, typename OutputType, typename BinaryFunction>
 OutputType reduce(execution_policy<DerivedPolicy>& exec,
                   InputIterator first,
@@ -39,25 +85,36 @@ OutputType reduce(execution_policy<DerivedPolicy>& exec,
 
   const difference_type n = ::cuda::std::distance(first, last);
 
-  // determine first and second level decomposition
-  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp1 =
-    thrust::system::omp::detail::default_decomposition(n);
-  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp2(decomp1.size() + 1, 1, 1);
+  _CCCL_HOST_RANGE_WORK(n, thrust::detail::host_range_bytes<InputIterator>(n), omp_get_max_threads());
+
+  if constexpr (thrust::detail::requires_determinism_v<DerivedPolicy>)
+  {
+    return thrust::system::omp::detail::deterministic_reduce(exec, first, n, init, binary_op);
+  }
+  else
+  {
+    // determine first and second level decomposition
+    const int tiles_per_processor =
+      thrust::detail::tuned_value(thrust::detail::autotune_knob::omp_reduce_tiles_per_processor, sizeof(OutputType), 1);
+    thrust::system::detail::internal::uniform_decomposition<difference_type> decomp1 =
+      thrust::system::omp::detail::default_decomposition(n, tiles_per_processor);
+    thrust::system::detail::internal::uniform_decomposition<difference_type> decomp2(decomp1.size() + 1, 1, 1);
 
-  // allocate storage for the initializer and partial sums
-  // XXX use select_system for Tag
-  thrust::detail::temporary_array<OutputType, DerivedPolicy> partial_sums(exec, decomp1.size() + 1);
+    // allocate storage for the initializer and partial sums
+    // XXX use select_system for Tag
+    thrust::detail::temporary_array<OutputType, DerivedPolicy> partial_sums(exec, decomp1.size() + 1);
 
-  // set first element of temp array to init
-  partial_sums[0] = init;
+    // set first element of temp array to init
+    partial_sums[0] = init;
 
-  // accumulate partial sums (first level reduction)
-  thrust::system::omp::detail::reduce_intervals(exec, first, partial_sums.begin() + 1, binary_op, decomp1);
+    // accumulate partial sums (first level reduction)
+    thrust::system::omp::detail::reduce_intervals(exec, first, partial_sums.begin() + 1, binary_op, decomp1);
 
-  // reduce partial sums (second level reduction)
-  thrust::system::omp::detail::reduce_intervals(exec, partial_sums.begin(), partial_sums.begin(), binary_op, decomp2);
+    // reduce partial sums (second level reduction)
+    thrust::system::omp::detail::reduce_intervals(exec, partial_sums.begin(), partial_sums.begin(), binary_op, decomp2);
 
-  return partial_sums[0];
+    return partial_sums[0];
+  }
 } // end reduce()
 } // end namespace system::omp::detail
 THRUST_NAMESPACE_END
@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file run_length_encode.h
+ *  \brief OpenMP implementations of run_length_encode and non_trivial_runs.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/system/detail/internal/chunked_runs.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/std/__utility/pair.h>
+#include <cuda/std/cstdint>
+
+#include <omp.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+namespace run_length_encode_detail
+{
+// use a signed type for the iteration variable or suffer the consequences of warnings
+using size_type = ::cuda::std::int64_t;
+
+template <typename DerivedPolicy, typename InputIterator, typename BinaryPredicate, typename Writer>
+size_type
+encode_runs(execution_policy<DerivedPolicy>& exec,
+            InputIterator first,
+            InputIterator last,
+            BinaryPredicate binary_pred,
+            size_type min_length,
+            Writer writer)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(
+    thrust::detail::depend_on_instantiation<InputIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+    "OpenMP compiler support is not enabled");
+
+  using plan_type    = thrust::system::detail::internal::chunked_runs<InputIterator, BinaryPredicate, size_type>;
+  using summary_type = typename plan_type::chunk_summary;
+
+  const plan_type plan(first, static_cast<size_type>(last - first), binary_pred, min_length, omp_get_max_threads());
+
+  const size_type num_chunks = plan.num_chunks();
+  thrust::detail::temporary_array<summary_type, DerivedPolicy> summaries(0, exec, num_chunks);
+  summary_type* summaries_ptr = thrust::raw_pointer_cast(summaries.data());
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (size_type chunk = 0; chunk < num_chunks; ++chunk)
+  {
+    plan.count(chunk, summaries_ptr);
+  }
+
+  const size_type num_runs = plan.scan(summaries_ptr);
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (size_type chunk = 0; chunk < num_chunks; ++chunk)
+  {
+    plan.write(chunk, summaries_ptr, writer);
+  }
+
+  return num_runs;
+}
+} // namespace run_length_encode_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+::cuda::std::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 unique_output,
+  OutputIterator2 counts_output,
+  BinaryPredicate binary_pred)
+{
+  const auto num_runs = run_length_encode_detail::encode_runs(
+    exec,
+    first,
+    last,
+    binary_pred,
+    1,
+    thrust::system::detail::internal::run_length_encode_writer<InputIterator, OutputIterator1, OutputIterator2>{
+      first, unique_output, counts_output});
+
+  return {unique_output + num_runs, counts_output + num_runs};
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+::cuda::std::pair<OutputIterator1, OutputIterator2> non_trivial_runs(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 offsets_output,
+  OutputIterator2 lengths_output,
+  BinaryPredicate binary_pred)
+{
+  const auto num_runs = run_length_encode_detail::encode_runs(
+    exec,
+    first,
+    last,
+    binary_pred,
+    2,
+    thrust::system::detail::internal::non_trivial_runs_writer<OutputIterator1, OutputIterator2>{
+      offsets_output, lengths_output});
+
+  return {offsets_output + num_runs, lengths_output + num_runs};
+}
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
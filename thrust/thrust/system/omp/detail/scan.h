@@ -14,9 +14,14 @@
 #endif // no system header
 
 // OMP parallel scan implementation
+#include <thrust/detail/autotune.h>
+#include <thrust/detail/execute_with_env.h>
 #include <thrust/detail/function.h>
+#include <thrust/detail/nvtx_policy.h>
+#include <thrust/detail/raw_pointer_cast.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/deterministic_tiling.h>
 #include <thrust/system/omp/detail/execution_policy.h>
 #include <thrust/system/omp/detail/pragma_omp.h>
 
@@ -40,7 +45,8 @@ struct __no_init_tag
 {};
 
 // Threshold below which serial scan is faster than parallel
-// Benchmarking shows parallel overhead dominates for small arrays
+// Benchmarking shows parallel overhead dominates for small arrays. It can be tuned per machine and value size with
+// thrust::autotune::knobs::omp_scan_threshold.
 inline constexpr size_t parallel_scan_threshold = 1024;
 
 template <bool IsInclusive,
@@ -71,13 +77,19 @@ OutputIterator scan_impl(
     return result;
   }
 
+  _CCCL_HOST_RANGE_WORK(
+    n,
+    thrust::detail::host_range_bytes<InputIterator>(n) + thrust::detail::host_range_bytes<OutputIterator>(n),
+    omp_get_max_threads());
+
   auto wrapped_binary_op = wrapped_function<BinaryFunction, accum_t>{binary_op};
 
-  const int num_threads = omp_get_max_threads();
+  const int num_threads  = omp_get_max_threads();
+  const size_t threshold = thrust::detail::tuned_value(
+    thrust::detail::autotune_knob::omp_scan_threshold, sizeof(accum_t), parallel_scan_threshold);
 
   // Use serial scan for small arrays where parallel overhead dominates
-  if (static_cast<size_t>(n) < (::cuda::std::max) (parallel_scan_threshold, static_cast<size_t>(num_threads))
-      || num_threads <= 1)
+  if (static_cast<size_t>(n) < (::cuda::std::max) (threshold, static_cast<size_t>(num_threads)) || num_threads <= 1)
   {
     if constexpr (IsInclusive)
     {
@@ -171,6 +183,81 @@ OutputIterator scan_impl(
   return result + n;
 }
 
+// Scans fixed-size tiles, so that the result does not depend on the number of threads
+template <bool IsInclusive,
+          typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename InitialValueType,
+          typename BinaryFunction>
+OutputIterator deterministic_scan_impl(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  [[maybe_unused]] InitialValueType init,
+  BinaryFunction binary_op)
+{
+  using namespace thrust::detail;
+
+  static constexpr bool has_init = !::cuda::std::is_same_v<InitialValueType, __no_init_tag>;
+  using accum_t = ::cuda::std::conditional_t<has_init, InitialValueType, it_value_t<InputIterator>>;
+  using Size    = it_difference_t<InputIterator>;
+
+  const Size n = ::cuda::std::distance(first, last);
+
+  if (n == 0)
+  {
+    return result;
+  }
+
+  _CCCL_HOST_RANGE_WORK(
+    n,
+    thrust::detail::host_range_bytes<InputIterator>(n) + thrust::detail::host_range_bytes<OutputIterator>(n),
+    omp_get_max_threads());
+
+  auto wrapped_binary_op = wrapped_function<BinaryFunction, accum_t>{binary_op};
+
+  const thrust::system::detail::internal::deterministic_tiling<Size> tiling(n);
+  const Size num_tiles = tiling.size();
+
+  temporary_array<accum_t, DerivedPolicy> tile_sums(exec, num_tiles);
+  accum_t* partials = thrust::raw_pointer_cast(tile_sums.data());
+
+  // Step 1: Reduce each tile
+  THRUST_PRAGMA_OMP(parallel for)
+  for (Size tile = 0; tile < num_tiles; ++tile)
+  {
+    tiling.reduce_tile(tile, first, partials, wrapped_binary_op);
+  }
+
+  // Step 2: Scan tile sums
+  if constexpr (has_init)
+  {
+    tiling.prefixes(partials, init, wrapped_binary_op);
+  }
+  else
+  {
+    tiling.prefixes(partials, wrapped_binary_op);
+  }
+
+  // Step 3: Scan each tile with its prefix
+  THRUST_PRAGMA_OMP(parallel for)
+  for (Size tile = 0; tile < num_tiles; ++tile)
+  {
+    if constexpr (IsInclusive)
+    {
+      tiling.template inclusive_scan_tile<has_init>(tile, first, result, partials, wrapped_binary_op);
+    }
+    else
+    {
+      tiling.exclusive_scan_tile(tile, first, result, partials, wrapped_binary_op);
+    }
+  }
+
+  return result + n;
+}
+
 template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename BinaryFunction>
 OutputIterator inclusive_scan(
   execution_policy<DerivedPolicy>& exec,
@@ -195,7 +282,14 @@ OutputIterator inclusive_scan(
   InitialValueType init,
   BinaryFunction binary_op)
 {
-  return scan_impl<true>(exec, first, last, result, init, binary_op);
+  if constexpr (thrust::detail::requires_determinism_v<DerivedPolicy>)
+  {
+    return deterministic_scan_impl<true>(exec, first, last, result, init, binary_op);
+  }
+  else
+  {
+    return scan_impl<true>(exec, first, last, result, init, binary_op);
+  }
 }
 
 template <typename DerivedPolicy,
@@ -211,7 +305,14 @@ OutputIterator exclusive_scan(
   InitialValueType init,
   BinaryFunction binary_op)
 {
-  return scan_impl<false>(exec, first, last, result, init, binary_op);
+  if constexpr (thrust::detail::requires_determinism_v<DerivedPolicy>)
+  {
+    return deterministic_scan_impl<false>(exec, first, last, result, init, binary_op);
+  }
+  else
+  {
+    return scan_impl<false>(exec, first, last, result, init, binary_op);
+  }
 }
 } // namespace system::omp::detail
 THRUST_NAMESPACE_END
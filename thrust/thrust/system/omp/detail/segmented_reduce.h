@@ -0,0 +1,153 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file segmented_reduce.h
+ *  \brief OpenMP implementations of segmented_reduce and segmented_arg_min.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/system/detail/internal/merge_path_segments.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/cstdint>
+
+#include <omp.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+namespace segmented_reduce_detail
+{
+// use a signed type for the iteration variable or suffer the consequences of warnings
+using size_type = ::cuda::std::int64_t;
+
+// reduces every segment of [first, first + n) from init(segment) and hands the reductions to output
+template <typename T,
+          typename DerivedPolicy,
+          typename OffsetIterator,
+          typename InputIterator,
+          typename InitFunction,
+          typename BinaryFunction,
+          typename OutputFunction>
+size_type reduce(execution_policy<DerivedPolicy>& exec,
+                 OffsetIterator offsets_first,
+                 OffsetIterator offsets_last,
+                 InputIterator first,
+                 InitFunction init,
+                 BinaryFunction binary_op,
+                 OutputFunction output)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<OffsetIterator,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  using plan_type = thrust::system::detail::internal::
+    segmented_reduce_plan<OffsetIterator, InputIterator, T, InitFunction, BinaryFunction, size_type>;
+
+  const size_type num_segments = (::cuda::std::max) (size_type{0}, size_type(offsets_last - offsets_first) - 1);
+  const plan_type plan({offsets_first, num_segments, omp_get_max_threads()}, first, init, binary_op);
+  const size_type num_workers = plan.num_workers();
+
+  // the pieces of the segments split among several threads
+  thrust::detail::temporary_array<T, DerivedPolicy> heads(0, exec, num_workers);
+  thrust::detail::temporary_array<T, DerivedPolicy> tails(0, exec, num_workers);
+  T* heads_ptr = thrust::raw_pointer_cast(heads.data());
+  T* tails_ptr = thrust::raw_pointer_cast(tails.data());
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (size_type worker = 0; worker < num_workers; ++worker)
+  {
+    plan.reduce(worker, output, heads_ptr, tails_ptr);
+  }
+
+  plan.fixup(output, heads_ptr, tails_ptr);
+
+  return num_segments;
+}
+} // namespace segmented_reduce_detail
+
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+OutputIterator segmented_reduce(
+  execution_policy<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op)
+{
+  using segmented_reduce_detail::size_type;
+
+  const size_type num_segments = segmented_reduce_detail::reduce<T>(
+    exec,
+    offsets_first,
+    offsets_last,
+    first,
+    thrust::system::detail::internal::same_init<T>{init},
+    binary_op,
+    [result](size_type segment, const T& sum) {
+      result[segment] = sum;
+    });
+
+  return result + num_segments;
+}
+
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator segmented_arg_min(
+  execution_policy<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  using segmented_reduce_detail::size_type;
+  namespace internal = thrust::system::detail::internal;
+
+  // reduce the positions of the elements
+  const size_type num_segments = segmented_reduce_detail::reduce<size_type>(
+    exec,
+    offsets_first,
+    offsets_last,
+    thrust::counting_iterator<size_type>(0),
+    internal::segment_begin_init<OffsetIterator, size_type>{offsets_first},
+    internal::first_smallest_position<RandomAccessIterator, StrictWeakOrdering>{first, {comp}},
+    [result, offsets_first](size_type segment, size_type position) {
+      result[segment] = position - size_type(offsets_first[segment]);
+    });
+
+  return result + num_segments;
+}
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
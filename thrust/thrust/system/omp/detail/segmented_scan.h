@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file segmented_scan.h
+ *  \brief OpenMP implementations of segmented_inclusive_scan and segmented_exclusive_scan.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/merge_path_segments.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/cstdint>
+
+#include <omp.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+namespace segmented_scan_detail
+{
+// use a signed type for the iteration variable or suffer the consequences of warnings
+using size_type = ::cuda::std::int64_t;
+
+template <typename T,
+          typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename BinaryFunction>
+OutputIterator scan(
+  execution_policy<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  bool exclusive,
+  T init,
+  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<OffsetIterator,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  using plan_type = thrust::system::detail::internal::
+    segmented_scan_plan<OffsetIterator, RandomAccessIterator, T, BinaryFunction, size_type>;
+
+  const size_type num_segments = (::cuda::std::max) (size_type{0}, size_type(offsets_last - offsets_first) - 1);
+  const plan_type plan({offsets_first, num_segments, omp_get_max_threads()}, first, exclusive, init, binary_op);
+  const size_type num_workers = plan.num_workers();
+
+  // the reductions of the pieces of the segments split among several threads
+  thrust::detail::temporary_array<T, DerivedPolicy> tails(0, exec, num_workers);
+  T* tails_ptr = thrust::raw_pointer_cast(tails.data());
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (size_type worker = 0; worker < num_workers; ++worker)
+  {
+    plan.reduce_tail(worker, tails_ptr);
+  }
+
+  plan.fixup(tails_ptr);
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (size_type worker = 0; worker < num_workers; ++worker)
+  {
+    plan.scan(worker, result, tails_ptr);
+  }
+
+  return num_segments > 0 ? result + offsets_first[num_segments] : result;
+}
+} // namespace segmented_scan_detail
+
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename BinaryFunction>
+OutputIterator segmented_inclusive_scan(
+  execution_policy<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  BinaryFunction binary_op)
+{
+  using ValueType = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  // an inclusive scan has no initial value
+  return segmented_scan_detail::scan(exec, offsets_first, offsets_last, first, result, false, ValueType(), binary_op);
+}
+
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+OutputIterator segmented_exclusive_scan(
+  execution_policy<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op)
+{
+  return segmented_scan_detail::scan(exec, offsets_first, offsets_last, first, result, true, init, binary_op);
+}
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
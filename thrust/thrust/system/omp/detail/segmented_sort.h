@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file segmented_sort.h
+ *  \brief OpenMP implementations of segmented_stable_sort and segmented_stable_sort_by_key.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/internal/segment_batches.h>
+#include <thrust/system/detail/sequential/segmented_sort.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/cstdint>
+
+#include <omp.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+namespace segmented_sort_detail
+{
+// use a signed type for the iteration variable or suffer the consequences of warnings
+using size_type = ::cuda::std::int64_t;
+
+template <typename OffsetIterator>
+thrust::system::detail::internal::segment_batches<OffsetIterator, size_type>
+make_segment_batches(OffsetIterator offsets_first, OffsetIterator offsets_last)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<OffsetIterator,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  const size_type num_segments = (::cuda::std::max) (size_type{0}, size_type(offsets_last - offsets_first) - 1);
+  return {offsets_first, num_segments, omp_get_max_threads()};
+}
+} // namespace segmented_sort_detail
+
+template <typename DerivedPolicy, typename OffsetIterator, typename RandomAccessIterator, typename StrictWeakOrdering>
+void segmented_stable_sort(
+  execution_policy<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator keys_first,
+  StrictWeakOrdering comp)
+{
+  using segmented_sort_detail::size_type;
+
+  const auto batches          = segmented_sort_detail::make_segment_batches(offsets_first, offsets_last);
+  const size_type num_batches = batches.num_batches();
+
+  // the batches take different times, so hand them out one at a time
+  THRUST_PRAGMA_OMP(parallel for schedule(dynamic))
+  for (size_type batch = 0; batch < num_batches; ++batch)
+  {
+    thrust::detail::seq_t seq;
+    batches.for_each_segment(batch, [&](size_type begin, size_type end) {
+      thrust::system::detail::sequential::segmented_sort_detail::stable_sort_segment(
+        seq, keys_first + begin, keys_first + end, comp);
+    });
+  }
+
+  batches.for_each_large_segment([&](size_type begin, size_type end) {
+    thrust::stable_sort(exec, keys_first + begin, keys_first + end, comp);
+  });
+}
+
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void segmented_stable_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp)
+{
+  using segmented_sort_detail::size_type;
+
+  const auto batches          = segmented_sort_detail::make_segment_batches(offsets_first, offsets_last);
+  const size_type num_batches = batches.num_batches();
+
+  // the batches take different times, so hand them out one at a time
+  THRUST_PRAGMA_OMP(parallel for schedule(dynamic))
+  for (size_type batch = 0; batch < num_batches; ++batch)
+  {
+    thrust::detail::seq_t seq;
+    batches.for_each_segment(batch, [&](size_type begin, size_type end) {
+      thrust::system::detail::sequential::segmented_sort_detail::stable_sort_segment_by_key(
+        seq, keys_first + begin, keys_first + end, values_first + begin, comp);
+    });
+  }
+
+  batches.for_each_large_segment([&](size_type begin, size_type end) {
+    thrust::stable_sort_by_key(exec, keys_first + begin, keys_first + end, values_first + begin, comp);
+  });
+}
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
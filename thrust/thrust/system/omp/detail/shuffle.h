@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file shuffle.h
+ *  \brief OpenMP implementation of shuffle and shuffle_copy.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/bucket_shuffle.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+template <typename DerivedPolicy, typename RandomIterator, typename OutputIterator, typename URBG>
+void shuffle_copy(
+  execution_policy<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, OutputIterator result, URBG&& g)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(
+    thrust::detail::depend_on_instantiation<RandomIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+    "OpenMP compiler support is not enabled");
+
+  using value_type = thrust::detail::it_value_t<RandomIterator>;
+  using size_type  = thrust::system::detail::internal::bucket_shuffle::size_type;
+
+  const thrust::system::detail::internal::bucket_shuffle plan(
+    static_cast<size_type>(::cuda::std::distance(first, last)), g);
+  if (plan.size() == 0)
+  {
+    return;
+  }
+
+  const size_type num_buckets = plan.num_buckets();
+  thrust::detail::temporary_array<size_type, DerivedPolicy> offsets(0, exec, plan.num_blocks() * num_buckets);
+  thrust::detail::temporary_array<size_type, DerivedPolicy> bucket_begin(0, exec, num_buckets + 1);
+  thrust::detail::temporary_array<value_type, DerivedPolicy> temp(exec, plan.size());
+
+  size_type* offsets_ptr      = thrust::raw_pointer_cast(offsets.data());
+  size_type* bucket_begin_ptr = thrust::raw_pointer_cast(bucket_begin.data());
+  value_type* temp_ptr        = thrust::raw_pointer_cast(temp.data());
+
+  // use a signed type for the iteration variable or suffer the consequences of warnings
+  const std::int64_t num_blocks         = static_cast<std::int64_t>(plan.num_blocks());
+  const std::int64_t signed_num_buckets = static_cast<std::int64_t>(num_buckets);
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (std::int64_t b = 0; b < num_blocks; ++b)
+  {
+    plan.count_block(b, offsets_ptr + b * num_buckets);
+  }
+
+  plan.compute_offsets(offsets_ptr, bucket_begin_ptr);
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (std::int64_t b = 0; b < num_blocks; ++b)
+  {
+    plan.scatter_block(b, first, temp_ptr, offsets_ptr + b * num_buckets);
+  }
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (std::int64_t j = 0; j < signed_num_buckets; ++j)
+  {
+    plan.shuffle_bucket(j, temp_ptr, result, bucket_begin_ptr);
+  }
+}
+
+template <typename DerivedPolicy, typename RandomIterator, typename URBG>
+void shuffle(execution_policy<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, URBG&& g)
+{
+  // the input is fully consumed before any output is written
+  omp::detail::shuffle_copy(exec, first, last, first, g);
+}
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
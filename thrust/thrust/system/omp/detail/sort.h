@@ -20,6 +20,7 @@
 #  include <omp.h>
 #endif // omp support
 
+#include <thrust/detail/nvtx_policy.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
@@ -98,6 +99,9 @@ void stable_sort(
     return;
   }
 
+  _CCCL_HOST_RANGE_WORK(
+    last - first, 2 * thrust::detail::host_range_bytes<RandomAccessIterator>(last - first), omp_get_max_threads());
+
   THRUST_PRAGMA_OMP(parallel)
   {
     thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(last - first, 1, omp_get_num_threads());
@@ -179,6 +183,11 @@ void stable_sort_by_key(
     return;
   }
 
+  _CCCL_HOST_RANGE_WORK(keys_last - keys_first,
+                        2 * (thrust::detail::host_range_bytes<RandomAccessIterator1>(keys_last - keys_first)
+                             + thrust::detail::host_range_bytes<RandomAccessIterator2>(keys_last - keys_first)),
+                        omp_get_max_threads());
+
   THRUST_PRAGMA_OMP(parallel)
   {
     thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(
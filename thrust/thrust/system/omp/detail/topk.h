@@ -0,0 +1,174 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file topk.h
+ *  \brief OpenMP implementations of topk_by_key and segmented_topk_by_key.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/execute_with_env.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/system/detail/internal/bounded_heap.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__utility/pair.h>
+#include <cuda/std/cstdint>
+
+#include <omp.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+namespace topk_detail
+{
+// use a signed type for the iteration variable or suffer the consequences of warnings
+using size_type = ::cuda::std::int64_t;
+} // namespace topk_detail
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size,
+          typename StrictWeakOrdering>
+::cuda::std::pair<OutputIterator1, OutputIterator2> topk_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k,
+  StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(
+    thrust::detail::depend_on_instantiation<RandomAccessIterator1,
+                                            (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+    "OpenMP compiler support is not enabled");
+
+  using topk_detail::size_type;
+
+  // a negative k selects nothing, like k == 0
+  const size_type max_count = (::cuda::std::max) (size_type{0}, static_cast<size_type>(k));
+
+  const thrust::system::detail::internal::chunked_topk<RandomAccessIterator1, StrictWeakOrdering, size_type> plan(
+    keys_first, static_cast<size_type>(keys_last - keys_first), max_count, comp, omp_get_max_threads());
+
+  const size_type num_chunks = plan.num_chunks();
+  thrust::detail::temporary_array<size_type, DerivedPolicy> candidates(0, exec, num_chunks * plan.k());
+  thrust::detail::temporary_array<size_type, DerivedPolicy> counts(0, exec, num_chunks);
+  thrust::detail::temporary_array<size_type, DerivedPolicy> selected(0, exec, plan.k());
+  size_type* candidates_ptr = thrust::raw_pointer_cast(candidates.data());
+  size_type* counts_ptr     = thrust::raw_pointer_cast(counts.data());
+  size_type* selected_ptr   = thrust::raw_pointer_cast(selected.data());
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (size_type chunk = 0; chunk < num_chunks; ++chunk)
+  {
+    plan.select(chunk, candidates_ptr, counts_ptr);
+  }
+
+  const size_type m =
+    plan.merge(candidates_ptr, counts_ptr, selected_ptr, thrust::detail::requires_sorted_output_v<DerivedPolicy>);
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (size_type i = 0; i < m; ++i)
+  {
+    keys_result[i]   = keys_first[selected_ptr[i]];
+    values_result[i] = values_first[selected_ptr[i]];
+  }
+
+  return {keys_result + m, values_result + m};
+}
+
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size,
+          typename StrictWeakOrdering>
+::cuda::std::pair<OutputIterator1, OutputIterator2> segmented_topk_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k,
+  StrictWeakOrdering comp)
+{
+  using topk_detail::size_type;
+
+  const size_type num_segments = (::cuda::std::max) (size_type{0}, size_type(offsets_last - offsets_first) - 1);
+  const size_type stride       = (::cuda::std::max) (size_type{0}, static_cast<size_type>(k));
+  const size_type num_threads  = omp_get_max_threads();
+
+  if (num_segments < num_threads)
+  {
+    // too few segments to keep every thread busy, select within every segment in parallel instead
+    for (size_type segment = 0; segment < num_segments; ++segment)
+    {
+      const size_type begin = offsets_first[segment];
+      const size_type end   = offsets_first[segment + 1];
+      omp::detail::topk_by_key(
+        exec,
+        keys_first + begin,
+        keys_first + end,
+        values_first + begin,
+        keys_result + segment * stride,
+        values_result + segment * stride,
+        stride,
+        comp);
+    }
+  }
+  else
+  {
+    // one heap per thread
+    thrust::detail::temporary_array<size_type, DerivedPolicy> heaps(0, exec, num_threads * stride);
+    size_type* heaps_ptr = thrust::raw_pointer_cast(heaps.data());
+
+    THRUST_PRAGMA_OMP(parallel for schedule(dynamic))
+    for (size_type segment = 0; segment < num_segments; ++segment)
+    {
+      const size_type begin = offsets_first[segment];
+      const size_type end   = offsets_first[segment + 1];
+      thrust::system::detail::internal::select_topk(
+        keys_first + begin,
+        end - begin,
+        values_first + begin,
+        keys_result + segment * stride,
+        values_result + segment * stride,
+        stride,
+        comp,
+        heaps_ptr + omp_get_thread_num() * stride,
+        thrust::detail::requires_sorted_output_v<DerivedPolicy>);
+    }
+  }
+
+  return {keys_result + num_segments * stride, values_result + num_segments * stride};
+}
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
@@ -21,6 +21,7 @@
 // now get all the algorithm definitions
 #include <thrust/system/omp/detail/adjacent_difference.h>
 #include <thrust/system/omp/detail/assign_value.h>
+#include <thrust/system/omp/detail/batched_copy.h>
 #include <thrust/system/omp/detail/binary_search.h>
 #include <thrust/system/omp/detail/copy.h>
 #include <thrust/system/omp/detail/copy_if.h>
@@ -33,6 +34,7 @@
 #include <thrust/system/omp/detail/gather.h>
 #include <thrust/system/omp/detail/generate.h>
 #include <thrust/system/omp/detail/get_value.h>
+#include <thrust/system/omp/detail/histogram.h>
 #include <thrust/system/omp/detail/inner_product.h>
 #include <thrust/system/omp/detail/iter_swap.h>
 #include <thrust/system/omp/detail/logical.h>
@@ -40,19 +42,26 @@
 #include <thrust/system/omp/detail/merge.h>
 #include <thrust/system/omp/detail/mismatch.h>
 #include <thrust/system/omp/detail/partition.h>
+#include <thrust/system/omp/detail/pipeline.h>
 #include <thrust/system/omp/detail/reduce.h>
 #include <thrust/system/omp/detail/reduce_by_key.h>
 #include <thrust/system/omp/detail/remove.h>
 #include <thrust/system/omp/detail/replace.h>
 #include <thrust/system/omp/detail/reverse.h>
+#include <thrust/system/omp/detail/run_length_encode.h>
 #include <thrust/system/omp/detail/scan.h>
 #include <thrust/system/omp/detail/scan_by_key.h>
 #include <thrust/system/omp/detail/scatter.h>
+#include <thrust/system/omp/detail/segmented_reduce.h>
+#include <thrust/system/omp/detail/segmented_scan.h>
+#include <thrust/system/omp/detail/segmented_sort.h>
 #include <thrust/system/omp/detail/sequence.h>
 #include <thrust/system/omp/detail/set_operations.h>
+#include <thrust/system/omp/detail/shuffle.h>
 #include <thrust/system/omp/detail/sort.h>
 #include <thrust/system/omp/detail/swap_ranges.h>
 #include <thrust/system/omp/detail/tabulate.h>
+#include <thrust/system/omp/detail/topk.h>
 #include <thrust/system/omp/detail/transform.h>
 #include <thrust/system/omp/detail/transform_reduce.h>
 #include <thrust/system/omp/detail/transform_scan.h>
@@ -0,0 +1,146 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file batched_copy.h
+ *  \brief TBB implementations of batched_copy and batched_memcpy.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/system/detail/internal/batched_buffers.h>
+#include <thrust/system/tbb/detail/execute_on_arena.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/transform_scan.h>
+
+#include <cuda/std/__functional/operations.h>
+#include <cuda/std/cstdint>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::tbb::detail
+{
+namespace batched_copy_detail
+{
+using size_type = ::cuda::std::int64_t;
+
+struct size_cast
+{
+  template <typename Size>
+  size_type operator()(Size size) const
+  {
+    return static_cast<size_type>(size);
+  }
+};
+
+template <typename Plan>
+struct copy_body
+{
+  const Plan& m_plan;
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    for (size_type worker = r.begin(); worker != r.end(); ++worker)
+    {
+      m_plan.copy(worker);
+    }
+  }
+};
+
+template <typename DerivedPolicy,
+          typename InputRangeIterator,
+          typename OutputRangeIterator,
+          typename SizeIterator,
+          typename CopyPiece>
+void copy(execution_policy<DerivedPolicy>& exec,
+          InputRangeIterator input_ranges_first,
+          OutputRangeIterator output_ranges_first,
+          SizeIterator sizes_first,
+          size_type num_ranges,
+          CopyPiece copy_piece)
+{
+  using plan_type = thrust::system::detail::internal::
+    batched_copy_plan<InputRangeIterator, OutputRangeIterator, CopyPiece, size_type>;
+
+  if (num_ranges <= 0)
+  {
+    return;
+  }
+
+  // the ranges are the segments of a single range, delimited by the prefix sums of their sizes
+  thrust::detail::temporary_array<size_type, DerivedPolicy> offsets(0, exec, num_ranges + 1);
+  size_type* offsets_ptr = thrust::raw_pointer_cast(offsets.data());
+  offsets_ptr[0]         = 0;
+  thrust::transform_inclusive_scan(
+    exec, sizes_first, sizes_first + num_ranges, offsets_ptr + 1, size_cast{}, ::cuda::std::plus<size_type>());
+
+  invoke_in_arena(exec, [&] {
+    const plan_type plan(
+      input_ranges_first,
+      output_ranges_first,
+      offsets_ptr,
+      num_ranges,
+      ::tbb::this_task_arena::max_concurrency(),
+      copy_piece);
+
+    // every share is already large, so hand them out one at a time
+    ::tbb::parallel_for(::tbb::blocked_range<size_type>(0, plan.num_workers(), 1), copy_body<plan_type>{plan});
+  });
+}
+} // namespace batched_copy_detail
+
+template <typename DerivedPolicy,
+          typename InputRangeIterator,
+          typename OutputRangeIterator,
+          typename SizeIterator,
+          typename Size>
+void batched_copy(execution_policy<DerivedPolicy>& exec,
+                  InputRangeIterator input_ranges_first,
+                  OutputRangeIterator output_ranges_first,
+                  SizeIterator sizes_first,
+                  Size num_ranges)
+{
+  batched_copy_detail::copy(
+    exec,
+    input_ranges_first,
+    output_ranges_first,
+    sizes_first,
+    batched_copy_detail::size_type(num_ranges),
+    thrust::system::detail::internal::copy_range_piece{});
+}
+
+template <typename DerivedPolicy,
+          typename InputBufferIterator,
+          typename OutputBufferIterator,
+          typename SizeIterator,
+          typename Size>
+void batched_memcpy(execution_policy<DerivedPolicy>& exec,
+                    InputBufferIterator input_buffers_first,
+                    OutputBufferIterator output_buffers_first,
+                    SizeIterator sizes_first,
+                    Size num_buffers)
+{
+  batched_copy_detail::copy(
+    exec,
+    input_buffers_first,
+    output_buffers_first,
+    sizes_first,
+    batched_copy_detail::size_type(num_buffers),
+    thrust::system::detail::internal::copy_buffer_piece{});
+}
+} // end namespace system::tbb::detail
+THRUST_NAMESPACE_END
@@ -16,13 +16,64 @@
 #include <thrust/detail/type_traits/minimum_type.h>
 #include <thrust/system/detail/generic/copy.h>
 #include <thrust/system/detail/sequential/copy.h>
+#include <thrust/system/detail/sequential/trivial_copy.h>
+#include <thrust/system/tbb/detail/execute_on_arena.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/type_traits/is_trivially_relocatable.h>
 
+#include <cuda/std/__memory/pointer_traits.h>
 #include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/cstdint>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::tbb::detail
 {
+namespace copy_detail
+{
+using size_type = ::cuda::std::int64_t;
+
+// the number of bytes below which copying with one more task does not pay for spawning it
+constexpr size_type min_bytes_per_task = size_type{1} << 16;
+
+template <typename T>
+struct trivial_copy_body
+{
+  const T* m_first;
+  T* m_result;
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    system::detail::sequential::trivial_copy_n(m_first + r.begin(), r.end() - r.begin(), m_result + r.begin());
+  }
+};
+
+// copies trivially relocatable elements with a memmove per task, of one contiguous chunk each; overlapping ranges,
+// which thrust::copy allows when result precedes first, are left to a single memmove
+template <typename DerivedPolicy, typename T>
+void trivial_copy_n(execution_policy<DerivedPolicy>& exec, const T* first, size_type n, T* result)
+{
+  const size_type grain_size = (min_bytes_per_task + static_cast<size_type>(sizeof(T)) - 1) / sizeof(T);
+
+  const auto input   = reinterpret_cast<::cuda::std::uintptr_t>(first);
+  const auto output  = reinterpret_cast<::cuda::std::uintptr_t>(result);
+  const auto bytes   = static_cast<::cuda::std::uintptr_t>(n) * sizeof(T);
+  const bool overlap = input < output + bytes && output < input + bytes;
+
+  if (n <= grain_size || overlap)
+  {
+    system::detail::sequential::trivial_copy_n(first, n, result);
+    return;
+  }
+
+  invoke_in_arena(exec, [&] {
+    ::tbb::parallel_for(::tbb::blocked_range<size_type>(0, n, grain_size), trivial_copy_body<T>{first, result});
+  });
+}
+} // namespace copy_detail
+
 template <typename DerivedPolicy, typename InputIterator, typename OutputIterator>
 OutputIterator
 copy(execution_policy<DerivedPolicy>& exec, InputIterator first, InputIterator last, OutputIterator result)
@@ -30,7 +81,13 @@ copy(execution_policy<DerivedPolicy>& exec, InputIterator first, InputIterator l
   using traversal1 = typename iterator_traversal<InputIterator>::type;
   using traversal2 = typename iterator_traversal<OutputIterator>::type;
   using traversal  = thrust::detail::minimum_type<traversal1, traversal2>;
-  if constexpr (::cuda::std::is_convertible_v<traversal, random_access_traversal_tag>)
+  if constexpr (thrust::is_indirectly_trivially_relocatable_to<InputIterator, OutputIterator>::value)
+  {
+    const copy_detail::size_type n = last - first;
+    copy_detail::trivial_copy_n(exec, ::cuda::std::to_address(first), n, ::cuda::std::to_address(result));
+    return result + n;
+  }
+  else if constexpr (::cuda::std::is_convertible_v<traversal, random_access_traversal_tag>)
   {
     return system::detail::generic::copy(exec, first, last, result);
   }
@@ -46,7 +103,13 @@ OutputIterator copy_n(execution_policy<DerivedPolicy>& exec, InputIterator first
   using traversal1 = typename iterator_traversal<InputIterator>::type;
   using traversal2 = typename iterator_traversal<OutputIterator>::type;
   using traversal  = thrust::detail::minimum_type<traversal1, traversal2>;
-  if constexpr (::cuda::std::is_convertible_v<traversal, random_access_traversal_tag>)
+  if constexpr (thrust::is_indirectly_trivially_relocatable_to<InputIterator, OutputIterator>::value)
+  {
+    copy_detail::trivial_copy_n(
+      exec, ::cuda::std::to_address(first), static_cast<copy_detail::size_type>(n), ::cuda::std::to_address(result));
+    return result + n;
+  }
+  else if constexpr (::cuda::std::is_convertible_v<traversal, random_access_traversal_tag>)
   {
     return system::detail::generic::copy_n(exec, first, n, result);
   }
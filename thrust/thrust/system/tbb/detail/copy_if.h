@@ -15,6 +15,7 @@
 
 #include <thrust/detail/function.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/tbb/detail/execute_on_arena.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
 #include <cuda/std/__iterator/advance.h>
@@ -95,9 +96,17 @@ struct body
 }; // end body
 } // namespace copy_if_detail
 
-template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Predicate>
-OutputIterator
-copy_if(tag, InputIterator1 first, InputIterator1 last, InputIterator2 stencil, OutputIterator result, Predicate pred)
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename Predicate>
+OutputIterator copy_if(execution_policy<DerivedPolicy>& exec,
+                       InputIterator1 first,
+                       InputIterator1 last,
+                       InputIterator2 stencil,
+                       OutputIterator result,
+                       Predicate pred)
 {
   using Size = thrust::detail::it_difference_t<InputIterator1>;
   using Body = typename copy_if_detail::body<InputIterator1, InputIterator2, OutputIterator, Predicate, Size>;
@@ -107,7 +116,9 @@ copy_if(tag, InputIterator1 first, InputIterator1 last, InputIterator2 stencil,
   if (n != 0)
   {
     Body body(first, stencil, result, pred);
-    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), body);
+    invoke_in_arena(exec, [&] {
+      ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), body);
+    });
     ::cuda::std::advance(result, body.sum);
   }
 
@@ -0,0 +1,177 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/allocator_aware_execution_policy.h>
+#include <thrust/detail/execute_with_env.h>
+#include <thrust/detail/nvtx_policy.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+
+#include <cuda/std/__type_traits/remove_reference.h>
+#include <cuda/std/__type_traits/void_t.h>
+#include <cuda/std/__utility/declval.h>
+
+#include <tbb/task_arena.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::tbb::detail
+{
+//! The CRTP base of a policy of the TBB system whose algorithms run inside a given \c tbb::task_arena. It carries the
+//! arena, so a policy with an environment or an allocator on top of it keeps running its algorithms in the arena.
+template <typename Arena>
+struct on_arena
+{
+  template <typename Derived>
+  struct type : execution_policy<Derived>
+  {
+  private:
+    Arena* arena;
+    bool isolate;
+
+  public:
+    type(Arena& arena_, bool isolate_ = false)
+        : arena(&arena_)
+        , isolate(isolate_)
+    {}
+
+    template <typename Other>
+    type(const type<Other>& other)
+        : arena(&other.get_arena())
+        , isolate(other.is_isolated())
+    {}
+
+    //! Returns a policy whose algorithms run in \c tbb::this_task_arena::isolate: threads that wait for them do not
+    //! take unrelated tasks of the same arena, and their tasks are not taken by threads that wait for unrelated work.
+    Derived isolated() const
+    {
+      Derived result = thrust::detail::derived_cast(*this);
+      static_cast<type&>(result).isolate = true;
+      return result;
+    }
+
+    Arena& get_arena() const
+    {
+      return *arena;
+    }
+
+    bool is_isolated() const
+    {
+      return isolate;
+    }
+  };
+};
+
+//! An execution policy of the TBB system whose algorithms run inside a given \c tbb::task_arena, and therefore only use
+//! the threads, NUMA node and core types the arena was constrained to. The arena must outlive the algorithms that use
+//! the policy. It can be given an environment and an allocator, in this order.
+//!
+//! \code
+//! tbb::task_arena arena(tbb::task_arena::constraints{}.set_numa_id(numa_node).set_max_concurrency(8));
+//! thrust::sort(thrust::tbb::par.on(arena), keys.begin(), keys.end());
+//! thrust::sort(thrust::tbb::par.on(arena).isolated(), keys.begin(), keys.end());
+//! thrust::sort(thrust::tbb::par.on(arena).with(env)(alloc), keys.begin(), keys.end());
+//! \endcode
+template <typename Arena>
+struct execute_on_arena
+    : on_arena<Arena>::template type<execute_on_arena<Arena>>
+    , thrust::detail::stateful_allocator_aware_execution_policy<on_arena<Arena>::template type, execute_on_arena<Arena>>
+{
+private:
+  using super_t = typename on_arena<Arena>::template type<execute_on_arena<Arena>>;
+
+public:
+  using super_t::super_t;
+};
+
+template <typename DerivedPolicy, typename = void>
+inline constexpr bool has_arena_v = false;
+
+template <typename DerivedPolicy>
+inline constexpr bool has_arena_v<
+  DerivedPolicy,
+  ::cuda::std::void_t<decltype(::cuda::std::declval<const DerivedPolicy&>().get_arena())>> = true;
+
+template <typename DerivedPolicy, typename = void>
+inline constexpr bool has_allocator_v = false;
+
+template <typename DerivedPolicy>
+inline constexpr bool has_allocator_v<
+  DerivedPolicy,
+  ::cuda::std::void_t<decltype(::cuda::std::declval<DerivedPolicy&>().get_allocator())>> = true;
+
+template <typename Derived>
+template <typename Env>
+auto execution_policy<Derived>::with(Env env) const
+{
+  static_assert(!has_allocator_v<Derived>, "give the policy its allocator after its environment");
+
+  if constexpr (has_arena_v<Derived>)
+  {
+    const Derived& policy = thrust::detail::derived_cast(*this);
+    using arena_t         = ::cuda::std::remove_reference_t<decltype(policy.get_arena())>;
+    return thrust::detail::execute_with_env<Env, on_arena<arena_t>::template type>(
+      env, policy.get_arena(), policy.is_isolated());
+  }
+  else
+  {
+    return thrust::detail::execute_with_env<Env, execution_policy>(env);
+  }
+}
+
+template <typename Derived>
+template <typename Arena>
+auto execution_policy<Derived>::on(Arena& arena) const
+{
+  static_assert(!has_allocator_v<Derived>, "give the policy its allocator after its arena");
+
+  if constexpr (thrust::detail::execution_policy_has_env_v<Derived>)
+  {
+    return thrust::detail::execute_with_env<typename thrust::detail::execution_policy_env<Derived>::type,
+                                            on_arena<Arena>::template type>(
+      thrust::detail::derived_cast(*this).get_env(), arena);
+  }
+  else
+  {
+    return execute_on_arena<Arena>(arena);
+  }
+}
+
+//! Invokes \p f, which starts TBB parallel algorithms, in the arena of \p exec, or in the arena of the calling thread
+//! if \p exec does not have one.
+template <typename DerivedPolicy, typename F>
+void invoke_in_arena([[maybe_unused]] execution_policy<DerivedPolicy>& exec, F&& f)
+{
+  if constexpr (has_arena_v<DerivedPolicy>)
+  {
+    const DerivedPolicy& policy = thrust::detail::derived_cast(exec);
+    policy.get_arena().execute([&] {
+      _CCCL_HOST_RANGE_WORK(0, 0, ::tbb::this_task_arena::max_concurrency());
+      if (policy.is_isolated())
+      {
+        ::tbb::this_task_arena::isolate(f);
+      }
+      else
+      {
+        f();
+      }
+    });
+  }
+  else
+  {
+    _CCCL_HOST_RANGE_WORK(0, 0, ::tbb::this_task_arena::max_concurrency());
+    f();
+  }
+}
+} // namespace system::tbb::detail
+THRUST_NAMESPACE_END
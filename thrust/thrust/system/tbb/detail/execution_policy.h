@@ -13,6 +13,7 @@
 #endif // no system header
 
 #include <thrust/detail/allocator_aware_execution_policy.h>
+#include <thrust/detail/execute_with_env.h>
 #include <thrust/system/cpp/detail/execution_policy.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
@@ -46,8 +47,27 @@ struct execution_policy : cpp::execution_policy<Derived>
   {
     return tag();
   }
+
+  //! Returns a policy that also carries the environment \p env, and keeps the arena of this policy. For example,
+  //! algorithms invoked with
+  //! <tt>thrust::tbb::par.with(cuda::execution::require(cuda::execution::determinism::run_to_run))</tt> return
+  //! the same results for any number of threads.
+  template <typename Env>
+  auto with(Env env) const;
+
+  //! Returns a policy whose algorithms run inside the \c tbb::task_arena \p arena, and which keeps the environment of
+  //! this policy.
+  template <typename Arena>
+  auto on(Arena& arena) const;
 };
 
+// with() and on() are defined in execute_on_arena.h, which is the only header that needs TBB's task_arena
+template <typename Arena>
+struct on_arena;
+
+template <typename Arena>
+struct execute_on_arena;
+
 struct par_t
     : execution_policy<par_t>
     , thrust::detail::allocator_aware_execution_policy<execution_policy>
@@ -74,6 +94,12 @@ using detail::execution_policy;
 //! Explicit dispatch can be useful in avoiding the introduction of data copies into containers such as \p
 //! thrust::tbb::vector.
 //!
+//! <tt>thrust::tbb::par.on(arena)</tt> runs algorithms inside the \c tbb::task_arena \p arena instead of the arena of
+//! the calling thread, which confines them to the concurrency, NUMA node and core types the arena was constrained to.
+//! <tt>thrust::tbb::par.on(arena).isolated()</tt> additionally runs them in \c tbb::this_task_arena::isolate.
+//! The arena composes with an environment given by \p with in either order, and the allocator is given last, as in
+//! <tt>thrust::tbb::par.on(arena).with(env)(alloc)</tt>.
+//!
 //! The type of \p thrust::tbb::par is implementation-defined.
 //!
 //! The following code snippet demonstrates how to use \p thrust::tbb::par to explicitly dispatch an invocation of \p
@@ -12,17 +12,67 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
-#include <thrust/system/detail/generic/find.h>
+#include <thrust/detail/autotune.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/cooperative_find.h>
+#include <thrust/system/tbb/detail/execute_on_arena.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
+#include <cuda/std/__iterator/distance.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
 THRUST_NAMESPACE_BEGIN
 namespace system::tbb::detail
 {
+namespace find_detail
+{
+template <typename Size, typename InputIterator, typename Predicate>
+struct body
+{
+  thrust::system::detail::internal::cooperative_find<Size>& m_find;
+  InputIterator m_first;
+  Predicate m_pred;
+
+  void operator()(const ::tbb::blocked_range<int>& r) const
+  {
+    for (int i = r.begin(); i != r.end(); ++i)
+    {
+      m_find.run(m_first, m_pred);
+    }
+  }
+};
+} // namespace find_detail
+
 template <typename DerivedPolicy, typename InputIterator, typename Predicate>
 InputIterator find_if(execution_policy<DerivedPolicy>& exec, InputIterator first, InputIterator last, Predicate pred)
 {
-  // tbb prefers generic::find_if to cpp::find_if
-  return thrust::system::detail::generic::find_if(exec, first, last, pred);
+  using difference_type = thrust::detail::it_difference_t<InputIterator>;
+
+  const difference_type n = ::cuda::std::distance(first, last);
+  thrust::system::detail::internal::cooperative_find<difference_type> find(n);
+
+  const difference_type sequential_threshold = thrust::detail::tuned_value(
+    thrust::detail::autotune_knob::tbb_find_if_sequential_threshold,
+    sizeof(thrust::detail::it_value_t<InputIterator>),
+    find.sequential_threshold);
+
+  if (n < sequential_threshold)
+  {
+    find.run(first, pred);
+  }
+  else
+  {
+    invoke_in_arena(exec, [&] {
+      // one task per worker, each of which keeps claiming blocks until the result is known
+      const ::tbb::blocked_range<int> workers(0, ::tbb::this_task_arena::max_concurrency(), 1);
+      ::tbb::parallel_for(workers, find_detail::body<difference_type, InputIterator, Predicate>{find, first, pred});
+    });
+  }
+
+  return first + find.result();
 }
 } // end namespace system::tbb::detail
 THRUST_NAMESPACE_END
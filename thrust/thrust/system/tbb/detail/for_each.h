@@ -13,9 +13,11 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/nvtx_policy.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/static_assert.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/tbb/detail/execute_on_arena.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
 #include <cuda/std/__iterator/distance.h>
@@ -54,9 +56,14 @@ body<RandomAccessIterator, Size, UnaryFunction> make_body(RandomAccessIterator f
 } // namespace for_each_detail
 
 template <typename DerivedPolicy, typename RandomAccessIterator, typename Size, typename UnaryFunction>
-RandomAccessIterator for_each_n(execution_policy<DerivedPolicy>&, RandomAccessIterator first, Size n, UnaryFunction f)
+RandomAccessIterator
+for_each_n(execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, Size n, UnaryFunction f)
 {
-  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, n), for_each_detail::make_body<Size>(first, f));
+  _CCCL_HOST_RANGE_WORK(n, thrust::detail::host_range_bytes<RandomAccessIterator>(n), 0);
+
+  invoke_in_arena(exec, [&] {
+    ::tbb::parallel_for(::tbb::blocked_range<Size>(0, n), for_each_detail::make_body<Size>(first, f));
+  });
 
   // return the end of the range
   return first + n;
@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file histogram.h
+ *  \brief TBB implementation of histogram.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/privatized_histogram.h>
+#include <thrust/system/tbb/detail/execute_on_arena.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+
+#include <cuda/std/array>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::tbb::detail
+{
+namespace histogram_detail
+{
+using size_type = ::cuda::std::int64_t;
+
+template <typename Plan, typename InputIterator>
+struct count_body
+{
+  const Plan& m_plan;
+  InputIterator m_first;
+  size_type* m_counters;
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    for (size_type worker = r.begin(); worker != r.end(); ++worker)
+    {
+      m_plan.count(worker, m_first, m_counters + worker * m_plan.size());
+    }
+  }
+};
+
+template <typename Plan, typename CounterIterator>
+struct merge_body
+{
+  const Plan& m_plan;
+  int m_channel;
+  const size_type* m_counters;
+  CounterIterator m_histogram;
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    for (size_type bin = r.begin(); bin != r.end(); ++bin)
+    {
+      m_plan.merge(m_channel, bin, m_counters, m_histogram);
+    }
+  }
+};
+} // namespace histogram_detail
+
+template <int NumChannels,
+          typename DerivedPolicy,
+          typename InputIterator,
+          typename CounterIterator,
+          ::cuda::std::size_t NumActiveChannels,
+          typename BinOp>
+void histogram(execution_policy<DerivedPolicy>& exec,
+               InputIterator first,
+               InputIterator last,
+               ::cuda::std::array<CounterIterator, NumActiveChannels> histograms,
+               ::cuda::std::array<BinOp, NumActiveChannels> bin_ops)
+{
+  using histogram_detail::size_type;
+  using plan_type = thrust::system::detail::internal::
+    privatized_histogram<NumChannels, static_cast<int>(NumActiveChannels), size_type, BinOp>;
+
+  invoke_in_arena(exec, [&] {
+    const plan_type plan(
+      bin_ops, static_cast<size_type>((last - first) / NumChannels), ::tbb::this_task_arena::max_concurrency());
+
+    thrust::detail::temporary_array<size_type, DerivedPolicy> counters(0, exec, plan.num_workers() * plan.size());
+    size_type* counters_ptr = thrust::raw_pointer_cast(counters.data());
+
+    // every worker already counts a large range of pixels, so hand them out one at a time
+    ::tbb::parallel_for(::tbb::blocked_range<size_type>(0, plan.num_workers(), 1),
+                        histogram_detail::count_body<plan_type, InputIterator>{plan, first, counters_ptr});
+
+    for (int channel = 0; channel < static_cast<int>(NumActiveChannels); ++channel)
+    {
+      ::tbb::parallel_for(
+        ::tbb::blocked_range<size_type>(0, plan.num_bins(channel)),
+        histogram_detail::merge_body<plan_type, CounterIterator>{plan, channel, counters_ptr, histograms[channel]});
+    }
+  });
+}
+} // end namespace system::tbb::detail
+THRUST_NAMESPACE_END
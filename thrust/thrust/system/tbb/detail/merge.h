@@ -17,6 +17,7 @@
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
+#include <thrust/system/tbb/detail/execute_on_arena.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
 #include <tbb/parallel_for.h>
@@ -235,7 +236,7 @@ template <typename DerivedPolicy,
           typename OutputIterator,
           typename StrictWeakOrdering>
 OutputIterator
-merge(execution_policy<DerivedPolicy>&,
+merge(execution_policy<DerivedPolicy>& exec,
       InputIterator1 first1,
       InputIterator1 last1,
       InputIterator2 first2,
@@ -248,7 +249,9 @@ merge(execution_policy<DerivedPolicy>&,
   Range range(first1, last1, first2, last2, result, comp);
   Body body;
 
-  ::tbb::parallel_for(range, body);
+  invoke_in_arena(exec, [&] {
+    ::tbb::parallel_for(range, body);
+  });
 
   ::cuda::std::advance(result, ::cuda::std::distance(first1, last1) + ::cuda::std::distance(first2, last2));
 
@@ -264,7 +267,7 @@ template <typename DerivedPolicy,
           typename OutputIterator2,
           typename StrictWeakOrdering>
 ::cuda::std::pair<OutputIterator1, OutputIterator2> merge_by_key(
-  execution_policy<DerivedPolicy>&,
+  execution_policy<DerivedPolicy>& exec,
   InputIterator1 keys_first1,
   InputIterator1 keys_last1,
   InputIterator2 keys_first2,
@@ -289,7 +292,9 @@ template <typename DerivedPolicy,
     keys_first1, keys_last1, keys_first2, keys_last2, values_first3, values_first4, keys_result, values_result, comp);
   Body body;
 
-  ::tbb::parallel_for(range, body);
+  invoke_in_arena(exec, [&] {
+    ::tbb::parallel_for(range, body);
+  });
 
   ::cuda::std::advance(keys_result,
                        ::cuda::std::distance(keys_first1, keys_last1) + ::cuda::std::distance(keys_first2, keys_last2));
@@ -12,14 +12,113 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/temporary_array.h>
 #include <thrust/system/detail/generic/partition.h>
+#include <thrust/system/detail/internal/chunked_three_way_partition.h>
+#include <thrust/system/tbb/detail/execute_on_arena.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
 #include <cuda/std/__utility/pair.h>
+#include <cuda/std/cstdint>
+#include <cuda/std/tuple>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::tbb::detail
 {
+namespace three_way_partition_detail
+{
+using size_type = ::cuda::std::int64_t;
+
+template <typename Plan>
+struct count_body
+{
+  const Plan& m_plan;
+  size_type* m_counts;
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    for (size_type chunk = r.begin(); chunk != r.end(); ++chunk)
+    {
+      m_plan.count(chunk, m_counts);
+    }
+  }
+};
+
+template <typename Plan, typename OutputIterator1, typename OutputIterator2, typename OutputIterator3>
+struct write_body
+{
+  const Plan& m_plan;
+  const size_type* m_positions;
+  OutputIterator1 m_out_first_part;
+  OutputIterator2 m_out_second_part;
+  OutputIterator3 m_out_unselected;
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    for (size_type chunk = r.begin(); chunk != r.end(); ++chunk)
+    {
+      m_plan.write(chunk, m_positions, m_out_first_part, m_out_second_part, m_out_unselected);
+    }
+  }
+};
+
+// returns the ends of the three groups in their outputs
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename OutputIterator3,
+          typename Predicate1,
+          typename Predicate2>
+::cuda::std::tuple<size_type, size_type, size_type> partition_chunks(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator1 out_first_part,
+  OutputIterator2 out_second_part,
+  OutputIterator3 out_unselected,
+  Predicate1 select_first_part,
+  Predicate2 select_second_part,
+  bool concatenate)
+{
+  using plan_type = thrust::system::detail::internal::
+    chunked_three_way_partition<RandomAccessIterator, Predicate1, Predicate2, size_type>;
+
+  ::cuda::std::tuple<size_type, size_type, size_type> ends;
+  invoke_in_arena(exec, [&] {
+    const plan_type plan(first,
+                         static_cast<size_type>(last - first),
+                         select_first_part,
+                         select_second_part,
+                         ::tbb::this_task_arena::max_concurrency());
+
+    thrust::detail::temporary_array<size_type, DerivedPolicy> positions(0, exec, 3 * (plan.num_chunks() + 1));
+    size_type* positions_ptr = thrust::raw_pointer_cast(positions.data());
+
+    // every chunk is already large, so hand them out one at a time
+    const ::tbb::blocked_range<size_type> chunks(0, plan.num_chunks(), 1);
+
+    ::tbb::parallel_for(chunks, count_body<plan_type>{plan, positions_ptr});
+
+    plan.scan(positions_ptr, concatenate);
+
+    ::tbb::parallel_for(
+      chunks,
+      write_body<plan_type, OutputIterator1, OutputIterator2, OutputIterator3>{
+        plan, positions_ptr, out_first_part, out_second_part, out_unselected});
+
+    const size_type* last_positions = positions_ptr + 3 * plan.num_chunks();
+    ends = ::cuda::std::make_tuple(last_positions[0], last_positions[1], last_positions[2]);
+  });
+
+  return ends;
+}
+} // namespace three_way_partition_detail
+
 template <typename DerivedPolicy, typename ForwardIterator, typename Predicate>
 ForwardIterator
 stable_partition(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, Predicate pred)
@@ -75,5 +174,48 @@ template <typename DerivedPolicy,
   // tbb prefers generic::stable_partition_copy to cpp::stable_partition_copy
   return thrust::system::detail::generic::stable_partition_copy(exec, first, last, stencil, out_true, out_false, pred);
 } // end stable_partition_copy()
+template <typename DerivedPolicy, typename RandomAccessIterator, typename Predicate1, typename Predicate2>
+::cuda::std::pair<RandomAccessIterator, RandomAccessIterator> three_way_partition(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  Predicate1 select_first_part,
+  Predicate2 select_second_part)
+{
+  using T = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  // partition a copy of the input back into it, with the groups one after the other
+  thrust::detail::temporary_array<T, DerivedPolicy> temp(exec, first, last);
+  const auto ends = three_way_partition_detail::partition_chunks(
+    exec, temp.begin(), temp.end(), first, first, first, select_first_part, select_second_part, true);
+
+  return {first + ::cuda::std::get<0>(ends), first + ::cuda::std::get<1>(ends)};
+} // end three_way_partition()
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename OutputIterator3,
+          typename Predicate1,
+          typename Predicate2>
+::cuda::std::tuple<OutputIterator1, OutputIterator2, OutputIterator3> three_way_partition_copy(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator1 out_first_part,
+  OutputIterator2 out_second_part,
+  OutputIterator3 out_unselected,
+  Predicate1 select_first_part,
+  Predicate2 select_second_part)
+{
+  const auto ends = three_way_partition_detail::partition_chunks(
+    exec, first, last, out_first_part, out_second_part, out_unselected, select_first_part, select_second_part, false);
+
+  return ::cuda::std::tuple<OutputIterator1, OutputIterator2, OutputIterator3>(
+    out_first_part + ::cuda::std::get<0>(ends),
+    out_second_part + ::cuda::std::get<1>(ends),
+    out_unselected + ::cuda::std::get<2>(ends));
+} // end three_way_partition_copy()
 } // end namespace system::tbb::detail
 THRUST_NAMESPACE_END
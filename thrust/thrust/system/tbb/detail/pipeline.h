@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file pipeline.h
+ *  \brief TBB implementation of pipeline.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/system/tbb/detail/execute_on_arena.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/cstddef>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::tbb::detail
+{
+namespace pipeline_detail
+{
+template <typename Pipeline>
+struct worker_body
+{
+  Pipeline& m_pipeline;
+
+  void operator()(const ::tbb::blocked_range<::cuda::std::size_t>& r) const
+  {
+    for (::cuda::std::size_t worker = r.begin(); worker != r.end(); ++worker)
+    {
+      // a worker waits for the carries of the tiles claimed before its own, so it must not take another worker's task
+      // while the functions of the stages wait for nested parallel algorithms
+      ::tbb::this_task_arena::isolate([this] {
+        m_pipeline.run_worker();
+      });
+    }
+  }
+};
+} // namespace pipeline_detail
+
+template <typename DerivedPolicy, typename Pipeline>
+void run_pipeline(execution_policy<DerivedPolicy>& exec, Pipeline& pipeline)
+{
+  invoke_in_arena(exec, [&] {
+    const ::cuda::std::size_t num_workers = ::cuda::std::min<::cuda::std::size_t>(
+      static_cast<::cuda::std::size_t>(::tbb::this_task_arena::max_concurrency()), pipeline.num_tiles());
+
+    // every worker claims tiles until none is left
+    ::tbb::parallel_for(::tbb::blocked_range<::cuda::std::size_t>(0, num_workers, 1),
+                        pipeline_detail::worker_body<Pipeline>{pipeline});
+  });
+} // end run_pipeline()
+} // end namespace system::tbb::detail
+THRUST_NAMESPACE_END
@@ -16,15 +16,22 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/execute_with_env.h>
 #include <thrust/detail/function.h>
+#include <thrust/detail/nvtx_policy.h>
+#include <thrust/detail/raw_pointer_cast.h>
 #include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/reduce.h>
+#include <thrust/system/detail/internal/deterministic_tiling.h>
+#include <thrust/system/tbb/detail/execute_on_arena.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
 #include <cuda/std/__iterator/distance.h>
 
 #include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 #include <tbb/parallel_reduce.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -95,25 +102,64 @@ struct body
     sum = binary_op(sum, b.sum);
   }
 }; // end body
+
+// reduces fixed-size tiles, so that the result does not depend on the number of threads
+template <typename Size, typename RandomAccessIterator, typename OutputType, typename BinaryFunction>
+struct tile_body
+{
+  const thrust::system::detail::internal::deterministic_tiling<Size>& tiling;
+  RandomAccessIterator first;
+  OutputType* partials;
+  thrust::detail::wrapped_function<BinaryFunction, OutputType> binary_op;
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    for (Size tile = r.begin(); tile != r.end(); ++tile)
+    {
+      tiling.reduce_tile(tile, first, partials, binary_op);
+    }
+  }
+};
 } // namespace reduce_detail
 
 template <typename DerivedPolicy, typename InputIterator, typename OutputType, typename BinaryFunction>
-OutputType reduce(
-  execution_policy<DerivedPolicy>&, InputIterator begin, InputIterator end, OutputType init, BinaryFunction binary_op)
+OutputType reduce(execution_policy<DerivedPolicy>& exec,
+                  InputIterator begin,
+                  InputIterator end,
+                  OutputType init,
+                  BinaryFunction binary_op)
 {
   using Size = thrust::detail::it_difference_t<InputIterator>;
 
   Size n = ::cuda::std::distance(begin, end);
 
+  _CCCL_HOST_RANGE_WORK(n, thrust::detail::host_range_bytes<InputIterator>(n), 0);
+
   if (n == 0)
   {
     return init;
   }
+  else if constexpr (thrust::detail::requires_determinism_v<DerivedPolicy>)
+  {
+    const thrust::system::detail::internal::deterministic_tiling<Size> tiling(n);
+
+    thrust::detail::temporary_array<OutputType, DerivedPolicy> partial_sums(exec, tiling.size());
+    OutputType* partials = thrust::raw_pointer_cast(partial_sums.data());
+
+    using Body = reduce_detail::tile_body<Size, InputIterator, OutputType, BinaryFunction>;
+    invoke_in_arena(exec, [&] {
+      ::tbb::parallel_for(::tbb::blocked_range<Size>(0, tiling.size(), 1), Body{tiling, begin, partials, {binary_op}});
+    });
+
+    return tiling.combine(init, partials, thrust::detail::wrapped_function<BinaryFunction, OutputType>{binary_op});
+  }
   else
   {
     using Body = typename reduce_detail::body<InputIterator, OutputType, BinaryFunction>;
     Body reduce_body(begin, init, binary_op);
-    ::tbb::parallel_reduce(::tbb::blocked_range<Size>(0, n), reduce_body);
+    invoke_in_arena(exec, [&] {
+      ::tbb::parallel_reduce(::tbb::blocked_range<Size>(0, n), reduce_body);
+    });
     return binary_op(init, reduce_body.sum);
   }
 }
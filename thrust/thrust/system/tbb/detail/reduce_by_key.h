@@ -16,6 +16,7 @@
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/scan.h>
+#include <thrust/system/tbb/detail/execute_on_arena.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 #include <thrust/system/tbb/detail/reduce_intervals.h>
 
@@ -339,21 +340,23 @@ template <typename DerivedPolicy,
   thrust::detail::temporary_array<carry_type, DerivedPolicy> carries(0, exec, num_intervals - 1);
 
   // force grainsize == 1 with simple_partioner()
-  ::tbb::parallel_for(
-    ::tbb::blocked_range<difference_type>(0, num_intervals, 1),
-    reduce_by_key_detail::make_serial_reduce_by_key_body(
-      keys_first,
-      values_first,
-      interval_output_offsets.begin(),
-      keys_result,
-      values_result,
-      carries.begin(),
-      n,
-      interval_size,
-      num_intervals,
-      binary_pred,
-      binary_op),
-    ::tbb::simple_partitioner());
+  invoke_in_arena(exec, [&] {
+    ::tbb::parallel_for(
+      ::tbb::blocked_range<difference_type>(0, num_intervals, 1),
+      reduce_by_key_detail::make_serial_reduce_by_key_body(
+        keys_first,
+        values_first,
+        interval_output_offsets.begin(),
+        keys_result,
+        values_result,
+        carries.begin(),
+        n,
+        interval_size,
+        num_intervals,
+        binary_pred,
+        binary_op),
+      ::tbb::simple_partitioner());
+  });
 
   difference_type size_of_result = interval_output_offsets[num_intervals];
 
@@ -0,0 +1,157 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file run_length_encode.h
+ *  \brief TBB implementations of run_length_encode and non_trivial_runs.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/temporary_array.h>
+#include <thrust/system/detail/internal/chunked_runs.h>
+#include <thrust/system/tbb/detail/execute_on_arena.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+
+#include <cuda/std/__utility/pair.h>
+#include <cuda/std/cstdint>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::tbb::detail
+{
+namespace run_length_encode_detail
+{
+using size_type = ::cuda::std::int64_t;
+
+template <typename Plan>
+struct count_body
+{
+  const Plan& m_plan;
+  typename Plan::chunk_summary* m_summaries;
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    for (size_type chunk = r.begin(); chunk != r.end(); ++chunk)
+    {
+      m_plan.count(chunk, m_summaries);
+    }
+  }
+};
+
+template <typename Plan, typename Writer>
+struct write_body
+{
+  const Plan& m_plan;
+  const typename Plan::chunk_summary* m_summaries;
+  Writer m_writer;
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    for (size_type chunk = r.begin(); chunk != r.end(); ++chunk)
+    {
+      m_plan.write(chunk, m_summaries, m_writer);
+    }
+  }
+};
+
+template <typename DerivedPolicy, typename InputIterator, typename BinaryPredicate, typename Writer>
+size_type
+encode_runs(execution_policy<DerivedPolicy>& exec,
+            InputIterator first,
+            InputIterator last,
+            BinaryPredicate binary_pred,
+            size_type min_length,
+            Writer writer)
+{
+  using plan_type    = thrust::system::detail::internal::chunked_runs<InputIterator, BinaryPredicate, size_type>;
+  using summary_type = typename plan_type::chunk_summary;
+
+  size_type num_runs = 0;
+  invoke_in_arena(exec, [&] {
+    const plan_type plan(first,
+                         static_cast<size_type>(last - first),
+                         binary_pred,
+                         min_length,
+                         ::tbb::this_task_arena::max_concurrency());
+
+    thrust::detail::temporary_array<summary_type, DerivedPolicy> summaries(0, exec, plan.num_chunks());
+    summary_type* summaries_ptr = thrust::raw_pointer_cast(summaries.data());
+
+    // every chunk is already large, so hand them out one at a time
+    const ::tbb::blocked_range<size_type> chunks(0, plan.num_chunks(), 1);
+
+    ::tbb::parallel_for(chunks, count_body<plan_type>{plan, summaries_ptr});
+
+    num_runs = plan.scan(summaries_ptr);
+
+    ::tbb::parallel_for(chunks, write_body<plan_type, Writer>{plan, summaries_ptr, writer});
+  });
+
+  return num_runs;
+}
+} // namespace run_length_encode_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+::cuda::std::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 unique_output,
+  OutputIterator2 counts_output,
+  BinaryPredicate binary_pred)
+{
+  const auto num_runs = run_length_encode_detail::encode_runs(
+    exec,
+    first,
+    last,
+    binary_pred,
+    1,
+    thrust::system::detail::internal::run_length_encode_writer<InputIterator, OutputIterator1, OutputIterator2>{
+      first, unique_output, counts_output});
+
+  return {unique_output + num_runs, counts_output + num_runs};
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+::cuda::std::pair<OutputIterator1, OutputIterator2> non_trivial_runs(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator1 offsets_output,
+  OutputIterator2 lengths_output,
+  BinaryPredicate binary_pred)
+{
+  const auto num_runs = run_length_encode_detail::encode_runs(
+    exec,
+    first,
+    last,
+    binary_pred,
+    2,
+    thrust::system::detail::internal::non_trivial_runs_writer<OutputIterator1, OutputIterator2>{
+      offsets_output, lengths_output});
+
+  return {offsets_output + num_runs, lengths_output + num_runs};
+}
+} // end namespace system::tbb::detail
+THRUST_NAMESPACE_END
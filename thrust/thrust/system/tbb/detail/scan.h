@@ -16,16 +16,22 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/execute_with_env.h>
 #include <thrust/detail/function.h>
+#include <thrust/detail/nvtx_policy.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
 #include <thrust/detail/type_traits.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/deterministic_tiling.h>
+#include <thrust/system/tbb/detail/execute_on_arena.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
 #include <cuda/std/__functional/invoke.h>
-#include <cuda/std/__iterator/advance.h>
 #include <cuda/std/__iterator/distance.h>
 
 #include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 #include <tbb/parallel_scan.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -216,11 +222,110 @@ struct exclusive_body
     sum = b.sum;
   }
 };
+
+template <typename Size, typename InputIterator, typename ValueType, typename BinaryFunction>
+struct reduce_tile_body
+{
+  const thrust::system::detail::internal::deterministic_tiling<Size>& tiling;
+  InputIterator input;
+  ValueType* partials;
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> binary_op;
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    for (Size tile = r.begin(); tile != r.end(); ++tile)
+    {
+      tiling.reduce_tile(tile, input, partials, binary_op);
+    }
+  }
+};
+
+template <bool IsInclusive,
+          bool HasInit,
+          typename Size,
+          typename InputIterator,
+          typename OutputIterator,
+          typename ValueType,
+          typename BinaryFunction>
+struct scan_tile_body
+{
+  const thrust::system::detail::internal::deterministic_tiling<Size>& tiling;
+  InputIterator input;
+  OutputIterator output;
+  const ValueType* partials;
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> binary_op;
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    for (Size tile = r.begin(); tile != r.end(); ++tile)
+    {
+      if constexpr (IsInclusive)
+      {
+        tiling.template inclusive_scan_tile<HasInit>(tile, input, output, partials, binary_op);
+      }
+      else
+      {
+        tiling.exclusive_scan_tile(tile, input, output, partials, binary_op);
+      }
+    }
+  }
+};
+
+// scans fixed-size tiles, so that the result does not depend on the number of threads
+template <bool IsInclusive,
+          typename ValueType,
+          typename DerivedPolicy,
+          typename InputIterator,
+          typename Size,
+          typename OutputIterator,
+          typename BinaryFunction,
+          typename... InitialValueType>
+void deterministic_scan(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  Size n,
+  OutputIterator result,
+  BinaryFunction binary_op,
+  InitialValueType... init)
+{
+  static constexpr bool has_init = sizeof...(InitialValueType) != 0;
+
+  const thrust::system::detail::internal::deterministic_tiling<Size> tiling(n);
+  const ::tbb::blocked_range<Size> tiles(0, tiling.size(), 1);
+
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> tile_sums(exec, tiling.size());
+  ValueType* partials = thrust::raw_pointer_cast(tile_sums.data());
+
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op{binary_op};
+
+  _CCCL_HOST_RANGE_WORK(
+    n, thrust::detail::host_range_bytes<InputIterator>(n) + thrust::detail::host_range_bytes<OutputIterator>(n), 0);
+
+  invoke_in_arena(exec, [&] {
+    ::tbb::parallel_for(
+      tiles,
+      reduce_tile_body<Size, InputIterator, ValueType, BinaryFunction>{tiling, first, partials, wrapped_binary_op});
+  });
+
+  tiling.prefixes(partials, init..., wrapped_binary_op);
+
+  invoke_in_arena(exec, [&] {
+    ::tbb::parallel_for(
+      tiles,
+      scan_tile_body<IsInclusive, has_init, Size, InputIterator, OutputIterator, ValueType, BinaryFunction>{
+        tiling, first, result, partials, wrapped_binary_op});
+  });
+}
 } // namespace scan_detail
 
-template <typename InputIterator, typename OutputIterator, typename BinaryFunction>
-OutputIterator
-inclusive_scan(tag, InputIterator first, InputIterator last, OutputIterator result, BinaryFunction binary_op)
+// Policies that require determinism scan fixed-size tiles, so that the result does not depend on the number of threads
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename BinaryFunction>
+OutputIterator inclusive_scan(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  BinaryFunction binary_op)
 {
   using namespace thrust::detail;
 
@@ -232,19 +337,39 @@ inclusive_scan(tag, InputIterator first, InputIterator last, OutputIterator resu
 
   if (n != 0)
   {
-    using Body = typename scan_detail::inclusive_body<InputIterator, OutputIterator, BinaryFunction, ValueType, false>;
-    Body scan_body(first, result, binary_op, *first);
-    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), scan_body);
+    if constexpr (thrust::detail::requires_determinism_v<DerivedPolicy>)
+    {
+      scan_detail::deterministic_scan<true, ValueType>(exec, first, n, result, binary_op);
+    }
+    else
+    {
+      _CCCL_HOST_RANGE_WORK(
+        n, thrust::detail::host_range_bytes<InputIterator>(n) + thrust::detail::host_range_bytes<OutputIterator>(n), 0);
+
+      using Body =
+        typename scan_detail::inclusive_body<InputIterator, OutputIterator, BinaryFunction, ValueType, false>;
+      Body scan_body(first, result, binary_op, *first);
+      invoke_in_arena(exec, [&] {
+        ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), scan_body);
+      });
+    }
   }
 
-  ::cuda::std::advance(result, n);
-
-  return result;
+  return result + n;
 }
 
-template <typename InputIterator, typename OutputIterator, typename InitialValueType, typename BinaryFunction>
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename InitialValueType,
+          typename BinaryFunction>
 OutputIterator inclusive_scan(
-  tag, InputIterator first, InputIterator last, OutputIterator result, InitialValueType init, BinaryFunction binary_op)
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  InitialValueType init,
+  BinaryFunction binary_op)
 {
   using namespace thrust::detail;
 
@@ -257,19 +382,38 @@ OutputIterator inclusive_scan(
 
   if (n != 0)
   {
-    using Body = typename scan_detail::inclusive_body<InputIterator, OutputIterator, BinaryFunction, ValueType, true>;
-    Body scan_body(first, result, binary_op, init);
-    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), scan_body);
+    if constexpr (thrust::detail::requires_determinism_v<DerivedPolicy>)
+    {
+      scan_detail::deterministic_scan<true, ValueType>(exec, first, n, result, binary_op, init);
+    }
+    else
+    {
+      _CCCL_HOST_RANGE_WORK(
+        n, thrust::detail::host_range_bytes<InputIterator>(n) + thrust::detail::host_range_bytes<OutputIterator>(n), 0);
+
+      using Body = typename scan_detail::inclusive_body<InputIterator, OutputIterator, BinaryFunction, ValueType, true>;
+      Body scan_body(first, result, binary_op, init);
+      invoke_in_arena(exec, [&] {
+        ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), scan_body);
+      });
+    }
   }
 
-  ::cuda::std::advance(result, n);
-
-  return result;
+  return result + n;
 }
 
-template <typename InputIterator, typename OutputIterator, typename InitialValueType, typename BinaryFunction>
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename InitialValueType,
+          typename BinaryFunction>
 OutputIterator exclusive_scan(
-  tag, InputIterator first, InputIterator last, OutputIterator result, InitialValueType init, BinaryFunction binary_op)
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  InitialValueType init,
+  BinaryFunction binary_op)
 {
   using namespace thrust::detail;
 
@@ -281,14 +425,24 @@ OutputIterator exclusive_scan(
 
   if (n != 0)
   {
-    using Body = typename scan_detail::exclusive_body<InputIterator, OutputIterator, BinaryFunction, ValueType>;
-    Body scan_body(first, result, binary_op, init);
-    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), scan_body);
+    if constexpr (thrust::detail::requires_determinism_v<DerivedPolicy>)
+    {
+      scan_detail::deterministic_scan<false, ValueType>(exec, first, n, result, binary_op, init);
+    }
+    else
+    {
+      _CCCL_HOST_RANGE_WORK(
+        n, thrust::detail::host_range_bytes<InputIterator>(n) + thrust::detail::host_range_bytes<OutputIterator>(n), 0);
+
+      using Body = typename scan_detail::exclusive_body<InputIterator, OutputIterator, BinaryFunction, ValueType>;
+      Body scan_body(first, result, binary_op, init);
+      invoke_in_arena(exec, [&] {
+        ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), scan_body);
+      });
+    }
   }
 
-  ::cuda::std::advance(result, n);
-
-  return result;
+  return result + n;
 }
 } // end namespace system::tbb::detail
 THRUST_NAMESPACE_END
@@ -0,0 +1,162 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file segmented_reduce.h
+ *  \brief TBB implementations of segmented_reduce and segmented_arg_min.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/system/detail/internal/merge_path_segments.h>
+#include <thrust/system/tbb/detail/execute_on_arena.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/cstdint>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::tbb::detail
+{
+namespace segmented_reduce_detail
+{
+using size_type = ::cuda::std::int64_t;
+
+template <typename Plan, typename OutputFunction>
+struct reduce_body
+{
+  const Plan& m_plan;
+  OutputFunction m_output;
+  typename Plan::value_type* m_heads;
+  typename Plan::value_type* m_tails;
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    for (size_type worker = r.begin(); worker != r.end(); ++worker)
+    {
+      m_plan.reduce(worker, m_output, m_heads, m_tails);
+    }
+  }
+};
+
+// reduces every segment of [first, first + n) from init(segment) and hands the reductions to output
+template <typename T,
+          typename DerivedPolicy,
+          typename OffsetIterator,
+          typename InputIterator,
+          typename InitFunction,
+          typename BinaryFunction,
+          typename OutputFunction>
+size_type reduce(execution_policy<DerivedPolicy>& exec,
+                 OffsetIterator offsets_first,
+                 OffsetIterator offsets_last,
+                 InputIterator first,
+                 InitFunction init,
+                 BinaryFunction binary_op,
+                 OutputFunction output)
+{
+  using plan_type = thrust::system::detail::internal::
+    segmented_reduce_plan<OffsetIterator, InputIterator, T, InitFunction, BinaryFunction, size_type>;
+
+  const size_type num_segments = (::cuda::std::max) (size_type{0}, size_type(offsets_last - offsets_first) - 1);
+
+  invoke_in_arena(exec, [&] {
+    const plan_type plan(
+      {offsets_first, num_segments, ::tbb::this_task_arena::max_concurrency()}, first, init, binary_op);
+
+    // the pieces of the segments split among several workers
+    thrust::detail::temporary_array<T, DerivedPolicy> heads(0, exec, plan.num_workers());
+    thrust::detail::temporary_array<T, DerivedPolicy> tails(0, exec, plan.num_workers());
+    T* heads_ptr = thrust::raw_pointer_cast(heads.data());
+    T* tails_ptr = thrust::raw_pointer_cast(tails.data());
+
+    // every share is already large, so hand them out one at a time
+    ::tbb::parallel_for(::tbb::blocked_range<size_type>(0, plan.num_workers(), 1),
+                        reduce_body<plan_type, OutputFunction>{plan, output, heads_ptr, tails_ptr});
+
+    plan.fixup(output, heads_ptr, tails_ptr);
+  });
+
+  return num_segments;
+}
+} // namespace segmented_reduce_detail
+
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+OutputIterator segmented_reduce(
+  execution_policy<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op)
+{
+  using segmented_reduce_detail::size_type;
+
+  const size_type num_segments = segmented_reduce_detail::reduce<T>(
+    exec,
+    offsets_first,
+    offsets_last,
+    first,
+    thrust::system::detail::internal::same_init<T>{init},
+    binary_op,
+    [result](size_type segment, const T& sum) {
+      result[segment] = sum;
+    });
+
+  return result + num_segments;
+}
+
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator segmented_arg_min(
+  execution_policy<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  using segmented_reduce_detail::size_type;
+  namespace internal = thrust::system::detail::internal;
+
+  // reduce the positions of the elements
+  const size_type num_segments = segmented_reduce_detail::reduce<size_type>(
+    exec,
+    offsets_first,
+    offsets_last,
+    thrust::counting_iterator<size_type>(0),
+    internal::segment_begin_init<OffsetIterator, size_type>{offsets_first},
+    internal::first_smallest_position<RandomAccessIterator, StrictWeakOrdering>{first, {comp}},
+    [result, offsets_first](size_type segment, size_type position) {
+      result[segment] = position - size_type(offsets_first[segment]);
+    });
+
+  return result + num_segments;
+}
+} // end namespace system::tbb::detail
+THRUST_NAMESPACE_END
@@ -0,0 +1,152 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file segmented_scan.h
+ *  \brief TBB implementations of segmented_inclusive_scan and segmented_exclusive_scan.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/merge_path_segments.h>
+#include <thrust/system/tbb/detail/execute_on_arena.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/cstdint>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::tbb::detail
+{
+namespace segmented_scan_detail
+{
+using size_type = ::cuda::std::int64_t;
+
+template <typename Plan>
+struct reduce_tail_body
+{
+  const Plan& m_plan;
+  typename Plan::value_type* m_tails;
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    for (size_type worker = r.begin(); worker != r.end(); ++worker)
+    {
+      m_plan.reduce_tail(worker, m_tails);
+    }
+  }
+};
+
+template <typename Plan, typename OutputIterator>
+struct scan_body
+{
+  const Plan& m_plan;
+  OutputIterator m_result;
+  const typename Plan::value_type* m_prefixes;
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    for (size_type worker = r.begin(); worker != r.end(); ++worker)
+    {
+      m_plan.scan(worker, m_result, m_prefixes);
+    }
+  }
+};
+
+template <typename T,
+          typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename BinaryFunction>
+OutputIterator scan(
+  execution_policy<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  bool exclusive,
+  T init,
+  BinaryFunction binary_op)
+{
+  using plan_type = thrust::system::detail::internal::
+    segmented_scan_plan<OffsetIterator, RandomAccessIterator, T, BinaryFunction, size_type>;
+
+  const size_type num_segments = (::cuda::std::max) (size_type{0}, size_type(offsets_last - offsets_first) - 1);
+
+  invoke_in_arena(exec, [&] {
+    const plan_type plan(
+      {offsets_first, num_segments, ::tbb::this_task_arena::max_concurrency()}, first, exclusive, init, binary_op);
+
+    // the reductions of the pieces of the segments split among several workers
+    thrust::detail::temporary_array<T, DerivedPolicy> tails(0, exec, plan.num_workers());
+    T* tails_ptr = thrust::raw_pointer_cast(tails.data());
+
+    // every share is already large, so hand them out one at a time
+    const ::tbb::blocked_range<size_type> workers(0, plan.num_workers(), 1);
+
+    ::tbb::parallel_for(workers, reduce_tail_body<plan_type>{plan, tails_ptr});
+
+    plan.fixup(tails_ptr);
+
+    ::tbb::parallel_for(workers, scan_body<plan_type, OutputIterator>{plan, result, tails_ptr});
+  });
+
+  return num_segments > 0 ? result + offsets_first[num_segments] : result;
+}
+} // namespace segmented_scan_detail
+
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename BinaryFunction>
+OutputIterator segmented_inclusive_scan(
+  execution_policy<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  BinaryFunction binary_op)
+{
+  using ValueType = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  // an inclusive scan has no initial value
+  return segmented_scan_detail::scan(exec, offsets_first, offsets_last, first, result, false, ValueType(), binary_op);
+}
+
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+OutputIterator segmented_exclusive_scan(
+  execution_policy<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op)
+{
+  return segmented_scan_detail::scan(exec, offsets_first, offsets_last, first, result, true, init, binary_op);
+}
+} // end namespace system::tbb::detail
+THRUST_NAMESPACE_END
@@ -0,0 +1,152 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file segmented_sort.h
+ *  \brief TBB implementations of segmented_stable_sort and segmented_stable_sort_by_key.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/seq.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/internal/segment_batches.h>
+#include <thrust/system/detail/sequential/segmented_sort.h>
+#include <thrust/system/tbb/detail/execute_on_arena.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/cstdint>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::tbb::detail
+{
+namespace segmented_sort_detail
+{
+using size_type = ::cuda::std::int64_t;
+
+template <typename OffsetIterator>
+using batches_type = thrust::system::detail::internal::segment_batches<OffsetIterator, size_type>;
+
+template <typename OffsetIterator, typename RandomAccessIterator, typename StrictWeakOrdering>
+struct sort_body
+{
+  const batches_type<OffsetIterator>& m_batches;
+  RandomAccessIterator m_keys_first;
+  StrictWeakOrdering m_comp;
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    thrust::detail::seq_t seq;
+    for (size_type batch = r.begin(); batch != r.end(); ++batch)
+    {
+      m_batches.for_each_segment(batch, [&](size_type begin, size_type end) {
+        thrust::system::detail::sequential::segmented_sort_detail::stable_sort_segment(
+          seq, m_keys_first + begin, m_keys_first + end, m_comp);
+      });
+    }
+  }
+};
+
+template <typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+struct sort_by_key_body
+{
+  const batches_type<OffsetIterator>& m_batches;
+  RandomAccessIterator1 m_keys_first;
+  RandomAccessIterator2 m_values_first;
+  StrictWeakOrdering m_comp;
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    thrust::detail::seq_t seq;
+    for (size_type batch = r.begin(); batch != r.end(); ++batch)
+    {
+      m_batches.for_each_segment(batch, [&](size_type begin, size_type end) {
+        thrust::system::detail::sequential::segmented_sort_detail::stable_sort_segment_by_key(
+          seq, m_keys_first + begin, m_keys_first + end, m_values_first + begin, m_comp);
+      });
+    }
+  }
+};
+
+template <typename OffsetIterator>
+batches_type<OffsetIterator> make_segment_batches(OffsetIterator offsets_first, OffsetIterator offsets_last)
+{
+  const size_type num_segments = (::cuda::std::max) (size_type{0}, size_type(offsets_last - offsets_first) - 1);
+  return {offsets_first, num_segments, ::tbb::this_task_arena::max_concurrency()};
+}
+} // namespace segmented_sort_detail
+
+template <typename DerivedPolicy, typename OffsetIterator, typename RandomAccessIterator, typename StrictWeakOrdering>
+void segmented_stable_sort(
+  execution_policy<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator keys_first,
+  StrictWeakOrdering comp)
+{
+  using segmented_sort_detail::size_type;
+
+  invoke_in_arena(exec, [&] {
+    const auto batches = segmented_sort_detail::make_segment_batches(offsets_first, offsets_last);
+
+    // a batch per task, which the workers that drew the smaller segments steal
+    ::tbb::parallel_for(
+      ::tbb::blocked_range<size_type>(0, batches.num_batches(), 1),
+      segmented_sort_detail::sort_body<OffsetIterator, RandomAccessIterator, StrictWeakOrdering>{
+        batches, keys_first, comp});
+
+    batches.for_each_large_segment([&](size_type begin, size_type end) {
+      thrust::stable_sort(exec, keys_first + begin, keys_first + end, comp);
+    });
+  });
+}
+
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void segmented_stable_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp)
+{
+  using segmented_sort_detail::size_type;
+
+  invoke_in_arena(exec, [&] {
+    const auto batches = segmented_sort_detail::make_segment_batches(offsets_first, offsets_last);
+
+    // a batch per task, which the workers that drew the smaller segments steal
+    ::tbb::parallel_for(
+      ::tbb::blocked_range<size_type>(0, batches.num_batches(), 1),
+      segmented_sort_detail::
+        sort_by_key_body<OffsetIterator, RandomAccessIterator1, RandomAccessIterator2, StrictWeakOrdering>{
+          batches, keys_first, values_first, comp});
+
+    batches.for_each_large_segment([&](size_type begin, size_type end) {
+      thrust::stable_sort_by_key(exec, keys_first + begin, keys_first + end, values_first + begin, comp);
+    });
+  });
+}
+} // end namespace system::tbb::detail
+THRUST_NAMESPACE_END
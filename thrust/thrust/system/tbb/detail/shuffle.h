@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file shuffle.h
+ *  \brief TBB implementation of shuffle and shuffle_copy.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/bucket_shuffle.h>
+#include <thrust/system/tbb/detail/execute_on_arena.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+
+#include <cuda/std/__iterator/distance.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::tbb::detail
+{
+namespace shuffle_detail
+{
+using thrust::system::detail::internal::bucket_shuffle;
+using size_type = bucket_shuffle::size_type;
+
+struct count_body
+{
+  const bucket_shuffle& m_plan;
+  size_type* m_offsets;
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    for (size_type b = r.begin(); b != r.end(); ++b)
+    {
+      m_plan.count_block(b, m_offsets + b * m_plan.num_buckets());
+    }
+  }
+};
+
+template <typename RandomIterator, typename T>
+struct scatter_body
+{
+  const bucket_shuffle& m_plan;
+  RandomIterator m_first;
+  T* m_temp;
+  size_type* m_offsets;
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    for (size_type b = r.begin(); b != r.end(); ++b)
+    {
+      m_plan.scatter_block(b, m_first, m_temp, m_offsets + b * m_plan.num_buckets());
+    }
+  }
+};
+
+template <typename T, typename OutputIterator>
+struct shuffle_body
+{
+  const bucket_shuffle& m_plan;
+  T* m_temp;
+  OutputIterator m_result;
+  const size_type* m_bucket_begin;
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    for (size_type j = r.begin(); j != r.end(); ++j)
+    {
+      m_plan.shuffle_bucket(j, m_temp, m_result, m_bucket_begin);
+    }
+  }
+};
+} // namespace shuffle_detail
+
+template <typename DerivedPolicy, typename RandomIterator, typename OutputIterator, typename URBG>
+void shuffle_copy(
+  execution_policy<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, OutputIterator result, URBG&& g)
+{
+  using value_type = thrust::detail::it_value_t<RandomIterator>;
+  using shuffle_detail::size_type;
+
+  const shuffle_detail::bucket_shuffle plan(static_cast<size_type>(::cuda::std::distance(first, last)), g);
+  if (plan.size() == 0)
+  {
+    return;
+  }
+
+  thrust::detail::temporary_array<size_type, DerivedPolicy> offsets(0, exec, plan.num_blocks() * plan.num_buckets());
+  thrust::detail::temporary_array<size_type, DerivedPolicy> bucket_begin(0, exec, plan.num_buckets() + 1);
+  thrust::detail::temporary_array<value_type, DerivedPolicy> temp(exec, plan.size());
+
+  size_type* offsets_ptr      = thrust::raw_pointer_cast(offsets.data());
+  size_type* bucket_begin_ptr = thrust::raw_pointer_cast(bucket_begin.data());
+  value_type* temp_ptr        = thrust::raw_pointer_cast(temp.data());
+
+  // blocks and buckets are already coarse, so hand them out one at a time
+  const ::tbb::blocked_range<size_type> blocks(0, plan.num_blocks(), 1);
+  const ::tbb::blocked_range<size_type> buckets(0, plan.num_buckets(), 1);
+
+  invoke_in_arena(exec, [&] {
+    ::tbb::parallel_for(blocks, shuffle_detail::count_body{plan, offsets_ptr});
+
+    plan.compute_offsets(offsets_ptr, bucket_begin_ptr);
+
+    ::tbb::parallel_for(
+      blocks, shuffle_detail::scatter_body<RandomIterator, value_type>{plan, first, temp_ptr, offsets_ptr});
+
+    ::tbb::parallel_for(
+      buckets, shuffle_detail::shuffle_body<value_type, OutputIterator>{plan, temp_ptr, result, bucket_begin_ptr});
+  });
+}
+
+template <typename DerivedPolicy, typename RandomIterator, typename URBG>
+void shuffle(execution_policy<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, URBG&& g)
+{
+  // the input is fully consumed before any output is written
+  tbb::detail::shuffle_copy(exec, first, last, first, g);
+}
+} // end namespace system::tbb::detail
+THRUST_NAMESPACE_END
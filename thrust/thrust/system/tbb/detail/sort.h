@@ -12,15 +12,19 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/autotune.h>
 #include <thrust/detail/copy.h>
+#include <thrust/detail/nvtx_policy.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
 #include <thrust/sort.h>
+#include <thrust/system/tbb/detail/execute_on_arena.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
 #include <cuda/std/__iterator/distance.h>
+#include <cuda/std/cstddef>
 
 #include <tbb/parallel_invoke.h>
 
@@ -29,8 +33,9 @@ namespace system::tbb::detail
 {
 namespace sort_detail
 {
-// TODO tune this based on data type and comp
-const static int threshold = 128 * 1024;
+// Below this size, a merge sort sorts sequentially. It can be tuned per machine and key size with
+// thrust::autotune::knobs::tbb_sort_threshold.
+inline constexpr ::cuda::std::ptrdiff_t default_threshold = 128 * 1024;
 
 template <typename DerivedPolicy, typename Iterator1, typename Iterator2, typename StrictWeakOrdering>
 void merge_sort(execution_policy<DerivedPolicy>& exec,
@@ -38,7 +43,8 @@ void merge_sort(execution_policy<DerivedPolicy>& exec,
                 Iterator1 last1,
                 Iterator2 first2,
                 StrictWeakOrdering comp,
-                bool inplace);
+                bool inplace,
+                ::cuda::std::ptrdiff_t threshold);
 
 template <typename DerivedPolicy, typename Iterator1, typename Iterator2, typename StrictWeakOrdering>
 struct merge_sort_closure
@@ -48,6 +54,7 @@ struct merge_sort_closure
   Iterator2 first2;
   StrictWeakOrdering comp;
   bool inplace;
+  ::cuda::std::ptrdiff_t threshold;
 
   merge_sort_closure(
     execution_policy<DerivedPolicy>& exec,
@@ -55,18 +62,20 @@ struct merge_sort_closure
     Iterator1 last1,
     Iterator2 first2,
     StrictWeakOrdering comp,
-    bool inplace)
+    bool inplace,
+    ::cuda::std::ptrdiff_t threshold)
       : exec(exec)
       , first1(first1)
       , last1(last1)
       , first2(first2)
       , comp(comp)
       , inplace(inplace)
+      , threshold(threshold)
   {}
 
   void operator()() const
   {
-    merge_sort(exec, first1, last1, first2, comp, inplace);
+    merge_sort(exec, first1, last1, first2, comp, inplace, threshold);
   }
 };
 
@@ -76,13 +85,15 @@ void merge_sort(execution_policy<DerivedPolicy>& exec,
                 Iterator1 last1,
                 Iterator2 first2,
                 StrictWeakOrdering comp,
-                bool inplace)
+                bool inplace,
+                ::cuda::std::ptrdiff_t threshold)
 {
   using difference_type = thrust::detail::it_difference_t<Iterator1>;
 
   difference_type n = ::cuda::std::distance(first1, last1);
 
-  if (n < threshold)
+  // a range of one element cannot be split, whatever the threshold
+  if (n < threshold || n < 2)
   {
     thrust::stable_sort(thrust::seq, first1, last1, comp);
 
@@ -100,8 +111,8 @@ void merge_sort(execution_policy<DerivedPolicy>& exec,
 
   using Closure = merge_sort_closure<DerivedPolicy, Iterator1, Iterator2, StrictWeakOrdering>;
 
-  Closure left(exec, first1, mid1, first2, comp, !inplace);
-  Closure right(exec, mid1, last1, mid2, comp, !inplace);
+  Closure left(exec, first1, mid1, first2, comp, !inplace, threshold);
+  Closure right(exec, mid1, last1, mid2, comp, !inplace, threshold);
 
   ::tbb::parallel_invoke(left, right);
 
@@ -118,8 +129,9 @@ void merge_sort(execution_policy<DerivedPolicy>& exec,
 
 namespace sort_by_key_detail
 {
-// TODO tune this based on data type and comp
-const static int threshold = 128 * 1024;
+// Below this size, a merge sort sorts sequentially. It can be tuned per machine and key and value size with
+// thrust::autotune::knobs::tbb_sort_by_key_threshold.
+inline constexpr ::cuda::std::ptrdiff_t default_threshold = 128 * 1024;
 
 template <typename DerivedPolicy,
           typename Iterator1,
@@ -135,7 +147,8 @@ void merge_sort_by_key(
   Iterator3 first3,
   Iterator4 first4,
   StrictWeakOrdering comp,
-  bool inplace);
+  bool inplace,
+  ::cuda::std::ptrdiff_t threshold);
 
 template <typename DerivedPolicy,
           typename Iterator1,
@@ -152,6 +165,7 @@ struct merge_sort_by_key_closure
   Iterator4 first4;
   StrictWeakOrdering comp;
   bool inplace;
+  ::cuda::std::ptrdiff_t threshold;
 
   merge_sort_by_key_closure(
     execution_policy<DerivedPolicy>& exec,
@@ -161,7 +175,8 @@ struct merge_sort_by_key_closure
     Iterator3 first3,
     Iterator4 first4,
     StrictWeakOrdering comp,
-    bool inplace)
+    bool inplace,
+    ::cuda::std::ptrdiff_t threshold)
       : exec(exec)
       , first1(first1)
       , last1(last1)
@@ -170,11 +185,12 @@ struct merge_sort_by_key_closure
       , first4(first4)
       , comp(comp)
       , inplace(inplace)
+      , threshold(threshold)
   {}
 
   void operator()() const
   {
-    merge_sort_by_key(exec, first1, last1, first2, first3, first4, comp, inplace);
+    merge_sort_by_key(exec, first1, last1, first2, first3, first4, comp, inplace, threshold);
   }
 };
 
@@ -192,7 +208,8 @@ void merge_sort_by_key(
   Iterator3 first3,
   Iterator4 first4,
   StrictWeakOrdering comp,
-  bool inplace)
+  bool inplace,
+  ::cuda::std::ptrdiff_t threshold)
 {
   using difference_type = thrust::detail::it_difference_t<Iterator1>;
 
@@ -205,7 +222,8 @@ void merge_sort_by_key(
   Iterator2 last2 = first2 + n;
   Iterator3 last3 = first3 + n;
 
-  if (n < threshold)
+  // a range of one element cannot be split, whatever the threshold
+  if (n < threshold || n < 2)
   {
     thrust::stable_sort_by_key(thrust::seq, first1, last1, first2, comp);
 
@@ -221,8 +239,8 @@ void merge_sort_by_key(
   using Closure =
     merge_sort_by_key_closure<DerivedPolicy, Iterator1, Iterator2, Iterator3, Iterator4, StrictWeakOrdering>;
 
-  Closure left(exec, first1, mid1, first2, first3, first4, comp, !inplace);
-  Closure right(exec, mid1, last1, mid2, mid3, mid4, comp, !inplace);
+  Closure left(exec, first1, mid1, first2, first3, first4, comp, !inplace, threshold);
+  Closure right(exec, mid1, last1, mid2, mid3, mid4, comp, !inplace, threshold);
 
   ::tbb::parallel_invoke(left, right);
 
@@ -243,9 +261,17 @@ void stable_sort(
 {
   using key_type = thrust::detail::it_value_t<RandomAccessIterator>;
 
+  _CCCL_HOST_RANGE_WORK(
+    last - first, 2 * thrust::detail::host_range_bytes<RandomAccessIterator>(last - first), 0);
+
   thrust::detail::temporary_array<key_type, DerivedPolicy> temp(exec, first, last);
 
-  sort_detail::merge_sort(exec, first, last, temp.begin(), comp, true);
+  const auto threshold = thrust::detail::tuned_value(
+    thrust::detail::autotune_knob::tbb_sort_threshold, sizeof(key_type), sort_detail::default_threshold);
+
+  invoke_in_arena(exec, [&] {
+    sort_detail::merge_sort(exec, first, last, temp.begin(), comp, true, threshold);
+  });
 }
 
 template <typename DerivedPolicy,
@@ -264,10 +290,23 @@ void stable_sort_by_key(
 
   RandomAccessIterator2 last2 = first2 + ::cuda::std::distance(first1, last1);
 
+  _CCCL_HOST_RANGE_WORK(last1 - first1,
+                        2 * (thrust::detail::host_range_bytes<RandomAccessIterator1>(last1 - first1)
+                             + thrust::detail::host_range_bytes<RandomAccessIterator2>(last1 - first1)),
+                        0);
+
   thrust::detail::temporary_array<key_type, DerivedPolicy> temp1(exec, first1, last1);
   thrust::detail::temporary_array<val_type, DerivedPolicy> temp2(exec, first2, last2);
 
-  sort_by_key_detail::merge_sort_by_key(exec, first1, last1, first2, temp1.begin(), temp2.begin(), comp, true);
+  const auto threshold = thrust::detail::tuned_value(
+    thrust::detail::autotune_knob::tbb_sort_by_key_threshold,
+    sizeof(key_type) + sizeof(val_type),
+    sort_by_key_detail::default_threshold);
+
+  invoke_in_arena(exec, [&] {
+    sort_by_key_detail::merge_sort_by_key(
+      exec, first1, last1, first2, temp1.begin(), temp2.begin(), comp, true, threshold);
+  });
 }
 } // end namespace system::tbb::detail
 THRUST_NAMESPACE_END
@@ -0,0 +1,248 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file topk.h
+ *  \brief TBB implementations of topk_by_key and segmented_topk_by_key.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/execute_with_env.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/system/detail/internal/bounded_heap.h>
+#include <thrust/system/tbb/detail/execute_on_arena.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__utility/pair.h>
+#include <cuda/std/cstdint>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::tbb::detail
+{
+namespace topk_detail
+{
+using size_type = ::cuda::std::int64_t;
+
+template <typename Plan>
+struct select_body
+{
+  const Plan& m_plan;
+  size_type* m_candidates;
+  size_type* m_counts;
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    for (size_type chunk = r.begin(); chunk != r.end(); ++chunk)
+    {
+      m_plan.select(chunk, m_candidates, m_counts);
+    }
+  }
+};
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2>
+struct write_body
+{
+  RandomAccessIterator1 m_keys_first;
+  RandomAccessIterator2 m_values_first;
+  OutputIterator1 m_keys_result;
+  OutputIterator2 m_values_result;
+  const size_type* m_selected;
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    for (size_type i = r.begin(); i != r.end(); ++i)
+    {
+      m_keys_result[i]   = m_keys_first[m_selected[i]];
+      m_values_result[i] = m_values_first[m_selected[i]];
+    }
+  }
+};
+
+template <typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+struct segment_body
+{
+  OffsetIterator m_offsets_first;
+  RandomAccessIterator1 m_keys_first;
+  RandomAccessIterator2 m_values_first;
+  OutputIterator1 m_keys_result;
+  OutputIterator2 m_values_result;
+  size_type m_k;
+  StrictWeakOrdering m_comp;
+  size_type* m_heaps;
+  bool m_sorted;
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    // the body does not wait for other tasks, so no other segment can use the heap of this thread meanwhile
+    size_type* heap = m_heaps + ::tbb::this_task_arena::current_thread_index() * m_k;
+
+    for (size_type segment = r.begin(); segment != r.end(); ++segment)
+    {
+      const size_type begin = m_offsets_first[segment];
+      const size_type end   = m_offsets_first[segment + 1];
+      thrust::system::detail::internal::select_topk(
+        m_keys_first + begin,
+        end - begin,
+        m_values_first + begin,
+        m_keys_result + segment * m_k,
+        m_values_result + segment * m_k,
+        m_k,
+        m_comp,
+        heap,
+        m_sorted);
+    }
+  }
+};
+} // namespace topk_detail
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size,
+          typename StrictWeakOrdering>
+::cuda::std::pair<OutputIterator1, OutputIterator2> topk_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k,
+  StrictWeakOrdering comp)
+{
+  using topk_detail::size_type;
+  using plan_type =
+    thrust::system::detail::internal::chunked_topk<RandomAccessIterator1, StrictWeakOrdering, size_type>;
+
+  // a negative k selects nothing, like k == 0
+  const size_type max_count = (::cuda::std::max) (size_type{0}, static_cast<size_type>(k));
+
+  size_type m = 0;
+  invoke_in_arena(exec, [&] {
+    const plan_type plan(keys_first,
+                         static_cast<size_type>(keys_last - keys_first),
+                         max_count,
+                         comp,
+                         ::tbb::this_task_arena::max_concurrency());
+
+    thrust::detail::temporary_array<size_type, DerivedPolicy> candidates(0, exec, plan.num_chunks() * plan.k());
+    thrust::detail::temporary_array<size_type, DerivedPolicy> counts(0, exec, plan.num_chunks());
+    thrust::detail::temporary_array<size_type, DerivedPolicy> selected(0, exec, plan.k());
+    size_type* candidates_ptr = thrust::raw_pointer_cast(candidates.data());
+    size_type* counts_ptr     = thrust::raw_pointer_cast(counts.data());
+    size_type* selected_ptr   = thrust::raw_pointer_cast(selected.data());
+
+    // every chunk is already large, so hand them out one at a time
+    ::tbb::parallel_for(::tbb::blocked_range<size_type>(0, plan.num_chunks(), 1),
+                        topk_detail::select_body<plan_type>{plan, candidates_ptr, counts_ptr});
+
+    m = plan.merge(candidates_ptr, counts_ptr, selected_ptr, thrust::detail::requires_sorted_output_v<DerivedPolicy>);
+
+    ::tbb::parallel_for(
+      ::tbb::blocked_range<size_type>(0, m),
+      topk_detail::write_body<RandomAccessIterator1, RandomAccessIterator2, OutputIterator1, OutputIterator2>{
+        keys_first, values_first, keys_result, values_result, selected_ptr});
+  });
+
+  return {keys_result + m, values_result + m};
+}
+
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size,
+          typename StrictWeakOrdering>
+::cuda::std::pair<OutputIterator1, OutputIterator2> segmented_topk_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k,
+  StrictWeakOrdering comp)
+{
+  using topk_detail::size_type;
+
+  const size_type num_segments = (::cuda::std::max) (size_type{0}, size_type(offsets_last - offsets_first) - 1);
+  const size_type stride       = (::cuda::std::max) (size_type{0}, static_cast<size_type>(k));
+
+  invoke_in_arena(exec, [&] {
+    const size_type num_threads = ::tbb::this_task_arena::max_concurrency();
+
+    if (num_segments < num_threads)
+    {
+      // too few segments to keep every thread busy, select within every segment in parallel instead
+      for (size_type segment = 0; segment < num_segments; ++segment)
+      {
+        const size_type begin = offsets_first[segment];
+        const size_type end   = offsets_first[segment + 1];
+        tbb::detail::topk_by_key(
+          exec,
+          keys_first + begin,
+          keys_first + end,
+          values_first + begin,
+          keys_result + segment * stride,
+          values_result + segment * stride,
+          stride,
+          comp);
+      }
+    }
+    else
+    {
+      // one heap per thread
+      thrust::detail::temporary_array<size_type, DerivedPolicy> heaps(0, exec, num_threads * stride);
+
+      ::tbb::parallel_for(
+        ::tbb::blocked_range<size_type>(0, num_segments),
+        topk_detail::segment_body<OffsetIterator,
+                                  RandomAccessIterator1,
+                                  RandomAccessIterator2,
+                                  OutputIterator1,
+                                  OutputIterator2,
+                                  StrictWeakOrdering>{
+          offsets_first,
+          keys_first,
+          values_first,
+          keys_result,
+          values_result,
+          stride,
+          comp,
+          thrust::raw_pointer_cast(heaps.data()),
+          thrust::detail::requires_sorted_output_v<DerivedPolicy>});
+    }
+  });
+
+  return {keys_result + num_segments * stride, values_result + num_segments * stride};
+}
+} // end namespace system::tbb::detail
+THRUST_NAMESPACE_END
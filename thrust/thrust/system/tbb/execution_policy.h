@@ -17,10 +17,12 @@
 
 // get the execution policies definitions first
 #include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/execute_on_arena.h>
 
 // now get all the algorithm definitions
 #include <thrust/system/tbb/detail/adjacent_difference.h>
 #include <thrust/system/tbb/detail/assign_value.h>
+#include <thrust/system/tbb/detail/batched_copy.h>
 #include <thrust/system/tbb/detail/binary_search.h>
 #include <thrust/system/tbb/detail/copy.h>
 #include <thrust/system/tbb/detail/copy_if.h>
@@ -33,6 +35,7 @@
 #include <thrust/system/tbb/detail/gather.h>
 #include <thrust/system/tbb/detail/generate.h>
 #include <thrust/system/tbb/detail/get_value.h>
+#include <thrust/system/tbb/detail/histogram.h>
 #include <thrust/system/tbb/detail/inner_product.h>
 #include <thrust/system/tbb/detail/iter_swap.h>
 #include <thrust/system/tbb/detail/logical.h>
@@ -40,19 +43,26 @@
 #include <thrust/system/tbb/detail/merge.h>
 #include <thrust/system/tbb/detail/mismatch.h>
 #include <thrust/system/tbb/detail/partition.h>
+#include <thrust/system/tbb/detail/pipeline.h>
 #include <thrust/system/tbb/detail/reduce.h>
 #include <thrust/system/tbb/detail/reduce_by_key.h>
 #include <thrust/system/tbb/detail/remove.h>
 #include <thrust/system/tbb/detail/replace.h>
 #include <thrust/system/tbb/detail/reverse.h>
+#include <thrust/system/tbb/detail/run_length_encode.h>
 #include <thrust/system/tbb/detail/scan.h>
 #include <thrust/system/tbb/detail/scan_by_key.h>
 #include <thrust/system/tbb/detail/scatter.h>
+#include <thrust/system/tbb/detail/segmented_reduce.h>
+#include <thrust/system/tbb/detail/segmented_scan.h>
+#include <thrust/system/tbb/detail/segmented_sort.h>
 #include <thrust/system/tbb/detail/sequence.h>
 #include <thrust/system/tbb/detail/set_operations.h>
+#include <thrust/system/tbb/detail/shuffle.h>
 #include <thrust/system/tbb/detail/sort.h>
 #include <thrust/system/tbb/detail/swap_ranges.h>
 #include <thrust/system/tbb/detail/tabulate.h>
+#include <thrust/system/tbb/detail/topk.h>
 #include <thrust/system/tbb/detail/transform.h>
 #include <thrust/system/tbb/detail/transform_reduce.h>
 #include <thrust/system/tbb/detail/transform_scan.h>
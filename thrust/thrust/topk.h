@@ -0,0 +1,933 @@
+// SPDX-FileCopyrightText: Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file topk.h
+ *  \brief Selects the k first elements of a range, or of every segment of a range, in sorted order
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+
+#include <cuda/std/__utility/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup sorting
+ *  \ingroup algorithms
+ *  \{
+ */
+
+/*! \p topk copies the <tt>min(k, last - first)</tt> largest elements of <tt>[first, last)</tt> to \p result, like
+ *  \p cub::DeviceTopK::MaxKeys. It produces the same output as a \p stable_sort of <tt>[first, last)</tt> into
+ *  descending order followed by a copy of its first \p k elements, but needs neither the sort nor a copy of the input:
+ *  the host systems keep the best \p k elements found by every thread in a heap, and merge the heaps.
+ *
+ *  The elements are written in descending order and equivalent elements in the order of the input, which is what
+ *  <tt>cuda::execution::output_ordering::stable_sorted</tt> requires. When the execution policy carries the requirement
+ *  <tt>cuda::execution::output_ordering::unsorted</tt>, e.g. <tt>thrust::omp::par.with(cuda::execution::require(
+ *  cuda::execution::output_ordering::unsorted))</tt>, the same elements may be written in any order, which saves
+ *  sorting them.
+ *
+ *  This version of \p topk compares objects using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input range.
+ *  \param last The end of the input range.
+ *  \param result The beginning of the output range.
+ *  \param k The number of elements to select.
+ *  \return The end of the output range, <tt>result + min(k, last - first)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">
+ *          LessThan Comparable</a>.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p RandomAccessIterator's \c value_type is convertible to its
+ *          \c value_type.
+ *  \tparam Size is an integral type.
+ *
+ *  \pre The output range shall not overlap the input range.
+ *
+ *  The following code snippet demonstrates how to use \p topk using the \p thrust::host execution policy for
+ *  parallelization:
+ *
+ *  \code
+ *  #include <thrust/topk.h>
+ *  #include <thrust/execution_policy.h>
+ *  int A[] = {1, 9, 4, 7, 2, 9, 3};
+ *  int B[3];
+ *  int* end = thrust::topk(thrust::host, A, A + 7, B, 3);
+ *  // end - B == 3
+ *  // B is now {9, 9, 7}
+ *  \endcode
+ *
+ *  \see topk_by_key
+ *  \see segmented_topk
+ *  \see stable_sort
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator, typename Size>
+_CCCL_HOST_DEVICE OutputIterator
+topk(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+     RandomAccessIterator first,
+     RandomAccessIterator last,
+     OutputIterator result,
+     Size k);
+
+/*! \p topk copies the <tt>min(k, last - first)</tt> first elements of <tt>[first, last)</tt> in the order \p comp to
+ *  \p result: the same output as a \p stable_sort of <tt>[first, last)</tt> with \p comp followed by a copy of its
+ *  first \p k elements. With <tt>cuda::std::greater<>{}</tt>, which is the default, these are the largest elements;
+ *  with <tt>cuda::std::less<>{}</tt>, the smallest ones.
+ *
+ *  The elements are written in the order \p comp, unless the execution policy carries the requirement
+ *  <tt>cuda::execution::output_ordering::unsorted</tt>.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input range.
+ *  \param last The end of the input range.
+ *  \param result The beginning of the output range.
+ *  \param k The number of elements to select.
+ *  \param comp The comparison operator, which returns \c true if its first argument comes before its second argument.
+ *  \return The end of the output range, <tt>result + min(k, last - first)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is convertible to \p StrictWeakOrdering's arguments.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p RandomAccessIterator's \c value_type is convertible to its
+ *          \c value_type.
+ *  \tparam Size is an integral type.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">
+ *          Strict Weak Ordering</a>.
+ *
+ *  \pre The output range shall not overlap the input range.
+ *
+ *  The following code snippet demonstrates how to use \p topk to select the smallest elements of a range:
+ *
+ *  \code
+ *  #include <thrust/topk.h>
+ *  #include <thrust/execution_policy.h>
+ *  #include <cuda/std/functional>
+ *  int A[] = {1, 9, 4, 7, 2, 9, 3};
+ *  int B[3];
+ *  thrust::topk(thrust::host, A, A + 7, B, 3, cuda::std::less<>{});
+ *  // B is now {1, 2, 3}
+ *  \endcode
+ *
+ *  \see topk_by_key
+ *  \see segmented_topk
+ *  \see stable_sort
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename Size,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator
+topk(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+     RandomAccessIterator first,
+     RandomAccessIterator last,
+     OutputIterator result,
+     Size k,
+     StrictWeakOrdering comp);
+
+/*! \p topk copies the <tt>min(k, last - first)</tt> largest elements of <tt>[first, last)</tt> to \p result, in
+ *  descending order and equivalent elements in the order of the input.
+ *
+ *  This version of \p topk compares objects using \c operator<.
+ *
+ *  \param first The beginning of the input range.
+ *  \param last The end of the input range.
+ *  \param result The beginning of the output range.
+ *  \param k The number of elements to select.
+ *  \return The end of the output range, <tt>result + min(k, last - first)</tt>.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">
+ *          LessThan Comparable</a>.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p RandomAccessIterator's \c value_type is convertible to its
+ *          \c value_type.
+ *  \tparam Size is an integral type.
+ *
+ *  \pre The output range shall not overlap the input range.
+ *
+ *  \see topk_by_key
+ *  \see segmented_topk
+ *  \see stable_sort
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename RandomAccessIterator, typename OutputIterator, typename Size>
+OutputIterator topk(RandomAccessIterator first, RandomAccessIterator last, OutputIterator result, Size k);
+
+/*! \p topk copies the <tt>min(k, last - first)</tt> first elements of <tt>[first, last)</tt> in the order \p comp to
+ *  \p result, in the order \p comp and equivalent elements in the order of the input.
+ *
+ *  \param first The beginning of the input range.
+ *  \param last The end of the input range.
+ *  \param result The beginning of the output range.
+ *  \param k The number of elements to select.
+ *  \param comp The comparison operator, which returns \c true if its first argument comes before its second argument.
+ *  \return The end of the output range, <tt>result + min(k, last - first)</tt>.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is convertible to \p StrictWeakOrdering's arguments.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p RandomAccessIterator's \c value_type is convertible to its
+ *          \c value_type.
+ *  \tparam Size is an integral type.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">
+ *          Strict Weak Ordering</a>.
+ *
+ *  \pre The output range shall not overlap the input range.
+ *
+ *  \see topk_by_key
+ *  \see segmented_topk
+ *  \see stable_sort
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename RandomAccessIterator, typename OutputIterator, typename Size, typename StrictWeakOrdering>
+OutputIterator
+topk(RandomAccessIterator first, RandomAccessIterator last, OutputIterator result, Size k, StrictWeakOrdering comp);
+
+/*! \p topk_by_key copies the <tt>min(k, keys_last - keys_first)</tt> largest keys of <tt>[keys_first, keys_last)</tt>
+ *  to \p keys_result and their values, the elements of <tt>[values_first, values_first + (keys_last - keys_first))</tt>
+ *  at the same positions, to \p values_result, like \p cub::DeviceTopK::MaxPairs. It produces the same output as a
+ *  \p stable_sort_by_key into descending order followed by a copy of the first \p k keys and values.
+ *
+ *  The keys are written in descending order and equivalent keys in the order of the input, unless the execution policy
+ *  carries the requirement <tt>cuda::execution::output_ordering::unsorted</tt>.
+ *
+ *  This version of \p topk_by_key compares keys using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the input key range.
+ *  \param keys_last The end of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_result The beginning of the output key range.
+ *  \param values_result The beginning of the output value range.
+ *  \param k The number of elements to select.
+ *  \return A pair of iterators at the end of the output ranges, <tt>keys_result + min(k, keys_last - keys_first)</tt>
+ *          and <tt>values_result + min(k, keys_last - keys_first)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">
+ *          LessThan Comparable</a>.
+ *  \tparam RandomAccessIterator2 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p RandomAccessIterator1's \c value_type is convertible to its
+ *          \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p RandomAccessIterator2's \c value_type is convertible to its
+ *          \c value_type.
+ *  \tparam Size is an integral type.
+ *
+ *  \pre The output ranges shall not overlap the input ranges.
+ *
+ *  The following code snippet demonstrates how to use \p topk_by_key using the \p thrust::host execution policy for
+ *  parallelization:
+ *
+ *  \code
+ *  #include <thrust/topk.h>
+ *  #include <thrust/execution_policy.h>
+ *  float scores[] = {0.5f, 0.9f, 0.1f, 0.7f, 0.9f};
+ *  int ids[]      = {10, 11, 12, 13, 14};
+ *  float top_scores[2];
+ *  int top_ids[2];
+ *  thrust::topk_by_key(thrust::host, scores, scores + 5, ids, top_scores, top_ids, 2);
+ *  // top_scores is now {0.9f, 0.9f}
+ *  // top_ids is now {11, 14}
+ *  \endcode
+ *
+ *  \see topk
+ *  \see segmented_topk_by_key
+ *  \see stable_sort_by_key
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> topk_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k);
+
+/*! \p topk_by_key copies the <tt>min(k, keys_last - keys_first)</tt> first keys of <tt>[keys_first, keys_last)</tt> in
+ *  the order \p comp to \p keys_result and their values to \p values_result.
+ *
+ *  The keys are written in the order \p comp and equivalent keys in the order of the input, unless the execution policy
+ *  carries the requirement <tt>cuda::execution::output_ordering::unsorted</tt>.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the input key range.
+ *  \param keys_last The end of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_result The beginning of the output key range.
+ *  \param values_result The beginning of the output value range.
+ *  \param k The number of elements to select.
+ *  \param comp The comparison operator, which returns \c true if its first argument comes before its second argument.
+ *  \return A pair of iterators at the end of the output ranges, <tt>keys_result + min(k, keys_last - keys_first)</tt>
+ *          and <tt>values_result + min(k, keys_last - keys_first)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is convertible to \p StrictWeakOrdering's arguments.
+ *  \tparam RandomAccessIterator2 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p RandomAccessIterator1's \c value_type is convertible to its
+ *          \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p RandomAccessIterator2's \c value_type is convertible to its
+ *          \c value_type.
+ *  \tparam Size is an integral type.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">
+ *          Strict Weak Ordering</a>.
+ *
+ *  \pre The output ranges shall not overlap the input ranges.
+ *
+ *  \see topk
+ *  \see segmented_topk_by_key
+ *  \see stable_sort_by_key
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> topk_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k,
+  StrictWeakOrdering comp);
+
+/*! \p topk_by_key copies the <tt>min(k, keys_last - keys_first)</tt> largest keys of <tt>[keys_first, keys_last)</tt>
+ *  to \p keys_result and their values to \p values_result, in descending order of keys and equivalent keys in the
+ *  order of the input.
+ *
+ *  This version of \p topk_by_key compares keys using \c operator<.
+ *
+ *  \param keys_first The beginning of the input key range.
+ *  \param keys_last The end of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_result The beginning of the output key range.
+ *  \param values_result The beginning of the output value range.
+ *  \param k The number of elements to select.
+ *  \return A pair of iterators at the end of the output ranges, <tt>keys_result + min(k, keys_last - keys_first)</tt>
+ *          and <tt>values_result + min(k, keys_last - keys_first)</tt>.
+ *
+ *  \tparam RandomAccessIterator1 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">
+ *          LessThan Comparable</a>.
+ *  \tparam RandomAccessIterator2 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p RandomAccessIterator1's \c value_type is convertible to its
+ *          \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p RandomAccessIterator2's \c value_type is convertible to its
+ *          \c value_type.
+ *  \tparam Size is an integral type.
+ *
+ *  \pre The output ranges shall not overlap the input ranges.
+ *
+ *  \see topk
+ *  \see segmented_topk_by_key
+ *  \see stable_sort_by_key
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size>
+::cuda::std::pair<OutputIterator1, OutputIterator2> topk_by_key(
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k);
+
+/*! \p topk_by_key copies the <tt>min(k, keys_last - keys_first)</tt> first keys of <tt>[keys_first, keys_last)</tt> in
+ *  the order \p comp to \p keys_result and their values to \p values_result, in the order \p comp and equivalent keys
+ *  in the order of the input.
+ *
+ *  \param keys_first The beginning of the input key range.
+ *  \param keys_last The end of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_result The beginning of the output key range.
+ *  \param values_result The beginning of the output value range.
+ *  \param k The number of elements to select.
+ *  \param comp The comparison operator, which returns \c true if its first argument comes before its second argument.
+ *  \return A pair of iterators at the end of the output ranges, <tt>keys_result + min(k, keys_last - keys_first)</tt>
+ *          and <tt>values_result + min(k, keys_last - keys_first)</tt>.
+ *
+ *  \tparam RandomAccessIterator1 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is convertible to \p StrictWeakOrdering's arguments.
+ *  \tparam RandomAccessIterator2 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p RandomAccessIterator1's \c value_type is convertible to its
+ *          \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p RandomAccessIterator2's \c value_type is convertible to its
+ *          \c value_type.
+ *  \tparam Size is an integral type.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">
+ *          Strict Weak Ordering</a>.
+ *
+ *  \pre The output ranges shall not overlap the input ranges.
+ *
+ *  \see topk
+ *  \see segmented_topk_by_key
+ *  \see stable_sort_by_key
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size,
+          typename StrictWeakOrdering>
+::cuda::std::pair<OutputIterator1, OutputIterator2> topk_by_key(
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k,
+  StrictWeakOrdering comp);
+
+/*! \p segmented_topk selects the largest elements of every segment of a range, as a batch of \p topk. The
+ *  <tt>offsets_last - offsets_first - 1</tt> segments are delimited by the offsets: segment \c i is
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>. As with \p topk, its
+ *  <tt>min(k, offsets_first[i + 1] - offsets_first[i])</tt> largest elements are copied to <tt>result + i * k</tt>,
+ *  and the rest of its \p k output positions are left unchanged.
+ *
+ *  The host systems select the elements of different segments in parallel when there are at least as many segments
+ *  as threads, and the elements of every segment in parallel otherwise.
+ *
+ *  This version of \p segmented_topk compares objects using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range.
+ *  \param k The number of elements to select from every segment.
+ *  \return The end of the output range, <tt>result + (offsets_last - offsets_first - 1) * k</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">
+ *          LessThan Comparable</a>.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p RandomAccessIterator's \c value_type is convertible to its
+ *          \c value_type.
+ *  \tparam Size is an integral type.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *  \pre The output range shall not overlap the input range.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_topk using the \p thrust::host execution policy
+ *  for parallelization:
+ *
+ *  \code
+ *  #include <thrust/topk.h>
+ *  #include <thrust/execution_policy.h>
+ *  int A[]       = {1, 9, 4, 7, 2, 9, 3};
+ *  int offsets[] = {0, 4, 5, 7};
+ *  int B[6];
+ *  thrust::segmented_topk(thrust::host, offsets, offsets + 4, A, B, 2);
+ *  // B is now {9, 7, 2, ?, 9, 3}, where ? is unchanged
+ *  \endcode
+ *
+ *  \see topk
+ *  \see segmented_topk_by_key
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename Size>
+_CCCL_HOST_DEVICE OutputIterator segmented_topk(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  Size k);
+
+/*! \p segmented_topk selects the first elements of every segment of a range in the order \p comp. Segment \c i is
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, and its first
+ *  <tt>min(k, offsets_first[i + 1] - offsets_first[i])</tt> elements are copied to <tt>result + i * k</tt>.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range.
+ *  \param k The number of elements to select from every segment.
+ *  \param comp The comparison operator, which returns \c true if its first argument comes before its second argument.
+ *  \return The end of the output range, <tt>result + (offsets_last - offsets_first - 1) * k</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is convertible to \p StrictWeakOrdering's arguments.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p RandomAccessIterator's \c value_type is convertible to its
+ *          \c value_type.
+ *  \tparam Size is an integral type.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">
+ *          Strict Weak Ordering</a>.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *  \pre The output range shall not overlap the input range.
+ *
+ *  \see topk
+ *  \see segmented_topk_by_key
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename Size,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator segmented_topk(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  Size k,
+  StrictWeakOrdering comp);
+
+/*! \p segmented_topk selects the largest elements of every segment of a range. Segment \c i is
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, and its
+ *  <tt>min(k, offsets_first[i + 1] - offsets_first[i])</tt> largest elements are copied to <tt>result + i * k</tt>.
+ *
+ *  This version of \p segmented_topk compares objects using \c operator<.
+ *
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range.
+ *  \param k The number of elements to select from every segment.
+ *  \return The end of the output range, <tt>result + (offsets_last - offsets_first - 1) * k</tt>.
+ *
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">
+ *          LessThan Comparable</a>.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p RandomAccessIterator's \c value_type is convertible to its
+ *          \c value_type.
+ *  \tparam Size is an integral type.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *  \pre The output range shall not overlap the input range.
+ *
+ *  \see topk
+ *  \see segmented_topk_by_key
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename OffsetIterator, typename RandomAccessIterator, typename OutputIterator, typename Size>
+OutputIterator segmented_topk(
+  OffsetIterator offsets_first, OffsetIterator offsets_last, RandomAccessIterator first, OutputIterator result, Size k);
+
+/*! \p segmented_topk selects the first elements of every segment of a range in the order \p comp. Segment \c i is
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, and its first
+ *  <tt>min(k, offsets_first[i + 1] - offsets_first[i])</tt> elements are copied to <tt>result + i * k</tt>.
+ *
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param first The beginning of the input range.
+ *  \param result The beginning of the output range.
+ *  \param k The number of elements to select from every segment.
+ *  \param comp The comparison operator, which returns \c true if its first argument comes before its second argument.
+ *  \return The end of the output range, <tt>result + (offsets_last - offsets_first - 1) * k</tt>.
+ *
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is convertible to \p StrictWeakOrdering's arguments.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p RandomAccessIterator's \c value_type is convertible to its
+ *          \c value_type.
+ *  \tparam Size is an integral type.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">
+ *          Strict Weak Ordering</a>.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *  \pre The output range shall not overlap the input range.
+ *
+ *  \see topk
+ *  \see segmented_topk_by_key
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename OffsetIterator,
+          typename RandomAccessIterator,
+          typename OutputIterator,
+          typename Size,
+          typename StrictWeakOrdering>
+OutputIterator segmented_topk(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator first,
+  OutputIterator result,
+  Size k,
+  StrictWeakOrdering comp);
+
+/*! \p segmented_topk_by_key selects the largest keys of every segment of a range of keys, and their values, as a
+ *  batch of \p topk_by_key. Segment \c i is <tt>[keys_first + offsets_first[i], keys_first +
+ *  offsets_first[i + 1])</tt>; its <tt>min(k, offsets_first[i + 1] - offsets_first[i])</tt> largest keys are copied to
+ *  <tt>keys_result + i * k</tt> and their values to <tt>values_result + i * k</tt>.
+ *
+ *  This version of \p segmented_topk_by_key compares keys using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param keys_first The beginning of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_result The beginning of the output key range.
+ *  \param values_result The beginning of the output value range.
+ *  \param k The number of elements to select from every segment.
+ *  \return A pair of iterators at the end of the output ranges, <tt>keys_result + num_segments * k</tt> and
+ *          <tt>values_result + num_segments * k</tt>, where \c num_segments is <tt>offsets_last - offsets_first -
+ *          1</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator1 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">
+ *          LessThan Comparable</a>.
+ *  \tparam RandomAccessIterator2 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p RandomAccessIterator1's \c value_type is convertible to its
+ *          \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p RandomAccessIterator2's \c value_type is convertible to its
+ *          \c value_type.
+ *  \tparam Size is an integral type.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *  \pre The output ranges shall not overlap the input ranges.
+ *
+ *  \see topk_by_key
+ *  \see segmented_topk
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> segmented_topk_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k);
+
+/*! \p segmented_topk_by_key selects the first keys of every segment of a range of keys in the order \p comp, and their
+ *  values. Segment \c i is <tt>[keys_first + offsets_first[i], keys_first + offsets_first[i + 1])</tt>; its first
+ *  <tt>min(k, offsets_first[i + 1] - offsets_first[i])</tt> keys are copied to <tt>keys_result + i * k</tt> and their
+ *  values to <tt>values_result + i * k</tt>.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param keys_first The beginning of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_result The beginning of the output key range.
+ *  \param values_result The beginning of the output value range.
+ *  \param k The number of elements to select from every segment.
+ *  \param comp The comparison operator, which returns \c true if its first argument comes before its second argument.
+ *  \return A pair of iterators at the end of the output ranges, <tt>keys_result + num_segments * k</tt> and
+ *          <tt>values_result + num_segments * k</tt>, where \c num_segments is <tt>offsets_last - offsets_first -
+ *          1</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator1 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is convertible to \p StrictWeakOrdering's arguments.
+ *  \tparam RandomAccessIterator2 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p RandomAccessIterator1's \c value_type is convertible to its
+ *          \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p RandomAccessIterator2's \c value_type is convertible to its
+ *          \c value_type.
+ *  \tparam Size is an integral type.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">
+ *          Strict Weak Ordering</a>.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *  \pre The output ranges shall not overlap the input ranges.
+ *
+ *  \see topk_by_key
+ *  \see segmented_topk
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename DerivedPolicy,
+          typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE ::cuda::std::pair<OutputIterator1, OutputIterator2> segmented_topk_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k,
+  StrictWeakOrdering comp);
+
+/*! \p segmented_topk_by_key selects the largest keys of every segment of a range of keys, and their values. Segment
+ *  \c i is <tt>[keys_first + offsets_first[i], keys_first + offsets_first[i + 1])</tt>; its
+ *  <tt>min(k, offsets_first[i + 1] - offsets_first[i])</tt> largest keys are copied to <tt>keys_result + i * k</tt>
+ *  and their values to <tt>values_result + i * k</tt>.
+ *
+ *  This version of \p segmented_topk_by_key compares keys using \c operator<.
+ *
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param keys_first The beginning of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_result The beginning of the output key range.
+ *  \param values_result The beginning of the output value range.
+ *  \param k The number of elements to select from every segment.
+ *  \return A pair of iterators at the end of the output ranges, <tt>keys_result + num_segments * k</tt> and
+ *          <tt>values_result + num_segments * k</tt>, where \c num_segments is <tt>offsets_last - offsets_first -
+ *          1</tt>.
+ *
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator1 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is a model of <a href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">
+ *          LessThan Comparable</a>.
+ *  \tparam RandomAccessIterator2 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p RandomAccessIterator1's \c value_type is convertible to its
+ *          \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p RandomAccessIterator2's \c value_type is convertible to its
+ *          \c value_type.
+ *  \tparam Size is an integral type.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *  \pre The output ranges shall not overlap the input ranges.
+ *
+ *  \see topk_by_key
+ *  \see segmented_topk
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size>
+::cuda::std::pair<OutputIterator1, OutputIterator2> segmented_topk_by_key(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k);
+
+/*! \p segmented_topk_by_key selects the first keys of every segment of a range of keys in the order \p comp, and their
+ *  values. Segment \c i is <tt>[keys_first + offsets_first[i], keys_first + offsets_first[i + 1])</tt>; its first
+ *  <tt>min(k, offsets_first[i + 1] - offsets_first[i])</tt> keys are copied to <tt>keys_result + i * k</tt> and their
+ *  values to <tt>values_result + i * k</tt>.
+ *
+ *  \param offsets_first The beginning of the range of offsets.
+ *  \param offsets_last The end of the range of offsets.
+ *  \param keys_first The beginning of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_result The beginning of the output key range.
+ *  \param values_result The beginning of the output value range.
+ *  \param k The number of elements to select from every segment.
+ *  \param comp The comparison operator, which returns \c true if its first argument comes before its second argument.
+ *  \return A pair of iterators at the end of the output ranges, <tt>keys_result + num_segments * k</tt> and
+ *          <tt>values_result + num_segments * k</tt>, where \c num_segments is <tt>offsets_last - offsets_first -
+ *          1</tt>.
+ *
+ *  \tparam OffsetIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and its \c value_type is an integral type.
+ *  \tparam RandomAccessIterator1 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          its \c value_type is convertible to \p StrictWeakOrdering's arguments.
+ *  \tparam RandomAccessIterator2 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p RandomAccessIterator1's \c value_type is convertible to its
+ *          \c value_type.
+ *  \tparam OutputIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">
+ *          Random Access Iterator</a>, and \p RandomAccessIterator2's \c value_type is convertible to its
+ *          \c value_type.
+ *  \tparam Size is an integral type.
+ *  \tparam StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">
+ *          Strict Weak Ordering</a>.
+ *
+ *  \pre The offsets shall be sorted in ascending order.
+ *  \pre The output ranges shall not overlap the input ranges.
+ *
+ *  \see topk_by_key
+ *  \see segmented_topk
+ *
+ *  \verbatim embed:rst:leading-asterisk
+ *     .. versionadded:: 3.5.0
+ *  \endverbatim
+ */
+template <typename OffsetIterator,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Size,
+          typename StrictWeakOrdering>
+::cuda::std::pair<OutputIterator1, OutputIterator2> segmented_topk_by_key(
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  Size k,
+  StrictWeakOrdering comp);
+
+/*! \} // end sorting
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/topk.inl>
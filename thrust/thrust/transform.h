@@ -110,7 +110,7 @@ _CCCL_HOST_DEVICE OutputIterator transform(
   OutputIterator result,
   UnaryFunction op)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::transform");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::transform");
   using thrust::system::detail::generic::transform;
   return transform(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, op);
 }
@@ -252,7 +252,7 @@ _CCCL_HOST_DEVICE OutputIterator transform(
   OutputIterator result,
   BinaryFunction op)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::transform");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::transform");
   using thrust::system::detail::generic::transform;
   return transform(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, op);
 }
@@ -413,7 +413,7 @@ _CCCL_HOST_DEVICE ForwardIterator transform_if(
   UnaryFunction op,
   Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::transform_if");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::transform_if");
   using thrust::system::detail::generic::transform_if;
   return transform_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, op, pred);
 }
@@ -582,7 +582,7 @@ _CCCL_HOST_DEVICE ForwardIterator transform_if(
   UnaryFunction op,
   Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::transform_if");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::transform_if");
   using thrust::system::detail::generic::transform_if;
   return transform_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, result, op, pred);
@@ -767,7 +767,7 @@ _CCCL_HOST_DEVICE ForwardIterator transform_if(
   BinaryFunction binary_op,
   Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::transform_if");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::transform_if");
   using thrust::system::detail::generic::transform_if;
   return transform_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -892,7 +892,7 @@ _CCCL_HOST_DEVICE OutputIterator transform_n(
   OutputIterator result,
   UnaryFunction op)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::transform_n");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::transform_n");
   using thrust::system::detail::generic::transform_n;
   return transform_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, count, result, op);
 }
@@ -931,7 +931,7 @@ _CCCL_HOST_DEVICE OutputIterator transform_n(
   OutputIterator result,
   BinaryFunction op)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::transform_n");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::transform_n");
   using thrust::system::detail::generic::transform_n;
   return transform_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, count, first2, result, op);
 }
@@ -975,7 +975,7 @@ _CCCL_HOST_DEVICE ForwardIterator transform_if_n(
   UnaryFunction op,
   Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::transform_if_n");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::transform_if_n");
   using thrust::system::detail::generic::transform_if_n;
   return transform_if_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, count, result, op, pred);
 }
@@ -1020,7 +1020,7 @@ _CCCL_HOST_DEVICE ForwardIterator transform_if_n(
   UnaryFunction op,
   Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::transform_if_n");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::transform_if_n");
   using thrust::system::detail::generic::transform_if_n;
   return transform_if_n(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, count, stencil, result, op, pred);
@@ -1074,7 +1074,7 @@ _CCCL_HOST_DEVICE ForwardIterator transform_if_n(
   BinaryFunction binary_op,
   Predicate pred)
 {
-  _CCCL_NVTX_RANGE_SCOPE("thrust::transform_if_n");
+  _THRUST_POLICY_RANGE_SCOPE(DerivedPolicy, "thrust::transform_if_n");
   using thrust::system::detail::generic::transform_if_n;
   return transform_if_n(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),